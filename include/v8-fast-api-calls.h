@@ -0,0 +1,173 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+/**
+ * This file provides additional API on top of the default one for making
+ * API calls, which come from embedder C++ functions. The functions are being
+ * called directly from optimized code, doing all the necessary typechecks
+ * in the compiler itself, instead of on the embedder side. Hence the "fast"
+ * in the name.
+ *
+ * A fast C function is described by a CFunction, which is passed as the
+ * last argument to FunctionTemplate::New next to the regular callback:
+ *
+ * \code
+ *    void SlowCallback(const FunctionCallbackInfo<Value>& info) {
+ *      // ...
+ *    }
+ *
+ *    int32_t FastCallback(ApiObject receiver, int32_t param) {
+ *      // ...
+ *    }
+ *
+ *    CFunction fast_callback = CFunction::Make(FastCallback);
+ *    Local<FunctionTemplate> method_template = FunctionTemplate::New(
+ *        isolate, SlowCallback, data, signature, length,
+ *        ConstructorBehavior::kThrow, SideEffectType::kHasSideEffect,
+ *        &fast_callback);
+ * \endcode
+ *
+ * The first parameter of a fast C function is always the receiver, followed
+ * by the JavaScript arguments in order. Supported parameter types are
+ * int32_t and uint32_t; supported return types are void, int32_t and
+ * uint32_t. JavaScript number arguments are converted as if by ToInt32 and
+ * ToUint32 respectively. If any argument is not a number, or the number of
+ * arguments doesn't match, the regular callback is called instead.
+ *
+ * The fast C function is called without entering V8, so it must not
+ * allocate on the V8 heap, call back into JavaScript, throw exceptions or
+ * otherwise use the isolate. The regular callback must be observably
+ * equivalent, since V8 is free to call either of them.
+ *
+ * Function templates with a fast C function cannot be serialized into a
+ * snapshot yet.
+ */
+
+#ifndef INCLUDE_V8_FAST_API_CALLS_H_
+#define INCLUDE_V8_FAST_API_CALLS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "v8config.h"  // NOLINT(build/include)
+
+namespace v8 {
+
+class CTypeInfo {
+ public:
+  enum class Type : uint8_t {
+    kVoid,
+    kInt32,
+    kUint32,
+    kReceiver,
+  };
+
+  constexpr explicit CTypeInfo(Type type) : type_(type) {}
+
+  constexpr Type GetType() const { return type_; }
+
+ private:
+  Type type_;
+};
+
+class CFunctionInfo {
+ public:
+  virtual const CTypeInfo& ReturnInfo() const = 0;
+  virtual unsigned int ArgumentCount() const = 0;
+  virtual const CTypeInfo& ArgumentInfo(unsigned int index) const = 0;
+};
+
+/**
+ * The receiver of a fast C function call. Holds the raw address of the
+ * receiver object, which is only valid for the duration of the call.
+ */
+struct ApiObject {
+  uintptr_t address;
+};
+
+namespace internal {
+
+template <typename T>
+struct GetCType;
+
+#define SPECIALIZE_GET_C_TYPE_FOR(ctype, ctypeinfo)   \
+  template <>                                         \
+  struct GetCType<ctype> {                            \
+    static constexpr CTypeInfo Get() {                \
+      return CTypeInfo(CTypeInfo::Type::ctypeinfo);   \
+    }                                                 \
+  };
+
+SPECIALIZE_GET_C_TYPE_FOR(void, kVoid)
+SPECIALIZE_GET_C_TYPE_FOR(int32_t, kInt32)
+SPECIALIZE_GET_C_TYPE_FOR(uint32_t, kUint32)
+SPECIALIZE_GET_C_TYPE_FOR(ApiObject, kReceiver)
+
+#undef SPECIALIZE_GET_C_TYPE_FOR
+
+template <typename R, typename Receiver, typename... Args>
+class CFunctionInfoImpl : public CFunctionInfo {
+ public:
+  CFunctionInfoImpl()
+      : return_info_(GetCType<R>::Get()),
+        arg_count_(sizeof...(Args) + 1),
+        arg_info_{GetCType<Receiver>::Get(), GetCType<Args>::Get()...} {
+    static_assert(GetCType<Receiver>::Get().GetType() ==
+                      CTypeInfo::Type::kReceiver,
+                  "The first argument of a fast C function must be the "
+                  "receiver, i.e. an ApiObject.");
+  }
+
+  const CTypeInfo& ReturnInfo() const override { return return_info_; }
+  unsigned int ArgumentCount() const override { return arg_count_; }
+  const CTypeInfo& ArgumentInfo(unsigned int index) const override {
+    return arg_info_[index];
+  }
+
+ private:
+  const CTypeInfo return_info_;
+  const unsigned int arg_count_;
+  const CTypeInfo arg_info_[sizeof...(Args) + 1];
+};
+
+}  // namespace internal
+
+class CFunction {
+ public:
+  constexpr CFunction() : address_(nullptr), type_info_(nullptr) {}
+
+  const CTypeInfo& ReturnInfo() const { return type_info_->ReturnInfo(); }
+
+  const CTypeInfo& ArgumentInfo(unsigned int index) const {
+    return type_info_->ArgumentInfo(index);
+  }
+
+  unsigned int ArgumentCount() const { return type_info_->ArgumentCount(); }
+
+  const void* GetAddress() const { return address_; }
+  const CFunctionInfo* GetTypeInfo() const { return type_info_; }
+
+  template <typename F>
+  static CFunction Make(F* func) {
+    return CFunction(reinterpret_cast<const void*>(func),
+                     GetCFunctionInfo(func));
+  }
+
+ private:
+  template <typename R, typename... Args>
+  static const CFunctionInfo* GetCFunctionInfo(R (*)(Args...)) {
+    static internal::CFunctionInfoImpl<R, Args...> instance;
+    return &instance;
+  }
+
+  CFunction(const void* address, const CFunctionInfo* type_info)
+      : address_(address), type_info_(type_info) {}
+
+  const void* address_;
+  const CFunctionInfo* type_info_;
+};
+
+}  // namespace v8
+
+#endif  // INCLUDE_V8_FAST_API_CALLS_H_
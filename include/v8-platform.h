@@ -27,6 +27,31 @@ class Task {
   virtual void Run() = 0;
 };
 
+/**
+ * A set of priorities for tasks posted with
+ * |Platform::PostTaskOnWorkerThread| and jobs posted with |Platform::PostJob|.
+ */
+enum class TaskPriority : uint8_t {
+  /**
+   * Best effort tasks are not critical for performance of the application. The
+   * platform implementation should preempt such tasks if higher priority tasks
+   * arrive. Example: tier-up compilation of Wasm code.
+   */
+  kBestEffort,
+  /**
+   * User visible tasks are long running background tasks that will improve
+   * performance and memory usage of the application upon completion.
+   * Example: background compilation and concurrent garbage collection.
+   */
+  kUserVisible,
+  /**
+   * User blocking tasks are the highest priority tasks that block the execution
+   * thread (e.g. parallel phases of garbage collection). They must be finished
+   * as soon as possible.
+   */
+  kUserBlocking,
+};
+
 /**
  * An IdleTask represents a unit of work to be performed in idle time.
  * The Run method is invoked with an argument that specifies the deadline in
@@ -98,6 +123,84 @@ class TaskRunner {
   TaskRunner& operator=(const TaskRunner&) = delete;
 };
 
+/**
+ * Delegate that is passed to a |JobTask| while it is being run on a thread.
+ */
+class JobDelegate {
+ public:
+  /**
+   * Returns true if this thread should return from the worker task on the
+   * current thread ASAP. Workers should periodically invoke ShouldYield as
+   * often as is reasonable.
+   */
+  virtual bool ShouldYield() = 0;
+
+  /**
+   * Notifies the scheduler that max concurrency was increased, and the number
+   * of workers should be adjusted accordingly. See Platform::PostJob() for more
+   * details.
+   */
+  virtual void NotifyConcurrencyIncrease() = 0;
+
+ protected:
+  virtual ~JobDelegate() = default;
+};
+
+/**
+ * Handle returned when posting a Job. Provides methods to control execution of
+ * the posted Job.
+ */
+class JobHandle {
+ public:
+  virtual ~JobHandle() = default;
+
+  /**
+   * Notifies the scheduler that max concurrency was increased, and the number
+   * of workers should be adjusted accordingly. See Platform::PostJob() for more
+   * details.
+   */
+  virtual void NotifyConcurrencyIncrease() = 0;
+
+  /**
+   * Contributes to the job on this thread. Doesn't return until all tasks have
+   * completed and max concurrency becomes 0. When Join() is called and max
+   * concurrency reaches 0, it should not increase again. This also promotes
+   * this Job's priority to be at least as high as the calling thread's
+   * priority.
+   */
+  virtual void Join() = 0;
+
+  /**
+   * Forces all existing workers to yield ASAP. Waits until they have all
+   * returned from the Job's callback before returning.
+   */
+  virtual void Cancel() = 0;
+
+  /**
+   * Returns true if associated with a Job and other methods may be called.
+   * Returns false after Join() or Cancel() was called.
+   */
+  virtual bool IsRunning() = 0;
+};
+
+/**
+ * A JobTask represents work to run in parallel from Platform::PostJob().
+ */
+class JobTask {
+ public:
+  virtual ~JobTask() = default;
+
+  virtual void Run(JobDelegate* delegate) = 0;
+
+  /**
+   * Controls the maximum number of threads calling Run() concurrently. Run() is
+   * only invoked if the number of threads previously running Run() was less
+   * than the value returned. Since GetMaxConcurrency() is a leaf function, it
+   * must not call back any JobHandle methods.
+   */
+  virtual size_t GetMaxConcurrency() const = 0;
+};
+
 /**
  * The interface represents complex arguments to trace events.
  */
@@ -257,6 +360,13 @@ class PageAllocator {
    * memory area brings the memory transparently back.
    */
   virtual bool DiscardSystemPages(void* address, size_t size) { return true; }
+
+  /**
+   * Hints that the given [address, address + size) range should be backed by
+   * huge pages, e.g. transparent huge pages on Linux. Returns false if the
+   * hint is not supported.
+   */
+  virtual bool AdviseHugePages(void* address, size_t size) { return false; }
 };
 
 /**
@@ -331,6 +441,21 @@ class Platform {
     CallOnWorkerThread(std::move(task));
   }
 
+  /**
+   * Schedules a task with the given |priority| to be invoked on a worker
+   * thread. Tasks with higher priority should be run before tasks with lower
+   * priority that were posted earlier.
+   */
+  virtual void PostTaskOnWorkerThread(TaskPriority priority,
+                                      std::unique_ptr<Task> task) {
+    // Embedders may optionally override this to honor the priority of tasks.
+    if (priority == TaskPriority::kUserBlocking) {
+      CallBlockingTaskOnWorkerThread(std::move(task));
+    } else {
+      CallOnWorkerThread(std::move(task));
+    }
+  }
+
   /**
    * Schedules a task to be invoked on a worker thread after |delay_in_seconds|
    * expires.
@@ -338,6 +463,58 @@ class Platform {
   virtual void CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
                                          double delay_in_seconds) = 0;
 
+  /**
+   * Posts |job_task| to run in parallel. Returns a JobHandle associated with
+   * the Job, which can be joined or canceled.
+   * This avoids degenerate cases:
+   * - Calling CallOnWorkerThread() for each work item, causing significant
+   *   overhead.
+   * - Fixed number of CallOnWorkerThread() calls that split the work and might
+   *   run for a long time. This is problematic when many components post
+   *   "num cores" tasks and all expect to use all the cores. In these cases,
+   *   the scheduler lacks context to be fair to multiple same-priority requests
+   *   and/or ability to request lower priority work to yield when high priority
+   *   work comes in.
+   * A canonical implementation of |job_task| looks like:
+   * class MyJobTask : public JobTask {
+   *  public:
+   *   MyJobTask(...) : worker_queue_(...) {}
+   *   // JobTask:
+   *   void Run(JobDelegate* delegate) override {
+   *     while (!delegate->ShouldYield()) {
+   *       // Smallest unit of work.
+   *       auto work_item = worker_queue_.TakeWorkItem(); // Thread safe.
+   *       if (!work_item) return;
+   *       ProcessWork(work_item);
+   *     }
+   *   }
+   *
+   *   size_t GetMaxConcurrency() const override {
+   *     return worker_queue_.GetSize(); // Thread safe.
+   *   }
+   * };
+   * auto handle = PostJob(TaskPriority::kUserVisible,
+   *                       std::make_unique<MyJobTask>(...));
+   * handle->Join();
+   *
+   * PostJob() and methods of the returned JobHandle/JobDelegate, must never be
+   * called while holding a lock that could be acquired by JobTask::Run or
+   * JobTask::GetMaxConcurrency -- that could result in a deadlock. This is
+   * because [1] JobTask::GetMaxConcurrency may be invoked while holding
+   * internal lock (A), hence JobTask::GetMaxConcurrency can only use a lock (B)
+   * if that lock is *never* held while calling back into JobHandle from any
+   * thread (A=>B/B=>A deadlock) and [2] JobTask::Run or
+   * JobTask::GetMaxConcurrency may be invoked synchronously from JobHandle
+   * (B=>JobHandle::foo=>B deadlock).
+   *
+   * Returns nullptr if the platform does not support jobs.
+   */
+  virtual std::unique_ptr<JobHandle> PostJob(
+      TaskPriority priority, std::unique_ptr<JobTask> job_task) {
+    // Embedders may optionally override this to support jobs.
+    return nullptr;
+  }
+
   /**
    * Schedules a task to be invoked on a foreground thread wrt a specific
    * |isolate|. Tasks posted for the same isolate should be execute in order of
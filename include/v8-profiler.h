@@ -122,7 +122,11 @@ struct TickSample {
 class V8_EXPORT CpuProfileNode {
  public:
   struct LineTick {
-    /** The 1-based number of the source line where the function originates. */
+    /**
+     * The 1-based number of the source line where the function originates.
+     * For WebAssembly functions this is the 1-based byte offset into the
+     * function body instead.
+     */
     int line;
 
     /** The count of samples associated with the source line. */
@@ -269,6 +273,17 @@ enum CpuProfilingMode {
   kCallerLineNumbers,
 };
 
+/**
+ * Callback invoked with each batch of samples of a profile started in
+ * streaming mode, see CpuProfiler::StartProfiling. |profile| only holds the
+ * samples of the current batch, which are discarded once the callback
+ * returns; the top down tree keeps growing and the node ids of the samples
+ * stay valid for the whole profile. The callback is invoked on the profiler
+ * thread and must not call into V8.
+ */
+typedef void (*CpuProfileSampleBatchCallback)(const CpuProfile* profile,
+                                              void* data);
+
 /**
  * Interface for controlling CPU profiling. Instance of the
  * profiler can be created using v8::CpuProfiler::New method.
@@ -321,6 +336,18 @@ class V8_EXPORT CpuProfiler {
    */
   void StartProfiling(Local<String> title, bool record_samples = false);
 
+  /**
+   * Starts collecting CPU profile in streaming mode. Samples are recorded,
+   * but instead of accumulating in the profile they are handed to |callback|
+   * in batches of |batch_size| samples. The remaining samples are handed
+   * over when the profile is stopped. Together with a large sampling
+   * interval this allows profiling continuously with bounded memory use;
+   * stopping and restarting the profile also resets the top down tree.
+   */
+  void StartProfiling(Local<String> title, CpuProfilingMode mode,
+                      CpuProfileSampleBatchCallback callback, void* data,
+                      int batch_size);
+
   /**
    * Stops collecting CPU profile with a given title and returns it.
    * If the title given is empty, finishes the last profile started.
@@ -479,7 +506,8 @@ class V8_EXPORT OutputStream {  // NOLINT
 class V8_EXPORT HeapSnapshot {
  public:
   enum SerializationFormat {
-    kJSON = 0  // See format description near 'Serialize' method.
+    kJSON = 0,   // See format description near 'Serialize' method.
+    kBinary = 1  // See format description near 'Serialize' method.
   };
 
   /** Returns the root node of the heap graph. */
@@ -529,6 +557,24 @@ class V8_EXPORT HeapSnapshot {
    *
    * Nodes reference strings, other nodes, and edges by their indexes
    * in corresponding arrays.
+   *
+   * The binary format is a more compact alternative for large heaps. All
+   * numbers are unsigned LEB128 varints. The stream starts with the bytes
+   * "V8HS" and a format version, followed by
+   *
+   *  - the node count and, per node, type, name, id, self_size, edge_count
+   *    and trace_node_id,
+   *  - the edge count and, per edge, type, name_or_index and the index of the
+   *    target node (not multiplied by the number of node fields),
+   *  - the location count and, per location, node index, script_id, line
+   *    and column,
+   *  - the sample count and, per sample, timestamp_us and last_assigned_id,
+   *  - the string count and, per string, its length in bytes and its UTF-8
+   *    contents. String ids start at 1.
+   *
+   * Nodes and edges are in the same order as in the JSON format, and edges
+   * are grouped by their source node. Allocation trace information is only
+   * available in the JSON format.
    */
   void Serialize(OutputStream* stream,
                  SerializationFormat format = kJSON) const;
@@ -653,6 +699,18 @@ class V8_EXPORT AllocationProfile {
      * what samples were added or removed between two snapshots.
      */
     uint64_t sample_id;
+
+    /**
+     * The number of garbage collections the sampled object survived so far.
+     * Samples that keep surviving many collections point at allocation sites
+     * that retain memory.
+     */
+    unsigned int gc_count;
+
+    /**
+     * The number of full (mark-compact) garbage collections among them.
+     */
+    unsigned int full_gc_count;
   };
 
   /**
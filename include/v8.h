@@ -41,6 +41,7 @@ class BigInt;
 class BigIntObject;
 class Boolean;
 class BooleanObject;
+class CFunction;
 class Context;
 class Data;
 class Date;
@@ -112,11 +113,14 @@ template<typename T> class ReturnValue;
 
 namespace internal {
 class Arguments;
+class BackgroundDeserializeTask;
 class DeferredHandles;
 class Heap;
 class HeapObject;
 class Isolate;
+class JsonChunkAccumulator;
 class LocalEmbedderHeapTracer;
+class MicrotaskQueue;
 class NeverReadOnlySpaceObject;
 struct ScriptStreamingData;
 template<typename T> class CustomArguments;
@@ -1245,6 +1249,11 @@ class V8_EXPORT Script {
 };
 
 
+/**
+ * Whether a source is compiled as a classic script or as an ES module.
+ */
+enum class ScriptType { kClassic, kModule };
+
 /**
  * For compiling scripts.
  */
@@ -1288,6 +1297,8 @@ class V8_EXPORT ScriptCompiler {
     CachedData& operator=(const CachedData&) = delete;
   };
 
+  class ConsumeCodeCacheTask;
+
   /**
    * Source code which can be then compiled to a UnboundScript or Script.
    */
@@ -1296,6 +1307,12 @@ class V8_EXPORT ScriptCompiler {
     // Source takes ownership of CachedData.
     V8_INLINE Source(Local<String> source_string, const ScriptOrigin& origin,
                      CachedData* cached_data = nullptr);
+    // Source takes ownership of both CachedData and ConsumeCodeCacheTask. The
+    // task must have been created for |cached_data| and its Run method must
+    // have returned before the Source is compiled.
+    V8_INLINE Source(Local<String> source_string, const ScriptOrigin& origin,
+                     CachedData* cached_data,
+                     ConsumeCodeCacheTask* consume_cache_task);
     V8_INLINE Source(Local<String> source_string,
                      CachedData* cached_data = nullptr);
     V8_INLINE ~Source();
@@ -1328,6 +1345,7 @@ class V8_EXPORT ScriptCompiler {
     // set), or hold newly generated cache data (kProduce*Cache flags) are
     // set when calling a compile method.
     CachedData* cached_data;
+    std::unique_ptr<ConsumeCodeCacheTask> consume_cache_task;
   };
 
   /**
@@ -1419,6 +1437,27 @@ class V8_EXPORT ScriptCompiler {
     internal::ScriptStreamingData* data_;
   };
 
+  /**
+   * A task which the embedder can run on a background thread to perform the
+   * parts of consuming a code cache that do not need the isolate, such as
+   * copying the data into an aligned buffer and verifying its checksum.
+   * Returned by ScriptCompiler::StartConsumingCodeCache.
+   */
+  class V8_EXPORT ConsumeCodeCacheTask final {
+   public:
+    ~ConsumeCodeCacheTask();
+
+    void Run();
+
+   private:
+    friend class ScriptCompiler;
+
+    explicit ConsumeCodeCacheTask(
+        std::unique_ptr<internal::BackgroundDeserializeTask> impl);
+
+    std::unique_ptr<internal::BackgroundDeserializeTask> impl_;
+  };
+
   enum CompileOptions {
     kNoCompileOptions = 0,
     kConsumeCodeCache,
@@ -1495,6 +1534,32 @@ class V8_EXPORT ScriptCompiler {
       Isolate* isolate, StreamedSource* source,
       CompileOptions options = kNoCompileOptions);
 
+  /**
+   * Like StartStreamingScript, but the returned task parses and compiles the
+   * streamed source as a classic script or as an ES module depending on
+   * |type|. A streamed module must be finalized with the CompileModule
+   * overload taking a StreamedSource below, a streamed classic script with
+   * Compile.
+   *
+   * Since each task only touches its own StreamedSource, an embedder loading
+   * a module graph can run one task per fetched module concurrently on
+   * worker threads and only finalize them on the main thread.
+   */
+  static ScriptStreamingTask* StartStreaming(Isolate* isolate,
+                                             StreamedSource* source,
+                                             ScriptType type);
+
+  /**
+   * Returns a task which prepares |cached_data| for consumption off the main
+   * thread. The user is responsible for running the task on a background
+   * thread and then passing it, together with |cached_data|, to a Source
+   * which is compiled with kConsumeCodeCache. This keeps the checksum
+   * verification of large caches off the main thread; the heap-allocating
+   * part of deserialization still happens during compilation.
+   */
+  static ConsumeCodeCacheTask* StartConsumingCodeCache(
+      const CachedData* cached_data);
+
   /**
    * Compiles a streamed script (bound to current context).
    *
@@ -1538,6 +1603,18 @@ class V8_EXPORT ScriptCompiler {
       CompileOptions options = kNoCompileOptions,
       NoCacheReason no_cache_reason = kNoCacheNoReason);
 
+  /**
+   * Compiles a streamed ES module.
+   *
+   * This can only be called after the streaming has finished (the
+   * ScriptStreamingTask returned by StartStreaming with ScriptType::kModule
+   * has been run). As with Compile, the embedder needs to pass the full source
+   * here, and |origin| must have is_module set.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Module> CompileModule(
+      Local<Context> context, StreamedSource* v8_source,
+      Local<String> full_source_string, const ScriptOrigin& origin);
+
   /**
    * Compile a function for a given context. This is equivalent to running
    *
@@ -1858,6 +1935,62 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Receives the UTF-8 encoded output of JSON::Stringify in chunks.
+   */
+  class V8_EXPORT OutputSink {
+   public:
+    virtual ~OutputSink() = default;
+
+    /**
+     * Called with the next |length| bytes of output. The data is only valid
+     * for the duration of the call. Must not call back into V8.
+     */
+    virtual void Write(const char* data, size_t length) = 0;
+  };
+
+  /**
+   * Like Stringify above, but writes the result to |sink| as UTF-8 instead
+   * of returning it, without creating a flat copy of the whole string first.
+   *
+   * \return Just(true) if the object was stringified successfully.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> Stringify(
+      Local<Context> context, Local<Value> json_object, OutputSink* sink,
+      Local<String> gap = Local<String>());
+
+  /**
+   * Parses JSON text which arrives as a sequence of UTF-8 encoded chunks, for
+   * example from the network. Each chunk is decoded as it is appended and
+   * does not have to be kept alive afterwards. Chunk boundaries may fall
+   * anywhere, including in the middle of a UTF-8 sequence.
+   */
+  class V8_EXPORT ChunkedParser {
+   public:
+    ChunkedParser();
+    ~ChunkedParser();
+
+    /**
+     * Appends the next |length| bytes of the text. Does not use V8 and may be
+     * called on any thread, as long as calls are not concurrent.
+     */
+    void Append(const uint8_t* data, size_t length);
+
+    /**
+     * Parses the text appended so far, like JSON::Parse, and resets the
+     * parser so that it can be used for the next text.
+     *
+     * \return The corresponding value if successfully parsed.
+     */
+    V8_WARN_UNUSED_RESULT MaybeLocal<Value> Finish(Local<Context> context);
+
+   private:
+    internal::JsonChunkAccumulator* accumulator_;
+
+    ChunkedParser(const ChunkedParser&) = delete;
+    ChunkedParser& operator=(const ChunkedParser&) = delete;
+  };
 };
 
 /**
@@ -1903,6 +2036,39 @@ class V8_EXPORT ValueSerializer {
 
     virtual Maybe<uint32_t> GetWasmModuleTransferId(
         Isolate* isolate, Local<WasmModuleObject> module);
+
+    /**
+     * Called when the ValueSerializer is going to serialize an external
+     * string (see String::IsExternal). The embedder can return an ID for the
+     * string to pass its resource by reference instead of copying the
+     * contents into the buffer. When deserializing, this ID will be passed to
+     * ValueDeserializer::Delegate::GetExternalStringFromId as |clone_id|.
+     * Since strings are immutable, the deserializing side can create a new
+     * external string on the same (thread-safe) resource.
+     *
+     * Returning Nothing<uint32_t>() without throwing serializes the contents
+     * as usual, which is the default.
+     */
+    virtual Maybe<uint32_t> GetExternalStringId(Isolate* isolate,
+                                                Local<String> string);
+
+    /**
+     * Called when the ValueSerializer is going to serialize the contents of
+     * an ArrayBuffer that was not marked with
+     * ValueSerializer::TransferArrayBuffer. The embedder can return an ID to
+     * pass the backing store by reference instead of copying it into the
+     * buffer, e.g. after externalizing it to share it copy-on-write or to
+     * detach it once serialization is done. When deserializing, this ID will
+     * be passed to ValueDeserializer::Delegate::GetArrayBufferFromContentsId
+     * as |clone_id|. The ArrayBuffer must not be detached before WriteValue()
+     * returns, as views into it are serialized afterwards.
+     *
+     * Returning Nothing<uint32_t>() without throwing serializes the contents
+     * as usual, which is the default.
+     */
+    virtual Maybe<uint32_t> GetArrayBufferContentsId(
+        Isolate* isolate, Local<ArrayBuffer> array_buffer);
+
     /**
      * Allocates memory for the buffer of at least the size provided. The actual
      * size (which may be greater or equal) is written to |actual_size|. If no
@@ -2018,6 +2184,21 @@ class V8_EXPORT ValueDeserializer {
      */
     virtual MaybeLocal<SharedArrayBuffer> GetSharedArrayBufferFromId(
         Isolate* isolate, uint32_t clone_id);
+
+    /**
+     * Get a String given a clone_id previously provided by
+     * ValueSerializer::Delegate::GetExternalStringId
+     */
+    virtual MaybeLocal<String> GetExternalStringFromId(Isolate* isolate,
+                                                       uint32_t clone_id);
+
+    /**
+     * Get an ArrayBuffer adopting the backing store given a clone_id
+     * previously provided by
+     * ValueSerializer::Delegate::GetArrayBufferContentsId
+     */
+    virtual MaybeLocal<ArrayBuffer> GetArrayBufferFromContentsId(
+        Isolate* isolate, uint32_t clone_id);
   };
 
   ValueDeserializer(Isolate* isolate, const uint8_t* data, size_t size);
@@ -4012,6 +4193,20 @@ class V8_EXPORT Function : public Object {
                                                Local<Value> recv, int argc,
                                                Local<Value> argv[]);
 
+  /**
+   * Calls this function |call_count| times with the same receiver, passing
+   * the |argc| arguments starting at argv[i * argc] to the i-th call. The
+   * callee and context are checked and entered only once for the whole
+   * batch, which makes this cheaper than calling Call in a loop for small,
+   * frequently invoked callbacks. The return values of the calls are
+   * discarded. If a call throws, the remaining calls are skipped and Nothing
+   * is returned.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<bool> CallBatch(Local<Context> context,
+                                              Local<Value> recv, int argc,
+                                              int call_count,
+                                              Local<Value> argv[]);
+
   void SetName(Local<String> name);
   Local<Value> GetName() const;
 
@@ -4609,6 +4804,13 @@ class V8_EXPORT ArrayBuffer : public Object {
      */
     virtual void Free(void* data, size_t length) = 0;
 
+    /**
+     * Called when an isolate using this allocator is under memory pressure.
+     * Allocators that keep freed memory around for reuse should return it to
+     * the system.
+     */
+    virtual void ReleaseCachedMemory() {}
+
     /**
      * ArrayBuffer allocation mode. kNormal is a malloc/free style allocation,
      * while kReservation is for larger allocations with the ability to set
@@ -4623,6 +4825,16 @@ class V8_EXPORT ArrayBuffer : public Object {
      * |delete allocator| once it is no longer in use.
      */
     static Allocator* NewDefaultAllocator();
+
+    /**
+     * Like NewDefaultAllocator(), but keeps freed blocks of up to 64 KB in
+     * per-size-class pools, so that short-lived small buffers are cheap to
+     * allocate. The pools are emptied by ReleaseCachedMemory().
+     *
+     * Caller takes ownership, i.e. the returned object needs to be freed using
+     * |delete allocator| once it is no longer in use.
+     */
+    static Allocator* NewPooledAllocator();
   };
 
   /**
@@ -4702,6 +4914,31 @@ class V8_EXPORT ArrayBuffer : public Object {
       Isolate* isolate, void* data, size_t byte_length,
       ArrayBufferCreationMode mode = ArrayBufferCreationMode::kExternalized);
 
+  /**
+   * Called with the memory block of an ArrayBuffer created with a release
+   * callback once the buffer has been garbage-collected, or when its isolate
+   * is disposed. The callback must not call into V8.
+   */
+  typedef void (*ReleaseCallback)(void* data, size_t byte_length,
+                                  void* release_data);
+
+  /**
+   * Create a new externalized ArrayBuffer over an existing memory block, and
+   * call |callback| with |release_data| once the ArrayBuffer is no longer
+   * reachable. The memory block is not reported to the garbage collector as
+   * external memory; embedders that want it to affect GC heuristics should
+   * use Isolate::AdjustAmountOfExternalAllocatedMemory for a whole batch of
+   * buffers.
+   *
+   * Typed arrays created over slices of the returned buffer with
+   * TypedArray::New(buffer, byte_offset, length) keep it alive, so a single
+   * buffer, and a single release callback, can cover many small views into
+   * one embedder-owned region.
+   */
+  static Local<ArrayBuffer> New(Isolate* isolate, void* data,
+                                size_t byte_length, ReleaseCallback callback,
+                                void* release_data);
+
   /**
    * Returns true if ArrayBuffer is externalized, that is, does not
    * own its memory block.
@@ -5801,13 +6038,19 @@ typedef bool (*AccessCheckCallback)(Local<Context> accessing_context,
  */
 class V8_EXPORT FunctionTemplate : public Template {
  public:
-  /** Creates a function template.*/
+  /**
+   * Creates a function template.
+   *
+   * If a |c_function| is given, optimized code may call it directly instead
+   * of |callback|, see v8-fast-api-calls.h for the requirements on it.
+   */
   static Local<FunctionTemplate> New(
       Isolate* isolate, FunctionCallback callback = nullptr,
       Local<Value> data = Local<Value>(),
       Local<Signature> signature = Local<Signature>(), int length = 0,
       ConstructorBehavior behavior = ConstructorBehavior::kAllow,
-      SideEffectType side_effect_type = SideEffectType::kHasSideEffect);
+      SideEffectType side_effect_type = SideEffectType::kHasSideEffect,
+      const CFunction* c_function = nullptr);
 
   /** Get a template included in the snapshot by index. */
   static MaybeLocal<FunctionTemplate> FromSnapshot(Isolate* isolate,
@@ -6458,6 +6701,50 @@ class V8_EXPORT ResourceConstraints {
   size_t max_zone_pool_size() const { return max_zone_pool_size_; }
   void set_max_zone_pool_size(size_t bytes) { max_zone_pool_size_ = bytes; }
 
+  /**
+   * The fraction of objects from an allocation site that have to survive a
+   * scavenge before the site allocates directly in old space, in (0, 1].
+   * Zero selects the default.
+   */
+  double pretenuring_ratio() const { return pretenuring_ratio_; }
+  void set_pretenuring_ratio(double ratio) { pretenuring_ratio_ = ratio; }
+
+  /**
+   * The number of objects an allocation site has to allocate before its
+   * pretenuring decision is made. Zero selects the default.
+   */
+  int pretenuring_minimum_allocations() const {
+    return pretenuring_minimum_allocations_;
+  }
+  void set_pretenuring_minimum_allocations(int count) {
+    pretenuring_minimum_allocations_ = count;
+  }
+
+  /**
+   * The fraction of time the embedder wants to spend outside of the garbage
+   * collector, in (0, 1). After a full garbage collection the old generation
+   * limit is sized such that the remaining GC CPU budget is met at the
+   * measured garbage collection and allocation speeds. Zero selects the
+   * default. Container memory limits are applied with ConfigureDefaults()
+   * and set_max_old_space_size().
+   */
+  double heap_growing_target_mutator_utilization() const {
+    return heap_growing_target_mutator_utilization_;
+  }
+  void set_heap_growing_target_mutator_utilization(double utilization) {
+    heap_growing_target_mutator_utilization_ = utilization;
+  }
+
+  /**
+   * The maximum amount in MB by which the old generation limit grows beyond
+   * the old generation size after a full garbage collection. Zero means no
+   * maximum.
+   */
+  size_t max_heap_growing_step() const { return max_heap_growing_step_; }
+  void set_max_heap_growing_step(size_t limit_in_mb) {
+    max_heap_growing_step_ = limit_in_mb;
+  }
+
  private:
   // max_semi_space_size_ is in KB
   size_t max_semi_space_size_in_kb_;
@@ -6467,6 +6754,10 @@ class V8_EXPORT ResourceConstraints {
   uint32_t* stack_limit_;
   size_t code_range_size_;
   size_t max_zone_pool_size_;
+  double pretenuring_ratio_;
+  int pretenuring_minimum_allocations_;
+  double heap_growing_target_mutator_utilization_;
+  size_t max_heap_growing_step_;
 };
 
 
@@ -6683,6 +6974,85 @@ class V8_EXPORT MicrotasksScope {
   bool run_;
 };
 
+/**
+ * Represents a queue of microtasks that can be attached to one or more
+ * contexts (see Context::New). Microtasks enqueued from JavaScript running
+ * in such a context are added to its queue instead of the isolate's default
+ * queue, and they only run when the embedder calls PerformCheckpoint.
+ *
+ * The MicrotaskQueue must outlive all contexts that use it.
+ */
+class V8_EXPORT MicrotaskQueue {
+ public:
+  /**
+   * Creates an empty MicrotaskQueue instance.
+   */
+  static std::unique_ptr<MicrotaskQueue> New(Isolate* isolate);
+
+  virtual ~MicrotaskQueue() = default;
+
+  /**
+   * Enqueues the callback to the queue.
+   */
+  virtual void EnqueueMicrotask(Isolate* isolate,
+                                Local<Function> microtask) = 0;
+
+  /**
+   * Enqueues the callback to the queue.
+   */
+  virtual void EnqueueMicrotask(Isolate* isolate, MicrotaskCallback callback,
+                                void* data = nullptr) = 0;
+
+  /**
+   * Enqueues |count| invocations of the callback, the i-th of which receives
+   * data[i]. The queue grows at most once for the whole batch.
+   */
+  virtual void EnqueueMicrotasks(Isolate* isolate, MicrotaskCallback callback,
+                                 void* const* data, size_t count) = 0;
+
+  /**
+   * Limits the work done by a single PerformCheckpoint call to at most
+   * |max_microtasks| microtasks and roughly |max_duration_ms| milliseconds.
+   * Microtasks that don't fit into the budget stay in the queue for the next
+   * checkpoint. A limit of 0 means that there is no such limit, which is the
+   * default.
+   */
+  virtual void SetRunBudget(size_t max_microtasks, double max_duration_ms) = 0;
+
+  /**
+   * Runs pending microtasks, including the ones enqueued while running, until
+   * the queue is empty or the run budget is exhausted. Returns the number of
+   * microtasks that ran. Does nothing if the queue is already running.
+   */
+  virtual int PerformCheckpoint(Isolate* isolate) = 0;
+
+  /**
+   * Returns the number of pending microtasks.
+   */
+  virtual size_t GetSize() const = 0;
+
+  /**
+   * Returns the total number of microtasks enqueued to this queue.
+   */
+  virtual size_t GetEnqueuedCount() const = 0;
+
+  /**
+   * Returns the total number of microtasks that ran from this queue.
+   */
+  virtual size_t GetRunCount() const = 0;
+
+  /**
+   * Returns how many checkpoints stopped because of the run budget.
+   */
+  virtual size_t GetBudgetExhaustedCount() const = 0;
+
+ private:
+  friend class internal::MicrotaskQueue;
+  MicrotaskQueue() = default;
+  MicrotaskQueue(const MicrotaskQueue&) = delete;
+  MicrotaskQueue& operator=(const MicrotaskQueue&) = delete;
+};
+
 
 // --- Failed Access Check Callback ---
 typedef void (*FailedAccessCheckCallback)(Local<Object> target,
@@ -6758,6 +7128,93 @@ enum GCCallbackFlags {
 
 typedef void (*GCCallback)(GCType type, GCCallbackFlags flags);
 
+/**
+ * Statistics about a single garbage collection, passed to the
+ * GCStatisticsCallback. Times are in milliseconds and sizes in bytes. Phases
+ * which are not part of the respective collection are zero.
+ */
+struct GCStatistics {
+  // kGCTypeScavenge for young generation and kGCTypeMarkSweepCompact for full
+  // garbage collections.
+  GCType type;
+  // Whether a full garbage collection finished incremental marking.
+  bool incremental;
+  // Start of the collection on the Platform::MonotonicallyIncreasingTime
+  // clock, in milliseconds.
+  double start_time;
+  double pause_duration;
+  double incremental_marking_duration;
+
+  // Main thread phases of full garbage collections.
+  double mark_duration;
+  double clear_duration;
+  double evacuate_duration;
+  double sweep_duration;
+
+  // Main thread phases of young generation garbage collections.
+  double scavenge_duration;
+  double scavenge_roots_duration;
+  double scavenge_parallel_duration;
+
+  // Time spent on background threads.
+  double background_marking_duration;
+  double background_sweeping_duration;
+  double background_evacuation_duration;
+  double background_scavenge_duration;
+
+  size_t start_object_size;
+  size_t end_object_size;
+  size_t start_memory_size;
+  size_t end_memory_size;
+  size_t promoted_bytes;
+  size_t semi_space_copied_bytes;
+  // Percentage of the young generation promoted resp. surviving in total.
+  double promotion_ratio;
+  double survival_ratio;
+};
+
+/**
+ * Called once at the end of every garbage collection. The callback runs
+ * inside the collection, so it must neither allocate on the V8 heap nor call
+ * into V8.
+ */
+typedef void (*GCStatisticsCallback)(Isolate* isolate,
+                                     const GCStatistics& statistics,
+                                     void* data);
+
+/**
+ * Information about a single deoptimization, passed to the
+ * DeoptimizationCallback.
+ */
+struct DeoptimizationInfo {
+  // The function whose optimized code was deoptimized.
+  Local<Function> function;
+  // "eager", "soft" or "lazy".
+  const char* kind;
+  // Why eager and soft deoptimizations happened, e.g. "wrong map". Lazy
+  // deoptimizations are caused by other code, their reason is "(unknown)".
+  const char* reason;
+  // The bytecode offset in |function| at which execution continues.
+  int bytecode_offset;
+  // Number of eager and lazy deoptimizations of |function| so far.
+  int deopt_count;
+  // Whether |function| had deoptimized before, i.e. the deoptimized code was
+  // the result of a re-optimization.
+  bool reoptimized;
+  // Whether V8 detected a deoptimization loop and will re-optimize |function|
+  // with conservative speculation.
+  bool deopt_loop;
+};
+
+/**
+ * Called once for every deoptimized optimized code object. The callback runs
+ * inside the deoptimizer, so it must neither allocate on the V8 heap nor call
+ * into V8.
+ */
+typedef void (*DeoptimizationCallback)(Isolate* isolate,
+                                       const DeoptimizationInfo& info,
+                                       void* data);
+
 typedef void (*InterruptCallback)(Isolate* isolate, void* data);
 
 /**
@@ -6836,6 +7293,32 @@ class V8_EXPORT HeapSpaceStatistics {
 };
 
 
+/**
+ * Counts of the polymorphic and megamorphic inline cache transitions in one
+ * function, see Isolate::GetFunctionICStatistics(). Functions with many of
+ * them access objects of unstable shapes.
+ */
+class V8_EXPORT FunctionICStatistics {
+ public:
+  FunctionICStatistics();
+  const char* function_name() { return function_name_; }
+  int script_id() { return script_id_; }
+  int start_position() { return start_position_; }
+  size_t megamorphic_transitions() { return megamorphic_transitions_; }
+  size_t polymorphic_transitions() { return polymorphic_transitions_; }
+  size_t max_polymorphism() { return max_polymorphism_; }
+
+ private:
+  const char* function_name_;
+  int script_id_;
+  int start_position_;
+  size_t megamorphic_transitions_;
+  size_t polymorphic_transitions_;
+  size_t max_polymorphism_;
+
+  friend class Isolate;
+};
+
 class V8_EXPORT HeapObjectStatistics {
  public:
   HeapObjectStatistics();
@@ -7042,6 +7525,24 @@ class V8_EXPORT EmbedderHeapTracer {
   virtual void RegisterV8References(
       const std::vector<std::pair<void*, void*> >& embedder_fields) = 0;
 
+  /**
+   * Returns true if the embedder wants V8's concurrent marking threads to
+   * report found wrappers directly through
+   * |RegisterV8ReferencesConcurrently|, instead of handing them to the main
+   * thread. Queried once per GC cycle, right after |TracePrologue|.
+   */
+  virtual bool SupportsConcurrentRegistration() { return false; }
+
+  /**
+   * Like |RegisterV8References|, but called from V8's concurrent marking
+   * threads, possibly several at a time and in parallel to the main thread.
+   * Wrappers are reported in large batches. No such call overlaps with a call
+   * of |AdvanceTracing| with an infinite deadline, so the embedder may trace
+   * from these references on its own threads until then.
+   */
+  virtual void RegisterV8ReferencesConcurrently(
+      const std::vector<std::pair<void*, void*> >& embedder_fields) {}
+
   /**
    * Called at the beginning of a GC cycle.
    */
@@ -7618,6 +8119,29 @@ class V8_EXPORT Isolate {
   bool GetHeapSpaceStatistics(HeapSpaceStatistics* space_statistics,
                               size_t index);
 
+  /**
+   * Returns the number of functions in which an inline cache went
+   * polymorphic or megamorphic since the isolate was created or
+   * ResetFunctionICStatistics() was called.
+   */
+  size_t NumberOfFunctionICStatistics();
+
+  /**
+   * Get the inline cache transition counts of a function.
+   *
+   * \param statistics The FunctionICStatistics object to fill in. Its
+   *   function name stays valid until ResetFunctionICStatistics() is called.
+   * \param index The index of the function, which ranges from 0 to
+   *   NumberOfFunctionICStatistics() - 1.
+   * \returns true on success.
+   */
+  bool GetFunctionICStatistics(FunctionICStatistics* statistics, size_t index);
+
+  /**
+   * Clears the inline cache transition counts of all functions.
+   */
+  void ResetFunctionICStatistics();
+
   /**
    * Returns the number of types of objects tracked in the heap at GC.
    */
@@ -7864,6 +8388,22 @@ class V8_EXPORT Isolate {
                                 void* data = nullptr);
   void RemoveGCEpilogueCallback(GCCallback callback);
 
+  /**
+   * Installs a callback which receives the statistics of every garbage
+   * collection without any string formatting, e.g. for sampling GC phase
+   * times in production. Passing nullptr removes the callback.
+   */
+  void SetGCStatisticsCallback(GCStatisticsCallback callback,
+                               void* data = nullptr);
+
+  /**
+   * Installs a callback which is told about every deoptimization, e.g. for
+   * spotting deoptimization storms in production. Passing nullptr removes the
+   * callback.
+   */
+  void SetDeoptimizationCallback(DeoptimizationCallback callback,
+                                 void* data = nullptr);
+
   typedef size_t (*GetExternallyAllocatedMemoryInBytesCallback)();
 
   /**
@@ -8685,6 +9225,43 @@ class V8_EXPORT SnapshotCreator {
   void* data_;
 };
 
+/**
+ * Keeps a number of isolates ready for use, each with a context created from
+ * the snapshot, so that handing out an isolate doesn't pay for deserializing
+ * the isolate and context snapshots. The pool refills itself on worker threads
+ * of the current platform. Since the isolates are created on other threads,
+ * they must only ever be used under a v8::Locker.
+ */
+class V8_EXPORT IsolatePool {
+ public:
+  /**
+   * Creates a pool holding up to |size| isolates created with |params|, and
+   * starts filling it in the background. Anything |params| points to, such as
+   * the array buffer allocator, must outlive the pool and its isolates.
+   */
+  IsolatePool(const Isolate::CreateParams& params, size_t size);
+
+  /**
+   * Waits for pending refills and disposes the isolates that were not taken.
+   */
+  ~IsolatePool();
+
+  /**
+   * Removes an isolate from the pool and schedules a refill. If the pool is
+   * empty, the isolate is created on the calling thread instead. |context| is
+   * set to the context created for the isolate. The caller owns the isolate
+   * and must reset |context| before disposing it.
+   */
+  Isolate* Take(Global<Context>* context);
+
+  // Disallow copying and assigning.
+  IsolatePool(const IsolatePool&) = delete;
+  void operator=(const IsolatePool&) = delete;
+
+ private:
+  void* data_;
+};
+
 /**
  * A simple Maybe type, representing an object which may or may not have a
  * value, see https://hackage.haskell.org/package/base/docs/Data-Maybe.html.
@@ -9014,13 +9591,18 @@ class V8_EXPORT Context {
    * created by a previous call to Context::New with the same global
    * template. The state of the global object will be completely reset
    * and only object identify will remain.
+   *
+   * \param microtask_queue An optional MicrotaskQueue for the microtasks
+   * of the newly created context. If not given, the isolate's default
+   * queue is used.
    */
   static Local<Context> New(
       Isolate* isolate, ExtensionConfiguration* extensions = nullptr,
       MaybeLocal<ObjectTemplate> global_template = MaybeLocal<ObjectTemplate>(),
       MaybeLocal<Value> global_object = MaybeLocal<Value>(),
       DeserializeInternalFieldsCallback internal_fields_deserializer =
-          DeserializeInternalFieldsCallback());
+          DeserializeInternalFieldsCallback(),
+      MicrotaskQueue* microtask_queue = nullptr);
 
   /**
    * Create a new context from a (non-default) context snapshot. There
@@ -9173,6 +9755,19 @@ class V8_EXPORT Context {
    */
   void SetErrorMessageForCodeGenerationFromStrings(Local<String> message);
 
+  /**
+   * Sets JavaScript functions to be called for the promise lifecycle events
+   * of this context, much like Isolate::SetPromiseHook() does for C++
+   * callbacks. Unlike the latter, these are called directly from the promise
+   * builtins, which keeps promise operations on their fast paths. The init
+   * hook is called with the new promise and its parent (or undefined), the
+   * other hooks with the promise only. Pass empty handles to remove hooks.
+   * Exceptions thrown from the hooks are reported and otherwise ignored.
+   */
+  void SetPromiseHooks(Local<Function> init_hook, Local<Function> before_hook,
+                       Local<Function> after_hook,
+                       Local<Function> resolve_hook);
+
   /**
    * Return data that was previously attached to the context snapshot via
    * SnapshotCreator, and removes the reference to it.
@@ -9254,6 +9849,17 @@ class V8_EXPORT Context {
  * isolate. V8 guarantees that an isolate can be locked by at most one thread at
  * any time. In other words, the scope of a v8::Locker is a critical section.
  *
+ * Data that lives outside of the V8 heap can be read by other threads without
+ * a v8::Locker, since the garbage collector never moves it. This includes the
+ * contents of an ArrayBuffer or SharedArrayBuffer returned by GetContents (for
+ * as long as the buffer is neither detached nor freed), and the characters of
+ * an external string returned by String::GetExternalStringResource or
+ * String::GetExternalOneByteStringResource. The embedder has to keep the
+ * owning object alive, for example with a v8::Global, until the other threads
+ * are done. Objects on the V8 heap, such as non-external strings or BigInts,
+ * may move during any garbage collection and must be copied out while the
+ * isolate is locked, e.g. with String::WriteOneByte or BigInt::ToWordsArray.
+ *
  * Sample usage:
 * \code
  * ...
@@ -9401,6 +10007,24 @@ class V8_EXPORT Unwinder {
                                 RegisterState* register_state,
                                 const void* stack_base);
 
+  /**
+   * Like the above, but also records the PC of each V8 frame that is skipped,
+   * innermost first, in |frame_pcs|. At most |max_frames| PCs are recorded;
+   * unwinding continues past that limit. On success, |frame_count| is set to
+   * the number of recorded PCs. This is just as signal-safe and does not
+   * allocate, so it can be used from a sampling signal handler on any thread
+   * running the isolate. The recorded PCs can be attributed to functions
+   * later, off the signal handler, using the code start addresses and sizes
+   * reported through Isolate::SetJitCodeEventHandler.
+   *
+   * On failure, |register_state| is left unchanged and the recorded PCs must
+   * not be used.
+   */
+  static bool TryUnwindV8Frames(const UnwindState& unwind_state,
+                                RegisterState* register_state,
+                                const void* stack_base, void** frame_pcs,
+                                size_t max_frames, size_t* frame_count);
+
   /**
    * Whether the PC is within the V8 code range represented by code_range or
    * embedded_code_range in |unwind_state|.
@@ -9858,6 +10482,19 @@ ScriptCompiler::Source::Source(Local<String> string, const ScriptOrigin& origin,
       host_defined_options(origin.HostDefinedOptions()),
       cached_data(data) {}
 
+ScriptCompiler::Source::Source(Local<String> string, const ScriptOrigin& origin,
+                               CachedData* data,
+                               ConsumeCodeCacheTask* consume_task)
+    : source_string(string),
+      resource_name(origin.ResourceName()),
+      resource_line_offset(origin.ResourceLineOffset()),
+      resource_column_offset(origin.ResourceColumnOffset()),
+      resource_options(origin.Options()),
+      source_map_url(origin.SourceMapUrl()),
+      host_defined_options(origin.HostDefinedOptions()),
+      cached_data(data),
+      consume_cache_task(consume_task) {}
+
 ScriptCompiler::Source::Source(Local<String> string,
                                CachedData* data)
     : source_string(string), cached_data(data) {}
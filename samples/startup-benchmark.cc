@@ -0,0 +1,270 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures the phases of starting up V8 and running a first script:
+//
+//   IsolateNew           v8::Isolate::New, i.e. deserializing the isolate
+//                        snapshot.
+//   ContextNew           v8::Context::New, i.e. deserializing the context
+//                        snapshot and bootstrapping the global object.
+//   CompileLazy          Parsing the script and compiling its top-level code.
+//   CompileEager         Parsing and compiling all of its functions.
+//   FirstRun             Running the lazily compiled script.
+//   CodeCacheProduce     Serializing the code cache after the first run.
+//   CodeCacheConsume     Compiling the script from that code cache.
+//   StreamingParse       The background part of a streaming compile.
+//   StreamingFinalize    Finishing the streaming compile on the main thread.
+//
+// Each phase runs in a fresh isolate so that the compilation cache does not
+// hide any work. Usage:
+//
+//   v8_startup_benchmark [--iterations=N] [V8 flags] [script.js]
+//
+// Without a script, a synthetic bundle of many small functions is used.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8.h"
+
+namespace {
+
+enum Phase {
+  kIsolateNew,
+  kContextNew,
+  kCompileLazy,
+  kCompileEager,
+  kFirstRun,
+  kCodeCacheProduce,
+  kCodeCacheConsume,
+  kStreamingParse,
+  kStreamingFinalize,
+  kNumberOfPhases
+};
+
+const char* const kPhaseNames[] = {
+    "IsolateNew",       "ContextNew",       "CompileLazy",
+    "CompileEager",     "FirstRun",         "CodeCacheProduce",
+    "CodeCacheConsume", "StreamingParse",   "StreamingFinalize"};
+
+class Benchmark {
+ public:
+  Benchmark(v8::Platform* platform, const std::string& source)
+      : platform_(platform),
+        source_(source),
+        allocator_(v8::ArrayBuffer::Allocator::NewDefaultAllocator()) {}
+
+  void RunIteration() {
+    std::unique_ptr<v8::ScriptCompiler::CachedData> cache;
+    RunWithContext([&](v8::Isolate* isolate, v8::Local<v8::Context> context) {
+      v8::ScriptCompiler::Source source(NewSource(isolate));
+      v8::Local<v8::Script> script = Measure(kCompileLazy, [&] {
+        return v8::ScriptCompiler::Compile(context, &source).ToLocalChecked();
+      });
+      Measure(kFirstRun, [&] { return script->Run(context).ToLocalChecked(); });
+      cache.reset(Measure(kCodeCacheProduce, [&] {
+        return v8::ScriptCompiler::CreateCodeCache(script->GetUnboundScript());
+      }));
+    });
+    RunWithContext([&](v8::Isolate* isolate, v8::Local<v8::Context> context) {
+      v8::ScriptCompiler::Source source(NewSource(isolate));
+      Measure(kCompileEager, [&] {
+        return v8::ScriptCompiler::Compile(context, &source,
+                                           v8::ScriptCompiler::kEagerCompile)
+            .ToLocalChecked();
+      });
+    });
+    RunWithContext([&](v8::Isolate* isolate, v8::Local<v8::Context> context) {
+      // The Source takes ownership of a copy of the cache.
+      uint8_t* data = new uint8_t[cache->length];
+      memcpy(data, cache->data, cache->length);
+      v8::ScriptCompiler::Source source(
+          NewSource(isolate),
+          new v8::ScriptCompiler::CachedData(
+              data, cache->length,
+              v8::ScriptCompiler::CachedData::BufferOwned));
+      Measure(kCodeCacheConsume, [&] {
+        return v8::ScriptCompiler::Compile(
+                   context, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+      });
+      if (source.GetCachedData()->rejected) {
+        fprintf(stderr, "The code cache was rejected.\n");
+        exit(1);
+      }
+    });
+    RunWithContext([&](v8::Isolate* isolate, v8::Local<v8::Context> context) {
+      v8::ScriptCompiler::StreamedSource streamed_source(
+          new SourceStream(source_),
+          v8::ScriptCompiler::StreamedSource::UTF8);
+      std::unique_ptr<v8::ScriptCompiler::ScriptStreamingTask> task(
+          v8::ScriptCompiler::StartStreamingScript(isolate, &streamed_source));
+      // An embedder would run the task on a background thread, it is run
+      // here directly to measure it in isolation.
+      Measure(kStreamingParse, [&] {
+        task->Run();
+        return true;
+      });
+      v8::Local<v8::String> full_source = NewSource(isolate);
+      v8::ScriptOrigin origin(NewString(isolate, "bundle.js"));
+      Measure(kStreamingFinalize, [&] {
+        return v8::ScriptCompiler::Compile(context, &streamed_source,
+                                           full_source, origin)
+            .ToLocalChecked();
+      });
+    });
+  }
+
+  void PrintResults() {
+    for (int phase = 0; phase < kNumberOfPhases; phase++) {
+      std::vector<double>& times = times_[phase];
+      std::sort(times.begin(), times.end());
+      printf("%s: %.3f ms (min %.3f ms)\n", kPhaseNames[phase],
+             times[times.size() / 2], times.front());
+    }
+  }
+
+ private:
+  // Streams the source in 64 KB chunks.
+  class SourceStream : public v8::ScriptCompiler::ExternalSourceStream {
+   public:
+    explicit SourceStream(const std::string& source) : source_(source) {}
+
+    size_t GetMoreData(const uint8_t** src) override {
+      static const size_t kChunkSize = 64 * 1024;
+      size_t length = std::min(kChunkSize, source_.size() - position_);
+      if (length == 0) return 0;
+      uint8_t* chunk = new uint8_t[length];
+      memcpy(chunk, source_.data() + position_, length);
+      position_ += length;
+      *src = chunk;
+      return length;
+    }
+
+   private:
+    const std::string& source_;
+    size_t position_ = 0;
+  };
+
+  template <typename Function>
+  void RunWithContext(Function function) {
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = allocator_.get();
+    v8::Isolate* isolate = Measure(
+        kIsolateNew, [&] { return v8::Isolate::New(create_params); });
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context =
+          Measure(kContextNew, [&] { return v8::Context::New(isolate); });
+      v8::Context::Scope context_scope(context);
+      function(isolate, context);
+    }
+    isolate->Dispose();
+  }
+
+  template <typename Function>
+  auto Measure(Phase phase, Function function) -> decltype(function()) {
+    double start = platform_->MonotonicallyIncreasingTime();
+    auto result = function();
+    double end = platform_->MonotonicallyIncreasingTime();
+    times_[phase].push_back((end - start) * 1000);
+    return result;
+  }
+
+  v8::Local<v8::String> NewSource(v8::Isolate* isolate) {
+    return NewString(isolate, source_.c_str());
+  }
+
+  static v8::Local<v8::String> NewString(v8::Isolate* isolate,
+                                         const char* string) {
+    return v8::String::NewFromUtf8(isolate, string, v8::NewStringType::kNormal)
+        .ToLocalChecked();
+  }
+
+  v8::Platform* platform_;
+  const std::string& source_;
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator_;
+  std::vector<double> times_[kNumberOfPhases];
+};
+
+// A bundle of a few thousand small modules, in the style of a bundler's
+// output, of which only some functions run at startup.
+std::string SyntheticBundle() {
+  std::ostringstream bundle;
+  static const int kModules = 2000;
+  bundle << "var modules = [];\n";
+  for (int i = 0; i < kModules; i++) {
+    bundle << "modules.push(function(exports) {\n"
+           << "  function helper" << i << "(a, b) {\n"
+           << "    return a.map((x) => x * b).filter((x) => x % 3 != 0);\n"
+           << "  }\n"
+           << "  exports.name = 'module" << i << "';\n"
+           << "  exports.run = function(n) {\n"
+           << "    var result = 0;\n"
+           << "    for (var j = 0; j < n; j++) result += helper" << i
+           << "([j, j + 1, j + 2], " << i << ").length;\n"
+           << "    return result;\n"
+           << "  };\n"
+           << "});\n";
+  }
+  bundle << "var exports = {};\n"
+         << "for (var i = 0; i < modules.length; i += 10) {\n"
+         << "  modules[i](exports);\n"
+         << "  exports.run(2);\n"
+         << "}\n";
+  return bundle.str();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  int iterations = 10;
+  std::string source;
+  v8::V8::SetFlagsFromCommandLine(&argc, argv, true);
+  for (int i = 1; i < argc; i++) {
+    if (strncmp(argv[i], "--iterations=", 13) == 0) {
+      iterations = atoi(argv[i] + 13);
+    } else if (strncmp(argv[i], "--", 2) == 0) {
+      fprintf(stderr, "Unknown flag %s\n", argv[i]);
+      return 1;
+    } else {
+      std::ifstream file(argv[i]);
+      if (!file) {
+        fprintf(stderr, "Cannot read %s\n", argv[i]);
+        return 1;
+      }
+      std::ostringstream contents;
+      contents << file.rdbuf();
+      source = contents.str();
+    }
+  }
+  if (iterations < 1) iterations = 1;
+  if (source.empty()) source = SyntheticBundle();
+
+  v8::V8::InitializeICUDefaultLocation(argv[0]);
+  v8::V8::InitializeExternalStartupData(argv[0]);
+  std::unique_ptr<v8::Platform> platform = v8::platform::NewDefaultPlatform();
+  v8::V8::InitializePlatform(platform.get());
+  v8::V8::Initialize();
+
+  {
+    Benchmark benchmark(platform.get(), source);
+    for (int i = 0; i < iterations; i++) benchmark.RunIteration();
+    benchmark.PrintResults();
+  }
+
+  v8::V8::Dispose();
+  v8::V8::ShutdownPlatform();
+  return 0;
+}
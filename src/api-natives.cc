@@ -545,6 +545,35 @@ void AddPropertyToPropertyList(Isolate* isolate, Handle<TemplateInfo> templ,
   templ->set_property_list(*list);
 }
 
+// Returns the number of data properties that ConfigureInstance adds to every
+// instance of |info|, see AddDataProperty for the property list layout.
+int CountDataProperties(Isolate* isolate, ObjectTemplateInfo* info) {
+  DisallowHeapAllocation no_gc;
+  Object* maybe_property_list = info->property_list();
+  if (maybe_property_list->IsUndefined(isolate)) return 0;
+  TemplateList properties = TemplateList::cast(maybe_property_list);
+  int count = 0;
+  int i = 0;
+  for (int c = 0; c < info->number_of_properties(); c++) {
+    i++;  // Skip the name.
+    Object* bit = properties->get(i++);
+    if (bit->IsSmi()) {
+      PropertyDetails details(Smi::cast(bit));
+      if (details.kind() == kData) {
+        count++;
+        i += 1;
+      } else {
+        i += 2;
+      }
+    } else {
+      // Intrinsic data property.
+      count++;
+      i += 2;
+    }
+  }
+  return count;
+}
+
 }  // namespace
 
 MaybeHandle<JSFunction> ApiNatives::InstantiateFunction(
@@ -671,11 +700,13 @@ Handle<JSFunction> ApiNatives::CreateApiFunction(
   }
 
   int embedder_field_count = 0;
+  int data_property_count = 0;
   bool immutable_proto = false;
   if (!obj->GetInstanceTemplate()->IsUndefined(isolate)) {
     Handle<ObjectTemplateInfo> GetInstanceTemplate = Handle<ObjectTemplateInfo>(
         ObjectTemplateInfo::cast(obj->GetInstanceTemplate()), isolate);
     embedder_field_count = GetInstanceTemplate->embedder_field_count();
+    data_property_count = CountDataProperties(isolate, *GetInstanceTemplate);
     immutable_proto = GetInstanceTemplate->immutable_proto();
   }
 
@@ -684,8 +715,19 @@ Handle<JSFunction> ApiNatives::CreateApiFunction(
   int instance_size = JSObject::GetHeaderSize(type) +
                       kEmbedderDataSlotSize * embedder_field_count;
 
-  Handle<Map> map = isolate->factory()->NewMap(type, instance_size,
-                                               TERMINAL_FAST_ELEMENTS_KIND);
+  // Reserve in-object space for the data properties of the instance template,
+  // so that instances cloned from the cached boilerplate (see
+  // InstantiateObject) are a single allocation, like object literals.
+  int inobject_properties = 0;
+  if (type == JS_API_OBJECT_TYPE) {
+    inobject_properties =
+        std::min({data_property_count, JSObject::kMaxInObjectProperties,
+                  (JSObject::kMaxInstanceSize - instance_size) / kTaggedSize});
+    instance_size += inobject_properties * kTaggedSize;
+  }
+
+  Handle<Map> map = isolate->factory()->NewMap(
+      type, instance_size, TERMINAL_FAST_ELEMENTS_KIND, inobject_properties);
   JSFunction::SetInitialMap(result, map, Handle<JSObject>::cast(prototype));
 
   // Mark as undetectable if needed.
@@ -11,14 +11,18 @@
 
 #include "src/api-inl.h"
 
+#include "include/v8-fast-api-calls.h"
 #include "include/v8-profiler.h"
 #include "include/v8-testing.h"
 #include "include/v8-util.h"
 #include "src/accessors.h"
 #include "src/api-natives.h"
 #include "src/assert-scope.h"
+#include "src/base/bits.h"
 #include "src/base/functional.h"
 #include "src/base/logging.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
 #include "src/base/safe_conversions.h"
@@ -44,11 +48,14 @@
 #include "src/gdb-jit.h"
 #include "src/global-handles.h"
 #include "src/globals.h"
+#include "src/heap/gc-tracer.h"
+#include "src/ic/ic-stats.h"
 #include "src/icu_util.h"
 #include "src/isolate-inl.h"
 #include "src/json-parser.h"
 #include "src/json-stringifier.h"
 #include "src/messages.h"
+#include "src/microtask-queue.h"
 #include "src/objects-inl.h"
 #include "src/objects/api-callbacks.h"
 #include "src/objects/embedder-data-array-inl.h"
@@ -60,6 +67,7 @@
 #include "src/objects/js-generator-inl.h"
 #include "src/objects/js-promise-inl.h"
 #include "src/objects/js-regexp-inl.h"
+#include "src/objects/managed.h"
 #include "src/objects/module-inl.h"
 #include "src/objects/ordered-hash-table-inl.h"
 #include "src/objects/slots.h"
@@ -70,6 +78,7 @@
 #include "src/parsing/parser.h"
 #include "src/parsing/scanner-character-streams.h"
 #include "src/pending-compilation-error-handler.h"
+#include "src/pooled-array-buffer-allocator.h"
 #include "src/profiler/cpu-profiler.h"
 #include "src/profiler/heap-profiler.h"
 #include "src/profiler/heap-snapshot-generator-inl.h"
@@ -559,6 +568,106 @@ struct SnapshotCreatorData {
 
 }  // namespace
 
+namespace {
+
+Isolate* NewPooledIsolate(const Isolate::CreateParams& params,
+                          Global<Context>* context) {
+  Isolate* isolate = Isolate::New(params);
+  Locker locker(isolate);
+  Isolate::Scope isolate_scope(isolate);
+  HandleScope handle_scope(isolate);
+  context->Reset(isolate, Context::New(isolate));
+  return isolate;
+}
+
+struct IsolatePoolEntry {
+  Isolate* isolate;
+  Global<Context> context;
+};
+
+struct IsolatePoolData {
+  IsolatePoolData(const Isolate::CreateParams& params, size_t size)
+      : params_(params), size_(size), pending_refills_(0) {}
+
+  static IsolatePoolData* cast(void* data) {
+    return reinterpret_cast<IsolatePoolData*>(data);
+  }
+
+  const Isolate::CreateParams params_;
+  const size_t size_;
+  base::Mutex mutex_;
+  base::ConditionVariable refills_done_;
+  size_t pending_refills_;
+  std::vector<IsolatePoolEntry> entries_;
+};
+
+class IsolatePoolRefillTask : public Task {
+ public:
+  explicit IsolatePoolRefillTask(IsolatePoolData* data) : data_(data) {}
+
+  void Run() override {
+    IsolatePoolEntry entry;
+    entry.isolate = NewPooledIsolate(data_->params_, &entry.context);
+    base::MutexGuard guard(&data_->mutex_);
+    data_->entries_.push_back(std::move(entry));
+    if (--data_->pending_refills_ == 0) data_->refills_done_.NotifyAll();
+  }
+
+ private:
+  IsolatePoolData* data_;
+};
+
+// Must be called with the pool's mutex held.
+void ScheduleIsolatePoolRefills(IsolatePoolData* data, size_t count) {
+  data->pending_refills_ += count;
+  for (size_t i = 0; i < count; i++) {
+    i::V8::GetCurrentPlatform()->CallOnWorkerThread(
+        base::make_unique<IsolatePoolRefillTask>(data));
+  }
+}
+
+}  // namespace
+
+IsolatePool::IsolatePool(const Isolate::CreateParams& params, size_t size) {
+  IsolatePoolData* data = new IsolatePoolData(params, size);
+  base::MutexGuard guard(&data->mutex_);
+  ScheduleIsolatePoolRefills(data, size);
+  data_ = data;
+}
+
+IsolatePool::~IsolatePool() {
+  IsolatePoolData* data = IsolatePoolData::cast(data_);
+  {
+    base::MutexGuard guard(&data->mutex_);
+    while (data->pending_refills_ > 0) data->refills_done_.Wait(&data->mutex_);
+  }
+  for (IsolatePoolEntry& entry : data->entries_) {
+    entry.context.Reset();
+    entry.isolate->Dispose();
+  }
+  delete data;
+}
+
+Isolate* IsolatePool::Take(Global<Context>* context) {
+  IsolatePoolData* data = IsolatePoolData::cast(data_);
+  {
+    base::MutexGuard guard(&data->mutex_);
+    if (!data->entries_.empty()) {
+      IsolatePoolEntry& entry = data->entries_.back();
+      Isolate* isolate = entry.isolate;
+      *context = std::move(entry.context);
+      data->entries_.pop_back();
+      ScheduleIsolatePoolRefills(data, 1);
+      return isolate;
+    }
+    // Don't queue more refills than the pool can hold.
+    if (data->pending_refills_ < data->size_) {
+      ScheduleIsolatePoolRefills(data, 1);
+    }
+  }
+  return NewPooledIsolate(data->params_, context);
+}
+
 SnapshotCreator::SnapshotCreator(Isolate* isolate,
                                  const intptr_t* external_references,
                                  StartupData* existing_snapshot) {
@@ -939,7 +1048,11 @@ ResourceConstraints::ResourceConstraints()
       max_old_space_size_(0),
       stack_limit_(nullptr),
       code_range_size_(0),
-      max_zone_pool_size_(0) {}
+      max_zone_pool_size_(0),
+      pretenuring_ratio_(0),
+      pretenuring_minimum_allocations_(0),
+      heap_growing_target_mutator_utilization_(0),
+      max_heap_growing_step_(0) {}
 
 void ResourceConstraints::ConfigureDefaults(uint64_t physical_memory,
                                             uint64_t virtual_memory_limit) {
@@ -968,6 +1081,12 @@ void SetResourceConstraints(i::Isolate* isolate,
                                    code_range_size);
   }
   isolate->allocator()->ConfigureSegmentPool(max_pool_size);
+  isolate->heap()->ConfigurePretenuring(
+      constraints.pretenuring_ratio(),
+      constraints.pretenuring_minimum_allocations());
+  isolate->heap()->ConfigureHeapGrowing(
+      constraints.heap_growing_target_mutator_utilization(),
+      constraints.max_heap_growing_step());
 
   if (constraints.stack_limit() != nullptr) {
     uintptr_t limit = reinterpret_cast<uintptr_t>(constraints.stack_limit());
@@ -1391,7 +1510,8 @@ static Local<FunctionTemplate> FunctionTemplateNew(
     i::Isolate* isolate, FunctionCallback callback, v8::Local<Value> data,
     v8::Local<Signature> signature, int length, bool do_not_cache,
     v8::Local<Private> cached_property_name = v8::Local<Private>(),
-    SideEffectType side_effect_type = SideEffectType::kHasSideEffect) {
+    SideEffectType side_effect_type = SideEffectType::kHasSideEffect,
+    const CFunction* c_function = nullptr) {
   i::Handle<i::Struct> struct_obj =
       isolate->factory()->NewStruct(i::FUNCTION_TEMPLATE_INFO_TYPE, i::TENURED);
   i::Handle<i::FunctionTemplateInfo> obj =
@@ -1417,20 +1537,27 @@ static Local<FunctionTemplate> FunctionTemplateNew(
       cached_property_name.IsEmpty()
           ? i::ReadOnlyRoots(isolate).the_hole_value()
           : *Utils::OpenHandle(*cached_property_name));
+  if (c_function != nullptr) {
+    i::FunctionTemplateInfo::SetCFunction(
+        isolate, obj, FromCData(isolate, c_function->GetAddress()));
+    i::FunctionTemplateInfo::SetCSignature(
+        isolate, obj, FromCData(isolate, c_function->GetTypeInfo()));
+  }
   return Utils::ToLocal(obj);
 }
 
 Local<FunctionTemplate> FunctionTemplate::New(
     Isolate* isolate, FunctionCallback callback, v8::Local<Value> data,
     v8::Local<Signature> signature, int length, ConstructorBehavior behavior,
-    SideEffectType side_effect_type) {
+    SideEffectType side_effect_type, const CFunction* c_function) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
   // Changes to the environment cannot be captured in the snapshot. Expect no
   // function templates when the isolate is created for serialization.
   LOG_API(i_isolate, FunctionTemplate, New);
   ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
-  auto templ = FunctionTemplateNew(i_isolate, callback, data, signature, length,
-                                   false, Local<Private>(), side_effect_type);
+  auto templ =
+      FunctionTemplateNew(i_isolate, callback, data, signature, length, false,
+                          Local<Private>(), side_effect_type, c_function);
   if (behavior == ConstructorBehavior::kThrow) templ->RemovePrototype();
   return templ;
 }
@@ -2346,9 +2473,18 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
   i::ScriptData* script_data = nullptr;
   if (options == kConsumeCodeCache) {
     DCHECK(source->cached_data);
-    // ScriptData takes care of pointer-aligning the data.
-    script_data = new i::ScriptData(source->cached_data->data,
-                                    source->cached_data->length);
+    if (source->consume_cache_task) {
+      // The data has already been copied and verified in the background.
+      i::BackgroundDeserializeTask* task =
+          source->consume_cache_task->impl_.get();
+      CHECK_EQ(task->cached_data(), source->cached_data);
+      script_data = task->ReleaseScriptData();
+    }
+    if (script_data == nullptr) {
+      // ScriptData takes care of pointer-aligning the data.
+      script_data = new i::ScriptData(source->cached_data->data,
+                                      source->cached_data->length);
+    }
   }
 
   i::Handle<i::String> str = Utils::OpenHandle(*(source->source_string));
@@ -2527,22 +2663,59 @@ MaybeLocal<Function> ScriptCompiler::CompileFunctionInContext(
 
 void ScriptCompiler::ScriptStreamingTask::Run() { data_->task->Run(); }
 
+ScriptCompiler::ConsumeCodeCacheTask::ConsumeCodeCacheTask(
+    std::unique_ptr<i::BackgroundDeserializeTask> impl)
+    : impl_(std::move(impl)) {}
+
+ScriptCompiler::ConsumeCodeCacheTask::~ConsumeCodeCacheTask() = default;
+
+void ScriptCompiler::ConsumeCodeCacheTask::Run() { impl_->Run(); }
+
+ScriptCompiler::ConsumeCodeCacheTask* ScriptCompiler::StartConsumingCodeCache(
+    const CachedData* cached_data) {
+  DCHECK_NOT_NULL(cached_data);
+  return new ScriptCompiler::ConsumeCodeCacheTask(
+      base::make_unique<i::BackgroundDeserializeTask>(cached_data));
+}
+
 ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreamingScript(
     Isolate* v8_isolate, StreamedSource* source, CompileOptions options) {
-  if (!i::FLAG_script_streaming) {
-    return nullptr;
-  }
   // We don't support other compile options on streaming background compiles.
   // TODO(rmcilroy): remove CompileOptions from the API.
   CHECK(options == ScriptCompiler::kNoCompileOptions);
+  return StartStreaming(v8_isolate, source, ScriptType::kClassic);
+}
+
+ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreaming(
+    Isolate* v8_isolate, StreamedSource* source, ScriptType type) {
+  if (!i::FLAG_script_streaming) {
+    return nullptr;
+  }
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
   i::ScriptStreamingData* data = source->impl();
   std::unique_ptr<i::BackgroundCompileTask> task =
-      base::make_unique<i::BackgroundCompileTask>(data, isolate);
+      base::make_unique<i::BackgroundCompileTask>(data, isolate, type);
   data->task = std::move(task);
   return new ScriptCompiler::ScriptStreamingTask(data);
 }
 
+namespace {
+
+i::MaybeHandle<i::SharedFunctionInfo> CompileStreamedSource(
+    i::Isolate* isolate, ScriptCompiler::StreamedSource* v8_source,
+    Local<String> full_source_string, const ScriptOrigin& origin) {
+  i::Handle<i::String> str = Utils::OpenHandle(*(full_source_string));
+  i::Compiler::ScriptDetails script_details = GetScriptDetails(
+      isolate, origin.ResourceName(), origin.ResourceLineOffset(),
+      origin.ResourceColumnOffset(), origin.SourceMapUrl(),
+      origin.HostDefinedOptions());
+  i::ScriptStreamingData* data = v8_source->impl();
+  return i::Compiler::GetSharedFunctionInfoForStreamedScript(
+      isolate, str, script_details, origin.Options(), data);
+}
+
+}  // namespace
+
 MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
                                            StreamedSource* v8_source,
                                            Local<String> full_source_string,
@@ -2552,16 +2725,8 @@ MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                "V8.CompileStreamedScript");
 
-  i::Handle<i::String> str = Utils::OpenHandle(*(full_source_string));
-  i::Compiler::ScriptDetails script_details = GetScriptDetails(
-      isolate, origin.ResourceName(), origin.ResourceLineOffset(),
-      origin.ResourceColumnOffset(), origin.SourceMapUrl(),
-      origin.HostDefinedOptions());
-  i::ScriptStreamingData* data = v8_source->impl();
-
   i::MaybeHandle<i::SharedFunctionInfo> maybe_function_info =
-      i::Compiler::GetSharedFunctionInfoForStreamedScript(
-          isolate, str, script_details, origin.Options(), data);
+      CompileStreamedSource(isolate, v8_source, full_source_string, origin);
 
   i::Handle<i::SharedFunctionInfo> result;
   has_pending_exception = !maybe_function_info.ToHandle(&result);
@@ -2576,6 +2741,29 @@ MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
   RETURN_ESCAPED(bound);
 }
 
+MaybeLocal<Module> ScriptCompiler::CompileModule(
+    Local<Context> context, StreamedSource* v8_source,
+    Local<String> full_source_string, const ScriptOrigin& origin) {
+  Utils::ApiCheck(origin.Options().IsModule(),
+                  "v8::ScriptCompiler::CompileModule",
+                  "Invalid ScriptOrigin: is_module must be true");
+  PREPARE_FOR_EXECUTION(context, ScriptCompiler, Compile, Module);
+  TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8", "V8.ScriptCompiler");
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.CompileStreamedModule");
+
+  i::MaybeHandle<i::SharedFunctionInfo> maybe_function_info =
+      CompileStreamedSource(isolate, v8_source, full_source_string, origin);
+
+  i::Handle<i::SharedFunctionInfo> result;
+  has_pending_exception = !maybe_function_info.ToHandle(&result);
+  if (has_pending_exception) isolate->ReportPendingMessages();
+
+  RETURN_ON_FAILED_EXECUTION(Module);
+
+  RETURN_ESCAPED(ToApiHandle<Module>(isolate->factory()->NewModule(result)));
+}
+
 uint32_t ScriptCompiler::CachedDataVersionTag() {
   return static_cast<uint32_t>(base::hash_combine(
       internal::Version::Hash(), internal::FlagList::Hash(),
@@ -3026,6 +3214,45 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+Maybe<bool> JSON::Stringify(Local<Context> context, Local<Value> json_object,
+                            OutputSink* sink, Local<String> gap) {
+  PREPARE_FOR_EXECUTION_WITH_CONTEXT(context, JSON, Stringify, Nothing<bool>(),
+                                     i::HandleScope, false);
+  i::Handle<i::Object> object = Utils::OpenHandle(*json_object);
+  i::Handle<i::Object> replacer = isolate->factory()->undefined_value();
+  i::Handle<i::String> gap_string = gap.IsEmpty()
+                                        ? isolate->factory()->empty_string()
+                                        : Utils::OpenHandle(*gap);
+  i::Handle<i::Object> maybe;
+  has_pending_exception =
+      !i::JsonStringify(isolate, object, replacer, gap_string).ToHandle(&maybe);
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  i::Handle<i::String> result;
+  has_pending_exception =
+      !i::Object::ToString(isolate, maybe).ToHandle(&result);
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  i::JsonWriteUtf8(result, sink);
+  return Just(true);
+}
+
+JSON::ChunkedParser::ChunkedParser()
+    : accumulator_(new i::JsonChunkAccumulator()) {}
+
+JSON::ChunkedParser::~ChunkedParser() { delete accumulator_; }
+
+void JSON::ChunkedParser::Append(const uint8_t* data, size_t length) {
+  accumulator_->Append(data, length);
+}
+
+MaybeLocal<Value> JSON::ChunkedParser::Finish(Local<Context> context) {
+  PREPARE_FOR_EXECUTION(context, JSON, Parse, Value);
+  Local<Value> result;
+  has_pending_exception =
+      !ToLocal<Value>(accumulator_->Parse(isolate), &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 Maybe<bool> ValueSerializer::Delegate::WriteHostObject(Isolate* v8_isolate,
@@ -3051,6 +3278,16 @@ Maybe<uint32_t> ValueSerializer::Delegate::GetWasmModuleTransferId(
   return Nothing<uint32_t>();
 }
 
+Maybe<uint32_t> ValueSerializer::Delegate::GetExternalStringId(
+    Isolate* v8_isolate, Local<String> string) {
+  return Nothing<uint32_t>();
+}
+
+Maybe<uint32_t> ValueSerializer::Delegate::GetArrayBufferContentsId(
+    Isolate* v8_isolate, Local<ArrayBuffer> array_buffer) {
+  return Nothing<uint32_t>();
+}
+
 void* ValueSerializer::Delegate::ReallocateBufferMemory(void* old_buffer,
                                                         size_t size,
                                                         size_t* actual_size) {
@@ -3150,6 +3387,25 @@ ValueDeserializer::Delegate::GetSharedArrayBufferFromId(Isolate* v8_isolate,
   return MaybeLocal<SharedArrayBuffer>();
 }
 
+MaybeLocal<String> ValueDeserializer::Delegate::GetExternalStringFromId(
+    Isolate* v8_isolate, uint32_t id) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  isolate->ScheduleThrow(*isolate->factory()->NewError(
+      isolate->error_function(),
+      i::MessageTemplate::kDataCloneDeserializationError));
+  return MaybeLocal<String>();
+}
+
+MaybeLocal<ArrayBuffer>
+ValueDeserializer::Delegate::GetArrayBufferFromContentsId(Isolate* v8_isolate,
+                                                          uint32_t id) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  isolate->ScheduleThrow(*isolate->factory()->NewError(
+      isolate->error_function(),
+      i::MessageTemplate::kDataCloneDeserializationError));
+  return MaybeLocal<ArrayBuffer>();
+}
+
 struct ValueDeserializer::PrivateData {
   PrivateData(i::Isolate* i, i::Vector<const uint8_t> data, Delegate* delegate)
       : isolate(i), deserializer(i, data, delegate) {}
@@ -4983,6 +5239,37 @@ MaybeLocal<v8::Value> Function::Call(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+Maybe<bool> Function::CallBatch(Local<Context> context,
+                                v8::Local<v8::Value> recv, int argc,
+                                int call_count, v8::Local<v8::Value> argv[]) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8", "V8.Execute");
+  ENTER_V8(isolate, context, Function, Call, Nothing<bool>(),
+           i::HandleScope);
+  i::TimerEventScope<i::TimerEventExecute> timer_scope(isolate);
+  auto self = Utils::OpenHandle(this);
+  Utils::ApiCheck(!self.is_null(), "v8::Function::CallBatch",
+                  "Function to be called is a null pointer");
+  Utils::ApiCheck(argc >= 0 && call_count >= 0, "v8::Function::CallBatch",
+                  "Negative argument or call count");
+  i::Handle<i::Object> recv_obj = Utils::OpenHandle(*recv);
+  if (recv_obj->IsJSGlobalObject()) {
+    recv_obj = handle(i::JSGlobalObject::cast(*recv_obj)->global_proxy(),
+                      isolate);
+  }
+  STATIC_ASSERT(sizeof(v8::Local<v8::Value>) == sizeof(i::Handle<i::Object>));
+  i::Handle<i::Object>* args = reinterpret_cast<i::Handle<i::Object>*>(argv);
+  for (int i = 0; i < call_count; ++i) {
+    // Don't let the results of earlier calls pile up in the handle scope.
+    i::HandleScope call_scope(isolate);
+    has_pending_exception =
+        i::Execution::Call(isolate, self, recv_obj, argc, args + i * argc)
+            .is_null();
+    RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  }
+  return Just(true);
+}
+
 
 Local<v8::Value> Function::Call(v8::Local<v8::Value> recv, int argc,
                                 v8::Local<v8::Value> argv[]) {
@@ -5268,9 +5555,30 @@ bool String::ContainsOnlyOneByte() const {
   return helper.Check(*str);
 }
 
-int String::Utf8Length(Isolate* isolate) const {
-  i::Handle<i::String> str = Utils::OpenHandle(this);
-  str = i::String::Flatten(reinterpret_cast<i::Isolate*>(isolate), str);
+// Returns the number of characters in |chars| that are not ASCII, checking a
+// word at a time.
+static int CountNonAscii(const uint8_t* chars, int length) {
+  const uint8_t* limit = chars + length;
+  int count = 0;
+  if (length >= i::kIntptrSize) {
+    // Count unaligned bytes.
+    while (!IsAligned(reinterpret_cast<intptr_t>(chars), sizeof(uintptr_t))) {
+      count += *chars++ >> 7;
+    }
+    // Count aligned words.
+    const uintptr_t non_one_byte_mask = i::kUintptrAllBitsSet / 0xFF * 0x80;
+    while (chars + sizeof(uintptr_t) <= limit) {
+      uintptr_t word = *reinterpret_cast<const uintptr_t*>(chars);
+      count += base::bits::CountPopulation(word & non_one_byte_mask);
+      chars += sizeof(uintptr_t);
+    }
+  }
+  // Count remaining unaligned bytes.
+  while (chars < limit) count += *chars++ >> 7;
+  return count;
+}
+
+static int Utf8LengthOfFlat(i::String str) {
   int length = str->length();
   if (length == 0) return 0;
   i::DisallowHeapAllocation no_gc;
@@ -5278,10 +5586,9 @@ int String::Utf8Length(Isolate* isolate) const {
   DCHECK(flat.IsFlat());
   int utf8_length = 0;
   if (flat.IsOneByte()) {
-    for (uint8_t c : flat.ToOneByteVector()) {
-      utf8_length += c >> 7;
-    }
-    utf8_length += length;
+    // Every non-ASCII character takes two bytes.
+    i::Vector<const uint8_t> chars = flat.ToOneByteVector();
+    utf8_length = length + CountNonAscii(chars.start(), length);
   } else {
     int last_character = unibrow::Utf16::kNoPreviousCharacter;
     for (uint16_t c : flat.ToUC16Vector()) {
@@ -5292,6 +5599,12 @@ int String::Utf8Length(Isolate* isolate) const {
   return utf8_length;
 }
 
+int String::Utf8Length(Isolate* isolate) const {
+  i::Handle<i::String> str = Utils::OpenHandle(this);
+  str = i::String::Flatten(reinterpret_cast<i::Isolate*>(isolate), str);
+  return Utf8LengthOfFlat(*str);
+}
+
 class Utf8WriterVisitor {
  public:
   Utf8WriterVisitor(
@@ -5379,9 +5692,18 @@ class Utf8WriterVisitor {
       }
       // Write the characters to the stream.
       if (sizeof(Char) == 1) {
-        for (; i < fast_length; i++) {
+        while (i < fast_length) {
+          // Copy runs of ASCII characters as they are.
+          int ascii_length = i::String::NonAsciiStart(
+              reinterpret_cast<const char*>(chars), fast_length - i);
+          i::MemCopy(buffer, chars, ascii_length);
+          buffer += ascii_length;
+          chars += ascii_length;
+          i += ascii_length;
+          if (i == fast_length) break;
           buffer += unibrow::Utf8::EncodeOneByte(
               buffer, static_cast<uint8_t>(*chars++));
+          i++;
           DCHECK(capacity_ == -1 || (buffer - start_) <= capacity_);
         }
       } else {
@@ -5509,8 +5831,9 @@ int String::WriteUtf8(Isolate* v8_isolate, char* buffer, int capacity,
     bool success = RecursivelySerializeToUtf8(*str, &writer, kMaxRecursion);
     if (success) return writer.CompleteWrite(write_null, nchars_ref);
   } else if (capacity >= string_length) {
-    // First check that the buffer is large enough.
-    int utf8_bytes = Utf8Length(v8_isolate);
+    // First check that the buffer is large enough. This is cheap for one-byte
+    // strings, and the string is already flat.
+    int utf8_bytes = Utf8LengthOfFlat(*str);
     if (utf8_bytes <= capacity) {
       // one-byte fast path.
       if (utf8_bytes == string_length) {
@@ -5927,6 +6250,14 @@ HeapSpaceStatistics::HeapSpaceStatistics()
       space_available_size_(0),
       physical_space_size_(0) {}
 
+FunctionICStatistics::FunctionICStatistics()
+    : function_name_(nullptr),
+      script_id_(0),
+      start_position_(0),
+      megamorphic_transitions_(0),
+      polymorphic_transitions_(0),
+      max_polymorphism_(0) {}
+
 HeapObjectStatistics::HeapObjectStatistics()
     : object_type_(nullptr),
       object_sub_type_(nullptr),
@@ -6101,7 +6432,8 @@ Local<Context> NewContext(
     v8::Isolate* external_isolate, v8::ExtensionConfiguration* extensions,
     v8::MaybeLocal<ObjectTemplate> global_template,
     v8::MaybeLocal<Value> global_object, size_t context_snapshot_index,
-    v8::DeserializeInternalFieldsCallback embedder_fields_deserializer) {
+    v8::DeserializeInternalFieldsCallback embedder_fields_deserializer,
+    v8::MicrotaskQueue* microtask_queue = nullptr) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(external_isolate);
   // TODO(jkummerow): This is for crbug.com/713699. Remove it if it doesn't
   // fail.
@@ -6120,6 +6452,10 @@ Local<Context> NewContext(
     if (isolate->has_pending_exception()) isolate->clear_pending_exception();
     return Local<Context>();
   }
+  if (microtask_queue != nullptr) {
+    env->native_context()->set_microtask_queue(
+        static_cast<i::MicrotaskQueue*>(microtask_queue));
+  }
   return Utils::ToLocal(scope.CloseAndEscape(env));
 }
 
@@ -6127,9 +6463,11 @@ Local<Context> v8::Context::New(
     v8::Isolate* external_isolate, v8::ExtensionConfiguration* extensions,
     v8::MaybeLocal<ObjectTemplate> global_template,
     v8::MaybeLocal<Value> global_object,
-    DeserializeInternalFieldsCallback internal_fields_deserializer) {
+    DeserializeInternalFieldsCallback internal_fields_deserializer,
+    v8::MicrotaskQueue* microtask_queue) {
   return NewContext(external_isolate, extensions, global_template,
-                    global_object, 0, internal_fields_deserializer);
+                    global_object, 0, internal_fields_deserializer,
+                    microtask_queue);
 }
 
 MaybeLocal<Context> v8::Context::FromSnapshot(
@@ -6256,6 +6594,41 @@ void Context::SetErrorMessageForCodeGenerationFromStrings(Local<String> error) {
   context->set_error_message_for_code_gen_from_strings(*error_handle);
 }
 
+void Context::SetPromiseHooks(Local<Function> init_hook,
+                              Local<Function> before_hook,
+                              Local<Function> after_hook,
+                              Local<Function> resolve_hook) {
+  i::Handle<i::Context> context = Utils::OpenHandle(this);
+  i::Isolate* isolate = context->GetIsolate();
+  i::Handle<i::Object> init = isolate->factory()->undefined_value();
+  i::Handle<i::Object> before = isolate->factory()->undefined_value();
+  i::Handle<i::Object> after = isolate->factory()->undefined_value();
+  i::Handle<i::Object> resolve = isolate->factory()->undefined_value();
+  bool has_hooks = false;
+  if (!init_hook.IsEmpty()) {
+    init = Utils::OpenHandle(*init_hook);
+    has_hooks = true;
+  }
+  if (!before_hook.IsEmpty()) {
+    before = Utils::OpenHandle(*before_hook);
+    has_hooks = true;
+  }
+  if (!after_hook.IsEmpty()) {
+    after = Utils::OpenHandle(*after_hook);
+    has_hooks = true;
+  }
+  if (!resolve_hook.IsEmpty()) {
+    resolve = Utils::OpenHandle(*resolve_hook);
+    has_hooks = true;
+  }
+  i::NativeContext native_context = context->native_context();
+  native_context->set_promise_hook_init_function(*init);
+  native_context->set_promise_hook_before_function(*before);
+  native_context->set_promise_hook_after_function(*after);
+  native_context->set_promise_hook_resolve_function(*resolve);
+  if (has_hooks) isolate->SetHasContextPromiseHooks();
+}
+
 namespace {
 i::Address* GetSerializedDataFromFixedArray(i::Isolate* isolate,
                                             i::FixedArray list, size_t index) {
@@ -7059,8 +7432,11 @@ enum class MapAsArrayKind {
   kValues = i::JS_MAP_VALUE_ITERATOR_TYPE
 };
 
+// Collects at most {max_entries} entries starting at {offset}, or all of them
+// if {max_entries} is zero.
 i::Handle<i::JSArray> MapAsArray(i::Isolate* isolate, i::Object* table_obj,
-                                 int offset, MapAsArrayKind kind) {
+                                 int offset, MapAsArrayKind kind,
+                                 int max_entries) {
   i::Factory* factory = isolate->factory();
   i::Handle<i::OrderedHashMap> table(i::OrderedHashMap::cast(table_obj),
                                      isolate);
@@ -7069,14 +7445,15 @@ i::Handle<i::JSArray> MapAsArray(i::Isolate* isolate, i::Object* table_obj,
   const bool collect_values =
       kind == MapAsArrayKind::kEntries || kind == MapAsArrayKind::kValues;
   int capacity = table->UsedCapacity();
-  int max_length =
-      (capacity - offset) * ((collect_keys && collect_values) ? 2 : 1);
+  int max_length = capacity - offset;
+  if (max_entries > 0) max_length = std::min(max_length, max_entries);
+  max_length *= (collect_keys && collect_values) ? 2 : 1;
   i::Handle<i::FixedArray> result = factory->NewFixedArray(max_length);
   int result_index = 0;
   {
     i::DisallowHeapAllocation no_gc;
     i::Oddball* the_hole = i::ReadOnlyRoots(isolate).the_hole_value();
-    for (int i = offset; i < capacity; ++i) {
+    for (int i = offset; i < capacity && result_index < max_length; ++i) {
       i::Object* key = table->KeyAt(i);
       if (key == the_hole) continue;
       if (collect_keys) result->set(result_index++, key);
@@ -7098,7 +7475,7 @@ Local<Array> Map::AsArray() const {
   LOG_API(isolate, Map, AsArray);
   ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
   return Utils::ToLocal(
-      MapAsArray(isolate, obj->table(), 0, MapAsArrayKind::kEntries));
+      MapAsArray(isolate, obj->table(), 0, MapAsArrayKind::kEntries, 0));
 }
 
 
@@ -7167,21 +7544,24 @@ Maybe<bool> Set::Delete(Local<Context> context, Local<Value> key) {
 }
 
 namespace {
+// Collects at most {max_entries} entries starting at {offset}, or all of them
+// if {max_entries} is zero.
 i::Handle<i::JSArray> SetAsArray(i::Isolate* isolate, i::Object* table_obj,
-                                 int offset) {
+                                 int offset, int max_entries) {
   i::Factory* factory = isolate->factory();
   i::Handle<i::OrderedHashSet> table(i::OrderedHashSet::cast(table_obj),
                                      isolate);
   // Elements skipped by |offset| may already be deleted.
   int capacity = table->UsedCapacity();
   int max_length = capacity - offset;
+  if (max_entries > 0) max_length = std::min(max_length, max_entries);
   if (max_length == 0) return factory->NewJSArray(0);
   i::Handle<i::FixedArray> result = factory->NewFixedArray(max_length);
   int result_index = 0;
   {
     i::DisallowHeapAllocation no_gc;
     i::Oddball* the_hole = i::ReadOnlyRoots(isolate).the_hole_value();
-    for (int i = offset; i < capacity; ++i) {
+    for (int i = offset; i < capacity && result_index < max_length; ++i) {
       i::Object* key = table->KeyAt(i);
       if (key == the_hole) continue;
       result->set(result_index++, key);
@@ -7200,7 +7580,7 @@ Local<Array> Set::AsArray() const {
   i::Isolate* isolate = obj->GetIsolate();
   LOG_API(isolate, Set, AsArray);
   ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
-  return Utils::ToLocal(SetAsArray(isolate, obj->table(), 0));
+  return Utils::ToLocal(SetAsArray(isolate, obj->table(), 0, 0));
 }
 
 
@@ -7544,6 +7924,10 @@ v8::ArrayBuffer::Allocator* v8::ArrayBuffer::Allocator::NewDefaultAllocator() {
   return new ArrayBufferAllocator();
 }
 
+v8::ArrayBuffer::Allocator* v8::ArrayBuffer::Allocator::NewPooledAllocator() {
+  return new i::PooledArrayBufferAllocator();
+}
+
 bool v8::ArrayBuffer::IsExternal() const {
   return Utils::OpenHandle(this)->is_external();
 }
@@ -7658,6 +8042,52 @@ Local<ArrayBuffer> v8::ArrayBuffer::New(Isolate* isolate, void* data,
   return Utils::ToLocal(obj);
 }
 
+namespace {
+
+struct ExternalBackingStoreRelease {
+  v8::ArrayBuffer::ReleaseCallback callback;
+  void* data;
+  size_t byte_length;
+  void* release_data;
+};
+
+void ReleaseExternalBackingStore(void* ptr) {
+  auto release = reinterpret_cast<ExternalBackingStoreRelease*>(ptr);
+  release->callback(release->data, release->byte_length,
+                    release->release_data);
+  delete release;
+}
+
+}  // namespace
+
+Local<ArrayBuffer> v8::ArrayBuffer::New(Isolate* isolate, void* data,
+                                        size_t byte_length,
+                                        ReleaseCallback callback,
+                                        void* release_data) {
+  CHECK_NOT_NULL(callback);
+  Local<ArrayBuffer> result =
+      New(isolate, data, byte_length, ArrayBufferCreationMode::kExternalized);
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  i::Handle<i::JSArrayBuffer> obj = Utils::OpenHandle(*result);
+  // The buffer stays externalized, so it is neither registered with the
+  // ArrayBufferTracker nor counted as external memory. The release callback
+  // is driven by the same weak handle machinery as i::Managed, which also
+  // runs it on isolate teardown.
+  auto destructor = new i::ManagedPtrDestructor(
+      0,
+      new ExternalBackingStoreRelease{callback, data, byte_length,
+                                      release_data},
+      &ReleaseExternalBackingStore);
+  i::Handle<i::Object> global_handle =
+      i_isolate->global_handles()->Create(*obj);
+  destructor->global_handle_location_ = global_handle.location();
+  i::GlobalHandles::MakeWeak(destructor->global_handle_location_, destructor,
+                             &i::ManagedObjectFinalizer,
+                             v8::WeakCallbackType::kParameter);
+  i_isolate->RegisterManagedPtrDestructor(destructor);
+  return result;
+}
+
 
 Local<ArrayBuffer> v8::ArrayBufferView::Buffer() {
   i::Handle<i::JSArrayBufferView> obj = Utils::OpenHandle(this);
@@ -8164,6 +8594,18 @@ void Isolate::RemoveGCEpilogueCallback(GCCallback callback) {
   RemoveGCEpilogueCallback(CallGCCallbackWithoutData, data);
 }
 
+void Isolate::SetGCStatisticsCallback(GCStatisticsCallback callback,
+                                      void* data) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->tracer()->SetStatisticsCallback(callback, data);
+}
+
+void Isolate::SetDeoptimizationCallback(DeoptimizationCallback callback,
+                                        void* data) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->SetDeoptimizationCallback(callback, data);
+}
+
 void Isolate::SetEmbedderHeapTracer(EmbedderHeapTracer* tracer) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   isolate->heap()->SetEmbedderHeapTracer(tracer);
@@ -8497,6 +8939,33 @@ bool Isolate::GetHeapSpaceStatistics(HeapSpaceStatistics* space_statistics,
 }
 
 
+size_t Isolate::NumberOfFunctionICStatistics() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  return isolate->function_ic_transitions()->size();
+}
+
+bool Isolate::GetFunctionICStatistics(FunctionICStatistics* statistics,
+                                      size_t index) {
+  if (!statistics) return false;
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::FunctionICTransitions* transitions = isolate->function_ic_transitions();
+  if (index >= transitions->size()) return false;
+
+  const i::FunctionICTransitions::Entry& entry = transitions->Get(index);
+  statistics->function_name_ = entry.function_name.get();
+  statistics->script_id_ = entry.script_id;
+  statistics->start_position_ = entry.start_position;
+  statistics->megamorphic_transitions_ = entry.megamorphic_transitions;
+  statistics->polymorphic_transitions_ = entry.polymorphic_transitions;
+  statistics->max_polymorphism_ = entry.max_polymorphism;
+  return true;
+}
+
+void Isolate::ResetFunctionICStatistics() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->function_ic_transitions()->Reset();
+}
+
 size_t Isolate::NumberOfTrackedHeapObjectTypes() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   i::Heap* heap = isolate->heap();
@@ -8627,18 +9096,12 @@ void Isolate::RunMicrotasks() {
 
 void Isolate::EnqueueMicrotask(Local<Function> function) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
-  i::Handle<i::CallableTask> microtask = isolate->factory()->NewCallableTask(
-      Utils::OpenHandle(*function), isolate->native_context());
-  isolate->EnqueueMicrotask(microtask);
+  isolate->default_microtask_queue()->EnqueueMicrotask(this, function);
 }
 
 void Isolate::EnqueueMicrotask(MicrotaskCallback callback, void* data) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
-  i::HandleScope scope(isolate);
-  i::Handle<i::CallbackTask> microtask = isolate->factory()->NewCallbackTask(
-      isolate->factory()->NewForeign(reinterpret_cast<i::Address>(callback)),
-      isolate->factory()->NewForeign(reinterpret_cast<i::Address>(data)));
-  isolate->EnqueueMicrotask(microtask);
+  isolate->default_microtask_queue()->EnqueueMicrotask(this, callback, data);
 }
 
 
@@ -8961,6 +9424,10 @@ void Isolate::SetAllowAtomicsWait(bool allow) {
   isolate->set_allow_atomics_wait(allow);
 }
 
+std::unique_ptr<MicrotaskQueue> MicrotaskQueue::New(Isolate* isolate) {
+  return i::MicrotaskQueue::New(reinterpret_cast<i::Isolate*>(isolate));
+}
+
 MicrotasksScope::MicrotasksScope(Isolate* isolate, MicrotasksScope::Type type)
     : isolate_(reinterpret_cast<i::Isolate*>(isolate)),
       run_(type == MicrotasksScope::kRunMicrotasks) {
@@ -9589,24 +10056,27 @@ int debug::EstimatedValueSize(Isolate* v8_isolate, v8::Local<v8::Value> value) {
   return i::Handle<i::HeapObject>::cast(object)->Size();
 }
 
-v8::MaybeLocal<v8::Array> v8::Object::PreviewEntries(bool* is_key_value) {
-  if (IsMap()) {
+namespace {
+v8::MaybeLocal<v8::Array> CollectEntriesForPreview(
+    i::Handle<i::JSReceiver> object, int max_entries, bool* is_key_value) {
+  i::Isolate* isolate = object->GetIsolate();
+  Isolate* v8_isolate = reinterpret_cast<Isolate*>(isolate);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
+  if (object->IsJSMap()) {
     *is_key_value = true;
-    return Map::Cast(this)->AsArray();
+    return Utils::ToLocal(MapAsArray(isolate, i::JSMap::cast(*object)->table(),
+                                     0, MapAsArrayKind::kEntries,
+                                     max_entries));
   }
-  if (IsSet()) {
+  if (object->IsJSSet()) {
     *is_key_value = false;
-    return Set::Cast(this)->AsArray();
+    return Utils::ToLocal(SetAsArray(isolate, i::JSSet::cast(*object)->table(),
+                                     0, max_entries));
   }
-
-  i::Handle<i::JSReceiver> object = Utils::OpenHandle(this);
-  i::Isolate* isolate = object->GetIsolate();
-  Isolate* v8_isolate = reinterpret_cast<Isolate*>(isolate);
-  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
   if (object->IsJSWeakCollection()) {
     *is_key_value = object->IsJSWeakMap();
     return Utils::ToLocal(i::JSWeakCollection::GetEntries(
-        i::Handle<i::JSWeakCollection>::cast(object), 0));
+        i::Handle<i::JSWeakCollection>::cast(object), max_entries));
   }
   if (object->IsJSMapIterator()) {
     i::Handle<i::JSMapIterator> iterator =
@@ -9616,17 +10086,29 @@ v8::MaybeLocal<v8::Array> v8::Object::PreviewEntries(bool* is_key_value) {
     *is_key_value = kind == MapAsArrayKind::kEntries;
     if (!iterator->HasMore()) return v8::Array::New(v8_isolate);
     return Utils::ToLocal(MapAsArray(isolate, iterator->table(),
-                                     i::Smi::ToInt(iterator->index()), kind));
+                                     i::Smi::ToInt(iterator->index()), kind,
+                                     max_entries));
   }
   if (object->IsJSSetIterator()) {
     i::Handle<i::JSSetIterator> it = i::Handle<i::JSSetIterator>::cast(object);
     *is_key_value = false;
     if (!it->HasMore()) return v8::Array::New(v8_isolate);
-    return Utils::ToLocal(
-        SetAsArray(isolate, it->table(), i::Smi::ToInt(it->index())));
+    return Utils::ToLocal(SetAsArray(
+        isolate, it->table(), i::Smi::ToInt(it->index()), max_entries));
   }
   return v8::MaybeLocal<v8::Array>();
 }
+}  // namespace
+
+v8::MaybeLocal<v8::Array> v8::Object::PreviewEntries(bool* is_key_value) {
+  return CollectEntriesForPreview(Utils::OpenHandle(this), 0, is_key_value);
+}
+
+MaybeLocal<Array> debug::PreviewEntries(Local<Object> object, int max_entries,
+                                        bool* is_key_value) {
+  return CollectEntriesForPreview(Utils::OpenHandle(*object), max_entries,
+                                  is_key_value);
+}
 
 Local<Function> debug::GetBuiltin(Isolate* v8_isolate, Builtin builtin) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
@@ -10143,6 +10625,15 @@ void CpuProfiler::StartProfiling(Local<String> title, CpuProfilingMode mode,
       *Utils::OpenHandle(*title), record_samples, mode);
 }
 
+void CpuProfiler::StartProfiling(Local<String> title, CpuProfilingMode mode,
+                                 CpuProfileSampleBatchCallback callback,
+                                 void* data, int batch_size) {
+  DCHECK_NOT_NULL(callback);
+  DCHECK_GT(batch_size, 0);
+  reinterpret_cast<i::CpuProfiler*>(this)->StartProfiling(
+      *Utils::OpenHandle(*title), true, mode, callback, data, batch_size);
+}
+
 CpuProfile* CpuProfiler::StopProfiling(Local<String> title) {
   return reinterpret_cast<CpuProfile*>(
       reinterpret_cast<i::CpuProfiler*>(this)->StopProfiling(
@@ -10358,12 +10849,17 @@ SnapshotObjectId HeapSnapshot::GetMaxSnapshotJSObjectId() const {
 
 void HeapSnapshot::Serialize(OutputStream* stream,
                              HeapSnapshot::SerializationFormat format) const {
-  Utils::ApiCheck(format == kJSON,
+  Utils::ApiCheck(format == kJSON || format == kBinary,
                   "v8::HeapSnapshot::Serialize",
                   "Unknown serialization format");
   Utils::ApiCheck(stream->GetChunkSize() > 0,
                   "v8::HeapSnapshot::Serialize",
                   "Invalid stream chunk size");
+  if (format == kBinary) {
+    i::HeapSnapshotBinarySerializer serializer(ToInternal(this));
+    serializer.Serialize(stream);
+    return;
+  }
   i::HeapSnapshotJSONSerializer serializer(ToInternal(this));
   serializer.Serialize(stream);
 }
@@ -10580,7 +11076,14 @@ const size_t HandleScopeImplementer::kIsMicrotaskContextOffset =
     offsetof(HandleScopeImplementer, is_microtask_context_);
 
 void HandleScopeImplementer::FreeThreadResources() {
-  Free();
+  // The spare block and the backing stores are kept for whichever thread
+  // locks the isolate next. They are released by {RestoreThread} or the
+  // destructor.
+  DCHECK(blocks_.empty());
+  DCHECK(entered_contexts_.empty());
+  DCHECK(is_microtask_context_.empty());
+  DCHECK(saved_contexts_.empty());
+  DCHECK_EQ(call_depth_, 0);
 }
 
 
@@ -10602,6 +11105,8 @@ int HandleScopeImplementer::ArchiveSpacePerThread() {
 
 
 char* HandleScopeImplementer::RestoreThread(char* storage) {
+  // Release anything kept by {FreeThreadResources} before it is overwritten.
+  Free();
   MemCopy(this, storage, sizeof(*this));
   *isolate_->handle_scope_data() = handle_scope_data_;
   return storage + ArchiveSpacePerThread();
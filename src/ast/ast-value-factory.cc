@@ -267,6 +267,10 @@ AstConsString* AstValueFactory::NewConsString(const AstRawString* str1,
 }
 
 void AstValueFactory::Internalize(Isolate* isolate) {
+  // Grow the string table once rather than rehashing it repeatedly while
+  // inserting the strings of a large script one by one.
+  StringTable::EnsureCapacityForBulkInsertion(isolate, string_count_);
+
   // Strings need to be internalized before values, because values refer to
   // strings.
   for (AstRawString* current = strings_; current != nullptr;) {
@@ -292,6 +296,11 @@ AstRawString* AstValueFactory::GetString(uint32_t hash_field, bool is_one_byte,
   // against the AstRawStrings which are in the string_table_. We should not
   // return this AstRawString.
   AstRawString key(is_one_byte, literal_bytes, hash_field);
+  base::HashMap::Entry* constant =
+      string_constants_->string_table()->Lookup(&key, key.Hash());
+  if (constant != nullptr) {
+    return reinterpret_cast<AstRawString*>(constant->key);
+  }
   base::HashMap::Entry* entry = string_table_.LookupOrInsert(&key, key.Hash());
   if (entry->value == nullptr) {
     // Copy literal contents for later comparison.
@@ -275,9 +275,10 @@ class AstValueFactory {
  public:
   AstValueFactory(Zone* zone, const AstStringConstants* string_constants,
                   uint64_t hash_seed)
-      : string_table_(string_constants->string_table()),
+      : string_table_(AstRawString::Compare),
         strings_(nullptr),
         strings_end_(&strings_),
+        string_count_(0),
         cons_strings_(nullptr),
         cons_strings_end_(&cons_strings_),
         string_constants_(string_constants),
@@ -328,6 +329,7 @@ class AstValueFactory {
   AstRawString* AddString(AstRawString* string) {
     *strings_end_ = string;
     strings_end_ = string->next_location();
+    string_count_++;
     return string;
   }
   AstConsString* AddConsString(AstConsString* string) {
@@ -338,6 +340,7 @@ class AstValueFactory {
   void ResetStrings() {
     strings_ = nullptr;
     strings_end_ = &strings_;
+    string_count_ = 0;
     cons_strings_ = nullptr;
     cons_strings_end_ = &cons_strings_;
   }
@@ -348,12 +351,18 @@ class AstValueFactory {
                           Vector<const byte> literal_bytes);
 
   // All strings are copied here, one after another (no zeroes inbetween).
+  // The isolate-wide constants are looked up in string_constants_ instead, so
+  // that creating a factory for a small lazy compile doesn't copy them.
   base::CustomMatcherHashMap string_table_;
 
   // We need to keep track of strings_ in order since cons strings require their
   // members to be internalized first.
   AstRawString* strings_;
   AstRawString** strings_end_;
+  // Number of strings in strings_, counted while parsing (which may happen on
+  // a background thread) so that internalization can size the string table
+  // up front.
+  int string_count_;
   AstConsString* cons_strings_;
   AstConsString** cons_strings_end_;
 
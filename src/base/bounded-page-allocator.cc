@@ -115,5 +115,9 @@ bool BoundedPageAllocator::DiscardSystemPages(void* address, size_t size) {
   return page_allocator_->DiscardSystemPages(address, size);
 }
 
+bool BoundedPageAllocator::AdviseHugePages(void* address, size_t size) {
+  return page_allocator_->AdviseHugePages(address, size);
+}
+
 }  // namespace base
 }  // namespace v8
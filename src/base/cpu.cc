@@ -75,7 +75,8 @@ static V8_INLINE void __cpuid(int cpu_info[4], int info_type) {
 
 #endif  // !V8_LIBC_MSVCRT
 
-#elif V8_HOST_ARCH_ARM || V8_HOST_ARCH_MIPS || V8_HOST_ARCH_MIPS64
+#elif V8_HOST_ARCH_ARM || V8_HOST_ARCH_ARM64 || V8_HOST_ARCH_MIPS || \
+    V8_HOST_ARCH_MIPS64
 
 #if V8_OS_LINUX
 
@@ -269,6 +270,7 @@ class CPUInfo final {
   size_t datalen_;
 };
 
+#if !V8_HOST_ARCH_ARM64
 // Checks that a space-separated list of items contains one given 'item'.
 static bool HasListItem(const char* list, const char* item) {
   ssize_t item_len = strlen(item);
@@ -292,10 +294,12 @@ static bool HasListItem(const char* list, const char* item) {
   }
   return false;
 }
+#endif  // !V8_HOST_ARCH_ARM64
 
 #endif  // V8_OS_LINUX
 
-#endif  //  V8_HOST_ARCH_ARM || V8_HOST_ARCH_MIPS || V8_HOST_ARCH_MIPS64
+#endif  //  V8_HOST_ARCH_ARM || V8_HOST_ARCH_ARM64 || V8_HOST_ARCH_MIPS ||
+        //  V8_HOST_ARCH_MIPS64
 
 CPU::CPU()
     : stepping_(0),
@@ -602,7 +606,31 @@ CPU::CPU()
 #endif
 
 #elif V8_HOST_ARCH_ARM64
-// Implementer, variant and part are currently unused under ARM64.
+
+#if V8_OS_LINUX
+  // Implementer and part are used to select the instruction latencies in
+  // TurboFan's instruction scheduler.
+  CPUInfo cpu_info;
+  char* implementer = cpu_info.ExtractField("CPU implementer");
+  if (implementer != nullptr) {
+    char* end;
+    implementer_ = strtol(implementer, &end, 0);
+    if (end == implementer) {
+      implementer_ = 0;
+    }
+    delete[] implementer;
+  }
+
+  char* part = cpu_info.ExtractField("CPU part");
+  if (part != nullptr) {
+    char* end;
+    part_ = strtol(part, &end, 0);
+    if (end == part) {
+      part_ = 0;
+    }
+    delete[] part;
+  }
+#endif  // V8_OS_LINUX
 
 #elif V8_HOST_ARCH_PPC
 
@@ -59,6 +59,12 @@ class V8_BASE_EXPORT CPU final {
   static const int ARM_CORTEX_A9 = 0xc09;
   static const int ARM_CORTEX_A12 = 0xc0c;
   static const int ARM_CORTEX_A15 = 0xc0f;
+  static const int ARM_CORTEX_A53 = 0xd03;
+  static const int ARM_CORTEX_A57 = 0xd07;
+  static const int ARM_CORTEX_A72 = 0xd08;
+  static const int ARM_CORTEX_A73 = 0xd09;
+  static const int ARM_CORTEX_A75 = 0xd0a;
+  static const int ARM_CORTEX_A76 = 0xd0b;
 
   // Denver-specific part code
   static const int NVIDIA_DENVER_V10 = 0x002;
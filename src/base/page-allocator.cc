@@ -62,5 +62,9 @@ bool PageAllocator::DiscardSystemPages(void* address, size_t size) {
   return base::OS::DiscardSystemPages(address, size);
 }
 
+bool PageAllocator::AdviseHugePages(void* address, size_t size) {
+  return base::OS::AdviseHugePages(address, size);
+}
+
 }  // namespace base
 }  // namespace v8
@@ -5,10 +5,86 @@
 #include "src/base/platform/mutex.h"
 
 #include <errno.h>
+#include <string.h>
+
+#ifdef V8_MUTEX_CONTENTION_STATS
+#include <atomic>
+
+#include "src/base/platform/time.h"
+#endif
 
 namespace v8 {
 namespace base {
 
+#ifdef V8_MUTEX_CONTENTION_STATS
+
+// Shared by all mutexes with the same name and never freed, so that the
+// statistics of destroyed mutexes are kept.
+struct Mutex::ContentionCounters {
+  explicit ContentionCounters(const char* name) : name(name) {}
+
+  const char* const name;
+  std::atomic<uint64_t> acquisitions{0};
+  std::atomic<uint64_t> contended_acquisitions{0};
+  std::atomic<int64_t> wait_time_in_us{0};
+  ContentionCounters* next = nullptr;
+};
+
+namespace {
+
+// The registry mutex itself is unnamed, so locking it records nothing.
+LazyMutex contention_counters_mutex = LAZY_MUTEX_INITIALIZER;
+
+}  // namespace
+
+Mutex::ContentionCounters* Mutex::contention_counters_head_ = nullptr;
+
+// static
+Mutex::ContentionCounters* Mutex::GetContentionCounters(const char* name) {
+  MutexGuard guard(contention_counters_mutex.Pointer());
+  ContentionCounters** link = &contention_counters_head_;
+  for (; *link != nullptr; link = &(*link)->next) {
+    if (strcmp((*link)->name, name) == 0) return *link;
+  }
+  *link = new ContentionCounters(name);
+  return *link;
+}
+
+// static
+std::vector<MutexContentionStats> Mutex::GetContentionStats() {
+  std::vector<MutexContentionStats> result;
+  MutexGuard guard(contention_counters_mutex.Pointer());
+  for (ContentionCounters* counters = contention_counters_head_;
+       counters != nullptr; counters = counters->next) {
+    result.push_back({counters->name, counters->acquisitions.load(),
+                      counters->contended_acquisitions.load(),
+                      counters->wait_time_in_us.load() / 1000.0});
+  }
+  return result;
+}
+
+// Locks with |try_lock| if possible, otherwise with |lock|, which is timed.
+#define LOCK_AND_RECORD_CONTENTION(counters, try_lock, lock)           \
+  do {                                                               \
+    if (!(try_lock)) {                                               \
+      TimeTicks start = TimeTicks::HighResolutionNow();              \
+      lock;                                                          \
+      (counters)->wait_time_in_us.fetch_add(                         \
+          (TimeTicks::HighResolutionNow() - start).InMicroseconds(), \
+          std::memory_order_relaxed);                                \
+      (counters)->contended_acquisitions.fetch_add(                  \
+          1, std::memory_order_relaxed);                             \
+    }                                                                \
+    (counters)->acquisitions.fetch_add(1, std::memory_order_relaxed); \
+  } while (false)
+
+#else  // V8_MUTEX_CONTENTION_STATS
+
+// static
+std::vector<MutexContentionStats> Mutex::GetContentionStats() { return {}; }
+
+#endif  // V8_MUTEX_CONTENTION_STATS
+
 #if V8_OS_POSIX
 
 static V8_INLINE void InitializeNativeHandle(pthread_mutex_t* mutex) {
@@ -85,6 +161,13 @@ Mutex::Mutex() {
 }
 
 
+Mutex::Mutex(const char* name) : Mutex() {
+#ifdef V8_MUTEX_CONTENTION_STATS
+  counters_ = GetContentionCounters(name);
+#endif
+}
+
+
 Mutex::~Mutex() {
   DestroyNativeHandle(&native_handle_);
   DCHECK_EQ(0, level_);
@@ -92,6 +175,15 @@ Mutex::~Mutex() {
 
 
 void Mutex::Lock() {
+#ifdef V8_MUTEX_CONTENTION_STATS
+  if (counters_ != nullptr) {
+    LOCK_AND_RECORD_CONTENTION(counters_,
+                               TryLockNativeHandle(&native_handle_),
+                               LockNativeHandle(&native_handle_));
+    AssertUnheldAndMark();
+    return;
+  }
+#endif
   LockNativeHandle(&native_handle_);
   AssertUnheldAndMark();
 }
@@ -107,6 +199,11 @@ bool Mutex::TryLock() {
   if (!TryLockNativeHandle(&native_handle_)) {
     return false;
   }
+#ifdef V8_MUTEX_CONTENTION_STATS
+  if (counters_ != nullptr) {
+    counters_->acquisitions.fetch_add(1, std::memory_order_relaxed);
+  }
+#endif
   AssertUnheldAndMark();
   return true;
 }
@@ -164,12 +261,28 @@ Mutex::Mutex() : native_handle_(SRWLOCK_INIT) {
 }
 
 
+Mutex::Mutex(const char* name) : Mutex() {
+#ifdef V8_MUTEX_CONTENTION_STATS
+  counters_ = GetContentionCounters(name);
+#endif
+}
+
+
 Mutex::~Mutex() {
   DCHECK_EQ(0, level_);
 }
 
 
 void Mutex::Lock() {
+#ifdef V8_MUTEX_CONTENTION_STATS
+  if (counters_ != nullptr) {
+    LOCK_AND_RECORD_CONTENTION(
+        counters_, TryAcquireSRWLockExclusive(&native_handle_),
+        AcquireSRWLockExclusive(&native_handle_));
+    AssertUnheldAndMark();
+    return;
+  }
+#endif
   AcquireSRWLockExclusive(&native_handle_);
   AssertUnheldAndMark();
 }
@@ -185,6 +298,11 @@ bool Mutex::TryLock() {
   if (!TryAcquireSRWLockExclusive(&native_handle_)) {
     return false;
   }
+#ifdef V8_MUTEX_CONTENTION_STATS
+  if (counters_ != nullptr) {
+    counters_->acquisitions.fetch_add(1, std::memory_order_relaxed);
+  }
+#endif
   AssertUnheldAndMark();
   return true;
 }
@@ -235,5 +353,7 @@ bool RecursiveMutex::TryLock() {
 
 #endif  // V8_OS_POSIX
 
+#undef LOCK_AND_RECORD_CONTENTION
+
 }  // namespace base
 }  // namespace v8
@@ -5,6 +5,9 @@
 #ifndef V8_BASE_PLATFORM_MUTEX_H_
 #define V8_BASE_PLATFORM_MUTEX_H_
 
+#include <stdint.h>
+#include <vector>
+
 #include "src/base/base-export.h"
 #include "src/base/lazy-instance.h"
 #if V8_OS_WIN
@@ -19,6 +22,15 @@
 namespace v8 {
 namespace base {
 
+// Lock statistics of all mutexes with the same name, see Mutex(const char*).
+struct MutexContentionStats {
+  const char* name;
+  uint64_t acquisitions;
+  // Acquisitions by Lock() that had to wait for another thread.
+  uint64_t contended_acquisitions;
+  double wait_time_in_ms;
+};
+
 // ----------------------------------------------------------------------------
 // Mutex
 //
@@ -37,6 +49,9 @@ namespace base {
 class V8_BASE_EXPORT Mutex final {
  public:
   Mutex();
+  // Creates a mutex whose lock statistics are recorded under |name| in builds
+  // with v8_enable_mutex_contention_stats. |name| must be a string literal.
+  explicit Mutex(const char* name);
   ~Mutex();
 
   // Locks the given mutex. If the mutex is currently unlocked, it becomes
@@ -67,11 +82,22 @@ class V8_BASE_EXPORT Mutex final {
     return native_handle_;
   }
 
+  // Returns the statistics of all names seen so far, or nothing in builds
+  // without v8_enable_mutex_contention_stats. Waiting in a ConditionVariable
+  // is not counted.
+  static std::vector<MutexContentionStats> GetContentionStats();
+
  private:
   NativeHandle native_handle_;
 #ifdef DEBUG
   int level_;
 #endif
+#ifdef V8_MUTEX_CONTENTION_STATS
+  struct ContentionCounters;
+  static ContentionCounters* GetContentionCounters(const char* name);
+  static ContentionCounters* contention_counters_head_;
+  ContentionCounters* counters_ = nullptr;
+#endif
 
   V8_INLINE void AssertHeldAndUnmark() {
 #ifdef DEBUG
@@ -276,6 +276,11 @@ class V8_BASE_EXPORT OS {
   V8_WARN_UNUSED_RESULT static bool DiscardSystemPages(void* address,
                                                        size_t size);
 
+  // Asks the OS to back the given range with transparent huge pages. Returns
+  // false if the platform does not support this.
+  V8_WARN_UNUSED_RESULT static bool AdviseHugePages(void* address,
+                                                    size_t size);
+
   static const int msPerSecond = 1000;
 
 #if V8_OS_POSIX
@@ -2482,6 +2482,27 @@ class ArrayIncludesIndexofAssembler : public CodeStubAssembler {
   void GenerateHoleyDoubles(SearchVariant variant, Node* elements,
                             Node* search_element, Node* array_length,
                             Node* from_index);
+
+ private:
+  // Calls the C++ search kernel {function} for {elements}, which returns the
+  // index of the element found, or -1.
+  TNode<IntPtrT> CallSearchKernel(ExternalReference function, Node* elements,
+                                  Node* search_element, Node* from_index,
+                                  Node* length) {
+    return UncheckedCast<IntPtrT>(CallCFunction4(
+        MachineType::IntPtr(), MachineType::AnyTagged(),
+        MachineType::AnyTagged(), MachineType::UintPtr(),
+        MachineType::UintPtr(), ExternalConstant(function), elements,
+        search_element, from_index, length));
+  }
+
+  // Binds {index_var} to the result of a search kernel and dispatches.
+  void GotoIfSearchKernelFound(TNode<IntPtrT> result, Variable* index_var,
+                               Label* found, Label* not_found) {
+    GotoIf(IntPtrLessThan(result, IntPtrConstant(0)), not_found);
+    index_var->Bind(result);
+    Goto(found);
+  }
 };
 
 void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
@@ -2552,7 +2573,8 @@ void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
   GotoIf(IntPtrGreaterThanOrEqual(index_var.value(), array_length_untagged),
          &return_not_found);
 
-  Label if_smiorobjects(this), if_packed_doubles(this), if_holey_doubles(this);
+  Label if_smiorobjects(this), if_packed_doubles(this), if_holey_doubles(this),
+      if_smis(this);
 
   TNode<Int32T> elements_kind = LoadElementsKind(array);
   Node* elements = LoadElements(array);
@@ -2560,6 +2582,11 @@ void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
   STATIC_ASSERT(HOLEY_SMI_ELEMENTS == 1);
   STATIC_ASSERT(PACKED_ELEMENTS == 2);
   STATIC_ASSERT(HOLEY_ELEMENTS == 3);
+  // A Smi can only be equal to the same Smi in Smi arrays.
+  GotoIf(Word32And(TaggedIsSmi(search_element),
+                   Uint32LessThanOrEqual(elements_kind,
+                                         Int32Constant(HOLEY_SMI_ELEMENTS))),
+         &if_smis);
   GotoIf(Uint32LessThanOrEqual(elements_kind, Int32Constant(HOLEY_ELEMENTS)),
          &if_smiorobjects);
   GotoIf(Word32Equal(elements_kind, Int32Constant(PACKED_DOUBLE_ELEMENTS)),
@@ -2568,6 +2595,19 @@ void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
          &if_holey_doubles);
   Goto(&return_not_found);
 
+  BIND(&if_smis);
+  {
+    TNode<IntPtrT> result = CallSearchKernel(
+        ExternalReference::search_identical_element(), elements,
+        search_element, index_var.value(), array_length_untagged);
+    GotoIf(IntPtrLessThan(result, intptr_zero), &return_not_found);
+    if (variant == kIncludes) {
+      args.PopAndReturn(TrueConstant());
+    } else {
+      args.PopAndReturn(SmiTag(result));
+    }
+  }
+
   BIND(&if_smiorobjects);
   {
     Callable callable =
@@ -2660,13 +2700,11 @@ void ArrayIncludesIndexofAssembler::GenerateSmiOrObject(
 
   BIND(&ident_loop);
   {
-    GotoIfNot(UintPtrLessThan(index_var.value(), array_length_untagged),
-              &return_not_found);
-    Node* element_k = LoadFixedArrayElement(CAST(elements), index_var.value());
-    GotoIf(WordEqual(element_k, search_element), &return_found);
-
-    Increment(&index_var);
-    Goto(&ident_loop);
+    TNode<IntPtrT> result = CallSearchKernel(
+        ExternalReference::search_identical_element(), elements,
+        search_element, index_var.value(), array_length_untagged);
+    GotoIfSearchKernelFound(result, &index_var, &return_found,
+                            &return_not_found);
   }
 
   if (variant == kIncludes) {
@@ -2823,16 +2861,12 @@ void ArrayIncludesIndexofAssembler::GeneratePackedDoubles(SearchVariant variant,
 
   BIND(&not_nan_loop);
   {
-    Label continue_loop(this);
-    GotoIfNot(UintPtrLessThan(index_var.value(), array_length_untagged),
-              &return_not_found);
-    Node* element_k = LoadFixedDoubleArrayElement(elements, index_var.value(),
-                                                  MachineType::Float64());
-    Branch(Float64Equal(element_k, search_num.value()), &return_found,
-           &continue_loop);
-    BIND(&continue_loop);
-    Increment(&index_var);
-    Goto(&not_nan_loop);
+    // The search element is a Smi or a HeapNumber that is not NaN here.
+    TNode<IntPtrT> result = CallSearchKernel(
+        ExternalReference::search_double_element(), elements, search_element,
+        index_var.value(), array_length_untagged);
+    GotoIfSearchKernelFound(result, &index_var, &return_found,
+                            &return_not_found);
   }
 
   // Array.p.includes uses SameValueZero comparisons, where NaN == NaN.
@@ -2896,20 +2930,12 @@ void ArrayIncludesIndexofAssembler::GenerateHoleyDoubles(SearchVariant variant,
 
   BIND(&not_nan_loop);
   {
-    Label continue_loop(this);
-    GotoIfNot(UintPtrLessThan(index_var.value(), array_length_untagged),
-              &return_not_found);
-
-    // No need for hole checking here; the following Float64Equal will
-    // return 'not equal' for holes anyway.
-    Node* element_k = LoadFixedDoubleArrayElement(elements, index_var.value(),
-                                                  MachineType::Float64());
-
-    Branch(Float64Equal(element_k, search_num.value()), &return_found,
-           &continue_loop);
-    BIND(&continue_loop);
-    Increment(&index_var);
-    Goto(&not_nan_loop);
+    // No need for hole checking here; holes compare 'not equal' anyway.
+    TNode<IntPtrT> result = CallSearchKernel(
+        ExternalReference::search_double_element(), elements, search_element,
+        index_var.value(), array_length_untagged);
+    GotoIfSearchKernelFound(result, &index_var, &return_found,
+                            &return_not_found);
   }
 
   // Array.p.includes uses SameValueZero comparisons, where NaN == NaN.
@@ -154,14 +154,22 @@ TF_BUILTIN(AsyncFunctionEnter, AsyncFunctionBuiltinsAssembler) {
   // in an async function on the catch prediction stack to handle exceptions
   // thrown before the first await.
   Label if_instrumentation(this, Label::kDeferred),
-      if_instrumentation_done(this);
-  Branch(IsPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(),
-         &if_instrumentation, &if_instrumentation_done);
+      if_context_hooks(this, Label::kDeferred), if_instrumentation_done(this);
+  GotoIf(IsPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(),
+         &if_instrumentation);
+  Branch(HasContextPromiseHooks(), &if_context_hooks,
+         &if_instrumentation_done);
   BIND(&if_instrumentation);
   {
     CallRuntime(Runtime::kDebugAsyncFunctionEntered, context, promise);
     Goto(&if_instrumentation_done);
   }
+  BIND(&if_context_hooks);
+  {
+    RunContextPromiseHook(Context::PROMISE_HOOK_INIT_FUNCTION_INDEX, context,
+                          promise, UndefinedConstant());
+    Goto(&if_instrumentation_done);
+  }
   BIND(&if_instrumentation_done);
 
   Return(async_function_object);
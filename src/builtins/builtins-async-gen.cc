@@ -39,6 +39,26 @@ Node* AsyncBuiltinsAssembler::AwaitOld(Node* context, Node* generator,
   static const int kTotalSize =
       kRejectClosureOffset + JSFunction::kSizeWithoutPrototype;
 
+  VARIABLE(var_result, MachineRepresentation::kTagged);
+  Label if_closures(this), done(this);
+
+  // Just like in `AwaitOptimized`, async functions don't need the await
+  // context and closures unless PromiseHooks or the debugger are involved,
+  // only the wrapper promise is still necessary here.
+  GotoIfNot(HasInstanceType(generator, JS_ASYNC_FUNCTION_OBJECT_TYPE),
+            &if_closures);
+  GotoIf(IsAnyPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(),
+         &if_closures);
+  {
+    Node* const wrapped_value = AllocateAndInitJSPromise(context);
+    CallBuiltin(Builtins::kResolvePromise, context, wrapped_value, value);
+    var_result.Bind(CallBuiltin(Builtins::kPerformPromiseThen, context,
+                                wrapped_value, generator, generator,
+                                UndefinedConstant()));
+    Goto(&done);
+  }
+
+  BIND(&if_closures);
   TNode<HeapObject> base = AllocateInNewSpace(kTotalSize);
   TNode<Context> closure_context = UncheckedCast<Context>(base);
   {
@@ -96,21 +116,38 @@ Node* AsyncBuiltinsAssembler::AwaitOld(Node* context, Node* generator,
   // Deal with PromiseHooks and debug support in the runtime. This
   // also allocates the throwaway promise, which is only needed in
   // case of PromiseHooks or debugging.
-  Label if_debugging(this, Label::kDeferred), do_resolve_promise(this);
-  Branch(IsPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(),
-         &if_debugging, &do_resolve_promise);
+  Label if_debugging(this, Label::kDeferred),
+      if_context_hooks(this, Label::kDeferred), do_resolve_promise(this);
+  GotoIf(IsPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(),
+         &if_debugging);
+  Branch(HasContextPromiseHooks(), &if_context_hooks, &do_resolve_promise);
   BIND(&if_debugging);
   var_throwaway.Bind(CallRuntime(Runtime::kAwaitPromisesInitOld, context, value,
                                  wrapped_value, outer_promise, on_reject,
                                  is_predicted_as_caught));
   Goto(&do_resolve_promise);
+  BIND(&if_context_hooks);
+  {
+    // Context promise hooks only need the init hooks and the throwaway
+    // promise, all of which we can do here.
+    RunPromiseHookInit(context, wrapped_value, outer_promise);
+    Node* const throwaway = AllocateAndInitJSPromise(context, wrapped_value);
+    PromiseSetHasHandler(throwaway);
+    var_throwaway.Bind(throwaway);
+    Goto(&do_resolve_promise);
+  }
   BIND(&do_resolve_promise);
 
   // Perform ! Call(promiseCapability.[[Resolve]], undefined, « promise »).
   CallBuiltin(Builtins::kResolvePromise, context, wrapped_value, value);
 
-  return CallBuiltin(Builtins::kPerformPromiseThen, context, wrapped_value,
-                     on_resolve, on_reject, var_throwaway.value());
+  var_result.Bind(CallBuiltin(Builtins::kPerformPromiseThen, context,
+                              wrapped_value, on_resolve, on_reject,
+                              var_throwaway.value()));
+  Goto(&done);
+
+  BIND(&done);
+  return var_result.value();
 }
 
 Node* AsyncBuiltinsAssembler::AwaitOptimized(Node* context, Node* generator,
@@ -132,6 +169,24 @@ Node* AsyncBuiltinsAssembler::AwaitOptimized(Node* context, Node* generator,
   // Node* const promise =
   // CallBuiltin(Builtins::kPromiseResolve, context, promise_fun, value);
 
+  VARIABLE(var_result, MachineRepresentation::kTagged);
+  Label if_closures(this), done(this);
+
+  // Async functions have exactly one pair of await continuations, which the
+  // PromiseReactionJob can run directly on the JSAsyncFunctionObject. So
+  // unless PromiseHooks or the debugger need the closures and the throwaway
+  // promise, we register the {generator} itself as both handlers and don't
+  // allocate the await context and closures at all.
+  GotoIfNot(HasInstanceType(generator, JS_ASYNC_FUNCTION_OBJECT_TYPE),
+            &if_closures);
+  GotoIf(IsAnyPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(),
+         &if_closures);
+  var_result.Bind(CallBuiltin(Builtins::kPerformPromiseThen, native_context,
+                              promise, generator, generator,
+                              UndefinedConstant()));
+  Goto(&done);
+
+  BIND(&if_closures);
   TNode<HeapObject> base = AllocateInNewSpace(kTotalSize);
   TNode<Context> closure_context = UncheckedCast<Context>(base);
   {
@@ -167,18 +222,35 @@ Node* AsyncBuiltinsAssembler::AwaitOptimized(Node* context, Node* generator,
   // Deal with PromiseHooks and debug support in the runtime. This
   // also allocates the throwaway promise, which is only needed in
   // case of PromiseHooks or debugging.
-  Label if_debugging(this, Label::kDeferred), do_perform_promise_then(this);
-  Branch(IsPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(),
-         &if_debugging, &do_perform_promise_then);
+  Label if_debugging(this, Label::kDeferred),
+      if_context_hooks(this, Label::kDeferred), do_perform_promise_then(this);
+  GotoIf(IsPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(),
+         &if_debugging);
+  Branch(HasContextPromiseHooks(), &if_context_hooks,
+         &do_perform_promise_then);
   BIND(&if_debugging);
   var_throwaway.Bind(CallRuntime(Runtime::kAwaitPromisesInit, context, promise,
                                  promise, outer_promise, on_reject,
                                  is_predicted_as_caught));
   Goto(&do_perform_promise_then);
+  BIND(&if_context_hooks);
+  {
+    // Context promise hooks only need the throwaway promise and its init
+    // hook, so there's no need to go to the runtime.
+    Node* const throwaway = AllocateAndInitJSPromise(context, promise);
+    PromiseSetHasHandler(throwaway);
+    var_throwaway.Bind(throwaway);
+    Goto(&do_perform_promise_then);
+  }
   BIND(&do_perform_promise_then);
 
-  return CallBuiltin(Builtins::kPerformPromiseThen, native_context, promise,
-                     on_resolve, on_reject, var_throwaway.value());
+  var_result.Bind(CallBuiltin(Builtins::kPerformPromiseThen, native_context,
+                              promise, on_resolve, on_reject,
+                              var_throwaway.value()));
+  Goto(&done);
+
+  BIND(&done);
+  return var_result.value();
 }
 
 Node* AsyncBuiltinsAssembler::Await(Node* context, Node* generator, Node* value,
@@ -187,7 +259,8 @@ Node* AsyncBuiltinsAssembler::Await(Node* context, Node* generator, Node* value,
                                     Node* on_reject_context_index,
                                     Node* is_predicted_as_caught) {
   VARIABLE(result, MachineRepresentation::kTagged);
-  Label if_old(this), if_new(this), done(this),
+  VARIABLE(var_promise, MachineRepresentation::kTagged, value);
+  Label if_old(this), if_new(this, &var_promise), if_wrap(this), done(this),
       if_slow_constructor(this, Label::kDeferred);
 
   STATIC_ASSERT(sizeof(FLAG_harmony_await_optimization) == 1);
@@ -203,9 +276,9 @@ Node* AsyncBuiltinsAssembler::Await(Node* context, Node* generator, Node* value,
   // intrinsics %Promise% constructor as its "constructor", we don't need
   // to allocate the wrapper promise and can just use the `AwaitOptimized`
   // logic.
-  GotoIf(TaggedIsSmi(value), &if_old);
+  GotoIf(TaggedIsSmi(value), &if_wrap);
   Node* const value_map = LoadMap(value);
-  GotoIfNot(IsJSPromiseMap(value_map), &if_old);
+  GotoIfNot(IsJSPromiseMap(value_map), &if_wrap);
   // We can skip the "constructor" lookup on {value} if it's [[Prototype]]
   // is the (initial) Promise.prototype and the @@species protector is
   // intact, as that guards the lookup path for "constructor" on
@@ -229,6 +302,19 @@ Node* AsyncBuiltinsAssembler::Await(Node* context, Node* generator, Node* value,
     Branch(WordEqual(value_constructor, promise_function), &if_new, &if_old);
   }
 
+  // If {value} is not a JSPromise at all, `PromiseResolve(%Promise%,value)`
+  // wraps it into a fresh native promise, so we can still use the
+  // `AwaitOptimized` logic on that (and avoid the closures for async
+  // functions). The wrapper's init hook gets the {outer_promise} as its
+  // parent, just like with `AwaitOld`.
+  BIND(&if_wrap);
+  {
+    Node* const promise = AllocateAndInitJSPromise(context, outer_promise);
+    CallBuiltin(Builtins::kResolvePromise, context, promise, value);
+    var_promise.Bind(promise);
+    Goto(&if_new);
+  }
+
   BIND(&if_old);
   result.Bind(AwaitOld(context, generator, value, outer_promise,
                        on_resolve_context_index, on_reject_context_index,
@@ -236,9 +322,9 @@ Node* AsyncBuiltinsAssembler::Await(Node* context, Node* generator, Node* value,
   Goto(&done);
 
   BIND(&if_new);
-  result.Bind(AwaitOptimized(context, generator, value, outer_promise,
-                             on_resolve_context_index, on_reject_context_index,
-                             is_predicted_as_caught));
+  result.Bind(AwaitOptimized(context, generator, var_promise.value(),
+                             outer_promise, on_resolve_context_index,
+                             on_reject_context_index, is_predicted_as_caught));
   Goto(&done);
 
   BIND(&done);
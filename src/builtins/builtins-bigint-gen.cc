@@ -42,5 +42,18 @@ TF_BUILTIN(I64ToBigInt, CodeStubAssembler) {
   Return(BigIntFromInt64(argument));
 }
 
+// https://tc39.github.io/proposal-bigint/#sec-bigint.asuintn
+TF_BUILTIN(U64ToBigInt, CodeStubAssembler) {
+  if (!Is64()) {
+    Unreachable();
+    return;
+  }
+
+  TNode<UintPtrT> argument =
+      UncheckedCast<UintPtrT>(Parameter(Descriptor::kArgument));
+
+  Return(BigIntFromUint64(argument));
+}
+
 }  // namespace internal
 }  // namespace v8
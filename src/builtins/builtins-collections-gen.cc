@@ -1584,6 +1584,9 @@ void CollectionsBuiltinsAssembler::StoreOrderedHashMapNewEntry(
   StoreFixedArrayElement(table, entry_start, value, UPDATE_WRITE_BARRIER,
                          kPointerSize * (OrderedHashMap::HashTableStartIndex() +
                                          OrderedHashMap::kValueOffset));
+  StoreFixedArrayElement(table, entry_start, SmiTag(hash), SKIP_WRITE_BARRIER,
+                         kPointerSize * (OrderedHashMap::HashTableStartIndex() +
+                                         OrderedHashMap::kHashOffset));
   StoreFixedArrayElement(table, entry_start, bucket_entry, SKIP_WRITE_BARRIER,
                          kPointerSize * (OrderedHashMap::HashTableStartIndex() +
                                          OrderedHashMap::kChainOffset));
@@ -1751,6 +1754,9 @@ void CollectionsBuiltinsAssembler::StoreOrderedHashSetNewEntry(
       number_of_buckets);
   StoreFixedArrayElement(table, entry_start, key, UPDATE_WRITE_BARRIER,
                          kPointerSize * OrderedHashSet::HashTableStartIndex());
+  StoreFixedArrayElement(table, entry_start, SmiTag(hash), SKIP_WRITE_BARRIER,
+                         kPointerSize * (OrderedHashSet::HashTableStartIndex() +
+                                         OrderedHashSet::kHashOffset));
   StoreFixedArrayElement(table, entry_start, bucket_entry, SKIP_WRITE_BARRIER,
                          kPointerSize * (OrderedHashSet::HashTableStartIndex() +
                                          OrderedHashSet::kChainOffset));
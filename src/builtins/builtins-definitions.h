@@ -208,6 +208,7 @@ namespace internal {
   TFC(GetSuperConstructor, Typeof, 1)                                          \
   TFC(BigIntToI64, BigIntToI64, 1)                                             \
   TFC(I64ToBigInt, BigIntToWasmI64, 1)                                         \
+  TFC(U64ToBigInt, BigIntToWasmI64, 1)                                         \
                                                                                \
   /* Type conversions continuations */                                         \
   TFC(ToBooleanLazyDeoptContinuation, TypeConversionStackParameter, 1)         \
@@ -824,6 +825,8 @@ namespace internal {
   /* ES #sec-object-constructor */                                             \
   TFJ(ObjectConstructor, SharedFunctionInfo::kDontAdaptArgumentsSentinel)      \
   TFJ(ObjectAssign, SharedFunctionInfo::kDontAdaptArgumentsSentinel)           \
+  /* ES #sec-copydataproperties */                                             \
+  TFS(CopyDataProperties, kTarget, kSource)                                    \
   /* ES #sec-object.create */                                                  \
   TFJ(ObjectCreate, SharedFunctionInfo::kDontAdaptArgumentsSentinel)           \
   TFS(CreateObjectWithoutProperties, kPrototypeArg)                            \
@@ -21,7 +21,7 @@ class MicrotaskQueueBuiltinsAssembler : public CodeStubAssembler {
   explicit MicrotaskQueueBuiltinsAssembler(compiler::CodeAssemblerState* state)
       : CodeStubAssembler(state) {}
 
-  TNode<IntPtrT> GetDefaultMicrotaskQueue();
+  TNode<IntPtrT> GetRunningMicrotaskQueue();
   TNode<IntPtrT> GetMicrotaskQueue(TNode<Context> context);
   TNode<IntPtrT> GetMicrotaskRingBuffer(TNode<IntPtrT> microtask_queue);
   TNode<IntPtrT> GetMicrotaskQueueCapacity(TNode<IntPtrT> microtask_queue);
@@ -44,12 +44,13 @@ class MicrotaskQueueBuiltinsAssembler : public CodeStubAssembler {
   void EnterMicrotaskContext(TNode<Context> native_context);
   void RewindEnteredContext(TNode<IntPtrT> saved_entered_context_count);
 
-  void RunPromiseHook(Runtime::FunctionId id, TNode<Context> context,
+  void RunPromiseHook(Runtime::FunctionId id, int context_index,
+                      TNode<Context> context,
                       SloppyTNode<HeapObject> promise_or_capability);
 };
 
-TNode<IntPtrT> MicrotaskQueueBuiltinsAssembler::GetDefaultMicrotaskQueue() {
-  auto ref = ExternalReference::default_microtask_queue_address(isolate());
+TNode<IntPtrT> MicrotaskQueueBuiltinsAssembler::GetRunningMicrotaskQueue() {
+  auto ref = ExternalReference::running_microtask_queue_address(isolate());
   return UncheckedCast<IntPtrT>(
       Load(MachineType::Pointer(), ExternalConstant(ref)));
 }
@@ -230,8 +231,9 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
         microtask, PromiseReactionJobTask::kPromiseOrCapabilityOffset);
 
     // Run the promise before/debug hook if enabled.
-    RunPromiseHook(Runtime::kPromiseHookBefore, microtask_context,
-                   promise_or_capability);
+    RunPromiseHook(Runtime::kPromiseHookBefore,
+                   Context::PROMISE_HOOK_BEFORE_FUNCTION_INDEX,
+                   microtask_context, promise_or_capability);
 
     Node* const result =
         CallBuiltin(Builtins::kPromiseFulfillReactionJob, microtask_context,
@@ -239,8 +241,9 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     GotoIfException(result, &if_exception, &var_exception);
 
     // Run the promise after/debug hook if enabled.
-    RunPromiseHook(Runtime::kPromiseHookAfter, microtask_context,
-                   promise_or_capability);
+    RunPromiseHook(Runtime::kPromiseHookAfter,
+                   Context::PROMISE_HOOK_AFTER_FUNCTION_INDEX,
+                   microtask_context, promise_or_capability);
 
     RewindEnteredContext(saved_entered_context_count);
     SetCurrentContext(current_context);
@@ -265,8 +268,9 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
         microtask, PromiseReactionJobTask::kPromiseOrCapabilityOffset);
 
     // Run the promise before/debug hook if enabled.
-    RunPromiseHook(Runtime::kPromiseHookBefore, microtask_context,
-                   promise_or_capability);
+    RunPromiseHook(Runtime::kPromiseHookBefore,
+                   Context::PROMISE_HOOK_BEFORE_FUNCTION_INDEX,
+                   microtask_context, promise_or_capability);
 
     Node* const result =
         CallBuiltin(Builtins::kPromiseRejectReactionJob, microtask_context,
@@ -274,8 +278,9 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     GotoIfException(result, &if_exception, &var_exception);
 
     // Run the promise after/debug hook if enabled.
-    RunPromiseHook(Runtime::kPromiseHookAfter, microtask_context,
-                   promise_or_capability);
+    RunPromiseHook(Runtime::kPromiseHookAfter,
+                   Context::PROMISE_HOOK_AFTER_FUNCTION_INDEX,
+                   microtask_context, promise_or_capability);
 
     RewindEnteredContext(saved_entered_context_count);
     SetCurrentContext(current_context);
@@ -438,10 +443,10 @@ void MicrotaskQueueBuiltinsAssembler::RewindEnteredContext(
 }
 
 void MicrotaskQueueBuiltinsAssembler::RunPromiseHook(
-    Runtime::FunctionId id, TNode<Context> context,
+    Runtime::FunctionId id, int context_index, TNode<Context> context,
     SloppyTNode<HeapObject> promise_or_capability) {
   Label hook(this, Label::kDeferred), done_hook(this);
-  Branch(IsPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(), &hook,
+  Branch(IsAnyPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(), &hook,
          &done_hook);
   BIND(&hook);
   {
@@ -455,8 +460,19 @@ void MicrotaskQueueBuiltinsAssembler::RunPromiseHook(
 
         [=] { return promise_or_capability; });
     GotoIf(IsUndefined(promise), &done_hook);
+
+    // The runtime takes care of the context promise hooks as well, otherwise
+    // call them directly.
+    Label if_runtime(this), if_context_hook(this);
+    Branch(IsPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(),
+           &if_runtime, &if_context_hook);
+    BIND(&if_runtime);
     CallRuntime(id, context, promise);
     Goto(&done_hook);
+    BIND(&if_context_hook);
+    GotoIfNot(IsJSPromise(promise), &done_hook);
+    RunContextPromiseHook(context_index, context, promise, UndefinedConstant());
+    Goto(&done_hook);
   }
   BIND(&done_hook);
 }
@@ -507,10 +523,10 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
   // Load the current context from the isolate.
   TNode<Context> current_context = GetCurrentContext();
 
-  // TODO(tzik): Take a MicrotaskQueue parameter to support non-default queue.
-  TNode<IntPtrT> microtask_queue = GetDefaultMicrotaskQueue();
+  // MicrotaskQueue::RunMicrotasks() puts the queue to drain onto the isolate.
+  TNode<IntPtrT> microtask_queue = GetRunningMicrotaskQueue();
 
-  Label loop(this), done(this);
+  Label loop(this), run(this), done(this), if_refill(this, Label::kDeferred);
   Goto(&loop);
   BIND(&loop);
 
@@ -519,6 +535,29 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
   // Exit if the queue is empty.
   GotoIf(WordEqual(size, IntPtrConstant(0)), &done);
 
+  // Check the run budget. Once the countdown hits zero we ask the C++ side
+  // how many more microtasks we may run, which is zero if the budget for
+  // this run is used up.
+  TNode<IntPtrT> countdown = UncheckedCast<IntPtrT>(
+      Load(MachineType::IntPtr(), microtask_queue,
+           IntPtrConstant(MicrotaskQueue::kRunCountdownOffset)));
+  Branch(WordEqual(countdown, IntPtrConstant(0)), &if_refill, &run);
+
+  BIND(&if_refill);
+  {
+    Node* function = ExternalConstant(
+        ExternalReference::call_refill_run_countdown_function());
+    TNode<IntPtrT> refilled = UncheckedCast<IntPtrT>(
+        CallCFunction1(MachineType::IntPtr(), MachineType::Pointer(), function,
+                       microtask_queue));
+    Branch(WordEqual(refilled, IntPtrConstant(0)), &done, &loop);
+  }
+
+  BIND(&run);
+  StoreNoWriteBarrier(MachineType::PointerRepresentation(), microtask_queue,
+                      IntPtrConstant(MicrotaskQueue::kRunCountdownOffset),
+                      IntPtrSub(countdown, IntPtrConstant(1)));
+
   TNode<IntPtrT> ring_buffer = GetMicrotaskRingBuffer(microtask_queue);
   TNode<IntPtrT> capacity = GetMicrotaskQueueCapacity(microtask_queue);
   TNode<IntPtrT> start = GetMicrotaskQueueStart(microtask_queue);
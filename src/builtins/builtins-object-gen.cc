@@ -569,6 +569,50 @@ void ObjectBuiltinsAssembler::ObjectAssignFast(TNode<Context> context,
   BIND(&done);
 }
 
+// ES #sec-copydataproperties
+// Used for object spread properties after the first one, which is handled by
+// CloneObjectIC. The {target} is always a fresh object literal, so the
+// properties can be defined with the literal store semantics.
+TF_BUILTIN(CopyDataProperties, ObjectBuiltinsAssembler) {
+  TNode<JSObject> target = CAST(Parameter(Descriptor::kTarget));
+  TNode<Object> source = CAST(Parameter(Descriptor::kSource));
+  TNode<Context> context = CAST(Parameter(Descriptor::kContext));
+
+  Label if_runtime(this, Label::kDeferred), done(this);
+
+  // Only JSReceivers and non-empty strings have enumerable own properties.
+  GotoIf(TaggedIsSmi(source), &done);
+  TNode<Map> source_map = LoadMap(CAST(source));
+  TNode<Int32T> source_instance_type = LoadMapInstanceType(source_map);
+  {
+    Label cont(this);
+    GotoIf(IsJSReceiverInstanceType(source_instance_type), &cont);
+    GotoIfNot(IsStringInstanceType(source_instance_type), &done);
+    Branch(Word32Equal(LoadStringLengthAsWord32(CAST(source)),
+                       Int32Constant(0)),
+           &done, &if_runtime);
+    BIND(&cont);
+  }
+
+  GotoIfNot(IsJSObjectInstanceType(source_instance_type), &if_runtime);
+  GotoIfNot(IsEmptyFixedArray(LoadElements(CAST(source))), &if_runtime);
+
+  ForEachEnumerableOwnProperty(
+      context, source_map, CAST(source),
+      [=](TNode<Name> key, TNode<Object> value) {
+        KeyedStoreGenericGenerator::SetPropertyInLiteral(state(), context,
+                                                         target, key, value);
+      },
+      &if_runtime);
+  Goto(&done);
+
+  BIND(&if_runtime);
+  TailCallRuntime(Runtime::kCopyDataProperties, context, target, source);
+
+  BIND(&done);
+  Return(UndefinedConstant());
+}
+
 // ES #sec-object.keys
 TF_BUILTIN(ObjectKeys, ObjectBuiltinsAssembler) {
   Node* object = Parameter(Descriptor::kObject);
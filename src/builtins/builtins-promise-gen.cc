@@ -12,6 +12,7 @@
 #include "src/code-factory.h"
 #include "src/code-stub-assembler.h"
 #include "src/objects-inl.h"
+#include "src/objects/js-generator.h"
 #include "src/objects/js-promise.h"
 #include "src/objects/smi.h"
 
@@ -57,13 +58,7 @@ Node* PromiseBuiltinsAssembler::AllocateAndInitJSPromise(Node* context,
                                                          Node* parent) {
   Node* const instance = AllocateJSPromise(context);
   PromiseInit(instance);
-
-  Label out(this);
-  GotoIfNot(IsPromiseHookEnabledOrHasAsyncEventDelegate(), &out);
-  CallRuntime(Runtime::kPromiseHookInit, context, instance, parent);
-  Goto(&out);
-
-  BIND(&out);
+  RunPromiseHookInit(context, instance, parent);
   return instance;
 }
 
@@ -82,16 +77,25 @@ Node* PromiseBuiltinsAssembler::AllocateAndSetJSPromise(
     StoreObjectFieldNoWriteBarrier(instance, offset, SmiConstant(0));
   }
 
-  Label out(this);
-  GotoIfNot(IsPromiseHookEnabledOrHasAsyncEventDelegate(), &out);
-  CallRuntime(Runtime::kPromiseHookInit, context, instance,
-              UndefinedConstant());
-  Goto(&out);
-
-  BIND(&out);
+  RunPromiseHookInit(context, instance, UndefinedConstant());
   return instance;
 }
 
+void PromiseBuiltinsAssembler::RunPromiseHookInit(Node* context, Node* promise,
+                                                  Node* parent) {
+  Label if_runtime(this, Label::kDeferred), done(this);
+  GotoIf(IsPromiseHookEnabledOrHasAsyncEventDelegate(), &if_runtime);
+  RunContextPromiseHook(Context::PROMISE_HOOK_INIT_FUNCTION_INDEX, context,
+                        promise, parent);
+  Goto(&done);
+
+  BIND(&if_runtime);
+  CallRuntime(Runtime::kPromiseHookInit, context, promise, parent);
+  Goto(&done);
+
+  BIND(&done);
+}
+
 std::pair<Node*, Node*>
 PromiseBuiltinsAssembler::CreatePromiseResolvingFunctions(
     Node* promise, Node* debug_event, Node* native_context) {
@@ -274,6 +278,11 @@ Node* PromiseBuiltinsAssembler::PromiseHasHandler(Node* promise) {
   return IsSetWord(SmiUntag(flags), 1 << JSPromise::kHasHandlerBit);
 }
 
+Node* PromiseBuiltinsAssembler::IsPromiseReactionHandler(Node* handler) {
+  return Word32Or(Word32Or(IsUndefined(handler), IsCallable(handler)),
+                  HasInstanceType(handler, JS_ASYNC_FUNCTION_OBJECT_TYPE));
+}
+
 void PromiseBuiltinsAssembler::PromiseSetHasHandler(Node* promise) {
   TNode<Smi> const flags =
       CAST(LoadObjectField(promise, JSPromise::kFlagsOffset));
@@ -321,9 +330,8 @@ void PromiseBuiltinsAssembler::PerformPromiseThen(
     Node* result_promise_or_capability) {
   CSA_ASSERT(this, TaggedIsNotSmi(promise));
   CSA_ASSERT(this, IsJSPromise(promise));
-  CSA_ASSERT(this,
-             Word32Or(IsCallable(on_fulfilled), IsUndefined(on_fulfilled)));
-  CSA_ASSERT(this, Word32Or(IsCallable(on_rejected), IsUndefined(on_rejected)));
+  CSA_ASSERT(this, IsPromiseReactionHandler(on_fulfilled));
+  CSA_ASSERT(this, IsPromiseReactionHandler(on_rejected));
   CSA_ASSERT(this, TaggedIsNotSmi(result_promise_or_capability));
   CSA_ASSERT(
       this,
@@ -889,10 +897,7 @@ TF_BUILTIN(PromiseConstructor, PromiseBuiltinsAssembler) {
         context, promise_fun, new_target);
     PromiseInit(instance);
     var_result.Bind(instance);
-
-    GotoIfNot(IsPromiseHookEnabledOrHasAsyncEventDelegate(), &debug_push);
-    CallRuntime(Runtime::kPromiseHookInit, context, instance,
-                UndefinedConstant());
+    RunPromiseHookInit(context, instance, UndefinedConstant());
     Goto(&debug_push);
   }
 
@@ -1110,7 +1115,7 @@ TF_BUILTIN(PromiseResolveThenableJob, PromiseBuiltinsAssembler) {
   GotoIfNot(WordEqual(then, promise_then), &if_slow);
   Node* const thenable_map = LoadMap(thenable);
   GotoIfNot(IsJSPromiseMap(thenable_map), &if_slow);
-  GotoIf(IsPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(),
+  GotoIf(IsAnyPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(),
          &if_slow);
   BranchIfPromiseSpeciesLookupChainIntact(native_context, thenable_map,
                                           &if_fast, &if_slow);
@@ -1180,7 +1185,7 @@ void PromiseBuiltinsAssembler::PromiseReactionJob(Node* context, Node* argument,
                                                   Node* promise_or_capability,
                                                   PromiseReaction::Type type) {
   CSA_ASSERT(this, TaggedIsNotSmi(handler));
-  CSA_ASSERT(this, Word32Or(IsUndefined(handler), IsCallable(handler)));
+  CSA_ASSERT(this, IsPromiseReactionHandler(handler));
   CSA_ASSERT(this, TaggedIsNotSmi(promise_or_capability));
   CSA_ASSERT(this,
              Word32Or(Word32Or(IsJSPromise(promise_or_capability),
@@ -1188,11 +1193,29 @@ void PromiseBuiltinsAssembler::PromiseReactionJob(Node* context, Node* argument,
                       IsUndefined(promise_or_capability)));
 
   VARIABLE(var_handler_result, MachineRepresentation::kTagged, argument);
-  Label if_handler_callable(this), if_fulfill(this), if_reject(this),
-      if_internal(this);
-  Branch(IsUndefined(handler),
-         type == PromiseReaction::kFulfill ? &if_fulfill : &if_reject,
-         &if_handler_callable);
+  Label if_handler_callable(this), if_handler_async_function(this),
+      if_fulfill(this), if_reject(this), if_internal(this);
+  GotoIf(IsUndefined(handler),
+         type == PromiseReaction::kFulfill ? &if_fulfill : &if_reject);
+  Branch(HasInstanceType(handler, JS_ASYNC_FUNCTION_OBJECT_TYPE),
+         &if_handler_async_function, &if_handler_callable);
+
+  BIND(&if_handler_async_function);
+  {
+    // The {handler} is a suspended async function that awaited the promise
+    // (see AsyncBuiltinsAssembler::AwaitOptimized), so resume it directly,
+    // just like the AsyncFunctionAwait{Resolve,Reject}Closure would do.
+    CSA_ASSERT(this, IsUndefined(promise_or_capability));
+    StoreObjectFieldNoWriteBarrier(
+        handler, JSGeneratorObject::kResumeModeOffset,
+        SmiConstant(type == PromiseReaction::kFulfill
+                        ? JSGeneratorObject::kNext
+                        : JSGeneratorObject::kThrow));
+    Node* const result = CallStub(CodeFactory::ResumeGenerator(isolate()),
+                                  context, argument, handler);
+    GotoIfException(result, &if_reject, &var_handler_result);
+    Goto(&if_internal);
+  }
 
   BIND(&if_handler_callable);
   {
@@ -1745,6 +1768,10 @@ TF_BUILTIN(RejectPromise, PromiseBuiltinsAssembler) {
   // here, but we let the C++ code take care of this completely.
   GotoIfNot(PromiseHasHandler(promise), &if_runtime);
 
+  // Everything below stays in the builtin, so fire the resolve hook here.
+  RunContextPromiseHook(Context::PROMISE_HOOK_RESOLVE_FUNCTION_INDEX, context,
+                        promise, UndefinedConstant());
+
   // 2. Let reactions be promise.[[PromiseRejectReactions]].
   Node* reactions =
       LoadObjectField(promise, JSPromise::kReactionsOrResultOffset);
@@ -1792,6 +1819,12 @@ TF_BUILTIN(ResolvePromise, PromiseBuiltinsAssembler) {
   // to be a JSPromise inside this function and thus is reference comparable.
   GotoIf(WordEqual(promise, resolution), &if_runtime);
 
+  // Everything below stays in the builtin (the "then" lookup, the thenable
+  // job and FulfillPromise don't call back into the runtime), so fire the
+  // resolve hook here.
+  RunContextPromiseHook(Context::PROMISE_HOOK_RESOLVE_FUNCTION_INDEX, context,
+                        promise, UndefinedConstant());
+
   // 7. If Type(resolution) is not Object, then
   GotoIf(TaggedIsSmi(resolution), &if_fulfill);
   Node* const resolution_map = LoadMap(resolution);
@@ -1968,7 +2001,7 @@ Node* PromiseBuiltinsAssembler::PerformPromiseAll(
     Label if_fast(this), if_slow(this);
     GotoIfNotPromiseResolveLookupChainIntact(native_context, constructor,
                                              &if_slow);
-    GotoIf(IsPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(),
+    GotoIf(IsAnyPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(),
            &if_slow);
     GotoIf(TaggedIsSmi(next_value), &if_slow);
     Node* const next_value_map = LoadMap(next_value);
@@ -34,6 +34,11 @@ class PromiseBuiltinsAssembler : public CodeStubAssembler {
   Node* AllocateAndSetJSPromise(Node* context, v8::Promise::PromiseState status,
                                 Node* result);
 
+  // Fires the init hook for the freshly allocated {promise}. This goes to the
+  // runtime only if an isolate PromiseHook or the async event delegate is
+  // installed, context promise hooks are called directly.
+  void RunPromiseHookInit(Node* context, Node* promise, Node* parent);
+
   Node* AllocatePromiseReaction(Node* next, Node* promise_or_capability,
                                 Node* fulfill_handler, Node* reject_handler);
 
@@ -52,6 +57,10 @@ class PromiseBuiltinsAssembler : public CodeStubAssembler {
 
   Node* PromiseHasHandler(Node* promise);
 
+  // Reaction handlers are either undefined, callables or (for await in
+  // async functions) the JSAsyncFunctionObject to resume.
+  Node* IsPromiseReactionHandler(Node* handler);
+
   // Creates the context used by all Promise.all resolve element closures,
   // together with the values array. Since all closures for a single Promise.all
   // call use the same context, we need to store the indices for the individual
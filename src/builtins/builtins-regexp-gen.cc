@@ -409,6 +409,23 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
 
   to_direct.TryToDirect(&runtime);
 
+  // No match can start before the first occurrence of the regexp's literal
+  // prefix, if it has one, so matching starts there.
+  TVARIABLE(IntPtrT, var_start_index, int_last_index);
+  {
+    Label next(this);
+    TNode<Object> prefix =
+        LoadFixedArrayElement(data, JSRegExp::kIrregexpLiteralPrefixIndex);
+    GotoIf(TaggedIsSmi(prefix), &next);
+    TNode<Smi> prefix_index =
+        CAST(CallBuiltin(Builtins::kStringIndexOf, context, string, prefix,
+                         SmiTag(int_last_index)));
+    GotoIf(SmiEqual(prefix_index, SmiConstant(-1)), &if_failure);
+    var_start_index = SmiUntag(prefix_index);
+    Goto(&next);
+    BIND(&next);
+  }
+
   // Load the irregexp code object and offsets into the subject string. Both
   // depend on whether the string is one- or two-byte.
 
@@ -425,9 +442,10 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
 
     BIND(&if_isonebyte);
     {
-      GetStringPointers(direct_string_data, to_direct.offset(), int_last_index,
-                        int_string_length, String::ONE_BYTE_ENCODING,
-                        &var_string_start, &var_string_end);
+      GetStringPointers(direct_string_data, to_direct.offset(),
+                        var_start_index.value(), int_string_length,
+                        String::ONE_BYTE_ENCODING, &var_string_start,
+                        &var_string_end);
       var_code =
           LoadFixedArrayElement(data, JSRegExp::kIrregexpLatin1CodeIndex);
       Goto(&next);
@@ -435,9 +453,10 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
 
     BIND(&if_istwobyte);
     {
-      GetStringPointers(direct_string_data, to_direct.offset(), int_last_index,
-                        int_string_length, String::TWO_BYTE_ENCODING,
-                        &var_string_start, &var_string_end);
+      GetStringPointers(direct_string_data, to_direct.offset(),
+                        var_start_index.value(), int_string_length,
+                        String::TWO_BYTE_ENCODING, &var_string_start,
+                        &var_string_end);
       var_code = LoadFixedArrayElement(data, JSRegExp::kIrregexpUC16CodeIndex);
       Goto(&next);
     }
@@ -447,7 +466,9 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
 
   // Check that the irregexp code has been generated for the actual string
   // encoding. If it has, the field contains a code object; and otherwise it
-  // contains the uninitialized sentinel as a smi.
+  // contains the uninitialized sentinel as a smi, or bytecode if the regexp
+  // has not been tiered up to native code yet. Bytecode is interpreted in
+  // the runtime.
 #ifdef DEBUG
   {
     Label next(this);
@@ -460,6 +481,7 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
 #endif
 
   GotoIf(TaggedIsSmi(var_code.value()), &runtime);
+  GotoIfNot(IsCode(CAST(var_code.value())), &runtime);
   TNode<Code> code = CAST(var_code.value());
 
   Label if_success(this), if_exception(this, Label::kDeferred);
@@ -481,7 +503,7 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
 
     // Argument 1: Previous index.
     MachineType arg1_type = type_int32;
-    TNode<Int32T> arg1 = TruncateIntPtrToInt32(int_last_index);
+    TNode<Int32T> arg1 = TruncateIntPtrToInt32(var_start_index.value());
 
     // Argument 2: Start of string data.
     MachineType arg2_type = type_ptr;
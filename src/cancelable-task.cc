@@ -20,36 +20,36 @@ Cancelable::~Cancelable() {
   }
 }
 
-CancelableTaskManager::CancelableTaskManager()
-    : task_id_counter_(0), canceled_(false) {}
-
 CancelableTaskManager::Id CancelableTaskManager::Register(Cancelable* task) {
-  base::MutexGuard guard(&mutex_);
   CancelableTaskManager::Id id = ++task_id_counter_;
   // Id overflows are not supported.
   CHECK_NE(0, id);
+  Shard& shard = ShardFor(id);
+  base::MutexGuard guard(&shard.mutex);
   CHECK(!canceled_);
-  cancelable_tasks_[id] = task;
+  shard.cancelable_tasks[id] = task;
   return id;
 }
 
 void CancelableTaskManager::RemoveFinishedTask(CancelableTaskManager::Id id) {
-  base::MutexGuard guard(&mutex_);
-  size_t removed = cancelable_tasks_.erase(id);
+  Shard& shard = ShardFor(id);
+  base::MutexGuard guard(&shard.mutex);
+  size_t removed = shard.cancelable_tasks.erase(id);
   USE(removed);
   DCHECK_NE(0u, removed);
-  cancelable_tasks_barrier_.NotifyOne();
+  shard.cancelable_tasks_barrier.NotifyOne();
 }
 
 TryAbortResult CancelableTaskManager::TryAbort(CancelableTaskManager::Id id) {
-  base::MutexGuard guard(&mutex_);
-  auto entry = cancelable_tasks_.find(id);
-  if (entry != cancelable_tasks_.end()) {
+  Shard& shard = ShardFor(id);
+  base::MutexGuard guard(&shard.mutex);
+  auto entry = shard.cancelable_tasks.find(id);
+  if (entry != shard.cancelable_tasks.end()) {
     Cancelable* value = entry->second;
     if (value->Cancel()) {
       // Cannot call RemoveFinishedTask here because of recursive locking.
-      cancelable_tasks_.erase(entry);
-      cancelable_tasks_barrier_.NotifyOne();
+      shard.cancelable_tasks.erase(entry);
+      shard.cancelable_tasks_barrier.NotifyOne();
       return TryAbortResult::kTaskAborted;
     } else {
       return TryAbortResult::kTaskRunning;
@@ -63,23 +63,25 @@ void CancelableTaskManager::CancelAndWait() {
   // the way if possible, i.e., if they have not started yet.  After each round
   // of canceling we wait for the background tasks that have already been
   // started.
-  base::MutexGuard guard(&mutex_);
   canceled_ = true;
 
-  // Cancelable tasks could be running or could potentially register new
-  // tasks, requiring a loop here.
-  while (!cancelable_tasks_.empty()) {
-    for (auto it = cancelable_tasks_.begin(); it != cancelable_tasks_.end();) {
-      auto current = it;
-      // We need to get to the next element before erasing the current.
-      ++it;
-      if (current->second->Cancel()) {
-        cancelable_tasks_.erase(current);
+  // No new tasks can be registered from here on, so each shard only needs to
+  // be drained once.
+  for (Shard& shard : shards_) {
+    base::MutexGuard guard(&shard.mutex);
+    while (!shard.cancelable_tasks.empty()) {
+      for (auto it = shard.cancelable_tasks.begin();
+           it != shard.cancelable_tasks.end();) {
+        if (it->second->Cancel()) {
+          it = shard.cancelable_tasks.erase(it);
+        } else {
+          ++it;
+        }
+      }
+      // Wait for already running background tasks.
+      if (!shard.cancelable_tasks.empty()) {
+        shard.cancelable_tasks_barrier.Wait(&shard.mutex);
       }
-    }
-    // Wait for already running background tasks.
-    if (!cancelable_tasks_.empty()) {
-      cancelable_tasks_barrier_.Wait(&mutex_);
     }
   }
 }
@@ -87,20 +89,28 @@ void CancelableTaskManager::CancelAndWait() {
 TryAbortResult CancelableTaskManager::TryAbortAll() {
   // Clean up all cancelable fore- and background tasks. Tasks are canceled on
   // the way if possible, i.e., if they have not started yet.
-  base::MutexGuard guard(&mutex_);
-
-  if (cancelable_tasks_.empty()) return TryAbortResult::kTaskRemoved;
-
-  for (auto it = cancelable_tasks_.begin(); it != cancelable_tasks_.end();) {
-    if (it->second->Cancel()) {
-      it = cancelable_tasks_.erase(it);
-    } else {
-      ++it;
+  bool any_registered = false;
+  bool any_running = false;
+
+  for (Shard& shard : shards_) {
+    base::MutexGuard guard(&shard.mutex);
+    if (shard.cancelable_tasks.empty()) continue;
+    any_registered = true;
+
+    for (auto it = shard.cancelable_tasks.begin();
+         it != shard.cancelable_tasks.end();) {
+      if (it->second->Cancel()) {
+        it = shard.cancelable_tasks.erase(it);
+      } else {
+        ++it;
+      }
     }
+    if (!shard.cancelable_tasks.empty()) any_running = true;
   }
 
-  return cancelable_tasks_.empty() ? TryAbortResult::kTaskAborted
-                                   : TryAbortResult::kTaskRunning;
+  if (!any_registered) return TryAbortResult::kTaskRemoved;
+  return any_running ? TryAbortResult::kTaskRunning
+                     : TryAbortResult::kTaskAborted;
 }
 
 CancelableTask::CancelableTask(Isolate* isolate)
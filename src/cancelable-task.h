@@ -33,7 +33,7 @@ class V8_EXPORT_PRIVATE CancelableTaskManager {
  public:
   using Id = uint64_t;
 
-  CancelableTaskManager();
+  CancelableTaskManager() = default;
 
   // Registers a new cancelable {task}. Returns the unique {id} of the task that
   // can be used to try to abort a task by calling {Abort}.
@@ -59,25 +59,39 @@ class V8_EXPORT_PRIVATE CancelableTaskManager {
   void CancelAndWait();
 
   // Returns true of the task manager has been cancelled.
-  bool canceled() const { return canceled_; }
+  bool canceled() const { return canceled_.load(); }
 
  private:
+  // Tasks are spread over a fixed number of shards by id, each with its own
+  // lock, so that registering and finishing tasks on different threads rarely
+  // contends. Only {CancelAndWait} and {TryAbortAll} visit every shard.
+  static constexpr int kNumShards = 16;
+
+  struct Shard {
+    // A set of cancelable tasks that are currently registered.
+    std::unordered_map<Id, Cancelable*> cancelable_tasks;
+
+    // Mutex and condition variable enabling concurrent register and removing,
+    // as well as waiting for background tasks on {CancelAndWait}.
+    base::ConditionVariable cancelable_tasks_barrier;
+    base::Mutex mutex;
+  };
+
+  Shard& ShardFor(Id id) { return shards_[id % kNumShards]; }
+
   // Only called by {Cancelable} destructor. The task is done with executing,
   // but needs to be removed.
   void RemoveFinishedTask(Id id);
 
   // To mitigate the ABA problem, the api refers to tasks through an id.
-  Id task_id_counter_;
-
-  // A set of cancelable tasks that are currently registered.
-  std::unordered_map<Id, Cancelable*> cancelable_tasks_;
+  std::atomic<Id> task_id_counter_{0};
 
-  // Mutex and condition variable enabling concurrent register and removing, as
-  // well as waiting for background tasks on {CancelAndWait}.
-  base::ConditionVariable cancelable_tasks_barrier_;
-  base::Mutex mutex_;
+  Shard shards_[kNumShards];
 
-  bool canceled_;
+  // Set before any shard is visited by {CancelAndWait}, and checked by
+  // {Register} under the shard lock, so a task either gets canceled or is
+  // never registered.
+  std::atomic<bool> canceled_{false};
 
   friend class Cancelable;
 
@@ -3409,6 +3409,8 @@ TNode<NameDictionary> CodeStubAssembler::AllocateNameDictionaryWithCapacity(
   StoreFixedArrayElement(result, NameDictionary::kObjectHashIndex,
                          SmiConstant(PropertyArray::kNoHashSentinel),
                          SKIP_WRITE_BARRIER);
+  StoreFixedArrayElement(result, NameDictionary::kEnumKeysCacheIndex, filler,
+                         SKIP_WRITE_BARRIER);
 
   // Initialize NameDictionary elements.
   TNode<WordT> result_word = BitcastTaggedToWord(result);
@@ -3588,6 +3590,8 @@ void CodeStubAssembler::FindOrderedHashTableEntry(
       CAST(table), bucket,
       CollectionType::HashTableStartIndex() * kPointerSize)));
 
+  Node* const tagged_hash = SmiTag(hash);
+
   // Walk the bucket chain.
   Node* entry_start;
   Label if_key_found(this);
@@ -3621,6 +3625,13 @@ void CodeStubAssembler::FindOrderedHashTableEntry(
                             IntPtrConstant(CollectionType::kEntrySize)),
                   number_of_buckets);
 
+    // Skip entries with a different hash without looking at their keys.
+    Node* const candidate_hash = LoadFixedArrayElement(
+        CAST(table), entry_start,
+        (CollectionType::HashTableStartIndex() + CollectionType::kHashOffset) *
+            kPointerSize);
+    GotoIf(WordNotEqual(candidate_hash, tagged_hash), &continue_next_entry);
+
     // Load the key from the entry.
     Node* const candidate_key = LoadFixedArrayElement(
         CAST(table), entry_start,
@@ -7155,9 +7166,94 @@ TNode<String> CodeStubAssembler::StringAdd(Node* context, TNode<String> left,
     GotoIf(Uint32LessThan(new_length, Uint32Constant(ConsString::kMinLength)),
            &non_cons);
 
-    result =
-        NewConsString(new_length, var_left.value(), var_right.value(), flags);
-    Goto(&done_native);
+    // Unwrap thin strings and flattened cons strings first. Otherwise code
+    // that keeps appending to a string which got flattened in between (i.e.
+    // `s += part` in a loop) builds up a chain of flattened cons strings that
+    // stay alive and have to be walked by every later flattening.
+    Label deref_right(this, 2, input_vars), new_cons(this, 2, input_vars);
+    MaybeDerefIndirectString(&var_left, LoadInstanceType(var_left.value()),
+                             &deref_right, &deref_right);
+    BIND(&deref_right);
+    MaybeDerefIndirectString(&var_right, LoadInstanceType(var_right.value()),
+                             &new_cons, &new_cons);
+
+    BIND(&new_cons);
+    {
+      // Appending short parts to a string, i.e. `s += part` in a loop, builds
+      // up a list of cons strings that is as deep as the number of appends.
+      // If the left string is a cons string that ends in a short sequential
+      // string, copy that and the new part into one leaf instead, so the list
+      // only grows by one level every ConsString::kMaxCoalescedLength
+      // characters.
+      Label coalesce(this), no_coalesce(this);
+      TNode<String> left_value = var_left.value();
+      TNode<String> right_value = var_right.value();
+      GotoIf(Uint32GreaterThan(right_length,
+                               Uint32Constant(ConsString::kMaxCoalescedLength)),
+             &no_coalesce);
+      GotoIfNot(IsConsStringInstanceType(LoadInstanceType(left_value)),
+                &no_coalesce);
+      TNode<String> tail =
+          CAST(LoadObjectField(left_value, ConsString::kSecondOffset));
+      TNode<Uint32T> tail_length = LoadStringLengthAsWord32(tail);
+      TNode<Uint32T> leaf_length = Uint32Add(tail_length, right_length);
+      GotoIf(Uint32GreaterThan(leaf_length,
+                               Uint32Constant(ConsString::kMaxCoalescedLength)),
+             &no_coalesce);
+      // Both parts have to be sequential strings with the same encoding.
+      Node* tail_instance_type = LoadInstanceType(tail);
+      Node* right_instance_type = LoadInstanceType(right_value);
+      GotoIf(IsSetWord32(Word32Or(tail_instance_type, right_instance_type),
+                         kStringRepresentationMask),
+             &no_coalesce);
+      Branch(IsSetWord32(Word32Xor(tail_instance_type, right_instance_type),
+                         kStringEncodingMask),
+             &no_coalesce, &coalesce);
+
+      BIND(&coalesce);
+      {
+        TNode<IntPtrT> word_tail_length =
+            Signed(ChangeUint32ToWord(tail_length));
+        TNode<IntPtrT> word_right_length =
+            Signed(ChangeUint32ToWord(right_length));
+        TVARIABLE(String, var_leaf);
+        Label one_byte_leaf(this), leaf_done(this, &var_leaf);
+        GotoIf(IsSetWord32(tail_instance_type, kStringEncodingMask),
+               &one_byte_leaf);
+        var_leaf = AllocateSeqTwoByteString(context, leaf_length);
+        CopyStringCharacters(tail, var_leaf.value(), IntPtrConstant(0),
+                             IntPtrConstant(0), word_tail_length,
+                             String::TWO_BYTE_ENCODING,
+                             String::TWO_BYTE_ENCODING);
+        CopyStringCharacters(right_value, var_leaf.value(), IntPtrConstant(0),
+                             word_tail_length, word_right_length,
+                             String::TWO_BYTE_ENCODING,
+                             String::TWO_BYTE_ENCODING);
+        Goto(&leaf_done);
+
+        BIND(&one_byte_leaf);
+        var_leaf = AllocateSeqOneByteString(context, leaf_length);
+        CopyStringCharacters(tail, var_leaf.value(), IntPtrConstant(0),
+                             IntPtrConstant(0), word_tail_length,
+                             String::ONE_BYTE_ENCODING,
+                             String::ONE_BYTE_ENCODING);
+        CopyStringCharacters(right_value, var_leaf.value(), IntPtrConstant(0),
+                             word_tail_length, word_right_length,
+                             String::ONE_BYTE_ENCODING,
+                             String::ONE_BYTE_ENCODING);
+        Goto(&leaf_done);
+
+        BIND(&leaf_done);
+        TNode<String> head =
+            CAST(LoadObjectField(left_value, ConsString::kFirstOffset));
+        result = NewConsString(new_length, head, var_leaf.value(), flags);
+        Goto(&done_native);
+      }
+
+      BIND(&no_coalesce);
+      result = NewConsString(new_length, left_value, right_value, flags);
+      Goto(&done_native);
+    }
 
     BIND(&non_cons);
 
@@ -7313,7 +7409,8 @@ TNode<String> CodeStubAssembler::NumberToString(TNode<Number> input) {
   TVARIABLE(String, result);
   TVARIABLE(Smi, smi_input);
   Label runtime(this, Label::kDeferred), if_smi(this), if_heap_number(this),
-      done(this, &result);
+      done(this, &result), hit(this, &result);
+  Counters* counters = isolate()->counters();
 
   // Load the number string cache.
   Node* number_string_cache = LoadRoot(RootIndex::kNumberStringCache);
@@ -7362,7 +7459,7 @@ TNode<String> CodeStubAssembler::NumberToString(TNode<Number> input) {
     // Heap number match, return value from cache entry.
     result = CAST(
         LoadFixedArrayElement(CAST(number_string_cache), index, kPointerSize));
-    Goto(&done);
+    Goto(&hit);
   }
 
   BIND(&if_smi);
@@ -7377,6 +7474,12 @@ TNode<String> CodeStubAssembler::NumberToString(TNode<Number> input) {
     // Smi match, return value from cache entry.
     result = CAST(LoadFixedArrayElement(CAST(number_string_cache), smi_index,
                                         kPointerSize, SMI_PARAMETERS));
+    Goto(&hit);
+  }
+
+  BIND(&hit);
+  {
+    IncrementCounter(counters->number_string_cache_hits(), 1);
     Goto(&done);
   }
 
@@ -8575,9 +8678,12 @@ void CodeStubAssembler::InsertEntry<NameDictionary>(
   Goto(&not_private);
   BIND(&not_private);
 
-  // Finally, store the details.
+  // Finally, store the details and drop the cached enumerable keys (see
+  // NameDictionaryShape::DetailsAtPut).
   StoreDetailsByKeyIndex<NameDictionary>(dictionary, index,
                                          var_details.value());
+  StoreFixedArrayElement(dictionary, NameDictionary::kEnumKeysCacheIndex,
+                         UndefinedConstant(), SKIP_WRITE_BARRIER);
 }
 
 template <>
@@ -13270,6 +13376,49 @@ Node* CodeStubAssembler::
                         Int32Constant(0));
 }
 
+Node* CodeStubAssembler::HasContextPromiseHooks() {
+  Node* const has_context_promise_hooks = Load(
+      MachineType::Uint8(),
+      ExternalConstant(
+          ExternalReference::has_context_promise_hooks_address(isolate())));
+  return Word32NotEqual(has_context_promise_hooks, Int32Constant(0));
+}
+
+Node* CodeStubAssembler::
+    IsAnyPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate() {
+  return Word32Or(IsPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(),
+                  HasContextPromiseHooks());
+}
+
+void CodeStubAssembler::RunContextPromiseHook(int context_index,
+                                              SloppyTNode<Context> context,
+                                              SloppyTNode<HeapObject> promise,
+                                              SloppyTNode<Object> parent) {
+  Label if_hooks(this, Label::kDeferred), if_hook(this, Label::kDeferred),
+      if_exception(this, Label::kDeferred), done(this);
+  Branch(HasContextPromiseHooks(), &if_hooks, &done);
+
+  BIND(&if_hooks);
+  TNode<Context> const native_context = LoadNativeContext(context);
+  TNode<Object> const hook = LoadContextElement(native_context, context_index);
+  Branch(IsUndefined(hook), &done, &if_hook);
+
+  BIND(&if_hook);
+  {
+    VARIABLE(var_exception, MachineRepresentation::kTagged, TheHoleConstant());
+    Node* const result = CallJS(CodeFactory::Call(isolate()), context, hook,
+                                UndefinedConstant(), promise, parent);
+    GotoIfException(result, &if_exception, &var_exception);
+    Goto(&done);
+
+    BIND(&if_exception);
+    CallRuntime(Runtime::kReportMessage, context, var_exception.value());
+    Goto(&done);
+  }
+
+  BIND(&done);
+}
+
 TNode<Code> CodeStubAssembler::LoadBuiltin(TNode<Smi> builtin_id) {
   CSA_ASSERT(this, SmiGreaterThanOrEqual(builtin_id, SmiConstant(0)));
   CSA_ASSERT(this,
@@ -3011,6 +3011,18 @@ class V8_EXPORT_PRIVATE CodeStubAssembler
   Node* HasAsyncEventDelegate();
   Node* IsPromiseHookEnabledOrHasAsyncEventDelegate();
   Node* IsPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate();
+  // Context promise hooks (see v8::Context::SetPromiseHooks) are called from
+  // the builtins directly, so they only need to be considered where a fast
+  // path would skip a promise or a resolve step that the hooks observe.
+  Node* HasContextPromiseHooks();
+  Node* IsAnyPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate();
+
+  // Calls the JavaScript promise hook at |context_index| in the native
+  // context of |context| with |promise| and |parent|, if there is one.
+  // Exceptions thrown by the hook are reported and otherwise ignored.
+  void RunContextPromiseHook(int context_index, SloppyTNode<Context> context,
+                             SloppyTNode<HeapObject> promise,
+                             SloppyTNode<Object> parent);
 
   // Helpers for StackFrame markers.
   Node* MarkerIsFrameType(Node* marker_or_function,
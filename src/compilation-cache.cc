@@ -162,9 +162,11 @@ MaybeHandle<SharedFunctionInfo> CompilationCacheScript::Lookup(
                      resource_options));
 #endif
     isolate()->counters()->compilation_cache_hits()->Increment();
+    isolate()->counters()->compilation_cache_script_hits()->Increment();
     LOG(isolate(), CompilationCacheEvent("hit", "script", *function_info));
   } else {
     isolate()->counters()->compilation_cache_misses()->Increment();
+    isolate()->counters()->compilation_cache_script_misses()->Increment();
   }
   return result;
 }
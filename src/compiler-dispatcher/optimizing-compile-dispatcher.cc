@@ -4,11 +4,14 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <algorithm>
+
 #include "src/base/atomicops.h"
 #include "src/base/template-utils.h"
 #include "src/cancelable-task.h"
 #include "src/compiler.h"
 #include "src/counters.h"
+#include "src/interpreter/bytecode-array-accessor.h"
 #include "src/isolate.h"
 #include "src/objects-inl.h"
 #include "src/optimized-compilation-info.h"
@@ -18,26 +21,6 @@
 namespace v8 {
 namespace internal {
 
-namespace {
-
-void DisposeCompilationJob(OptimizedCompilationJob* job,
-                           bool restore_function_code) {
-  if (restore_function_code) {
-    Handle<JSFunction> function = job->compilation_info()->closure();
-    function->set_code(function->shared()->GetCode());
-    if (function->IsInOptimizationQueue()) {
-      function->ClearOptimizationMarker();
-    }
-    // TODO(mvstanton): We can't call EnsureFeedbackVector here due to
-    // allocation, but we probably shouldn't call set_code either, as this
-    // sometimes runs on the worker thread!
-    // JSFunction::EnsureFeedbackVector(function);
-  }
-  delete job;
-}
-
-}  // namespace
-
 class OptimizingCompileDispatcher::CompileTask : public CancelableTask {
  public:
   explicit CompileTask(Isolate* isolate,
@@ -71,12 +54,15 @@ class OptimizingCompileDispatcher::CompileTask : public CancelableTask {
       TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                    "V8.RecompileConcurrent");
 
-      if (dispatcher_->recompilation_delay_ != 0) {
-        base::OS::Sleep(base::TimeDelta::FromMilliseconds(
-            dispatcher_->recompilation_delay_));
+      // Keep compiling until the queue is drained, so that the number of
+      // tasks stays within the limit.
+      while (OptimizedCompilationJob* job = dispatcher_->NextInput(true)) {
+        if (dispatcher_->recompilation_delay_ != 0) {
+          base::OS::Sleep(base::TimeDelta::FromMilliseconds(
+              dispatcher_->recompilation_delay_));
+        }
+        dispatcher_->CompileNext(job);
       }
-
-      dispatcher_->CompileNext(dispatcher_->NextInput(true));
     }
     {
       base::MutexGuard lock_guard(&dispatcher_->ref_count_mutex_);
@@ -93,6 +79,22 @@ class OptimizingCompileDispatcher::CompileTask : public CancelableTask {
   DISALLOW_COPY_AND_ASSIGN(CompileTask);
 };
 
+OptimizingCompileDispatcher::OptimizingCompileDispatcher(Isolate* isolate)
+    : isolate_(isolate),
+      input_queue_capacity_(FLAG_concurrent_recompilation_queue_length),
+      running_tasks_(0),
+      max_running_tasks_(FLAG_concurrent_recompilation_max_tasks),
+      mode_(COMPILE),
+      blocked_jobs_(0),
+      ref_count_(0),
+      recompilation_delay_(FLAG_concurrent_recompilation_delay) {
+  if (max_running_tasks_ <= 0) {
+    max_running_tasks_ =
+        Max(1, V8::GetCurrentPlatform()->NumberOfWorkerThreads());
+  }
+  input_queue_.reserve(input_queue_capacity_);
+}
+
 OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
 #ifdef DEBUG
   {
@@ -100,28 +102,94 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
     DCHECK_EQ(0, ref_count_);
   }
 #endif
-  DCHECK_EQ(0, input_queue_length_);
-  DeleteArray(input_queue_);
+  DCHECK(input_queue_.empty());
+  DCHECK_EQ(0, running_tasks_);
+  DCHECK(osr_pending_.empty());
+  DCHECK(osr_ready_.empty());
+}
+
+void OptimizingCompileDispatcher::DisposeCompilationJob(
+    OptimizedCompilationJob* job, bool restore_function_code) {
+  if (job->compilation_info()->is_osr()) {
+    // OSR code is never installed on the closure, so there is nothing to
+    // restore.
+    restore_function_code = false;
+    base::MutexGuard access_osr_pending(&osr_pending_mutex_);
+    auto it = std::find(osr_pending_.begin(), osr_pending_.end(), job);
+    if (it != osr_pending_.end()) osr_pending_.erase(it);
+  }
+  if (restore_function_code) {
+    Handle<JSFunction> function = job->compilation_info()->closure();
+    function->set_code(function->shared()->GetCode());
+    if (function->IsInOptimizationQueue()) {
+      function->ClearOptimizationMarker();
+    }
+    // TODO(mvstanton): We can't call EnsureFeedbackVector here due to
+    // allocation, but we probably shouldn't call set_code either, as this
+    // sometimes runs on the worker thread!
+    // JSFunction::EnsureFeedbackVector(function);
+  }
+  delete job;
 }
 
 OptimizedCompilationJob* OptimizingCompileDispatcher::NextInput(
-    bool check_if_flushing) {
+    bool for_task) {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
-  if (input_queue_length_ == 0) return nullptr;
-  OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
-  DCHECK_NOT_NULL(job);
-  input_queue_shift_ = InputQueueIndex(1);
-  input_queue_length_--;
-  if (check_if_flushing) {
-    if (mode_ == FLUSH) {
-      AllowHandleDereference allow_handle_dereference;
-      DisposeCompilationJob(job, true);
-      return nullptr;
+  if (for_task && mode_ == FLUSH) {
+    AllowHandleDereference allow_handle_dereference;
+    for (const InputQueueEntry& entry : input_queue_) {
+      DisposeCompilationJob(entry.job, true);
     }
+    input_queue_.clear();
+  }
+  if (input_queue_.empty()) {
+    if (for_task) running_tasks_--;
+    return nullptr;
   }
+  // Ties go to the job that was queued first.
+  auto hottest = std::max_element(
+      input_queue_.begin(), input_queue_.end(),
+      [](const InputQueueEntry& a, const InputQueueEntry& b) {
+        return a.hotness < b.hotness;
+      });
+  OptimizedCompilationJob* job = hottest->job;
+  DCHECK_NOT_NULL(job);
+  input_queue_.erase(hottest);
   return job;
 }
 
+void OptimizingCompileDispatcher::DropStaleJobs() {
+  for (auto it = input_queue_.begin(); it != input_queue_.end();) {
+    OptimizedCompilationInfo* info = it->job->compilation_info();
+    JSFunction function = *info->closure();
+    bool stale =
+        function->shared()->optimization_disabled() ||
+        (!info->is_osr() && function->HasOptimizedCode()) ||
+        (function->has_feedback_vector() &&
+         function->feedback_vector()->deopt_count() != it->deopt_count);
+    if (!stale) {
+      ++it;
+      continue;
+    }
+    if (FLAG_trace_concurrent_recompilation) {
+      PrintF("  ** Dropping stale job for ");
+      function->ShortPrint();
+      PrintF(".\n");
+    }
+    DisposeCompilationJob(it->job, true);
+    it = input_queue_.erase(it);
+  }
+}
+
+bool OptimizingCompileDispatcher::IsQueueAvailable() {
+  base::MutexGuard access_input_queue(&input_queue_mutex_);
+  if (static_cast<int>(input_queue_.size()) < input_queue_capacity_) {
+    return true;
+  }
+  DropStaleJobs();
+  return static_cast<int>(input_queue_.size()) < input_queue_capacity_;
+}
+
 void OptimizingCompileDispatcher::CompileNext(OptimizedCompilationJob* job) {
   if (!job) return;
 
@@ -151,18 +219,23 @@ void OptimizingCompileDispatcher::FlushOutputQueue(bool restore_function_code) {
   }
 }
 
+void OptimizingCompileDispatcher::FlushOSRBuffer() {
+  for (OptimizedCompilationJob* job : osr_ready_) {
+    DisposeCompilationJob(job, false);
+  }
+  osr_ready_.clear();
+}
+
 void OptimizingCompileDispatcher::Flush(BlockingBehavior blocking_behavior) {
   if (blocking_behavior == BlockingBehavior::kDontBlock) {
     if (FLAG_block_concurrent_recompilation) Unblock();
     base::MutexGuard access_input_queue_(&input_queue_mutex_);
-    while (input_queue_length_ > 0) {
-      OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
-      DCHECK_NOT_NULL(job);
-      input_queue_shift_ = InputQueueIndex(1);
-      input_queue_length_--;
-      DisposeCompilationJob(job, true);
+    for (const InputQueueEntry& entry : input_queue_) {
+      DisposeCompilationJob(entry.job, true);
     }
+    input_queue_.clear();
     FlushOutputQueue(true);
+    FlushOSRBuffer();
     if (FLAG_trace_concurrent_recompilation) {
       PrintF("  ** Flushed concurrent recompilation queues (not blocking).\n");
     }
@@ -176,6 +249,7 @@ void OptimizingCompileDispatcher::Flush(BlockingBehavior blocking_behavior) {
     mode_ = COMPILE;
   }
   FlushOutputQueue(true);
+  FlushOSRBuffer();
   if (FLAG_trace_concurrent_recompilation) {
     PrintF("  ** Flushed concurrent recompilation queues.\n");
   }
@@ -192,12 +266,13 @@ void OptimizingCompileDispatcher::Stop() {
 
   if (recompilation_delay_ != 0) {
     // At this point the optimizing compiler thread's event loop has stopped.
-    // There is no need for a mutex when reading input_queue_length_.
-    while (input_queue_length_ > 0) CompileNext(NextInput());
+    // There is no need for a mutex when reading input_queue_.
+    while (!input_queue_.empty()) CompileNext(NextInput());
     InstallOptimizedFunctions();
   } else {
     FlushOutputQueue(false);
   }
+  FlushOSRBuffer();
 }
 
 void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
@@ -212,6 +287,10 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
       output_queue_.pop();
     }
     OptimizedCompilationInfo* info = job->compilation_info();
+    if (info->is_osr()) {
+      InstallOSRJob(job);
+      continue;
+    }
     Handle<JSFunction> function(*info->closure(), isolate_);
     if (function->HasOptimizedCode()) {
       if (FLAG_trace_concurrent_recompilation) {
@@ -226,29 +305,117 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
   }
 }
 
+void OptimizingCompileDispatcher::InstallOSRJob(OptimizedCompilationJob* job) {
+  {
+    base::MutexGuard access_osr_pending(&osr_pending_mutex_);
+    auto it = std::find(osr_pending_.begin(), osr_pending_.end(), job);
+    DCHECK(it != osr_pending_.end());
+    osr_pending_.erase(it);
+  }
+  if (job->state() != CompilationJob::State::kReadyToFinalize) {
+    DisposeCompilationJob(job, false);
+    return;
+  }
+
+  // Keep the buffer bounded, the oldest job is the least likely to still be
+  // entered.
+  if (static_cast<int>(osr_ready_.size()) >= input_queue_capacity_) {
+    DisposeCompilationJob(osr_ready_.front(), false);
+    osr_ready_.erase(osr_ready_.begin());
+  }
+  osr_ready_.push_back(job);
+
+  // Re-arm the back edge the job was requested for (and the ones of its
+  // enclosing loops), so that the next iteration enters the new code.
+  OptimizedCompilationInfo* info = job->compilation_info();
+  Handle<BytecodeArray> bytecode(
+      info->closure()->shared()->GetBytecodeArray(), isolate_);
+  interpreter::BytecodeArrayAccessor accessor(bytecode,
+                                              info->osr_offset().ToInt());
+  DCHECK_EQ(interpreter::Bytecode::kJumpLoop, accessor.current_bytecode());
+  int level = Min(accessor.GetImmediateOperand(1) + 1,
+                  AbstractCode::kMaxLoopNestingMarker);
+  if (bytecode->osr_loop_nesting_level() < level) {
+    bytecode->set_osr_loop_nesting_level(level);
+  }
+  if (FLAG_trace_osr) {
+    PrintF("[OSR - Compilation of ");
+    info->closure()->PrintName();
+    PrintF(" at AST id %d ready, arming back edges]\n",
+           info->osr_offset().ToInt());
+  }
+}
+
+bool OptimizingCompileDispatcher::IsQueuedForOSR(Handle<JSFunction> function) {
+  base::MutexGuard access_osr_pending(&osr_pending_mutex_);
+  for (OptimizedCompilationJob* job : osr_pending_) {
+    if (*job->compilation_info()->closure() == *function) return true;
+  }
+  return false;
+}
+
+OptimizedCompilationJob* OptimizingCompileDispatcher::FindReadyOSRCandidate(
+    Handle<JSFunction> function, BailoutId osr_offset) {
+  OptimizedCompilationJob* result = nullptr;
+  for (auto it = osr_ready_.begin(); it != osr_ready_.end();) {
+    OptimizedCompilationJob* job = *it;
+    OptimizedCompilationInfo* info = job->compilation_info();
+    if (*info->closure() != *function) {
+      ++it;
+      continue;
+    }
+    it = osr_ready_.erase(it);
+    if (result == nullptr && info->osr_offset() == osr_offset) {
+      result = job;
+    } else {
+      DisposeCompilationJob(job, false);
+    }
+  }
+  return result;
+}
+
 void OptimizingCompileDispatcher::QueueForOptimization(
-    OptimizedCompilationJob* job) {
+    OptimizedCompilationJob* job, int hotness) {
   DCHECK(IsQueueAvailable());
+  if (job->compilation_info()->is_osr()) {
+    base::MutexGuard access_osr_pending(&osr_pending_mutex_);
+    osr_pending_.push_back(job);
+  }
+  Handle<JSFunction> function = job->compilation_info()->closure();
+  int deopt_count = function->has_feedback_vector()
+                        ? function->feedback_vector()->deopt_count()
+                        : 0;
+  bool post_task = false;
   {
-    // Add job to the back of the input queue.
+    // Add job to the input queue.
     base::MutexGuard access_input_queue(&input_queue_mutex_);
-    DCHECK_LT(input_queue_length_, input_queue_capacity_);
-    input_queue_[InputQueueIndex(input_queue_length_)] = job;
-    input_queue_length_++;
+    DCHECK_LT(static_cast<int>(input_queue_.size()), input_queue_capacity_);
+    input_queue_.push_back({job, hotness, deopt_count});
+    if (!FLAG_block_concurrent_recompilation &&
+        running_tasks_ < max_running_tasks_) {
+      running_tasks_++;
+      post_task = true;
+    }
   }
   if (FLAG_block_concurrent_recompilation) {
     blocked_jobs_++;
-  } else {
+  } else if (post_task) {
     V8::GetCurrentPlatform()->CallOnWorkerThread(
         base::make_unique<CompileTask>(isolate_, this));
   }
 }
 
 void OptimizingCompileDispatcher::Unblock() {
-  while (blocked_jobs_ > 0) {
+  int tasks;
+  {
+    base::MutexGuard access_input_queue(&input_queue_mutex_);
+    tasks = Min(blocked_jobs_, max_running_tasks_ - running_tasks_);
+    running_tasks_ += tasks;
+  }
+  blocked_jobs_ = 0;
+  for (int i = 0; i < tasks; i++) {
     V8::GetCurrentPlatform()->CallOnWorkerThread(
         base::make_unique<CompileTask>(isolate_, this));
-    blocked_jobs_--;
   }
 }
 
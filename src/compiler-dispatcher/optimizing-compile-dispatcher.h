@@ -7,6 +7,7 @@
 
 #include <atomic>
 #include <queue>
+#include <vector>
 
 #include "src/allocation.h"
 #include "src/base/platform/condition-variable.h"
@@ -14,40 +15,42 @@
 #include "src/base/platform/platform.h"
 #include "src/flags.h"
 #include "src/globals.h"
+#include "src/handles.h"
+#include "src/utils.h"
 
 namespace v8 {
 namespace internal {
 
+class JSFunction;
 class OptimizedCompilationJob;
 class SharedFunctionInfo;
 
 class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
  public:
-  explicit OptimizingCompileDispatcher(Isolate* isolate)
-      : isolate_(isolate),
-        input_queue_capacity_(FLAG_concurrent_recompilation_queue_length),
-        input_queue_length_(0),
-        input_queue_shift_(0),
-        mode_(COMPILE),
-        blocked_jobs_(0),
-        ref_count_(0),
-        recompilation_delay_(FLAG_concurrent_recompilation_delay) {
-    input_queue_ = NewArray<OptimizedCompilationJob*>(input_queue_capacity_);
-  }
+  explicit OptimizingCompileDispatcher(Isolate* isolate);
 
   ~OptimizingCompileDispatcher();
 
   void Stop();
   void Flush(BlockingBehavior blocking_behavior);
-  // Takes ownership of |job|.
-  void QueueForOptimization(OptimizedCompilationJob* job);
+  // Takes ownership of |job|. Queued jobs with a higher |hotness| (e.g. the
+  // profiler ticks of the function) are compiled first.
+  void QueueForOptimization(OptimizedCompilationJob* job, int hotness = 0);
   void Unblock();
   void InstallOptimizedFunctions();
 
-  inline bool IsQueueAvailable() {
-    base::MutexGuard access_input_queue(&input_queue_mutex_);
-    return input_queue_length_ < input_queue_capacity_;
-  }
+  // OSR jobs are queued like any other job, but their code is not installed
+  // on the closure. Once compiled, they wait here until the interpreter hits
+  // an armed back edge of the function again.
+  bool IsQueuedForOSR(Handle<JSFunction> function);
+  // Returns the compiled OSR job for |function| at |osr_offset|, or nullptr.
+  // The caller takes ownership of the job. Compiled OSR jobs of |function| at
+  // other offsets are discarded.
+  OptimizedCompilationJob* FindReadyOSRCandidate(Handle<JSFunction> function,
+                                                 BailoutId osr_offset);
+
+  // Drops stale jobs if the queue is full.
+  bool IsQueueAvailable();
 
   static bool Enabled() { return FLAG_concurrent_recompilation; }
 
@@ -56,32 +59,54 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   enum ModeFlag { COMPILE, FLUSH };
 
+  struct InputQueueEntry {
+    OptimizedCompilationJob* job;
+    int hotness;
+    // Deoptimization count of the function when the job was queued.
+    int deopt_count;
+  };
+
   void FlushOutputQueue(bool restore_function_code);
+  void FlushOSRBuffer();
+  void InstallOSRJob(OptimizedCompilationJob* job);
+  void DisposeCompilationJob(OptimizedCompilationJob* job,
+                             bool restore_function_code);
   void CompileNext(OptimizedCompilationJob* job);
-  OptimizedCompilationJob* NextInput(bool check_if_flushing = false);
-
-  inline int InputQueueIndex(int i) {
-    int result = (i + input_queue_shift_) % input_queue_capacity_;
-    DCHECK_LE(0, result);
-    DCHECK_LT(result, input_queue_capacity_);
-    return result;
-  }
+  // Called by compile tasks with |for_task| set. A task exits once this
+  // returns nullptr, which also disposes all jobs when flushing.
+  OptimizedCompilationJob* NextInput(bool for_task = false);
+  // Disposes queued jobs whose function has been deoptimized, optimized or
+  // had optimization disabled since it was queued. Must be called on the main
+  // thread with |input_queue_mutex_| held.
+  void DropStaleJobs();
 
   Isolate* isolate_;
 
-  // Circular queue of incoming recompilation tasks (including OSR).
-  OptimizedCompilationJob** input_queue_;
+  // Incoming recompilation tasks (including OSR), compiled hottest first.
+  std::vector<InputQueueEntry> input_queue_;
   int input_queue_capacity_;
-  int input_queue_length_;
-  int input_queue_shift_;
   base::Mutex input_queue_mutex_;
 
-  // Queue of recompilation tasks ready to be installed (excluding OSR).
+  // Number of compile tasks that have been posted and not exited yet, and the
+  // limit for it. Guarded by |input_queue_mutex_|.
+  int running_tasks_;
+  int max_running_tasks_;
+
+  // Queue of recompilation tasks ready to be installed (including OSR).
   std::queue<OptimizedCompilationJob*> output_queue_;
   // Used for job based recompilation which has multiple producers on
   // different threads.
   base::Mutex output_queue_mutex_;
 
+  // OSR jobs that are queued or being compiled. A job is removed before it is
+  // disposed, so the main thread may look at the jobs in here.
+  std::vector<OptimizedCompilationJob*> osr_pending_;
+  base::Mutex osr_pending_mutex_;
+
+  // Compiled OSR jobs waiting to be entered, oldest first. Only accessed on
+  // the main thread.
+  std::vector<OptimizedCompilationJob*> osr_ready_;
+
   std::atomic<ModeFlag> mode_;
 
   int blocked_jobs_;
@@ -634,11 +634,35 @@ void ClearOptimizedCodeCache(OptimizedCompilationInfo* compilation_info) {
   }
 }
 
+// Break points may have been set on the function or on any of the functions
+// inlined into it while a concurrent job was running. The debugger does not
+// abort concurrent jobs for that, so such code must not be installed.
+bool IsFunctionBeingDebugged(OptimizedCompilationInfo* compilation_info) {
+  if (compilation_info->shared_info()->HasBreakInfo()) return true;
+  for (const auto& inlined : compilation_info->inlined_functions()) {
+    if (inlined.shared_info->HasBreakInfo()) return true;
+  }
+  return false;
+}
+
 void InsertCodeIntoOptimizedCodeCache(
     OptimizedCompilationInfo* compilation_info) {
   Handle<Code> code = compilation_info->code();
   if (code->kind() != Code::OPTIMIZED_FUNCTION) return;  // Nothing to do.
 
+  // Remember that this function was hot enough to optimize, so that code
+  // caches produced from this isolate can tier it up eagerly.
+  Handle<SharedFunctionInfo> optimized_shared = compilation_info->shared_info();
+  if (FLAG_code_cache_optimization_hints &&
+      optimized_shared->HasBytecodeArray()) {
+    optimized_shared->GetBytecodeArray()->set_has_optimization_hint(true);
+    // Also remember the inlining decisions, so that the first optimization
+    // after deserialization inlines the same functions.
+    for (const auto& inlined : compilation_info->inlined_functions()) {
+      inlined.bytecode_array->set_has_inlining_hint(true);
+    }
+  }
+
   // Function context specialization folds-in the function context,
   // so no sharing can occur.
   if (compilation_info->is_function_context_specializing()) {
@@ -688,7 +712,8 @@ bool GetOptimizedCodeNow(OptimizedCompilationJob* job, Isolate* isolate) {
   return true;
 }
 
-bool GetOptimizedCodeLater(OptimizedCompilationJob* job, Isolate* isolate) {
+bool GetOptimizedCodeLater(OptimizedCompilationJob* job, Isolate* isolate,
+                           int hotness) {
   OptimizedCompilationInfo* compilation_info = job->compilation_info();
   if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailable()) {
     if (FLAG_trace_concurrent_recompilation) {
@@ -715,7 +740,7 @@ bool GetOptimizedCodeLater(OptimizedCompilationJob* job, Isolate* isolate) {
                "V8.RecompileSynchronous");
 
   if (job->PrepareJob(isolate) != CompilationJob::SUCCEEDED) return false;
-  isolate->optimizing_compile_dispatcher()->QueueForOptimization(job);
+  isolate->optimizing_compile_dispatcher()->QueueForOptimization(job, hotness);
 
   if (FLAG_trace_concurrent_recompilation) {
     PrintF("  ** Queued ");
@@ -757,8 +782,10 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
     return cached_code;
   }
 
-  // Reset profiler ticks, function is no longer considered hot.
+  // Reset profiler ticks, function is no longer considered hot. The ticks
+  // decide the order in which concurrent jobs are compiled.
   DCHECK(shared->is_compiled());
+  int hotness = function->feedback_vector()->profiler_ticks();
   function->feedback_vector()->set_profiler_ticks(0);
 
   VMState<COMPILER> state(isolate);
@@ -816,9 +843,13 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
   compilation_info->ReopenHandlesInNewHandleScope(isolate);
 
   if (mode == ConcurrencyMode::kConcurrent) {
-    if (GetOptimizedCodeLater(job.get(), isolate)) {
+    if (GetOptimizedCodeLater(job.get(), isolate, hotness)) {
       job.release();  // The background recompile job owns this now.
 
+      // OSR code is picked up from the dispatcher at the next back edge, the
+      // closure keeps running in the interpreter in the meantime.
+      if (!osr_offset.IsNone()) return MaybeHandle<Code>();
+
       // Set the optimization marker and return a code object which checks it.
       function->SetOptimizationMarker(OptimizationMarker::kInOptimizationQueue);
       DCHECK(function->IsInterpreted() ||
@@ -835,6 +866,45 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
   return MaybeHandle<Code>();
 }
 
+MaybeHandle<Code> FinalizeOptimizedCompilationJobForOSR(
+    OptimizedCompilationJob* job, Isolate* isolate) {
+  VMState<COMPILER> state(isolate);
+  OptimizedCompilationInfo* compilation_info = job->compilation_info();
+  DCHECK(compilation_info->is_osr());
+  DCHECK_EQ(job->state(), CompilationJob::State::kReadyToFinalize);
+
+  TimerEventScope<TimerEventRecompileSynchronous> timer(isolate);
+  RuntimeCallTimerScope runtimeTimer(
+      isolate, RuntimeCallCounterId::kRecompileSynchronous);
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.RecompileSynchronous");
+
+  // Optimization may have been disabled, or break points set, while the job
+  // was waiting to be entered.
+  Handle<SharedFunctionInfo> shared = compilation_info->shared_info();
+  if (shared->optimization_disabled()) {
+    job->RetryOptimization(BailoutReason::kOptimizationDisabled);
+  } else if (IsFunctionBeingDebugged(compilation_info)) {
+    job->RetryOptimization(BailoutReason::kFunctionBeingDebugged);
+  } else if (job->FinalizeJob(isolate) == CompilationJob::SUCCEEDED) {
+    job->RecordCompilationStats();
+    DCHECK(!isolate->has_pending_exception());
+    InsertCodeIntoOptimizedCodeCache(compilation_info);
+    job->RecordFunctionCompilation(CodeEventListener::LAZY_COMPILE_TAG,
+                                   isolate);
+    return compilation_info->code();
+  }
+
+  if (FLAG_trace_opt) {
+    PrintF("[aborted optimizing ");
+    compilation_info->closure()->ShortPrint();
+    PrintF(" because: %s]\n",
+           GetBailoutReason(compilation_info->bailout_reason()));
+  }
+  if (isolate->has_pending_exception()) isolate->clear_pending_exception();
+  return MaybeHandle<Code>();
+}
+
 bool FailWithPendingException(Isolate* isolate, ParseInfo* parse_info,
                               Compiler::ClearExceptionFlag flag) {
   if (flag == Compiler::CLEAR_EXCEPTION) {
@@ -965,7 +1035,7 @@ std::unique_ptr<UnoptimizedCompilationJob> CompileOnBackgroundThread(
 }  // namespace
 
 BackgroundCompileTask::BackgroundCompileTask(ScriptStreamingData* streamed_data,
-                                             Isolate* isolate)
+                                             Isolate* isolate, ScriptType type)
     : info_(new ParseInfo(isolate)),
       stack_size_(i::FLAG_stack_size),
       worker_thread_runtime_call_stats_(
@@ -980,6 +1050,7 @@ BackgroundCompileTask::BackgroundCompileTask(ScriptStreamingData* streamed_data,
                            info_->script_id()));
   info_->set_toplevel();
   info_->set_allow_lazy_parsing();
+  if (type == ScriptType::kModule) info_->set_module();
   if (V8_UNLIKELY(info_->block_coverage_enabled())) {
     info_->AllocateSourceRangeMap();
   }
@@ -1197,11 +1268,17 @@ bool Compiler::Compile(Handle<JSFunction> function, ClearExceptionFlag flag,
   DCHECK(!function->HasOptimizationMarker());
   DCHECK(!function->HasOptimizedCode());
 
+  Isolate* isolate = function->GetIsolate();
+
   // Reset the JSFunction if we are recompiling due to the bytecode having been
-  // flushed.
+  // flushed. Functions that still hold on to their feedback vector have run
+  // before, so count them as recompilations of flushed bytecode.
+  if (!function->shared()->is_compiled() &&
+      function->raw_feedback_cell()->value()->IsFeedbackVector()) {
+    isolate->counters()->bytecode_flushed_recompiled()->Increment();
+  }
   function->ResetIfBytecodeFlushed();
 
-  Isolate* isolate = function->GetIsolate();
   Handle<SharedFunctionInfo> shared_info = handle(function->shared(), isolate);
 
   // Ensure shared function info is compiled.
@@ -1214,7 +1291,7 @@ bool Compiler::Compile(Handle<JSFunction> function, ClearExceptionFlag flag,
   Handle<Code> code = handle(shared_info->GetCode(), isolate);
 
   // Allocate FeedbackVector for the JSFunction.
-  JSFunction::EnsureFeedbackVector(function);
+  JSFunction::InitializeFeedbackVector(function);
 
   // Optimize now if --always-opt is enabled.
   if (FLAG_always_opt && !function->shared()->HasAsmWasmData()) {
@@ -1901,6 +1978,7 @@ Compiler::GetSharedFunctionInfoForStreamedScript(
   BackgroundCompileTask* task = streaming_data->task.get();
   ParseInfo* parse_info = task->info();
   DCHECK(parse_info->is_toplevel());
+  DCHECK_EQ(parse_info->is_module(), origin_options.IsModule());
   // Check if compile cache already holds the SFI, if so no need to finalize
   // the code compiled on the background thread.
   CompilationCache* compilation_cache = isolate->compilation_cache();
@@ -1974,8 +2052,26 @@ MaybeHandle<Code> Compiler::GetOptimizedCodeForOSR(Handle<JSFunction> function,
                                                    JavaScriptFrame* osr_frame) {
   DCHECK(!osr_offset.IsNone());
   DCHECK_NOT_NULL(osr_frame);
-  return GetOptimizedCode(function, ConcurrencyMode::kNotConcurrent, osr_offset,
-                          osr_frame);
+  Isolate* isolate = function->GetIsolate();
+
+  // Compile on the main thread if the function was explicitly marked for
+  // non-concurrent optimization, e.g. by %OptimizeOsr.
+  if (!FLAG_concurrent_osr || !isolate->concurrent_recompilation_enabled() ||
+      function->IsMarkedForOptimization()) {
+    return GetOptimizedCode(function, ConcurrencyMode::kNotConcurrent,
+                            osr_offset, osr_frame);
+  }
+
+  OptimizingCompileDispatcher* dispatcher =
+      isolate->optimizing_compile_dispatcher();
+  std::unique_ptr<OptimizedCompilationJob> job(
+      dispatcher->FindReadyOSRCandidate(function, osr_offset));
+  if (job) return FinalizeOptimizedCompilationJobForOSR(job.get(), isolate);
+  if (dispatcher->IsQueuedForOSR(function)) return MaybeHandle<Code>();
+
+  // The background thread must not look at the stack, so the frame is not
+  // passed along.
+  return GetOptimizedCode(function, ConcurrencyMode::kConcurrent, osr_offset);
 }
 
 bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
@@ -1996,16 +2092,17 @@ bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
   // Reset profiler ticks, function is no longer considered hot.
   compilation_info->closure()->feedback_vector()->set_profiler_ticks(0);
 
-  DCHECK(!shared->HasBreakInfo());
-
   // 1) Optimization on the concurrent thread may have failed.
   // 2) The function may have already been optimized by OSR.  Simply continue.
   //    Except when OSR already disabled optimization for some reason.
   // 3) The code may have already been invalidated due to dependency change.
   // 4) Code generation may have failed.
+  // 5) Break points may have been set while the job was running.
   if (job->state() == CompilationJob::State::kReadyToFinalize) {
     if (shared->optimization_disabled()) {
       job->RetryOptimization(BailoutReason::kOptimizationDisabled);
+    } else if (IsFunctionBeingDebugged(compilation_info)) {
+      job->RetryOptimization(BailoutReason::kFunctionBeingDebugged);
     } else if (job->FinalizeJob(isolate) == CompilationJob::SUCCEEDED) {
       job->RecordCompilationStats();
       job->RecordFunctionCompilation(CodeEventListener::LAZY_COMPILE_TAG,
@@ -2045,7 +2142,7 @@ void Compiler::PostInstantiation(Handle<JSFunction> function,
   // If code is compiled to bytecode (i.e., isn't asm.js), then allocate a
   // feedback and check for optimized code.
   if (is_compiled_scope.is_compiled() && shared->HasBytecodeArray()) {
-    JSFunction::EnsureFeedbackVector(function);
+    JSFunction::InitializeFeedbackVector(function);
 
     Code code = function->has_feedback_vector()
                     ? function->feedback_vector()->optimized_code()
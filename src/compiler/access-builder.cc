@@ -115,6 +115,15 @@ FieldAccess AccessBuilder::ForJSCollectionTable() {
   return access;
 }
 
+// static
+FieldAccess AccessBuilder::ForJSWeakCollectionTable() {
+  FieldAccess access = {kTaggedBase,           JSWeakCollection::kTableOffset,
+                        MaybeHandle<Name>(),   MaybeHandle<Map>(),
+                        Type::OtherInternal(), MachineType::TaggedPointer(),
+                        kPointerWriteBarrier};
+  return access;
+}
+
 // static
 FieldAccess AccessBuilder::ForJSCollectionIteratorTable() {
   FieldAccess access = {
@@ -853,6 +862,18 @@ FieldAccess AccessBuilder::ForCellValue() {
   return access;
 }
 
+// static
+FieldAccess AccessBuilder::ForFeedbackVectorInvocationCount() {
+  FieldAccess access = {kTaggedBase,
+                        FeedbackVector::kInvocationCountOffset,
+                        Handle<Name>(),
+                        MaybeHandle<Map>(),
+                        TypeCache::Get().kInt32,
+                        MachineType::Int32(),
+                        kNoWriteBarrier};
+  return access;
+}
+
 // static
 FieldAccess AccessBuilder::ForContextSlot(size_t index) {
   int offset = Context::OffsetOfElementAt(static_cast<int>(index));
@@ -56,6 +56,9 @@ class V8_EXPORT_PRIVATE AccessBuilder final
   // Provides access to JSCollecton::table() field.
   static FieldAccess ForJSCollectionTable();
 
+  // Provides access to JSWeakCollection::table() field.
+  static FieldAccess ForJSWeakCollectionTable();
+
   // Provides access to JSCollectionIterator::table() field.
   static FieldAccess ForJSCollectionIteratorTable();
 
@@ -266,6 +269,9 @@ class V8_EXPORT_PRIVATE AccessBuilder final
   // Provides access to Cell::value() field.
   static FieldAccess ForCellValue();
 
+  // Provides access to FeedbackVector::invocation_count() field.
+  static FieldAccess ForFeedbackVectorInvocationCount();
+
   // Provides access to arguments object fields.
   static FieldAccess ForArgumentsLength();
   static FieldAccess ForArgumentsCallee();
@@ -360,7 +360,72 @@ int InstructionScheduler::GetTargetInstructionFlags(
   UNREACHABLE();
 }
 
-int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+namespace {
+
+// Latencies for the Cortex-A72 through Cortex-A76, taken from the vendor's
+// software optimization guides. Returns 0 for instructions not covered here.
+int GetCortexA7xInstructionLatency(const Instruction* instr) {
+  switch (instr->arch_opcode()) {
+    case kArm64Ldr:
+    case kArm64LdrD:
+    case kArm64LdrS:
+    case kArm64LdrW:
+    case kArm64Ldrb:
+    case kArm64Ldrh:
+    case kArm64Ldrsb:
+    case kArm64Ldrsh:
+    case kArm64Ldrsw:
+      return 4;
+
+    case kArm64Madd32:
+    case kArm64Mneg32:
+    case kArm64Msub32:
+    case kArm64Mul32:
+      return 3;
+
+    case kArm64Madd:
+    case kArm64Mneg:
+    case kArm64Msub:
+    case kArm64Mul:
+      return 4;
+
+    case kArm64Float32Add:
+    case kArm64Float32Sub:
+    case kArm64Float64Add:
+    case kArm64Float64Sub:
+    case kArm64Float32Mul:
+    case kArm64Float64Mul:
+      return 3;
+
+    case kArm64Float32Abs:
+    case kArm64Float32Neg:
+    case kArm64Float64Abs:
+    case kArm64Float64Neg:
+      return 2;
+
+    case kArm64Float32Div:
+      return 7;
+    case kArm64Float64Div:
+      return 12;
+    case kArm64Float32Sqrt:
+      return 9;
+    case kArm64Float64Sqrt:
+      return 17;
+
+    default:
+      return 0;
+  }
+}
+
+}  // namespace
+
+int InstructionScheduler::GetInstructionLatency(
+    const Instruction* instr) const {
+  if (cpu_model() == CpuModel::kCortexA7x) {
+    int latency = GetCortexA7xInstructionLatency(instr);
+    if (latency != 0) return latency;
+  }
+
   // Basic latency modeling for arm64 instructions. They have been determined
   // in an empirical way.
   switch (instr->arch_opcode()) {
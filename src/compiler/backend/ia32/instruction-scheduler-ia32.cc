@@ -391,7 +391,8 @@ int InstructionScheduler::GetTargetInstructionFlags(
   UNREACHABLE();
 }
 
-int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+int InstructionScheduler::GetInstructionLatency(
+    const Instruction* instr) const {
   // Basic latency modeling for ia32 instructions. They have been determined
   // in an empirical way.
   switch (instr->arch_opcode()) {
@@ -5,6 +5,8 @@
 #include "src/compiler/backend/instruction-scheduler.h"
 
 #include "src/base/adapters.h"
+#include "src/base/cpu.h"
+#include "src/base/once.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/isolate.h"
 
@@ -12,6 +14,53 @@ namespace v8 {
 namespace internal {
 namespace compiler {
 
+namespace {
+
+base::OnceType target_cpu_model_once = V8_ONCE_INIT;
+InstructionScheduler::CpuModel target_cpu_model =
+    InstructionScheduler::CpuModel::kGeneric;
+
+void DetectTargetCpuModel() {
+  base::CPU cpu;
+  USE(cpu);
+#if V8_TARGET_ARCH_X64 && V8_HOST_ARCH_X64
+  if (strcmp(cpu.vendor(), "GenuineIntel") == 0 && cpu.family() == 0x6) {
+    switch (cpu.model()) {
+      case 0x4E:  // Skylake client (mobile).
+      case 0x5E:  // Skylake client (desktop).
+      case 0x55:  // Skylake server, Cascade Lake.
+      case 0x8E:  // Kaby Lake, Coffee Lake, Whiskey Lake (mobile).
+      case 0x9E:  // Kaby Lake, Coffee Lake (desktop).
+        target_cpu_model = InstructionScheduler::CpuModel::kSkylake;
+        break;
+    }
+  } else if (strcmp(cpu.vendor(), "AuthenticAMD") == 0 &&
+             cpu.family() == 0xF && cpu.ext_family() == 0x8) {
+    // Family 17h.
+    target_cpu_model = InstructionScheduler::CpuModel::kZen;
+  }
+#elif V8_TARGET_ARCH_ARM64 && V8_HOST_ARCH_ARM64
+  if (cpu.implementer() == base::CPU::ARM) {
+    switch (cpu.part()) {
+      case base::CPU::ARM_CORTEX_A72:
+      case base::CPU::ARM_CORTEX_A73:
+      case base::CPU::ARM_CORTEX_A75:
+      case base::CPU::ARM_CORTEX_A76:
+        target_cpu_model = InstructionScheduler::CpuModel::kCortexA7x;
+        break;
+    }
+  }
+#endif
+}
+
+}  // namespace
+
+// static
+InstructionScheduler::CpuModel InstructionScheduler::TargetCpuModel() {
+  base::CallOnce(&target_cpu_model_once, &DetectTargetCpuModel);
+  return target_cpu_model;
+}
+
 void InstructionScheduler::SchedulingQueueBase::AddNode(
     ScheduleGraphNode* node) {
   // We keep the ready list sorted by total latency so that we can quickly find
@@ -58,11 +107,12 @@ InstructionScheduler::StressSchedulerQueue::PopBestCandidate(int cycle) {
 }
 
 InstructionScheduler::ScheduleGraphNode::ScheduleGraphNode(Zone* zone,
-                                                           Instruction* instr)
+                                                           Instruction* instr,
+                                                           int latency)
     : instr_(instr),
       successors_(zone),
       unscheduled_predecessors_count_(0),
-      latency_(GetInstructionLatency(instr)),
+      latency_(latency),
       total_latency_(-1),
       start_cycle_(-1) {}
 
@@ -76,6 +126,7 @@ InstructionScheduler::InstructionScheduler(Zone* zone,
                                            InstructionSequence* sequence)
     : zone_(zone),
       sequence_(sequence),
+      cpu_model_(TargetCpuModel()),
       graph_(zone),
       last_side_effect_instr_(nullptr),
       pending_loads_(zone),
@@ -109,7 +160,8 @@ void InstructionScheduler::EndBlock(RpoNumber rpo) {
 }
 
 void InstructionScheduler::AddTerminator(Instruction* instr) {
-  ScheduleGraphNode* new_node = new (zone()) ScheduleGraphNode(zone(), instr);
+  ScheduleGraphNode* new_node = new (zone())
+      ScheduleGraphNode(zone(), instr, GetInstructionLatency(instr));
   // Make sure that basic block terminators are not moved by adding them
   // as successor of every instruction.
   for (ScheduleGraphNode* node : graph_) {
@@ -119,7 +171,8 @@ void InstructionScheduler::AddTerminator(Instruction* instr) {
 }
 
 void InstructionScheduler::AddInstruction(Instruction* instr) {
-  ScheduleGraphNode* new_node = new (zone()) ScheduleGraphNode(zone(), instr);
+  ScheduleGraphNode* new_node = new (zone())
+      ScheduleGraphNode(zone(), instr, GetInstructionLatency(instr));
 
   // We should not have branches in the middle of a block.
   DCHECK_NE(instr->flags_mode(), kFlags_branch);
@@ -28,6 +28,10 @@ enum ArchOpcodeFlags {
 
 class InstructionScheduler final : public ZoneObject {
  public:
+  // The microarchitectures for which the backends provide specific
+  // instruction latencies; everything else uses the generic latencies.
+  enum class CpuModel { kGeneric, kSkylake, kZen, kCortexA7x };
+
   InstructionScheduler(Zone* zone, InstructionSequence* sequence);
 
   void StartBlock(RpoNumber rpo);
@@ -38,12 +42,16 @@ class InstructionScheduler final : public ZoneObject {
 
   static bool SchedulerSupported();
 
+  // Returns the microarchitecture of the CPU we generate code for, as
+  // detected once via base::CPU. Always kGeneric when running on a simulator.
+  static CpuModel TargetCpuModel();
+
  private:
   // A scheduling graph node.
   // Represent an instruction and their dependencies.
   class ScheduleGraphNode : public ZoneObject {
    public:
-    ScheduleGraphNode(Zone* zone, Instruction* instr);
+    ScheduleGraphNode(Zone* zone, Instruction* instr, int latency);
 
     // Mark the instruction represented by 'node' as a dependecy of this one.
     // The current instruction will be registered as an unscheduled predecessor
@@ -188,14 +196,17 @@ class InstructionScheduler final : public ZoneObject {
 
   void ComputeTotalLatencies();
 
-  static int GetInstructionLatency(const Instruction* instr);
+  // Estimate the latency of the given instruction on {cpu_model_}.
+  int GetInstructionLatency(const Instruction* instr) const;
 
+  CpuModel cpu_model() const { return cpu_model_; }
   Zone* zone() { return zone_; }
   InstructionSequence* sequence() { return sequence_; }
   Isolate* isolate() { return sequence()->isolate(); }
 
   Zone* zone_;
   InstructionSequence* sequence_;
+  CpuModel const cpu_model_;
   ZoneVector<ScheduleGraphNode*> graph_;
 
   friend class InstructionSchedulerTester;
@@ -1302,7 +1302,8 @@ int CheckPageFlagLatency() {
   return 2 * AndLatency(false) + 1 + Latency::BRANCH;
 }
 
-int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+int InstructionScheduler::GetInstructionLatency(
+    const Instruction* instr) const {
   // Basic latency modeling for MIPS32 instructions. They have been determined
   // in an empirical way.
   switch (instr->arch_opcode()) {
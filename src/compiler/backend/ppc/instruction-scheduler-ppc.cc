@@ -204,7 +204,8 @@ int InstructionScheduler::GetTargetInstructionFlags(
   UNREACHABLE();
 }
 
-int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+int InstructionScheduler::GetInstructionLatency(
+    const Instruction* instr) const {
   // TODO(all): Add instruction cost modeling.
   return 1;
 }
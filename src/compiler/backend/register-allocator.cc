@@ -1367,10 +1367,11 @@ void RegisterAllocationData::PhiMapValue::CommitAssignment(
 
 RegisterAllocationData::RegisterAllocationData(
     const RegisterConfiguration* config, Zone* zone, Frame* frame,
-    InstructionSequence* code, const char* debug_name)
+    InstructionSequence* code, bool is_fast_mode, const char* debug_name)
     : allocation_zone_(zone),
       frame_(frame),
       code_(code),
+      is_fast_mode_(is_fast_mode),
       debug_name_(debug_name),
       config_(config),
       phi_map_(allocation_zone()),
@@ -2782,8 +2783,10 @@ void LinearScanAllocator::AllocateRegisters() {
     TRACE("Processing interval %d:%d start=%d\n", current->TopLevel()->vreg(),
           current->relative_id(), position.value());
 
-    if (current->IsTopLevel() && TryReuseSpillForPhi(current->TopLevel()))
+    if (!data()->is_fast_mode() && current->IsTopLevel() &&
+        TryReuseSpillForPhi(current->TopLevel())) {
       continue;
+    }
 
     ForwardStateTo(position);
 
@@ -2890,6 +2893,20 @@ ZoneVector<LiveRange*>::iterator LinearScanAllocator::InactiveToActive(
   return inactive_live_ranges().erase(it);
 }
 
+LifetimePosition LinearScanAllocator::NextIntersection(
+    LiveRange* inactive, LiveRange* current) const {
+  if (!data()->is_fast_mode()) return inactive->FirstIntersection(current);
+  // The inactive range does not cover the start of {current}, so the first
+  // intersection can't be before the inactive range is live again. Stopping
+  // there avoids walking the intervals of {current}, at the price of
+  // sometimes splitting {current} where no actual conflict exists.
+  DCHECK(!inactive->Covers(current->Start()));
+  DCHECK(inactive->End() > current->Start());
+  LifetimePosition next_start = inactive->NextStartAfter(current->Start());
+  if (next_start >= current->End()) return LifetimePosition::Invalid();
+  return next_start;
+}
+
 void LinearScanAllocator::ForwardStateTo(LifetimePosition position) {
   if (position >= next_active_ranges_change_) {
     next_active_ranges_change_ = LifetimePosition::MaxPosition();
@@ -2988,7 +3005,7 @@ void LinearScanAllocator::FindFreeRegistersForRange(
       continue;
     }
 
-    LifetimePosition next_intersection = cur_inactive->FirstIntersection(range);
+    LifetimePosition next_intersection = NextIntersection(cur_inactive, range);
     if (!next_intersection.IsValid()) continue;
     if (kSimpleFPAliasing || !check_fp_aliasing()) {
       positions[cur_reg] = Min(positions[cur_reg], next_intersection);
@@ -3218,7 +3235,7 @@ void LinearScanAllocator::AllocateBlockedReg(LiveRange* current) {
       }
     }
 
-    LifetimePosition next_intersection = range->FirstIntersection(current);
+    LifetimePosition next_intersection = NextIntersection(range, current);
     if (!next_intersection.IsValid()) continue;
 
     if (kSimpleFPAliasing || !check_fp_aliasing()) {
@@ -746,7 +746,7 @@ class RegisterAllocationData final : public ZoneObject {
 
   RegisterAllocationData(const RegisterConfiguration* config,
                          Zone* allocation_zone, Frame* frame,
-                         InstructionSequence* code,
+                         InstructionSequence* code, bool is_fast_mode = false,
                          const char* debug_name = nullptr);
 
   const ZoneVector<TopLevelLiveRange*>& live_ranges() const {
@@ -791,6 +791,10 @@ class RegisterAllocationData final : public ZoneObject {
   Frame* frame() const { return frame_; }
   const char* debug_name() const { return debug_name_; }
   const RegisterConfiguration* config() const { return config_; }
+  // In fast mode, the linear scan allocator approximates interference with
+  // inactive ranges and doesn't try to share spill slots of phis, trading
+  // some code quality for allocation time on very large code.
+  bool is_fast_mode() const { return is_fast_mode_; }
 
   MachineRepresentation RepresentationFor(int virtual_register);
 
@@ -831,6 +835,7 @@ class RegisterAllocationData final : public ZoneObject {
   Zone* const allocation_zone_;
   Frame* const frame_;
   InstructionSequence* const code_;
+  const bool is_fast_mode_;
   const char* const debug_name_;
   const RegisterConfiguration* const config_;
   PhiMap phi_map_;
@@ -1057,6 +1062,11 @@ class LinearScanAllocator final : public RegisterAllocator {
 
   void ForwardStateTo(LifetimePosition position);
 
+  // Returns the first position at which the {inactive} range interferes with
+  // {current}, or an earlier conservative estimate in fast mode.
+  LifetimePosition NextIntersection(LiveRange* inactive,
+                                    LiveRange* current) const;
+
   // Helper methods for allocating registers.
   bool TryReuseSpillForPhi(TopLevelLiveRange* range);
   bool TryAllocateFreeReg(LiveRange* range,
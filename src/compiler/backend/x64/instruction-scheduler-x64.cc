@@ -347,7 +347,104 @@ int InstructionScheduler::GetTargetInstructionFlags(
   UNREACHABLE();
 }
 
-int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+namespace {
+
+// Latencies for Intel Skylake and its derivatives, taken from the vendor's
+// optimization manual. Returns 0 for instructions not covered here.
+int GetSkylakeInstructionLatency(const Instruction* instr) {
+  switch (instr->arch_opcode()) {
+    case kSSEFloat32Add:
+    case kSSEFloat32Sub:
+    case kSSEFloat32Mul:
+    case kSSEFloat64Add:
+    case kSSEFloat64Sub:
+    case kSSEFloat64Mul:
+    case kSSEFloat64Max:
+    case kSSEFloat64Min:
+      return 4;
+    case kSSEFloat32Div:
+      return 11;
+    case kSSEFloat64Div:
+      return 14;
+    case kSSEFloat32Sqrt:
+      return 12;
+    case kSSEFloat64Sqrt:
+      return 18;
+    case kSSEFloat32Round:
+    case kSSEFloat64Round:
+      return 8;
+    case kSSEFloat32ToFloat64:
+    case kSSEFloat64ToFloat32:
+      return 5;
+    case kSSEFloat32ToInt32:
+    case kSSEFloat32ToUint32:
+    case kSSEFloat64ToInt32:
+    case kSSEFloat64ToUint32:
+    case kSSEFloat32ToInt64:
+    case kSSEFloat64ToInt64:
+      return 6;
+    case kX64Idiv:
+      return 42;
+    case kX64Idiv32:
+    case kX64Udiv32:
+      return 26;
+    case kX64Udiv:
+      return 35;
+    default:
+      return 0;
+  }
+}
+
+// Latencies for AMD family 17h (Zen), taken from the vendor's optimization
+// manual. Returns 0 for instructions not covered here.
+int GetZenInstructionLatency(const Instruction* instr) {
+  switch (instr->arch_opcode()) {
+    case kSSEFloat32Add:
+    case kSSEFloat32Sub:
+    case kSSEFloat32Mul:
+    case kSSEFloat64Add:
+    case kSSEFloat64Sub:
+    case kSSEFloat64Mul:
+      return 3;
+    case kSSEFloat64Max:
+    case kSSEFloat64Min:
+      return 1;
+    case kSSEFloat32Div:
+      return 10;
+    case kSSEFloat64Div:
+      return 13;
+    case kSSEFloat32Sqrt:
+      return 14;
+    case kSSEFloat64Sqrt:
+      return 20;
+    case kSSEFloat32Round:
+    case kSSEFloat64Round:
+      return 4;
+    case kX64Idiv:
+    case kX64Udiv:
+      return 45;
+    case kX64Idiv32:
+    case kX64Udiv32:
+      return 29;
+    default:
+      return 0;
+  }
+}
+
+}  // namespace
+
+int InstructionScheduler::GetInstructionLatency(
+    const Instruction* instr) const {
+  if (cpu_model() != CpuModel::kGeneric) {
+    // Loads hitting the L1 cache, which dominate the critical path of
+    // most blocks.
+    if (IsLoadOperation(instr)) return cpu_model() == CpuModel::kZen ? 4 : 5;
+    int latency = cpu_model() == CpuModel::kZen
+                      ? GetZenInstructionLatency(instr)
+                      : GetSkylakeInstructionLatency(instr);
+    if (latency != 0) return latency;
+  }
+
   // Basic latency modeling for x64 instructions. They have been determined
   // in an empirical way.
   switch (instr->arch_opcode()) {
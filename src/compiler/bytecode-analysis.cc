@@ -115,6 +115,10 @@ void UpdateInLiveness(Bytecode bytecode, BytecodeLivenessState& in_liveness,
   if (Bytecodes::WritesAccumulator(bytecode)) {
     in_liveness.MarkAccumulatorDead();
   }
+  if (Bytecodes::IsShortStar(bytecode)) {
+    in_liveness.MarkRegisterDead(
+        interpreter::Register::FromShortStar(bytecode).index());
+  }
   for (int i = 0; i < num_operands; ++i) {
     switch (operand_types[i]) {
       case OperandType::kRegOut: {
@@ -277,6 +281,9 @@ void UpdateAssignments(Bytecode bytecode, BytecodeLoopAssignments& assignments,
   int num_operands = Bytecodes::NumberOfOperands(bytecode);
   const OperandType* operand_types = Bytecodes::GetOperandTypes(bytecode);
 
+  if (Bytecodes::IsShortStar(bytecode)) {
+    assignments.Add(interpreter::Register::FromShortStar(bytecode));
+  }
   for (int i = 0; i < num_operands; ++i) {
     switch (operand_types[i]) {
       case OperandType::kRegOut: {
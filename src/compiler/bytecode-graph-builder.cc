@@ -577,6 +577,15 @@ VectorSlotPair BytecodeGraphBuilder::CreateVectorSlotPair(int slot_id) {
   return VectorSlotPair(feedback_vector(), slot, nexus.ic_state());
 }
 
+void BytecodeGraphBuilder::BuildIncrementInvocationCount() {
+  if (isolate()->is_best_effort_code_coverage()) return;
+  Node* vector = jsgraph()->Constant(feedback_vector());
+  FieldAccess const access = AccessBuilder::ForFeedbackVectorInvocationCount();
+  Node* count = NewNode(simplified()->LoadField(access), vector);
+  count = NewNode(simplified()->NumberAdd(), count, jsgraph()->OneConstant());
+  NewNode(simplified()->StoreField(access), vector, count);
+}
+
 void BytecodeGraphBuilder::CreateGraph() {
   SourcePositionTable::Scope pos_scope(source_positions_, start_position_);
 
@@ -592,6 +601,8 @@ void BytecodeGraphBuilder::CreateGraph() {
                   graph()->start());
   set_environment(&env);
 
+  if (osr_offset_.IsNone()) BuildIncrementInvocationCount();
+
   VisitBytecodes();
 
   // Finish the basic structure of the graph.
@@ -972,9 +983,15 @@ void BytecodeGraphBuilder::VisitLdar() {
 
 void BytecodeGraphBuilder::VisitStar() {
   Node* value = environment()->LookupAccumulator();
-  environment()->BindRegister(bytecode_iterator().GetRegisterOperand(0), value);
+  environment()->BindRegister(bytecode_iterator().GetStarTargetRegister(),
+                              value);
 }
 
+#define SHORT_STAR_VISITOR(Name, ...) \
+  void BytecodeGraphBuilder::Visit##Name() { VisitStar(); }
+SHORT_STAR_BYTECODE_LIST(SHORT_STAR_VISITOR)
+#undef SHORT_STAR_VISITOR
+
 void BytecodeGraphBuilder::VisitMov() {
   Node* value =
       environment()->LookupRegister(bytecode_iterator().GetRegisterOperand(0));
@@ -2125,6 +2142,11 @@ void BytecodeGraphBuilder::VisitInvokeIntrinsic() {
   const Operator* call = javascript()->CallRuntime(functionId, reg_count);
   Node* value = ProcessCallRuntimeArguments(call, receiver, reg_count);
   environment()->BindAccumulator(value, Environment::kAttachFrameState);
+
+  if (functionId == Runtime::kInlineCreateJSGeneratorObject ||
+      functionId == Runtime::kInlineAsyncFunctionEnter) {
+    BuildStoreGeneratorParameters(value);
+  }
 }
 
 void BytecodeGraphBuilder::VisitThrow() {
@@ -2767,7 +2789,17 @@ void BytecodeGraphBuilder::VisitSwitchOnSmiNoFeedback() {
 
 void BytecodeGraphBuilder::VisitStackCheck() {
   PrepareEagerCheckpoint();
-  Node* node = NewNode(javascript()->StackCheck());
+  // Stack checks inside of loops don't grow the frame beyond what the check
+  // on function entry covered, so they can't overflow and don't need an
+  // exception edge inside of try-blocks. With OSR the frame is grown on
+  // loop entry though, so keep the full check there.
+  StackCheckKind kind = StackCheckKind::kJSFunctionEntry;
+  if (osr_offset_.IsNone() &&
+      bytecode_analysis()->GetLoopOffsetFor(
+          bytecode_iterator().current_offset()) != -1) {
+    kind = StackCheckKind::kJSIterationBody;
+  }
+  Node* node = NewNode(javascript()->StackCheck(kind));
   environment()->RecordAfterState(node, Environment::kAttachFrameState);
 }
 
@@ -2920,11 +2952,17 @@ void BytecodeGraphBuilder::VisitSuspendGenerator() {
   value_inputs[2] = offset;
 
   int count_written = 0;
-  // Store the parameters.
+  // Store the parameters. Parameters that still hold their incoming value
+  // are already in the generator: either stored right after the generator
+  // object was created, or pushed from it when this frame was resumed.
   for (int i = 0; i < parameter_count_without_receiver; i++) {
-    value_inputs[3 + count_written++] =
+    Node* value =
         environment()->LookupRegister(interpreter::Register::FromParameterIndex(
             i, parameter_count_without_receiver));
+    if (IsIncomingParameter(value, i)) {
+      value = jsgraph()->OptimizedOutConstant();
+    }
+    value_inputs[3 + count_written++] = value;
   }
 
   // Store the registers.
@@ -2952,6 +2990,37 @@ void BytecodeGraphBuilder::VisitSuspendGenerator() {
       bytecode_iterator().current_offset()));
 }
 
+void BytecodeGraphBuilder::BuildStoreGeneratorParameters(Node* generator) {
+  // Fill in the parameters of a freshly created generator object, so that
+  // suspends can skip the parameters which were never reassigned. The
+  // context, continuation and input_or_debug_pos are re-stored with the
+  // values the generator object was created with.
+  int parameter_count_without_receiver =
+      bytecode_array()->parameter_count() - 1;
+  if (parameter_count_without_receiver == 0) return;
+
+  int value_input_count = 3 + parameter_count_without_receiver;
+  Node** value_inputs = local_zone()->NewArray<Node*>(value_input_count);
+  value_inputs[0] = generator;
+  value_inputs[1] =
+      jsgraph()->SmiConstant(JSGeneratorObject::kGeneratorExecuting);
+  value_inputs[2] = jsgraph()->UndefinedConstant();
+  for (int i = 0; i < parameter_count_without_receiver; i++) {
+    value_inputs[3 + i] =
+        environment()->LookupRegister(interpreter::Register::FromParameterIndex(
+            i, parameter_count_without_receiver));
+  }
+  MakeNode(javascript()->GeneratorStore(parameter_count_without_receiver),
+           value_input_count, value_inputs, false);
+}
+
+bool BytecodeGraphBuilder::IsIncomingParameter(Node* value,
+                                               int parameter_index) const {
+  // Parameter 0 is the receiver.
+  return value->opcode() == IrOpcode::kParameter &&
+         ParameterIndexOf(value->op()) == parameter_index + 1;
+}
+
 void BytecodeGraphBuilder::BuildSwitchOnGeneratorState(
     const ZoneVector<ResumeJumpTarget>& resume_jump_targets,
     bool allow_fallthrough_on_executing) {
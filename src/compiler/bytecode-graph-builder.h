@@ -245,6 +245,11 @@ class BytecodeGraphBuilder {
   // feedback.
   SpeculationMode GetSpeculationMode(int slot_id) const;
 
+  // Increments the invocation count in the feedback vector unless code
+  // coverage is in best effort mode. Optimized code skips the interpreter
+  // entry trampoline, which does this otherwise.
+  void BuildIncrementInvocationCount();
+
   // Control flow plumbing.
   void BuildJump();
   void BuildJumpIf(Node* condition);
@@ -262,6 +267,8 @@ class BytecodeGraphBuilder {
   void BuildSwitchOnGeneratorState(
       const ZoneVector<ResumeJumpTarget>& resume_jump_targets,
       bool allow_fallthrough_on_executing);
+  void BuildStoreGeneratorParameters(Node* generator);
+  bool IsIncomingParameter(Node* value, int parameter_index) const;
 
   // Simulates control flow by forward-propagating environments.
   void MergeIntoSuccessorEnvironment(int target_offset);
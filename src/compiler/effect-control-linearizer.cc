@@ -985,6 +985,12 @@ bool EffectControlLinearizer::TryWireInStateEffect(Node* node,
     case IrOpcode::kFindOrderedHashMapEntryForInt32Key:
       result = LowerFindOrderedHashMapEntryForInt32Key(node);
       break;
+    case IrOpcode::kFindOrderedHashMapEntryForStringKey:
+      result = LowerFindOrderedHashMapEntryForStringKey(node);
+      break;
+    case IrOpcode::kFindWeakMapEntry:
+      result = LowerFindWeakMapEntry(node);
+      break;
     case IrOpcode::kTransitionAndStoreNumberElement:
       LowerTransitionAndStoreNumberElement(node);
       break;
@@ -3109,11 +3115,44 @@ Node* EffectControlLinearizer::LowerNewArgumentsElements(Node* node) {
                  length, __ SmiConstant(mapped_count), __ NoContextConstant());
 }
 
+Node* EffectControlLinearizer::MaybeDerefIndirectString(Node* string) {
+  auto if_deref = __ MakeLabel();
+  auto done = __ MakeLabel(MachineRepresentation::kTaggedPointer);
+
+  Node* string_map = __ LoadField(AccessBuilder::ForMap(), string);
+  Node* string_instance_type =
+      __ LoadField(AccessBuilder::ForMapInstanceType(), string_map);
+  Node* representation = __ Word32And(
+      string_instance_type, __ Int32Constant(kStringRepresentationMask));
+  __ GotoIf(__ Word32Equal(representation, __ Int32Constant(kThinStringTag)),
+            &if_deref);
+  __ GotoIfNot(__ Word32Equal(representation, __ Int32Constant(kConsStringTag)),
+               &done, string);
+  Node* string_second =
+      __ LoadField(AccessBuilder::ForConsStringSecond(), string);
+  __ GotoIfNot(__ WordEqual(string_second, __ EmptyStringConstant()), &done,
+               string);
+  __ Goto(&if_deref);
+
+  __ Bind(&if_deref);
+  STATIC_ASSERT(static_cast<int>(ThinString::kActualOffset) ==
+                static_cast<int>(ConsString::kFirstOffset));
+  __ Goto(&done, __ LoadField(AccessBuilder::ForConsStringFirst(), string));
+
+  __ Bind(&done);
+  return done.PhiAt(0);
+}
+
 Node* EffectControlLinearizer::LowerNewConsString(Node* node) {
   Node* length = node->InputAt(0);
   Node* first = node->InputAt(1);
   Node* second = node->InputAt(2);
 
+  // Don't build cons strings on top of thin strings or flattened cons strings,
+  // see CodeStubAssembler::StringAdd.
+  first = MaybeDerefIndirectString(first);
+  second = MaybeDerefIndirectString(second);
+
   // Determine the instance types of {first} and {second}.
   Node* first_map = __ LoadField(AccessBuilder::ForMap(), first);
   Node* first_instance_type =
@@ -5285,6 +5324,123 @@ Node* EffectControlLinearizer::LowerFindOrderedHashMapEntryForInt32Key(
   return done.PhiAt(0);
 }
 
+Node* EffectControlLinearizer::LowerFindOrderedHashMapEntryForStringKey(
+    Node* node) {
+  Node* table = NodeProperties::GetValueInput(node, 0);
+  Node* key = NodeProperties::GetValueInput(node, 1);
+
+  auto call_builtin = __ MakeDeferredLabel();
+  auto done = __ MakeLabel(MachineType::PointerRepresentation());
+
+  // Internalized strings have their hash computed, and are equal to another
+  // internalized string only if they are identical. Everything else takes
+  // the generic lookup.
+  Node* key_map = __ LoadField(AccessBuilder::ForMap(), key);
+  Node* key_instance_type =
+      __ LoadField(AccessBuilder::ForMapInstanceType(), key_map);
+  __ GotoIfNot(
+      __ Word32Equal(__ Word32And(key_instance_type,
+                                  __ Int32Constant(kIsNotInternalizedMask)),
+                     __ Int32Constant(kInternalizedTag)),
+      &call_builtin);
+
+  Node* hash = ChangeUint32ToUintPtr(
+      __ Word32Shr(__ LoadField(AccessBuilder::ForNameHashField(), key),
+                   __ Int32Constant(Name::kHashShift)));
+
+  Node* number_of_buckets = ChangeSmiToIntPtr(__ LoadField(
+      AccessBuilder::ForOrderedHashMapOrSetNumberOfBuckets(), table));
+  hash = __ WordAnd(hash, __ IntSub(number_of_buckets, __ IntPtrConstant(1)));
+  Node* first_entry = ChangeSmiToIntPtr(__ Load(
+      MachineType::TaggedSigned(), table,
+      __ IntAdd(__ WordShl(hash, __ IntPtrConstant(kPointerSizeLog2)),
+                __ IntPtrConstant(OrderedHashMap::HashTableStartOffset() -
+                                  kHeapObjectTag))));
+
+  auto loop = __ MakeLoopLabel(MachineType::PointerRepresentation());
+  __ Goto(&loop, first_entry);
+  __ Bind(&loop);
+  {
+    Node* entry = loop.PhiAt(0);
+    Node* check =
+        __ WordEqual(entry, __ IntPtrConstant(OrderedHashMap::kNotFound));
+    __ GotoIf(check, &done, entry);
+    entry = __ IntAdd(
+        __ IntMul(entry, __ IntPtrConstant(OrderedHashMap::kEntrySize)),
+        number_of_buckets);
+
+    Node* candidate_key = __ Load(
+        MachineType::AnyTagged(), table,
+        __ IntAdd(__ WordShl(entry, __ IntPtrConstant(kPointerSizeLog2)),
+                  __ IntPtrConstant(OrderedHashMap::HashTableStartOffset() -
+                                    kHeapObjectTag)));
+
+    auto if_notmatch = __ MakeLabel();
+    auto if_notidentical = __ MakeLabel();
+    __ GotoIfNot(__ WordEqual(candidate_key, key), &if_notidentical);
+    __ Goto(&done, entry);
+
+    // A string key which is not internalized may still be equal to {key},
+    // so bail out to the generic lookup when we run into one.
+    __ Bind(&if_notidentical);
+    __ GotoIf(ObjectIsSmi(candidate_key), &if_notmatch);
+    Node* candidate_instance_type = __ LoadField(
+        AccessBuilder::ForMapInstanceType(),
+        __ LoadField(AccessBuilder::ForMap(), candidate_key));
+    __ Branch(
+        __ Word32Equal(
+            __ Word32And(candidate_instance_type,
+                         __ Int32Constant(kIsNotStringMask |
+                                          kIsNotInternalizedMask)),
+            __ Int32Constant(kStringTag | kNotInternalizedTag)),
+        &call_builtin, &if_notmatch);
+
+    __ Bind(&if_notmatch);
+    {
+      Node* next_entry = ChangeSmiToIntPtr(__ Load(
+          MachineType::TaggedSigned(), table,
+          __ IntAdd(
+              __ WordShl(entry, __ IntPtrConstant(kPointerSizeLog2)),
+              __ IntPtrConstant(OrderedHashMap::HashTableStartOffset() +
+                                OrderedHashMap::kChainOffset * kPointerSize -
+                                kHeapObjectTag))));
+      __ Goto(&loop, next_entry);
+    }
+  }
+
+  __ Bind(&call_builtin);
+  {
+    Callable const callable =
+        Builtins::CallableFor(isolate(), Builtins::kFindOrderedHashMapEntry);
+    Operator::Properties const properties = node->op()->properties();
+    CallDescriptor::Flags const flags = CallDescriptor::kNoFlags;
+    auto call_descriptor = Linkage::GetStubCallDescriptor(
+        graph()->zone(), callable.descriptor(),
+        callable.descriptor().GetStackParameterCount(), flags, properties);
+    Node* entry = __ Call(call_descriptor, __ HeapConstant(callable.code()),
+                          table, key, __ NoContextConstant());
+    __ Goto(&done, ChangeSmiToIntPtr(entry));
+  }
+
+  __ Bind(&done);
+  return done.PhiAt(0);
+}
+
+Node* EffectControlLinearizer::LowerFindWeakMapEntry(Node* node) {
+  Node* table = NodeProperties::GetValueInput(node, 0);
+  Node* key = NodeProperties::GetValueInput(node, 1);
+
+  Callable const callable =
+      Builtins::CallableFor(isolate(), Builtins::kWeakMapLookupHashIndex);
+  Operator::Properties const properties = node->op()->properties();
+  CallDescriptor::Flags const flags = CallDescriptor::kNoFlags;
+  auto call_descriptor = Linkage::GetStubCallDescriptor(
+      graph()->zone(), callable.descriptor(),
+      callable.descriptor().GetStackParameterCount(), flags, properties);
+  return __ Call(call_descriptor, __ HeapConstant(callable.code()), table, key,
+                 __ NoContextConstant());
+}
+
 Node* EffectControlLinearizer::LowerDateNow(Node* node) {
   Operator::Properties properties = Operator::kNoDeopt | Operator::kNoThrow;
   Runtime::FunctionId id = Runtime::kDateCurrentTime;
@@ -545,6 +545,10 @@ Node* LowerCompareMapsWithoutLoad(Node* checked_map,
   return replacement;
 }
 
+// LoadElement with a non-constant index from a virtual object with at most this
+// many elements is turned into a chain of Select operations.
+const int kMaxElementsForSelectChain = 4;
+
 void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
                 JSGraph* jsgraph) {
   switch (op->opcode()) {
@@ -629,9 +633,6 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
         int const length =
             (vobject->size() - access.header_size) >>
             ElementSizeLog2Of(access.machine_type.representation());
-        Variable var0, var1;
-        Node* value0;
-        Node* value1;
         if (length == 1 &&
             vobject->FieldAt(OffsetOfElementAt(access, 0)).To(&var) &&
             current->Get(var).To(&value) &&
@@ -642,37 +643,56 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
           // one element of {object}.
           current->SetReplacement(value);
           break;
-        } else if (length == 2 &&
-                   vobject->FieldAt(OffsetOfElementAt(access, 0)).To(&var0) &&
-                   current->Get(var0).To(&value0) &&
-                   (value0 == nullptr ||
-                    NodeProperties::GetType(value0).Is(access.type)) &&
-                   vobject->FieldAt(OffsetOfElementAt(access, 1)).To(&var1) &&
-                   current->Get(var1).To(&value1) &&
-                   (value1 == nullptr ||
-                    NodeProperties::GetType(value1).Is(access.type))) {
-          if (value0 && value1) {
-            // The {object} has exactly two elements, so the LoadElement
-            // must return one of them (i.e. either the element at index
-            // 0 or the one at index 1). So we can turn the LoadElement
-            // into a Select operation instead (still allowing the {object}
-            // to be scalar replaced). We must however mark the elements
-            // of the {object} itself as escaping.
-            Node* check =
-                jsgraph->graph()->NewNode(jsgraph->simplified()->NumberEqual(),
-                                          index, jsgraph->ZeroConstant());
-            NodeProperties::SetType(check, Type::Boolean());
-            Node* select = jsgraph->graph()->NewNode(
-                jsgraph->common()->Select(access.machine_type.representation()),
-                check, value0, value1);
-            NodeProperties::SetType(select, access.type);
+        } else if (length >= 2 && length <= kMaxElementsForSelectChain) {
+          // The {object} has only a few elements, so the LoadElement must
+          // return one of them. This is typically an arguments or rest
+          // parameters object of an inlined callee that is indexed by a loop
+          // variable. We can turn the LoadElement into a chain of Select
+          // operations instead (still allowing the {object} to be scalar
+          // replaced). We must however mark the elements of the {object}
+          // itself as escaping.
+          Node* values[kMaxElementsForSelectChain];
+          bool all_known = true;
+          bool all_typed = true;
+          for (int i = 0; i < length; ++i) {
+            if (!vobject->FieldAt(OffsetOfElementAt(access, i)).To(&var) ||
+                !current->Get(var).To(&values[i])) {
+              all_known = false;
+              break;
+            }
+            if (values[i] == nullptr) {
+              all_typed = false;
+            } else if (!NodeProperties::GetType(values[i]).Is(access.type)) {
+              all_known = false;
+              break;
+            }
+          }
+          if (all_known) {
+            if (!all_typed) {
+              // If the variables have no values, we have
+              // not reached the fixed-point yet.
+              break;
+            }
+            Node* select = values[length - 1];
+            for (int i = length - 2; i >= 0; --i) {
+              Node* constant = jsgraph->Constant(i);
+              // The typer is not running anymore, so type cached constants
+              // created here ourselves.
+              if (!NodeProperties::IsTyped(constant)) {
+                NodeProperties::SetType(
+                    constant, Type::NewConstant(i, jsgraph->graph()->zone()));
+              }
+              Node* check = jsgraph->graph()->NewNode(
+                  jsgraph->simplified()->NumberEqual(), index, constant);
+              NodeProperties::SetType(check, Type::Boolean());
+              select = jsgraph->graph()->NewNode(
+                  jsgraph->common()->Select(
+                      access.machine_type.representation()),
+                  check, values[i], select);
+              NodeProperties::SetType(select, access.type);
+            }
             current->SetReplacement(select);
-            current->SetEscaped(value0);
-            current->SetEscaped(value1);
-            break;
-          } else {
-            // If the variables have no values, we have
-            // not reached the fixed-point yet.
+            for (int i = 0; i < length; ++i) current->SetEscaped(values[i]);
             break;
           }
         }
@@ -4,6 +4,7 @@
 
 #include "src/compiler/js-call-reducer.h"
 
+#include "include/v8-fast-api-calls.h"
 #include "src/api-inl.h"
 #include "src/builtins/builtins-promise.h"
 #include "src/builtins/builtins-utils.h"
@@ -2911,6 +2912,23 @@ Reduction JSCallReducer::ReduceCallApiFunction(
     }
   }
 
+  Node* holder = lookup == CallOptimization::kHolderFound
+                     ? jsgraph()->HeapConstant(api_holder)
+                     : receiver;
+
+  // Call the embedder's fast C function directly if it has one that
+  // matches this call site.
+  Object* c_function = function_template_info->GetCFunction();
+  if (FLAG_turbo_fast_api_calls && c_function->IsForeign() &&
+      p.speculation_mode() == SpeculationMode::kAllowSpeculation) {
+    const CFunctionInfo* c_signature =
+        v8::ToCData<const CFunctionInfo*>(
+            function_template_info->GetCSignature());
+    Reduction reduction = ReduceFastApiCall(
+        node, v8::ToCData<Address>(c_function), c_signature, holder);
+    if (reduction.Changed()) return reduction;
+  }
+
   // Load the {target}s context.
   Node* context = effect = graph()->NewNode(
       simplified()->LoadField(AccessBuilder::ForJSFunctionContext()), target,
@@ -2931,9 +2949,6 @@ Reduction JSCallReducer::ReduceCallApiFunction(
       cid.GetStackParameterCount() + argc + 1 /* implicit receiver */,
       CallDescriptor::kNeedsFrameState);
   ApiFunction api_function(v8::ToCData<Address>(call_handler_info->callback()));
-  Node* holder = lookup == CallOptimization::kHolderFound
-                     ? jsgraph()->HeapConstant(api_holder)
-                     : receiver;
   ExternalReference function_reference = ExternalReference::Create(
       &api_function, ExternalReference::DIRECT_API_CALL);
   node->InsertInput(graph()->zone(), 0,
@@ -2951,6 +2966,97 @@ Reduction JSCallReducer::ReduceCallApiFunction(
   return Changed(node);
 }
 
+Reduction JSCallReducer::ReduceFastApiCall(Node* node, Address c_function,
+                                           const CFunctionInfo* c_signature,
+                                           Node* holder) {
+  DCHECK_EQ(IrOpcode::kJSCall, node->opcode());
+  CallParameters const& p = CallParametersOf(node->op());
+  int const argc = static_cast<int>(p.arity()) - 2;
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+
+  // The first C parameter is the {holder}, followed by the JS arguments.
+  DCHECK_EQ(CTypeInfo::Type::kReceiver,
+            c_signature->ArgumentInfo(0).GetType());
+  if (static_cast<int>(c_signature->ArgumentCount()) != argc + 1) {
+    return NoChange();
+  }
+  for (int i = 0; i < argc; ++i) {
+    CTypeInfo::Type const type = c_signature->ArgumentInfo(i + 1).GetType();
+    if (type != CTypeInfo::Type::kInt32 && type != CTypeInfo::Type::kUint32) {
+      return NoChange();
+    }
+  }
+
+  CTypeInfo::Type const return_type = c_signature->ReturnInfo().GetType();
+  MachineSignature::Builder builder(
+      graph()->zone(), return_type == CTypeInfo::Type::kVoid ? 0 : 1,
+      argc + 1);
+  switch (return_type) {
+    case CTypeInfo::Type::kVoid:
+      break;
+    case CTypeInfo::Type::kInt32:
+      builder.AddReturn(MachineType::Int32());
+      break;
+    case CTypeInfo::Type::kUint32:
+      builder.AddReturn(MachineType::Uint32());
+      break;
+    case CTypeInfo::Type::kReceiver:
+      return NoChange();
+  }
+
+  // The C function sees the raw tagged {holder}; it must not allocate, so
+  // the {holder} cannot move during the call.
+  builder.AddParam(MachineType::AnyTagged());
+  Node** inputs = graph()->zone()->NewArray<Node*>(argc + 4);
+  inputs[0] = jsgraph()->ExternalConstant(ExternalReference::Create(c_function));
+  inputs[1] = holder;
+  for (int i = 0; i < argc; ++i) {
+    Node* value = NodeProperties::GetValueInput(node, 2 + i);
+    value = effect = graph()->NewNode(simplified()->CheckNumber(p.feedback()),
+                                      value, effect, control);
+    switch (c_signature->ArgumentInfo(i + 1).GetType()) {
+      case CTypeInfo::Type::kInt32:
+        builder.AddParam(MachineType::Int32());
+        value = graph()->NewNode(simplified()->NumberToInt32(), value);
+        break;
+      case CTypeInfo::Type::kUint32:
+        builder.AddParam(MachineType::Uint32());
+        value = graph()->NewNode(simplified()->NumberToUint32(), value);
+        break;
+      case CTypeInfo::Type::kVoid:
+      case CTypeInfo::Type::kReceiver:
+        UNREACHABLE();
+    }
+    inputs[2 + i] = value;
+  }
+  inputs[argc + 2] = effect;
+  inputs[argc + 3] = control;
+
+  auto call_descriptor =
+      Linkage::GetSimplifiedCDescriptor(graph()->zone(), builder.Build());
+  Node* value = effect = graph()->NewNode(common()->Call(call_descriptor),
+                                          argc + 4, inputs);
+  switch (return_type) {
+    case CTypeInfo::Type::kVoid:
+      value = jsgraph()->UndefinedConstant();
+      break;
+    case CTypeInfo::Type::kInt32:
+      value = effect = graph()->NewNode(common()->TypeGuard(Type::Signed32()),
+                                        value, effect, control);
+      break;
+    case CTypeInfo::Type::kUint32:
+      value = effect = graph()->NewNode(
+          common()->TypeGuard(Type::Unsigned32()), value, effect, control);
+      break;
+    case CTypeInfo::Type::kReceiver:
+      UNREACHABLE();
+  }
+
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
 namespace {
 
 // Check whether elements aren't mutated; we play it extremely safe here by
@@ -3451,6 +3557,8 @@ Reduction JSCallReducer::ReduceJSCall(Node* node,
       return ReduceArrayIterator(node, IterationKind::kValues);
     case Builtins::kArrayIteratorPrototypeNext:
       return ReduceArrayIteratorPrototypeNext(node);
+    case Builtins::kArrayFrom:
+      return ReduceArrayFrom(node);
     case Builtins::kArrayIsArray:
       return ReduceArrayIsArray(node);
     case Builtins::kArrayBufferIsView:
@@ -3602,6 +3710,10 @@ Reduction JSCallReducer::ReduceJSCall(Node* node,
       return ReduceNumberIsNaN(node);
     case Builtins::kNumberParseInt:
       return ReduceNumberParseInt(node);
+    case Builtins::kBigIntAsIntN:
+      return ReduceBigIntAsN(node, Builtins::kI64ToBigInt);
+    case Builtins::kBigIntAsUintN:
+      return ReduceBigIntAsN(node, Builtins::kU64ToBigInt);
     case Builtins::kGlobalIsFinite:
       return ReduceGlobalIsFinite(node);
     case Builtins::kGlobalIsNaN:
@@ -3610,6 +3722,10 @@ Reduction JSCallReducer::ReduceJSCall(Node* node,
       return ReduceMapPrototypeGet(node);
     case Builtins::kMapPrototypeHas:
       return ReduceMapPrototypeHas(node);
+    case Builtins::kWeakMapGet:
+      return ReduceWeakMapPrototypeGet(node);
+    case Builtins::kWeakMapHas:
+      return ReduceWeakMapPrototypeHas(node);
     case Builtins::kRegExpPrototypeTest:
       return ReduceRegExpPrototypeTest(node);
     case Builtins::kReturnReceiver:
@@ -4873,6 +4989,87 @@ Reduction JSCallReducer::ReduceArrayPrototypeSlice(Node* node) {
   return Replace(clone);
 }
 
+// ES6 section 22.1.2.1 Array.from ( items [ , mapfn [ , thisArg ] ] )
+Reduction JSCallReducer::ReduceArrayFrom(Node* node) {
+  if (!FLAG_turbo_inline_array_builtins) return NoChange();
+  DCHECK_EQ(IrOpcode::kJSCall, node->opcode());
+  CallParameters const& p = CallParametersOf(node->op());
+  if (p.speculation_mode() == SpeculationMode::kDisallowSpeculation) {
+    return NoChange();
+  }
+
+  // We only optimize Array.from(items) and Array.from(items, undefined),
+  // where the {items} are a fast JSArray, since that is just a clone.
+  int const arity = node->op()->ValueInputCount() - 2;
+  if (arity < 1 || arity > 2) return NoChange();
+  if (arity == 2 &&
+      !HeapObjectMatcher(NodeProperties::GetValueInput(node, 3))
+           .Is(factory()->undefined_value())) {
+    return NoChange();
+  }
+
+  // The {receiver} must be the Array function, otherwise Array.from
+  // constructs the result via the {receiver}.
+  Node* receiver = NodeProperties::GetValueInput(node, 1);
+  HeapObjectMatcher m(receiver);
+  if (!m.HasValue() ||
+      !m.Ref(broker()).equals(native_context().array_function())) {
+    return NoChange();
+  }
+
+  Node* items = NodeProperties::GetValueInput(node, 2);
+  Node* context = NodeProperties::GetContextInput(node);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+
+  // Try to determine the {items} maps.
+  ZoneHandleSet<Map> items_maps;
+  NodeProperties::InferReceiverMapsResult result =
+      NodeProperties::InferReceiverMaps(broker(), items, effect, &items_maps);
+  if (result == NodeProperties::kNoReceiverMaps) return NoChange();
+
+  // Iterating the {items} must not be observable, which is the case
+  // as long as the Array iterator lookup chain is intact.
+  if (!isolate()->IsArrayIteratorLookupChainIntact()) return NoChange();
+
+  // Check that the maps are of JSArray with packed elements; holes would
+  // have to be turned into undefined, so we cannot just clone those.
+  for (Handle<Map> map : items_maps) {
+    MapRef items_map(broker(), map);
+    if (!CanInlineArrayIteratingBuiltin(isolate(), items_map) ||
+        IsHoleyElementsKind(items_map.elements_kind())) {
+      return NoChange();
+    }
+  }
+
+  // Install code dependency on the Array iterator protector.
+  dependencies()->DependOnProtector(
+      PropertyCellRef(broker(), factory()->array_iterator_protector()));
+
+  // If we have unreliable maps, we need a map check, as there might be
+  // side-effects caused by the evaluation of the {node}s parameters.
+  if (result == NodeProperties::kUnreliableReceiverMaps) {
+    effect = graph()->NewNode(
+        simplified()->CheckMaps(CheckMapsFlag::kNone, items_maps,
+                                p.feedback()),
+        items, effect, control);
+  }
+
+  Callable callable =
+      Builtins::CallableFor(isolate(), Builtins::kCloneFastJSArray);
+  auto call_descriptor = Linkage::GetStubCallDescriptor(
+      graph()->zone(), callable.descriptor(),
+      callable.descriptor().GetStackParameterCount(), CallDescriptor::kNoFlags,
+      Operator::kNoThrow | Operator::kNoDeopt);
+
+  Node* clone = effect = graph()->NewNode(
+      common()->Call(call_descriptor), jsgraph()->HeapConstant(callable.code()),
+      items, context, effect, control);
+
+  ReplaceWithValue(node, clone, effect, control);
+  return Replace(clone);
+}
+
 // ES6 section 22.1.2.2 Array.isArray ( arg )
 Reduction JSCallReducer::ReduceArrayIsArray(Node* node) {
   // We certainly know that undefined is not an array.
@@ -6284,6 +6481,62 @@ Reduction JSCallReducer::ReduceNumberIsSafeInteger(Node* node) {
   return Replace(value);
 }
 
+// ES #sec-bigint.asintn and ES #sec-bigint.asuintn
+Reduction JSCallReducer::ReduceBigIntAsN(Node* node, Builtins::Name builtin) {
+  // The raw 64-bit builtins are only available on 64-bit targets.
+  if (!jsgraph()->machine()->Is64()) return NoChange();
+  CallParameters const& p = CallParametersOf(node->op());
+  if (p.speculation_mode() == SpeculationMode::kDisallowSpeculation) {
+    return NoChange();
+  }
+  if (node->op()->ValueInputCount() < 4) return NoChange();
+
+  // Only the 64-bit width maps onto a single machine word.
+  NumberMatcher m(NodeProperties::GetValueInput(node, 2));
+  if (!m.Is(64)) return NoChange();
+
+  Node* value = NodeProperties::GetValueInput(node, 3);
+  Node* context = NodeProperties::GetContextInput(node);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+
+  // Deoptimize for anything that would need ToBigInt, so that neither
+  // of the calls below can throw or run user code.
+  Node* check = graph()->NewNode(simplified()->ObjectIsBigInt(), value);
+  effect = graph()->NewNode(
+      simplified()->CheckIf(DeoptimizeReason::kNotABigInt, p.feedback()),
+      check, effect, control);
+
+  // Truncate to the low 64 bits and box the result again.
+  {
+    Callable const callable =
+        Builtins::CallableFor(isolate(), Builtins::kBigIntToI64);
+    auto call_descriptor = Linkage::GetStubCallDescriptor(
+        graph()->zone(), callable.descriptor(),
+        callable.descriptor().GetStackParameterCount(),
+        CallDescriptor::kNoFlags, Operator::kEliminatable);
+    value = effect = graph()->NewNode(
+        common()->Call(call_descriptor),
+        jsgraph()->HeapConstant(callable.code()), value, context, effect,
+        control);
+  }
+  {
+    Callable const callable = Builtins::CallableFor(isolate(), builtin);
+    auto call_descriptor = Linkage::GetStubCallDescriptor(
+        graph()->zone(), callable.descriptor(),
+        callable.descriptor().GetStackParameterCount(),
+        CallDescriptor::kNoFlags, Operator::kEliminatable);
+    value = effect = graph()->NewNode(
+        common()->Call(call_descriptor),
+        jsgraph()->HeapConstant(callable.code()), value, effect, control);
+  }
+  value = effect = graph()->NewNode(common()->TypeGuard(Type::BigInt()),
+                                    value, effect, control);
+
+  ReplaceWithValue(node, value, effect);
+  return Replace(value);
+}
+
 // ES #sec-number.isnan
 Reduction JSCallReducer::ReduceNumberIsNaN(Node* node) {
   if (node->op()->ValueInputCount() < 3) {
@@ -6369,6 +6622,78 @@ Reduction JSCallReducer::ReduceMapPrototypeHas(Node* node) {
   return Replace(value);
 }
 
+Reduction JSCallReducer::ReduceWeakMapPrototypeGet(Node* node) {
+  // We only optimize if we have target, receiver and key parameters.
+  if (node->op()->ValueInputCount() != 3) return NoChange();
+  Node* receiver = NodeProperties::GetValueInput(node, 1);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+  Node* key = NodeProperties::GetValueInput(node, 2);
+
+  if (!NodeProperties::HasInstanceTypeWitness(broker(), receiver, effect,
+                                              JS_WEAK_MAP_TYPE))
+    return NoChange();
+
+  Node* table = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSWeakCollectionTable()),
+      receiver, effect, control);
+
+  Node* index = effect = graph()->NewNode(simplified()->FindWeakMapEntry(),
+                                          table, key, effect, control);
+
+  Node* check = graph()->NewNode(simplified()->NumberEqual(), index,
+                                 jsgraph()->MinusOneConstant());
+
+  Node* branch = graph()->NewNode(common()->Branch(), check, control);
+
+  // Key not found.
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* etrue = effect;
+  Node* vtrue = jsgraph()->UndefinedConstant();
+
+  // Key found, {index} is the index of the value in the {table}.
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* efalse = effect;
+  Node* vfalse = efalse = graph()->NewNode(
+      simplified()->LoadElement(AccessBuilder::ForFixedArrayElement()), table,
+      index, efalse, if_false);
+
+  control = graph()->NewNode(common()->Merge(2), if_true, if_false);
+  Node* value = graph()->NewNode(
+      common()->Phi(MachineRepresentation::kTagged, 2), vtrue, vfalse, control);
+  effect = graph()->NewNode(common()->EffectPhi(2), etrue, efalse, control);
+
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
+Reduction JSCallReducer::ReduceWeakMapPrototypeHas(Node* node) {
+  // We only optimize if we have target, receiver and key parameters.
+  if (node->op()->ValueInputCount() != 3) return NoChange();
+  Node* receiver = NodeProperties::GetValueInput(node, 1);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+  Node* key = NodeProperties::GetValueInput(node, 2);
+
+  if (!NodeProperties::HasInstanceTypeWitness(broker(), receiver, effect,
+                                              JS_WEAK_MAP_TYPE))
+    return NoChange();
+
+  Node* table = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSWeakCollectionTable()),
+      receiver, effect, control);
+
+  Node* index = effect = graph()->NewNode(simplified()->FindWeakMapEntry(),
+                                          table, key, effect, control);
+
+  Node* value = graph()->NewNode(simplified()->NumberEqual(), index,
+                                 jsgraph()->MinusOneConstant());
+  value = graph()->NewNode(simplified()->BooleanNot(), value);
+
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
 namespace {
 
 InstanceType InstanceTypeForCollectionKind(CollectionKind kind) {
@@ -11,6 +11,10 @@
 #include "src/deoptimize-reason.h"
 
 namespace v8 {
+
+// Forward declarations.
+class CFunctionInfo;
+
 namespace internal {
 
 // Forward declarations.
@@ -59,6 +63,8 @@ class V8_EXPORT_PRIVATE JSCallReducer final : public AdvancedReducer {
   Reduction ReduceBooleanConstructor(Node* node);
   Reduction ReduceCallApiFunction(Node* node,
                                   const SharedFunctionInfoRef& shared);
+  Reduction ReduceFastApiCall(Node* node, Address c_function,
+                              const CFunctionInfo* c_signature, Node* holder);
   Reduction ReduceFunctionPrototypeApply(Node* node);
   Reduction ReduceFunctionPrototypeBind(Node* node);
   Reduction ReduceFunctionPrototypeCall(Node* node);
@@ -94,6 +100,7 @@ class V8_EXPORT_PRIVATE JSCallReducer final : public AdvancedReducer {
   Reduction ReduceArrayPrototypePop(Node* node);
   Reduction ReduceArrayPrototypeShift(Node* node);
   Reduction ReduceArrayPrototypeSlice(Node* node);
+  Reduction ReduceArrayFrom(Node* node);
   Reduction ReduceArrayIsArray(Node* node);
   enum class ArrayIteratorKind { kArray, kTypedArray };
   Reduction ReduceArrayIterator(Node* node, IterationKind kind);
@@ -158,10 +165,14 @@ class V8_EXPORT_PRIVATE JSCallReducer final : public AdvancedReducer {
   Reduction ReduceNumberIsSafeInteger(Node* node);
   Reduction ReduceNumberIsNaN(Node* node);
 
+  Reduction ReduceBigIntAsN(Node* node, Builtins::Name builtin);
+
   Reduction ReduceGlobalIsFinite(Node* node);
   Reduction ReduceGlobalIsNaN(Node* node);
 
   Reduction ReduceMapPrototypeHas(Node* node);
+  Reduction ReduceWeakMapPrototypeGet(Node* node);
+  Reduction ReduceWeakMapPrototypeHas(Node* node);
   Reduction ReduceMapPrototypeGet(Node* node);
   Reduction ReduceCollectionIteration(Node* node,
                                       CollectionKind collection_kind,
@@ -1384,11 +1384,13 @@ Reduction JSCreateLowering::ReduceJSCreateObject(Node* node) {
             jsgraph()->SmiConstant(PropertyDetails::kInitialIndex));
     a.Store(AccessBuilder::ForDictionaryObjectHashIndex(),
             jsgraph()->SmiConstant(PropertyArray::kNoHashSentinel));
-    // Initialize the Properties fields.
+    // Initialize the enum keys cache and the Properties fields.
     Node* undefined = jsgraph()->UndefinedConstant();
-    STATIC_ASSERT(NameDictionary::kElementsStartIndex ==
+    STATIC_ASSERT(NameDictionary::kEnumKeysCacheIndex ==
                   NameDictionary::kObjectHashIndex + 1);
-    for (int index = NameDictionary::kElementsStartIndex; index < length;
+    STATIC_ASSERT(NameDictionary::kElementsStartIndex ==
+                  NameDictionary::kEnumKeysCacheIndex + 1);
+    for (int index = NameDictionary::kEnumKeysCacheIndex; index < length;
          index++) {
       a.Store(AccessBuilder::ForFixedArraySlot(index, kNoWriteBarrier),
               undefined);
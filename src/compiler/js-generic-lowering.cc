@@ -854,8 +854,14 @@ void JSGenericLowering::LowerJSStackCheck(Node* node) {
     }
   }
 
-  // Turn the stack check into a runtime call.
-  ReplaceWithRuntimeCall(node, Runtime::kStackGuard);
+  // Turn the stack check into a runtime call. Stack checks in iteration
+  // bodies only need to handle interrupts, which cannot throw catchable
+  // exceptions.
+  if (StackCheckKindOf(node->op()) == StackCheckKind::kJSIterationBody) {
+    ReplaceWithRuntimeCall(node, Runtime::kInterrupt);
+  } else {
+    ReplaceWithRuntimeCall(node, Runtime::kStackGuard);
+  }
 }
 
 void JSGenericLowering::LowerJSDebugger(Node* node) {
@@ -1017,14 +1017,17 @@ void FixedDoubleArrayData::SerializeContents(JSHeapBroker* broker) {
 class BytecodeArrayData : public FixedArrayBaseData {
  public:
   int register_count() const { return register_count_; }
+  bool has_inlining_hint() const { return has_inlining_hint_; }
 
   BytecodeArrayData(JSHeapBroker* broker, ObjectData** storage,
                     Handle<BytecodeArray> object)
       : FixedArrayBaseData(broker, storage, object),
-        register_count_(object->register_count()) {}
+        register_count_(object->register_count()),
+        has_inlining_hint_(object->has_inlining_hint()) {}
 
  private:
   int const register_count_;
+  bool const has_inlining_hint_;
 };
 
 class JSArrayData : public JSObjectData {
@@ -2113,6 +2116,7 @@ BIMODAL_ACCESSOR_C(AllocationSite, ElementsKind, GetElementsKind)
 BIMODAL_ACCESSOR_C(AllocationSite, PretenureFlag, GetPretenureMode)
 
 BIMODAL_ACCESSOR_C(BytecodeArray, int, register_count)
+BIMODAL_ACCESSOR_C(BytecodeArray, bool, has_inlining_hint)
 
 BIMODAL_ACCESSOR(Cell, Object, value)
 
@@ -2176,6 +2180,22 @@ BROKER_SFI_FIELDS(DEF_SFI_ACCESSOR)
 
 BIMODAL_ACCESSOR_C(String, int, length)
 
+bool SharedFunctionInfoRef::IsInlineable() const {
+  // Built-in functions are handled by the JSCallReducer.
+  if (HasBuiltinFunctionId()) return false;
+
+  // Only choose user code for inlining.
+  if (!IsUserJavaScript()) return false;
+
+  // If there is no bytecode array, it is either not compiled or it is compiled
+  // with WebAssembly for the asm.js pipeline. In either case we don't want to
+  // inline.
+  if (!HasBytecodeArray()) return false;
+
+  // Quick check on the size of the bytecode to avoid inlining large functions.
+  return GetBytecodeArray().length() <= FLAG_max_inlined_bytecode_size;
+}
+
 void* JSTypedArrayRef::elements_external_pointer() const {
   if (broker()->mode() == JSHeapBroker::kDisabled) {
     AllowHandleDereference allow_handle_dereference;
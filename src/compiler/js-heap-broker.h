@@ -485,6 +485,7 @@ class BytecodeArrayRef : public FixedArrayBaseRef {
   Handle<BytecodeArray> object() const;
 
   int register_count() const;
+  bool has_inlining_hint() const;
 };
 
 class JSArrayRef : public JSObjectRef {
@@ -512,6 +513,7 @@ class ScopeInfoRef : public HeapObjectRef {
   V(bool, native)                           \
   V(bool, HasBreakInfo)                     \
   V(bool, HasBuiltinFunctionId)             \
+  V(bool, IsUserJavaScript)                 \
   V(bool, HasBuiltinId)                     \
   V(BuiltinFunctionId, builtin_function_id) \
   V(bool, construct_as_builtin)             \
@@ -527,6 +529,10 @@ class SharedFunctionInfoRef : public HeapObjectRef {
 #define DECL_ACCESSOR(type, name) type name() const;
   BROKER_SFI_FIELDS(DECL_ACCESSOR)
 #undef DECL_ACCESSOR
+
+  // Whether the function qualifies for inlining. Only uses serialized data,
+  // so inlining decisions do not need to access the heap.
+  bool IsInlineable() const;
 };
 
 class StringRef : public NameRef {
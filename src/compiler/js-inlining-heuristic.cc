@@ -60,32 +60,20 @@ int CollectFunctions(Node* node, Handle<JSFunction>* functions,
   return 0;
 }
 
-bool CanInlineFunction(Handle<SharedFunctionInfo> shared,
+bool CanInlineFunction(SharedFunctionInfoRef shared,
                        Handle<BytecodeArray> bytecode) {
-  // Built-in functions are handled by the JSCallReducer.
-  if (shared->HasBuiltinFunctionId()) return false;
-
-  // Only choose user code for inlining.
-  if (!shared->IsUserJavaScript()) return false;
-
-  // If there is no bytecode array, it is either not compiled or it is compiled
-  // with WebAssembly for the asm.js pipeline. In either case we don't want to
-  // inline.
+  // The bytecode is held strongly by the candidate, so a function that was
+  // not compiled when collecting the candidates is never inlined.
   if (bytecode.is_null()) return false;
-
-  // Quick check on the size of the bytecode to avoid inlining large functions.
-  if (bytecode->length() > FLAG_max_inlined_bytecode_size) {
-    return false;
-  }
-
-  return true;
+  return shared.IsInlineable();
 }
 
-bool IsSmallInlineFunction(Handle<BytecodeArray> bytecode) {
+bool IsSmallInlineFunction(JSHeapBroker* broker,
+                           Handle<BytecodeArray> bytecode) {
   // Forcibly inline small functions.
   // Don't forcibly inline functions that weren't compiled yet.
-  if (!bytecode.is_null() &&
-      bytecode->length() <= FLAG_max_inlined_bytecode_size_small) {
+  if (!bytecode.is_null() && BytecodeArrayRef(broker, bytecode).length() <=
+                                 FLAG_max_inlined_bytecode_size_small) {
     return true;
   }
   return false;
@@ -119,6 +107,7 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
 
   bool can_inline = false, small_inline = true;
   candidate.total_size = 0;
+  candidate.inlined_before = FLAG_code_cache_optimization_hints;
   Node* frame_state = NodeProperties::GetFrameStateInput(node);
   FrameStateInfo const& frame_info = FrameStateInfoOf(frame_state->op());
   Handle<SharedFunctionInfo> frame_shared_info;
@@ -128,7 +117,8 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
             ? candidate.shared_info
             : handle(candidate.functions[i]->shared(), isolate());
     Handle<BytecodeArray> bytecode = candidate.bytecode[i];
-    candidate.can_inline_function[i] = CanInlineFunction(shared, bytecode);
+    candidate.can_inline_function[i] =
+        CanInlineFunction(SharedFunctionInfoRef(broker(), shared), bytecode);
     // Do not allow direct recursion i.e. f() -> f(). We still allow indirect
     // recurion like f() -> g() -> f(). The indirect recursion is helpful in
     // cases where f() is a small dispatch function that calls the appropriate
@@ -146,9 +136,11 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
     }
     if (candidate.can_inline_function[i]) {
       can_inline = true;
-      candidate.total_size += bytecode->length();
+      BytecodeArrayRef bytecode_ref(broker(), bytecode);
+      candidate.total_size += bytecode_ref.length();
+      if (!bytecode_ref.has_inlining_hint()) candidate.inlined_before = false;
     }
-    if (!IsSmallInlineFunction(bytecode)) {
+    if (!IsSmallInlineFunction(broker(), bytecode)) {
       small_inline = false;
     }
   }
@@ -177,9 +169,11 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
 
   // Don't consider a {candidate} whose frequency is below the
   // threshold, i.e. a call site that is only hit once every N
-  // invocations of the caller.
+  // invocations of the caller. Functions inlined in a previous run are
+  // still considered, as the feedback of an early optimization is sparse.
   if (candidate.frequency.IsKnown() &&
-      candidate.frequency.value() < FLAG_min_inlining_frequency) {
+      candidate.frequency.value() < FLAG_min_inlining_frequency &&
+      !candidate.inlined_before) {
     return NoChange();
   }
 
@@ -698,6 +692,10 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
 
 bool JSInliningHeuristic::CandidateCompare::operator()(
     const Candidate& left, const Candidate& right) const {
+  // Functions inlined in a previous run get the budget first.
+  if (left.inlined_before != right.inlined_before) {
+    return left.inlined_before;
+  }
   if (right.frequency.IsUnknown()) {
     if (left.frequency.IsUnknown()) {
       // If left and right are both unknown then the ordering is indeterminate,
@@ -723,7 +721,8 @@ void JSInliningHeuristic::PrintCandidates() {
   for (const Candidate& candidate : candidates_) {
     os << "  #" << candidate.node->id() << ":"
        << candidate.node->op()->mnemonic()
-       << ", frequency: " << candidate.frequency << std::endl;
+       << ", frequency: " << candidate.frequency
+       << (candidate.inlined_before ? ", inlined before" : "") << std::endl;
     for (int i = 0; i < candidate.num_functions; ++i) {
       Handle<SharedFunctionInfo> shared =
           candidate.functions[i].is_null()
@@ -24,7 +24,8 @@ class JSInliningHeuristic final : public AdvancedReducer {
         candidates_(local_zone),
         seen_(local_zone),
         source_positions_(source_positions),
-        jsgraph_(jsgraph) {}
+        jsgraph_(jsgraph),
+        broker_(broker) {}
 
   const char* reducer_name() const override { return "JSInliningHeuristic"; }
 
@@ -56,6 +57,9 @@ class JSInliningHeuristic final : public AdvancedReducer {
     Node* node = nullptr;     // The call site at which to inline.
     CallFrequency frequency;  // Relative frequency of this call site.
     int total_size = 0;
+    // Whether the functions were inlined into optimized code in a previous
+    // run, according to the hints restored from the code cache.
+    bool inlined_before = false;
   };
 
   // Comparator for candidates.
@@ -85,6 +89,7 @@ class JSInliningHeuristic final : public AdvancedReducer {
   Graph* graph() const;
   JSGraph* jsgraph() const { return jsgraph_; }
   Isolate* isolate() const { return jsgraph_->isolate(); }
+  JSHeapBroker* broker() const { return broker_; }
   SimplifiedOperatorBuilder* simplified() const;
 
   Mode const mode_;
@@ -93,6 +98,7 @@ class JSInliningHeuristic final : public AdvancedReducer {
   ZoneSet<NodeId> seen_;
   SourcePositionTable* source_positions_;
   JSGraph* const jsgraph_;
+  JSHeapBroker* const broker_;
   int cumulative_count_ = 0;
 };
 
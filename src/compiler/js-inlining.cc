@@ -493,6 +493,9 @@ Reduction JSInliner::ReduceJSCall(Node* node) {
     if (info_->is_bailout_on_uninitialized()) {
       flags |= JSTypeHintLowering::kBailoutOnUninitialized;
     }
+    if (info_->is_conservative_speculation()) {
+      flags |= JSTypeHintLowering::kConservativeSpeculation;
+    }
     CallFrequency frequency = call.frequency();
     BytecodeGraphBuilder graph_builder(
         zone(), bytecode_array, shared_info, feedback_vector, BailoutId::None(),
@@ -995,10 +995,16 @@ Reduction JSNativeContextSpecialization::ReduceJSLoadGlobal(Node* node) {
         contents.AsHeapObject().map().oddball_type() == OddballType::kHole) {
       return NoChange();
     }
+    if (result->immutable) {
+      // An initialized script-level const never changes, so the load is a
+      // constant and doesn't need to stay on the effect chain.
+      Node* value = jsgraph()->Constant(contents);
+      ReplaceWithValue(node, value);
+      return Replace(value);
+    }
     Node* context = jsgraph()->Constant(result->context);
     Node* value = effect = graph()->NewNode(
-        javascript()->LoadContext(0, result->index, result->immutable), context,
-        effect);
+        javascript()->LoadContext(0, result->index, false), context, effect);
     ReplaceWithValue(node, value, effect);
     return Replace(value);
   }
@@ -1066,6 +1072,10 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
                                   index);
       }
     }
+    if (receiver_map->IsJSProxyMap()) {
+      return ReduceProxyAccess(node, value, receiver_map, name, access_mode,
+                               index);
+    }
   }
 
   // Compute property access infos for the receiver maps.
@@ -1305,6 +1315,75 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
   return Replace(value);
 }
 
+Reduction JSNativeContextSpecialization::ReduceProxyAccess(
+    Node* node, Node* value, Handle<Map> receiver_map, Handle<Name> name,
+    AccessMode access_mode, Node* index) {
+  DCHECK(receiver_map->IsJSProxyMap());
+  // Private symbols are never forwarded to the proxy handler.
+  if (name->IsPrivate()) return NoChange();
+  if (access_mode != AccessMode::kLoad && access_mode != AccessMode::kStore) {
+    return NoChange();
+  }
+  if (node->opcode() == IrOpcode::kJSStoreNamedOwn) return NoChange();
+
+  Node* receiver = NodeProperties::GetValueInput(node, 0);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+
+  // Check that {receiver} is a JSProxy with the expected map.
+  PropertyAccessBuilder access_builder(jsgraph(), broker(), dependencies());
+  receiver = access_builder.BuildCheckHeapObject(receiver, &effect, control);
+  access_builder.BuildCheckMaps(receiver, &effect, control,
+                                std::vector<Handle<Map>>{receiver_map});
+
+  // Ensure that {index} matches the specified {name} (if {index} is given).
+  if (index != nullptr) {
+    effect = BuildCheckEqualsName(name, index, effect, control);
+  }
+
+  LanguageMode language_mode = LanguageMode::kSloppy;
+  if (node->opcode() == IrOpcode::kJSStoreNamed) {
+    language_mode = NamedAccessOf(node->op()).language_mode();
+  } else if (node->opcode() == IrOpcode::kJSStoreProperty) {
+    language_mode = PropertyAccessOf(node->op()).language_mode();
+  }
+
+  // Call the proxy builtins directly instead of going through the IC
+  // dispatch. They invoke the handler trap, or forward to the target if
+  // the handler doesn't have one.
+  NodeProperties::ReplaceEffectInput(node, effect);
+  for (int i = node->op()->ValueInputCount() - 1; i > 0; --i) {
+    node->RemoveInput(i);
+  }
+  Callable callable = Builtins::CallableFor(
+      isolate(), access_mode == AccessMode::kLoad
+                     ? Builtins::kProxyGetProperty
+                     : Builtins::kProxySetProperty);
+  node->InsertInput(graph()->zone(), 0,
+                    jsgraph()->HeapConstant(callable.code()));
+  node->ReplaceInput(1, receiver);
+  node->InsertInput(graph()->zone(), 2, jsgraph()->Constant(name));
+  if (access_mode == AccessMode::kLoad) {
+    node->InsertInput(graph()->zone(), 3, receiver);
+    node->InsertInput(
+        graph()->zone(), 4,
+        jsgraph()->SmiConstant(
+            static_cast<int>(OnNonExistent::kReturnUndefined)));
+  } else {
+    node->InsertInput(graph()->zone(), 3, value);
+    node->InsertInput(graph()->zone(), 4, receiver);
+    node->InsertInput(
+        graph()->zone(), 5,
+        jsgraph()->SmiConstant(static_cast<int>(language_mode)));
+  }
+  auto call_descriptor = Linkage::GetStubCallDescriptor(
+      graph()->zone(), callable.descriptor(),
+      callable.descriptor().GetStackParameterCount(),
+      CallDescriptor::kNeedsFrameState);
+  NodeProperties::ChangeOp(node, common()->Call(call_descriptor));
+  return Changed(node);
+}
+
 Reduction JSNativeContextSpecialization::ReduceNamedAccessFromNexus(
     Node* node, Node* value, FeedbackNexus const& nexus, Handle<Name> name,
     AccessMode access_mode) {
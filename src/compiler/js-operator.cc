@@ -578,6 +578,23 @@ ForInMode ForInModeOf(Operator const* op) {
   return OpParameter<ForInMode>(op);
 }
 
+size_t hash_value(StackCheckKind kind) { return static_cast<uint8_t>(kind); }
+
+std::ostream& operator<<(std::ostream& os, StackCheckKind kind) {
+  switch (kind) {
+    case StackCheckKind::kJSFunctionEntry:
+      return os << "JSFunctionEntry";
+    case StackCheckKind::kJSIterationBody:
+      return os << "JSIterationBody";
+  }
+  UNREACHABLE();
+}
+
+StackCheckKind StackCheckKindOf(Operator const* op) {
+  DCHECK_EQ(IrOpcode::kJSStackCheck, op->opcode());
+  return OpParameter<StackCheckKind>(op);
+}
+
 BinaryOperationHint BinaryOperationHintOf(const Operator* op) {
   DCHECK_EQ(IrOpcode::kJSAdd, op->opcode());
   return OpParameter<BinaryOperationHint>(op);
@@ -636,7 +653,6 @@ CompareOperationHint CompareOperationHintOf(const Operator* op) {
   V(GeneratorRestoreContinuation, Operator::kNoThrow, 1, 1)              \
   V(GeneratorRestoreContext, Operator::kNoThrow, 1, 1)                   \
   V(GeneratorRestoreInputOrDebugPos, Operator::kNoThrow, 1, 1)           \
-  V(StackCheck, Operator::kNoWrite, 0, 0)                                \
   V(Debugger, Operator::kNoProperties, 0, 0)                             \
   V(FulfillPromise, Operator::kNoDeopt | Operator::kNoThrow, 2, 1)       \
   V(PerformPromiseThen, Operator::kNoDeopt | Operator::kNoThrow, 4, 1)   \
@@ -1001,6 +1017,19 @@ const Operator* JSOperatorBuilder::GeneratorRestoreRegister(int index) {
       index);                                                     // parameter
 }
 
+const Operator* JSOperatorBuilder::StackCheck(StackCheckKind kind) {
+  Operator::Properties properties = Operator::kNoWrite;
+  if (kind == StackCheckKind::kJSIterationBody) {
+    properties |= Operator::kNoThrow;
+  }
+  size_t control_output_count = Operator::ZeroIfNoThrow(properties);
+  return new (zone()) Operator1<StackCheckKind>(  // --
+      IrOpcode::kJSStackCheck, properties,        // opcode
+      "JSStackCheck",                             // name
+      0, 1, 1, 0, 1, control_output_count,        // counts
+      kind);                                      // parameter
+}
+
 int RestoreRegisterIndexOf(const Operator* op) {
   DCHECK_EQ(IrOpcode::kJSGeneratorRestoreRegister, op->opcode());
   return OpParameter<int>(op);
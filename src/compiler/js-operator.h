@@ -663,6 +663,17 @@ std::ostream& operator<<(std::ostream&, ForInMode);
 
 ForInMode ForInModeOf(Operator const* op) V8_WARN_UNUSED_RESULT;
 
+// Descriptor used by the JSStackCheck opcode. Stack checks in iteration
+// bodies run in a frame that the function entry check already accounted
+// for, so they only handle interrupts and never throw catchable exceptions.
+enum class StackCheckKind : uint8_t { kJSFunctionEntry, kJSIterationBody };
+
+size_t hash_value(StackCheckKind);
+
+std::ostream& operator<<(std::ostream&, StackCheckKind);
+
+StackCheckKind StackCheckKindOf(Operator const* op) V8_WARN_UNUSED_RESULT;
+
 BinaryOperationHint BinaryOperationHintOf(const Operator* op);
 
 CompareOperationHint CompareOperationHintOf(const Operator* op);
@@ -834,7 +845,8 @@ class V8_EXPORT_PRIVATE JSOperatorBuilder final
   const Operator* GeneratorRestoreRegister(int index);
   const Operator* GeneratorRestoreInputOrDebugPos();
 
-  const Operator* StackCheck();
+  const Operator* StackCheck(
+      StackCheckKind kind = StackCheckKind::kJSFunctionEntry);
   const Operator* Debugger();
 
   const Operator* FulfillPromise();
@@ -70,14 +70,19 @@ class JSSpeculativeBinopBuilder final {
   }
 
   bool GetBinaryNumberOperationHint(NumberOperationHint* hint) {
-    return BinaryOperationHintToNumberOperationHint(GetBinaryOperationHint(),
-                                                    hint);
+    if (!BinaryOperationHintToNumberOperationHint(GetBinaryOperationHint(),
+                                                  hint)) {
+      return false;
+    }
+    GeneralizeNumberOperationHint(hint);
+    return true;
   }
 
   bool GetCompareNumberOperationHint(NumberOperationHint* hint) {
     switch (GetCompareOperationHint()) {
       case CompareOperationHint::kSignedSmall:
         *hint = NumberOperationHint::kSignedSmall;
+        GeneralizeNumberOperationHint(hint);
         return true;
       case CompareOperationHint::kNumber:
         *hint = NumberOperationHint::kNumber;
@@ -98,6 +103,23 @@ class JSSpeculativeBinopBuilder final {
     return false;
   }
 
+  // Widen small integer hints to numbers under conservative speculation.
+  void GeneralizeNumberOperationHint(NumberOperationHint* hint) {
+    if (!(lowering_->flags() & JSTypeHintLowering::kConservativeSpeculation)) {
+      return;
+    }
+    switch (*hint) {
+      case NumberOperationHint::kSignedSmall:
+      case NumberOperationHint::kSignedSmallInputs:
+      case NumberOperationHint::kSigned32:
+        *hint = NumberOperationHint::kNumber;
+        break;
+      case NumberOperationHint::kNumber:
+      case NumberOperationHint::kNumberOrOddball:
+        break;
+    }
+  }
+
   const Operator* SpeculativeNumberOp(NumberOperationHint hint) {
     switch (op_->opcode()) {
       case IrOpcode::kJSAdd:
@@ -38,7 +38,13 @@ class Operator;
 class JSTypeHintLowering {
  public:
   // Flags that control the mode of operation.
-  enum Flag { kNoFlags = 0u, kBailoutOnUninitialized = 1u << 1 };
+  enum Flag {
+    kNoFlags = 0u,
+    kBailoutOnUninitialized = 1u << 1,
+    // Treat small integer feedback as number feedback, to avoid repeated
+    // overflow and minus zero deoptimizations.
+    kConservativeSpeculation = 1u << 2
+  };
   typedef base::Flags<Flag> Flags;
 
   JSTypeHintLowering(JSGraph* jsgraph, Handle<FeedbackVector> feedback_vector,
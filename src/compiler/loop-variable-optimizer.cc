@@ -4,6 +4,7 @@
 
 #include "src/compiler/loop-variable-optimizer.h"
 
+#include "src/compiler/all-nodes.h"
 #include "src/compiler/common-operator.h"
 #include "src/compiler/graph.h"
 #include "src/compiler/node-marker.h"
@@ -345,6 +346,46 @@ void LoopVariableOptimizer::ChangeToPhisAndInsertGuards() {
   }
 }
 
+bool LoopVariableOptimizer::IsKnownLessThan(Node* control, Node* left,
+                                            Node* right) {
+  if (!reduced_.Get(control)) return false;
+  for (Constraint constraint : limits_.Get(control)) {
+    if (constraint.left == left && constraint.right == right &&
+        constraint.kind == InductionVariable::kStrict) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void LoopVariableOptimizer::EliminateRedundantBoundsChecks() {
+  AllNodes all(zone(), graph());
+  for (Node* node : all.reachable) {
+    if (node->opcode() != IrOpcode::kCheckBounds) continue;
+    Node* index = NodeProperties::GetValueInput(node, 0);
+    Node* length = NodeProperties::GetValueInput(node, 1);
+    if (FindInductionVariable(index) == nullptr) continue;
+    // The constraint compares numbers, so {index} must not be NaN or -0 for
+    // it to imply the bounds check.
+    Type index_type = NodeProperties::GetType(index);
+    if (!index_type.Is(Type::Unsigned32()) ||
+        !NodeProperties::GetType(length).Is(Type::Number())) {
+      continue;
+    }
+    if (!IsKnownLessThan(NodeProperties::GetControlInput(node), index,
+                         length)) {
+      continue;
+    }
+    TRACE("Eliminating bounds check %i for induction variable %i\n",
+          node->id(), index->id());
+    // Keep the narrowed type of the check so that the element access still
+    // sees an in-bounds index.
+    Type type = NodeProperties::GetType(node);
+    node->RemoveInput(1);
+    NodeProperties::ChangeOp(node, common()->TypeGuard(type));
+  }
+}
+
 #undef TRACE
 
 }  // namespace compiler
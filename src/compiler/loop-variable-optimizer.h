@@ -80,6 +80,12 @@ class LoopVariableOptimizer {
   void ChangeToInductionVariablePhis();
   void ChangeToPhisAndInsertGuards();
 
+  // Turns CheckBounds(index, length) into a TypeGuard if {index} is a
+  // non-negative integer induction variable and a branch dominating the check
+  // already established {index} < {length}. Requires a typed graph and must
+  // run after Run().
+  void EliminateRedundantBoundsChecks();
+
  private:
   const int kAssumedLoopEntryIndex = 0;
   const int kFirstBackedge = 1;
@@ -112,6 +118,7 @@ class LoopVariableOptimizer {
   const InductionVariable* FindInductionVariable(Node* node);
   InductionVariable* TryGetInductionVariable(Node* phi);
   void DetectInductionVariables(Node* loop);
+  bool IsKnownLessThan(Node* control, Node* left, Node* right);
 
   Graph* graph() { return graph_; }
   CommonOperatorBuilder* common() { return common_; }
@@ -362,94 +362,96 @@
 
 #define SIMPLIFIED_SPECULATIVE_NUMBER_UNOP_LIST(V) V(SpeculativeToNumber)
 
-#define SIMPLIFIED_OTHER_OP_LIST(V)     \
-  V(PlainPrimitiveToNumber)             \
-  V(PlainPrimitiveToWord32)             \
-  V(PlainPrimitiveToFloat64)            \
-  V(BooleanNot)                         \
-  V(StringConcat)                       \
-  V(StringToNumber)                     \
-  V(StringCharCodeAt)                   \
-  V(StringCodePointAt)                  \
-  V(StringFromSingleCharCode)           \
-  V(StringFromSingleCodePoint)          \
-  V(StringIndexOf)                      \
-  V(StringLength)                       \
-  V(StringToLowerCaseIntl)              \
-  V(StringToUpperCaseIntl)              \
-  V(StringSubstring)                    \
-  V(CheckBounds)                        \
-  V(CheckIf)                            \
-  V(CheckMaps)                          \
-  V(CheckNumber)                        \
-  V(CheckInternalizedString)            \
-  V(CheckReceiver)                      \
-  V(CheckReceiverOrNullOrUndefined)     \
-  V(CheckString)                        \
-  V(CheckSymbol)                        \
-  V(CheckSmi)                           \
-  V(CheckHeapObject)                    \
-  V(CheckFloat64Hole)                   \
-  V(CheckNotTaggedHole)                 \
-  V(CheckEqualsInternalizedString)      \
-  V(CheckEqualsSymbol)                  \
-  V(CompareMaps)                        \
-  V(ConvertReceiver)                    \
-  V(ConvertTaggedHoleToUndefined)       \
-  V(TypeOf)                             \
-  V(Allocate)                           \
-  V(AllocateRaw)                        \
-  V(LoadFieldByIndex)                   \
-  V(LoadField)                          \
-  V(LoadElement)                        \
-  V(LoadTypedElement)                   \
-  V(LoadDataViewElement)                \
-  V(StoreField)                         \
-  V(StoreElement)                       \
-  V(StoreTypedElement)                  \
-  V(StoreDataViewElement)               \
-  V(StoreSignedSmallElement)            \
-  V(TransitionAndStoreElement)          \
-  V(TransitionAndStoreNumberElement)    \
-  V(TransitionAndStoreNonNumberElement) \
-  V(ToBoolean)                          \
-  V(NumberIsFloat64Hole)                \
-  V(NumberIsFinite)                     \
-  V(ObjectIsFiniteNumber)               \
-  V(NumberIsInteger)                    \
-  V(ObjectIsSafeInteger)                \
-  V(NumberIsSafeInteger)                \
-  V(ObjectIsInteger)                    \
-  V(ObjectIsArrayBufferView)            \
-  V(ObjectIsBigInt)                     \
-  V(ObjectIsCallable)                   \
-  V(ObjectIsConstructor)                \
-  V(ObjectIsDetectableCallable)         \
-  V(ObjectIsMinusZero)                  \
-  V(NumberIsMinusZero)                  \
-  V(ObjectIsNaN)                        \
-  V(NumberIsNaN)                        \
-  V(ObjectIsNonCallable)                \
-  V(ObjectIsNumber)                     \
-  V(ObjectIsReceiver)                   \
-  V(ObjectIsSmi)                        \
-  V(ObjectIsString)                     \
-  V(ObjectIsSymbol)                     \
-  V(ObjectIsUndetectable)               \
-  V(ArgumentsFrame)                     \
-  V(ArgumentsLength)                    \
-  V(NewDoubleElements)                  \
-  V(NewSmiOrObjectElements)             \
-  V(NewArgumentsElements)               \
-  V(NewConsString)                      \
-  V(DelayedStringConstant)              \
-  V(EnsureWritableFastElements)         \
-  V(MaybeGrowFastElements)              \
-  V(TransitionElementsKind)             \
-  V(FindOrderedHashMapEntry)            \
-  V(FindOrderedHashMapEntryForInt32Key) \
-  V(PoisonIndex)                        \
-  V(RuntimeAbort)                       \
+#define SIMPLIFIED_OTHER_OP_LIST(V)      \
+  V(PlainPrimitiveToNumber)              \
+  V(PlainPrimitiveToWord32)              \
+  V(PlainPrimitiveToFloat64)             \
+  V(BooleanNot)                          \
+  V(StringConcat)                        \
+  V(StringToNumber)                      \
+  V(StringCharCodeAt)                    \
+  V(StringCodePointAt)                   \
+  V(StringFromSingleCharCode)            \
+  V(StringFromSingleCodePoint)           \
+  V(StringIndexOf)                       \
+  V(StringLength)                        \
+  V(StringToLowerCaseIntl)               \
+  V(StringToUpperCaseIntl)               \
+  V(StringSubstring)                     \
+  V(CheckBounds)                         \
+  V(CheckIf)                             \
+  V(CheckMaps)                           \
+  V(CheckNumber)                         \
+  V(CheckInternalizedString)             \
+  V(CheckReceiver)                       \
+  V(CheckReceiverOrNullOrUndefined)      \
+  V(CheckString)                         \
+  V(CheckSymbol)                         \
+  V(CheckSmi)                            \
+  V(CheckHeapObject)                     \
+  V(CheckFloat64Hole)                    \
+  V(CheckNotTaggedHole)                  \
+  V(CheckEqualsInternalizedString)       \
+  V(CheckEqualsSymbol)                   \
+  V(CompareMaps)                         \
+  V(ConvertReceiver)                     \
+  V(ConvertTaggedHoleToUndefined)        \
+  V(TypeOf)                              \
+  V(Allocate)                            \
+  V(AllocateRaw)                         \
+  V(LoadFieldByIndex)                    \
+  V(LoadField)                           \
+  V(LoadElement)                         \
+  V(LoadTypedElement)                    \
+  V(LoadDataViewElement)                 \
+  V(StoreField)                          \
+  V(StoreElement)                        \
+  V(StoreTypedElement)                   \
+  V(StoreDataViewElement)                \
+  V(StoreSignedSmallElement)             \
+  V(TransitionAndStoreElement)           \
+  V(TransitionAndStoreNumberElement)     \
+  V(TransitionAndStoreNonNumberElement)  \
+  V(ToBoolean)                           \
+  V(NumberIsFloat64Hole)                 \
+  V(NumberIsFinite)                      \
+  V(ObjectIsFiniteNumber)                \
+  V(NumberIsInteger)                     \
+  V(ObjectIsSafeInteger)                 \
+  V(NumberIsSafeInteger)                 \
+  V(ObjectIsInteger)                     \
+  V(ObjectIsArrayBufferView)             \
+  V(ObjectIsBigInt)                      \
+  V(ObjectIsCallable)                    \
+  V(ObjectIsConstructor)                 \
+  V(ObjectIsDetectableCallable)          \
+  V(ObjectIsMinusZero)                   \
+  V(NumberIsMinusZero)                   \
+  V(ObjectIsNaN)                         \
+  V(NumberIsNaN)                         \
+  V(ObjectIsNonCallable)                 \
+  V(ObjectIsNumber)                      \
+  V(ObjectIsReceiver)                    \
+  V(ObjectIsSmi)                         \
+  V(ObjectIsString)                      \
+  V(ObjectIsSymbol)                      \
+  V(ObjectIsUndetectable)                \
+  V(ArgumentsFrame)                      \
+  V(ArgumentsLength)                     \
+  V(NewDoubleElements)                   \
+  V(NewSmiOrObjectElements)              \
+  V(NewArgumentsElements)                \
+  V(NewConsString)                       \
+  V(DelayedStringConstant)               \
+  V(EnsureWritableFastElements)          \
+  V(MaybeGrowFastElements)               \
+  V(TransitionElementsKind)              \
+  V(FindOrderedHashMapEntry)             \
+  V(FindOrderedHashMapEntryForInt32Key)  \
+  V(FindOrderedHashMapEntryForStringKey) \
+  V(FindWeakMapEntry)                    \
+  V(PoisonIndex)                         \
+  V(RuntimeAbort)                        \
   V(DateNow)
 
 #define SIMPLIFIED_OP_LIST(V)                 \
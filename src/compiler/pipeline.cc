@@ -398,11 +398,12 @@ class PipelineData {
   }
 
   void InitializeRegisterAllocationData(const RegisterConfiguration* config,
-                                        CallDescriptor* call_descriptor) {
+                                        CallDescriptor* call_descriptor,
+                                        bool is_fast_mode) {
     DCHECK_NULL(register_allocation_data_);
     register_allocation_data_ = new (register_allocation_zone())
         RegisterAllocationData(config, register_allocation_zone(), frame(),
-                               sequence(), debug_name());
+                               sequence(), is_fast_mode, debug_name());
   }
 
   void InitializeOsrHelper() {
@@ -899,10 +900,33 @@ PipelineCompilationJob::Status PipelineCompilationJob::PrepareJobImpl(
   if (!FLAG_always_opt) {
     compilation_info()->MarkAsBailoutOnUninitialized();
   }
-  if (FLAG_turbo_loop_peeling) {
+  if (compilation_info()->closure()->feedback_vector()
+          ->has_conservative_speculation()) {
+    compilation_info()->MarkAsConservativeSpeculation();
+    if (FLAG_trace_opt) {
+      StdoutStream{} << "[using conservative speculation for "
+                     << compilation_info()->GetDebugName().get() << "]"
+                     << std::endl;
+    }
+  }
+  // Huge functions spend most of their compile time in phases whose cost grows
+  // faster than the graph, so trade some code quality for compile time.
+  if (FLAG_turbo_fast_pipeline_bytecode_size > 0 &&
+      compilation_info()->bytecode_array()->length() >=
+          FLAG_turbo_fast_pipeline_bytecode_size) {
+    compilation_info()->MarkAsFastPipeline();
+    if (FLAG_trace_opt) {
+      StdoutStream{} << "[using fast TurboFan pipeline for "
+                     << compilation_info()->GetDebugName().get()
+                     << ", bytecode size "
+                     << compilation_info()->bytecode_array()->length() << "]"
+                     << std::endl;
+    }
+  }
+  if (FLAG_turbo_loop_peeling && !compilation_info()->is_fast_pipeline()) {
     compilation_info()->MarkAsLoopPeelingEnabled();
   }
-  if (FLAG_turbo_inlining) {
+  if (FLAG_turbo_inlining && !compilation_info()->is_fast_pipeline()) {
     compilation_info()->MarkAsInliningEnabled();
   }
   if (FLAG_inline_accessors) {
@@ -1030,6 +1054,9 @@ struct GraphBuilderPhase {
     if (data->info()->is_bailout_on_uninitialized()) {
       flags |= JSTypeHintLowering::kBailoutOnUninitialized;
     }
+    if (data->info()->is_conservative_speculation()) {
+      flags |= JSTypeHintLowering::kConservativeSpeculation;
+    }
     CallFrequency frequency = CallFrequency(1.0f);
     BytecodeGraphBuilder graph_builder(
         temp_zone, data->info()->bytecode_array(), data->info()->shared_info(),
@@ -1409,6 +1436,17 @@ struct StoreStoreEliminationPhase {
   }
 };
 
+struct BoundsCheckEliminationPhase {
+  static const char* phase_name() { return "bounds check elimination"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    LoopVariableOptimizer induction_vars(data->jsgraph()->graph(),
+                                         data->common(), temp_zone);
+    induction_vars.Run();
+    induction_vars.EliminateRedundantBoundsChecks();
+  }
+};
+
 struct LoadEliminationPhase {
   static const char* phase_name() { return "load elimination"; }
 
@@ -1975,13 +2013,21 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     RunPrintAndVerify(LoopExitEliminationPhase::phase_name(), true);
   }
 
-  if (FLAG_turbo_load_elimination) {
+  if (FLAG_turbo_load_elimination && !data->info()->is_fast_pipeline()) {
     Run<LoadEliminationPhase>();
     RunPrintAndVerify(LoadEliminationPhase::phase_name());
   }
+
+  // Runs after load elimination so that the loop condition and the element
+  // access refer to the same length node.
+  if (FLAG_turbo_loop_variable && FLAG_turbo_bounds_check_elimination &&
+      !data->info()->is_fast_pipeline()) {
+    Run<BoundsCheckEliminationPhase>();
+    RunPrintAndVerify(BoundsCheckEliminationPhase::phase_name());
+  }
   data->DeleteTyper();
 
-  if (FLAG_turbo_escape) {
+  if (FLAG_turbo_escape && !data->info()->is_fast_pipeline()) {
     Run<EscapeAnalysisPhase>();
     if (data->compilation_failed()) {
       info()->AbortOptimization(
@@ -2029,7 +2075,7 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
   }
 
   // Optimize control flow.
-  if (FLAG_turbo_cf_optimization) {
+  if (FLAG_turbo_cf_optimization && !data->info()->is_fast_pipeline()) {
     Run<ControlFlowOptimizationPhase>();
     RunPrintAndVerify(ControlFlowOptimizationPhase::phase_name(), true);
   }
@@ -2792,9 +2838,30 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
   data_->sequence()->ValidateDeferredBlockExitPaths();
 #endif
 
-  data->InitializeRegisterAllocationData(config, call_descriptor);
+  // The cost of finding interference grows with the number of live ranges
+  // times the number of inactive ranges, so very large code is allocated in
+  // the allocator's fast mode.
+  const bool fast_register_allocation =
+      FLAG_turbo_fast_register_allocation_size > 0 &&
+      data->sequence()->instructions().size() >=
+          static_cast<size_t>(FLAG_turbo_fast_register_allocation_size);
+  if (fast_register_allocation && FLAG_trace_opt) {
+    StdoutStream{} << "[using fast register allocation for "
+                   << info()->GetDebugName().get() << ", "
+                   << data->sequence()->instructions().size()
+                   << " instructions]" << std::endl;
+  }
+  data->InitializeRegisterAllocationData(config, call_descriptor,
+                                         fast_register_allocation);
   if (info()->is_osr()) data->osr_helper()->SetupFrame(data->frame());
 
+  // Splintering and move optimization improve the allocation but their cost
+  // grows with the number of live ranges, so the fast pipeline skips them.
+  const bool preprocess_ranges =
+      FLAG_turbo_preprocess_ranges && !info()->is_fast_pipeline();
+  const bool optimize_moves =
+      FLAG_turbo_move_optimization && !info()->is_fast_pipeline();
+
   Run<MeetRegisterConstraintsPhase>();
   Run<ResolvePhisPhase>();
   Run<BuildLiveRangesPhase>();
@@ -2811,7 +2878,7 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
                                        data->register_allocation_data());
   }
 
-  if (FLAG_turbo_preprocess_ranges) {
+  if (preprocess_ranges) {
     Run<SplinterLiveRangesPhase>();
     if (info()->trace_turbo_json_enabled() &&
         !data->MayHaveUnverifiableGraph()) {
@@ -2827,7 +2894,7 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
     Run<AllocateFPRegistersPhase<LinearScanAllocator>>();
   }
 
-  if (FLAG_turbo_preprocess_ranges) {
+  if (preprocess_ranges) {
     Run<MergeSplintersPhase>();
   }
 
@@ -2845,7 +2912,7 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
   Run<PopulateReferenceMapsPhase>();
   Run<ConnectRangesPhase>();
   Run<ResolveControlFlowPhase>();
-  if (FLAG_turbo_move_optimization) {
+  if (optimize_moves) {
     Run<OptimizeMovesPhase>();
   }
 
@@ -292,7 +292,8 @@ class RepresentationSelector {
         source_positions_(source_positions),
         node_origins_(node_origins),
         type_cache_(TypeCache::Get()),
-        op_typer_(broker, graph_zone()) {
+        op_typer_(broker, graph_zone()),
+        typed_state_values_(zone) {
   }
 
   // Forward propagation of types from type feedback.
@@ -1120,22 +1121,35 @@ class RepresentationSelector {
         EnqueueInput(node, i, UseInfo::Any());
       }
     } else if (lower()) {
-      Zone* zone = jsgraph_->zone();
-      ZoneVector<MachineType>* types =
-          new (zone->New(sizeof(ZoneVector<MachineType>)))
-              ZoneVector<MachineType>(node->InputCount(), zone);
+      ZoneVector<MachineType> types(node->InputCount(), zone());
       for (int i = 0; i < node->InputCount(); i++) {
         Node* input = node->InputAt(i);
-        (*types)[i] =
+        types[i] =
             DeoptMachineTypeOf(GetInfo(input)->representation(), TypeOf(input));
       }
       SparseInputMask mask = SparseInputMaskOf(node->op());
-      NodeProperties::ChangeOp(
-          node, jsgraph_->common()->TypedStateValues(types, mask));
+      NodeProperties::ChangeOp(node, TypedStateValuesFor(types, mask));
     }
     SetOutput(node, MachineRepresentation::kTagged);
   }
 
+  // Returns a TypedStateValues operator for {types} and {mask}. Large
+  // functions have many state values with identical types, so operators
+  // (and their type vectors) are shared instead of being allocated in the
+  // graph zone for every single node.
+  const Operator* TypedStateValuesFor(ZoneVector<MachineType> const& types,
+                                      SparseInputMask mask) {
+    auto it = typed_state_values_.find(TypedStateValueInfo(&types, mask));
+    if (it != typed_state_values_.end()) return it->second;
+    ZoneVector<MachineType>* copy =
+        new (graph_zone()->New(sizeof(ZoneVector<MachineType>)))
+            ZoneVector<MachineType>(types.begin(), types.end(), graph_zone());
+    const Operator* op = jsgraph_->common()->TypedStateValues(copy, mask);
+    typed_state_values_.insert(
+        std::make_pair(TypedStateValueInfo(copy, mask), op));
+    return op;
+  }
+
   void VisitFrameState(Node* node) {
     DCHECK_EQ(5, node->op()->ValueInputCount());
     DCHECK_EQ(1, OperatorProperties::GetFrameStateInputCount(node->op()));
@@ -1149,21 +1163,18 @@ class RepresentationSelector {
     if (propagate()) {
       EnqueueInput(node, 2, UseInfo::Any());
     } else if (lower()) {
-      Zone* zone = jsgraph_->zone();
       Node* accumulator = node->InputAt(2);
       if (accumulator == jsgraph_->OptimizedOutConstant()) {
         node->ReplaceInput(2, jsgraph_->SingleDeadTypedStateValues());
       } else {
-        ZoneVector<MachineType>* types =
-            new (zone->New(sizeof(ZoneVector<MachineType>)))
-                ZoneVector<MachineType>(1, zone);
-        (*types)[0] = DeoptMachineTypeOf(GetInfo(accumulator)->representation(),
-                                         TypeOf(accumulator));
+        ZoneVector<MachineType> types(1, zone());
+        types[0] = DeoptMachineTypeOf(GetInfo(accumulator)->representation(),
+                                      TypeOf(accumulator));
 
         node->ReplaceInput(
-            2, jsgraph_->graph()->NewNode(jsgraph_->common()->TypedStateValues(
-                                              types, SparseInputMask::Dense()),
-                                          accumulator));
+            2, jsgraph_->graph()->NewNode(
+                   TypedStateValuesFor(types, SparseInputMask::Dense()),
+                   accumulator));
       }
     }
 
@@ -3318,12 +3329,25 @@ class RepresentationSelector {
                 node,
                 lowering->simplified()->FindOrderedHashMapEntryForInt32Key());
           }
+        } else if (key_type.Is(Type::String())) {
+          VisitBinop(node, UseInfo::AnyTagged(),
+                     MachineType::PointerRepresentation());
+          if (lower()) {
+            NodeProperties::ChangeOp(
+                node,
+                lowering->simplified()->FindOrderedHashMapEntryForStringKey());
+          }
         } else {
           VisitBinop(node, UseInfo::AnyTagged(),
                      MachineRepresentation::kTaggedSigned);
         }
         return;
       }
+      case IrOpcode::kFindWeakMapEntry: {
+        VisitBinop(node, UseInfo::AnyTagged(),
+                   MachineRepresentation::kTaggedSigned);
+        return;
+      }
 
       // Operators with all inputs tagged and no or tagged output have uniform
       // handling.
@@ -3474,6 +3498,26 @@ class RepresentationSelector {
   TypeCache const& type_cache_;
   OperationTyper op_typer_;  // helper for the feedback typer
 
+  // Shared TypedStateValues operators, keyed by the contents of their
+  // machine type vectors rather than by their identity.
+  struct TypedStateValuesHash {
+    size_t operator()(TypedStateValueInfo const& info) const {
+      ZoneVector<MachineType> const* types = info.machine_types();
+      return base::hash_combine(base::hash_range(types->begin(), types->end()),
+                                info.sparse_input_mask());
+    }
+  };
+  struct TypedStateValuesEqual {
+    bool operator()(TypedStateValueInfo const& lhs,
+                    TypedStateValueInfo const& rhs) const {
+      return *lhs.machine_types() == *rhs.machine_types() &&
+             lhs.sparse_input_mask() == rhs.sparse_input_mask();
+    }
+  };
+  ZoneUnorderedMap<TypedStateValueInfo, const Operator*, TypedStateValuesHash,
+                   TypedStateValuesEqual>
+      typed_state_values_;
+
   NodeInfo* GetInfo(Node* node) {
     DCHECK(node->id() < count_);
     return &info_[node->id()];
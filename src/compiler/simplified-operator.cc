@@ -922,6 +922,22 @@ struct SimplifiedOperatorGlobalCache final {
   FindOrderedHashMapEntryForInt32KeyOperator
       kFindOrderedHashMapEntryForInt32Key;
 
+  struct FindOrderedHashMapEntryForStringKeyOperator final : public Operator {
+    FindOrderedHashMapEntryForStringKeyOperator()
+        : Operator(IrOpcode::kFindOrderedHashMapEntryForStringKey,
+                   Operator::kEliminatable,
+                   "FindOrderedHashMapEntryForStringKey", 2, 1, 1, 1, 1, 0) {}
+  };
+  FindOrderedHashMapEntryForStringKeyOperator
+      kFindOrderedHashMapEntryForStringKey;
+
+  struct FindWeakMapEntryOperator final : public Operator {
+    FindWeakMapEntryOperator()
+        : Operator(IrOpcode::kFindWeakMapEntry, Operator::kEliminatable,
+                   "FindWeakMapEntry", 2, 1, 1, 1, 1, 0) {}
+  };
+  FindWeakMapEntryOperator kFindWeakMapEntry;
+
   struct ArgumentsFrameOperator final : public Operator {
     ArgumentsFrameOperator()
         : Operator(IrOpcode::kArgumentsFrame, Operator::kPure, "ArgumentsFrame",
@@ -1165,6 +1181,8 @@ CHECKED_OP_LIST(GET_FROM_CACHE)
 GET_FROM_CACHE(ArgumentsFrame)
 GET_FROM_CACHE(FindOrderedHashMapEntry)
 GET_FROM_CACHE(FindOrderedHashMapEntryForInt32Key)
+GET_FROM_CACHE(FindOrderedHashMapEntryForStringKey)
+GET_FROM_CACHE(FindWeakMapEntry)
 GET_FROM_CACHE(LoadFieldByIndex)
 #undef GET_FROM_CACHE
 
@@ -632,6 +632,8 @@ class V8_EXPORT_PRIVATE SimplifiedOperatorBuilder final
 
   const Operator* FindOrderedHashMapEntry();
   const Operator* FindOrderedHashMapEntryForInt32Key();
+  const Operator* FindOrderedHashMapEntryForStringKey();
+  const Operator* FindWeakMapEntry();
 
   const Operator* SpeculativeToNumber(NumberOperationHint hint,
                                       const VectorSlotPair& feedback);
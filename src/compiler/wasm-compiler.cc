@@ -2642,16 +2642,13 @@ Node* WasmGraphBuilder::BuildCCall(MachineSignature* sig, Node* function,
   return SetEffect(graph()->NewNode(op, arraysize(call_args), call_args));
 }
 
-Node* WasmGraphBuilder::BuildWasmCall(wasm::FunctionSig* sig, Node** args,
-                                      Node*** rets,
+Node* WasmGraphBuilder::BuildCallNode(wasm::FunctionSig* sig, Node** args,
                                       wasm::WasmCodePosition position,
-                                      Node* instance_node,
-                                      UseRetpoline use_retpoline) {
+                                      Node* instance_node, const Operator* op) {
   if (instance_node == nullptr) {
     DCHECK_NOT_NULL(instance_node_);
     instance_node = instance_node_.get();
   }
-  needs_stack_check_ = true;
   const size_t params = sig->parameter_count();
   const size_t extra = 3;  // instance_node, effect, and control.
   const size_t count = 1 + params + extra;
@@ -2667,13 +2664,24 @@ Node* WasmGraphBuilder::BuildWasmCall(wasm::FunctionSig* sig, Node** args,
   args[params + 2] = Effect();
   args[params + 3] = Control();
 
-  auto call_descriptor =
-      GetWasmCallDescriptor(mcgraph()->zone(), sig, use_retpoline);
-  const Operator* op = mcgraph()->common()->Call(call_descriptor);
   Node* call = SetEffect(graph()->NewNode(op, static_cast<int>(count), args));
   DCHECK(position == wasm::kNoCodePosition || position > 0);
   if (position > 0) SetSourcePosition(call, position);
 
+  return call;
+}
+
+Node* WasmGraphBuilder::BuildWasmCall(wasm::FunctionSig* sig, Node** args,
+                                      Node*** rets,
+                                      wasm::WasmCodePosition position,
+                                      Node* instance_node,
+                                      UseRetpoline use_retpoline) {
+  needs_stack_check_ = true;
+  auto call_descriptor =
+      GetWasmCallDescriptor(mcgraph()->zone(), sig, use_retpoline);
+  const Operator* op = mcgraph()->common()->Call(call_descriptor);
+  Node* call = BuildCallNode(sig, args, position, instance_node, op);
+
   size_t ret_count = sig->return_count();
   if (ret_count == 0) return call;  // No return value.
 
@@ -2691,10 +2699,27 @@ Node* WasmGraphBuilder::BuildWasmCall(wasm::FunctionSig* sig, Node** args,
   return call;
 }
 
+Node* WasmGraphBuilder::BuildWasmReturnCall(wasm::FunctionSig* sig,
+                                            Node** args,
+                                            wasm::WasmCodePosition position,
+                                            Node* instance_node,
+                                            UseRetpoline use_retpoline) {
+  // The callee replaces the frame of the current function and returns
+  // directly to our caller, so there are no return values to project.
+  auto call_descriptor =
+      GetWasmCallDescriptor(mcgraph()->zone(), sig, use_retpoline);
+  const Operator* op = mcgraph()->common()->TailCall(call_descriptor);
+  Node* call = BuildCallNode(sig, args, position, instance_node, op);
+
+  MergeControlToEnd(mcgraph(), call);
+  return call;
+}
+
 Node* WasmGraphBuilder::BuildImportCall(wasm::FunctionSig* sig, Node** args,
                                         Node*** rets,
                                         wasm::WasmCodePosition position,
-                                        int func_index) {
+                                        int func_index,
+                                        IsReturnCall continuation) {
   // Load the imported function refs array from the instance.
   Node* imported_function_refs =
       LOAD_INSTANCE_FIELD(ImportedFunctionRefs, MachineType::TaggedPointer());
@@ -2709,8 +2734,12 @@ Node* WasmGraphBuilder::BuildImportCall(wasm::FunctionSig* sig, Node** args,
       mcgraph()->Int32Constant(func_index * kPointerSize), Effect(),
       Control()));
   args[0] = target_node;
-  return BuildWasmCall(sig, args, rets, position, ref_node,
-                       untrusted_code_mitigations_ ? kRetpoline : kNoRetpoline);
+  const UseRetpoline use_retpoline =
+      untrusted_code_mitigations_ ? kRetpoline : kNoRetpoline;
+  if (continuation == kReturnCall) {
+    return BuildWasmReturnCall(sig, args, position, ref_node, use_retpoline);
+  }
+  return BuildWasmCall(sig, args, rets, position, ref_node, use_retpoline);
 }
 
 Node* WasmGraphBuilder::BuildImportCall(wasm::FunctionSig* sig, Node** args,
@@ -2752,7 +2781,7 @@ Node* WasmGraphBuilder::CallDirect(uint32_t index, Node** args, Node*** rets,
 
   if (env_ && index < env_->module->num_imported_functions) {
     // Call to an imported function.
-    return BuildImportCall(sig, args, rets, position, index);
+    return BuildImportCall(sig, args, rets, position, index, kCallContinues);
   }
 
   // A direct call to a wasm function defined in this module.
@@ -2766,6 +2795,36 @@ Node* WasmGraphBuilder::CallDirect(uint32_t index, Node** args, Node*** rets,
 Node* WasmGraphBuilder::CallIndirect(uint32_t sig_index, Node** args,
                                      Node*** rets,
                                      wasm::WasmCodePosition position) {
+  return BuildIndirectCall(sig_index, args, rets, position, kCallContinues);
+}
+
+Node* WasmGraphBuilder::ReturnCall(uint32_t index, Node** args,
+                                   wasm::WasmCodePosition position) {
+  DCHECK_NULL(args[0]);
+  wasm::FunctionSig* sig = env_->module->functions[index].sig;
+
+  if (env_ && index < env_->module->num_imported_functions) {
+    // Tail call to an imported function.
+    return BuildImportCall(sig, args, nullptr, position, index, kReturnCall);
+  }
+
+  // A direct tail call to a wasm function defined in this module.
+  // Just encode the function index. This will be patched at instantiation.
+  Address code = static_cast<Address>(index);
+  args[0] = mcgraph()->RelocatableIntPtrConstant(code, RelocInfo::WASM_CALL);
+
+  return BuildWasmReturnCall(sig, args, position, nullptr, kNoRetpoline);
+}
+
+Node* WasmGraphBuilder::ReturnCallIndirect(uint32_t sig_index, Node** args,
+                                           wasm::WasmCodePosition position) {
+  return BuildIndirectCall(sig_index, args, nullptr, position, kReturnCall);
+}
+
+Node* WasmGraphBuilder::BuildIndirectCall(uint32_t sig_index, Node** args,
+                                          Node*** rets,
+                                          wasm::WasmCodePosition position,
+                                          IsReturnCall continuation) {
   DCHECK_NOT_NULL(args[0]);
   DCHECK_NOT_NULL(env_);
 
@@ -2830,9 +2889,14 @@ Node* WasmGraphBuilder::CallIndirect(uint32_t sig_index, Node** args,
       Effect(), Control()));
 
   args[0] = target;
-
+  const UseRetpoline use_retpoline =
+      untrusted_code_mitigations_ ? kRetpoline : kNoRetpoline;
+  if (continuation == kReturnCall) {
+    return BuildWasmReturnCall(sig, args, position, target_instance,
+                               use_retpoline);
+  }
   return BuildWasmCall(sig, args, rets, position, target_instance,
-                       untrusted_code_mitigations_ ? kRetpoline : kNoRetpoline);
+                       use_retpoline);
 }
 
 Node* WasmGraphBuilder::BuildI32Rol(Node* left, Node* right) {
@@ -4312,10 +4376,108 @@ Node* WasmGraphBuilder::MemoryDrop(uint32_t data_segment_index,
                        mcgraph()->Int32Constant(1), Effect(), Control()));
 }
 
+namespace {
+
+// memory.copy and memory.fill with a constant size of at most this many bytes
+// are inlined as loads and stores instead of calling out to C.
+constexpr uint32_t kMaxInlineBulkMemorySize = 8 * kPointerSize;
+
+// Splits an inlined bulk memory operation of {size} bytes into accesses of
+// at most pointer size, and calls {callback} with the machine type and the
+// offset of each access.
+template <typename Callback>
+void ForEachBulkMemoryAccess(uint32_t size, Callback callback) {
+  static constexpr MachineType kAccessTypes[] = {
+      MachineType::Pointer(), MachineType::Uint32(), MachineType::Uint16(),
+      MachineType::Uint8()};
+  uint32_t offset = 0;
+  for (MachineType type : kAccessTypes) {
+    uint32_t access_size = ElementSizeInBytes(type.representation());
+    for (; size - offset >= access_size; offset += access_size) {
+      callback(type, offset);
+    }
+  }
+  DCHECK_EQ(size, offset);
+}
+
+// The accesses of inlined bulk memory operations are not aligned in general.
+const Operator* GetBulkMemoryLoadOperator(MachineOperatorBuilder* m,
+                                          MachineType type) {
+  if (type.representation() == MachineRepresentation::kWord8 ||
+      m->UnalignedLoadSupported(type.representation())) {
+    return m->Load(type);
+  }
+  return m->UnalignedLoad(type);
+}
+
+const Operator* GetBulkMemoryStoreOperator(MachineOperatorBuilder* m,
+                                           MachineRepresentation rep) {
+  if (rep == MachineRepresentation::kWord8 || m->UnalignedStoreSupported(rep)) {
+    return m->Store(StoreRepresentation(rep, kNoWriteBarrier));
+  }
+  return m->UnalignedStore(UnalignedStoreRepresentation(rep));
+}
+
+}  // namespace
+
+Node* WasmGraphBuilder::BuildInlineMemoryCopy(Node* dst, Node* src,
+                                             uint32_t size) {
+  MachineOperatorBuilder* m = mcgraph()->machine();
+  // Load everything before storing anything, since the ranges may overlap.
+  Node* values[kMaxInlineBulkMemorySize];
+  int num_values = 0;
+  ForEachBulkMemoryAccess(size, [&](MachineType type, uint32_t offset) {
+    values[num_values++] = SetEffect(
+        graph()->NewNode(GetBulkMemoryLoadOperator(m, type), src,
+                         mcgraph()->IntPtrConstant(offset), Effect(),
+                         Control()));
+  });
+  num_values = 0;
+  ForEachBulkMemoryAccess(size, [&](MachineType type, uint32_t offset) {
+    SetEffect(graph()->NewNode(
+        GetBulkMemoryStoreOperator(m, type.representation()), dst,
+        mcgraph()->IntPtrConstant(offset), values[num_values++], Effect(),
+        Control()));
+  });
+  return Effect();
+}
+
+Node* WasmGraphBuilder::BuildInlineMemoryFill(Node* dst, Node* value,
+                                             uint32_t size) {
+  MachineOperatorBuilder* m = mcgraph()->machine();
+  // Replicate the low byte of {value} into every byte of a word, which is
+  // then stored truncated to the size of each access.
+  Node* byte_value =
+      graph()->NewNode(m->Word32And(), value, Int32Constant(0xFF));
+  Node* word32_value =
+      graph()->NewNode(m->Int32Mul(), byte_value, Int32Constant(0x01010101));
+  Node* word_value = word32_value;
+  if (m->Is64() && size >= kPointerSize) {
+    word_value = graph()->NewNode(m->Int64Mul(),
+                                  graph()->NewNode(m->ChangeUint32ToUint64(),
+                                                   byte_value),
+                                  Int64Constant(0x0101010101010101));
+  }
+  ForEachBulkMemoryAccess(size, [&](MachineType type, uint32_t offset) {
+    MachineRepresentation rep = type.representation();
+    Node* stored_value =
+        rep == MachineRepresentation::kWord64 ? word_value : word32_value;
+    SetEffect(graph()->NewNode(GetBulkMemoryStoreOperator(m, rep), dst,
+                               mcgraph()->IntPtrConstant(offset), stored_value,
+                               Effect(), Control()));
+  });
+  return Effect();
+}
+
 Node* WasmGraphBuilder::MemoryCopy(Node* dst, Node* src, Node* size,
                                    wasm::WasmCodePosition position) {
   dst = BoundsCheckMemRange(dst, size, position);
   src = BoundsCheckMemRange(src, size, position);
+  Uint32Matcher size_match(size);
+  if (size_match.HasValue() &&
+      size_match.Value() <= kMaxInlineBulkMemorySize) {
+    return BuildInlineMemoryCopy(dst, src, size_match.Value());
+  }
   Node* function = graph()->NewNode(mcgraph()->common()->ExternalConstant(
       ExternalReference::wasm_memory_copy()));
   MachineType sig_types[] = {MachineType::Pointer(), MachineType::Pointer(),
@@ -4327,6 +4489,11 @@ Node* WasmGraphBuilder::MemoryCopy(Node* dst, Node* src, Node* size,
 Node* WasmGraphBuilder::MemoryFill(Node* dst, Node* value, Node* size,
                                    wasm::WasmCodePosition position) {
   dst = BoundsCheckMemRange(dst, size, position);
+  Uint32Matcher size_match(size);
+  if (size_match.HasValue() &&
+      size_match.Value() <= kMaxInlineBulkMemorySize) {
+    return BuildInlineMemoryFill(dst, value, size_match.Value());
+  }
   Node* function = graph()->NewNode(mcgraph()->common()->ExternalConstant(
       ExternalReference::wasm_memory_fill()));
   MachineType sig_types[] = {MachineType::Pointer(), MachineType::Uint32(),
@@ -5395,6 +5562,7 @@ WasmImportCallKind GetWasmImportCallKind(Handle<JSReceiver> target,
         COMPARE_SIG_FOR_BUILTIN_F32_F64(Ceil);
         COMPARE_SIG_FOR_BUILTIN_F32_F64(Floor);
         COMPARE_SIG_FOR_BUILTIN_F32_F64(Sqrt);
+        COMPARE_SIG_FOR_BUILTIN_F32_F64(Trunc);
         case Builtins::kMathFround:
           COMPARE_SIG_FOR_BUILTIN(F32ConvertF64);
           break;
@@ -5444,6 +5612,7 @@ wasm::WasmOpcode GetMathIntrinsicOpcode(WasmImportCallKind kind,
     CASE(F64Ceil);
     CASE(F64Floor);
     CASE(F64Sqrt);
+    CASE(F64Trunc);
     CASE(F64Min);
     CASE(F64Max);
     CASE(F64Abs);
@@ -5453,6 +5622,7 @@ wasm::WasmOpcode GetMathIntrinsicOpcode(WasmImportCallKind kind,
     CASE(F32Ceil);
     CASE(F32Floor);
     CASE(F32Sqrt);
+    CASE(F32Trunc);
     CASE(F32ConvertF64);
     default:
       UNREACHABLE();
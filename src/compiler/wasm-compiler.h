@@ -92,6 +92,7 @@ enum class WasmImportCallKind : uint8_t {
   kF64Ceil,
   kF64Floor,
   kF64Sqrt,
+  kF64Trunc,
   kF64Min,
   kF64Max,
   kF64Abs,
@@ -101,6 +102,7 @@ enum class WasmImportCallKind : uint8_t {
   kF32Ceil,
   kF32Floor,
   kF32Sqrt,
+  kF32Trunc,
   kF32ConvertF64,
   kLastMathIntrinsic = kF32ConvertF64,
   // For everything else, there's the call builtin.
@@ -168,6 +170,10 @@ class WasmGraphBuilder {
     kExtraCallableParam = true,
     kNoExtraCallableParam = false
   };
+  enum IsReturnCall : bool {  // --
+    kReturnCall = true,
+    kCallContinues = false
+  };
 
   WasmGraphBuilder(wasm::CompilationEnv* env, Zone* zone, MachineGraph* mcgraph,
                    wasm::FunctionSig* sig,
@@ -264,6 +270,10 @@ class WasmGraphBuilder {
                    wasm::WasmCodePosition position);
   Node* CallIndirect(uint32_t index, Node** args, Node*** rets,
                      wasm::WasmCodePosition position);
+  Node* ReturnCall(uint32_t index, Node** args,
+                   wasm::WasmCodePosition position);
+  Node* ReturnCallIndirect(uint32_t index, Node** args,
+                           wasm::WasmCodePosition position);
 
   Node* Invert(Node* node);
 
@@ -421,6 +431,10 @@ class WasmGraphBuilder {
   // BoundsCheckMemRange receives a uint32 {start} and {size} and returns
   // a pointer into memory at that index, if it is in bounds.
   Node* BoundsCheckMemRange(Node* start, Node* size, wasm::WasmCodePosition);
+  // Inline memory.copy and memory.fill of a small constant {size} on the
+  // bounds checked pointers {dst} and {src}.
+  Node* BuildInlineMemoryCopy(Node* dst, Node* src, uint32_t size);
+  Node* BuildInlineMemoryFill(Node* dst, Node* value, uint32_t size);
   Node* CheckBoundsAndAlignment(uint8_t access_size, Node* index,
                                 uint32_t offset, wasm::WasmCodePosition);
   Node* Uint32ToUintptr(Node*);
@@ -436,13 +450,23 @@ class WasmGraphBuilder {
 
   template <typename... Args>
   Node* BuildCCall(MachineSignature* sig, Node* function, Args... args);
+  Node* BuildCallNode(wasm::FunctionSig* sig, Node** args,
+                      wasm::WasmCodePosition position, Node* instance_node,
+                      const Operator* op);
   Node* BuildWasmCall(wasm::FunctionSig* sig, Node** args, Node*** rets,
                       wasm::WasmCodePosition position, Node* instance_node,
                       UseRetpoline use_retpoline);
+  Node* BuildWasmReturnCall(wasm::FunctionSig* sig, Node** args,
+                            wasm::WasmCodePosition position,
+                            Node* instance_node, UseRetpoline use_retpoline);
   Node* BuildImportCall(wasm::FunctionSig* sig, Node** args, Node*** rets,
-                        wasm::WasmCodePosition position, int func_index);
+                        wasm::WasmCodePosition position, int func_index,
+                        IsReturnCall continuation);
   Node* BuildImportCall(wasm::FunctionSig* sig, Node** args, Node*** rets,
                         wasm::WasmCodePosition position, Node* func_index);
+  Node* BuildIndirectCall(uint32_t sig_index, Node** args, Node*** rets,
+                          wasm::WasmCodePosition position,
+                          IsReturnCall continuation);
 
   Node* BuildF32CopySign(Node* left, Node* right);
   Node* BuildF64CopySign(Node* left, Node* right);
@@ -477,7 +477,13 @@ void RuntimeCallStats::CorrectCurrentCounterId(
     RuntimeCallCounterId counter_id) {
   DCHECK(IsCalledOnTheSameThread());
   RuntimeCallTimer* timer = current_timer();
-  if (timer == nullptr) return;
+  if (timer == nullptr) {
+    // The counter sampling mode has no timers, only the current counter.
+    if (current_counter() != nullptr && IsCounterSamplingEnabled()) {
+      current_counter_.SetValue(GetCounter(counter_id));
+    }
+    return;
+  }
   RuntimeCallCounter* counter = GetCounter(counter_id);
   timer->set_counter(counter);
   current_counter_.SetValue(counter);
@@ -1062,6 +1062,22 @@ class RuntimeCallStats final {
   V8_EXPORT_PRIVATE void CorrectCurrentCounterId(
       RuntimeCallCounterId counter_id);
 
+  // In the counter sampling mode scopes only swap the current counter, which
+  // samplers read to bucket their ticks. No timers are started, so neither
+  // counts nor times are recorded. Returns the previous counter.
+  RuntimeCallCounter* SwitchCurrentCounter(RuntimeCallCounterId counter_id) {
+    RuntimeCallCounter* previous = current_counter();
+    current_counter_.SetValue(GetCounter(counter_id));
+    return previous;
+  }
+  void RestoreCurrentCounter(RuntimeCallCounter* counter) {
+    current_counter_.SetValue(counter);
+  }
+  static bool IsCounterSamplingEnabled() {
+    return base::AsAtomic32::Relaxed_Load(&FLAG_runtime_stats) ==
+           v8::tracing::TracingCategoryObserver::ENABLED_BY_COUNTER_SAMPLING;
+  }
+
   V8_EXPORT_PRIVATE void Reset();
   // Add all entries from another stats object.
   void Add(RuntimeCallStats* other);
@@ -1156,19 +1172,33 @@ class RuntimeCallTimerScope {
   inline RuntimeCallTimerScope(RuntimeCallStats* stats,
                                RuntimeCallCounterId counter_id) {
     if (V8_LIKELY(!FLAG_runtime_stats || stats == nullptr)) return;
-    stats_ = stats;
-    stats_->Enter(&timer_, counter_id);
+    Enter(stats, counter_id);
   }
 
   inline ~RuntimeCallTimerScope() {
     if (V8_UNLIKELY(stats_ != nullptr)) {
       stats_->Leave(&timer_);
+    } else if (V8_UNLIKELY(sampling_stats_ != nullptr)) {
+      sampling_stats_->RestoreCurrentCounter(previous_counter_);
     }
   }
 
  private:
+  inline void Enter(RuntimeCallStats* stats, RuntimeCallCounterId counter_id) {
+    if (RuntimeCallStats::IsCounterSamplingEnabled()) {
+      sampling_stats_ = stats;
+      previous_counter_ = stats->SwitchCurrentCounter(counter_id);
+      return;
+    }
+    stats_ = stats;
+    stats_->Enter(&timer_, counter_id);
+  }
+
   RuntimeCallStats* stats_ = nullptr;
   RuntimeCallTimer timer_;
+  // Only used in the counter sampling mode, which does not start |timer_|.
+  RuntimeCallStats* sampling_stats_ = nullptr;
+  RuntimeCallCounter* previous_counter_ = nullptr;
 
   DISALLOW_COPY_AND_ASSIGN(RuntimeCallTimerScope);
 };
@@ -1376,6 +1406,8 @@ class RuntimeCallTimerScope {
   SC(inlined_copied_elements, V8.InlinedCopiedElements)             \
   SC(compilation_cache_hits, V8.CompilationCacheHits)               \
   SC(compilation_cache_misses, V8.CompilationCacheMisses)           \
+  SC(compilation_cache_script_hits, V8.CompilationCacheScriptHits)  \
+  SC(compilation_cache_script_misses, V8.CompilationCacheScriptMisses) \
   /* Amount of evaled source code. */                               \
   SC(total_eval_size, V8.TotalEvalSize)                             \
   /* Amount of loaded source code. */                               \
@@ -1386,6 +1418,11 @@ class RuntimeCallTimerScope {
   SC(total_preparse_skipped, V8.TotalPreparseSkipped)               \
   /* Amount of compiled source code. */                             \
   SC(total_compile_size, V8.TotalCompileSize)                       \
+  /* Number and size of bytecode arrays flushed by the GC. */       \
+  SC(bytecode_flushed, V8.BytecodeFlushed)                          \
+  SC(bytecode_flushed_size, V8.BytecodeFlushedSize)                 \
+  /* Number of functions recompiled after a bytecode flush. */      \
+  SC(bytecode_flushed_recompiled, V8.BytecodeFlushedRecompiled)     \
   /* Amount of source code compiled with the full codegen. */       \
   SC(total_full_codegen_source_size, V8.TotalFullCodegenSourceSize) \
   /* Number of contexts created from scratch. */                    \
@@ -1425,12 +1462,20 @@ class RuntimeCallTimerScope {
   SC(megamorphic_stub_cache_probes, V8.MegamorphicStubCacheProbes)             \
   SC(megamorphic_stub_cache_misses, V8.MegamorphicStubCacheMisses)             \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
+  SC(megamorphic_stub_cache_evictions, V8.MegamorphicStubCacheEvictions)       \
+  SC(megamorphic_stub_cache_resizes, V8.MegamorphicStubCacheResizes)           \
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
   SC(fast_new_closure_total, V8.FastNewClosureTotal)                           \
   SC(string_add_runtime, V8.StringAddRuntime)                                  \
   SC(string_add_native, V8.StringAddNative)                                    \
   SC(string_add_runtime_ext_to_one_byte, V8.StringAddRuntimeExtToOneByte)      \
+  SC(string_flatten, V8.StringFlatten)                                         \
+  SC(string_flatten_characters, V8.StringFlattenCharacters)                    \
+  SC(number_string_cache_hits, V8.NumberStringCacheHits)                       \
+  SC(number_string_cache_misses, V8.NumberStringCacheMisses)                   \
+  SC(regexp_results_cache_hits, V8.RegExpResultsCacheHits)                     \
+  SC(regexp_results_cache_misses, V8.RegExpResultsCacheMisses)                 \
   SC(sub_string_runtime, V8.SubStringRuntime)                                  \
   SC(sub_string_native, V8.SubStringNative)                                    \
   SC(regexp_entry_runtime, V8.RegExpEntryRuntime)                              \
@@ -1675,8 +1720,7 @@ void HistogramTimer::Stop() {
 RuntimeCallTimerScope::RuntimeCallTimerScope(Isolate* isolate,
                                              RuntimeCallCounterId counter_id) {
   if (V8_LIKELY(!FLAG_runtime_stats)) return;
-  stats_ = isolate->counters()->runtime_call_stats();
-  stats_->Enter(&timer_, counter_id);
+  Enter(isolate->counters()->runtime_call_stats(), counter_id);
 }
 
 }  // namespace internal
@@ -157,6 +157,12 @@ class DelayedTasksPlatform : public Platform {
     platform_->CallOnWorkerThread(MakeDelayedTask(std::move(task)));
   }
 
+  void PostTaskOnWorkerThread(TaskPriority priority,
+                              std::unique_ptr<Task> task) override {
+    platform_->PostTaskOnWorkerThread(priority,
+                                      MakeDelayedTask(std::move(task)));
+  }
+
   void CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
                                  double delay_in_seconds) override {
     platform_->CallDelayedOnWorkerThread(MakeDelayedTask(std::move(task)),
@@ -406,13 +406,14 @@ class DummySourceStream : public v8::ScriptCompiler::ExternalSourceStream {
 
 class BackgroundCompileThread : public base::Thread {
  public:
-  BackgroundCompileThread(Isolate* isolate, Local<String> source)
+  BackgroundCompileThread(Isolate* isolate, Local<String> source,
+                          ScriptType type = ScriptType::kClassic)
       : base::Thread(GetThreadOptions("BackgroundCompileThread")),
         source_(source),
         streamed_source_(new DummySourceStream(source, isolate),
                          v8::ScriptCompiler::StreamedSource::UTF8),
-        task_(v8::ScriptCompiler::StartStreamingScript(isolate,
-                                                       &streamed_source_)) {}
+        task_(v8::ScriptCompiler::StartStreaming(isolate, &streamed_source_,
+                                                 type)) {}
 
   void Run() override { task_->Run(); }
 
@@ -492,6 +493,14 @@ bool Shell::ExecuteString(Isolate* isolate, Local<String> source,
         maybe_script = ScriptCompiler::Compile(
             context, &script_source, ScriptCompiler::kNoCompileOptions);
       }
+    } else if (options.streaming_compile) {
+      // Compile the script on a background thread, like an embedder streaming
+      // it from the network would, and finalize it on the main thread.
+      BackgroundCompileThread background_compile_thread(isolate, source);
+      background_compile_thread.Start();
+      background_compile_thread.Join();
+      maybe_script = v8::ScriptCompiler::Compile(
+          context, background_compile_thread.streamed_source(), source, origin);
     } else if (options.stress_background_compile) {
       // Start a background thread compiling the script.
       BackgroundCompileThread background_compile_thread(isolate, source);
@@ -691,6 +700,30 @@ MaybeLocal<Module> ResolveModuleCallback(Local<Context> context,
 
 }  // anonymous namespace
 
+namespace {
+
+ScriptOrigin ModuleOrigin(Isolate* isolate, const std::string& file_name) {
+  return ScriptOrigin(
+      String::NewFromUtf8(isolate, file_name.c_str(), NewStringType::kNormal)
+          .ToLocalChecked(),
+      Local<Integer>(), Local<Integer>(), Local<Boolean>(), Local<Integer>(),
+      Local<Value>(), Local<Boolean>(), Local<Boolean>(), True(isolate));
+}
+
+void RegisterModule(Local<Context> context, Local<Module> module,
+                    const std::string& file_name) {
+  Isolate* isolate = context->GetIsolate();
+  ModuleEmbedderData* d = GetModuleDataFromContext(context);
+  CHECK(d->specifier_to_module_map
+            .insert(std::make_pair(file_name, Global<Module>(isolate, module)))
+            .second);
+  CHECK(d->module_to_specifier_map
+            .insert(std::make_pair(Global<Module>(isolate, module), file_name))
+            .second);
+}
+
+}  // namespace
+
 MaybeLocal<Module> Shell::FetchModuleTree(Local<Context> context,
                                           const std::string& file_name) {
   DCHECK(IsAbsolutePath(file_name));
@@ -701,39 +734,99 @@ MaybeLocal<Module> Shell::FetchModuleTree(Local<Context> context,
     Throw(isolate, msg.c_str());
     return MaybeLocal<Module>();
   }
-  ScriptOrigin origin(
-      String::NewFromUtf8(isolate, file_name.c_str(), NewStringType::kNormal)
-          .ToLocalChecked(),
-      Local<Integer>(), Local<Integer>(), Local<Boolean>(), Local<Integer>(),
-      Local<Value>(), Local<Boolean>(), Local<Boolean>(), True(isolate));
-  ScriptCompiler::Source source(source_text, origin);
+  ScriptOrigin origin = ModuleOrigin(isolate, file_name);
   Local<Module> module;
-  if (!ScriptCompiler::CompileModule(isolate, &source).ToLocal(&module)) {
+  if (options.streaming_compile) {
+    BackgroundCompileThread background_compile_thread(isolate, source_text,
+                                                      ScriptType::kModule);
+    background_compile_thread.Start();
+    background_compile_thread.Join();
+    if (!ScriptCompiler::CompileModule(
+             context, background_compile_thread.streamed_source(),
+             source_text, origin)
+             .ToLocal(&module)) {
+      return MaybeLocal<Module>();
+    }
+  } else {
+    ScriptCompiler::Source source(source_text, origin);
+    if (!ScriptCompiler::CompileModule(isolate, &source).ToLocal(&module)) {
+      return MaybeLocal<Module>();
+    }
+  }
+
+  RegisterModule(context, module, file_name);
+  if (!FetchModuleDependencies(context, module, file_name)) {
     return MaybeLocal<Module>();
   }
+  return module;
+}
 
+bool Shell::FetchModuleDependencies(Local<Context> context,
+                                    Local<Module> module,
+                                    const std::string& file_name) {
+  Isolate* isolate = context->GetIsolate();
   ModuleEmbedderData* d = GetModuleDataFromContext(context);
-  CHECK(d->specifier_to_module_map
-            .insert(std::make_pair(file_name, Global<Module>(isolate, module)))
-            .second);
-  CHECK(d->module_to_specifier_map
-            .insert(std::make_pair(Global<Module>(isolate, module), file_name))
-            .second);
-
   std::string dir_name = DirName(file_name);
 
+  std::vector<std::string> missing;
   for (int i = 0, length = module->GetModuleRequestsLength(); i < length; ++i) {
     Local<String> name = module->GetModuleRequest(i);
     std::string absolute_path =
         NormalizePath(ToSTLString(isolate, name), dir_name);
-    if (!d->specifier_to_module_map.count(absolute_path)) {
-      if (FetchModuleTree(context, absolute_path).IsEmpty()) {
-        return MaybeLocal<Module>();
-      }
+    if (!d->specifier_to_module_map.count(absolute_path) &&
+        std::find(missing.begin(), missing.end(), absolute_path) ==
+            missing.end()) {
+      missing.push_back(absolute_path);
     }
   }
 
-  return module;
+  if (!options.streaming_compile) {
+    for (const std::string& absolute_path : missing) {
+      // An earlier sibling's subtree may have loaded it in the meantime.
+      if (d->specifier_to_module_map.count(absolute_path)) continue;
+      if (FetchModuleTree(context, absolute_path).IsEmpty()) return false;
+    }
+    return true;
+  }
+
+  // Compile all missing dependencies of this module in parallel before
+  // descending into them, the way a browser fetches a module graph.
+  std::vector<Local<String>> sources;
+  for (const std::string& absolute_path : missing) {
+    Local<String> source_text = ReadFile(isolate, absolute_path.c_str());
+    if (source_text.IsEmpty()) {
+      std::string msg = "Error reading: " + absolute_path;
+      Throw(isolate, msg.c_str());
+      return false;
+    }
+    sources.push_back(source_text);
+  }
+  std::vector<std::unique_ptr<BackgroundCompileThread>> threads;
+  for (Local<String> source_text : sources) {
+    threads.emplace_back(new BackgroundCompileThread(isolate, source_text,
+                                                     ScriptType::kModule));
+    threads.back()->Start();
+  }
+  for (auto& thread : threads) thread->Join();
+
+  std::vector<Local<Module>> modules;
+  for (size_t i = 0; i < missing.size(); ++i) {
+    Local<Module> dependency;
+    if (!ScriptCompiler::CompileModule(context, threads[i]->streamed_source(),
+                                       sources[i],
+                                       ModuleOrigin(isolate, missing[i]))
+             .ToLocal(&dependency)) {
+      return false;
+    }
+    RegisterModule(context, dependency, missing[i]);
+    modules.push_back(dependency);
+  }
+  for (size_t i = 0; i < missing.size(); ++i) {
+    if (!FetchModuleDependencies(context, modules[i], missing[i])) {
+      return false;
+    }
+  }
+  return true;
 }
 
 namespace {
@@ -892,15 +985,30 @@ PerIsolateData::PerIsolateData(Isolate* isolate)
   if (i::FLAG_expose_async_hooks) {
     async_hooks_wrapper_ = new AsyncHooks(isolate);
   }
+  isolate->SetGCStatisticsCallback(RecordGCStatistics, this);
 }
 
 PerIsolateData::~PerIsolateData() {
+  isolate_->SetGCStatisticsCallback(nullptr);
   isolate_->SetData(0, nullptr);  // Not really needed, just to be sure...
   if (i::FLAG_expose_async_hooks) {
     delete async_hooks_wrapper_;  // This uses the isolate
   }
 }
 
+// static
+void PerIsolateData::RecordGCStatistics(Isolate* isolate,
+                                        const GCStatistics& statistics,
+                                        void* data) {
+  PerIsolateData* self = static_cast<PerIsolateData*>(data);
+  self->gc_pauses_.push_back(statistics.pause_duration);
+  if (statistics.type == kGCTypeMarkSweepCompact) self->full_gc_count_++;
+  self->gc_promoted_bytes_ += statistics.promoted_bytes;
+  self->gc_peak_memory_size_ =
+      std::max({self->gc_peak_memory_size_, statistics.start_memory_size,
+                statistics.end_memory_size});
+}
+
 void PerIsolateData::SetTimeout(Local<Function> callback,
                                 Local<Context> context) {
   set_timeout_callbacks_.emplace(isolate_, callback);
@@ -990,6 +1098,43 @@ void Shell::PerformanceNow(const v8::FunctionCallbackInfo<v8::Value>& args) {
 }
 
 
+// performance.gcStatistics() returns the pause times (in milliseconds) of
+// the garbage collections since the last call, along with the number of full
+// collections, the promoted bytes and the peak committed heap memory.
+void Shell::PerformanceGCStatistics(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  Local<Context> context = isolate->GetCurrentContext();
+  PerIsolateData* data = PerIsolateData::Get(isolate);
+  Local<Array> pauses =
+      Array::New(isolate, static_cast<int>(data->gc_pauses_.size()));
+  for (size_t i = 0; i < data->gc_pauses_.size(); i++) {
+    pauses
+        ->Set(context, static_cast<uint32_t>(i),
+              Number::New(isolate, data->gc_pauses_[i]))
+        .FromJust();
+  }
+  std::pair<const char*, Local<Value>> properties[] = {
+      {"pauses", pauses},
+      {"fullGCCount", Integer::New(isolate, data->full_gc_count_)},
+      {"promotedBytes",
+       Number::New(isolate, static_cast<double>(data->gc_promoted_bytes_))},
+      {"peakMemorySize",
+       Number::New(isolate, static_cast<double>(data->gc_peak_memory_size_))}};
+  Local<Object> result = Object::New(isolate);
+  for (const auto& property : properties) {
+    Local<String> name =
+        String::NewFromUtf8(isolate, property.first, NewStringType::kNormal)
+            .ToLocalChecked();
+    result->Set(context, name, property.second).FromJust();
+  }
+  data->gc_pauses_.clear();
+  data->full_gc_count_ = 0;
+  data->gc_promoted_bytes_ = 0;
+  data->gc_peak_memory_size_ = 0;
+  args.GetReturnValue().Set(result);
+}
+
 // Realm.current() returns the index of the currently active realm.
 void Shell::RealmCurrent(const v8::FunctionCallbackInfo<v8::Value>& args) {
   Isolate* isolate = args.GetIsolate();
@@ -1811,6 +1956,10 @@ Local<ObjectTemplate> Shell::CreateGlobalTemplate(Isolate* isolate) {
       String::NewFromUtf8(isolate, "now", NewStringType::kNormal)
           .ToLocalChecked(),
       FunctionTemplate::New(isolate, PerformanceNow));
+  performance_template->Set(
+      String::NewFromUtf8(isolate, "gcStatistics", NewStringType::kNormal)
+          .ToLocalChecked(),
+      FunctionTemplate::New(isolate, PerformanceGCStatistics));
   global_template->Set(
       String::NewFromUtf8(isolate, "performance", NewStringType::kNormal)
           .ToLocalChecked(),
@@ -2130,6 +2279,26 @@ void Shell::OnExit(v8::Isolate* isolate) {
     delete [] counters;
   }
 
+  if (options.dump_mutex_stats) {
+    std::vector<base::MutexContentionStats> stats =
+        base::Mutex::GetContentionStats();
+    if (stats.empty()) {
+      printf("No mutex statistics, build with "
+             "v8_enable_mutex_contention_stats=true.\n");
+    }
+    std::sort(stats.begin(), stats.end(),
+              [](const base::MutexContentionStats& a,
+                 const base::MutexContentionStats& b) {
+                return a.wait_time_in_ms > b.wait_time_in_ms;
+              });
+    for (const base::MutexContentionStats& entry : stats) {
+      printf("%-45s %10" PRIu64 " acquisitions %10" PRIu64
+             " contended %12.3f ms waited\n",
+             entry.name, entry.acquisitions, entry.contended_acquisitions,
+             entry.wait_time_in_ms);
+    }
+  }
+
   delete counters_file_;
   delete counter_map_;
 }
@@ -2507,30 +2676,32 @@ void SourceGroup::ExecuteInThread() {
   debug::SetConsoleDelegate(isolate, &console);
   for (int i = 0; i < Shell::options.stress_runs; ++i) {
     next_semaphore_.Wait();
-    {
-      Isolate::Scope iscope(isolate);
-      PerIsolateData data(isolate);
-      {
-        HandleScope scope(isolate);
-        Local<Context> context = Shell::CreateEvaluationContext(isolate);
-        {
-          Context::Scope cscope(context);
-          InspectorClient inspector_client(context,
-                                           Shell::options.enable_inspector);
-          PerIsolateData::RealmScope realm_scope(PerIsolateData::Get(isolate));
-          Execute(isolate);
-          Shell::CompleteMessageLoop(isolate);
-        }
-        DisposeModuleEmbedderData(context);
-      }
-      Shell::CollectGarbage(isolate);
-    }
+    ExecuteInNewContext(isolate);
     done_semaphore_.Signal();
   }
 
   isolate->Dispose();
 }
 
+void SourceGroup::ExecuteInNewContext(Isolate* isolate) {
+  Isolate::Scope iscope(isolate);
+  PerIsolateData data(isolate);
+  {
+    HandleScope scope(isolate);
+    Local<Context> context = Shell::CreateEvaluationContext(isolate);
+    {
+      Context::Scope cscope(context);
+      InspectorClient inspector_client(context,
+                                       Shell::options.enable_inspector);
+      PerIsolateData::RealmScope realm_scope(PerIsolateData::Get(isolate));
+      Execute(isolate);
+      Shell::CompleteMessageLoop(isolate);
+    }
+    DisposeModuleEmbedderData(context);
+  }
+  Shell::CollectGarbage(isolate);
+}
+
 
 void SourceGroup::StartExecuteInThread() {
   if (thread_ == nullptr) {
@@ -2558,31 +2729,43 @@ ExternalizedContents::~ExternalizedContents() {
   }
 }
 
+SerializationDataQueue::SerializationDataQueue()
+    : head_(new Node), tail_(head_) {}
+
+SerializationDataQueue::~SerializationDataQueue() {
+  Clear();
+  delete head_;
+}
+
 void SerializationDataQueue::Enqueue(std::unique_ptr<SerializationData> data) {
-  base::MutexGuard lock_guard(&mutex_);
-  data_.push_back(std::move(data));
+  Node* node = new Node;
+  node->data = std::move(data);
+  // Publishes the message to the consumer.
+  tail_->next.store(node, std::memory_order_release);
+  tail_ = node;
 }
 
 bool SerializationDataQueue::Dequeue(
     std::unique_ptr<SerializationData>* out_data) {
   out_data->reset();
-  base::MutexGuard lock_guard(&mutex_);
-  if (data_.empty()) return false;
-  *out_data = std::move(data_[0]);
-  data_.erase(data_.begin());
+  Node* next = head_->next.load(std::memory_order_acquire);
+  if (next == nullptr) return false;
+  *out_data = std::move(next->data);
+  delete head_;
+  head_ = next;
   return true;
 }
 
 
 bool SerializationDataQueue::IsEmpty() {
-  base::MutexGuard lock_guard(&mutex_);
-  return data_.empty();
+  return head_->next.load(std::memory_order_acquire) == nullptr;
 }
 
 
 void SerializationDataQueue::Clear() {
-  base::MutexGuard lock_guard(&mutex_);
-  data_.clear();
+  std::unique_ptr<SerializationData> data;
+  while (Dequeue(&data)) {
+  }
 }
 
 Worker::Worker()
@@ -2778,6 +2961,9 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strcmp(argv[i], "--stress-deopt") == 0) {
       options.stress_deopt = true;
       argv[i] = nullptr;
+    } else if (strcmp(argv[i], "--streaming-compile") == 0) {
+      options.streaming_compile = true;
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--stress-background-compile") == 0) {
       options.stress_background_compile = true;
       argv[i] = nullptr;
@@ -2895,6 +3081,15 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strncmp(argv[i], "--thread-pool-size=", 19) == 0) {
       options.thread_pool_size = atoi(argv[i] + 19);
       argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--multi-isolate=", 16) == 0) {
+      options.multi_isolate = atoi(argv[i] + 16);
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--multi-isolate-runs=", 21) == 0) {
+      options.multi_isolate_runs = std::max(1, atoi(argv[i] + 21));
+      argv[i] = nullptr;
+    } else if (strcmp(argv[i], "--dump-mutex-stats") == 0) {
+      options.dump_mutex_stats = true;
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--stress-delay-tasks") == 0) {
       // Delay execution of tasks by 0-100ms randomly (based on --random-seed).
       options.stress_delay_tasks = true;
@@ -2977,6 +3172,101 @@ int Shell::RunMain(Isolate* isolate, int argc, char* argv[], bool last_run) {
   return 0;
 }
 
+namespace {
+
+// Runs a source group options.multi_isolate_runs times in its own isolate,
+// for --multi-isolate.
+class MultiIsolateThread : public base::Thread {
+ public:
+  MultiIsolateThread(SourceGroup* group, base::Semaphore* ready,
+                     base::Semaphore* start)
+      : base::Thread(base::Thread::Options("MultiIsolateThread")),
+        group_(group),
+        ready_(ready),
+        start_(start) {}
+
+  void Run() override {
+    Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = Shell::array_buffer_allocator;
+    Isolate* isolate = Isolate::New(create_params);
+    isolate->SetHostImportModuleDynamicallyCallback(
+        Shell::HostImportModuleDynamically);
+    isolate->SetHostInitializeImportMetaObjectCallback(
+        Shell::HostInitializeImportMetaObject);
+    Shell::SetWaitUntilDone(isolate, false);
+    D8Console console(isolate);
+    debug::SetConsoleDelegate(isolate, &console);
+
+    // Start all isolates at the same time.
+    ready_->Signal();
+    start_->Wait();
+    base::TimeTicks wall_start = base::TimeTicks::HighResolutionNow();
+    base::ThreadTicks cpu_start;
+    if (base::ThreadTicks::IsSupported()) cpu_start = base::ThreadTicks::Now();
+    for (int i = 0; i < Shell::options.multi_isolate_runs; ++i) {
+      group_->ExecuteInNewContext(isolate);
+    }
+    wall_time_ = base::TimeTicks::HighResolutionNow() - wall_start;
+    if (base::ThreadTicks::IsSupported()) {
+      cpu_time_ = base::ThreadTicks::Now() - cpu_start;
+    }
+
+    isolate->Dispose();
+  }
+
+  base::TimeDelta wall_time() const { return wall_time_; }
+  base::TimeDelta cpu_time() const { return cpu_time_; }
+
+ private:
+  SourceGroup* group_;
+  base::Semaphore* ready_;
+  base::Semaphore* start_;
+  base::TimeDelta wall_time_;
+  base::TimeDelta cpu_time_;
+};
+
+}  // namespace
+
+// Runs the first source group in options.multi_isolate isolates on as many
+// threads at once, and prints the throughput of each isolate and of all of
+// them together. The time each thread spends off the CPU is mostly spent
+// waiting on process-wide locks and on background tasks, so it grows with
+// contention.
+int Shell::RunMultiIsolate() {
+  int count = options.multi_isolate;
+  base::Semaphore ready(0);
+  base::Semaphore start(0);
+  std::vector<std::unique_ptr<MultiIsolateThread>> threads;
+  for (int i = 0; i < count; ++i) {
+    threads.emplace_back(
+        new MultiIsolateThread(&options.isolate_sources[0], &ready, &start));
+    threads.back()->Start();
+  }
+  for (int i = 0; i < count; ++i) ready.Wait();
+  for (int i = 0; i < count; ++i) start.Signal();
+  for (auto& thread : threads) thread->Join();
+  CleanupWorkers();
+
+  int runs = options.multi_isolate_runs;
+  double longest_ms = 0;
+  double off_cpu_ms = 0;
+  for (int i = 0; i < count; ++i) {
+    double wall_ms = threads[i]->wall_time().InMillisecondsF();
+    double cpu_ms = threads[i]->cpu_time().InMillisecondsF();
+    printf("Isolate %d: %d runs in %.3f ms, %.3f runs/s, %.3f ms off-CPU\n", i,
+           runs, wall_ms, runs * 1000 / wall_ms, wall_ms - cpu_ms);
+    longest_ms = std::max(longest_ms, wall_ms);
+    off_cpu_ms += wall_ms - cpu_ms;
+  }
+  printf(
+      "Total: %d isolates, %d runs in %.3f ms, %.3f runs/s, %.3f ms off-CPU\n",
+      count, count * runs, longest_ms, count * runs * 1000 / longest_ms,
+      off_cpu_ms);
+  if (!base::ThreadTicks::IsSupported()) {
+    printf("Thread CPU time is not supported, off-CPU times are wall times.\n");
+  }
+  return 0;
+}
 
 void Shell::CollectGarbage(Isolate* isolate) {
   if (options.send_idle_notification) {
@@ -3157,8 +3447,12 @@ class Serializer : public ValueSerializer::Delegate {
       for (uint32_t i = 0; i < length; ++i) {
         Local<Value> element;
         if (transfer_array->Get(context, i).ToLocal(&element)) {
+          // SharedArrayBuffers are never copied, listing them is a no-op.
+          if (element->IsSharedArrayBuffer()) continue;
           if (!element->IsArrayBuffer()) {
-            Throw(isolate_, "Transfer array elements must be an ArrayBuffer");
+            Throw(isolate_,
+                  "Transfer array elements must be an ArrayBuffer or "
+                  "SharedArrayBuffer");
             return Nothing<bool>();
           }
 
@@ -3207,7 +3501,17 @@ class Serializer : public ValueSerializer::Delegate {
         return Nothing<bool>();
       }
 
-      ArrayBuffer::Contents contents = MaybeExternalize(array_buffer);
+      // The message takes over internal backing stores, so that the receiver
+      // can adopt them. External ones stay owned by their current owner.
+      ArrayBuffer::Contents contents;
+      if (array_buffer->IsExternal()) {
+        contents = array_buffer->GetContents();
+        data_->owned_array_buffer_contents_.emplace_back(
+            ArrayBuffer::Contents());
+      } else {
+        contents = array_buffer->Externalize();
+        data_->owned_array_buffer_contents_.emplace_back(contents);
+      }
       array_buffer->Detach();
       data_->array_buffer_contents_.push_back(contents);
     }
@@ -3242,11 +3546,19 @@ class Deserializer : public ValueDeserializer::Delegate {
       return MaybeLocal<Value>();
     }
 
-    uint32_t index = 0;
-    for (const auto& contents : data_->array_buffer_contents()) {
+    const std::vector<ArrayBuffer::Contents>& contents =
+        data_->array_buffer_contents();
+    for (size_t index = 0; index < contents.size(); ++index) {
+      // Adopts the backing store if the message owns it.
+      ArrayBufferCreationMode mode =
+          data_->owned_array_buffer_contents()[index].Release()
+              ? ArrayBufferCreationMode::kInternalized
+              : ArrayBufferCreationMode::kExternalized;
       Local<ArrayBuffer> array_buffer =
-          ArrayBuffer::New(isolate_, contents.Data(), contents.ByteLength());
-      deserializer_.TransferArrayBuffer(index++, array_buffer);
+          ArrayBuffer::New(isolate_, contents[index].Data(),
+                           contents[index].ByteLength(), mode);
+      deserializer_.TransferArrayBuffer(static_cast<uint32_t>(index),
+                                        array_buffer);
     }
 
     return deserializer_.ReadValue(context);
@@ -3464,6 +3776,8 @@ int Shell::Main(int argc, char* argv[]) {
       }
       printf("======== Full Deoptimization =======\n");
       Testing::DeoptimizeAll(isolate);
+    } else if (options.multi_isolate > 0) {
+      result = RunMultiIsolate();
     } else if (i::FLAG_stress_runs > 0) {
       options.stress_runs = i::FLAG_stress_runs;
       for (int i = 0; i < options.stress_runs && result == 0; i++) {
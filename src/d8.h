@@ -5,6 +5,7 @@
 #ifndef V8_D8_H_
 #define V8_D8_H_
 
+#include <atomic>
 #include <iterator>
 #include <map>
 #include <memory>
@@ -95,6 +96,9 @@ class SourceGroup {
   void End(int offset) { end_offset_ = offset; }
 
   void Execute(Isolate* isolate);
+  // Executes the group in a new context of |isolate|, and runs the message
+  // loop until it is done.
+  void ExecuteInNewContext(Isolate* isolate);
 
   void StartExecuteInThread();
   void WaitForThread();
@@ -164,6 +168,13 @@ class ExternalizedContents {
   }
   ~ExternalizedContents();
 
+  // Gives up ownership of the backing store. Returns false if there was none.
+  bool Release() {
+    if (data_ == nullptr) return false;
+    data_ = nullptr;
+    return true;
+  }
+
  private:
   void* data_;
   size_t length_;
@@ -182,6 +193,13 @@ class SerializationData {
   const std::vector<ArrayBuffer::Contents>& array_buffer_contents() {
     return array_buffer_contents_;
   }
+  // Parallel to array_buffer_contents(). Holds the backing stores that the
+  // message owns, i.e. those of transferred ArrayBuffers that were not
+  // external. These move into the receiving isolate without a copy, or are
+  // freed with the message if it is never read.
+  std::vector<ExternalizedContents>& owned_array_buffer_contents() {
+    return owned_array_buffer_contents_;
+  }
   const std::vector<SharedArrayBuffer::Contents>&
   shared_array_buffer_contents() {
     return shared_array_buffer_contents_;
@@ -199,6 +217,7 @@ class SerializationData {
   std::unique_ptr<uint8_t, DataDeleter> data_;
   size_t size_;
   std::vector<ArrayBuffer::Contents> array_buffer_contents_;
+  std::vector<ExternalizedContents> owned_array_buffer_contents_;
   std::vector<SharedArrayBuffer::Contents> shared_array_buffer_contents_;
   std::vector<WasmModuleObject::TransferrableModule> transferrable_modules_;
 
@@ -209,16 +228,33 @@ class SerializationData {
 };
 
 
+// A lock-free queue of messages from a single producer thread to a single
+// consumer thread, as between a Worker and the thread that created it.
+// Enqueue() may only be called by the producer, the other methods only by the
+// consumer.
 class SerializationDataQueue {
  public:
+  SerializationDataQueue();
+  ~SerializationDataQueue();
+
   void Enqueue(std::unique_ptr<SerializationData> data);
   bool Dequeue(std::unique_ptr<SerializationData>* data);
   bool IsEmpty();
   void Clear();
 
  private:
-  base::Mutex mutex_;
-  std::vector<std::unique_ptr<SerializationData>> data_;
+  struct Node {
+    std::unique_ptr<SerializationData> data;
+    std::atomic<Node*> next{nullptr};
+  };
+
+  // |head_| is a consumed node whose successor holds the oldest message,
+  // |tail_| holds the newest one. The consumer owns |head_| and the producer
+  // owns |tail_|; they only share the |next| links.
+  Node* head_;
+  Node* tail_;
+
+  DISALLOW_COPY_AND_ASSIGN(SerializationDataQueue);
 };
 
 
@@ -301,6 +337,9 @@ class PerIsolateData {
  private:
   friend class Shell;
   friend class RealmScope;
+  static void RecordGCStatistics(Isolate* isolate,
+                                 const GCStatistics& statistics, void* data);
+
   Isolate* isolate_;
   int realm_count_;
   int realm_current_;
@@ -310,6 +349,11 @@ class PerIsolateData {
   std::queue<Global<Function>> set_timeout_callbacks_;
   std::queue<Global<Context>> set_timeout_contexts_;
   AsyncHooks* async_hooks_wrapper_;
+  // Collected for performance.gcStatistics() since its last call.
+  std::vector<double> gc_pauses_;
+  int full_gc_count_ = 0;
+  size_t gc_promoted_bytes_ = 0;
+  size_t gc_peak_memory_size_ = 0;
 
   int RealmIndexOrThrow(const v8::FunctionCallbackInfo<v8::Value>& args,
                         int arg_offset);
@@ -372,6 +416,9 @@ class ShellOptions {
   int num_isolates;
   v8::ScriptCompiler::CompileOptions compile_options;
   bool stress_background_compile;
+  // Compile scripts and modules on background threads through the streaming
+  // API, and fetch module dependencies in parallel.
+  bool streaming_compile = false;
   CodeCacheOptions code_cache_options;
   SourceGroup* isolate_sources;
   const char* icu_data_file;
@@ -387,6 +434,9 @@ class ShellOptions {
   bool quiet_load = false;
   int thread_pool_size = 0;
   bool stress_delay_tasks = false;
+  int multi_isolate = 0;
+  int multi_isolate_runs = 1;
+  bool dump_mutex_stats = false;
   std::vector<const char*> arguments;
   bool include_arguments = true;
 };
@@ -412,6 +462,7 @@ class Shell : public i::AllStatic {
   static Local<String> ReadFile(Isolate* isolate, const char* name);
   static Local<Context> CreateEvaluationContext(Isolate* isolate);
   static int RunMain(Isolate* isolate, int argc, char* argv[], bool last_run);
+  static int RunMultiIsolate();
   static int Main(int argc, char* argv[]);
   static void Exit(int exit_code);
   static void OnExit(Isolate* isolate);
@@ -433,6 +484,8 @@ class Shell : public i::AllStatic {
   static void MapCounters(v8::Isolate* isolate, const char* name);
 
   static void PerformanceNow(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void PerformanceGCStatistics(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
 
   static void RealmCurrent(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void RealmOwner(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -576,6 +629,9 @@ class Shell : public i::AllStatic {
                            int index);
   static MaybeLocal<Module> FetchModuleTree(v8::Local<v8::Context> context,
                                             const std::string& file_name);
+  static bool FetchModuleDependencies(v8::Local<v8::Context> context,
+                                      v8::Local<v8::Module> module,
+                                      const std::string& file_name);
   static ScriptCompiler::CachedData* LookupCodeCache(Isolate* isolate,
                                                      Local<Value> name);
   static void StoreInCodeCache(Isolate* isolate, Local<Value> name,
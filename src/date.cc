@@ -21,8 +21,6 @@ static const int kDays1970to2000 = 30 * 365 + 7;
 static const int kDaysOffset = 1000 * kDaysIn400Years + 5 * kDaysIn400Years -
                                kDays1970to2000;
 static const int kYearsOffset = 400000;
-static const char kDaysInMonths[] =
-    {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
 
 DateCache::DateCache()
     : stamp_(kNullAddress),
@@ -131,15 +129,12 @@ void DateCache::YearMonthDayFromDays(
   // Check if the date is after February.
   if (days >= 31 + 28 + BoolToInt(is_leap)) {
     days -= 31 + 28 + BoolToInt(is_leap);
-    // Find the date starting from March.
-    for (int i = 2; i < 12; i++) {
-      if (days < kDaysInMonths[i]) {
-        *month = i;
-        *day = days + 1;
-        break;
-      }
-      days -= kDaysInMonths[i];
-    }
+    // Counted from March, the month lengths repeat the pattern 31, 30, 31,
+    // 30, 31 (153 days per five months), so the month and day follow in
+    // closed form.
+    int month_from_march = (5 * days + 2) / 153;
+    *month = month_from_march + 2;
+    *day = days - (153 * month_from_march + 2) / 5 + 1;
   } else {
     // Check January and February.
     if (days < 31) {
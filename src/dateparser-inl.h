@@ -13,8 +13,9 @@ namespace v8 {
 namespace internal {
 
 template <typename Char>
-bool DateParser::Parse(Isolate* isolate, Vector<Char> str, FixedArray out) {
-  DCHECK(out->length() >= OUTPUT_SIZE);
+bool DateParser::Parse(Isolate* isolate, Vector<Char> str, double* out) {
+  if (ParseFixedWidthES5DateTime(str, out)) return true;
+
   InputReader<Char> in(str);
   DateStringTokenizer<Char> scanner(&in);
   TimeZoneComposer tz;
@@ -352,6 +353,83 @@ DateParser::DateToken DateParser::ParseES5DateTime(
   return DateToken::EndOfInput();
 }
 
+template <typename Char>
+bool DateParser::ParseFixedWidthES5DateTime(Vector<Char> str, double* output) {
+  const int length = str.length();
+  if (length != 10 && length != 16 && length != 17 && length != 19 &&
+      length != 20 && length != 23 && length != 24) {
+    return false;
+  }
+  // Reads the {count} digits starting at {index} into {result}.
+  auto read_digits = [&str](int index, int count, int* result) {
+    int value = 0;
+    for (int i = index; i < index + count; i++) {
+      unsigned digit = static_cast<unsigned>(str[i]) - '0';
+      if (digit > 9) return false;
+      value = value * 10 + static_cast<int>(digit);
+    }
+    *result = value;
+    return true;
+  };
+
+  int year, month, day;
+  if (!read_digits(0, 4, &year) || str[4] != '-' ||
+      !read_digits(5, 2, &month) || str[7] != '-' ||
+      !read_digits(8, 2, &day) || !DayComposer::IsMonth(month) ||
+      !DayComposer::IsDay(day)) {
+    return false;
+  }
+  output[YEAR] = year;
+  output[MONTH] = month - 1;  // 0-based
+  output[DAY] = day;
+
+  // Date-only forms are interpreted as UTC.
+  if (length == 10) {
+    output[HOUR] = output[MINUTE] = output[SECOND] = output[MILLISECOND] = 0;
+    output[UTC_OFFSET] = 0;
+    return true;
+  }
+
+  int index = 16;
+  int hour, minute, second = 0, millisecond = 0;
+  if ((str[10] != 'T' && str[10] != 't') || !read_digits(11, 2, &hour) ||
+      str[13] != ':' || !read_digits(14, 2, &minute) ||
+      !TimeComposer::IsMinute(minute)) {
+    return false;
+  }
+  if (index + 3 <= length && str[index] == ':') {
+    if (!read_digits(index + 1, 2, &second) ||
+        !TimeComposer::IsSecond(second)) {
+      return false;
+    }
+    index += 3;
+    if (index + 4 <= length && str[index] == '.') {
+      if (!read_digits(index + 1, 3, &millisecond)) return false;
+      index += 4;
+    }
+  }
+  // Allow 24:00:00.000, but no other time starting with 24.
+  if (!TimeComposer::IsHour(hour) &&
+      (hour != 24 || minute != 0 || second != 0 || millisecond != 0)) {
+    return false;
+  }
+
+  // Date-time forms without a time zone designator are local time.
+  double utc_offset = std::numeric_limits<double>::quiet_NaN();
+  if (index < length && (str[index] == 'Z' || str[index] == 'z')) {
+    utc_offset = 0;
+    index++;
+  }
+  if (index != length) return false;
+
+  output[HOUR] = hour;
+  output[MINUTE] = minute;
+  output[SECOND] = second;
+  output[MILLISECOND] = millisecond;
+  output[UTC_OFFSET] = utc_offset;
+  return true;
+}
+
 
 }  // namespace internal
 }  // namespace v8
@@ -14,7 +14,7 @@ namespace internal {
 class DateParser : public AllStatic {
  public:
   // Parse the string as a date. If parsing succeeds, return true after
-  // filling out the output array as follows (all integers are Smis):
+  // filling out the output array as follows (all integral values):
   // [0]: year
   // [1]: month (0 = Jan, 1 = Feb, ...)
   // [2]: day
@@ -22,10 +22,10 @@ class DateParser : public AllStatic {
   // [4]: minute
   // [5]: second
   // [6]: millisecond
-  // [7]: UTC offset in seconds, or null value if no timezone specified
+  // [7]: UTC offset in seconds, or NaN if no timezone specified
   // If parsing fails, return false (content of output array is not defined).
   template <typename Char>
-  static bool Parse(Isolate* isolate, Vector<Char> str, FixedArray output);
+  static bool Parse(Isolate* isolate, Vector<Char> str, double* output);
 
   enum {
     YEAR, MONTH, DAY, HOUR, MINUTE, SECOND, MILLISECOND, UTC_OFFSET, OUTPUT_SIZE
@@ -276,7 +276,7 @@ class DateParser : public AllStatic {
       return hour_ != kNone && minute_ == kNone && TimeComposer::IsMinute(n);
     }
     bool IsUTC() const { return hour_ == 0 && minute_ == 0; }
-    bool Write(FixedArray output);
+    bool Write(double* output);
     bool IsEmpty() { return hour_ == kNone; }
    private:
     int sign_;
@@ -302,7 +302,7 @@ class DateParser : public AllStatic {
       return true;
     }
     void SetHourOffset(int n) { hour_offset_ = n; }
-    bool Write(FixedArray output);
+    bool Write(double* output);
 
     static bool IsMinute(int x) { return Between(x, 0, 59); }
     static bool IsHour(int x) { return Between(x, 0, 23); }
@@ -331,7 +331,7 @@ class DateParser : public AllStatic {
       return false;
     }
     void SetNamedMonth(int n) { named_month_ = n; }
-    bool Write(FixedArray output);
+    bool Write(double* output);
     void set_iso_date() { is_iso_date_ = true; }
     static bool IsMonth(int x) { return Between(x, 1, 12); }
     static bool IsDay(int x) { return Between(x, 1, 31); }
@@ -354,6 +354,14 @@ class DateParser : public AllStatic {
   static DateParser::DateToken ParseES5DateTime(
       DateStringTokenizer<Char>* scanner, DayComposer* day, TimeComposer* time,
       TimeZoneComposer* tz);
+
+  // Parses the fixed-width ES5 Date Time Strings produced by
+  // Date.prototype.toISOString and most log formats without tokenizing:
+  //   yyyy-MM-DD[THH:mm[:ss[.sss]][Z]]
+  // Returns false if the string has any other shape or a component is out of
+  // range, in which case the general parser decides.
+  template <typename Char>
+  static bool ParseFixedWidthES5DateTime(Vector<Char> str, double* output);
 };
 
 
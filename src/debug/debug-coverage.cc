@@ -622,8 +622,10 @@ void Coverage::SelectMode(Isolate* isolate, debug::Coverage::Mode mode) {
     case debug::Coverage::kPreciseCount: {
       HandleScope scope(isolate);
 
-      // Remove all optimized function. Optimized and inlined functions do not
-      // increment invocation count.
+      // Remove all optimized functions and discard pending optimization jobs.
+      // Code optimized before this point does not increment invocation
+      // counts; code optimized from now on does.
+      isolate->AbortConcurrentOptimization(BlockingBehavior::kBlock);
       Deoptimizer::DeoptimizeAll(isolate);
 
       // Root all feedback vectors to avoid early collection.
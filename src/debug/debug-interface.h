@@ -193,6 +193,11 @@ void ResetBlackboxedStateCache(Isolate* isolate,
 
 int EstimatedValueSize(Isolate* isolate, v8::Local<v8::Value> value);
 
+// Like v8::Object::PreviewEntries, but collects at most {max_entries} entries
+// so that previews of huge collections do not copy all of them.
+MaybeLocal<Array> PreviewEntries(Local<Object> object, int max_entries,
+                                 bool* is_key_value);
+
 enum Builtin { kStringToLowerCase };
 
 Local<Function> GetBuiltin(Isolate* isolate, Builtin builtin);
@@ -522,7 +527,10 @@ struct PropertyDescriptor {
 
 class PropertyIterator {
  public:
-  static std::unique_ptr<PropertyIterator> Create(v8::Local<v8::Object> object);
+  // If {skip_indices} is true, array index properties (elements) are not
+  // reported, which avoids collecting their keys altogether.
+  static std::unique_ptr<PropertyIterator> Create(v8::Local<v8::Object> object,
+                                                  bool skip_indices = false);
 
   virtual ~PropertyIterator() = default;
 
@@ -14,21 +14,23 @@
 namespace v8 {
 
 std::unique_ptr<debug::PropertyIterator> debug::PropertyIterator::Create(
-    v8::Local<v8::Object> v8_object) {
+    v8::Local<v8::Object> v8_object, bool skip_indices) {
   internal::Isolate* isolate =
       reinterpret_cast<internal::Isolate*>(v8_object->GetIsolate());
   return std::unique_ptr<debug::PropertyIterator>(
-      new internal::DebugPropertyIterator(isolate,
-                                          Utils::OpenHandle(*v8_object)));
+      new internal::DebugPropertyIterator(
+          isolate, Utils::OpenHandle(*v8_object), skip_indices));
 }
 
 namespace internal {
 
 DebugPropertyIterator::DebugPropertyIterator(Isolate* isolate,
-                                             Handle<JSReceiver> receiver)
+                                             Handle<JSReceiver> receiver,
+                                             bool skip_indices)
     : isolate_(isolate),
       prototype_iterator_(isolate, receiver, kStartAtReceiver,
-                          PrototypeIterator::END_AT_NULL) {
+                          PrototypeIterator::END_AT_NULL),
+      skip_indices_(skip_indices) {
   if (receiver->IsJSProxy()) {
     is_own_ = false;
     prototype_iterator_.AdvanceIgnoringProxies();
@@ -87,10 +89,10 @@ Handle<Name> DebugPropertyIterator::raw_name() const {
   DCHECK(!Done());
   if (stage_ == kExoticIndices) {
     return isolate_->factory()->Uint32ToString(current_key_index_);
-  } else {
-    return Handle<Name>::cast(
-        FixedArray::get(*keys_, current_key_index_, isolate_));
   }
+  Handle<Object> key = FixedArray::get(*keys_, current_key_index_, isolate_);
+  if (key->IsNumber()) return isolate_->factory()->NumberToString(key);
+  return Handle<Name>::cast(key);
 }
 
 v8::Local<v8::Name> DebugPropertyIterator::name() const {
@@ -134,8 +136,10 @@ bool DebugPropertyIterator::is_own() { return is_own_; }
 
 bool DebugPropertyIterator::is_array_index() {
   if (stage_ == kExoticIndices) return true;
+  Object* key = keys_->get(current_key_index_);
+  if (key->IsNumber()) return true;
   uint32_t index = 0;
-  return raw_name()->AsArrayIndex(&index);
+  return Name::cast(key)->AsArrayIndex(&index);
 }
 
 void DebugPropertyIterator::FillKeysForCurrentPrototypeAndStage() {
@@ -147,16 +151,16 @@ void DebugPropertyIterator::FillKeysForCurrentPrototypeAndStage() {
       PrototypeIterator::GetCurrent<JSReceiver>(prototype_iterator_);
   bool has_exotic_indices = receiver->IsJSTypedArray();
   if (stage_ == kExoticIndices) {
-    if (!has_exotic_indices) return;
+    if (!has_exotic_indices || skip_indices_) return;
     exotic_length_ = static_cast<uint32_t>(
         Handle<JSTypedArray>::cast(receiver)->length_value());
     return;
   }
-  bool skip_indices = has_exotic_indices;
+  bool skip_indices = has_exotic_indices || skip_indices_;
   PropertyFilter filter =
       stage_ == kEnumerableStrings ? ENUMERABLE_STRINGS : ALL_PROPERTIES;
   if (!KeyAccumulator::GetKeys(receiver, KeyCollectionMode::kOwnOnly, filter,
-                               GetKeysConversion::kConvertToString, false,
+                               GetKeysConversion::kKeepNumbers, false,
                                skip_indices)
            .ToHandle(&keys_)) {
     keys_ = Handle<FixedArray>::null();
@@ -19,7 +19,8 @@ class JSReceiver;
 
 class DebugPropertyIterator final : public debug::PropertyIterator {
  public:
-  DebugPropertyIterator(Isolate* isolate, Handle<JSReceiver> receiver);
+  DebugPropertyIterator(Isolate* isolate, Handle<JSReceiver> receiver,
+                        bool skip_indices);
   ~DebugPropertyIterator() override = default;
 
   bool Done() const override;
@@ -43,10 +44,13 @@ class DebugPropertyIterator final : public debug::PropertyIterator {
 
   Isolate* isolate_;
   PrototypeIterator prototype_iterator_;
+  bool skip_indices_;
   enum Stage { kExoticIndices = 0, kEnumerableStrings = 1, kAllProperties = 2 };
   Stage stage_ = kExoticIndices;
 
   uint32_t current_key_index_ = 0;
+  // Array index keys are kept as numbers and only converted to strings when
+  // their name is requested.
   Handle<FixedArray> keys_;
   uint32_t exotic_length_ = 0;
 
@@ -1163,9 +1163,8 @@ class RedirectActiveFunctions : public ThreadVisitor {
 
 void Debug::DeoptimizeFunction(Handle<SharedFunctionInfo> shared) {
   // Deoptimize all code compiled from this shared function info including
-  // inlining.
-  isolate_->AbortConcurrentOptimization(BlockingBehavior::kBlock);
-
+  // inlining. Concurrent jobs are left running; code that inlines a function
+  // with break info is discarded when the job is finalized.
   // TODO(mlippautz): Try to remove this call.
   isolate_->heap()->PreciseCollectAllGarbage(
       Heap::kNoGCFlags, GarbageCollectionReason::kDebugger);
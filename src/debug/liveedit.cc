@@ -1128,7 +1128,10 @@ void LiveEdit::PatchScript(Isolate* isolate, Handle<Script> script,
     start_position_to_unchanged_id[mapping.second->start_position()] =
         mapping.second->function_literal_id();
 
-    if (sfi->HasUncompiledDataWithPreParsedScope()) {
+    // Preparsed scope data refers to inner functions by absolute source
+    // position, so it can be reused as long as the function didn't move.
+    if (sfi->HasUncompiledDataWithPreParsedScope() &&
+        mapping.first->start_position() != mapping.second->start_position()) {
       sfi->ClearPreParsedScopeData();
     }
 
@@ -7,6 +7,7 @@
 #include <memory>
 
 #include "src/accessors.h"
+#include "src/api-inl.h"
 #include "src/assembler-inl.h"
 #include "src/ast/prettyprinter.h"
 #include "src/callable.h"
@@ -508,6 +509,9 @@ Deoptimizer::Deoptimizer(Isolate* isolate, JSFunction function,
     // If the function is optimized, and we haven't counted that deopt yet, then
     // increment the function's deopt count so that we can avoid optimising
     // functions that deopt too often.
+    int previous_deopt_count =
+        function.is_null() ? 0 : function->feedback_vector()->deopt_count();
+    bool deopt_loop = false;
 
     if (deopt_kind_ == DeoptimizeKind::kSoft) {
       // Soft deopts shouldn't count against the overall deoptimization count
@@ -515,6 +519,24 @@ Deoptimizer::Deoptimizer(Isolate* isolate, JSFunction function,
       isolate->counters()->soft_deopts_executed()->Increment();
     } else if (!function.is_null()) {
       function->feedback_vector()->increment_deopt_count();
+      if (deopt_kind_ == DeoptimizeKind::kEager &&
+          compiled_code_->kind() == Code::OPTIMIZED_FUNCTION) {
+        DeoptimizeReason reason =
+            GetDeoptInfo(compiled_code_, from_).deopt_reason;
+        deopt_loop = function->feedback_vector()->RecordDeoptimization(reason);
+        if (deopt_loop && (FLAG_trace_deopt || FLAG_trace_opt)) {
+          PrintF("[detected deoptimization loop in ");
+          function->ShortPrint();
+          PrintF(" (%s, %d times in a row), reoptimizing with conservative "
+                 "speculation]\n",
+                 DeoptimizeReasonToString(reason), FLAG_deopt_loop_threshold);
+        }
+      }
+    }
+    if (isolate->deoptimization_callback() != nullptr &&
+        compiled_code_->kind() == Code::OPTIMIZED_FUNCTION &&
+        !function.is_null()) {
+      CallDeoptimizationCallback(previous_deopt_count, deopt_loop);
     }
   }
   if (compiled_code_->kind() == Code::OPTIMIZED_FUNCTION) {
@@ -528,6 +550,28 @@ Deoptimizer::Deoptimizer(Isolate* isolate, JSFunction function,
   input_ = new (size) FrameDescription(size, parameter_count);
 }
 
+void Deoptimizer::CallDeoptimizationCallback(int previous_deopt_count,
+                                             bool deopt_loop) {
+  DeoptimizationData data =
+      DeoptimizationData::cast(compiled_code_->deoptimization_data());
+  DeoptimizeReason reason = DeoptimizeReason::kUnknown;
+  if (deopt_kind_ != DeoptimizeKind::kLazy) {
+    reason = GetDeoptInfo(compiled_code_, from_).deopt_reason;
+  }
+  HandleScope scope(isolate_);
+  v8::DeoptimizationInfo info;
+  info.function = Utils::ToLocal(handle(function_, isolate_));
+  info.kind = MessageFor(deopt_kind_);
+  info.reason = DeoptimizeReasonToString(reason);
+  info.bytecode_offset = data->BytecodeOffset(bailout_id_).ToInt();
+  info.deopt_count = function_->feedback_vector()->deopt_count();
+  info.reoptimized = previous_deopt_count > 0;
+  info.deopt_loop = deopt_loop;
+  isolate_->deoptimization_callback()(reinterpret_cast<v8::Isolate*>(isolate_),
+                                      info,
+                                      isolate_->deoptimization_callback_data());
+}
+
 Code Deoptimizer::FindOptimizedCode() {
   Code compiled_code = FindDeoptimizingCode(from_);
   return !compiled_code.is_null() ? compiled_code
@@ -554,6 +554,7 @@ class Deoptimizer : public Malloced {
   Deoptimizer(Isolate* isolate, JSFunction function, DeoptimizeKind kind,
               unsigned bailout_id, Address from, int fp_to_sp_delta);
   Code FindOptimizedCode();
+  void CallDeoptimizationCallback(int previous_deopt_count, bool deopt_loop);
   void PrintFunctionName();
   void DeleteFrameDescriptions();
 
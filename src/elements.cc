@@ -5,6 +5,7 @@
 #include "src/elements.h"
 
 #include "src/arguments.h"
+#include "src/base/bits.h"
 #include "src/conversions.h"
 #include "src/frames.h"
 #include "src/heap/factory.h"
@@ -21,6 +22,11 @@
 #include "src/objects/slots.h"
 #include "src/utils.h"
 
+#if V8_HOST_ARCH_X64 || V8_HOST_ARCH_IA32
+#include <emmintrin.h>
+#define V8_ELEMENTS_SIMD_SSE2 1
+#endif
+
 // Each concrete ElementsAccessor can handle exactly one ElementsKind,
 // several abstract ElementsAccessor classes are used to allow sharing
 // common code.
@@ -67,6 +73,102 @@ static const int kPackedSizeNotKnown = -1;
 
 enum Where { AT_START, AT_END };
 
+// Converts {length} floating point values to int32 like DoubleToInt32. The
+// SIMD truncating conversions produce the same result whenever they don't
+// overflow, which they signal with INT32_MIN; such blocks are redone with
+// the scalar conversion.
+void ConvertToInt32(const double* source, int32_t* destination,
+                    size_t length) {
+  size_t i = 0;
+#if V8_ELEMENTS_SIMD_SSE2
+  const __m128i overflow = _mm_set1_epi32(kMinInt);
+  for (; i + 4 <= length; i += 4) {
+    __m128i low = _mm_cvttpd_epi32(_mm_loadu_pd(source + i));
+    __m128i high = _mm_cvttpd_epi32(_mm_loadu_pd(source + i + 2));
+    __m128i result = _mm_unpacklo_epi64(low, high);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), result);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(result, overflow)) != 0) {
+      for (size_t j = i; j < i + 4; j++) {
+        destination[j] = DoubleToInt32(source[j]);
+      }
+    }
+  }
+#endif
+  for (; i < length; i++) destination[i] = DoubleToInt32(source[i]);
+}
+
+void ConvertToInt32(const float* source, int32_t* destination,
+                    size_t length) {
+  size_t i = 0;
+#if V8_ELEMENTS_SIMD_SSE2
+  const __m128i overflow = _mm_set1_epi32(kMinInt);
+  for (; i + 4 <= length; i += 4) {
+    __m128i result = _mm_cvttps_epi32(_mm_loadu_ps(source + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), result);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(result, overflow)) != 0) {
+      for (size_t j = i; j < i + 4; j++) {
+        destination[j] = DoubleToInt32(source[j]);
+      }
+    }
+  }
+#endif
+  for (; i < length; i++) destination[i] = DoubleToInt32(source[i]);
+}
+
+// Returns the index of the first of the {length} words in {words} equal to
+// {value}, or -1.
+intptr_t FindWord(const Address* words, Address value, size_t length) {
+  size_t i = 0;
+#if V8_ELEMENTS_SIMD_SSE2
+  // SSE2 only compares 32-bit lanes, a word matches if all of its lanes do.
+  const int kLanesPerWord = kPointerSize / 4;
+  const int kWordMask = (1 << kLanesPerWord) - 1;
+  const int kWordsPerVector = 4 / kLanesPerWord;
+  const __m128i needle = kPointerSize == 8
+                             ? _mm_set1_epi64x(static_cast<int64_t>(value))
+                             : _mm_set1_epi32(static_cast<int32_t>(value));
+  for (; i + kWordsPerVector <= length; i += kWordsPerVector) {
+    __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(words + i));
+    int mask =
+        _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle)));
+    if (mask == 0) continue;
+    for (int j = 0; j < kWordsPerVector; j++) {
+      if (((mask >> (j * kLanesPerWord)) & kWordMask) == kWordMask) {
+        return static_cast<intptr_t>(i + j);
+      }
+    }
+  }
+#endif
+  for (; i < length; i++) {
+    if (words[i] == value) return static_cast<intptr_t>(i);
+  }
+  return -1;
+}
+
+// Returns the index of the first of the {length} doubles in {values} equal
+// to {value}, or -1. {value} must not be NaN.
+intptr_t FindDouble(const double* values, double value, size_t length) {
+  DCHECK(!std::isnan(value));
+  size_t i = 0;
+#if V8_ELEMENTS_SIMD_SSE2
+  const __m128d needle = _mm_set1_pd(value);
+  for (; i + 4 <= length; i += 4) {
+    int low = _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(values + i), needle));
+    int high =
+        _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(values + i + 2), needle));
+    int mask = low | (high << 2);
+    if (mask != 0) {
+      return static_cast<intptr_t>(i + base::bits::CountTrailingZeros(mask));
+    }
+  }
+#endif
+  for (; i < length; i++) {
+    if (values[i] == value) return static_cast<intptr_t>(i);
+  }
+  return -1;
+}
+
 
 // First argument in list is the accessor class, the second argument is the
 // accessor ElementsKind, and the third is the backing store class.  Use the
@@ -2256,8 +2358,24 @@ class FastElementsAccessor : public ElementsAccessorBase<Subclass, KindTraits> {
     }
     DCHECK_LE(end, Subclass::GetCapacityImpl(*receiver, receiver->elements()));
 
-    for (uint32_t index = start; index < end; ++index) {
-      Subclass::SetImpl(receiver, index, *obj_value);
+    DisallowHeapAllocation no_gc;
+    if (IsDoubleElementsKind(Subclass::kind())) {
+      FixedDoubleArray elements = FixedDoubleArray::cast(receiver->elements());
+      const double value = obj_value->Number();
+      for (uint32_t index = start; index < end; ++index) {
+        elements->set(index, value);
+      }
+    } else {
+      // Store the same value without barriers and emit a single barrier for
+      // the whole range instead.
+      FixedArray elements = FixedArray::cast(receiver->elements());
+      for (uint32_t index = start; index < end; ++index) {
+        elements->set(index, *obj_value, SKIP_WRITE_BARRIER);
+      }
+      if (obj_value->IsHeapObject()) {
+        FIXED_ARRAY_ELEMENTS_WRITE_BARRIER(receiver->GetIsolate()->heap(),
+                                           elements, start, end - start);
+      }
     }
     return *receiver;
   }
@@ -2822,6 +2940,36 @@ class FastHoleyDoubleElementsAccessor
 };
 
 
+// Returns the index of the first element in [start, end) of {data} that is
+// equal to {value}, or -1. Elements are compared in fixed-size blocks without
+// early exits, which compilers turn into 128-bit vector compares.
+template <typename ctype>
+int64_t SearchTypedElements(const ctype* data, uint32_t start, uint32_t end,
+                            ctype value) {
+  static constexpr uint32_t kBlockSize =
+      sizeof(ctype) >= 32 ? 1 : 32 / sizeof(ctype);
+  // Reads may race with writes to a SharedArrayBuffer, see
+  // FixedTypedArray::get_scalar_from_data_ptr.
+  TSAN_ANNOTATE_IGNORE_READS_BEGIN;
+  uint32_t k = start;
+  for (; end - k >= kBlockSize; k += kBlockSize) {
+    bool found = false;
+    for (uint32_t i = 0; i < kBlockSize; i++) {
+      found |= data[k + i] == value;
+    }
+    if (found) break;
+  }
+  int64_t result = -1;
+  for (; k < end; ++k) {
+    if (data[k] == value) {
+      result = k;
+      break;
+    }
+  }
+  TSAN_ANNOTATE_IGNORE_READS_END;
+  return result;
+}
+
 // Super class for all external element arrays.
 template <ElementsKind Kind, typename ctype>
 class TypedElementsAccessor
@@ -3022,11 +3170,10 @@ class TypedElementsAccessor
       }
     }
 
-    for (uint32_t k = start_from; k < length; ++k) {
-      ctype element_k = elements->get_scalar(k);
-      if (element_k == typed_search_value) return Just(true);
-    }
-    return Just(false);
+    if (start_from >= length) return Just(false);
+    const ctype* data = static_cast<const ctype*>(elements->DataPtr());
+    return Just(SearchTypedElements(data, start_from, length,
+                                    typed_search_value) >= 0);
   }
 
   static Maybe<int64_t> IndexOfValueImpl(Isolate* isolate,
@@ -3073,11 +3220,10 @@ class TypedElementsAccessor
       length = elements->length();
     }
 
-    for (uint32_t k = start_from; k < length; ++k) {
-      ctype element_k = elements->get_scalar(k);
-      if (element_k == typed_search_value) return Just<int64_t>(k);
-    }
-    return Just<int64_t>(-1);
+    if (start_from >= length) return Just<int64_t>(-1);
+    const ctype* data = static_cast<const ctype*>(elements->DataPtr());
+    return Just<int64_t>(
+        SearchTypedElements(data, start_from, length, typed_search_value));
   }
 
   static Maybe<int64_t> LastIndexOfValueImpl(Handle<JSObject> receiver,
@@ -3212,13 +3358,50 @@ class TypedElementsAccessor
   static void CopyBetweenBackingStores(void* source_data_ptr, BackingStore dest,
                                        size_t length, uint32_t offset) {
     DisallowHeapAllocation no_gc;
-    for (uint32_t i = 0; i < length; i++) {
-      // We use scalar accessors to avoid boxing/unboxing, so there are no
-      // allocations.
-      typename SourceTraits::ElementType elem =
-          FixedTypedArray<SourceTraits>::get_scalar_from_data_ptr(
-              source_data_ptr, i);
-      dest->set(offset + i, dest->from(elem));
+    CHECK_LE(offset + length, static_cast<size_t>(dest->length()));
+    const typename SourceTraits::ElementType* source =
+        static_cast<typename SourceTraits::ElementType*>(source_data_ptr);
+    ctype* destination = static_cast<ctype*>(dest->DataPtr()) + offset;
+    // See the comment in FixedTypedArray<Traits>::get_scalar_from_data_ptr
+    // on the racy accesses to shared backing stores.
+    TSAN_ANNOTATE_IGNORE_READS_BEGIN;
+    TSAN_ANNOTATE_IGNORE_WRITES_BEGIN;
+    ConvertElements(source, destination, length);
+    TSAN_ANNOTATE_IGNORE_WRITES_END;
+    TSAN_ANNOTATE_IGNORE_READS_END;
+  }
+
+  // Converts with scalar accessors to avoid boxing/unboxing, in a simple
+  // loop which the C++ compiler can vectorize.
+  template <typename SourceType>
+  static void ConvertElements(const SourceType* source, ctype* destination,
+                              size_t length) {
+    for (size_t i = 0; i < length; i++) {
+      destination[i] = BackingStore::from(source[i]);
+    }
+  }
+
+  // Conversions from floating point to 32-bit integers can't be vectorized
+  // automatically, because ToInt32 is defined modulo 2^32.
+  static void ConvertElements(const double* source, ctype* destination,
+                              size_t length) {
+    if (Kind == INT32_ELEMENTS || Kind == UINT32_ELEMENTS) {
+      ConvertToInt32(source, reinterpret_cast<int32_t*>(destination), length);
+    } else {
+      for (size_t i = 0; i < length; i++) {
+        destination[i] = BackingStore::from(source[i]);
+      }
+    }
+  }
+
+  static void ConvertElements(const float* source, ctype* destination,
+                              size_t length) {
+    if (Kind == INT32_ELEMENTS || Kind == UINT32_ELEMENTS) {
+      ConvertToInt32(source, reinterpret_cast<int32_t*>(destination), length);
+    } else {
+      for (size_t i = 0; i < length; i++) {
+        destination[i] = BackingStore::from(source[i]);
+      }
     }
   }
 
@@ -4462,6 +4645,34 @@ void CopyFastNumberJSArrayElementsToTypedArray(Address raw_context,
   }
 }
 
+intptr_t SearchIdenticalElement(Address raw_elements,
+                                Address raw_search_element,
+                                uintptr_t from_index, uintptr_t length) {
+  DisallowHeapAllocation no_gc;
+  FixedArray elements = FixedArray::cast(ObjectPtr(raw_elements));
+  DCHECK_LE(from_index, length);
+  DCHECK_LE(length, elements->length());
+  const Address* words =
+      reinterpret_cast<const Address*>(elements->data_start().address());
+  intptr_t index = FindWord(words + from_index, raw_search_element,
+                            length - from_index);
+  return index < 0 ? -1 : index + static_cast<intptr_t>(from_index);
+}
+
+intptr_t SearchDoubleElement(Address raw_elements, Address raw_search_element,
+                             uintptr_t from_index, uintptr_t length) {
+  DisallowHeapAllocation no_gc;
+  FixedDoubleArray elements = FixedDoubleArray::cast(ObjectPtr(raw_elements));
+  DCHECK_LE(from_index, length);
+  DCHECK_LE(length, elements->length());
+  const double search_value = ObjectPtr(raw_search_element)->Number();
+  const double* values = reinterpret_cast<const double*>(
+      elements->address() + FixedDoubleArray::OffsetOfElementAt(0));
+  intptr_t index =
+      FindDouble(values + from_index, search_value, length - from_index);
+  return index < 0 ? -1 : index + static_cast<intptr_t>(from_index);
+}
+
 void CopyTypedArrayElementsToTypedArray(Address raw_source,
                                         Address raw_destination,
                                         uintptr_t length, uintptr_t offset) {
@@ -4569,3 +4780,5 @@ ElementsAccessor** ElementsAccessor::elements_accessors_ = nullptr;
 #undef ELEMENTS_LIST
 }  // namespace internal
 }  // namespace v8
+
+#undef V8_ELEMENTS_SIMD_SSE2
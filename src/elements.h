@@ -237,6 +237,18 @@ void CopyFastNumberJSArrayElementsToTypedArray(Address raw_context,
                                                Address raw_destination,
                                                uintptr_t length,
                                                uintptr_t offset);
+// {raw_elements}: FixedArray pointer.
+// Returns the first index in [from_index, length) whose element is the
+// tagged value {raw_search_element}, or -1.
+intptr_t SearchIdenticalElement(Address raw_elements,
+                                Address raw_search_element,
+                                uintptr_t from_index, uintptr_t length);
+// {raw_elements}: FixedDoubleArray pointer, {raw_search_element}: Number.
+// Returns the first index in [from_index, length) whose element is equal to
+// the value of {raw_search_element}, which must not be NaN, or -1. Holes
+// never match.
+intptr_t SearchDoubleElement(Address raw_elements, Address raw_search_element,
+                             uintptr_t from_index, uintptr_t length);
 // {raw_source}, {raw_destination}: JSTypedArray pointers.
 void CopyTypedArrayElementsToTypedArray(Address raw_source,
                                         Address raw_destination,
@@ -11,6 +11,7 @@
 #include "src/isolate-inl.h"
 #include "src/runtime-profiler.h"
 #include "src/vm-state-inl.h"
+#include "src/wasm/wasm-engine.h"
 
 namespace v8 {
 namespace internal {
@@ -539,6 +540,15 @@ Object* StackGuard::HandleInterrupts() {
     isolate_->heap()->DeoptMarkedAllocationSites();
   }
 
+  if (CheckAndClearInterrupt(WASM_CODE_GC)) {
+    if (FLAG_trace_interrupts) {
+      if (any_interrupt_handled) PrintF(", ");
+      PrintF("WASM_CODE_GC");
+      any_interrupt_handled = true;
+    }
+    isolate_->wasm_engine()->ReportLiveCodeFromStackForGC(isolate_);
+  }
+
   if (CheckAndClearInterrupt(INSTALL_CODE)) {
     if (FLAG_trace_interrupts) {
       if (any_interrupt_handled) PrintF(", ");
@@ -137,9 +137,9 @@ ExternalReference ExternalReference::handle_scope_implementer_address(
   return ExternalReference(isolate->handle_scope_implementer_address());
 }
 
-ExternalReference ExternalReference::default_microtask_queue_address(
+ExternalReference ExternalReference::running_microtask_queue_address(
     Isolate* isolate) {
-  return ExternalReference(isolate->default_microtask_queue_address());
+  return ExternalReference(isolate->running_microtask_queue_address());
 }
 
 ExternalReference ExternalReference::interpreter_dispatch_table_address(
@@ -662,6 +662,8 @@ FUNCTION_REFERENCE(copy_fast_number_jsarray_elements_to_typed_array,
 FUNCTION_REFERENCE(copy_typed_array_elements_to_typed_array,
                    CopyTypedArrayElementsToTypedArray)
 FUNCTION_REFERENCE(copy_typed_array_elements_slice, CopyTypedArrayElementsSlice)
+FUNCTION_REFERENCE(search_identical_element, SearchIdenticalElement)
+FUNCTION_REFERENCE(search_double_element, SearchDoubleElement)
 FUNCTION_REFERENCE(try_internalize_string_function,
                    StringTable::LookupStringIfExists_NoAllocate)
 
@@ -740,6 +742,11 @@ ExternalReference ExternalReference::
           ->promise_hook_or_debug_is_active_or_async_event_delegate_address());
 }
 
+ExternalReference ExternalReference::has_context_promise_hooks_address(
+    Isolate* isolate) {
+  return ExternalReference(isolate->has_context_promise_hooks_address());
+}
+
 ExternalReference ExternalReference::debug_execution_mode_address(
     Isolate* isolate) {
   return ExternalReference(isolate->debug_execution_mode_address());
@@ -851,6 +858,11 @@ ExternalReference ExternalReference::call_enqueue_microtask_function() {
       Redirect(FUNCTION_ADDR(MicrotaskQueue::CallEnqueueMicrotask)));
 }
 
+ExternalReference ExternalReference::call_refill_run_countdown_function() {
+  return ExternalReference(
+      Redirect(FUNCTION_ADDR(MicrotaskQueue::CallRefillRunCountdown)));
+}
+
 static int64_t atomic_pair_load(intptr_t address) {
   return std::atomic_load(reinterpret_cast<std::atomic<int64_t>*>(address));
 }
@@ -27,8 +27,8 @@ class StatsCounter;
   V(builtins_address, "builtins")                                              \
   V(handle_scope_implementer_address,                                          \
     "Isolate::handle_scope_implementer_address")                               \
-  V(default_microtask_queue_address,                                           \
-    "Isolate::default_microtask_queue_address()")                              \
+  V(running_microtask_queue_address,                                           \
+    "Isolate::running_microtask_queue_address()")                              \
   V(address_of_interpreter_entry_trampoline_instruction_start,                 \
     "Address of the InterpreterEntryTrampoline instruction start")             \
   V(interpreter_dispatch_counters, "Interpreter::dispatch_counters")           \
@@ -60,6 +60,8 @@ class StatsCounter;
   V(promise_hook_or_debug_is_active_or_async_event_delegate_address,           \
     "Isolate::promise_hook_or_debug_is_active_or_async_event_delegate_"        \
     "address()")                                                               \
+  V(has_context_promise_hooks_address,                                         \
+    "Isolate::has_context_promise_hooks_address()")                            \
   V(debug_execution_mode_address, "Isolate::debug_execution_mode_address()")   \
   V(debug_is_active_address, "Debug::is_active_address()")                     \
   V(debug_hook_on_function_call_address,                                       \
@@ -147,6 +149,8 @@ class StatsCounter;
   V(power_double_double_function, "power_double_double_function")             \
   V(printf_function, "printf")                                                \
   V(refill_math_random, "MathRandom::RefillCache")                            \
+  V(search_double_element, "search_double_element")                           \
+  V(search_identical_element, "search_identical_element")                     \
   V(search_string_raw_one_one, "search_string_raw_one_one")                   \
   V(search_string_raw_one_two, "search_string_raw_one_two")                   \
   V(search_string_raw_two_one, "search_string_raw_two_one")                   \
@@ -186,6 +190,8 @@ class StatsCounter;
   V(wasm_memory_copy, "wasm::memory_copy")                                    \
   V(wasm_memory_fill, "wasm::memory_fill")                                    \
   V(call_enqueue_microtask_function, "MicrotaskQueue::CallEnqueueMicrotask")  \
+  V(call_refill_run_countdown_function,                                       \
+    "MicrotaskQueue::CallRefillRunCountdown")                                 \
   V(call_enter_context_function, "call_enter_context_function")               \
   V(atomic_pair_load_function, "atomic_pair_load_function")                   \
   V(atomic_pair_store_function, "atomic_pair_store_function")                 \
@@ -96,6 +96,7 @@ INT32_ACCESSORS(FeedbackVector, length, kLengthOffset)
 INT32_ACCESSORS(FeedbackVector, invocation_count, kInvocationCountOffset)
 INT32_ACCESSORS(FeedbackVector, profiler_ticks, kProfilerTicksOffset)
 INT32_ACCESSORS(FeedbackVector, deopt_count, kDeoptCountOffset)
+INT32_ACCESSORS(FeedbackVector, deopt_history, kDeoptHistoryOffset)
 
 bool FeedbackVector::is_empty() const { return length() == 0; }
 
@@ -112,6 +113,10 @@ void FeedbackVector::increment_deopt_count() {
   }
 }
 
+bool FeedbackVector::has_conservative_speculation() const {
+  return ConservativeSpeculationBit::decode(deopt_history());
+}
+
 Code FeedbackVector::optimized_code() const {
   MaybeObject slot = optimized_code_weak_or_smi();
   DCHECK(slot->IsSmi() || slot->IsWeakOrCleared());
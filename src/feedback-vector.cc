@@ -219,6 +219,7 @@ Handle<FeedbackVector> FeedbackVector::New(Isolate* isolate,
   DCHECK_EQ(vector->invocation_count(), 0);
   DCHECK_EQ(vector->profiler_ticks(), 0);
   DCHECK_EQ(vector->deopt_count(), 0);
+  DCHECK_EQ(vector->deopt_history(), 0);
 
   // Ensure we can skip the write barrier
   Handle<Object> uninitialized_sentinel = UninitializedSentinel(isolate);
@@ -352,6 +353,25 @@ void FeedbackVector::EvictOptimizedCodeMarkedForDeoptimization(
   }
 }
 
+bool FeedbackVector::RecordDeoptimization(DeoptimizeReason reason) {
+  int history = deopt_history();
+  int count = 1;
+  if (LastDeoptReasonBits::decode(history) == reason) {
+    count = std::min(RepeatedDeoptCountBits::decode(history) + 1,
+                     RepeatedDeoptCountBits::kMax);
+  }
+  history = LastDeoptReasonBits::update(history, reason);
+  history = RepeatedDeoptCountBits::update(history, count);
+  bool loop_detected = FLAG_deopt_loop_threshold > 0 &&
+                       count == FLAG_deopt_loop_threshold &&
+                       !ConservativeSpeculationBit::decode(history);
+  if (loop_detected) {
+    history = ConservativeSpeculationBit::update(history, true);
+  }
+  set_deopt_history(history);
+  return loop_detected;
+}
+
 bool FeedbackVector::ClearSlots(Isolate* isolate) {
   MaybeObject uninitialized_sentinel = MaybeObject::FromObject(
       FeedbackVector::RawUninitializedSentinel(isolate));
@@ -9,6 +9,7 @@
 
 #include "src/base/logging.h"
 #include "src/base/macros.h"
+#include "src/deoptimize-reason.h"
 #include "src/elements-kind.h"
 #include "src/globals.h"
 #include "src/objects/map.h"
@@ -182,9 +183,25 @@ class FeedbackVector : public HeapObjectPtr {
   // [deopt_count]: The number of times this function has deoptimized.
   DECL_INT32_ACCESSORS(deopt_count)
 
+  // [deopt_history]: The reason of the last eager deoptimization, how many
+  // times in a row the function deoptimized for that reason, and whether it
+  // is reoptimized with conservative speculation because of that.
+  DECL_INT32_ACCESSORS(deopt_history)
+
   inline void clear_invocation_count();
   inline void increment_deopt_count();
 
+  // Records an eager deoptimization for {reason}. Returns true if this
+  // detects a deoptimization loop, i.e. the function deoptimized for the same
+  // {reason} FLAG_deopt_loop_threshold times in a row. Once that happened,
+  // the function is optimized with conservative speculation from then on.
+  bool RecordDeoptimization(DeoptimizeReason reason);
+  inline bool has_conservative_speculation() const;
+
+  class LastDeoptReasonBits : public BitField<DeoptimizeReason, 0, 8> {};
+  class RepeatedDeoptCountBits : public BitField<int, 8, 8> {};
+  class ConservativeSpeculationBit : public BitField<bool, 16, 1> {};
+
   inline Code optimized_code() const;
   inline OptimizationMarker optimization_marker() const;
   inline bool has_optimized_code() const;
@@ -286,6 +303,7 @@ class FeedbackVector : public HeapObjectPtr {
   V(kInvocationCountOffset, kInt32Size)      \
   V(kProfilerTicksOffset, kInt32Size)        \
   V(kDeoptCountOffset, kInt32Size)           \
+  V(kDeoptHistoryOffset, kInt32Size)         \
   V(kUnalignedHeaderSize, 0)
 
   DEFINE_FIELD_OFFSET_CONSTANTS(HeapObject::kHeaderSize, FEEDBACK_VECTOR_FIELDS)
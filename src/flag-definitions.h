@@ -352,11 +352,19 @@ DEFINE_INT(interrupt_budget, 144 * KB,
 DEFINE_BOOL(ignition_elide_noneffectful_bytecodes, true,
             "elide bytecodes which won't have any external effect")
 DEFINE_BOOL(ignition_reo, true, "use ignition register equivalence optimizer")
+DEFINE_BOOL(ignition_short_star, false,
+            "emit one-byte Star bytecodes for the first registers")
 DEFINE_BOOL(ignition_filter_expression_positions, true,
             "filter expression positions before the bytecode pipeline")
 DEFINE_BOOL(ignition_share_named_property_feedback, true,
             "share feedback slots when loading the same named property from "
             "the same object")
+DEFINE_BOOL(lazy_feedback_allocation, false,
+            "allocate feedback vectors only once functions have run for a while")
+DEFINE_INT(invocations_for_feedback_vector_allocation, 8,
+           "approximate number of invocations (measured as executed bytecode) "
+           "after which a function gets a feedback vector with "
+           "--lazy-feedback-allocation")
 DEFINE_BOOL(print_bytecode, false,
             "print bytecode generated by ignition interpreter")
 DEFINE_STRING(print_bytecode_filter, "*",
@@ -383,6 +391,9 @@ DEFINE_BOOL(fast_math, true, "faster (but maybe less accurate) math functions")
 DEFINE_BOOL(trace_track_allocation_sites, false,
             "trace the tracking of allocation sites")
 DEFINE_BOOL(trace_migration, false, "trace object migration")
+DEFINE_BOOL(batch_instance_migration, false,
+            "migrate all instances of deprecated maps in one task instead of "
+            "lazily on their next access")
 DEFINE_BOOL(trace_generalization, false, "trace map generalization")
 
 // Flags for concurrent recompilation.
@@ -392,6 +403,9 @@ DEFINE_BOOL(trace_concurrent_recompilation, false,
             "track concurrent recompilation")
 DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
+DEFINE_INT(concurrent_recompilation_max_tasks, 0,
+           "the maximum number of concurrent compilation tasks, 0 for one per "
+           "worker thread")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
 DEFINE_BOOL(block_concurrent_recompilation, false,
@@ -486,8 +500,12 @@ DEFINE_BOOL(inline_accessors, true, "inline JavaScript accessors")
 DEFINE_BOOL(inline_into_try, true, "inline into try blocks")
 DEFINE_BOOL(turbo_inline_array_builtins, true,
             "inline array builtins in TurboFan code")
+DEFINE_BOOL(turbo_fast_api_calls, false,
+            "call embedder fast C functions directly from TurboFan code")
 DEFINE_BOOL(use_osr, true, "use on-stack replacement")
 DEFINE_BOOL(trace_osr, false, "trace on-stack replacement")
+DEFINE_BOOL(concurrent_osr, true,
+            "compile on-stack replacement code on a separate thread")
 DEFINE_BOOL(analyze_environment_liveness, true,
             "analyze liveness of environment slots and zap dead values")
 DEFINE_BOOL(trace_environment_liveness, false,
@@ -499,14 +517,27 @@ DEFINE_BOOL(turbo_profiling, false, "enable profiling in TurboFan")
 DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
             "verify register allocation in TurboFan")
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
+DEFINE_INT(turbo_fast_register_allocation_size, 20000,
+           "use the fast register allocation mode for code with at least this "
+           "many instructions (0 means never)")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "Turbofan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "Turbofan loop variable optimization")
+DEFINE_BOOL(turbo_bounds_check_elimination, true,
+            "remove bounds checks implied by loop conditions in TurboFan")
 DEFINE_BOOL(turbo_loop_rotation, true, "Turbofan loop rotation")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
+DEFINE_INT(turbo_fast_pipeline_bytecode_size, 32 * KB,
+           "use the reduced TurboFan pipeline for functions with at least "
+           "this many bytes of bytecode (0 means never)")
 DEFINE_BOOL(turbo_allocation_folding, true, "Turbofan allocation folding")
-DEFINE_BOOL(turbo_instruction_scheduling, false,
+#if V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_ARM64
+#define V8_TURBO_INSTRUCTION_SCHEDULING_BOOL true
+#else
+#define V8_TURBO_INSTRUCTION_SCHEDULING_BOOL false
+#endif
+DEFINE_BOOL(turbo_instruction_scheduling, V8_TURBO_INSTRUCTION_SCHEDULING_BOOL,
             "enable instruction scheduling in TurboFan")
 DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
             "randomly schedule instructions to stress dependency tracking")
@@ -545,6 +576,12 @@ DEFINE_BOOL(wasm_async_compilation, true,
             "enable actual asynchronous compilation for WebAssembly.compile")
 DEFINE_BOOL(wasm_test_streaming, false,
             "use streaming compilation instead of async compilation for tests")
+DEFINE_BOOL(wasm_native_module_cache, false,
+            "reuse the native module of an earlier compilation of the same "
+            "wire bytes in any isolate")
+DEFINE_BOOL(wasm_code_gc, false,
+            "free wasm code which got replaced by tier-up once it is not on "
+            "any stack anymore")
 DEFINE_UINT(wasm_max_mem_pages, v8::internal::wasm::kV8MaxWasmMemoryPages,
             "maximum number of 64KiB memory pages of a wasm instance")
 DEFINE_UINT(wasm_max_table_size, v8::internal::wasm::kV8MaxWasmTableSize,
@@ -628,7 +665,7 @@ DEFINE_BOOL(wasm_shared_code, true,
 DEFINE_IMPLICATION(future, wasm_shared_code)
 DEFINE_BOOL(wasm_trap_handler, true,
             "use signal handlers to catch out of bounds memory access in wasm"
-            " (currently Linux x86_64 only)")
+            " (currently x64, and native arm64 on Linux)")
 DEFINE_BOOL(wasm_trap_handler_fallback, false,
             "Use bounds checks if guarded memory is not available")
 DEFINE_BOOL(wasm_fuzzer_gen_test, false,
@@ -644,6 +681,8 @@ DEFINE_BOOL(wasm_lazy_compilation, false,
             "enable lazy compilation for all wasm modules")
 DEFINE_DEBUG_BOOL(trace_wasm_lazy_compilation, false,
                   "trace lazy compilation of wasm functions")
+DEFINE_BOOL(wasm_lazy_relocation, false,
+            "relocate deserialized wasm functions on their first call")
 // wasm-interpret-all resets {asm-,}wasm-lazy-compilation.
 DEFINE_NEG_IMPLICATION(wasm_interpret_all, asm_wasm_lazy_compilation)
 DEFINE_NEG_IMPLICATION(wasm_interpret_all, wasm_lazy_compilation)
@@ -669,6 +708,9 @@ DEFINE_BOOL(experimental_new_space_growth_heuristic, false,
             "of their absolute value.")
 DEFINE_SIZE_T(max_old_space_size, 0, "max size of the old space (in Mbytes)")
 DEFINE_SIZE_T(initial_old_space_size, 0, "initial old space size (in Mbytes)")
+DEFINE_SIZE_T(page_pool_size, 0,
+              "size of the process-wide pool of free heap pages which is "
+              "shared between isolates (in Mbytes)")
 DEFINE_BOOL(gc_global, false, "always perform global GCs")
 DEFINE_INT(random_gc_interval, 0,
            "Collect garbage after random(0, X) allocations. It overrides "
@@ -703,9 +745,15 @@ DEFINE_BOOL(trace_mutator_utilization, false,
 DEFINE_BOOL(incremental_marking, true, "use incremental marking")
 DEFINE_BOOL(incremental_marking_wrappers, true,
             "use incremental marking for marking wrappers")
+DEFINE_BOOL(incremental_marking_schedule, true,
+            "pace incremental marking steps using the allocation rate, so "
+            "that marking finishes when the allocation limit is reached")
 DEFINE_BOOL(trace_unmapper, false, "Trace the unmapping")
 DEFINE_BOOL(parallel_scavenge, true, "parallel scavenge")
 DEFINE_BOOL(trace_parallel_scavenge, false, "trace parallel scavenge")
+DEFINE_BOOL(overlap_scavenge_roots, true,
+            "copy the roots while background tasks already scavenge old to "
+            "new pages")
 #if defined(V8_TARGET_ARCH_ARM)
 #define V8_WRITE_PROTECT_CODE_MEMORY_BOOL false
 #else
@@ -724,6 +772,8 @@ DEFINE_BOOL(parallel_marking, true, "use parallel marking in atomic pause")
 DEFINE_INT(ephemeron_fixpoint_iterations, 10,
            "number of fixpoint iterations it takes to switch to linear "
            "ephemeron algorithm")
+DEFINE_BOOL(incremental_ephemerons, true,
+            "resolve ephemerons during incremental and concurrent marking")
 DEFINE_BOOL(trace_concurrent_marking, false, "trace concurrent marking")
 DEFINE_BOOL(black_allocation, true, "use black allocation")
 DEFINE_BOOL(concurrent_store_buffer, true,
@@ -732,6 +782,8 @@ DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
+DEFINE_BOOL(parallel_string_table_cleaning, true,
+            "use parallel string table cleaning in atomic pause")
 DEFINE_BOOL(detect_ineffective_gcs_near_heap_limit, true,
             "trigger out-of-memory failure to avoid GC storm near heap limit")
 DEFINE_BOOL(trace_incremental_marking, false,
@@ -742,6 +794,12 @@ DEFINE_BOOL(track_gc_object_stats, false,
             "track object counts and memory usage")
 DEFINE_BOOL(trace_gc_object_stats, false,
             "trace object counts and memory usage")
+DEFINE_INT(gc_object_stats_sampling_rate, 1,
+           "estimate object statistics from every n-th page of the paged "
+           "spaces in each GC, rotating through the pages across GCs")
+DEFINE_BOOL(trace_pointer_compression_savings, false,
+            "trace how much of the live heap pointer compression would save "
+            "after each mark-compact")
 DEFINE_BOOL(trace_zone_stats, false, "trace zone memory usage")
 DEFINE_BOOL(track_retaining_path, false,
             "enable support for tracking retaining path")
@@ -752,6 +810,7 @@ DEFINE_IMPLICATION(trace_gc_object_stats, track_gc_object_stats)
 DEFINE_VALUE_IMPLICATION(track_gc_object_stats, gc_stats, 1)
 DEFINE_VALUE_IMPLICATION(trace_gc_object_stats, gc_stats, 1)
 DEFINE_NEG_IMPLICATION(trace_gc_object_stats, incremental_marking)
+DEFINE_IMPLICATION(trace_pointer_compression_savings, track_gc_object_stats)
 DEFINE_NEG_IMPLICATION(track_retaining_path, incremental_marking)
 DEFINE_NEG_IMPLICATION(track_retaining_path, parallel_marking)
 DEFINE_NEG_IMPLICATION(track_retaining_path, concurrent_marking)
@@ -767,6 +826,8 @@ DEFINE_BOOL(verify_heap_skip_remembered_set, false,
 #endif
 DEFINE_BOOL(move_object_start, true, "enable moving of object starts")
 DEFINE_BOOL(memory_reducer, true, "use memory reducer")
+DEFINE_BOOL(memory_reducer_shrink_idle_heap, true,
+            "shrink the heap in stages after the memory reducer is done")
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
@@ -774,8 +835,19 @@ DEFINE_BOOL(always_compact, false, "Perform compaction on every full GC")
 DEFINE_BOOL(never_compact, false,
             "Never perform compaction on full GC - testing only")
 DEFINE_BOOL(compact_code_space, true, "Compact code space on full collections")
-DEFINE_BOOL(flush_bytecode, V8_LITE_BOOL,
+DEFINE_INT(code_space_fragmentation_limit, 50,
+           "percentage of free memory in code space above which fragmented "
+           "code pages are evacuated on every full GC")
+DEFINE_SIZE_T(code_space_evacuation_budget_kb, 1024,
+              "maximum amount of code (in KB) evacuated by a single full GC "
+              "when compacting a fragmented code space")
+DEFINE_BOOL(flush_bytecode, true,
             "flush of bytecode when it has not been executed recently")
+DEFINE_INT(bytecode_old_age, 3,
+           "number of full GCs (1 to 5) during which bytecode must not have "
+           "been executed before it is considered old and can be flushed")
+DEFINE_BOOL(trace_flush_bytecode, false,
+            "trace the amount of bytecode flushed by each full GC")
 DEFINE_BOOL(stress_flush_bytecode, false, "stress bytecode flushing")
 DEFINE_IMPLICATION(stress_flush_bytecode, flush_bytecode)
 DEFINE_BOOL(use_marking_progress_bar, true,
@@ -815,7 +887,7 @@ DEFINE_BOOL(fast_promotion_new_space, false,
 
 DEFINE_BOOL(clear_free_memory, false, "initialize free memory with 0")
 
-DEFINE_BOOL(young_generation_large_objects, false,
+DEFINE_BOOL(young_generation_large_objects, true,
             "allocates large objects by default in the young generation large "
             "object space")
 
@@ -905,6 +977,10 @@ DEFINE_BOOL(trace_opt_verbose, false, "extra verbose compilation tracing")
 DEFINE_IMPLICATION(trace_opt_verbose, trace_opt)
 DEFINE_BOOL(trace_opt_stats, false, "trace lazy optimization statistics")
 DEFINE_BOOL(trace_deopt, false, "trace optimize function deoptimization")
+DEFINE_INT(deopt_loop_threshold, 3,
+           "number of consecutive deoptimizations for the same reason after "
+           "which a function is reoptimized with conservative speculation "
+           "(0 means never)")
 DEFINE_BOOL(trace_file_names, false,
             "include file names in trace-opt/trace-deopt output")
 DEFINE_BOOL(trace_interrupts, false, "trace interrupts when they are handled")
@@ -913,6 +989,13 @@ DEFINE_BOOL(always_osr, false, "always try to OSR functions")
 DEFINE_BOOL(prepare_always_opt, false, "prepare for turning on always opt")
 
 DEFINE_BOOL(trace_serializer, false, "print code serializer trace")
+DEFINE_BOOL(code_cache_optimization_hints, false,
+            "record which functions were optimized or inlined in the code "
+            "cache, and optimize and inline them without re-warming after "
+            "deserialization")
+DEFINE_BOOL(code_cache_lazy_functions, false,
+            "only cache top-level code in the code cache and compile inner "
+            "functions lazily after deserialization")
 #ifdef DEBUG
 DEFINE_BOOL(external_reference_stats, false,
             "print statistics on external references used during serialization")
@@ -920,11 +1003,18 @@ DEFINE_BOOL(external_reference_stats, false,
 
 // compilation-cache.cc
 DEFINE_BOOL(compilation_cache, true, "enable compilation cache")
+DEFINE_INT(compilation_cache_script_budget, 0,
+           "keep the most recently used scripts in the compilation cache "
+           "across GCs, up to this many KB of source and bytecode "
+           "(0 evicts scripts once their bytecode is old)")
 
 DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
 // compiler-dispatcher.cc
 DEFINE_BOOL(parallel_compile_tasks, false, "enable parallel compile tasks")
+DEFINE_BOOL(parallel_compile_tasks_for_lazy, false,
+            "also post parallel compile tasks for lazy top-level functions")
+DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, parallel_compile_tasks)
 DEFINE_BOOL(compiler_dispatcher, false, "enable compiler dispatcher")
 DEFINE_IMPLICATION(parallel_compile_tasks, compiler_dispatcher)
 DEFINE_BOOL(trace_compiler_dispatcher, false,
@@ -991,6 +1081,14 @@ DEFINE_BOOL(trace_ic, false,
 DEFINE_IMPLICATION(trace_ic, log_code)
 DEFINE_INT(ic_stats, 0, "inline cache state transitions statistics")
 DEFINE_VALUE_IMPLICATION(trace_ic, ic_stats, 1)
+DEFINE_BOOL(function_ic_stats, true,
+            "count polymorphic and megamorphic inline cache transitions per "
+            "function")
+// stub-cache.cc
+DEFINE_BOOL(stub_cache_adaptive_size, true,
+            "grow the megamorphic stub cache when it evicts too many entries")
+DEFINE_BOOL(trace_stub_cache, false, "trace megamorphic stub cache resizing")
+
 DEFINE_BOOL_READONLY(track_constant_fields, false,
                      "enable constant field tracking")
 DEFINE_BOOL_READONLY(modify_map_inplace, false, "enable in-place map updates")
@@ -1075,6 +1173,11 @@ DEFINE_BOOL(runtime_call_stats, false, "report runtime call counts and times")
 DEFINE_INT(runtime_stats, 0,
            "internal usage only for controlling runtime statistics")
 DEFINE_VALUE_IMPLICATION(runtime_call_stats, runtime_stats, 1)
+DEFINE_BOOL(runtime_call_stats_sampling, false,
+            "only track the active runtime call counter, so that profiler "
+            "ticks can be attributed to it")
+DEFINE_NEG_IMPLICATION(runtime_call_stats_sampling, runtime_call_stats)
+DEFINE_VALUE_IMPLICATION(runtime_call_stats_sampling, runtime_stats, 8)
 
 // snapshot-common.cc
 #ifdef V8_EMBEDDED_BUILTINS
@@ -1102,6 +1205,21 @@ DEFINE_BOOL_READONLY(jitless, false,
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
 DEFINE_BOOL(regexp_mode_modifiers, false, "enable inline flags in regexp.")
+DEFINE_BOOL(regexp_tier_up, true,
+            "interpret regexp bytecode first and compile to native code once "
+            "the regexp has been executed often enough")
+DEFINE_INT(regexp_tier_up_ticks, 1,
+           "number of interpreted executions before a regexp is compiled to "
+           "native code")
+DEFINE_BOOL(regexp_linear_engine, false,
+            "match regexps without backreferences, lookarounds, ignore-case "
+            "or unicode mode with a linear-time automaton")
+DEFINE_BOOL(regexp_linear_fallback, false,
+            "switch such regexps to the linear-time automaton once they "
+            "backtrack excessively")
+DEFINE_INT(regexp_backtracks_before_fallback, 50000,
+           "number of backtracks after which a regexp switches to the "
+           "linear-time automaton, see --regexp-linear-fallback")
 
 // Testing flags test/cctest/test-{flags,api,serialization}.cc
 DEFINE_BOOL(testing_bool_flag, true, "testing_bool_flag")
@@ -1117,6 +1235,10 @@ DEFINE_STRING(embedded_src, nullptr,
 DEFINE_STRING(
     embedded_variant, nullptr,
     "Label to disambiguate symbols in embedded data file. (mksnapshot only)")
+DEFINE_STRING(embedded_builtins_profile, nullptr,
+              "Path of a builtin hotness profile, with one '<builtin name> "
+              "<count>' line per builtin, by which the embedded builtins are "
+              "ordered. (mksnapshot only)")
 DEFINE_STRING(startup_src, nullptr,
               "Write V8 startup as C++ src. (mksnapshot only)")
 DEFINE_STRING(startup_blob, nullptr,
@@ -1131,6 +1253,11 @@ DEFINE_BOOL(minor_mc_parallel_marking, true,
 DEFINE_BOOL(trace_minor_mc_parallel_marking, false,
             "trace parallel marking for the young generation")
 DEFINE_BOOL(minor_mc, false, "perform young generation mark compact GCs")
+DEFINE_INT(minor_mc_page_promotion_threshold, 50,
+           "min percentage of live bytes on a young generation page to move "
+           "it in place during minor mark compact GCs")
+DEFINE_BOOL(trace_minor_mc_page_promotion, false,
+            "trace in-place page promotion of the minor mark compactor")
 #endif  // ENABLE_MINOR_MC
 
 //
@@ -1242,6 +1369,9 @@ DEFINE_BOOL(trace_normalization, false,
 DEFINE_BOOL(trace_lazy, false, "trace lazy compilation")
 
 // spaces.cc
+DEFINE_BOOL(transparent_huge_pages, false,
+            "advise the OS to back heap pages and the code range with "
+            "transparent huge pages")
 DEFINE_BOOL(collect_heap_spill_statistics, false,
             "report heap spill statistics along with heap_stats "
             "(requires heap_stats)")
@@ -1300,6 +1430,9 @@ DEFINE_INT(prof_sampling_interval, DEFAULT_PROF_SAMPLING_INTERVAL,
 
 DEFINE_BOOL(prof_cpp, false, "Like --prof, but ignore generated code.")
 DEFINE_IMPLICATION(prof, prof_cpp)
+DEFINE_BOOL(log_binary_ticks, false,
+            "Log --prof ticks as compact binary records, use "
+            "tools/decode-binary-log.py to turn the log back into text.")
 DEFINE_BOOL(prof_browser_mode, true,
             "Used with --prof, turns on browser-compatible mode for profiling.")
 DEFINE_STRING(logfile, "v8.log", "Specify the name of the log file.")
@@ -1316,7 +1449,6 @@ DEFINE_BOOL(perf_basic_prof_only_functions, false,
 DEFINE_IMPLICATION(perf_basic_prof_only_functions, perf_basic_prof)
 DEFINE_BOOL(perf_prof, false,
             "Enable perf linux profiler (experimental annotate support).")
-DEFINE_NEG_IMPLICATION(perf_prof, compact_code_space)
 // TODO(v8:8462) Remove implication once perf supports remapping.
 DEFINE_NEG_IMPLICATION(perf_prof, write_protect_code_memory)
 DEFINE_NEG_IMPLICATION(perf_prof, wasm_write_protect_code_memory)
@@ -19,21 +19,21 @@ namespace internal {
 
 using AtomicsWaitEvent = v8::Isolate::AtomicsWaitEvent;
 
-base::LazyMutex FutexEmulation::mutex_ = LAZY_MUTEX_INITIALIZER;
-base::LazyInstance<FutexWaitList>::type FutexEmulation::wait_list_ =
-    LAZY_INSTANCE_INITIALIZER;
-
+base::LazyInstance<FutexEmulation::FutexWaitBuckets>::type
+    FutexEmulation::buckets_ = LAZY_INSTANCE_INITIALIZER;
 
 void FutexWaitListNode::NotifyWake() {
-  // Lock the FutexEmulation mutex before notifying. We know that the mutex
-  // will have been unlocked if we are currently waiting on the condition
-  // variable. The mutex will not be locked if FutexEmulation::Wait hasn't
-  // locked it yet. In that case, we set the interrupted_
-  // flag to true, which will be tested after the mutex locked by a future wait.
-  base::MutexGuard lock_guard(FutexEmulation::mutex_.Pointer());
+  // Set the interrupted_ flag before looking for the bucket. A waiter tests
+  // the flag after publishing its bucket, so either it sees the flag, or we
+  // see the bucket. In the latter case, lock the bucket's mutex before
+  // notifying. We know that the mutex will have been unlocked if we are
+  // currently waiting on the condition variable.
+  interrupted_.store(true);
+  FutexWaitBucket* bucket = bucket_.load();
+  if (bucket == nullptr) return;
+  base::MutexGuard lock_guard(&bucket->mutex_);
   // if not waiting, this will not have any effect.
   cond_.NotifyOne();
-  interrupted_ = true;
 }
 
 
@@ -71,17 +71,20 @@ void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
 }
 
 void AtomicsWaitWakeHandle::Wake() {
-  // Adding a separate `NotifyWake()` variant that doesn't acquire the lock
-  // itself would likely just add unnecessary complexity..
-  // The split lock by itself isn’t an issue, as long as the caller properly
-  // synchronizes this with the closing `AtomicsWaitCallback`.
-  {
-    base::MutexGuard lock_guard(FutexEmulation::mutex_.Pointer());
-    stopped_ = true;
-  }
+  // stopped_ is set before the node is interrupted, so the waiter sees it once
+  // it handles the interrupt. This has to be synchronized with the closing
+  // `AtomicsWaitCallback` by the caller.
+  stopped_.store(true);
   isolate_->futex_wait_list_node()->NotifyWake();
 }
 
+// static
+FutexWaitBucket* FutexEmulation::BucketFor(void* backing_store, size_t addr) {
+  // Waits are on naturally aligned 32 or 64 bit values.
+  uintptr_t key = (reinterpret_cast<uintptr_t>(backing_store) + addr) >> 2;
+  return &buckets_.Pointer()->buckets[(key ^ (key >> 8)) % kNumberOfBuckets];
+}
+
 enum WaitReturnValue : int { kOk = 0, kNotEqual = 1, kTimedOut = 2 };
 
 Object* FutexEmulation::WaitJs(Isolate* isolate,
@@ -153,14 +156,18 @@ Object* FutexEmulation::Wait(Isolate* isolate,
   Object* result;
   AtomicsWaitEvent callback_result = AtomicsWaitEvent::kWokenUp;
 
+  void* backing_store = array_buffer->backing_store();
+  FutexWaitBucket* bucket = BucketFor(backing_store, addr);
+  base::Mutex* mutex = &bucket->mutex_;
+
   do {  // Not really a loop, just makes it easier to break out early.
-    base::MutexGuard lock_guard(mutex_.Pointer());
-    void* backing_store = array_buffer->backing_store();
+    base::MutexGuard lock_guard(mutex);
 
     FutexWaitListNode* node = isolate->futex_wait_list_node();
     node->backing_store_ = backing_store;
     node->wait_addr_ = addr;
     node->waiting_ = true;
+    node->bucket_.store(bucket);
 
     // Reset node->waiting_ = false when leaving this scope (but while
     // still holding the lock).
@@ -181,25 +188,24 @@ Object* FutexEmulation::Wait(Isolate* isolate,
       timeout_time = current_time + rel_timeout;
     }
 
-    wait_list_.Pointer()->AddNode(node);
+    bucket->wait_list_.AddNode(node);
 
     while (true) {
-      bool interrupted = node->interrupted_;
-      node->interrupted_ = false;
+      bool interrupted = node->interrupted_.exchange(false);
 
       // Unlock the mutex here to prevent deadlock from lock ordering between
-      // mutex_ and mutexes locked by HandleInterrupts.
-      mutex_.Pointer()->Unlock();
+      // the bucket mutex and mutexes locked by HandleInterrupts.
+      mutex->Unlock();
 
       // Because the mutex is unlocked, we have to be careful about not dropping
       // an interrupt. The notification can happen in three different places:
       // 1) Before Wait is called: the notification will be dropped, but
       //    interrupted_ will be set to 1. This will be checked below.
-      // 2) After interrupted has been checked here, but before mutex_ is
-      //    acquired: interrupted is checked again below, with mutex_ locked.
-      //    Because the wakeup signal also acquires mutex_, we know it will not
-      //    be able to notify until mutex_ is released below, when waiting on
-      //    the condition variable.
+      // 2) After interrupted has been checked here, but before the mutex is
+      //    acquired: interrupted is checked again below, with the mutex
+      //    locked. Because the wakeup signal also acquires the mutex, we know
+      //    it will not be able to notify until the mutex is released below,
+      //    when waiting on the condition variable.
       // 3) After the mutex is released in the call to WaitFor(): this
       // notification will wake up the condition variable. node->waiting() will
       // be false, so we'll loop and then check interrupts.
@@ -208,15 +214,15 @@ Object* FutexEmulation::Wait(Isolate* isolate,
         if (interrupt_object->IsException(isolate)) {
           result = interrupt_object;
           callback_result = AtomicsWaitEvent::kTerminatedExecution;
-          mutex_.Pointer()->Lock();
+          mutex->Lock();
           break;
         }
       }
 
-      mutex_.Pointer()->Lock();
+      mutex->Lock();
 
-      if (node->interrupted_) {
-        // An interrupt occurred while the mutex_ was unlocked. Don't wait yet.
+      if (node->interrupted_.load()) {
+        // An interrupt occurred while the mutex was unlocked. Don't wait yet.
         continue;
       }
 
@@ -241,17 +247,16 @@ Object* FutexEmulation::Wait(Isolate* isolate,
 
         base::TimeDelta time_until_timeout = timeout_time - current_time;
         DCHECK_GE(time_until_timeout.InMicroseconds(), 0);
-        bool wait_for_result =
-            node->cond_.WaitFor(mutex_.Pointer(), time_until_timeout);
+        bool wait_for_result = node->cond_.WaitFor(mutex, time_until_timeout);
         USE(wait_for_result);
       } else {
-        node->cond_.Wait(mutex_.Pointer());
+        node->cond_.Wait(mutex);
       }
 
       // Spurious wakeup, interrupt or timeout.
     }
 
-    wait_list_.Pointer()->RemoveNode(node);
+    bucket->wait_list_.RemoveNode(node);
   } while (false);
 
   isolate->RunAtomicsWaitCallback(callback_result, array_buffer, addr, value,
@@ -272,8 +277,9 @@ Object* FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
   int waiters_woken = 0;
   void* backing_store = array_buffer->backing_store();
 
-  base::MutexGuard lock_guard(mutex_.Pointer());
-  FutexWaitListNode* node = wait_list_.Pointer()->head_;
+  FutexWaitBucket* bucket = BucketFor(backing_store, addr);
+  base::MutexGuard lock_guard(&bucket->mutex_);
+  FutexWaitListNode* node = bucket->wait_list_.head_;
   while (node && num_waiters_to_wake > 0) {
     if (backing_store == node->backing_store_ && addr == node->wait_addr_ &&
         node->waiting_) {
@@ -296,10 +302,11 @@ Object* FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
   DCHECK_LT(addr, array_buffer->byte_length());
   void* backing_store = array_buffer->backing_store();
 
-  base::MutexGuard lock_guard(mutex_.Pointer());
+  FutexWaitBucket* bucket = BucketFor(backing_store, addr);
+  base::MutexGuard lock_guard(&bucket->mutex_);
 
   int waiters = 0;
-  FutexWaitListNode* node = wait_list_.Pointer()->head_;
+  FutexWaitListNode* node = bucket->wait_list_.head_;
   while (node) {
     if (backing_store == node->backing_store_ && addr == node->wait_addr_ &&
         node->waiting_) {
@@ -6,6 +6,7 @@
 #define V8_FUTEX_EMULATION_H_
 
 #include <stdint.h>
+#include <atomic>
 
 #include "src/allocation.h"
 #include "src/base/atomicops.h"
@@ -17,7 +18,9 @@
 // Support for emulating futexes, a low-level synchronization primitive. They
 // are natively supported by Linux, but must be emulated for other platforms.
 // This library emulates them on all platforms using mutexes and condition
-// variables for consistency.
+// variables for consistency. Waiters are kept in a fixed number of buckets
+// hashed by address, each with its own mutex, so that waiting on and waking
+// unrelated addresses does not contend.
 //
 // This is used by the Futex API defined in the SharedArrayBuffer draft spec,
 // found here: https://github.com/tc39/ecmascript_sharedmem
@@ -32,6 +35,7 @@ namespace internal {
 
 template <typename T>
 class Handle;
+class FutexWaitBucket;
 class Isolate;
 class JSArrayBuffer;
 
@@ -40,11 +44,11 @@ class AtomicsWaitWakeHandle {
   explicit AtomicsWaitWakeHandle(Isolate* isolate) : isolate_(isolate) {}
 
   void Wake();
-  inline bool has_stopped() const { return stopped_; }
+  inline bool has_stopped() const { return stopped_.load(); }
 
  private:
   Isolate* isolate_;
-  bool stopped_ = false;
+  std::atomic<bool> stopped_{false};
 };
 
 class FutexWaitListNode {
@@ -65,16 +69,20 @@ class FutexWaitListNode {
   friend class ResetWaitingOnScopeExit;
 
   base::ConditionVariable cond_;
-  // prev_ and next_ are protected by FutexEmulation::mutex_.
+  // prev_ and next_ are protected by the mutex of the bucket whose list
+  // contains this node.
   FutexWaitListNode* prev_;
   FutexWaitListNode* next_;
   void* backing_store_;
   size_t wait_addr_;
-  // waiting_ and interrupted_ are protected by FutexEmulation::mutex_
-  // if this node is currently contained in FutexEmulation::wait_list_
-  // or an AtomicsWaitWakeHandle has access to it.
+  // waiting_ is protected by the mutex of |bucket_| while the node is waiting.
   bool waiting_;
-  bool interrupted_;
+  // The bucket this node is waiting in, or nullptr. It is only changed while
+  // holding the bucket's mutex, and lets NotifyWake find the mutex to lock.
+  std::atomic<FutexWaitBucket*> bucket_{nullptr};
+  // Set by NotifyWake before it looks at |bucket_|, and checked by the waiter
+  // after it has set |bucket_|, so that an interrupt is never lost.
+  std::atomic<bool> interrupted_;
 
   DISALLOW_COPY_AND_ASSIGN(FutexWaitListNode);
 };
@@ -96,10 +104,29 @@ class FutexWaitList {
   DISALLOW_COPY_AND_ASSIGN(FutexWaitList);
 };
 
+// A wait list together with the mutex that protects it. All waiters on the
+// same address are in the same bucket.
+class FutexWaitBucket {
+ public:
+  FutexWaitBucket() : mutex_("FutexWaitBucket::mutex") {}
+
+ private:
+  friend class FutexEmulation;
+  friend class FutexWaitListNode;
+
+  base::Mutex mutex_;
+  FutexWaitList wait_list_;
+
+  DISALLOW_COPY_AND_ASSIGN(FutexWaitBucket);
+};
+
 class ResetWaitingOnScopeExit {
  public:
   explicit ResetWaitingOnScopeExit(FutexWaitListNode* node) : node_(node) {}
-  ~ResetWaitingOnScopeExit() { node_->waiting_ = false; }
+  ~ResetWaitingOnScopeExit() {
+    node_->waiting_ = false;
+    node_->bucket_.store(nullptr);
+  }
 
  private:
   FutexWaitListNode* node_;
@@ -151,13 +178,19 @@ class FutexEmulation : public AllStatic {
   static Object* Wait(Isolate* isolate, Handle<JSArrayBuffer> array_buffer,
                       size_t addr, T value, double rel_timeout_ms);
 
-  // `mutex_` protects the composition of `wait_list_` (i.e. no elements may be
-  // added or removed without holding this mutex), as well as the `waiting_`
-  // and `interrupted_` fields for each individual list node that is currently
-  // part of the list. It must be the mutex used together with the `cond_`
-  // condition variable of such nodes.
-  static base::LazyMutex mutex_;
-  static base::LazyInstance<FutexWaitList>::type wait_list_;
+  // Returns the bucket for waiters on |addr| in |backing_store|.
+  static FutexWaitBucket* BucketFor(void* backing_store, size_t addr);
+
+  static const size_t kNumberOfBuckets = 256;
+  struct FutexWaitBuckets {
+    FutexWaitBucket buckets[kNumberOfBuckets];
+  };
+
+  // The mutex of each bucket protects the composition of its `wait_list_`
+  // (i.e. no elements may be added or removed without holding this mutex), as
+  // well as the `waiting_` field of each node in the list. It must be the
+  // mutex used together with the `cond_` condition variable of such nodes.
+  static base::LazyInstance<FutexWaitBuckets>::type buckets_;
 };
 }  // namespace internal
 }  // namespace v8
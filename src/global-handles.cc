@@ -399,6 +399,15 @@ class GlobalHandles::NodeBlock {
     }
   }
 
+  // Like PutNodesOnFreeList, but only for the nodes that are not in use.
+  void PutFreeNodesOnFreeList(Node** first_free) {
+    for (int i = kSize - 1; i >= 0; --i) {
+      if (nodes_[i].state() != Node::FREE) continue;
+      DCHECK(!nodes_[i].is_in_new_space_list());
+      nodes_[i].Initialize(i, first_free);
+    }
+  }
+
   Node* node_at(int index) {
     DCHECK(0 <= index && index < kSize);
     return &nodes_[index];
@@ -407,6 +416,7 @@ class GlobalHandles::NodeBlock {
   void IncreaseUses() {
     DCHECK_LT(used_nodes_, kSize);
     if (used_nodes_++ == 0) {
+      global_handles_->number_of_empty_blocks_--;
       NodeBlock* old_first = global_handles_->first_used_block_;
       global_handles_->first_used_block_ = this;
       next_used_ = old_first;
@@ -419,6 +429,7 @@ class GlobalHandles::NodeBlock {
   void DecreaseUses() {
     DCHECK_GT(used_nodes_, 0);
     if (--used_nodes_ == 0) {
+      global_handles_->number_of_empty_blocks_++;
       if (next_used_ != nullptr) next_used_->prev_used_ = prev_used_;
       if (prev_used_ != nullptr) prev_used_->next_used_ = next_used_;
       if (this == global_handles_->first_used_block_) {
@@ -429,8 +440,11 @@ class GlobalHandles::NodeBlock {
 
   GlobalHandles* global_handles() { return global_handles_; }
 
+  bool IsEmpty() const { return used_nodes_ == 0; }
+
   // Next block in the list of all blocks.
   NodeBlock* next() const { return next_; }
+  void set_next(NodeBlock* next) { next_ = next; }
 
   // Next/previous block in the list of blocks with used nodes.
   NodeBlock* next_used() const { return next_used_; }
@@ -438,7 +452,7 @@ class GlobalHandles::NodeBlock {
 
  private:
   Node nodes_[kSize];
-  NodeBlock* const next_;
+  NodeBlock* next_;
   int used_nodes_;
   NodeBlock* next_used_;
   NodeBlock* prev_used_;
@@ -513,6 +527,7 @@ GlobalHandles::GlobalHandles(Isolate* isolate)
       first_used_block_(nullptr),
       first_free_(nullptr),
       number_of_global_handles_(0),
+      number_of_empty_blocks_(0),
       post_gc_processing_count_(0),
       number_of_phantom_handle_resets_(0) {}
 
@@ -530,6 +545,7 @@ Handle<Object> GlobalHandles::Create(ObjectPtr value) {
   if (first_free_ == nullptr) {
     first_block_ = new NodeBlock(this, first_block_);
     first_block_->PutNodesOnFreeList(&first_free_);
+    number_of_empty_blocks_++;
   }
   DCHECK_NOT_NULL(first_free_);
   // Take the first node in the free list.
@@ -929,10 +945,52 @@ int GlobalHandles::PostGarbageCollectionProcessing(
   }
   if (initial_post_gc_processing_count == post_gc_processing_count_) {
     UpdateListOfNewSpaceNodes();
+    if (!Heap::IsYoungGenerationCollector(collector) &&
+        number_of_empty_blocks_ > kMaxEmptyBlocks &&
+        pending_phantom_callbacks_.empty()) {
+      ReleaseEmptyBlocks();
+    }
   }
   return freed_nodes;
 }
 
+void GlobalHandles::ReleaseEmptyBlocks() {
+  // The free list runs through all blocks, so it is rebuilt from the free
+  // nodes of the blocks that are kept. No free node can be in the list of new
+  // space nodes or have a pending callback at this point.
+  first_free_ = nullptr;
+  NodeBlock* previous = nullptr;
+  NodeBlock* block = first_block_;
+  int kept_empty_blocks = 0;
+  while (block != nullptr) {
+    NodeBlock* next = block->next();
+    if (block->IsEmpty() && kept_empty_blocks == kMaxEmptyBlocks) {
+      if (previous == nullptr) {
+        first_block_ = next;
+      } else {
+        previous->set_next(next);
+      }
+      delete block;
+      number_of_empty_blocks_--;
+    } else {
+      if (block->IsEmpty()) kept_empty_blocks++;
+      block->PutFreeNodesOnFreeList(&first_free_);
+      previous = block;
+    }
+    block = next;
+  }
+  DCHECK_EQ(kMaxEmptyBlocks, number_of_empty_blocks_);
+}
+
+size_t GlobalHandles::NumberOfBlocks() {
+  size_t count = 0;
+  for (NodeBlock* block = first_block_; block != nullptr;
+       block = block->next()) {
+    count++;
+  }
+  return count;
+}
+
 void GlobalHandles::IterateStrongRoots(RootVisitor* v) {
   for (NodeIterator it(this); !it.done(); it.Advance()) {
     if (it.node()->IsStrongRetainer()) {
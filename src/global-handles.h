@@ -107,6 +107,9 @@ class GlobalHandles {
 
   size_t NumberOfNewSpaceNodes() { return new_space_nodes_.size(); }
 
+  // Returns the number of allocated node blocks, including empty ones.
+  size_t NumberOfBlocks();
+
   // Clear the weakness of a global handle.
   static void* ClearWeakness(Address* location);
 
@@ -205,6 +208,8 @@ class GlobalHandles {
   int PostMarkSweepProcessing(int initial_post_gc_processing_count);
   void InvokeOrScheduleSecondPassPhantomCallbacks(bool synchronous_second_pass);
   void UpdateListOfNewSpaceNodes();
+  // Frees all but kMaxEmptyBlocks of the node blocks without used nodes.
+  void ReleaseEmptyBlocks();
   void ApplyPersistentHandleVisitor(v8::PersistentHandleVisitor* visitor,
                                     Node* node);
 
@@ -226,6 +231,11 @@ class GlobalHandles {
   // Field always containing the number of handles to global objects.
   int number_of_global_handles_;
 
+  // The number of node blocks without used nodes. After a full GC, only
+  // kMaxEmptyBlocks of them are kept for new handles.
+  static const int kMaxEmptyBlocks = 2;
+  int number_of_empty_blocks_;
+
   int post_gc_processing_count_;
 
   size_t number_of_phantom_handle_resets_;
@@ -453,6 +453,7 @@
   F(BACKGROUND_ARRAY_BUFFER_FREE)                 \
   F(BACKGROUND_STORE_BUFFER)                      \
   F(BACKGROUND_UNMAPPER)                          \
+  F(MC_BACKGROUND_CLEAR_STRING_TABLE)             \
   F(MC_BACKGROUND_EVACUATE_COPY)                  \
   F(MC_BACKGROUND_EVACUATE_UPDATE_POINTERS)       \
   F(MC_BACKGROUND_MARKING)                        \
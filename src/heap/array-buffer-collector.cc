@@ -36,26 +36,56 @@ void ArrayBufferCollector::QueueOrFreeGarbageAllocations(
 }
 
 void ArrayBufferCollector::PerformFreeAllocations() {
-  base::MutexGuard guard(&allocations_mutex_);
-  for (const std::vector<JSArrayBuffer::Allocation>& allocations :
-       allocations_) {
+  std::vector<std::vector<JSArrayBuffer::Allocation>> allocations;
+  {
+    // Only grab the queued allocations under the lock so that threads queueing
+    // new garbage never wait for the embedder's allocator.
+    base::MutexGuard guard(&allocations_mutex_);
+    allocations.swap(allocations_);
+  }
+  for (const std::vector<JSArrayBuffer::Allocation>& batch : allocations) {
+    FreeAllocationsHelper(heap_, batch);
+  }
+}
+
+bool ArrayBufferCollector::CanFreeConcurrently() {
+  return !heap_->IsTearingDown() && !heap_->ShouldReduceMemory() &&
+         FLAG_concurrent_array_buffer_freeing;
+}
+
+void ArrayBufferCollector::ScheduleFreeingTask() {
+  if (freeing_task_pending_.exchange(true)) return;
+  V8::GetCurrentPlatform()->CallOnWorkerThread(
+      MakeCancelableTask(heap_->isolate(), [this] {
+        TRACE_BACKGROUND_GC(
+            heap_->tracer(),
+            GCTracer::BackgroundScope::BACKGROUND_ARRAY_BUFFER_FREE);
+        // Reset the flag before taking the queue so that allocations queued
+        // concurrently are either picked up here or schedule a new task.
+        freeing_task_pending_ = false;
+        PerformFreeAllocations();
+      }));
+}
+
+void ArrayBufferCollector::FreeAllocationsConcurrently(
+    std::vector<JSArrayBuffer::Allocation> allocations) {
+  if (allocations.empty()) return;
+  if (!CanFreeConcurrently()) {
     FreeAllocationsHelper(heap_, allocations);
+    return;
+  }
+  {
+    base::MutexGuard guard(&allocations_mutex_);
+    allocations_.push_back(std::move(allocations));
   }
-  allocations_.clear();
+  ScheduleFreeingTask();
 }
 
 void ArrayBufferCollector::FreeAllocations() {
   // TODO(wez): Remove backing-store from external memory accounting.
   heap_->account_external_memory_concurrently_freed();
-  if (!heap_->IsTearingDown() && !heap_->ShouldReduceMemory() &&
-      FLAG_concurrent_array_buffer_freeing) {
-    V8::GetCurrentPlatform()->CallOnWorkerThread(
-        MakeCancelableTask(heap_->isolate(), [this] {
-          TRACE_BACKGROUND_GC(
-              heap_->tracer(),
-              GCTracer::BackgroundScope::BACKGROUND_ARRAY_BUFFER_FREE);
-          PerformFreeAllocations();
-        }));
+  if (CanFreeConcurrently()) {
+    ScheduleFreeingTask();
   } else {
     // Fallback for when concurrency is disabled/restricted. This is e.g. the
     // case when the GC should reduce memory. For such GCs the
@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_ARRAY_BUFFER_COLLECTOR_H_
 #define V8_HEAP_ARRAY_BUFFER_COLLECTOR_H_
 
+#include <atomic>
 #include <vector>
 
 #include "src/base/platform/mutex.h"
@@ -21,7 +22,8 @@ class Heap;
 // background thread.
 class ArrayBufferCollector {
  public:
-  explicit ArrayBufferCollector(Heap* heap) : heap_(heap) {}
+  explicit ArrayBufferCollector(Heap* heap)
+      : heap_(heap), freeing_task_pending_(false) {}
 
   ~ArrayBufferCollector() { PerformFreeAllocations(); }
 
@@ -36,6 +38,14 @@ class ArrayBufferCollector {
   // Calls FreeAllocations() on a background thread.
   void FreeAllocations();
 
+  // Queues the allocations and makes sure a background task frees them soon,
+  // falling back to freeing them immediately if concurrency is disabled or
+  // the heap should reduce memory. Can be called from any thread. Unlike
+  // FreeAllocations() this does not touch the external memory accounting of
+  // the heap, which callers have to update in bulk themselves.
+  void FreeAllocationsConcurrently(
+      std::vector<JSArrayBuffer::Allocation> allocations);
+
  private:
   class FreeingTask;
 
@@ -43,9 +53,16 @@ class ArrayBufferCollector {
   // Also called by TearDown.
   void PerformFreeAllocations();
 
+  // Posts a background task calling PerformFreeAllocations() unless one is
+  // already pending.
+  void ScheduleFreeingTask();
+
+  bool CanFreeConcurrently();
+
   Heap* const heap_;
   base::Mutex allocations_mutex_;
   std::vector<std::vector<JSArrayBuffer::Allocation>> allocations_;
+  std::atomic<bool> freeing_task_pending_;
 };
 
 }  // namespace internal
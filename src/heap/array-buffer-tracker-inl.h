@@ -6,6 +6,7 @@
 #define V8_HEAP_ARRAY_BUFFER_TRACKER_INL_H_
 
 #include "src/conversions-inl.h"
+#include "src/heap/array-buffer-collector.h"
 #include "src/heap/array-buffer-tracker.h"
 #include "src/heap/heap.h"
 #include "src/heap/spaces.h"
@@ -59,7 +60,7 @@ Space* LocalArrayBufferTracker::space() { return page_->owner(); }
 template <typename Callback>
 void LocalArrayBufferTracker::Free(Callback should_free) {
   size_t freed_memory = 0;
-  Isolate* isolate = page_->heap()->isolate();
+  std::vector<JSArrayBuffer::Allocation> backing_stores_to_free;
   for (TrackingData::iterator it = array_buffers_.begin();
        it != array_buffers_.end();) {
     // Unchecked cast because the map might already be dead at this point.
@@ -67,7 +68,7 @@ void LocalArrayBufferTracker::Free(Callback should_free) {
     const size_t length = it->second.length;
 
     if (should_free(buffer)) {
-      JSArrayBuffer::FreeBackingStore(isolate, it->second);
+      backing_stores_to_free.push_back(it->second);
       it = array_buffers_.erase(it);
       freed_memory += length;
     } else {
@@ -81,6 +82,11 @@ void LocalArrayBufferTracker::Free(Callback should_free) {
     // TODO(wez): Remove backing-store from external memory accounting.
     page_->heap()->update_external_memory_concurrently_freed(
         static_cast<intptr_t>(freed_memory));
+
+    // Hand the whole batch to the collector instead of calling into the
+    // embedder's allocator for every buffer on the sweeping thread.
+    page_->heap()->array_buffer_collector()->FreeAllocationsConcurrently(
+        std::move(backing_stores_to_free));
   }
 }
 
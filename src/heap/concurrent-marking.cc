@@ -8,7 +8,9 @@
 #include <unordered_map>
 
 #include "include/v8config.h"
+#include "src/base/optional.h"
 #include "src/base/template-utils.h"
+#include "src/heap/embedder-tracing.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
@@ -81,7 +83,8 @@ class ConcurrentMarkingVisitor final
       ConcurrentMarking::MarkingWorklist* bailout,
       MemoryChunkDataMap* memory_chunk_data, WeakObjects* weak_objects,
       ConcurrentMarking::EmbedderTracingWorklist* embedder_objects, int task_id,
-      bool embedder_tracing_enabled)
+      bool embedder_tracing_enabled,
+      LocalEmbedderHeapTracer::ProcessingScope* embedder_scope)
       : shared_(shared, task_id),
         bailout_(bailout, task_id),
         weak_objects_(weak_objects),
@@ -89,7 +92,8 @@ class ConcurrentMarkingVisitor final
         marking_state_(memory_chunk_data),
         memory_chunk_data_(memory_chunk_data),
         task_id_(task_id),
-        embedder_tracing_enabled_(embedder_tracing_enabled) {}
+        embedder_tracing_enabled_(embedder_tracing_enabled),
+        embedder_scope_(embedder_scope) {}
 
   template <typename T, typename = typename std::enable_if<
                             std::is_base_of<Object, T>::value>::type>
@@ -302,6 +306,10 @@ class ConcurrentMarkingVisitor final
   // ===========================================================================
 
   int VisitFixedArray(Map map, FixedArray object) {
+    MemoryChunk* chunk = MemoryChunk::FromHeapObject(object);
+    if (chunk->IsFlagSet<AccessMode::ATOMIC>(MemoryChunk::HAS_PROGRESS_BAR)) {
+      return VisitFixedArrayWithProgressBar(map, object, chunk);
+    }
     return VisitLeftTrimmableArray(map, object);
   }
 
@@ -409,7 +417,10 @@ class ConcurrentMarkingVisitor final
 
   // Implements ephemeron semantics: Marks value if key is already reachable.
   // Returns true if value was actually marked.
-  bool VisitEphemeron(HeapObject* key, HeapObject* value) {
+  // Ephemerons with both key and value unreachable are pushed to |unresolved|
+  // if given and to next_ephemerons otherwise.
+  bool VisitEphemeron(HeapObject* key, HeapObject* value,
+                      std::vector<Ephemeron>* unresolved = nullptr) {
     if (marking_state_.IsBlackOrGrey(key)) {
       if (marking_state_.WhiteToGrey(value)) {
         shared_.Push(value);
@@ -417,7 +428,11 @@ class ConcurrentMarkingVisitor final
       }
 
     } else if (marking_state_.IsWhite(value)) {
-      weak_objects_->next_ephemerons.Push(task_id_, Ephemeron{key, value});
+      if (unresolved != nullptr) {
+        unresolved->push_back(Ephemeron{key, value});
+      } else {
+        weak_objects_->next_ephemerons.Push(task_id_, Ephemeron{key, value});
+      }
     }
 
     return false;
@@ -503,13 +518,38 @@ class ConcurrentMarkingVisitor final
     DCHECK(object->IsApiWrapper());
     int size = VisitJSObjectSubclass(map, object);
     if (size && embedder_tracing_enabled_) {
-      // Success: The object needs to be processed for embedder references on
-      // the main thread.
-      embedder_objects_.Push(object);
+      if (embedder_scope_ != nullptr) {
+        // Success: The embedder accepts the references from this thread.
+        embedder_scope_->TracePossibleWrapper(JSObject::cast(object));
+      } else {
+        // Success: The object needs to be processed for embedder references on
+        // the main thread.
+        embedder_objects_.Push(object);
+      }
     }
     return size;
   }
 
+  // Large arrays with a progress bar are scanned in chunks that are claimed
+  // atomically. The array is pushed again before its chunk is scanned, so
+  // that other marking tasks and the main thread can scan the rest of it in
+  // parallel. Large objects are never left-trimmed.
+  int VisitFixedArrayWithProgressBar(Map map, FixedArray object,
+                                     MemoryChunk* chunk) {
+    int size = FixedArray::BodyDescriptor::SizeOf(map, object);
+    // Only the task that turns the array black accounts for its size.
+    bool first_visit = marking_state_.GreyToBlack(object);
+    int start_offset, end_offset;
+    if (chunk->ClaimProgressBarChunk(FixedArray::BodyDescriptor::kStartOffset,
+                                     size, &start_offset, &end_offset)) {
+      if (end_offset < size) shared_.Push(object);
+      if (first_visit) VisitMapPointer(object, object->map_slot());
+      VisitPointers(object, HeapObject::RawField(object, start_offset),
+                    HeapObject::RawField(object, end_offset));
+    }
+    return first_visit ? size : 0;
+  }
+
   template <typename T>
   int VisitLeftTrimmableArray(Map map, T object) {
     // The synchronized_length() function checks that the length is a Smi.
@@ -571,6 +611,7 @@ class ConcurrentMarkingVisitor final
   int task_id_;
   SlotSnapshot slot_snapshot_;
   bool embedder_tracing_enabled_;
+  LocalEmbedderHeapTracer::ProcessingScope* const embedder_scope_;
 };
 
 // Strings can change maps due to conversion to thin string or external strings.
@@ -651,9 +692,19 @@ void ConcurrentMarking::Run(int task_id, TaskState* task_state) {
                       GCTracer::BackgroundScope::MC_BACKGROUND_MARKING);
   size_t kBytesUntilInterruptCheck = 64 * KB;
   int kObjectsUntilInterrupCheck = 1000;
+  LocalEmbedderHeapTracer* embedder_tracer =
+      heap_->local_embedder_heap_tracer();
+  base::Optional<LocalEmbedderHeapTracer::ProcessingScope> embedder_scope;
+  if (embedder_tracer->InUse() &&
+      embedder_tracer->SupportsConcurrentRegistration()) {
+    embedder_scope.emplace(
+        embedder_tracer,
+        LocalEmbedderHeapTracer::ProcessingScope::Registration::kConcurrent);
+  }
   ConcurrentMarkingVisitor visitor(
       shared_, bailout_, &task_state->memory_chunk_data, weak_objects_,
-      embedder_objects_, task_id, heap_->local_embedder_heap_tracer()->InUse());
+      embedder_objects_, task_id, embedder_tracer->InUse(),
+      embedder_scope ? &embedder_scope.value() : nullptr);
   double time_ms;
   size_t marked_bytes = 0;
   if (FLAG_trace_concurrent_marking) {
@@ -716,12 +767,33 @@ void ConcurrentMarking::Run(int task_id, TaskState* task_state) {
           ephemeron_marked = true;
         }
       }
+
+      if (FLAG_incremental_ephemerons) {
+        // Revisit ephemerons left over from earlier tasks and marking steps,
+        // whose keys may have been marked in the meantime. Unresolved ones are
+        // kept locally so that this task does not pop them again.
+        std::vector<Ephemeron> unresolved;
+        size_t visited = 0;
+        while (visited < MarkCompactCollector::kMaxEphemeronsPerStep &&
+               weak_objects_->next_ephemerons.Pop(task_id, &ephemeron)) {
+          visited++;
+          if (visitor.VisitEphemeron(ephemeron.key, ephemeron.value,
+                                     &unresolved)) {
+            ephemeron_marked = true;
+          }
+        }
+        for (const Ephemeron& e : unresolved) {
+          weak_objects_->next_ephemerons.Push(task_id, e);
+        }
+      }
     }
 
     shared_->FlushToGlobal(task_id);
     bailout_->FlushToGlobal(task_id);
     on_hold_->FlushToGlobal(task_id);
     embedder_objects_->FlushToGlobal(task_id);
+    // Reports the remaining wrappers before the task is marked as done.
+    embedder_scope.reset();
 
     weak_objects_->transition_arrays.FlushToGlobal(task_id);
     weak_objects_->ephemeron_hash_tables.FlushToGlobal(task_id);
@@ -59,10 +59,9 @@ class ConcurrentMarking {
     COMPLETE_TASKS_FOR_TESTING,
   };
 
-  // TODO(gab): The only thing that prevents this being above 7 is
-  // Worklist::kMaxNumTasks being maxed at 8 (concurrent marking doesn't use
-  // task 0, reserved for the main thread).
-  static constexpr int kMaxTasks = 7;
+  // Bounded by Worklist::kMaxNumTasks (concurrent marking doesn't use task 0,
+  // reserved for the main thread).
+  static constexpr int kMaxTasks = 15;
   using MarkingWorklist = Worklist<HeapObject*, 64 /* segment size */>;
   using EmbedderTracingWorklist = Worklist<HeapObject*, 16 /* segment size */>;
 
@@ -25,12 +25,16 @@ void LocalEmbedderHeapTracer::TracePrologue() {
   num_v8_marking_worklist_was_empty_ = 0;
   embedder_worklist_empty_ = false;
   remote_tracer_->TracePrologue();
+  supports_concurrent_registration_ =
+      FLAG_concurrent_marking &&
+      remote_tracer_->SupportsConcurrentRegistration();
 }
 
 void LocalEmbedderHeapTracer::TraceEpilogue() {
   if (!InUse()) return;
 
   remote_tracer_->TraceEpilogue();
+  supports_concurrent_registration_ = false;
 }
 
 void LocalEmbedderHeapTracer::EnterFinalPause() {
@@ -60,14 +64,22 @@ void LocalEmbedderHeapTracer::SetEmbedderStackStateForNextFinalization(
 }
 
 LocalEmbedderHeapTracer::ProcessingScope::ProcessingScope(
-    LocalEmbedderHeapTracer* tracer)
-    : tracer_(tracer) {
+    LocalEmbedderHeapTracer* tracer, Registration registration)
+    : tracer_(tracer), registration_(registration) {
+  DCHECK_IMPLIES(registration_ == Registration::kConcurrent,
+                 tracer_->SupportsConcurrentRegistration());
   wrapper_cache_.reserve(kWrapperCacheSize);
 }
 
 LocalEmbedderHeapTracer::ProcessingScope::~ProcessingScope() {
-  if (!wrapper_cache_.empty()) {
-    tracer_->remote_tracer()->RegisterV8References(std::move(wrapper_cache_));
+  if (!wrapper_cache_.empty()) RegisterWrapperCache();
+}
+
+void LocalEmbedderHeapTracer::ProcessingScope::RegisterWrapperCache() {
+  if (registration_ == Registration::kConcurrent) {
+    tracer_->remote_tracer()->RegisterV8ReferencesConcurrently(wrapper_cache_);
+  } else {
+    tracer_->remote_tracer()->RegisterV8References(wrapper_cache_);
   }
 }
 
@@ -87,7 +99,7 @@ void LocalEmbedderHeapTracer::ProcessingScope::TracePossibleWrapper(
 
 void LocalEmbedderHeapTracer::ProcessingScope::FlushWrapperCacheIfFull() {
   if (wrapper_cache_.size() == wrapper_cache_.capacity()) {
-    tracer_->remote_tracer()->RegisterV8References(std::move(wrapper_cache_));
+    RegisterWrapperCache();
     wrapper_cache_.clear();
     wrapper_cache_.reserve(kWrapperCacheSize);
   }
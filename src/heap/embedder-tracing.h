@@ -22,7 +22,13 @@ class V8_EXPORT_PRIVATE LocalEmbedderHeapTracer final {
 
   class V8_EXPORT_PRIVATE ProcessingScope {
    public:
-    explicit ProcessingScope(LocalEmbedderHeapTracer* tracer);
+    // kConcurrent scopes are used by concurrent marking threads and report
+    // wrappers through EmbedderHeapTracer::RegisterV8ReferencesConcurrently.
+    enum class Registration { kMainThread, kConcurrent };
+
+    explicit ProcessingScope(
+        LocalEmbedderHeapTracer* tracer,
+        Registration registration = Registration::kMainThread);
     ~ProcessingScope();
 
     void TracePossibleWrapper(JSObject js_object);
@@ -33,8 +39,10 @@ class V8_EXPORT_PRIVATE LocalEmbedderHeapTracer final {
     static constexpr size_t kWrapperCacheSize = 1000;
 
     void FlushWrapperCacheIfFull();
+    void RegisterWrapperCache();
 
     LocalEmbedderHeapTracer* const tracer_;
+    const Registration registration_;
     WrapperCache wrapper_cache_;
   };
 
@@ -47,6 +55,12 @@ class V8_EXPORT_PRIVATE LocalEmbedderHeapTracer final {
   bool InUse() const { return remote_tracer_ != nullptr; }
   EmbedderHeapTracer* remote_tracer() const { return remote_tracer_; }
 
+  // Whether concurrent marking threads report wrappers to the remote tracer
+  // themselves during the current GC cycle.
+  bool SupportsConcurrentRegistration() const {
+    return supports_concurrent_registration_;
+  }
+
   void SetRemoteTracer(EmbedderHeapTracer* tracer);
   void TracePrologue();
   void TraceEpilogue();
@@ -77,6 +91,7 @@ class V8_EXPORT_PRIVATE LocalEmbedderHeapTracer final {
   EmbedderHeapTracer* remote_tracer_ = nullptr;
 
   size_t num_v8_marking_worklist_was_empty_ = 0;
+  bool supports_concurrent_registration_ = false;
   EmbedderHeapTracer::EmbedderStackState embedder_stack_state_ =
       EmbedderHeapTracer::kUnknown;
   // Indicates whether the embedder worklist was observed empty on the main
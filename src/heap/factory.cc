@@ -218,6 +218,7 @@ Handle<PrototypeInfo> Factory::NewPrototypeInfo() {
   result->set_registry_slot(PrototypeInfo::UNREGISTERED);
   result->set_bit_field(0);
   result->set_module_namespace(*undefined_value());
+  result->set_for_in_cache(*undefined_value());
   return result;
 }
 
@@ -425,6 +426,7 @@ Handle<FeedbackVector> Factory::NewFeedbackVector(
   vector->set_invocation_count(0);
   vector->set_profiler_ticks(0);
   vector->set_deopt_count(0);
+  vector->set_deopt_history(0);
   // TODO(leszeks): Initialize based on the feedback metadata.
   MemsetTagged(ObjectSlot(vector->slots_start()), *undefined_value(), length);
   return vector;
@@ -660,6 +662,21 @@ MaybeHandle<String> Factory::NewStringFromUtf8(Vector<const char> string,
   int utf16_length = static_cast<int>(decoder->Utf16Length());
   DCHECK_GT(utf16_length, 0);
 
+  if (decoder->IsOneByte()) {
+    // Latin-1 text still fits into a one-byte string.
+    Handle<SeqOneByteString> result;
+    ASSIGN_RETURN_ON_EXCEPTION(
+        isolate(), result,
+        NewRawOneByteString(non_ascii_start + utf16_length, pretenure),
+        String);
+    DisallowHeapAllocation no_gc;
+    uint8_t* data = result->GetChars(no_gc);
+    CopyChars(data, reinterpret_cast<const uint8_t*>(ascii_data),
+              non_ascii_start);
+    decoder->WriteOneByte(data + non_ascii_start, utf16_length, non_ascii);
+    return result;
+  }
+
   // Allocate string.
   Handle<SeqTwoByteString> result;
   ASSIGN_RETURN_ON_EXCEPTION(
@@ -669,9 +686,9 @@ MaybeHandle<String> Factory::NewStringFromUtf8(Vector<const char> string,
   // Copy ASCII portion.
   DisallowHeapAllocation no_gc;
   uint16_t* data = result->GetChars(no_gc);
-  for (int i = 0; i < non_ascii_start; i++) {
-    *data++ = *ascii_data++;
-  }
+  CopyChars(data, reinterpret_cast<const uint8_t*>(ascii_data),
+            non_ascii_start);
+  data += non_ascii_start;
 
   // Now write the remainder.
   decoder->WriteUtf16(data, utf16_length, non_ascii);
@@ -708,6 +725,25 @@ MaybeHandle<String> Factory::NewStringFromUtf8SubString(
 
   DCHECK_GT(utf16_length, 0);
 
+  if (decoder->IsOneByte()) {
+    // Latin-1 text still fits into a one-byte string.
+    Handle<SeqOneByteString> result;
+    ASSIGN_RETURN_ON_EXCEPTION(
+        isolate(), result,
+        NewRawOneByteString(non_ascii_start + utf16_length, pretenure),
+        String);
+    DisallowHeapAllocation no_gc;
+    const uint8_t* ascii_data = str->GetChars(no_gc) + begin;
+    auto non_ascii =
+        Vector<const char>(reinterpret_cast<const char*>(ascii_data) +
+                               non_ascii_start,
+                           length - non_ascii_start);
+    uint8_t* data = result->GetChars(no_gc);
+    CopyChars(data, ascii_data, non_ascii_start);
+    decoder->WriteOneByte(data + non_ascii_start, utf16_length, non_ascii);
+    return result;
+  }
+
   // Allocate string.
   Handle<SeqTwoByteString> result;
   ASSIGN_RETURN_ON_EXCEPTION(
@@ -724,9 +760,9 @@ MaybeHandle<String> Factory::NewStringFromUtf8SubString(
 
   // Copy ASCII portion.
   uint16_t* data = result->GetChars(no_gc);
-  for (int i = 0; i < non_ascii_start; i++) {
-    *data++ = *ascii_data++;
-  }
+  CopyChars(data, reinterpret_cast<const uint8_t*>(ascii_data),
+            non_ascii_start);
+  data += non_ascii_start;
 
   // Now write the remainder.
   decoder->WriteUtf16(data, utf16_length, non_ascii);
@@ -1182,6 +1218,29 @@ MaybeHandle<String> Factory::NewConsString(Handle<String> left,
   }
 
   bool one_byte = (is_one_byte || is_one_byte_data_in_two_byte_string);
+
+  // Copy short appended parts into the last leaf of the left string, like
+  // CodeStubAssembler::StringAdd does.
+  if (left->IsConsString() && right->IsSeqString() &&
+      right_length <= ConsString::kMaxCoalescedLength) {
+    Handle<ConsString> left_cons = Handle<ConsString>::cast(left);
+    Handle<String> tail(left_cons->second(), isolate());
+    int leaf_length = tail->length() + right_length;
+    if (tail->IsSeqString() && leaf_length <= ConsString::kMaxCoalescedLength &&
+        tail->IsOneByteRepresentation() == right_is_one_byte) {
+      Handle<String> leaf =
+          right_is_one_byte
+              ? ConcatStringContent<uint8_t>(
+                    NewRawOneByteString(leaf_length).ToHandleChecked(), tail,
+                    right)
+              : ConcatStringContent<uc16>(
+                    NewRawTwoByteString(leaf_length).ToHandleChecked(), tail,
+                    right);
+      return NewConsString(handle(left_cons->first(), isolate()), leaf, length,
+                           one_byte);
+    }
+  }
+
   return NewConsString(left, right, length, one_byte);
 }
 
@@ -1779,6 +1838,8 @@ Handle<BytecodeArray> Factory::NewBytecodeArray(
   instance->set_interrupt_budget(interpreter::Interpreter::InterruptBudget());
   instance->set_osr_loop_nesting_level(0);
   instance->set_bytecode_age(BytecodeArray::kNoAgeBytecodeAge);
+  instance->set_has_optimization_hint(false);
+  instance->set_has_inlining_hint(false);
   instance->set_constant_pool(*constant_pool);
   instance->set_handler_table(*empty_byte_array());
   instance->set_source_position_table(*empty_byte_array());
@@ -2269,6 +2330,7 @@ Handle<FeedbackVector> Factory::CopyFeedbackVector(
     result->set_invocation_count(array->invocation_count());
     result->set_profiler_ticks(array->profiler_ticks());
     result->set_deopt_count(array->deopt_count());
+    result->set_deopt_history(array->deopt_history());
     for (int i = 0; i < len; i++) result->set(i, array->get(i), mode);
   }
   return result;
@@ -2908,6 +2970,8 @@ Handle<BytecodeArray> Factory::CopyBytecodeArray(
   copy->set_interrupt_budget(bytecode_array->interrupt_budget());
   copy->set_osr_loop_nesting_level(bytecode_array->osr_loop_nesting_level());
   copy->set_bytecode_age(bytecode_array->bytecode_age());
+  copy->set_has_optimization_hint(bytecode_array->has_optimization_hint());
+  copy->set_has_inlining_hint(bytecode_array->has_inlining_hint());
   bytecode_array->CopyBytecodesTo(*copy);
   return copy;
 }
@@ -3688,8 +3752,27 @@ inline int NumberToStringCacheHash(Handle<FixedArray> cache, double number) {
   int64_t bits = bit_cast<int64_t>(number);
   return (static_cast<int>(bits) ^ static_cast<int>(bits >> 32)) & mask;
 }
+inline int NumberToStringCacheHash(Handle<FixedArray> cache, Object* number) {
+  if (number->IsSmi()) return NumberToStringCacheHash(cache, Smi::cast(number));
+  return NumberToStringCacheHash(cache, HeapNumber::cast(number)->value());
+}
 }  // namespace
 
+void Factory::GrowNumberStringCache() {
+  Handle<FixedArray> old_cache = number_string_cache();
+  Handle<FixedArray> new_cache =
+      NewFixedArray(old_cache->length() * 2, TENURED);
+  DisallowHeapAllocation no_gc;
+  for (int i = 0; i < old_cache->length(); i += 2) {
+    Object* key = old_cache->get(i);
+    if (key->IsUndefined(isolate())) continue;
+    int hash = NumberToStringCacheHash(new_cache, key);
+    new_cache->set(hash * 2, key);
+    new_cache->set(hash * 2 + 1, old_cache->get(i + 1));
+  }
+  isolate()->heap()->set_number_string_cache(*new_cache);
+}
+
 Handle<String> Factory::NumberToStringCacheSet(Handle<Object> number, int hash,
                                                const char* string,
                                                bool check_cache) {
@@ -3700,11 +3783,14 @@ Handle<String> Factory::NumberToStringCacheSet(Handle<Object> number, int hash,
   if (!check_cache) return js_string;
 
   if (!number_string_cache()->get(hash * 2)->IsUndefined(isolate())) {
-    int full_size = isolate()->heap()->MaxNumberToStringCacheSize();
-    if (number_string_cache()->length() != full_size) {
-      Handle<FixedArray> new_cache = NewFixedArray(full_size, TENURED);
-      isolate()->heap()->set_number_string_cache(*new_cache);
-      return js_string;
+    // The cache starts out small and doubles whenever it has evicted a
+    // quarter of its entries, up to a size based on the new space size.
+    int length = number_string_cache()->length();
+    if (length < isolate()->heap()->MaxNumberToStringCacheSize() &&
+        isolate()->heap()->RecordCacheEviction(RootIndex::kNumberStringCache,
+                                               length / 2)) {
+      GrowNumberStringCache();
+      hash = NumberToStringCacheHash(number_string_cache(), *number);
     }
   }
   number_string_cache()->set(hash * 2, *number);
@@ -3717,9 +3803,11 @@ Handle<Object> Factory::NumberToStringCacheGet(Object* number, int hash) {
   Object* key = number_string_cache()->get(hash * 2);
   if (key == number || (key->IsHeapNumber() && number->IsHeapNumber() &&
                         key->Number() == number->Number())) {
+    isolate()->counters()->number_string_cache_hits()->Increment();
     return Handle<String>(
         String::cast(number_string_cache()->get(hash * 2 + 1)), isolate());
   }
+  isolate()->counters()->number_string_cache_misses()->Increment();
   return undefined_value();
 }
 
@@ -3980,6 +4068,11 @@ void Factory::SetRegExpIrregexpData(Handle<JSRegExp> regexp,
   store->set(JSRegExp::kIrregexpMaxRegisterCountIndex, Smi::kZero);
   store->set(JSRegExp::kIrregexpCaptureCountIndex, Smi::FromInt(capture_count));
   store->set(JSRegExp::kIrregexpCaptureNameMapIndex, uninitialized);
+  store->set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
+             Smi::FromInt(std::max(FLAG_regexp_tier_up_ticks, 0)));
+  store->set(JSRegExp::kIrregexpLinearCodeIndex,
+             Smi::FromInt(JSRegExp::kLinearEngineUnused));
+  store->set(JSRegExp::kIrregexpLiteralPrefixIndex, Smi::kZero);
   regexp->set_data(*store);
 }
 
@@ -31,6 +31,12 @@ void GCIdleTimeAction::Print() {
         PrintF("; finalized marking");
       }
       break;
+    case DO_START_INCREMENTAL_MARKING:
+      PrintF("start incremental marking");
+      break;
+    case DO_FINALIZE_SWEEPING:
+      PrintF("finalize sweeping");
+      break;
     case DO_FULL_GC:
       PrintF("full GC");
       break;
@@ -43,6 +49,10 @@ void GCIdleTimeHeapState::Print() {
   PrintF("contexts_disposal_rate=%f ", contexts_disposal_rate);
   PrintF("size_of_objects=%" PRIuS " ", size_of_objects);
   PrintF("incremental_marking_stopped=%d ", incremental_marking_stopped);
+  PrintF("incremental_marking_limit_reached=%d ",
+         incremental_marking_limit_reached);
+  PrintF("sweeping_in_progress=%d ", sweeping_in_progress);
+  PrintF("sweeper_tasks_running=%d ", sweeper_tasks_running);
 }
 
 size_t GCIdleTimeHandler::EstimateMarkingStepSize(
@@ -117,9 +127,11 @@ GCIdleTimeAction GCIdleTimeHandler::NothingOrDone(double idle_time_in_ms) {
 // we do nothing until the context disposal rate becomes lower.
 // (3) If the new space is almost full and we can afford a scavenge or if the
 // next scavenge will very likely take long, then a scavenge is performed.
-// (4) If sweeping is in progress and we received a large enough idle time
-// request, we finalize sweeping here.
-// (5) If incremental marking is in progress, we perform a marking step. Note,
+// (4) If sweeping is in progress and the concurrent sweeper tasks are done, we
+// finalize sweeping here.
+// (5) If incremental marking is stopped but the old generation reached the
+// limit for starting it, we start it here rather than on the next allocation.
+// (6) If incremental marking is in progress, we perform a marking step. Note,
 // that this currently may trigger a full garbage collection.
 GCIdleTimeAction GCIdleTimeHandler::Compute(double idle_time_in_ms,
                                             GCIdleTimeHeapState heap_state) {
@@ -142,6 +154,15 @@ GCIdleTimeAction GCIdleTimeHandler::Compute(double idle_time_in_ms,
     return NothingOrDone(idle_time_in_ms);
   }
 
+  if (heap_state.sweeping_in_progress && !heap_state.sweeper_tasks_running) {
+    return GCIdleTimeAction::FinalizeSweeping();
+  }
+
+  if (FLAG_incremental_marking && heap_state.incremental_marking_stopped &&
+      heap_state.incremental_marking_limit_reached) {
+    return GCIdleTimeAction::StartIncrementalMarking();
+  }
+
   if (!FLAG_incremental_marking || heap_state.incremental_marking_stopped) {
     return GCIdleTimeAction::Done();
   }
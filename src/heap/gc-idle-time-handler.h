@@ -14,6 +14,8 @@ enum GCIdleTimeActionType {
   DONE,
   DO_NOTHING,
   DO_INCREMENTAL_STEP,
+  DO_START_INCREMENTAL_MARKING,
+  DO_FINALIZE_SWEEPING,
   DO_FULL_GC,
 };
 
@@ -41,6 +43,20 @@ class GCIdleTimeAction {
     return result;
   }
 
+  static GCIdleTimeAction StartIncrementalMarking() {
+    GCIdleTimeAction result;
+    result.type = DO_START_INCREMENTAL_MARKING;
+    result.additional_work = false;
+    return result;
+  }
+
+  static GCIdleTimeAction FinalizeSweeping() {
+    GCIdleTimeAction result;
+    result.type = DO_FINALIZE_SWEEPING;
+    result.additional_work = false;
+    return result;
+  }
+
   static GCIdleTimeAction FullGC() {
     GCIdleTimeAction result;
     result.type = DO_FULL_GC;
@@ -63,6 +79,11 @@ class GCIdleTimeHeapState {
   double contexts_disposal_rate;
   size_t size_of_objects;
   bool incremental_marking_stopped;
+  // Whether the old generation has grown enough that incremental marking
+  // would be started soon anyway.
+  bool incremental_marking_limit_reached;
+  bool sweeping_in_progress;
+  bool sweeper_tasks_running;
 };
 
 
@@ -352,6 +352,8 @@ void GCTracer::Stop(GarbageCollector collector) {
 
   heap_->UpdateTotalGCTime(duration);
 
+  if (statistics_callback_ != nullptr) ReportStatistics();
+
   if ((current_.type == Event::SCAVENGER ||
        current_.type == Event::MINOR_MARK_COMPACTOR) &&
       FLAG_trace_gc_ignore_scavenger)
@@ -369,6 +371,67 @@ void GCTracer::Stop(GarbageCollector collector) {
 }
 
 
+void GCTracer::ReportStatistics() const {
+  v8::GCStatistics statistics = {};
+  switch (current_.type) {
+    case Event::SCAVENGER:
+      statistics.type = kGCTypeScavenge;
+      statistics.scavenge_duration = current_.scopes[Scope::SCAVENGER_SCAVENGE];
+      statistics.scavenge_roots_duration =
+          current_.scopes[Scope::SCAVENGER_SCAVENGE_ROOTS];
+      statistics.scavenge_parallel_duration =
+          current_.scopes[Scope::SCAVENGER_SCAVENGE_PARALLEL];
+      statistics.background_scavenge_duration =
+          current_.scopes[Scope::SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL];
+      break;
+    case Event::MINOR_MARK_COMPACTOR:
+      statistics.type = kGCTypeScavenge;
+      statistics.mark_duration = current_.scopes[Scope::MINOR_MC_MARK];
+      statistics.evacuate_duration = current_.scopes[Scope::MINOR_MC_EVACUATE];
+      statistics.clear_duration = current_.scopes[Scope::MINOR_MC_CLEAR];
+      statistics.background_marking_duration =
+          current_.scopes[Scope::MINOR_MC_BACKGROUND_MARKING];
+      statistics.background_evacuation_duration =
+          current_.scopes[Scope::MINOR_MC_BACKGROUND_EVACUATE_COPY] +
+          current_.scopes[Scope::MINOR_MC_BACKGROUND_EVACUATE_UPDATE_POINTERS];
+      break;
+    case Event::INCREMENTAL_MARK_COMPACTOR:
+    case Event::MARK_COMPACTOR:
+      statistics.type = kGCTypeMarkSweepCompact;
+      statistics.incremental =
+          current_.type == Event::INCREMENTAL_MARK_COMPACTOR;
+      statistics.incremental_marking_duration =
+          current_.incremental_marking_duration;
+      statistics.mark_duration = current_.scopes[Scope::MC_MARK];
+      statistics.clear_duration = current_.scopes[Scope::MC_CLEAR];
+      statistics.evacuate_duration = current_.scopes[Scope::MC_EVACUATE];
+      statistics.sweep_duration = current_.scopes[Scope::MC_SWEEP];
+      statistics.background_marking_duration =
+          current_.scopes[Scope::MC_BACKGROUND_MARKING];
+      statistics.background_sweeping_duration =
+          current_.scopes[Scope::MC_BACKGROUND_SWEEPING];
+      statistics.background_evacuation_duration =
+          current_.scopes[Scope::MC_BACKGROUND_EVACUATE_COPY] +
+          current_.scopes[Scope::MC_BACKGROUND_EVACUATE_UPDATE_POINTERS];
+      break;
+    case Event::START:
+      UNREACHABLE();
+  }
+  statistics.start_time = current_.start_time;
+  statistics.pause_duration = current_.end_time - current_.start_time;
+  statistics.start_object_size = current_.start_object_size;
+  statistics.end_object_size = current_.end_object_size;
+  statistics.start_memory_size = current_.start_memory_size;
+  statistics.end_memory_size = current_.end_memory_size;
+  statistics.promoted_bytes = heap_->promoted_objects_size();
+  statistics.semi_space_copied_bytes = heap_->semi_space_copied_object_size();
+  statistics.promotion_ratio = heap_->promotion_ratio_;
+  statistics.survival_ratio =
+      heap_->promotion_ratio_ + heap_->semi_space_copied_rate_;
+  statistics_callback_(reinterpret_cast<v8::Isolate*>(heap_->isolate()),
+                       statistics, statistics_callback_data_);
+}
+
 void GCTracer::SampleAllocation(double current_ms,
                                 size_t new_space_counter_bytes,
                                 size_t old_generation_counter_bytes) {
@@ -77,7 +77,7 @@ class V8_EXPORT_PRIVATE GCTracer {
           LAST_INCREMENTAL_SCOPE - FIRST_INCREMENTAL_SCOPE + 1,
       FIRST_GENERAL_BACKGROUND_SCOPE = BACKGROUND_ARRAY_BUFFER_FREE,
       LAST_GENERAL_BACKGROUND_SCOPE = BACKGROUND_UNMAPPER,
-      FIRST_MC_BACKGROUND_SCOPE = MC_BACKGROUND_EVACUATE_COPY,
+      FIRST_MC_BACKGROUND_SCOPE = MC_BACKGROUND_CLEAR_STRING_TABLE,
       LAST_MC_BACKGROUND_SCOPE = MC_BACKGROUND_SWEEPING,
       FIRST_TOP_MC_SCOPE = MC_CLEAR,
       LAST_TOP_MC_SCOPE = MC_SWEEP,
@@ -108,7 +108,7 @@ class V8_EXPORT_PRIVATE GCTracer {
           NUMBER_OF_SCOPES,
       FIRST_GENERAL_BACKGROUND_SCOPE = BACKGROUND_ARRAY_BUFFER_FREE,
       LAST_GENERAL_BACKGROUND_SCOPE = BACKGROUND_UNMAPPER,
-      FIRST_MC_BACKGROUND_SCOPE = MC_BACKGROUND_EVACUATE_COPY,
+      FIRST_MC_BACKGROUND_SCOPE = MC_BACKGROUND_CLEAR_STRING_TABLE,
       LAST_MC_BACKGROUND_SCOPE = MC_BACKGROUND_SWEEPING,
       FIRST_MINOR_GC_BACKGROUND_SCOPE = MINOR_MC_BACKGROUND_EVACUATE_COPY,
       LAST_MINOR_GC_BACKGROUND_SCOPE = SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL
@@ -323,6 +323,11 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   void RecordGCPhasesHistograms(TimedHistogram* gc_timer);
 
+  void SetStatisticsCallback(v8::GCStatisticsCallback callback, void* data) {
+    statistics_callback_ = callback;
+    statistics_callback_data_ = data;
+  }
+
  private:
   FRIEND_TEST(GCTracer, AverageSpeed);
   FRIEND_TEST(GCTracerTest, AllocationThroughput);
@@ -341,6 +346,7 @@ class V8_EXPORT_PRIVATE GCTracer {
   FRIEND_TEST(GCTracerTest, RecordGCSumHistograms);
   FRIEND_TEST(GCTracerTest, RecordMarkCompactHistograms);
   FRIEND_TEST(GCTracerTest, RecordScavengerHistograms);
+  FRIEND_TEST(GCTracerTest, StatisticsCallback);
 
   struct BackgroundCounter {
     double total_duration_ms;
@@ -392,6 +398,9 @@ class V8_EXPORT_PRIVATE GCTracer {
   void FetchBackgroundMarkCompactCounters();
   void FetchBackgroundGeneralCounters();
 
+  // Hands the statistics of the current event to the statistics callback.
+  void ReportStatistics() const;
+
   // Pointer to the heap that owns this tracer.
   Heap* heap_;
 
@@ -402,6 +411,10 @@ class V8_EXPORT_PRIVATE GCTracer {
   // Previous tracer event.
   Event previous_;
 
+  // Embedder callback receiving the statistics of every event.
+  v8::GCStatisticsCallback statistics_callback_ = nullptr;
+  void* statistics_callback_data_ = nullptr;
+
   // Size of incremental marking steps (in bytes) accumulated since the end of
   // the last mark compact GC.
   size_t incremental_marking_bytes_;
@@ -96,6 +96,9 @@ size_t MemoryController::CalculateAllocationLimit(
   CHECK_LT(1.0, factor);
   CHECK_LT(0, curr_size);
   uint64_t limit = static_cast<uint64_t>(curr_size * factor);
+  if (max_growing_step_ > 0) {
+    limit = Min(limit, static_cast<uint64_t>(curr_size) + max_growing_step_);
+  }
   limit = Max(limit, static_cast<uint64_t>(curr_size) +
                          MinimumAllocationLimitGrowingStep(growing_mode));
   limit += new_space_capacity;
@@ -46,8 +46,11 @@ class V8_EXPORT_PRIVATE MemoryController {
   const double max_growing_factor_;
   const double conservative_growing_factor_;
   const double target_mutator_utilization_;
+  // Maximum distance of the limit from the current size, or 0 for no maximum.
+  size_t max_growing_step_ = 0;
 
   FRIEND_TEST(HeapControllerTest, HeapGrowingFactor);
+  FRIEND_TEST(HeapControllerTest, MaxGrowingStep);
   FRIEND_TEST(HeapControllerTest, MaxHeapGrowingFactor);
   FRIEND_TEST(HeapControllerTest, MaxOldGenerationSize);
   FRIEND_TEST(HeapControllerTest, OldGenerationAllocationLimit);
@@ -59,8 +62,13 @@ class V8_EXPORT_PRIVATE HeapController : public MemoryController {
   static constexpr size_t kMinSize = 128 * Heap::kPointerMultiplier;
   static constexpr size_t kMaxSize = 1024 * Heap::kPointerMultiplier;
 
+  static constexpr double kTargetMutatorUtilization = 0.97;
+
   explicit HeapController(Heap* heap)
-      : MemoryController(heap, 1.1, 4.0, 1.3, 0.97) {}
+      : MemoryController(heap, 1.1, 4.0, 1.3,
+                         heap->target_mutator_utilization()) {
+    max_growing_step_ = heap->max_heap_growing_step();
+  }
   double MaxGrowingFactor(size_t curr_max_size);
 
  protected:
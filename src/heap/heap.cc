@@ -37,6 +37,7 @@
 #include "src/heap/object-stats.h"
 #include "src/heap/objects-visiting-inl.h"
 #include "src/heap/objects-visiting.h"
+#include "src/heap/page-pool.h"
 #include "src/heap/remembered-set.h"
 #include "src/heap/scavenge-job.h"
 #include "src/heap/scavenger-inl.h"
@@ -57,6 +58,7 @@
 #include "src/snapshot/natives.h"
 #include "src/snapshot/serializer-common.h"
 #include "src/snapshot/snapshot.h"
+#include "src/task-utils.h"
 #include "src/tracing/trace-event.h"
 #include "src/unicode-decoder.h"
 #include "src/unicode-inl.h"
@@ -136,6 +138,9 @@ Heap::Heap()
       memory_pressure_level_(MemoryPressureLevel::kNone),
       old_generation_allocation_limit_(initial_old_generation_size_),
       global_pretenuring_feedback_(kInitialFeedbackCapacity),
+      pretenuring_ratio_(AllocationSite::kPretenureRatio),
+      pretenuring_minimum_mementos_(AllocationSite::kPretenureMinimumCreated),
+      target_mutator_utilization_(HeapController::kTargetMutatorUtilization),
       current_gc_callback_flags_(GCCallbackFlags::kNoGCCallbackFlags),
       external_string_table_(this) {
   // Ensure old_generation_size_ is a multiple of kPageSize.
@@ -262,7 +267,7 @@ bool Heap::HasBeenSetUp() {
 GarbageCollector Heap::SelectGarbageCollector(AllocationSpace space,
                                               const char** reason) {
   // Is global GC requested?
-  if (space != NEW_SPACE) {
+  if (space != NEW_SPACE && space != NEW_LO_SPACE) {
     isolate_->counters()->gc_compactor_caused_by_request()->Increment();
     *reason = "GC in old space requested";
     return MARK_COMPACTOR;
@@ -280,7 +285,8 @@ GarbageCollector Heap::SelectGarbageCollector(AllocationSpace space,
   }
 
   // Over-estimate the new space size using capacity to allow some slack.
-  if (!CanExpandOldGeneration(new_space_->TotalCapacity())) {
+  if (!CanExpandOldGeneration(new_space_->TotalCapacity() +
+                              new_lo_space_->Size())) {
     isolate_->counters()
         ->gc_compactor_caused_by_oldspace_exhaustion()
         ->Increment();
@@ -305,6 +311,11 @@ void Heap::PrintShortHeapStatistics() {
                " available: %6" PRIuS " KB\n",
                memory_allocator()->Size() / KB,
                memory_allocator()->Available() / KB);
+  if (FLAG_transparent_huge_pages) {
+    PrintIsolate(isolate_,
+                 "Huge pages,         advised: %6" PRIuS " KB\n",
+                 memory_allocator()->HugePageAdvisedSize() / KB);
+  }
   PrintIsolate(isolate_,
                "Read-only space,        used: %6" PRIuS
                " KB"
@@ -634,7 +645,8 @@ void Heap::MergeAllocationSitePretenuringFeedback(
 
     const int value = static_cast<int>(site_and_count.second);
     DCHECK_LT(0, value);
-    if (site->IncrementMementoFoundCount(value)) {
+    site->IncrementMementoFoundCount(value);
+    if (site->memento_found_count() >= pretenuring_minimum_mementos_) {
       // For sites in the global map the count is accessed through the site.
       global_pretenuring_feedback_.insert(std::make_pair(site, 0));
     }
@@ -689,12 +701,12 @@ class Heap::SkipStoreBufferScope {
 namespace {
 inline bool MakePretenureDecision(
     AllocationSite* site, AllocationSite::PretenureDecision current_decision,
-    double ratio, bool maximum_size_scavenge) {
+    double ratio, double pretenuring_ratio, bool maximum_size_scavenge) {
   // Here we just allow state transitions from undecided or maybe tenure
   // to don't tenure, maybe tenure, or tenure.
   if ((current_decision == AllocationSite::kUndecided ||
        current_decision == AllocationSite::kMaybeTenure)) {
-    if (ratio >= AllocationSite::kPretenureRatio) {
+    if (ratio >= pretenuring_ratio) {
       // We just transition into tenure state when the semi-space was at
       // maximum capacity.
       if (maximum_size_scavenge) {
@@ -712,14 +724,18 @@ inline bool MakePretenureDecision(
   return false;
 }
 
-inline bool DigestPretenuringFeedback(Isolate* isolate, AllocationSite* site,
-                                      bool maximum_size_scavenge) {
+inline bool DigestPretenuringFeedback(Heap* heap, AllocationSite* site,
+                                      bool maximum_size_scavenge,
+                                      v8::tracing::TracedValue* trace_sites) {
+  Isolate* isolate = heap->isolate();
   bool deopt = false;
   int create_count = site->memento_create_count();
   int found_count = site->memento_found_count();
   bool minimum_mementos_created =
-      create_count >= AllocationSite::kPretenureMinimumCreated;
-  double ratio = minimum_mementos_created || FLAG_trace_pretenuring_statistics
+      create_count >= heap->pretenuring_minimum_mementos();
+  double ratio = minimum_mementos_created ||
+                         FLAG_trace_pretenuring_statistics ||
+                         trace_sites != nullptr
                      ? static_cast<double>(found_count) / create_count
                      : 0.0;
   AllocationSite::PretenureDecision current_decision =
@@ -727,9 +743,25 @@ inline bool DigestPretenuringFeedback(Isolate* isolate, AllocationSite* site,
 
   if (minimum_mementos_created) {
     deopt = MakePretenureDecision(site, current_decision, ratio,
+                                  heap->pretenuring_ratio(),
                                   maximum_size_scavenge);
   }
 
+  if (trace_sites != nullptr) {
+    char address[32];
+    SNPrintF(ArrayVector(address), "%p", static_cast<void*>(site));
+    trace_sites->BeginDictionary();
+    trace_sites->SetString("site", address);
+    trace_sites->SetInteger("created", create_count);
+    trace_sites->SetInteger("found", found_count);
+    trace_sites->SetDouble("ratio", ratio);
+    trace_sites->SetString("previous_decision",
+                           site->PretenureDecisionName(current_decision));
+    trace_sites->SetString(
+        "decision", site->PretenureDecisionName(site->pretenure_decision()));
+    trace_sites->EndDictionary();
+  }
+
   if (FLAG_trace_pretenuring_statistics) {
     PrintIsolate(isolate,
                  "pretenuring: AllocationSite(%p): (created, found, ratio) "
@@ -765,6 +797,17 @@ void Heap::ProcessPretenuringFeedback() {
 
     AllocationSite* site = nullptr;
 
+    // Allocation sites and their decisions are reported to the tracing
+    // infrastructure if the v8.gc category is enabled.
+    std::unique_ptr<v8::tracing::TracedValue> trace_sites;
+    bool tracing_enabled = false;
+    TRACE_EVENT_CATEGORY_GROUP_ENABLED(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
+                                       &tracing_enabled);
+    if (tracing_enabled) {
+      trace_sites = v8::tracing::TracedValue::Create();
+      trace_sites->BeginArray("sites");
+    }
+
     // Step 1: Digest feedback for recorded allocation sites.
     bool maximum_size_scavenge = MaximumSizeScavenge();
     for (auto& site_and_count : global_pretenuring_feedback_) {
@@ -780,7 +823,8 @@ void Heap::ProcessPretenuringFeedback() {
         DCHECK(site->IsAllocationSite());
         active_allocation_sites++;
         allocation_mementos_found += found_count;
-        if (DigestPretenuringFeedback(isolate_, site, maximum_size_scavenge)) {
+        if (DigestPretenuringFeedback(this, site, maximum_size_scavenge,
+                                      trace_sites.get())) {
           trigger_deoptimization = true;
         }
         if (site->GetPretenureMode() == TENURED) {
@@ -822,6 +866,16 @@ void Heap::ProcessPretenuringFeedback() {
                    tenure_decisions, dont_tenure_decisions);
     }
 
+    if (trace_sites) {
+      trace_sites->EndArray();
+      trace_sites->SetInteger("tenured", tenure_decisions);
+      trace_sites->SetInteger("not_tenured", dont_tenure_decisions);
+      trace_sites->SetBoolean("deopt_maybe_tenured", deopt_maybe_tenured);
+      TRACE_EVENT_INSTANT1(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
+                           "V8.GCPretenuringFeedback", TRACE_EVENT_SCOPE_THREAD,
+                           "feedback", std::move(trace_sites));
+    }
+
     global_pretenuring_feedback_.clear();
     global_pretenuring_feedback_.reserve(kInitialFeedbackCapacity);
   }
@@ -1685,7 +1739,9 @@ bool Heap::PerformGarbageCollection(
         MinorMarkCompact();
         break;
       case SCAVENGER:
-        if ((fast_promotion_mode_ &&
+        // Fast promotion only moves the semi space pages, young large
+        // objects need a regular scavenge to be promoted.
+        if ((fast_promotion_mode_ && new_lo_space()->IsEmpty() &&
              CanExpandOldGeneration(new_space()->Size()))) {
           tracer()->NotifyYoungGenerationHandling(
               YoungGenerationHandling::kFastPromotionDuringScavenge);
@@ -2410,6 +2466,26 @@ void Heap::ConfigureInitialOldGenerationSize() {
   }
 }
 
+bool Heap::RecordCacheEviction(RootIndex cache, int capacity) {
+  int* evictions;
+  switch (cache) {
+    case RootIndex::kNumberStringCache:
+      evictions = &number_string_cache_evictions_;
+      break;
+    case RootIndex::kStringSplitCache:
+      evictions = &string_split_cache_evictions_;
+      break;
+    case RootIndex::kRegExpMultipleCache:
+      evictions = &regexp_multiple_cache_evictions_;
+      break;
+    default:
+      UNREACHABLE();
+  }
+  if (++*evictions < capacity / 4) return false;
+  *evictions = 0;
+  return true;
+}
+
 void Heap::FlushNumberStringCache() {
   // Flush the number to string cache.
   int len = number_string_cache()->length();
@@ -3054,6 +3130,13 @@ GCIdleTimeHeapState Heap::ComputeHeapState() {
       tracer()->ContextDisposalRateInMilliseconds();
   heap_state.size_of_objects = static_cast<size_t>(SizeOfObjects());
   heap_state.incremental_marking_stopped = incremental_marking()->IsStopped();
+  heap_state.incremental_marking_limit_reached =
+      heap_state.incremental_marking_stopped &&
+      IncrementalMarkingLimitReached() != IncrementalMarkingLimit::kNoLimit;
+  heap_state.sweeping_in_progress =
+      mark_compact_collector()->sweeping_in_progress();
+  heap_state.sweeper_tasks_running =
+      mark_compact_collector()->sweeper()->AreSweeperTasksRunning();
   return heap_state;
 }
 
@@ -3066,6 +3149,14 @@ bool Heap::PerformIdleTimeAction(GCIdleTimeAction action,
     case DONE:
       result = true;
       break;
+    case DO_FINALIZE_SWEEPING:
+      mark_compact_collector()->EnsureSweepingCompleted();
+      break;
+    case DO_START_INCREMENTAL_MARKING:
+      StartIncrementalMarking(GCFlagsForIncrementalMarking(),
+                              GarbageCollectionReason::kIdleTask,
+                              kGCCallbackScheduleIdleGarbageCollection);
+      V8_FALLTHROUGH;
     case DO_INCREMENTAL_STEP: {
       const double remaining_idle_time_in_ms =
           incremental_marking()->AdvanceIncrementalMarking(
@@ -3194,6 +3285,7 @@ void Heap::CheckMemoryPressure() {
   memory_pressure_level_ = MemoryPressureLevel::kNone;
   if (memory_pressure_level == MemoryPressureLevel::kCritical) {
     CollectGarbageOnMemoryPressure();
+    PagePool::Get()->ReleaseAll();
   } else if (memory_pressure_level == MemoryPressureLevel::kModerate) {
     if (FLAG_incremental_marking && incremental_marking()->IsStopped()) {
       StartIncrementalMarking(kReduceMemoryFootprintMask,
@@ -3219,6 +3311,8 @@ void Heap::CollectGarbageOnMemoryPressure() {
                     GarbageCollectionReason::kMemoryPressure,
                     kGCCallbackFlagCollectAllAvailableGarbage);
   EagerlyFreeExternalMemory();
+  // The backing stores of dead array buffers may have been pooled again.
+  isolate()->array_buffer_allocator()->ReleaseCachedMemory();
   double end = MonotonicallyIncreasingTimeInMs();
 
   // Estimate how much memory we can free.
@@ -3246,6 +3340,12 @@ void Heap::CollectGarbageOnMemoryPressure() {
 
 void Heap::MemoryPressureNotification(MemoryPressureLevel level,
                                       bool is_isolate_locked) {
+  // Zone segments pooled for the compilers and backing stores pooled by the
+  // array buffer allocator are the cheapest memory to give back.
+  isolate()->allocator()->MemoryPressureNotification(level);
+  if (level != MemoryPressureLevel::kNone) {
+    isolate()->array_buffer_allocator()->ReleaseCachedMemory();
+  }
   MemoryPressureLevel previous = memory_pressure_level_;
   memory_pressure_level_ = level;
   if ((previous != MemoryPressureLevel::kCritical &&
@@ -4028,6 +4128,27 @@ void Heap::GetFromRingBuffer(char* buffer) {
 
 void Heap::ConfigureHeapDefault() { ConfigureHeap(0, 0, 0); }
 
+void Heap::ConfigurePretenuring(double pretenuring_ratio,
+                                int minimum_mementos) {
+  if (pretenuring_ratio > 0) {
+    DCHECK_LE(pretenuring_ratio, 1.0);
+    pretenuring_ratio_ = pretenuring_ratio;
+  }
+  if (minimum_mementos > 0) pretenuring_minimum_mementos_ = minimum_mementos;
+}
+
+void Heap::ConfigureHeapGrowing(double target_mutator_utilization,
+                                size_t max_growing_step_in_mb) {
+  DCHECK_NULL(heap_controller_);
+  if (target_mutator_utilization > 0) {
+    DCHECK_LT(target_mutator_utilization, 1.0);
+    target_mutator_utilization_ = target_mutator_utilization;
+  }
+  if (max_growing_step_in_mb > 0) {
+    max_heap_growing_step_ = max_growing_step_in_mb * MB;
+  }
+}
+
 void Heap::RecordStats(HeapStats* stats, bool take_snapshot) {
   *stats->start_marker = HeapStats::kStartMarker;
   *stats->end_marker = HeapStats::kEndMarker;
@@ -4817,6 +4938,38 @@ void Heap::CompactWeakArrayLists(PretenureFlag pretenure) {
   set_noscript_shared_function_infos(*no_script_list);
 }
 
+void Heap::MigrateDeprecatedInstances() {
+  HandleScope scope(isolate());
+  std::vector<Handle<JSObject>> objects;
+  {
+    HeapIterator iterator(this);
+    for (HeapObject* o = iterator.next(); o != nullptr; o = iterator.next()) {
+      if (o->IsJSObject() && o->map()->is_deprecated()) {
+        objects.push_back(handle(JSObject::cast(o), isolate()));
+      }
+    }
+  }
+  for (Handle<JSObject> object : objects) {
+    // Migrating an earlier object may have allocated, but can't have changed
+    // the map of this one back to a deprecated map, so check again.
+    if (object->map()->is_deprecated()) JSObject::MigrateInstance(object);
+  }
+  if (FLAG_trace_migration) {
+    PrintIsolate(isolate(), "Batch-migrated %zu instances\n", objects.size());
+  }
+}
+
+void Heap::ScheduleDeprecatedInstanceMigration() {
+  if (deprecated_instance_migration_pending_ || IsTearingDown()) return;
+  deprecated_instance_migration_pending_ = true;
+  auto taskrunner = V8::GetCurrentPlatform()->GetForegroundTaskRunner(
+      reinterpret_cast<v8::Isolate*>(isolate()));
+  taskrunner->PostTask(MakeCancelableTask(isolate(), [this] {
+    deprecated_instance_migration_pending_ = false;
+    MigrateDeprecatedInstances();
+  }));
+}
+
 void Heap::AddRetainedMap(Handle<Map> map) {
   if (map->is_in_retained_map_list()) {
     return;
@@ -544,6 +544,15 @@ class Heap {
 
   void CompactWeakArrayLists(PretenureFlag pretenure);
 
+  // Migrates every live JSObject with a deprecated map to its updated map, so
+  // that the instances don't each miss in the ICs on their next access.
+  void MigrateDeprecatedInstances();
+
+  // Posts a foreground task that calls MigrateDeprecatedInstances(), unless
+  // one is already pending. All deprecations up to the point the task runs
+  // are handled by a single heap walk.
+  void ScheduleDeprecatedInstanceMigration();
+
   void AddRetainedMap(Handle<Map> map);
 
   // This event is triggered after successful allocation of a new object made
@@ -591,6 +600,31 @@ class Heap {
                      size_t code_range_size_in_mb);
   void ConfigureHeapDefault();
 
+  // Configures the thresholds of allocation site pretenuring. Zero keeps the
+  // respective default.
+  // pretenuring_ratio: fraction of mementos found during scavenges above which
+  //   an allocation site tenures its allocations
+  // minimum_mementos: number of mementos an allocation site has to create
+  //   before a decision is made
+  void ConfigurePretenuring(double pretenuring_ratio, int minimum_mementos);
+  double pretenuring_ratio() const { return pretenuring_ratio_; }
+  int pretenuring_minimum_mementos() const {
+    return pretenuring_minimum_mementos_;
+  }
+
+  // Configures the growing policy of the old generation. Zero keeps the
+  // respective default. Has to be called before the heap is set up.
+  // target_mutator_utilization: fraction of time spent outside of the GC that
+  //   the allocation limit is sized for
+  // max_growing_step_in_mb: maximum distance of the allocation limit from the
+  //   old generation size after a full GC
+  void ConfigureHeapGrowing(double target_mutator_utilization,
+                            size_t max_growing_step_in_mb);
+  double target_mutator_utilization() const {
+    return target_mutator_utilization_;
+  }
+  size_t max_heap_growing_step() const { return max_heap_growing_step_; }
+
   // Prepares the heap, setting up memory areas that are needed in the isolate
   // without actually creating any objects.
   void SetUp();
@@ -1295,6 +1329,12 @@ class Heap {
   // Calculates the nof entries for the full sized number to string cache.
   inline int MaxNumberToStringCacheSize() const;
 
+  // Records that an entry of the number-string cache or of a RegExp results
+  // cache, given by {cache}, got overwritten. Returns true once a quarter of
+  // the cache's {capacity} entries have been evicted since it was last
+  // resized, i.e. when the cache should grow.
+  bool RecordCacheEviction(RootIndex cache, int capacity);
+
  private:
   class SkipStoreBufferScope;
 
@@ -1785,6 +1825,12 @@ class Heap {
   // ... and since the last scavenge.
   size_t survived_last_scavenge_ = 0;
 
+  // Entries overwritten in the number-string cache and the RegExp results
+  // caches since they were last resized.
+  int number_string_cache_evictions_ = 0;
+  int string_split_cache_evictions_ = 0;
+  int regexp_multiple_cache_evictions_ = 0;
+
   // This is not the depth of nested AlwaysAllocateScope's but rather a single
   // count, as scopes can be acquired from multiple tasks (read: threads).
   std::atomic<size_t> always_allocate_scope_count_{0};
@@ -1955,6 +2001,14 @@ class Heap {
   // forwarding pointers.
   PretenuringFeedbackMap global_pretenuring_feedback_;
 
+  // Thresholds used by ProcessPretenuringFeedback. See ConfigurePretenuring.
+  double pretenuring_ratio_;
+  int pretenuring_minimum_mementos_;
+
+  // The old generation growing policy. See ConfigureHeapGrowing.
+  double target_mutator_utilization_;
+  size_t max_heap_growing_step_ = 0;
+
   char trace_ring_buffer_[kTraceRingBufferSize];
 
   // Used as boolean.
@@ -1985,6 +2039,8 @@ class Heap {
 
   bool deserialization_complete_ = false;
 
+  bool deprecated_instance_migration_pending_ = false;
+
   // The depth of HeapIterator nestings.
   int heap_iterator_depth_ = 0;
 
@@ -2037,11 +2093,13 @@ class Heap {
   friend class MarkCompactCollector;
   friend class MarkCompactCollectorBase;
   friend class MinorMarkCompactCollector;
+  friend class NewLargeObjectSpace;
   friend class NewSpace;
   friend class ObjectStatsCollector;
   friend class Page;
   friend class PagedSpace;
   friend class ReadOnlyRoots;
+  friend class RegExpResultsCache;
   friend class Scavenger;
   friend class ScavengerCollector;
   friend class Space;
@@ -2058,6 +2116,7 @@ class Heap {
   // Used in cctest.
   friend class heap::HeapTester;
 
+  FRIEND_TEST(HeapControllerTest, MaxGrowingStep);
   FRIEND_TEST(HeapControllerTest, OldGenerationAllocationLimit);
   FRIEND_TEST(HeapTest, ExternalLimitDefault);
   FRIEND_TEST(HeapTest, ExternalLimitStaysAboveDefaultForExplicitHandling);
@@ -63,6 +63,8 @@ IncrementalMarking::IncrementalMarking(
       weak_objects_(weak_objects),
       initial_old_generation_size_(0),
       bytes_marked_ahead_of_schedule_(0),
+      bytes_marked_(0),
+      last_scheduled_step_time_ms_(0),
       bytes_marked_concurrently_(0),
       unscanned_bytes_of_large_object_(0),
       is_compacting_(false),
@@ -351,6 +353,8 @@ void IncrementalMarking::Start(GarbageCollectionReason gc_reason) {
   old_generation_allocation_counter_ = heap_->OldGenerationAllocationCounter();
   bytes_allocated_ = 0;
   bytes_marked_ahead_of_schedule_ = 0;
+  bytes_marked_ = 0;
+  last_scheduled_step_time_ms_ = start_time_ms_;
   bytes_marked_concurrently_ = 0;
   should_hurry_ = false;
   was_activated_ = true;
@@ -1027,11 +1031,60 @@ size_t IncrementalMarking::StepSizeToMakeProgress() {
     return heap()->OldGenerationSizeOfObjects() / kTargetStepCountAtOOM;
   }
 
+  size_t step_size;
+  if (FLAG_incremental_marking_schedule && StepSizeToFinishInTime(&step_size)) {
+    return step_size;
+  }
+
   return Min(Max(initial_old_generation_size_ / kTargetStepCount,
                  IncrementalMarking::kMinStepSizeInBytes),
              kMaxStepSizeInByte);
 }
 
+bool IncrementalMarking::StepSizeToFinishInTime(size_t* step_size) {
+  GCTracer* tracer = heap()->tracer();
+  double allocation_speed =
+      tracer->CurrentOldGenerationAllocationThroughputInBytesPerMillisecond();
+  if (allocation_speed == 0) return false;
+
+  double now = heap()->MonotonicallyIncreasingTimeInMs();
+  double elapsed_ms = now - last_scheduled_step_time_ms_;
+  last_scheduled_step_time_ms_ = now;
+
+  // The old generation size at the start of marking over-approximates the
+  // live bytes. Work created by allocations during marking is covered by
+  // StepSizeToKeepUpWithAllocations().
+  size_t marked_bytes = bytes_marked_ + bytes_marked_concurrently_;
+  if (marked_bytes >= initial_old_generation_size_) {
+    *step_size = 0;
+    return true;
+  }
+  size_t remaining_bytes = initial_old_generation_size_ - marked_bytes;
+
+  size_t size = heap()->OldGenerationSizeOfObjects();
+  size_t limit = heap()->old_generation_allocation_limit();
+  if (size >= limit) {
+    // Behind schedule, finish as soon as possible.
+    *step_size = remaining_bytes;
+    return true;
+  }
+
+  // Pace the marking rate so that the remaining bytes are marked when the
+  // limit is reached. Concurrent marking and marking tasks contribute to this
+  // rate: StepOnAllocation() only does the part they did not do.
+  double time_to_limit_ms = (limit - size) / allocation_speed;
+  double fraction =
+      time_to_limit_ms > elapsed_ms ? elapsed_ms / time_to_limit_ms : 1.0;
+  *step_size = static_cast<size_t>(remaining_bytes * fraction);
+  if (FLAG_trace_incremental_marking) {
+    heap()->isolate()->PrintWithTimestamp(
+        "[IncrementalMarking] Scheduled step %" PRIuS "KB (%" PRIuS
+        "KB remaining, %.1fms to the limit)\n",
+        *step_size / KB, remaining_bytes / KB, time_to_limit_ms);
+  }
+  return true;
+}
+
 void IncrementalMarking::AdvanceIncrementalMarkingOnAllocation() {
   // Code using an AlwaysAllocateScope assumes that the GC state does not
   // change; that implies that no marking steps must be performed.
@@ -1140,6 +1193,15 @@ size_t IncrementalMarking::Step(size_t bytes_to_process,
     if (step_origin == StepOrigin::kTask) {
       bytes_marked_ahead_of_schedule_ += bytes_processed;
     }
+    bytes_marked_ += bytes_processed;
+
+    if (FLAG_incremental_ephemerons && marking_worklist()->IsEmpty()) {
+      // Marking the values of ephemerons with reachable keys here keeps the
+      // fixpoint iteration in the atomic pause short. Newly marked values end
+      // up on the marking worklist and postpone finalization.
+      heap_->mark_compact_collector()->ProcessEphemeronsIncrementally(
+          MarkCompactCollector::kMaxEphemeronsPerStep);
+    }
 
     if (marking_worklist()->IsEmpty()) {
       if (heap_->local_embedder_heap_tracer()
@@ -290,6 +290,10 @@ class V8_EXPORT_PRIVATE IncrementalMarking {
 
   size_t StepSizeToKeepUpWithAllocations();
   size_t StepSizeToMakeProgress();
+  // Returns the bytes to mark in this step so that marking finishes when the
+  // old generation reaches its allocation limit, predicted from the current
+  // allocation throughput, or returns false if there is no prediction.
+  bool StepSizeToFinishInTime(size_t* step_size);
 
   void SetState(State s) {
     state_ = s;
@@ -305,6 +309,10 @@ class V8_EXPORT_PRIVATE IncrementalMarking {
   size_t old_generation_allocation_counter_;
   size_t bytes_allocated_;
   size_t bytes_marked_ahead_of_schedule_;
+  // The bytes marked by the main thread and the time of the last step that
+  // was paced by StepSizeToFinishInTime().
+  size_t bytes_marked_;
+  double last_scheduled_step_time_ms_;
   // A sample of concurrent_marking()->TotalMarkedBytes() at the last
   // incremental marking step. It is used for updating
   // bytes_marked_ahead_of_schedule_ with contribution of concurrent marking.
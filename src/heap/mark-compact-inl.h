@@ -82,7 +82,10 @@ template <FixedArrayVisitationMode fixed_array_mode,
           TraceRetainingPathMode retaining_path_mode, typename MarkingState>
 int MarkingVisitor<fixed_array_mode, retaining_path_mode,
                    MarkingState>::VisitFixedArray(Map map, FixedArray object) {
-  return (fixed_array_mode == FixedArrayVisitationMode::kRegular)
+  // In the atomic pause large arrays are split into chunks only if parallel
+  // marking tasks can pick up the rest.
+  return (fixed_array_mode == FixedArrayVisitationMode::kRegular &&
+          !FLAG_parallel_marking)
              ? Parent::VisitFixedArray(map, object)
              : VisitFixedArrayIncremental(map, object);
 }
@@ -328,35 +331,26 @@ int MarkingVisitor<fixed_array_mode, retaining_path_mode, MarkingState>::
   if (chunk->IsFlagSet(MemoryChunk::HAS_PROGRESS_BAR)) {
     DCHECK(!FLAG_use_marking_progress_bar || heap_->IsLargeObject(object));
     // When using a progress bar for large fixed arrays, scan only a chunk of
-    // the array and try to push it onto the marking deque again until it is
-    // fully scanned. Fall back to scanning it through to the end in case this
-    // fails because of a full deque.
-    int start_offset =
-        Max(FixedArray::BodyDescriptor::kStartOffset, chunk->progress_bar());
-    if (start_offset < object_size) {
+    // the array and push it onto the marking worklist again until it is
+    // fully scanned. Chunks are claimed atomically, so the array can be
+    // pushed onto the shared worklist and scanned by concurrent marking tasks
+    // at the same time.
+    int start_offset, end_offset;
+    if (chunk->ClaimProgressBarChunk(FixedArray::BodyDescriptor::kStartOffset,
+                                     object_size, &start_offset,
+                                     &end_offset)) {
       // Ensure that the object is either grey or black before pushing it
       // into marking worklist.
       marking_state()->WhiteToGrey(object);
-      if (FLAG_concurrent_marking || FLAG_parallel_marking) {
-        marking_worklist()->PushBailout(object);
-      } else {
+      if (end_offset < object_size) {
         marking_worklist()->Push(object);
+        heap_->incremental_marking()->NotifyIncompleteScanOfObject(
+            object_size - (end_offset - start_offset));
       }
       DCHECK(marking_state()->IsGrey(object) ||
              marking_state()->IsBlack(object));
-
-      int end_offset =
-          Min(object_size, start_offset + kProgressBarScanningChunk);
-      int already_scanned_offset = start_offset;
       VisitPointers(object, HeapObject::RawField(object, start_offset),
                     HeapObject::RawField(object, end_offset));
-      start_offset = end_offset;
-      end_offset = Min(object_size, end_offset + kProgressBarScanningChunk);
-      chunk->set_progress_bar(start_offset);
-      if (start_offset < object_size) {
-        heap_->incremental_marking()->NotifyIncompleteScanOfObject(
-            object_size - (start_offset - already_scanned_offset));
-      }
     }
   } else {
     FixedArray::BodyDescriptor::IterateBody(map, object, object_size, this);
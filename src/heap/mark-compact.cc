@@ -617,6 +617,18 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
   }
 }
 
+// static
+bool MarkCompactCollector::IsCodeSpaceFragmented(
+    const std::vector<std::pair<size_t, Page*>>& pages, size_t area_size) {
+  if (pages.empty()) return false;
+  size_t capacity = pages.size() * area_size;
+  size_t live_bytes = 0;
+  for (const auto& page : pages) live_bytes += page.first;
+  DCHECK_LE(live_bytes, capacity);
+  return (capacity - live_bytes) * 100 >
+         static_cast<size_t>(FLAG_code_space_fragmentation_limit) * capacity;
+}
+
 void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
   DCHECK(space->identity() == OLD_SPACE || space->identity() == CODE_SPACE);
 
@@ -700,6 +712,18 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
     int target_fragmentation_percent;
     ComputeEvacuationHeuristics(area_size, &target_fragmentation_percent,
                                 &max_evacuated_bytes);
+    if (space->identity() == CODE_SPACE && !reduce_memory &&
+        IsCodeSpaceFragmented(pages, area_size)) {
+      // Every deoptimization and re-optimization leaves holes in code space
+      // which the latency-oriented heuristics above rarely select. Evacuate
+      // the emptiest code pages a few at a time on every full GC instead, so
+      // that code space stays compact without a long memory reducing pause.
+      const int kTargetFragmentationPercentForCode = 20;
+      target_fragmentation_percent =
+          Min(target_fragmentation_percent, kTargetFragmentationPercentForCode);
+      max_evacuated_bytes =
+          Min(max_evacuated_bytes, FLAG_code_space_evacuation_budget_kb * KB);
+    }
 
     const size_t free_bytes_threshold =
         target_fragmentation_percent * (area_size / 100);
@@ -1007,6 +1031,49 @@ class InternalizedStringTableCleaner : public ObjectVisitor {
   HeapObject* table_;
 };
 
+// A range of string table elements that is cleaned by a single task.
+class StringTableCleaningItem : public ItemParallelJob::Item {
+ public:
+  StringTableCleaningItem(int start, int end) : start_(start), end_(end) {}
+  ~StringTableCleaningItem() override = default;
+
+  int start() const { return start_; }
+  int end() const { return end_; }
+
+ private:
+  int start_;
+  int end_;
+};
+
+class StringTableCleaningTask : public ItemParallelJob::Task {
+ public:
+  StringTableCleaningTask(Isolate* isolate, StringTable table,
+                          std::atomic<int>* pointers_removed)
+      : ItemParallelJob::Task(isolate),
+        heap_(isolate->heap()),
+        table_(table),
+        pointers_removed_(pointers_removed) {}
+
+  void RunInParallel() override {
+    TRACE_BACKGROUND_GC(
+        heap_->tracer(),
+        GCTracer::BackgroundScope::MC_BACKGROUND_CLEAR_STRING_TABLE);
+    InternalizedStringTableCleaner visitor(heap_, table_);
+    StringTableCleaningItem* item = nullptr;
+    while ((item = GetItem<StringTableCleaningItem>()) != nullptr) {
+      visitor.VisitPointers(table_, table_->RawFieldOfElementAt(item->start()),
+                            table_->RawFieldOfElementAt(item->end()));
+      item->MarkFinished();
+    }
+    *pointers_removed_ += visitor.PointersRemoved();
+  };
+
+ private:
+  Heap* heap_;
+  StringTable table_;
+  std::atomic<int>* pointers_removed_;
+};
+
 class ExternalStringTableCleaner : public RootVisitor {
  public:
   explicit ExternalStringTableCleaner(Heap* heap) : heap_(heap) {}
@@ -1692,7 +1759,8 @@ void MarkCompactCollector::ProcessMarkingWorklistInternal() {
   DCHECK(marking_worklist()->IsBailoutEmpty());
 }
 
-bool MarkCompactCollector::VisitEphemeron(HeapObject* key, HeapObject* value) {
+bool MarkCompactCollector::VisitEphemeron(
+    HeapObject* key, HeapObject* value, std::vector<Ephemeron>* unresolved) {
   if (marking_state()->IsBlackOrGrey(key)) {
     if (marking_state()->WhiteToGrey(value)) {
       marking_worklist()->Push(value);
@@ -1700,12 +1768,38 @@ bool MarkCompactCollector::VisitEphemeron(HeapObject* key, HeapObject* value) {
     }
 
   } else if (marking_state()->IsWhite(value)) {
-    weak_objects_.next_ephemerons.Push(kMainThread, Ephemeron{key, value});
+    if (unresolved != nullptr) {
+      unresolved->push_back(Ephemeron{key, value});
+    } else {
+      weak_objects_.next_ephemerons.Push(kMainThread, Ephemeron{key, value});
+    }
   }
 
   return false;
 }
 
+bool MarkCompactCollector::ProcessEphemeronsIncrementally(
+    size_t max_ephemerons) {
+  // Unresolved ephemerons are collected locally and pushed back at the end,
+  // otherwise the main thread would pop them again right away.
+  std::vector<Ephemeron> unresolved;
+  bool ephemeron_marked = false;
+  Ephemeron ephemeron;
+  size_t visited = 0;
+  while (visited < max_ephemerons &&
+         (weak_objects_.discovered_ephemerons.Pop(kMainThread, &ephemeron) ||
+          weak_objects_.next_ephemerons.Pop(kMainThread, &ephemeron))) {
+    visited++;
+    if (VisitEphemeron(ephemeron.key, ephemeron.value, &unresolved)) {
+      ephemeron_marked = true;
+    }
+  }
+  for (const Ephemeron& e : unresolved) {
+    weak_objects_.next_ephemerons.Push(kMainThread, e);
+  }
+  return ephemeron_marked;
+}
+
 void MarkCompactCollector::ProcessEphemeronMarking() {
   DCHECK(marking_worklist()->IsEmpty());
 
@@ -1755,6 +1849,9 @@ void MarkCompactCollector::RecordObjectStats() {
       heap()->live_object_stats_->PrintJSON("live");
       heap()->dead_object_stats_->PrintJSON("dead");
     }
+    if (FLAG_trace_pointer_compression_savings) {
+      heap()->live_object_stats_->PrintPointerCompressionSavings();
+    }
     heap()->live_object_stats_->CheckpointObjectStats();
     heap()->dead_object_stats_->ClearObjectStats();
   }
@@ -1891,9 +1988,7 @@ void MarkCompactCollector::ClearNonLiveReferences() {
     // string table.  Cannot use string_table() here because the string
     // table is marked.
     StringTable string_table = heap()->string_table();
-    InternalizedStringTableCleaner internalized_visitor(heap(), string_table);
-    string_table->IterateElements(&internalized_visitor);
-    string_table->ElementsRemoved(internalized_visitor.PointersRemoved());
+    ClearStringTable(string_table);
 
     ExternalStringTableCleaner external_visitor(heap());
     heap()->external_string_table_.IterateAll(&external_visitor);
@@ -1935,6 +2030,33 @@ void MarkCompactCollector::ClearNonLiveReferences() {
   DCHECK(weak_objects_.bytecode_flushing_candidates.IsEmpty());
 }
 
+void MarkCompactCollector::ClearStringTable(StringTable string_table) {
+  // Chunks are large enough for the task overhead to be negligible, even for
+  // the default table size.
+  const int kElementsPerItem = 16 * KB;
+  ItemParallelJob cleaning_job(isolate()->cancelable_task_manager(),
+                               &page_parallel_job_semaphore_);
+  const int length = string_table->length();
+  int items = 0;
+  for (int start = StringTable::kElementsStartIndex; start < length;
+       start += kElementsPerItem) {
+    cleaning_job.AddItem(new StringTableCleaningItem(
+        start, Min(length, start + kElementsPerItem)));
+    items++;
+  }
+  if (items == 0) return;
+  const int num_tasks = FLAG_parallel_string_table_cleaning
+                            ? Min(NumberOfAvailableCores(), items)
+                            : 1;
+  std::atomic<int> pointers_removed{0};
+  for (int i = 0; i < num_tasks; i++) {
+    cleaning_job.AddTask(
+        new StringTableCleaningTask(isolate(), string_table, &pointers_removed));
+  }
+  cleaning_job.Run(isolate()->async_counters());
+  string_table->ElementsRemoved(pointers_removed);
+}
+
 void MarkCompactCollector::MarkDependentCodeForDeoptimization() {
   std::pair<HeapObject*, Code> weak_object_in_code;
   while (weak_objects_.weak_objects_in_code.Pop(kMainThread,
@@ -2054,13 +2176,17 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
 void MarkCompactCollector::ClearOldBytecodeCandidates() {
   DCHECK(FLAG_flush_bytecode ||
          weak_objects_.bytecode_flushing_candidates.IsEmpty());
+  int flushed_count = 0;
+  size_t flushed_size = 0;
   SharedFunctionInfo flushing_candidate;
   while (weak_objects_.bytecode_flushing_candidates.Pop(kMainThread,
                                                         &flushing_candidate)) {
     // If the BytecodeArray is dead, flush it, which will replace the field with
     // an uncompiled data object.
-    if (!non_atomic_marking_state()->IsBlackOrGrey(
-            flushing_candidate->GetBytecodeArray())) {
+    BytecodeArray bytecode = flushing_candidate->GetBytecodeArray();
+    if (!non_atomic_marking_state()->IsBlackOrGrey(bytecode)) {
+      flushed_count++;
+      flushed_size += bytecode->Size();
       FlushBytecodeFromSFI(flushing_candidate);
     }
 
@@ -2070,6 +2196,15 @@ void MarkCompactCollector::ClearOldBytecodeCandidates() {
         flushing_candidate, SharedFunctionInfo::kFunctionDataOffset);
     RecordSlot(flushing_candidate, slot, HeapObject::cast(*slot));
   }
+
+  if (flushed_count == 0) return;
+  isolate()->counters()->bytecode_flushed()->Increment(flushed_count);
+  isolate()->counters()->bytecode_flushed_size()->Increment(
+      static_cast<int>(flushed_size));
+  if (FLAG_trace_flush_bytecode) {
+    PrintIsolate(isolate(), "Flushed bytecode of %d functions (%zu KB)\n",
+                 flushed_count, flushed_size / KB);
+  }
 }
 
 void MarkCompactCollector::ClearFullMapTransitions() {
@@ -2615,10 +2750,11 @@ class Evacuator : public Malloced {
   }
 
   // NewSpacePages with more live bytes than this threshold qualify for fast
-  // evacuation.
-  static intptr_t NewSpacePageEvacuationThreshold() {
+  // evacuation. The threshold is given as a percentage of the allocatable
+  // memory of a page.
+  static intptr_t NewSpacePageEvacuationThreshold(int threshold_percentage) {
     if (FLAG_page_promotion)
-      return FLAG_page_promotion_threshold *
+      return threshold_percentage *
              MemoryChunkLayout::AllocatableMemoryInDataPage() / 100;
     return MemoryChunkLayout::AllocatableMemoryInDataPage() + kPointerSize;
   }
@@ -2868,11 +3004,13 @@ void MarkCompactCollectorBase::CreateAndExecuteEvacuationTasks(
   }
 }
 
-bool MarkCompactCollectorBase::ShouldMovePage(Page* p, intptr_t live_bytes) {
+bool MarkCompactCollectorBase::ShouldMovePage(Page* p, intptr_t live_bytes,
+                                              int threshold_percentage) {
   const bool reduce_memory = heap()->ShouldReduceMemory();
   const Address age_mark = heap()->new_space()->age_mark();
   return !reduce_memory && !p->NeverEvacuate() &&
-         (live_bytes > Evacuator::NewSpacePageEvacuationThreshold()) &&
+         (live_bytes >
+          Evacuator::NewSpacePageEvacuationThreshold(threshold_percentage)) &&
          !p->Contains(age_mark) && heap()->CanExpandOldGeneration(live_bytes);
 }
 
@@ -2890,7 +3028,8 @@ void MarkCompactCollector::EvacuatePagesInParallel() {
     intptr_t live_bytes_on_page = non_atomic_marking_state()->live_bytes(page);
     if (live_bytes_on_page == 0 && !page->contains_array_buffers()) continue;
     live_bytes += live_bytes_on_page;
-    if (ShouldMovePage(page, live_bytes_on_page)) {
+    if (ShouldMovePage(page, live_bytes_on_page,
+                       FLAG_page_promotion_threshold)) {
       if (page->IsFlagSet(MemoryChunk::NEW_SPACE_BELOW_AGE_MARK)) {
         EvacuateNewSpacePageVisitor<NEW_TO_OLD>::Move(page);
         DCHECK_EQ(heap()->old_space(), page->owner());
@@ -4766,20 +4905,35 @@ void MinorMarkCompactCollector::EvacuatePagesInParallel() {
   ItemParallelJob evacuation_job(isolate()->cancelable_task_manager(),
                                  &page_parallel_job_semaphore_);
   intptr_t live_bytes = 0;
+  int pages_moved_new_to_old = 0;
+  int pages_moved_new_to_new = 0;
 
   for (Page* page : new_space_evacuation_pages_) {
     intptr_t live_bytes_on_page = non_atomic_marking_state()->live_bytes(page);
     if (live_bytes_on_page == 0 && !page->contains_array_buffers()) continue;
     live_bytes += live_bytes_on_page;
-    if (ShouldMovePage(page, live_bytes_on_page)) {
+    // Pages are moved in place instead of copying their survivors. This keeps
+    // the pause proportional to the number of pages rather than to the number
+    // of surviving bytes on high-survival workloads.
+    if (ShouldMovePage(page, live_bytes_on_page,
+                       FLAG_minor_mc_page_promotion_threshold)) {
       if (page->IsFlagSet(MemoryChunk::NEW_SPACE_BELOW_AGE_MARK)) {
         EvacuateNewSpacePageVisitor<NEW_TO_OLD>::Move(page);
+        pages_moved_new_to_old++;
       } else {
         EvacuateNewSpacePageVisitor<NEW_TO_NEW>::Move(page);
+        pages_moved_new_to_new++;
       }
     }
     evacuation_job.AddItem(new EvacuationItem(page));
   }
+  if (FLAG_trace_minor_mc_page_promotion) {
+    PrintIsolate(isolate(),
+                 "minor-mc-page-promotion: pages=%d new_to_old=%d "
+                 "new_to_new=%d live_bytes=%" V8PRIdPTR "\n",
+                 evacuation_job.NumberOfItems(), pages_moved_new_to_old,
+                 pages_moved_new_to_new, live_bytes);
+  }
   if (evacuation_job.NumberOfItems() == 0) return;
 
   YoungGenerationMigrationObserver observer(heap(),
@@ -274,8 +274,10 @@ class MarkCompactCollectorBase {
       RecordMigratedSlotVisitor* record_visitor,
       MigrationObserver* migration_observer, const intptr_t live_bytes);
 
-  // Returns whether this page should be moved according to heuristics.
-  bool ShouldMovePage(Page* p, intptr_t live_bytes);
+  // Returns whether this page should be moved according to heuristics. Pages
+  // qualify if more than |threshold_percentage| of their allocatable memory
+  // is live.
+  bool ShouldMovePage(Page* p, intptr_t live_bytes, int threshold_percentage);
 
   int CollectToSpaceUpdatingItems(ItemParallelJob* job);
   template <typename IterateableSpace>
@@ -606,6 +608,11 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
 
   void CollectEvacuationCandidates(PagedSpace* space);
 
+  // Returns true if the given code pages, as pairs of live bytes and page,
+  // have more free memory than --code-space-fragmentation-limit permits.
+  static bool IsCodeSpaceFragmented(
+      const std::vector<std::pair<size_t, Page*>>& pages, size_t area_size);
+
   void AddEvacuationCandidate(Page* p);
 
   // Prepares for GC by resetting relocation info in old and map spaces and
@@ -674,6 +681,16 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
                                              Ephemeron{key, value});
   }
 
+  // Maximum number of ephemerons visited by a single incremental marking step
+  // or concurrent marking task outside of the atomic pause.
+  static const size_t kMaxEphemeronsPerStep = 4096;
+
+  // Visits up to |max_ephemerons| of the ephemerons which could not be
+  // resolved so far and marks the values of those whose keys got marked in
+  // the meantime. Called during incremental marking so that the atomic pause
+  // mostly confirms the fixpoint. Returns true if a value was marked.
+  bool ProcessEphemeronsIncrementally(size_t max_ephemerons);
+
   void AddWeakReference(HeapObject* host, HeapObjectSlot slot) {
     weak_objects_.weak_references.Push(kMainThread, std::make_pair(host, slot));
   }
@@ -778,8 +795,11 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   void ProcessMarkingWorklistInternal();
 
   // Implements ephemeron semantics: Marks value if key is already reachable.
-  // Returns true if value was actually marked.
-  bool VisitEphemeron(HeapObject* key, HeapObject* value);
+  // Returns true if value was actually marked. Ephemerons with both key and
+  // value unreachable are pushed to |unresolved| if given and to
+  // next_ephemerons otherwise.
+  bool VisitEphemeron(HeapObject* key, HeapObject* value,
+                      std::vector<Ephemeron>* unresolved = nullptr);
 
   // Marks ephemerons and drains marking worklist iteratively
   // until a fixpoint is reached.
@@ -803,6 +823,9 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   // Clear non-live references in weak cells, transition and descriptor arrays,
   // and deoptimize dependent code of non-live maps.
   void ClearNonLiveReferences() override;
+  // Removes strings only referenced by the string table, splitting the table
+  // into chunks that are cleaned in parallel.
+  void ClearStringTable(StringTable string_table);
   void MarkDependentCodeForDeoptimization();
   // Checks if the given weak cell is a simple transition from the parent map
   // of the given dead target. If so it clears the transition and trims
@@ -976,10 +999,6 @@ class MarkingVisitor final
                                ObjectSlot end) final {}
 
  private:
-  // Granularity in which FixedArrays are scanned if |fixed_array_mode|
-  // is true.
-  static const int kProgressBarScanningChunk = 32 * 1024;
-
   template <typename TSlot>
   V8_INLINE void VisitPointerImpl(HeapObject* host, TSlot p);
 
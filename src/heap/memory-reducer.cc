@@ -63,11 +63,33 @@ void MemoryReducer::TimerTask::RunInternal() {
 }
 
 
+MemoryReducer::ShrinkTask::ShrinkTask(MemoryReducer* memory_reducer)
+    : CancelableTask(memory_reducer->heap()->isolate()),
+      memory_reducer_(memory_reducer) {}
+
+void MemoryReducer::ShrinkTask::RunInternal() {
+  Heap* heap = memory_reducer_->heap();
+  heap->tracer()->SampleAllocation(heap->MonotonicallyIncreasingTimeInMs(),
+                                   heap->NewSpaceAllocationCounter(),
+                                   heap->OldGenerationAllocationCounter());
+  // Only shrink if the isolate is still idle, otherwise the heap would grow
+  // back right away.
+  bool idle =
+      heap->HasLowAllocationRate() || heap->ShouldOptimizeForMemoryUsage();
+  if (!idle || memory_reducer_->state_.action != kDone ||
+      !heap->incremental_marking()->IsStopped()) {
+    return;
+  }
+  memory_reducer_->ShrinkIdleHeap();
+}
+
 void MemoryReducer::NotifyTimer(const Event& event) {
   DCHECK_EQ(kTimer, event.type);
   DCHECK_EQ(kWait, state_.action);
   state_ = Step(state_, event);
-  if (state_.action == kRun) {
+  if (state_.action == kDone) {
+    if (state_.started_gcs > 0) ScheduleShrinkTask();
+  } else if (state_.action == kRun) {
     DCHECK(heap()->incremental_marking()->IsStopped());
     DCHECK(FLAG_incremental_marking);
     if (FLAG_trace_gc_verbose) {
@@ -117,6 +139,7 @@ void MemoryReducer::NotifyMarkCompact(const Event& event) {
           "Memory reducer: finished GC #%d (%s)\n", state_.started_gcs,
           state_.action == kWait ? "will do more" : "done");
     }
+    if (state_.action == kDone) ScheduleShrinkTask();
   }
 }
 
@@ -218,6 +241,43 @@ void MemoryReducer::ScheduleTimer(double delay_ms) {
       (delay_ms + kSlackMs) / 1000.0);
 }
 
+void MemoryReducer::ScheduleShrinkTask() {
+  if (!FLAG_memory_reducer_shrink_idle_heap || heap()->IsTearingDown()) return;
+  taskrunner_->PostDelayedTask(
+      base::make_unique<MemoryReducer::ShrinkTask>(this),
+      kShortDelayMs / 1000.0);
+}
+
+void MemoryReducer::ShrinkIdleHeap() {
+  Heap* heap = this->heap();
+  MemoryAllocator::Unmapper* unmapper = heap->memory_allocator()->unmapper();
+
+  // Bytecode of functions that did not run during the memory reducer's GCs
+  // is old by now and gets flushed. Memory reducing GCs also compact
+  // fragmented pages.
+  size_t committed = heap->CommittedMemory();
+  heap->CollectAllGarbage(Heap::kReduceMemoryFootprintMask,
+                          GarbageCollectionReason::kMemoryReducer);
+  size_t released_by_gc = committed - Min(committed, heap->CommittedMemory());
+
+  committed = heap->CommittedMemory();
+  heap->new_space()->Shrink();
+  heap->new_space()->UncommitFromSpace();
+  size_t released_by_shrinking =
+      committed - Min(committed, heap->CommittedMemory());
+
+  int pooled_pages = unmapper->NumberOfChunks();
+  unmapper->EnsureUnmappingCompleted();
+  pooled_pages -= unmapper->NumberOfChunks();
+
+  if (FLAG_trace_gc_verbose) {
+    heap->isolate()->PrintWithTimestamp(
+        "Memory reducer: released %" PRIuS " KB by GC, %" PRIuS
+        " KB of semi spaces and %d pooled pages\n",
+        released_by_gc / KB, released_by_shrinking / KB, pooled_pages);
+  }
+}
+
 void MemoryReducer::TearDown() { state_ = State(kDone, 0, 0, 0.0, 0); }
 
 }  // namespace internal
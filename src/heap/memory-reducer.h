@@ -150,8 +150,27 @@ class V8_EXPORT_PRIVATE MemoryReducer {
     DISALLOW_COPY_AND_ASSIGN(TimerTask);
   };
 
+  // Shrinks the heap of an idle isolate after the memory reducer is done.
+  class ShrinkTask : public v8::internal::CancelableTask {
+   public:
+    explicit ShrinkTask(MemoryReducer* memory_reducer);
+
+   private:
+    // v8::internal::CancelableTask overrides.
+    void RunInternal() override;
+    MemoryReducer* memory_reducer_;
+    DISALLOW_COPY_AND_ASSIGN(ShrinkTask);
+  };
+
   void NotifyTimer(const Event& event);
 
+  void ScheduleShrinkTask();
+
+  // Runs the stages of shrinking an idle heap: a memory reducing full GC,
+  // which flushes the bytecode of cold functions and compacts fragmented
+  // pages, shrinking the semi spaces, and releasing the pooled pages.
+  void ShrinkIdleHeap();
+
   static bool WatchdogGC(const State& state, const Event& event);
 
   Heap* heap_;
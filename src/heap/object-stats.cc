@@ -39,7 +39,12 @@ class FieldStatsCollector : public ObjectVisitor {
         unboxed_double_fields_count_(unboxed_double_fields_count),
         raw_fields_count_(raw_fields_count) {}
 
-  void RecordStats(HeapObject* host) {
+  // Records the fields of |host|, counting each of them |sampling_factor|
+  // times.
+  void RecordStats(HeapObject* host, size_t sampling_factor) {
+    size_t old_embedder_fields_count = *embedder_fields_count_;
+    size_t old_unboxed_double_fields_count = *unboxed_double_fields_count_;
+    size_t old_raw_fields_count = *raw_fields_count_;
     size_t old_pointer_fields_count = *tagged_fields_count_;
     host->Iterate(this);
     size_t tagged_fields_count_in_object =
@@ -66,6 +71,15 @@ class FieldStatsCollector : public ObjectVisitor {
       *unboxed_double_fields_count_ += field_stats.unboxed_double_fields_count_;
     }
     *raw_fields_count_ += raw_fields_count_in_object;
+
+    if (sampling_factor > 1) {
+      Scale(tagged_fields_count_, old_pointer_fields_count, sampling_factor);
+      Scale(embedder_fields_count_, old_embedder_fields_count,
+            sampling_factor);
+      Scale(unboxed_double_fields_count_, old_unboxed_double_fields_count,
+            sampling_factor);
+      Scale(raw_fields_count_, old_raw_fields_count, sampling_factor);
+    }
   }
 
   void VisitPointers(HeapObject* host, ObjectSlot start,
@@ -99,6 +113,10 @@ class FieldStatsCollector : public ObjectVisitor {
 
   JSObjectFieldStats GetInobjectFieldStats(Map map);
 
+  static void Scale(size_t* count, size_t old_count, size_t factor) {
+    *count = old_count + (*count - old_count) * factor;
+  }
+
   size_t* const tagged_fields_count_;
   size_t* const embedder_fields_count_;
   size_t* const unboxed_double_fields_count_;
@@ -231,6 +249,24 @@ void ObjectStats::PrintJSON(const char* key) {
 #undef VIRTUAL_INSTANCE_TYPE_WRAPPER
 }
 
+void ObjectStats::PrintPointerCompressionSavings() {
+  // Virtual instance types describe parts of real objects, only the latter
+  // add up to the size of the heap.
+  size_t object_size = 0;
+  for (int i = 0; i <= LAST_TYPE; i++) object_size += object_sizes_[i];
+  const size_t tagged_size = tagged_fields_count_ * kTaggedSize;
+  const size_t savings =
+      tagged_fields_count_ * (kTaggedSize - Min(kTaggedSize, kInt32Size));
+  auto percent = [object_size](size_t size) {
+    return object_size == 0 ? 0.0 : 100.0 * size / object_size;
+  };
+  PrintIsolate(isolate(),
+               "pointer compression: objects %zu KB, tagged fields %zu KB "
+               "(%.1f%%), compressing them saves %zu KB (%.1f%%)\n",
+               object_size / KB, tagged_size / KB, percent(tagged_size),
+               savings / KB, percent(savings));
+}
+
 void ObjectStats::DumpInstanceTypeData(std::stringstream& stream,
                                        const char* name, int index) {
   stream << "\"" << name << "\":{";
@@ -308,20 +344,22 @@ int ObjectStats::HistogramIndexFromSize(size_t size) {
 
 void ObjectStats::RecordObjectStats(InstanceType type, size_t size) {
   DCHECK_LE(type, LAST_TYPE);
-  object_counts_[type]++;
-  object_sizes_[type] += size;
-  size_histogram_[type][HistogramIndexFromSize(size)]++;
+  object_counts_[type] += sampling_factor_;
+  object_sizes_[type] += size * sampling_factor_;
+  size_histogram_[type][HistogramIndexFromSize(size)] += sampling_factor_;
 }
 
 void ObjectStats::RecordVirtualObjectStats(VirtualInstanceType type,
                                            size_t size, size_t over_allocated) {
   DCHECK_LE(type, LAST_VIRTUAL_TYPE);
-  object_counts_[FIRST_VIRTUAL_TYPE + type]++;
-  object_sizes_[FIRST_VIRTUAL_TYPE + type] += size;
-  size_histogram_[FIRST_VIRTUAL_TYPE + type][HistogramIndexFromSize(size)]++;
-  over_allocated_[FIRST_VIRTUAL_TYPE + type] += over_allocated;
+  object_counts_[FIRST_VIRTUAL_TYPE + type] += sampling_factor_;
+  object_sizes_[FIRST_VIRTUAL_TYPE + type] += size * sampling_factor_;
+  size_histogram_[FIRST_VIRTUAL_TYPE + type][HistogramIndexFromSize(size)] +=
+      sampling_factor_;
+  over_allocated_[FIRST_VIRTUAL_TYPE + type] +=
+      over_allocated * sampling_factor_;
   over_allocated_histogram_[FIRST_VIRTUAL_TYPE + type]
-                           [HistogramIndexFromSize(size)]++;
+                           [HistogramIndexFromSize(size)] += sampling_factor_;
 }
 
 Isolate* ObjectStats::isolate() { return heap()->isolate(); }
@@ -338,6 +376,10 @@ class ObjectStatsCollectorImpl {
 
   void CollectGlobalStatistics();
 
+  void set_sampling_factor(size_t factor) {
+    stats_->set_sampling_factor(factor);
+  }
+
   enum class CollectFieldStats { kNo, kYes };
   void CollectStatistics(HeapObject* obj, Phase phase,
                          CollectFieldStats collect_field_stats);
@@ -706,7 +748,7 @@ void ObjectStatsCollectorImpl::CollectStatistics(
       }
       RecordObjectStats(obj, map->instance_type(), obj->Size());
       if (collect_field_stats == CollectFieldStats::kYes) {
-        field_stats_collector_.RecordStats(obj);
+        field_stats_collector_.RecordStats(obj, stats_->sampling_factor_);
       }
       break;
   }
@@ -997,6 +1039,11 @@ class ObjectStatsVisitor {
     return true;
   }
 
+  void set_sampling_factor(size_t factor) {
+    live_collector_->set_sampling_factor(factor);
+    dead_collector_->set_sampling_factor(factor);
+  }
+
  private:
   ObjectStatsCollectorImpl* live_collector_;
   ObjectStatsCollectorImpl* dead_collector_;
@@ -1018,16 +1065,55 @@ void IterateHeap(Heap* heap, ObjectStatsVisitor* visitor) {
   }
 }
 
+// Visits the objects on every |sampling_rate|-th page of the paged spaces,
+// starting with the page at |offset|, and counts each of them
+// |sampling_rate| times. The objects in the other spaces are all visited.
+void IterateSampledHeap(Heap* heap, ObjectStatsVisitor* visitor,
+                        int sampling_rate, int offset) {
+  SpaceIterator space_it(heap);
+  HeapObject* obj = nullptr;
+  while (space_it.has_next()) {
+    Space* space = space_it.next();
+    AllocationSpace identity = space->identity();
+    if (identity == RO_SPACE || (identity >= FIRST_GROWABLE_PAGED_SPACE &&
+                                 identity <= LAST_GROWABLE_PAGED_SPACE)) {
+      visitor->set_sampling_factor(sampling_rate);
+      int index = 0;
+      for (Page* page : *static_cast<PagedSpace*>(space)) {
+        if (index++ % sampling_rate != offset) continue;
+        HeapObjectIterator obj_it(page);
+        while ((obj = obj_it.Next()) != nullptr) {
+          visitor->Visit(obj, obj->Size());
+        }
+      }
+    } else {
+      visitor->set_sampling_factor(1);
+      std::unique_ptr<ObjectIterator> it(space->GetObjectIterator());
+      while ((obj = it->Next()) != nullptr) {
+        visitor->Visit(obj, obj->Size());
+      }
+    }
+  }
+  visitor->set_sampling_factor(1);
+}
+
 }  // namespace
 
 void ObjectStatsCollector::Collect() {
   ObjectStatsCollectorImpl live_collector(heap_, live_);
   ObjectStatsCollectorImpl dead_collector(heap_, dead_);
   live_collector.CollectGlobalStatistics();
+  // With sampling, consecutive GCs rotate through the pages.
+  int sampling_rate = Max(FLAG_gc_object_stats_sampling_rate, 1);
+  int offset = heap_->gc_count() % sampling_rate;
   for (int i = 0; i < ObjectStatsCollectorImpl::kNumberOfPhases; i++) {
     ObjectStatsVisitor visitor(heap_, &live_collector, &dead_collector,
                                static_cast<ObjectStatsCollectorImpl::Phase>(i));
-    IterateHeap(heap_, &visitor);
+    if (sampling_rate > 1) {
+      IterateSampledHeap(heap_, &visitor, sampling_rate, offset);
+    } else {
+      IterateHeap(heap_, &visitor);
+    }
   }
 }
 
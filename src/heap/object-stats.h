@@ -102,6 +102,9 @@ class ObjectStats {
   void ClearObjectStats(bool clear_last_time_stats = false);
 
   void PrintJSON(const char* key);
+  // Prints the share of the recorded objects taken up by tagged fields and
+  // how much storing them as 32-bit compressed pointers would save.
+  void PrintPointerCompressionSavings();
   void Dump(std::stringstream& stream);
 
   void CheckpointObjectStats();
@@ -120,6 +123,10 @@ class ObjectStats {
   Isolate* isolate();
   Heap* heap() { return heap_; }
 
+  // Objects recorded from here on stand for |factor| objects each. Used to
+  // scale up the statistics of sampled pages.
+  void set_sampling_factor(size_t factor) { sampling_factor_ = factor; }
+
  private:
   static const int kFirstBucketShift = 5;  // <32
   static const int kLastBucketShift = 20;  // >=1M
@@ -155,6 +162,8 @@ class ObjectStats {
   size_t unboxed_double_fields_count_;
   size_t raw_fields_count_;
 
+  size_t sampling_factor_ = 1;
+
   friend class ObjectStatsCollectorImpl;
 };
 
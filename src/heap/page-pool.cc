@@ -0,0 +1,104 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/page-pool.h"
+
+#include <string.h>
+
+#include "src/allocation.h"
+#include "src/base/lazy-instance.h"
+#include "src/flags.h"
+#include "src/heap/spaces.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+base::LazyInstance<PagePool>::type global_page_pool = LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+// static
+PagePool* PagePool::Get() { return global_page_pool.Pointer(); }
+
+// static
+bool PagePool::IsEnabledFor(v8::PageAllocator* page_allocator) {
+  return FLAG_page_pool_size > 0 && page_allocator == GetPlatformPageAllocator();
+}
+
+size_t PagePool::CapacityInPages() const {
+  return FLAG_page_pool_size * MB / MemoryChunk::kPageSize;
+}
+
+bool PagePool::Add(Address page) {
+  DCHECK(IsAligned(page, MemoryChunk::kPageSize));
+  base::MutexGuard guard(&mutex_);
+  if (dirty_pages_.size() + clean_pages_.size() + zeroing_pages_ >=
+      CapacityInPages()) {
+    return false;
+  }
+  dirty_pages_.push_back(page);
+  return true;
+}
+
+Address PagePool::Remove() {
+  Address page = kNullAddress;
+  {
+    base::MutexGuard guard(&mutex_);
+    if (!clean_pages_.empty()) {
+      page = clean_pages_.back();
+      clean_pages_.pop_back();
+      return page;
+    }
+    if (dirty_pages_.empty()) return kNullAddress;
+    page = dirty_pages_.back();
+    dirty_pages_.pop_back();
+  }
+  // The background task did not get to this page yet.
+  memset(reinterpret_cast<void*>(page), 0, MemoryChunk::kPageSize);
+  return page;
+}
+
+void PagePool::ZeroDirtyPages() {
+  while (true) {
+    Address page;
+    {
+      base::MutexGuard guard(&mutex_);
+      if (dirty_pages_.empty()) return;
+      page = dirty_pages_.back();
+      dirty_pages_.pop_back();
+      zeroing_pages_++;
+    }
+    memset(reinterpret_cast<void*>(page), 0, MemoryChunk::kPageSize);
+    {
+      base::MutexGuard guard(&mutex_);
+      zeroing_pages_--;
+      clean_pages_.push_back(page);
+    }
+  }
+}
+
+void PagePool::ReleaseAll() {
+  std::vector<Address> pages;
+  {
+    base::MutexGuard guard(&mutex_);
+    pages.swap(dirty_pages_);
+    pages.insert(pages.end(), clean_pages_.begin(), clean_pages_.end());
+    clean_pages_.clear();
+  }
+  for (Address page : pages) {
+    CHECK(FreePages(GetPlatformPageAllocator(), reinterpret_cast<void*>(page),
+                    MemoryChunk::kPageSize));
+  }
+}
+
+size_t PagePool::Size() {
+  base::MutexGuard guard(&mutex_);
+  return (dirty_pages_.size() + clean_pages_.size() + zeroing_pages_) *
+         MemoryChunk::kPageSize;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,70 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_PAGE_POOL_H_
+#define V8_HEAP_PAGE_POOL_H_
+
+#include <vector>
+
+#include "include/v8-platform.h"
+#include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+#include "src/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// A process-wide cache of committed, MemoryChunk::kPageSize sized and aligned
+// pages obtained from the platform page allocator. Isolates hand their freed
+// regular data pages to the pool instead of unmapping them and take them back
+// when new space or old space grows, which avoids the mmap/munmap and
+// mprotect round trips of the per-isolate pooling in the Unmapper.
+//
+// Pages enter the pool dirty. The Unmapper's background task zeroes them so
+// that memory handed to an isolate never contains another isolate's objects.
+// The pool holds at most --page-pool-size MB; pages beyond that high-water
+// mark are rejected and freed by the caller as before.
+class V8_EXPORT_PRIVATE PagePool {
+ public:
+  PagePool() = default;
+
+  static PagePool* Get();
+
+  // Returns true if pages of |page_allocator| may be shared through the
+  // global pool. Isolates with their own page allocator (e.g. with pointer
+  // compression) keep using their Unmapper's pool.
+  static bool IsEnabledFor(v8::PageAllocator* page_allocator);
+
+  // Takes ownership of the committed page at |page|. Returns false if the
+  // pool is full, in which case the caller remains responsible for the page.
+  bool Add(Address page);
+
+  // Returns a committed, zeroed page or kNullAddress if the pool is empty.
+  Address Remove();
+
+  // Zeroes the pages which were added since the last call. Does not block
+  // on concurrent calls.
+  void ZeroDirtyPages();
+
+  // Returns all pooled pages to the platform page allocator.
+  void ReleaseAll();
+
+  size_t Size();
+
+ private:
+  size_t CapacityInPages() const;
+
+  base::Mutex mutex_;
+  std::vector<Address> dirty_pages_;
+  std::vector<Address> clean_pages_;
+  // Pages which are currently being zeroed outside of the lock.
+  size_t zeroing_pages_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(PagePool);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_PAGE_POOL_H_
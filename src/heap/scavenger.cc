@@ -32,11 +32,19 @@ class PageScavengingItem final : public ItemParallelJob::Item {
 
 class ScavengingTask final : public ItemParallelJob::Task {
  public:
-  ScavengingTask(Heap* heap, Scavenger* scavenger, OneshotBarrier* barrier)
+  // The task given a |root_visitor| runs on the main thread and copies the
+  // roots before processing pages, while the other tasks already start on
+  // the pages. It registers with the barrier up front, so that the other
+  // tasks do not finish while the roots are still being copied.
+  ScavengingTask(Heap* heap, Scavenger* scavenger, OneshotBarrier* barrier,
+                 RootScavengeVisitor* root_visitor = nullptr)
       : ItemParallelJob::Task(heap->isolate()),
         heap_(heap),
         scavenger_(scavenger),
-        barrier_(barrier) {}
+        barrier_(barrier),
+        root_visitor_(root_visitor) {
+    if (root_visitor_ != nullptr) barrier_->Start();
+  }
 
   void RunInParallel() final {
     TRACE_BACKGROUND_GC(
@@ -44,8 +52,13 @@ class ScavengingTask final : public ItemParallelJob::Task {
         GCTracer::BackgroundScope::SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL);
     double scavenging_time = 0.0;
     {
-      barrier_->Start();
+      if (root_visitor_ == nullptr) barrier_->Start();
       TimedScope scope(&scavenging_time);
+      if (root_visitor_ != nullptr) {
+        TRACE_GC(heap_->tracer(), GCTracer::Scope::SCAVENGER_SCAVENGE_ROOTS);
+        heap_->IterateRoots(root_visitor_, VISIT_ALL_IN_SCAVENGE);
+        barrier_->NotifyAll();
+      }
       PageScavengingItem* item = nullptr;
       while ((item = GetItem<PageScavengingItem>()) != nullptr) {
         item->Process(scavenger_);
@@ -68,6 +81,7 @@ class ScavengingTask final : public ItemParallelJob::Task {
   Heap* const heap_;
   Scavenger* const scavenger_;
   OneshotBarrier* const barrier_;
+  RootScavengeVisitor* const root_visitor_;
 };
 
 class IterateAndScavengePromotedObjectsVisitor final : public ObjectVisitor {
@@ -181,8 +195,8 @@ void ScavengerCollector::CollectGarbage() {
   for (int i = 0; i < num_scavenge_tasks; i++) {
     scavengers[i] = new Scavenger(this, heap_, is_logging, &copied_list,
                                   &promotion_list, i);
-    job.AddTask(new ScavengingTask(heap_, scavengers[i], &barrier));
   }
+  RootScavengeVisitor root_scavenge_visitor(scavengers[kMainThreadId]);
 
   {
     Sweeper* sweeper = heap_->mark_compact_collector()->sweeper();
@@ -201,8 +215,6 @@ void ScavengerCollector::CollectGarbage() {
           job.AddItem(new PageScavengingItem(chunk));
         });
 
-    RootScavengeVisitor root_scavenge_visitor(scavengers[kMainThreadId]);
-
     {
       // Identify weak unmodified handles. Requires an unmodified graph.
       TRACE_GC(
@@ -211,7 +223,15 @@ void ScavengerCollector::CollectGarbage() {
       isolate_->global_handles()->IdentifyWeakUnmodifiedObjects(
           &JSObject::IsUnmodifiedApiObject);
     }
-    {
+    // The first task runs on the main thread, see ItemParallelJob::Run.
+    for (int i = 0; i < num_scavenge_tasks; i++) {
+      job.AddTask(new ScavengingTask(
+          heap_, scavengers[i], &barrier,
+          i == kMainThreadId && FLAG_overlap_scavenge_roots
+              ? &root_scavenge_visitor
+              : nullptr));
+    }
+    if (!FLAG_overlap_scavenge_roots) {
       // Copy roots.
       TRACE_GC(heap_->tracer(), GCTracer::Scope::SCAVENGER_SCAVENGE_ROOTS);
       heap_->IterateRoots(&root_scavenge_visitor, VISIT_ALL_IN_SCAVENGE);
@@ -755,9 +755,9 @@ void Heap::CreateInitialObjects() {
 
   // Allocate cache for string split and regexp-multiple.
   set_string_split_cache(*factory->NewFixedArray(
-      RegExpResultsCache::kRegExpResultsCacheSize, TENURED));
+      RegExpResultsCache::kInitialSize, TENURED));
   set_regexp_multiple_cache(*factory->NewFixedArray(
-      RegExpResultsCache::kRegExpResultsCacheSize, TENURED));
+      RegExpResultsCache::kInitialSize, TENURED));
 
   // Allocate FeedbackCell for builtins.
   Handle<FeedbackCell> many_closures_cell =
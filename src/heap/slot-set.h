@@ -29,6 +29,9 @@ enum SlotCallbackResult { KEEP_SLOT, REMOVE_SLOT };
 // The data structure assumes that the slots are pointer size aligned and
 // splits the valid slot offset range into kBuckets buckets.
 // Each bucket is a bitmap with a bit corresponding to a single slot offset.
+// Sparse buckets with at most kInlineSlots slots are not allocated. They are
+// stored as a sorted list of slot indices in the bucket word itself, see
+// IsInlineBucket(), and turn into a bitmap when they overflow.
 class SlotSet : public Malloced {
  public:
   enum EmptyBucketMode {
@@ -65,16 +68,18 @@ class SlotSet : public Malloced {
     int bucket_index, cell_index, bit_index;
     SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
     Bucket bucket = LoadBucket<access_mode>(&buckets_[bucket_index]);
-    if (bucket == nullptr) {
-      bucket = AllocateBucket();
-      if (!SwapInNewBucket<access_mode>(&buckets_[bucket_index], bucket)) {
-        DeleteArray<uint32_t>(bucket);
-        bucket = LoadBucket<access_mode>(&buckets_[bucket_index]);
-      }
+    while (!IsBitmapBucket(bucket)) {
+      Bucket new_bucket =
+          InsertIntoInlineBucket(bucket, cell_index * kBitsPerCell + bit_index);
+      if (new_bucket == bucket) return;
+      Bucket old_bucket = CompareAndSwapBucket<access_mode>(
+          &buckets_[bucket_index], bucket, new_bucket);
+      if (old_bucket == bucket) return;
+      if (IsBitmapBucket(new_bucket)) DeleteArray<uint32_t>(new_bucket);
+      bucket = old_bucket;
     }
     // Check that monotonicity is preserved, i.e., once a bucket is set we do
     // not free it concurrently.
-    DCHECK_NOT_NULL(bucket);
     DCHECK_EQ(bucket, LoadBucket<access_mode>(&buckets_[bucket_index]));
     uint32_t mask = 1u << bit_index;
     if ((LoadCell<access_mode>(&bucket[cell_index]) & mask) == 0) {
@@ -89,6 +94,10 @@ class SlotSet : public Malloced {
     SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
     Bucket bucket = LoadBucket(&buckets_[bucket_index]);
     if (bucket == nullptr) return false;
+    if (IsInlineBucket(bucket)) {
+      return InlineBucketContains(bucket,
+                                  cell_index * kBitsPerCell + bit_index);
+    }
     return (LoadCell(&bucket[cell_index]) & (1u << bit_index)) != 0;
   }
 
@@ -96,7 +105,9 @@ class SlotSet : public Malloced {
   void Remove(int slot_offset) {
     int bucket_index, cell_index, bit_index;
     SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
-    Bucket bucket = LoadBucket(&buckets_[bucket_index]);
+    int index = cell_index * kBitsPerCell + bit_index;
+    Bucket bucket = RemoveFromInlineBucket(
+        bucket_index, [index](int slot_index) { return slot_index == index; });
     if (bucket != nullptr) {
       uint32_t cell = LoadCell(&bucket[cell_index]);
       uint32_t bit_mask = 1u << bit_index;
@@ -115,12 +126,15 @@ class SlotSet : public Malloced {
     SlotToIndices(start_offset, &start_bucket, &start_cell, &start_bit);
     int end_bucket, end_cell, end_bit;
     SlotToIndices(end_offset, &end_bucket, &end_cell, &end_bit);
+    RemoveRangeFromInlineBuckets(start_bucket,
+                                 start_cell * kBitsPerCell + start_bit,
+                                 end_bucket, end_cell * kBitsPerCell + end_bit);
     uint32_t start_mask = (1u << start_bit) - 1;
     uint32_t end_mask = ~((1u << end_bit) - 1);
     Bucket bucket;
     if (start_bucket == end_bucket && start_cell == end_cell) {
       bucket = LoadBucket(&buckets_[start_bucket]);
-      if (bucket != nullptr) {
+      if (IsBitmapBucket(bucket)) {
         ClearCellBits(&bucket[start_cell], ~(start_mask | end_mask));
       }
       return;
@@ -128,12 +142,12 @@ class SlotSet : public Malloced {
     int current_bucket = start_bucket;
     int current_cell = start_cell;
     bucket = LoadBucket(&buckets_[current_bucket]);
-    if (bucket != nullptr) {
+    if (IsBitmapBucket(bucket)) {
       ClearCellBits(&bucket[current_cell], ~start_mask);
     }
     current_cell++;
     if (current_bucket < end_bucket) {
-      if (bucket != nullptr) {
+      if (IsBitmapBucket(bucket)) {
         ClearBucket(bucket, current_cell, kCellsPerBucket);
       }
       // The rest of the current bucket is cleared.
@@ -151,18 +165,17 @@ class SlotSet : public Malloced {
       } else {
         DCHECK(mode == KEEP_EMPTY_BUCKETS);
         bucket = LoadBucket(&buckets_[current_bucket]);
-        if (bucket != nullptr) {
+        if (IsBitmapBucket(bucket)) {
           ClearBucket(bucket, 0, kCellsPerBucket);
         }
       }
       current_bucket++;
     }
     // All buckets between start_bucket and end_bucket are cleared.
-    bucket = LoadBucket(&buckets_[current_bucket]);
     DCHECK(current_bucket == end_bucket && current_cell <= end_cell);
-    if (current_bucket == kBuckets || bucket == nullptr) {
-      return;
-    }
+    if (current_bucket == kBuckets) return;
+    bucket = LoadBucket(&buckets_[current_bucket]);
+    if (!IsBitmapBucket(bucket)) return;
     while (current_cell < end_cell) {
       StoreCell(&bucket[current_cell], 0);
       current_cell++;
@@ -173,13 +186,7 @@ class SlotSet : public Malloced {
   }
 
   // The slot offset specifies a slot at address page_start_ + slot_offset.
-  bool Lookup(int slot_offset) {
-    int bucket_index, cell_index, bit_index;
-    SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
-    Bucket bucket = LoadBucket(&buckets_[bucket_index]);
-    if (bucket == nullptr) return false;
-    return (LoadCell(&bucket[cell_index]) & (1u << bit_index)) != 0;
-  }
+  bool Lookup(int slot_offset) { return Contains(slot_offset); }
 
   // Iterate over all slots in the set and for each slot invoke the callback.
   // If the callback returns REMOVE_SLOT then the slot is removed from the set.
@@ -197,30 +204,10 @@ class SlotSet : public Malloced {
     for (int bucket_index = 0; bucket_index < kBuckets; bucket_index++) {
       Bucket bucket = LoadBucket(&buckets_[bucket_index]);
       if (bucket != nullptr) {
-        int in_bucket_count = 0;
-        int cell_offset = bucket_index * kBitsPerBucket;
-        for (int i = 0; i < kCellsPerBucket; i++, cell_offset += kBitsPerCell) {
-          uint32_t cell = LoadCell(&bucket[i]);
-          if (cell) {
-            uint32_t old_cell = cell;
-            uint32_t mask = 0;
-            while (cell) {
-              int bit_offset = base::bits::CountTrailingZeros(cell);
-              uint32_t bit_mask = 1u << bit_offset;
-              uint32_t slot = (cell_offset + bit_offset) << kPointerSizeLog2;
-              if (callback(MaybeObjectSlot(page_start_ + slot)) == KEEP_SLOT) {
-                ++in_bucket_count;
-              } else {
-                mask |= bit_mask;
-              }
-              cell ^= bit_mask;
-            }
-            uint32_t new_cell = old_cell & ~mask;
-            if (old_cell != new_cell) {
-              ClearCellBits(&bucket[i], mask);
-            }
-          }
-        }
+        int in_bucket_count =
+            IsInlineBucket(bucket)
+                ? IterateInlineBucket(bucket_index, bucket, callback)
+                : IterateBitmapBucket(bucket_index, bucket, callback);
         if (mode == PREFREE_EMPTY_BUCKETS && in_bucket_count == 0) {
           PreFreeEmptyBucket(bucket_index);
         }
@@ -238,7 +225,7 @@ class SlotSet : public Malloced {
   void PreFreeEmptyBuckets() {
     for (int bucket_index = 0; bucket_index < kBuckets; bucket_index++) {
       Bucket bucket = LoadBucket(&buckets_[bucket_index]);
-      if (bucket != nullptr) {
+      if (IsBitmapBucket(bucket)) {
         if (IsEmptyBucket(bucket)) {
           PreFreeEmptyBucket(bucket_index);
         }
@@ -249,7 +236,7 @@ class SlotSet : public Malloced {
   void FreeEmptyBuckets() {
     for (int bucket_index = 0; bucket_index < kBuckets; bucket_index++) {
       Bucket bucket = LoadBucket(&buckets_[bucket_index]);
-      if (bucket != nullptr) {
+      if (IsBitmapBucket(bucket)) {
         if (IsEmptyBucket(bucket)) {
           ReleaseBucket(bucket_index);
         }
@@ -278,6 +265,185 @@ class SlotSet : public Malloced {
   static const int kBitsPerBucketLog2 = kCellsPerBucketLog2 + kBitsPerCellLog2;
   static const int kBuckets = kMaxSlots / kCellsPerBucket / kBitsPerCell;
 
+  // An inline bucket word has the low tag bit set, followed by the number of
+  // slots and their indices within the bucket in ascending order. Bitmaps
+  // are at least 4-byte aligned, so the tag never collides with them.
+  static const uintptr_t kInlineTag = 1;
+  static const int kInlineCountShift = 1;
+  static const int kInlineCountBits = kSystemPointerSize == 8 ? 3 : 2;
+  static const int kInlineSlotsShift = kInlineCountShift + kInlineCountBits;
+  static const int kInlineSlotBits = kBitsPerBucketLog2;
+  static const int kInlineSlots =
+      (kBitsPerSystemPointer - kInlineSlotsShift) / kInlineSlotBits;
+  STATIC_ASSERT(kInlineSlots < (1 << kInlineCountBits));
+
+  static bool IsInlineBucket(Bucket bucket) {
+    return (reinterpret_cast<uintptr_t>(bucket) & kInlineTag) != 0;
+  }
+
+  static bool IsBitmapBucket(Bucket bucket) {
+    return bucket != nullptr && !IsInlineBucket(bucket);
+  }
+
+  static int InlineBucketCount(Bucket bucket) {
+    DCHECK(IsInlineBucket(bucket));
+    return static_cast<int>((reinterpret_cast<uintptr_t>(bucket) >>
+                             kInlineCountShift) &
+                            ((1u << kInlineCountBits) - 1));
+  }
+
+  static int InlineBucketSlot(Bucket bucket, int i) {
+    DCHECK_LT(i, InlineBucketCount(bucket));
+    return static_cast<int>((reinterpret_cast<uintptr_t>(bucket) >>
+                             (kInlineSlotsShift + i * kInlineSlotBits)) &
+                            (kBitsPerBucket - 1));
+  }
+
+  // Encodes the sorted slot indices, an empty list is the nullptr bucket.
+  static Bucket MakeInlineBucket(const int* slots, int count) {
+    DCHECK_LE(count, kInlineSlots);
+    if (count == 0) return nullptr;
+    uintptr_t word = kInlineTag | (static_cast<uintptr_t>(count)
+                                   << kInlineCountShift);
+    for (int i = 0; i < count; i++) {
+      DCHECK(i == 0 || slots[i - 1] < slots[i]);
+      word |= static_cast<uintptr_t>(slots[i])
+              << (kInlineSlotsShift + i * kInlineSlotBits);
+    }
+    return reinterpret_cast<Bucket>(word);
+  }
+
+  static bool InlineBucketContains(Bucket bucket, int index) {
+    for (int i = 0; i < InlineBucketCount(bucket); i++) {
+      if (InlineBucketSlot(bucket, i) == index) return true;
+    }
+    return false;
+  }
+
+  // Returns the bucket with |index| added to the nullptr or inline |bucket|.
+  // That is |bucket| itself if it contains the index already and a newly
+  // allocated bitmap if the inline bucket overflows.
+  Bucket InsertIntoInlineBucket(Bucket bucket, int index) {
+    int slots[kInlineSlots + 1];
+    int count = 0;
+    if (bucket != nullptr) {
+      for (int i = 0; i < InlineBucketCount(bucket); i++) {
+        int slot = InlineBucketSlot(bucket, i);
+        if (slot == index) return bucket;
+        if (slot > index && count == i) slots[count++] = index;
+        slots[count++] = slot;
+      }
+    }
+    if (count == 0 || slots[count - 1] < index) slots[count++] = index;
+    if (count <= kInlineSlots) return MakeInlineBucket(slots, count);
+    Bucket bitmap = AllocateBucket();
+    for (int i = 0; i < count; i++) {
+      bitmap[slots[i] >> kBitsPerCellLog2] |=
+          1u << (slots[i] & (kBitsPerCell - 1));
+    }
+    return bitmap;
+  }
+
+  // Removes the slot indices for which |remove| returns true if the bucket
+  // at |bucket_index| is inline. Returns the bucket if it is a bitmap, so
+  // that the caller can remove the slots from it, and nullptr otherwise.
+  template <typename Predicate>
+  Bucket RemoveFromInlineBucket(int bucket_index, Predicate remove) {
+    Bucket bucket = LoadBucket(&buckets_[bucket_index]);
+    while (IsInlineBucket(bucket)) {
+      int slots[kInlineSlots];
+      int count = 0;
+      for (int i = 0; i < InlineBucketCount(bucket); i++) {
+        int slot = InlineBucketSlot(bucket, i);
+        if (!remove(slot)) slots[count++] = slot;
+      }
+      if (count == InlineBucketCount(bucket)) return nullptr;
+      Bucket old_bucket = CompareAndSwapBucket(
+          &buckets_[bucket_index], bucket, MakeInlineBucket(slots, count));
+      if (old_bucket == bucket) return nullptr;
+      bucket = old_bucket;
+    }
+    return bucket;
+  }
+
+  // Removes the slot indices in [start_index, end_index) of start_bucket up
+  // to the same range of end_bucket from all inline buckets in between.
+  void RemoveRangeFromInlineBuckets(int start_bucket, int start_index,
+                                    int end_bucket, int end_index) {
+    for (int bucket_index = start_bucket;
+         bucket_index <= end_bucket && bucket_index < kBuckets;
+         bucket_index++) {
+      int from = bucket_index == start_bucket ? start_index : 0;
+      int to = bucket_index == end_bucket ? end_index : kBitsPerBucket;
+      RemoveFromInlineBucket(bucket_index, [from, to](int slot_index) {
+        return from <= slot_index && slot_index < to;
+      });
+    }
+  }
+
+  template <typename Callback>
+  int IterateInlineBucket(int bucket_index, Bucket bucket, Callback callback) {
+    int removed[kInlineSlots];
+    int removed_count = 0;
+    int in_bucket_count = 0;
+    int bucket_offset = bucket_index * kBitsPerBucket;
+    for (int i = 0; i < InlineBucketCount(bucket); i++) {
+      int index = InlineBucketSlot(bucket, i);
+      uint32_t slot = (bucket_offset + index) << kPointerSizeLog2;
+      if (callback(MaybeObjectSlot(page_start_ + slot)) == KEEP_SLOT) {
+        ++in_bucket_count;
+      } else {
+        removed[removed_count++] = index;
+      }
+    }
+    if (removed_count > 0) {
+      auto is_removed = [&removed, removed_count](int slot_index) {
+        for (int i = 0; i < removed_count; i++) {
+          if (removed[i] == slot_index) return true;
+        }
+        return false;
+      };
+      // The bucket may have overflowed into a bitmap concurrently.
+      Bucket bitmap = RemoveFromInlineBucket(bucket_index, is_removed);
+      if (bitmap != nullptr) {
+        for (int i = 0; i < removed_count; i++) {
+          ClearCellBits(&bitmap[removed[i] >> kBitsPerCellLog2],
+                        1u << (removed[i] & (kBitsPerCell - 1)));
+        }
+      }
+    }
+    return in_bucket_count;
+  }
+
+  template <typename Callback>
+  int IterateBitmapBucket(int bucket_index, Bucket bucket, Callback callback) {
+    int in_bucket_count = 0;
+    int cell_offset = bucket_index * kBitsPerBucket;
+    for (int i = 0; i < kCellsPerBucket; i++, cell_offset += kBitsPerCell) {
+      uint32_t cell = LoadCell(&bucket[i]);
+      if (cell) {
+        uint32_t old_cell = cell;
+        uint32_t mask = 0;
+        while (cell) {
+          int bit_offset = base::bits::CountTrailingZeros(cell);
+          uint32_t bit_mask = 1u << bit_offset;
+          uint32_t slot = (cell_offset + bit_offset) << kPointerSizeLog2;
+          if (callback(MaybeObjectSlot(page_start_ + slot)) == KEEP_SLOT) {
+            ++in_bucket_count;
+          } else {
+            mask |= bit_mask;
+          }
+          cell ^= bit_mask;
+        }
+        uint32_t new_cell = old_cell & ~mask;
+        if (old_cell != new_cell) {
+          ClearCellBits(&bucket[i], mask);
+        }
+      }
+    }
+    return in_bucket_count;
+  }
+
   Bucket AllocateBucket() {
     Bucket result = NewArray<uint32_t>(kCellsPerBucket);
     for (int i = 0; i < kCellsPerBucket; i++) {
@@ -298,17 +464,17 @@ class SlotSet : public Malloced {
 
   void PreFreeEmptyBucket(int bucket_index) {
     Bucket bucket = LoadBucket(&buckets_[bucket_index]);
-    if (bucket != nullptr) {
+    if (IsBitmapBucket(bucket)) {
       base::MutexGuard guard(&to_be_freed_buckets_mutex_);
       to_be_freed_buckets_.push(bucket);
-      StoreBucket(&buckets_[bucket_index], nullptr);
     }
+    StoreBucket(&buckets_[bucket_index], nullptr);
   }
 
   void ReleaseBucket(int bucket_index) {
     Bucket bucket = LoadBucket(&buckets_[bucket_index]);
     StoreBucket(&buckets_[bucket_index], nullptr);
-    DeleteArray<uint32_t>(bucket);
+    if (IsBitmapBucket(bucket)) DeleteArray<uint32_t>(bucket);
   }
 
   template <AccessMode access_mode = AccessMode::ATOMIC>
@@ -336,15 +502,17 @@ class SlotSet : public Malloced {
     return true;
   }
 
+  // Returns the previous value of the bucket, the swap succeeded if it is
+  // |expected|.
   template <AccessMode access_mode = AccessMode::ATOMIC>
-  bool SwapInNewBucket(Bucket* bucket, Bucket value) {
+  Bucket CompareAndSwapBucket(Bucket* bucket, Bucket expected, Bucket value) {
     if (access_mode == AccessMode::ATOMIC) {
-      return base::AsAtomicPointer::Release_CompareAndSwap(bucket, nullptr,
-                                                           value) == nullptr;
+      return base::AsAtomicPointer::Release_CompareAndSwap(bucket, expected,
+                                                           value);
     } else {
-      DCHECK_NULL(*bucket);
+      DCHECK_EQ(expected, *bucket);
       *bucket = value;
-      return true;
+      return expected;
     }
   }
 
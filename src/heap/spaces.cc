@@ -17,6 +17,7 @@
 #include "src/heap/heap-controller.h"
 #include "src/heap/incremental-marking-inl.h"
 #include "src/heap/mark-compact.h"
+#include "src/heap/page-pool.h"
 #include "src/heap/remembered-set.h"
 #include "src/heap/slot-set.h"
 #include "src/heap/sweeper.h"
@@ -102,6 +103,9 @@ PauseAllocationObserversScope::~PauseAllocationObserversScope() {
   }
 }
 
+// Size of a transparent huge page on the platforms that support them.
+static const size_t kHugePageSize = 2 * MB;
+
 static base::LazyInstance<CodeRangeAddressHint>::type code_range_address_hint =
     LAZY_INSTANCE_INITIALIZER;
 
@@ -134,6 +138,7 @@ MemoryAllocator::MemoryAllocator(Isolate* isolate, size_t capacity,
       capacity_(RoundUp(capacity, Page::kPageSize)),
       size_(0),
       size_executable_(0),
+      huge_page_advised_size_(0),
       lowest_ever_allocated_(static_cast<Address>(-1ll)),
       highest_ever_allocated_(kNullAddress),
       unmapper_(isolate->heap(), this) {
@@ -169,9 +174,12 @@ void MemoryAllocator::InitializeCodePageAllocator(
   Address hint =
       RoundDown(code_range_address_hint.Pointer()->GetAddressHint(requested),
                 page_allocator->AllocatePageSize());
-  VirtualMemory reservation(
-      page_allocator, requested, reinterpret_cast<void*>(hint),
-      Max(kMinExpectedOSPageSize, page_allocator->AllocatePageSize()));
+  size_t alignment =
+      Max(kMinExpectedOSPageSize, page_allocator->AllocatePageSize());
+  // Huge pages can only back huge-page-aligned parts of the range.
+  if (FLAG_transparent_huge_pages) alignment = Max(alignment, kHugePageSize);
+  VirtualMemory reservation(page_allocator, requested,
+                            reinterpret_cast<void*>(hint), alignment);
   if (!reservation.IsReserved()) {
     V8::FatalProcessOutOfMemory(isolate_,
                                 "CodeRange setup: allocate virtual memory");
@@ -204,6 +212,12 @@ void MemoryAllocator::InitializeCodePageAllocator(
       NewEvent("CodeRange", reinterpret_cast<void*>(reservation.address()),
                requested));
 
+  if (FLAG_transparent_huge_pages &&
+      page_allocator->AdviseHugePages(
+          reinterpret_cast<void*>(reservation.address()), reservation.size())) {
+    huge_page_advised_size_ += reservation.size();
+  }
+
   heap_reservation_.TakeControl(&reservation);
   code_page_allocator_instance_ = base::make_unique<base::BoundedPageAllocator>(
       page_allocator, aligned_base, size,
@@ -346,6 +360,7 @@ void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks() {
   // Regular chunks.
   while ((chunk = GetMemoryChunkSafe<kRegular>()) != nullptr) {
     bool pooled = chunk->IsFlagSet(MemoryChunk::POOLED);
+    if (allocator_->TryAddToPagePool(chunk)) continue;
     allocator_->PerformFreeMemory(chunk);
     if (pooled) AddMemoryChunkSafe<kPooled>(chunk);
   }
@@ -358,6 +373,9 @@ void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks() {
     }
   }
   PerformFreeMemoryOnQueuedNonRegularChunks();
+  if (PagePool::IsEnabledFor(allocator_->data_page_allocator())) {
+    PagePool::Get()->ZeroDirtyPages();
+  }
 }
 
 void MemoryAllocator::Unmapper::TearDown() {
@@ -889,9 +907,29 @@ MemoryChunk* MemoryAllocator::AllocateChunk(size_t reserve_area_size,
                               executable, owner, std::move(reservation));
 
   if (chunk->executable()) RegisterExecutableMemoryChunk(chunk);
+  MaybeAdviseHugePages(chunk);
   return chunk;
 }
 
+void MemoryAllocator::MaybeAdviseHugePages(MemoryChunk* chunk) {
+  if (!FLAG_transparent_huge_pages) return;
+  // The code range was advised as a whole when it was reserved.
+  if (!code_range_.is_empty() && code_range_.contains(chunk->address())) {
+    return;
+  }
+  VirtualMemory* reservation = chunk->reserved_memory();
+  Address start =
+      reservation->IsReserved() ? reservation->address() : chunk->address();
+  size_t size = reservation->IsReserved() ? reservation->size() : chunk->size();
+  // Chunks are smaller than huge pages; the OS can still use huge pages once
+  // adjacent chunks form a large enough, suitably aligned region.
+  if (page_allocator(chunk->executable())
+          ->AdviseHugePages(reinterpret_cast<void*>(start), size)) {
+    chunk->SetFlag(MemoryChunk::HUGE_PAGES_ADVISED);
+    huge_page_advised_size_ += size;
+  }
+}
+
 void MemoryChunk::SetOldGenerationPageFlags(bool is_marking) {
   if (is_marking) {
     SetFlag(MemoryChunk::POINTERS_TO_HERE_ARE_INTERESTING);
@@ -1061,6 +1099,10 @@ void MemoryAllocator::PreFreeMemory(MemoryChunk* chunk) {
     DCHECK_GE(size_executable_, size);
     size_executable_ -= size;
   }
+  if (chunk->IsFlagSet(MemoryChunk::HUGE_PAGES_ADVISED)) {
+    DCHECK_GE(huge_page_advised_size_, size);
+    huge_page_advised_size_ -= size;
+  }
 
   chunk->SetFlag(MemoryChunk::PRE_FREED);
 
@@ -1068,6 +1110,25 @@ void MemoryAllocator::PreFreeMemory(MemoryChunk* chunk) {
 }
 
 
+bool MemoryAllocator::TryAddToPagePool(MemoryChunk* chunk) {
+  DCHECK(chunk->IsFlagSet(MemoryChunk::PRE_FREED));
+  VirtualMemory* reservation = chunk->reserved_memory();
+  if (!PagePool::IsEnabledFor(data_page_allocator()) ||
+      chunk->executable() == EXECUTABLE ||
+      chunk->owner()->identity() == RO_SPACE || !reservation->IsReserved() ||
+      reservation->address() != chunk->address() ||
+      reservation->size() != static_cast<size_t>(MemoryChunk::kPageSize)) {
+    return false;
+  }
+  DCHECK_EQ(reservation->page_allocator(), data_page_allocator());
+  chunk->ReleaseAllocatedMemory();
+  // The page stays committed. Once it is in the pool the chunk header must not
+  // be touched anymore since the pool zeroes the page concurrently.
+  if (!PagePool::Get()->Add(chunk->address())) return false;
+  isolate_->counters()->memory_allocated()->Decrement(MemoryChunk::kPageSize);
+  return true;
+}
+
 void MemoryAllocator::PerformFreeMemory(MemoryChunk* chunk) {
   DCHECK(chunk->IsFlagSet(MemoryChunk::PRE_FREED));
   chunk->ReleaseAllocatedMemory();
@@ -1092,7 +1153,7 @@ void MemoryAllocator::Free(MemoryChunk* chunk) {
   switch (mode) {
     case kFull:
       PreFreeMemory(chunk);
-      PerformFreeMemory(chunk);
+      if (!TryAddToPagePool(chunk)) PerformFreeMemory(chunk);
       break;
     case kAlreadyPooled:
       // Pooled pages cannot be touched anymore as their memory is uncommitted.
@@ -1135,6 +1196,14 @@ Page* MemoryAllocator::AllocatePage(size_t size, SpaceType* owner,
                             owner->identity())));
     DCHECK_EQ(executable, NOT_EXECUTABLE);
     chunk = AllocatePagePooled(owner);
+  } else if (executable == NOT_EXECUTABLE &&
+             owner->identity() != CODE_SPACE &&
+             owner->identity() != RO_SPACE &&
+             size == MemoryChunkLayout::AllocatableMemoryInMemoryChunk(
+                         owner->identity()) &&
+             PagePool::IsEnabledFor(data_page_allocator())) {
+    // Regular data pages can be taken from the process-wide page pool, too.
+    chunk = AllocatePagePooled(owner);
   }
   if (chunk == nullptr) {
     chunk = AllocateChunk(size, size, executable, owner);
@@ -1163,24 +1232,38 @@ LargePage* MemoryAllocator::AllocateLargePage(size_t size,
 
 template <typename SpaceType>
 MemoryChunk* MemoryAllocator::AllocatePagePooled(SpaceType* owner) {
-  MemoryChunk* chunk = unmapper()->TryGetPooledMemoryChunkSafe();
-  if (chunk == nullptr) return nullptr;
   const int size = MemoryChunk::kPageSize;
-  const Address start = reinterpret_cast<Address>(chunk);
+  VirtualMemory reservation;
+  if (PagePool::IsEnabledFor(data_page_allocator())) {
+    Address page = PagePool::Get()->Remove();
+    if (page != kNullAddress) {
+      // Pages from the process-wide pool are still committed and zeroed.
+      reservation = VirtualMemory(data_page_allocator(), page, size);
+      UpdateAllocatedSpaceLimits(page, page + size);
+      isolate_->counters()->memory_allocated()->Increment(size);
+    }
+  }
+  if (!reservation.IsReserved()) {
+    MemoryChunk* chunk = unmapper()->TryGetPooledMemoryChunkSafe();
+    if (chunk == nullptr) return nullptr;
+    reservation = VirtualMemory(data_page_allocator(), chunk->address(), size);
+    if (!CommitMemory(&reservation)) return nullptr;
+  }
+  const Address start = reservation.address();
+  MemoryChunk* chunk = reinterpret_cast<MemoryChunk*>(start);
   const Address area_start =
       start +
       MemoryChunkLayout::ObjectStartOffsetInMemoryChunk(owner->identity());
   const Address area_end = start + size;
   // Pooled pages are always regular data pages.
   DCHECK_NE(CODE_SPACE, owner->identity());
-  VirtualMemory reservation(data_page_allocator(), start, size);
-  if (!CommitMemory(&reservation)) return nullptr;
   if (Heap::ShouldZapGarbage()) {
     ZapBlock(start, size, kZapValue);
   }
   MemoryChunk::Initialize(isolate_->heap(), start, size, area_start, area_end,
                           NOT_EXECUTABLE, owner, std::move(reservation));
   size_ += size;
+  MaybeAdviseHugePages(chunk);
   return chunk;
 }
 
@@ -3727,7 +3810,19 @@ NewLargeObjectSpace::NewLargeObjectSpace(Heap* heap)
     : LargeObjectSpace(heap, NEW_LO_SPACE) {}
 
 AllocationResult NewLargeObjectSpace::AllocateRaw(int object_size) {
-  // TODO(hpayer): Add heap growing strategy here.
+  // Do not allocate more objects if promoting the existing objects would
+  // exceed the old generation capacity.
+  if (!heap()->CanExpandOldGeneration(SizeOfObjects())) {
+    return AllocationResult::Retry(identity());
+  }
+
+  // The young large objects share the budget of the semi space, so that they
+  // trigger a scavenge in the same way as regular young objects do. The first
+  // object is always allocated, independent of the capacity.
+  if (SizeOfObjects() > 0 && static_cast<size_t>(object_size) > Available()) {
+    return AllocationResult::Retry(identity());
+  }
+
   LargePage* page = AllocateLargePage(object_size, NOT_EXECUTABLE);
   if (page == nullptr) return AllocationResult::Retry(identity());
   page->SetYoungGenerationPageFlags(heap()->incremental_marking()->IsMarking());
@@ -3737,8 +3832,9 @@ AllocationResult NewLargeObjectSpace::AllocateRaw(int object_size) {
 }
 
 size_t NewLargeObjectSpace::Available() {
-  // TODO(hpayer): Update as soon as we have a growing strategy.
-  return 0;
+  size_t capacity = heap()->new_space()->Capacity();
+  size_t size = SizeOfObjects();
+  return capacity > size ? capacity - size : 0;
 }
 
 void NewLargeObjectSpace::Flip() {
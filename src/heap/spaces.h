@@ -323,7 +323,11 @@ class MemoryChunk {
 
     // |INCREMENTAL_MARKING|: Indicates whether incremental marking is currently
     // enabled.
-    INCREMENTAL_MARKING = 1u << 18
+    INCREMENTAL_MARKING = 1u << 18,
+
+    // |HUGE_PAGES_ADVISED|: The OS was asked to back this chunk with
+    // transparent huge pages (--transparent-huge-pages).
+    HUGE_PAGES_ADVISED = 1u << 19
   };
 
   using Flags = uintptr_t;
@@ -402,6 +406,9 @@ class MemoryChunk {
   // TODO(6792,mstarzinger): Drop to 3 or lower once WebAssembly is off heap.
   static const int kMaxWriteUnprotectCounter = 4;
 
+  // Granularity in which large FixedArrays with a progress bar are scanned.
+  static const int kProgressBarScanningChunk = 32 * 1024;
+
   // Only works if the pointer is in the first kPageSize of the MemoryChunk.
   static MemoryChunk* FromAddress(Address a) {
     return reinterpret_cast<MemoryChunk*>(a & ~kAlignmentMask);
@@ -537,13 +544,37 @@ class MemoryChunk {
   Address HighWaterMark() { return address() + high_water_mark_; }
 
   int progress_bar() {
-    DCHECK(IsFlagSet(HAS_PROGRESS_BAR));
-    return static_cast<int>(progress_bar_);
+    DCHECK(IsFlagSet<AccessMode::ATOMIC>(HAS_PROGRESS_BAR));
+    return static_cast<int>(base::AsAtomicWord::Relaxed_Load(&progress_bar_));
   }
 
   void set_progress_bar(int progress_bar) {
-    DCHECK(IsFlagSet(HAS_PROGRESS_BAR));
-    progress_bar_ = progress_bar;
+    DCHECK(IsFlagSet<AccessMode::ATOMIC>(HAS_PROGRESS_BAR));
+    base::AsAtomicWord::Relaxed_Store(&progress_bar_, progress_bar);
+  }
+
+  // Claims the next kProgressBarScanningChunk bytes of the large object on
+  // this chunk for scanning, starting no earlier than |min_offset|. Marking
+  // tasks use this to scan one array with a progress bar in parallel. Returns
+  // false if the object has been scanned up to |object_size| already.
+  bool ClaimProgressBarChunk(int min_offset, int object_size,
+                             int* start_offset, int* end_offset) {
+    DCHECK(IsFlagSet<AccessMode::ATOMIC>(HAS_PROGRESS_BAR));
+    intptr_t current = base::AsAtomicWord::Relaxed_Load(&progress_bar_);
+    while (true) {
+      intptr_t start = Max<intptr_t>(min_offset, current);
+      if (start >= object_size) return false;
+      intptr_t end =
+          Min<intptr_t>(object_size, start + kProgressBarScanningChunk);
+      intptr_t previous = base::AsAtomicWord::Release_CompareAndSwap(
+          &progress_bar_, current, end);
+      if (previous == current) {
+        *start_offset = static_cast<int>(start);
+        *end_offset = static_cast<int>(end);
+        return true;
+      }
+      current = previous;
+    }
   }
 
   void ResetProgressBar() {
@@ -1308,6 +1339,10 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
   // Returns allocated executable spaces in bytes.
   size_t SizeExecutable() { return size_executable_; }
 
+  // Returns the bytes of reserved memory, including the code range, that the
+  // OS was asked to back with transparent huge pages.
+  size_t HugePageAdvisedSize() { return huge_page_advised_size_; }
+
   // Returns the maximum available bytes of heaps.
   size_t Available() {
     const size_t size = Size();
@@ -1429,6 +1464,15 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
              !highest_ever_allocated_.compare_exchange_weak(ptr, high));
   }
 
+  // Advises huge pages for the chunk's reservation with
+  // --transparent-huge-pages.
+  void MaybeAdviseHugePages(MemoryChunk* chunk);
+
+  // Hands a pre-freed regular data page over to the process-wide PagePool.
+  // Returns false if the page cannot be pooled, in which case it has to be
+  // freed as usual.
+  bool TryAddToPagePool(MemoryChunk* chunk);
+
   void RegisterExecutableMemoryChunk(MemoryChunk* chunk) {
     DCHECK(chunk->IsFlagSet(MemoryChunk::IS_EXECUTABLE));
     DCHECK_EQ(executable_memory_.find(chunk), executable_memory_.end());
@@ -1487,6 +1531,8 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
   std::atomic<size_t> size_;
   // Allocated executable space size in bytes.
   std::atomic<size_t> size_executable_;
+  // Reserved space size in bytes for which huge pages were advised.
+  std::atomic<size_t> huge_page_advised_size_;
 
   // We keep the lowest and highest addresses allocated as a quick way
   // of determining that pointers are outside the heap. The estimate is
@@ -2914,6 +2960,12 @@ class MapSpace : public PagedSpace {
 
 // -----------------------------------------------------------------------------
 // Read Only space for all Immortal Immovable and Immutable objects
+//
+// TODO(v8:7464): Each isolate deserializes its own copy of this space. It
+// can't be shared between isolates yet, because HeapObject::GetReadOnlyRoots
+// and the remaining GetIsolate/GetHeap users find the isolate through the
+// MemoryChunk's heap pointer. Also, rehashing the snapshot with a per-isolate
+// hash seed writes to the read-only hash tables.
 
 class ReadOnlySpace : public PagedSpace {
  public:
@@ -54,10 +54,10 @@ void StoreBuffer::SetUp() {
   Address start = reservation.address();
   const size_t allocated_size = reservation.size();
 
-  start_[0] = reinterpret_cast<Address*>(start);
-  limit_[0] = start_[0] + (kStoreBufferSize / kPointerSize);
-  start_[1] = limit_[0];
-  limit_[1] = start_[1] + (kStoreBufferSize / kPointerSize);
+  for (int i = 0; i < kStoreBuffers; i++) {
+    start_[i] = i == 0 ? reinterpret_cast<Address*>(start) : limit_[i - 1];
+    limit_[i] = start_[i] + (kStoreBufferSize / kPointerSize);
+  }
 
   // Sanity check the buffers.
   Address* vm_limit = reinterpret_cast<Address*>(start + allocated_size);
@@ -142,7 +142,9 @@ int StoreBuffer::StoreBufferOverflow(Isolate* isolate) {
 
 void StoreBuffer::FlipStoreBuffers() {
   base::MutexGuard guard(&mutex_);
-  int other = (current_ + 1) % kStoreBuffers;
+  int other = NextStoreBuffer(current_);
+  // The next buffer holds the oldest entries if the concurrent thread did not
+  // get to it yet, so it may be processed before all others.
   MoveEntriesToRememberedSet(other);
   lazy_top_[current_] = top_;
   current_ = other;
@@ -193,18 +195,30 @@ void StoreBuffer::MoveEntriesToRememberedSet(int index) {
 
 void StoreBuffer::MoveAllEntriesToRememberedSet() {
   base::MutexGuard guard(&mutex_);
-  int other = (current_ + 1) % kStoreBuffers;
-  MoveEntriesToRememberedSet(other);
+  // Process the buffers in the order they were filled, ending with the
+  // current one.
+  for (int i = NextStoreBuffer(current_); i != current_;
+       i = NextStoreBuffer(i)) {
+    MoveEntriesToRememberedSet(i);
+  }
   lazy_top_[current_] = top_;
   MoveEntriesToRememberedSet(current_);
   top_ = start_[current_];
 }
 
 void StoreBuffer::ConcurrentlyProcessStoreBuffer() {
-  base::MutexGuard guard(&mutex_);
-  int other = (current_ + 1) % kStoreBuffers;
-  MoveEntriesToRememberedSet(other);
-  task_running_ = false;
+  while (true) {
+    base::MutexGuard guard(&mutex_);
+    int oldest = NextStoreBuffer(current_);
+    while (oldest != current_ && !lazy_top_[oldest]) {
+      oldest = NextStoreBuffer(oldest);
+    }
+    if (oldest == current_) {
+      task_running_ = false;
+      return;
+    }
+    MoveEntriesToRememberedSet(oldest);
+  }
 }
 
 }  // namespace internal
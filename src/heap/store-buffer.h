@@ -27,7 +27,7 @@ class StoreBuffer {
  public:
   enum StoreBufferMode { IN_GC, NOT_IN_GC };
 
-  static const int kStoreBuffers = 2;
+  static const int kStoreBuffers = 4;
   static const int kStoreBufferSize =
       Max(static_cast<int>(kMinExpectedOSPageSize / kStoreBuffers),
           1 << (11 + kPointerSizeLog2));
@@ -95,7 +95,9 @@ class StoreBuffer {
   void SetMode(StoreBufferMode mode);
 
   // Used by the concurrent processing thread to transfer entries from the
-  // store buffer to the remembered set.
+  // store buffers to the remembered set, oldest first. The lock is released
+  // between buffers so that the main thread is never blocked for more than
+  // one buffer.
   void ConcurrentlyProcessStoreBuffer();
 
   bool Empty() {
@@ -110,13 +112,15 @@ class StoreBuffer {
   Heap* heap() { return heap_; }
 
  private:
-  // There are two store buffers. If one store buffer fills up, the main thread
-  // publishes the top pointer of the store buffer that needs processing in its
-  // global lazy_top_ field. After that it start the concurrent processing
-  // thread. The concurrent processing thread uses the pointer in lazy_top_.
-  // It will grab the given mutex and transfer its entries to the remembered
-  // set. If the concurrent thread does not make progress, the main thread will
-  // perform the work.
+  // There are kStoreBuffers store buffers which are used in a ring. If one
+  // store buffer fills up, the main thread publishes the top pointer of the
+  // store buffer that needs processing in its global lazy_top_ field and moves
+  // on to the next buffer. After that it starts the concurrent processing
+  // thread. The concurrent processing thread uses the pointers in lazy_top_.
+  // It will grab the given mutex and transfer the entries of one buffer at a
+  // time to the remembered set. Only if the concurrent thread did not make
+  // progress by the time the ring wraps around, the main thread will process
+  // the next buffer itself.
   // Important: there is an ordering constrained. The store buffer with the
   // older entries has to be processed first.
   class Task : public CancelableTask {
@@ -142,6 +146,8 @@ class StoreBuffer {
 
   void FlipStoreBuffers();
 
+  int NextStoreBuffer(int index) const { return (index + 1) % kStoreBuffers; }
+
   Heap* heap_;
 
   Address* top_;
@@ -153,7 +159,9 @@ class StoreBuffer {
   Address* start_[kStoreBuffers];
   Address* limit_[kStoreBuffers];
 
-  // At most one lazy_top_ pointer is set at any time.
+  // The lazy_top_ pointers of all buffers but the current one may be set. The
+  // buffers with a lazy_top_ pointer form a contiguous run in the ring which
+  // ends right before current_.
   Address* lazy_top_[kStoreBuffers];
   base::Mutex mutex_;
 
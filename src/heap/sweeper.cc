@@ -515,13 +515,24 @@ void Sweeper::EnsurePageIsIterable(Page* page) {
     SweepOrWaitUntilSweepingCompleted(page);
   } else {
     DCHECK(IsValidIterabilitySpace(space));
-    EnsureIterabilityCompleted();
+    // Only the given page has to be iterable, the iterability task may keep
+    // processing the others. This blocks only if the task is processing the
+    // page right now.
+    if (!page->SweepingDone()) MakeIterableIfPending(page);
+    DCHECK(page->SweepingDone());
   }
 }
 
 void Sweeper::EnsureIterabilityCompleted() {
   if (!iterability_in_progress_) return;
 
+  // Process the pages that the iterability task has not reached yet instead
+  // of waiting for it, starting from the other end of the list.
+  for (auto it = iterability_list_.rbegin(); it != iterability_list_.rend();
+       ++it) {
+    MakeIterableIfPending(*it);
+  }
+
   if (FLAG_concurrent_sweeping && iterability_task_started_) {
     if (heap_->isolate()->cancelable_task_manager()->TryAbort(
             iterability_task_id_) != TryAbortResult::kTaskAborted) {
@@ -530,9 +541,6 @@ void Sweeper::EnsureIterabilityCompleted() {
     iterability_task_started_ = false;
   }
 
-  for (Page* page : iterability_list_) {
-    MakeIterable(page);
-  }
   iterability_list_.clear();
   iterability_in_progress_ = false;
 }
@@ -553,9 +561,8 @@ class Sweeper::IterabilityTask final : public CancelableTask {
     TRACE_BACKGROUND_GC(tracer_,
                         GCTracer::BackgroundScope::MC_BACKGROUND_SWEEPING);
     for (Page* page : sweeper_->iterability_list_) {
-      sweeper_->MakeIterable(page);
+      sweeper_->MakeIterableIfPending(page);
     }
-    sweeper_->iterability_list_.clear();
     pending_iterability_task_->Signal();
   }
 
@@ -590,6 +597,17 @@ void Sweeper::AddPageForIterability(Page* page) {
   page->set_concurrent_sweeping_state(Page::kSweepingPending);
 }
 
+void Sweeper::MakeIterableIfPending(Page* page) {
+  // Early bailout without taking the lock, see ParallelSweepPage.
+  if (page->SweepingDone()) return;
+  base::MutexGuard guard(page->mutex());
+  if (page->SweepingDone()) return;
+  DCHECK_EQ(Page::kSweepingPending, page->concurrent_sweeping_state());
+  page->set_concurrent_sweeping_state(Page::kSweepingInProgress);
+  MakeIterable(page);
+  DCHECK(page->SweepingDone());
+}
+
 void Sweeper::MakeIterable(Page* page) {
   DCHECK(IsValidIterabilitySpace(page->owner()->identity()));
   const FreeSpaceTreatmentMode free_space_mode =
@@ -147,6 +147,10 @@ class Sweeper {
 
   void SweepOrWaitUntilSweepingCompleted(Page* page);
 
+  // Makes the page iterable unless the iterability task or the main thread
+  // has done so already. Pages are claimed under the page mutex, so this
+  // blocks while another thread is processing the page.
+  void MakeIterableIfPending(Page* page);
   void MakeIterable(Page* page);
 
   bool IsValidIterabilitySpace(AllocationSpace space) {
@@ -56,7 +56,7 @@ class Worklist {
     int task_id_;
   };
 
-  static const int kMaxNumTasks = 8;
+  static const int kMaxNumTasks = 16;
   static const size_t kSegmentCapacity = SEGMENT_SIZE;
 
   Worklist() : Worklist(kMaxNumTasks) {}
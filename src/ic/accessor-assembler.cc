@@ -2272,7 +2272,8 @@ enum AccessorAssembler::StubCacheTable : int {
   kSecondary = static_cast<int>(StubCache::kSecondary)
 };
 
-Node* AccessorAssembler::StubCachePrimaryOffset(Node* name, Node* map) {
+Node* AccessorAssembler::StubCachePrimaryOffset(StubCache* stub_cache,
+                                                Node* name, Node* map) {
   // See v8::internal::StubCache::PrimaryOffset().
   STATIC_ASSERT(StubCache::kCacheIndexShift == Name::kHashShift);
   // Compute the hash of the name (use entire hash field).
@@ -2288,21 +2289,24 @@ Node* AccessorAssembler::StubCachePrimaryOffset(Node* name, Node* map) {
   Node* map32 = TruncateIntPtrToInt32(BitcastTaggedToWord(map));
   // Base the offset on a simple combination of name and map.
   Node* hash = Int32Add(hash_field, map32);
-  uint32_t mask = (StubCache::kPrimaryTableSize - 1)
-                  << StubCache::kCacheIndexShift;
-  return ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  Node* mask = Load(MachineType::Uint32(),
+                    ExternalConstant(ExternalReference::Create(
+                        stub_cache->mask_reference(StubCache::kPrimary))));
+  return ChangeUint32ToWord(Word32And(hash, mask));
 }
 
-Node* AccessorAssembler::StubCacheSecondaryOffset(Node* name, Node* seed) {
+Node* AccessorAssembler::StubCacheSecondaryOffset(StubCache* stub_cache,
+                                                  Node* name, Node* seed) {
   // See v8::internal::StubCache::SecondaryOffset().
 
   // Use the seed from the primary cache in the secondary cache.
   Node* name32 = TruncateIntPtrToInt32(BitcastTaggedToWord(name));
   Node* hash = Int32Sub(TruncateIntPtrToInt32(seed), name32);
   hash = Int32Add(hash, Int32Constant(StubCache::kSecondaryMagic));
-  int32_t mask = (StubCache::kSecondaryTableSize - 1)
-                 << StubCache::kCacheIndexShift;
-  return ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  Node* mask = Load(MachineType::Uint32(),
+                    ExternalConstant(ExternalReference::Create(
+                        stub_cache->mask_reference(StubCache::kSecondary))));
+  return ChangeUint32ToWord(Word32And(hash, mask));
 }
 
 void AccessorAssembler::TryProbeStubCacheTable(
@@ -2315,22 +2319,23 @@ void AccessorAssembler::TryProbeStubCacheTable(
   const int kMultiplier = sizeof(StubCache::Entry) >> Name::kHashShift;
   entry_offset = IntPtrMul(entry_offset, IntPtrConstant(kMultiplier));
 
-  // Check that the key in the entry matches the name.
-  Node* key_base = ExternalConstant(
-      ExternalReference::Create(stub_cache->key_reference(table)));
+  // Check that the key in the entry matches the name. The table itself is
+  // reallocated when the cache grows, so load its current address.
+  Node* key_base = Load(MachineType::Pointer(),
+                        ExternalConstant(ExternalReference::Create(
+                            stub_cache->table_reference(table))));
+  STATIC_ASSERT(offsetof(StubCache::Entry, key) == 0);
   Node* entry_key = Load(MachineType::Pointer(), key_base, entry_offset);
   GotoIf(WordNotEqual(name, entry_key), if_miss);
 
   // Get the map entry from the cache.
-  DCHECK_EQ(kPointerSize * 2, stub_cache->map_reference(table).address() -
-                                  stub_cache->key_reference(table).address());
+  STATIC_ASSERT(offsetof(StubCache::Entry, map) == kPointerSize * 2);
   Node* entry_map =
       Load(MachineType::Pointer(), key_base,
            IntPtrAdd(entry_offset, IntPtrConstant(kPointerSize * 2)));
   GotoIf(WordNotEqual(map, entry_map), if_miss);
 
-  DCHECK_EQ(kPointerSize, stub_cache->value_reference(table).address() -
-                              stub_cache->key_reference(table).address());
+  STATIC_ASSERT(offsetof(StubCache::Entry, value) == kPointerSize);
   TNode<MaybeObject> handler = ReinterpretCast<MaybeObject>(
       Load(MachineType::AnyTagged(), key_base,
            IntPtrAdd(entry_offset, IntPtrConstant(kPointerSize))));
@@ -2355,14 +2360,16 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache, Node* receiver,
   Node* receiver_map = LoadMap(receiver);
 
   // Probe the primary table.
-  Node* primary_offset = StubCachePrimaryOffset(name, receiver_map);
+  Node* primary_offset =
+      StubCachePrimaryOffset(stub_cache, name, receiver_map);
   TryProbeStubCacheTable(stub_cache, kPrimary, primary_offset, name,
                          receiver_map, if_handler, var_handler, &try_secondary);
 
   BIND(&try_secondary);
   {
     // Probe the secondary table.
-    Node* secondary_offset = StubCacheSecondaryOffset(name, primary_offset);
+    Node* secondary_offset =
+        StubCacheSecondaryOffset(stub_cache, name, primary_offset);
     TryProbeStubCacheTable(stub_cache, kSecondary, secondary_offset, name,
                            receiver_map, if_handler, var_handler, &miss);
   }
@@ -2699,39 +2706,11 @@ void AccessorAssembler::KeyedLoadIC(const LoadICParameters* p) {
   {
     // We might have a name in feedback, and a weak fixed array in the next
     // slot.
-    Node* name = p->name;
     Comment("KeyedLoadIC_try_polymorphic_name");
-    VARIABLE(var_name, MachineRepresentation::kTagged, name);
-    VARIABLE(var_index, MachineType::PointerRepresentation());
-    Label if_polymorphic_name(this, &var_name), if_internalized(this),
-        if_notinternalized(this, Label::kDeferred);
-
-    // Fast-case: The recorded {feedback} matches the {name}.
-    GotoIf(WordEqual(strong_feedback, name), &if_polymorphic_name);
-
-    // Try to internalize the {name} if it isn't already.
-    TryToName(name, &miss, &var_index, &if_internalized, &var_name, &miss,
-              &if_notinternalized);
-
-    BIND(&if_internalized);
-    {
-      // The {var_name} now contains a unique name.
-      Branch(WordEqual(strong_feedback, var_name.value()), &if_polymorphic_name,
-             &miss);
-    }
-
-    BIND(&if_notinternalized);
-    {
-      // Try to internalize the {name}.
-      Node* function = ExternalConstant(
-          ExternalReference::try_internalize_string_function());
-      Node* const isolate_ptr =
-          ExternalConstant(ExternalReference::isolate_address(isolate()));
-      var_name.Bind(CallCFunction2(
-          MachineType::AnyTagged(), MachineType::Pointer(),
-          MachineType::AnyTagged(), function, isolate_ptr, name));
-      Goto(&if_internalized);
-    }
+    VARIABLE(var_name, MachineRepresentation::kTagged, p->name);
+    Label if_polymorphic_name(this, &var_name);
+    BranchIfFeedbackNameMatches(p->name, strong_feedback, &var_name,
+                                &if_polymorphic_name, &miss);
 
     BIND(&if_polymorphic_name);
     {
@@ -2751,6 +2730,48 @@ void AccessorAssembler::KeyedLoadIC(const LoadICParameters* p) {
   }
 }
 
+void AccessorAssembler::BranchIfFeedbackNameMatches(Node* name,
+                                                    Node* feedback_name,
+                                                    Variable* var_unique,
+                                                    Label* if_match,
+                                                    Label* miss) {
+  DCHECK_EQ(MachineRepresentation::kTagged, var_unique->rep());
+  VARIABLE(var_index, MachineType::PointerRepresentation());
+  Label if_internalized(this, var_unique),
+      if_notinternalized(this, Label::kDeferred);
+
+  // Fast-case: The recorded {feedback_name} matches the {name}.
+  var_unique->Bind(name);
+  GotoIf(WordEqual(feedback_name, name), if_match);
+
+  // Try to internalize the {name} if it isn't already.
+  TryToName(name, miss, &var_index, &if_internalized, var_unique, miss,
+            &if_notinternalized);
+
+  BIND(&if_notinternalized);
+  {
+    // Look up the {name} in the string table. On success this also turns
+    // {name} into a ThinString, so that subsequent accesses with the same
+    // key take the fast path in TryToName above.
+    Node* function =
+        ExternalConstant(ExternalReference::try_internalize_string_function());
+    Node* const isolate_ptr =
+        ExternalConstant(ExternalReference::isolate_address(isolate()));
+    var_unique->Bind(CallCFunction2(MachineType::AnyTagged(),
+                                    MachineType::Pointer(),
+                                    MachineType::AnyTagged(), function,
+                                    isolate_ptr, name));
+    Goto(&if_internalized);
+  }
+
+  BIND(&if_internalized);
+  {
+    // The {var_unique} now contains a unique name, or a Smi if {name} was not
+    // found in the string table.
+    Branch(WordEqual(feedback_name, var_unique->value()), if_match, miss);
+  }
+}
+
 void AccessorAssembler::KeyedLoadICGeneric(const LoadICParameters* p) {
   VARIABLE(var_index, MachineType::PointerRepresentation());
   VARIABLE(var_unique, MachineRepresentation::kTagged, p->name);
@@ -3057,8 +3078,11 @@ void AccessorAssembler::KeyedStoreIC(const StoreICParameters* p) {
   Label miss(this, Label::kDeferred);
   {
     TVARIABLE(MaybeObject, var_handler);
+    // The {p->name}, or its internalized version for polymorphic name
+    // feedback.
+    VARIABLE(var_name, MachineRepresentation::kTagged, p->name);
 
-    Label if_handler(this, &var_handler),
+    Label if_handler(this, {&var_handler, &var_name}),
         try_polymorphic(this, Label::kDeferred),
         try_megamorphic(this, Label::kDeferred),
         try_polymorphic_name(this, Label::kDeferred);
@@ -3073,7 +3097,9 @@ void AccessorAssembler::KeyedStoreIC(const StoreICParameters* p) {
     BIND(&if_handler);
     {
       Comment("KeyedStoreIC_if_handler");
-      HandleStoreICHandlerCase(p, var_handler.value(), &miss,
+      StoreICParameters pp = *p;
+      pp.name = var_name.value();
+      HandleStoreICHandlerCase(&pp, var_handler.value(), &miss,
                                ICMode::kNonGlobalIC, kSupportElements);
     }
 
@@ -3103,7 +3129,11 @@ void AccessorAssembler::KeyedStoreIC(const StoreICParameters* p) {
     {
       // We might have a name in feedback, and a fixed array in the next slot.
       Comment("KeyedStoreIC_try_polymorphic_name");
-      GotoIfNot(WordEqual(strong_feedback, p->name), &miss);
+      Label if_polymorphic_name(this, &var_name);
+      BranchIfFeedbackNameMatches(p->name, strong_feedback, &var_name,
+                                  &if_polymorphic_name, &miss);
+
+      BIND(&if_polymorphic_name);
       // If the name comparison succeeded, we know we have a feedback vector
       // with at least one map/handler pair.
       TNode<MaybeObject> feedback_element = LoadFeedbackVectorSlot(
@@ -57,11 +57,13 @@ class AccessorAssembler : public CodeStubAssembler {
                          Label* if_handler, TVariable<MaybeObject>* var_handler,
                          Label* if_miss);
 
-  Node* StubCachePrimaryOffsetForTesting(Node* name, Node* map) {
-    return StubCachePrimaryOffset(name, map);
+  Node* StubCachePrimaryOffsetForTesting(StubCache* stub_cache, Node* name,
+                                         Node* map) {
+    return StubCachePrimaryOffset(stub_cache, name, map);
   }
-  Node* StubCacheSecondaryOffsetForTesting(Node* name, Node* map) {
-    return StubCacheSecondaryOffset(name, map);
+  Node* StubCacheSecondaryOffsetForTesting(StubCache* stub_cache, Node* name,
+                                           Node* map) {
+    return StubCacheSecondaryOffset(stub_cache, name, map);
   }
 
   struct LoadICParameters {
@@ -167,6 +169,14 @@ class AccessorAssembler : public CodeStubAssembler {
 
   // IC dispatcher behavior.
 
+  // Checks whether {name} is the {feedback_name} recorded for a keyed access
+  // site, internalizing {name} through a string table lookup if necessary.
+  // Jumps to {if_match} with the unique name in {var_unique}, or to {miss}.
+  // The {if_match} label must merge {var_unique}.
+  void BranchIfFeedbackNameMatches(Node* name, Node* feedback_name,
+                                   Variable* var_unique, Label* if_match,
+                                   Label* miss);
+
   // Checks monomorphic case. Returns {feedback} entry of the vector.
   TNode<MaybeObject> TryMonomorphicCase(Node* slot, Node* vector,
                                         Node* receiver_map, Label* if_handler,
@@ -306,8 +316,9 @@ class AccessorAssembler : public CodeStubAssembler {
   // including stub cache header.
   enum StubCacheTable : int;
 
-  Node* StubCachePrimaryOffset(Node* name, Node* map);
-  Node* StubCacheSecondaryOffset(Node* name, Node* seed);
+  Node* StubCachePrimaryOffset(StubCache* stub_cache, Node* name, Node* map);
+  Node* StubCacheSecondaryOffset(StubCache* stub_cache, Node* name,
+                                 Node* seed);
 
   void TryProbeStubCacheTable(StubCache* stub_cache, StubCacheTable table_id,
                               Node* entry_offset, Node* name, Node* map,
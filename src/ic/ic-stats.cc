@@ -88,6 +88,36 @@ const char* ICStats::GetOrCacheFunctionName(JSFunction function) {
   return function_name;
 }
 
+FunctionICTransitions::Entry* FunctionICTransitions::Lookup(
+    SharedFunctionInfo shared) {
+  int script_id = shared->script()->IsScript()
+                      ? Script::cast(shared->script())->id()
+                      : v8::UnboundScript::kNoScriptId;
+  std::pair<int, int> key(script_id, shared->StartPosition());
+  auto it = index_.find(key);
+  if (it != index_.end()) return &entries_[it->second];
+  index_.insert(std::make_pair(key, entries_.size()));
+  entries_.push_back({shared->DebugName()->ToCString(), script_id,
+                      shared->StartPosition(), 0, 0, 0});
+  return &entries_.back();
+}
+
+void FunctionICTransitions::RecordMegamorphic(SharedFunctionInfo shared) {
+  Lookup(shared)->megamorphic_transitions++;
+}
+
+void FunctionICTransitions::RecordPolymorphic(SharedFunctionInfo shared,
+                                              size_t map_count) {
+  Entry* entry = Lookup(shared);
+  entry->polymorphic_transitions++;
+  entry->max_polymorphism = std::max(entry->max_polymorphism, map_count);
+}
+
+void FunctionICTransitions::Reset() {
+  entries_.clear();
+  index_.clear();
+}
+
 ICInfo::ICInfo()
     : function_name(nullptr),
       script_offset(0),
@@ -5,6 +5,7 @@
 #ifndef V8_IC_IC_STATS_H_
 #define V8_IC_IC_STATS_H_
 
+#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -24,6 +25,7 @@ namespace internal {
 
 class JSFunction;
 class Script;
+class SharedFunctionInfo;
 
 struct ICInfo {
   ICInfo();
@@ -73,6 +75,38 @@ class ICStats {
   int pos_;
 };
 
+// Per-isolate counts of the polymorphic and megamorphic IC transitions in each
+// function, see v8::Isolate::GetFunctionICStatistics(). Only IC misses that
+// change the feedback update it, which is cheap enough for
+// --function-ic-stats to be on by default.
+class FunctionICTransitions {
+ public:
+  struct Entry {
+    std::unique_ptr<char[]> function_name;
+    int script_id;
+    int start_position;
+    size_t megamorphic_transitions;
+    size_t polymorphic_transitions;
+    // The largest number of maps seen by a polymorphic IC in the function.
+    size_t max_polymorphism;
+  };
+
+  void RecordMegamorphic(SharedFunctionInfo shared);
+  void RecordPolymorphic(SharedFunctionInfo shared, size_t map_count);
+
+  size_t size() const { return entries_.size(); }
+  const Entry& Get(size_t index) const { return entries_[index]; }
+  void Reset();
+
+ private:
+  Entry* Lookup(SharedFunctionInfo shared);
+
+  std::vector<Entry> entries_;
+  // Keyed by script id and start position, which unlike the address of the
+  // SharedFunctionInfo survive GCs.
+  std::map<std::pair<int, int>, size_t> index_;
+};
+
 }  // namespace internal
 }  // namespace v8
 
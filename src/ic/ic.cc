@@ -382,6 +382,10 @@ bool IC::ConfigureVectorState(IC::State new_state, Handle<Object> key) {
   bool changed =
       nexus()->ConfigureMegamorphic(key->IsName() ? PROPERTY : ELEMENT);
   vector_set_ = true;
+  if (FLAG_function_ic_stats && changed) {
+    isolate()->function_ic_transitions()->RecordMegamorphic(
+        nexus()->vector()->shared_function_info());
+  }
   OnFeedbackChanged(isolate(), nexus(), GetHostFunction(), "Megamorphic");
   return changed;
 }
@@ -420,6 +424,10 @@ void IC::ConfigureVectorState(Handle<Name> name, MapHandles const& maps,
   nexus()->ConfigurePolymorphic(name, maps, handlers);
 
   vector_set_ = true;
+  if (FLAG_function_ic_stats) {
+    isolate()->function_ic_transitions()->RecordPolymorphic(
+        nexus()->vector()->shared_function_info(), maps.size());
+  }
   OnFeedbackChanged(isolate(), nexus(), GetHostFunction(), "Polymorphic");
 }
 
@@ -539,6 +547,30 @@ static bool AddOneReceiverMapIfMissing(MapHandles* receiver_maps,
   return true;
 }
 
+namespace {
+
+// Returns true if {handler} is a field load handler that is identical to all
+// the other handlers that stay in the polymorphic IC, i.e. all maps have the
+// property in the same field with the same representation.
+bool IsSharedFieldLoadHandler(const MapHandles& maps,
+                              const MaybeObjectHandles& handlers,
+                              int handler_to_overwrite,
+                              const MaybeObjectHandle& handler) {
+  MaybeObject const value = *handler;
+  if (!value.IsSmi()) return false;
+  if (LoadHandler::GetHandlerKind(value.ToSmi()) != LoadHandler::kField) {
+    return false;
+  }
+  for (size_t i = 0; i < handlers.size(); ++i) {
+    if (static_cast<int>(i) == handler_to_overwrite) continue;
+    if (maps[i]->is_deprecated()) continue;
+    if (*handlers[i] != value) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
 bool IC::UpdatePolymorphicIC(Handle<Name> name,
                              const MaybeObjectHandle& handler) {
   DCHECK(IsHandler(*handler));
@@ -583,7 +615,14 @@ bool IC::UpdatePolymorphicIC(Handle<Name> name,
   int number_of_valid_maps =
       number_of_maps - deprecated_maps - (handler_to_overwrite != -1);
 
-  if (number_of_valid_maps >= kMaxPolymorphicMapCount) return false;
+  if (number_of_valid_maps >= kMaxPolymorphicMapCount) {
+    if (!IsAnyLoad() ||
+        number_of_valid_maps >= kMaxPolymorphicFieldLoadMapCount ||
+        !IsSharedFieldLoadHandler(maps, handlers, handler_to_overwrite,
+                                  handler)) {
+      return false;
+    }
+  }
   if (number_of_maps == 0 && state() != MONOMORPHIC && state() != POLYMORPHIC) {
     return false;
   }
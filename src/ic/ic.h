@@ -35,6 +35,11 @@ class IC {
   // to megamorphic state.
   static constexpr int kMaxPolymorphicMapCount = 4;
 
+  // Load sites where all maps share the same field load handler can grow
+  // beyond kMaxPolymorphicMapCount, since a single map check and field load
+  // handles all of them.
+  static constexpr int kMaxPolymorphicFieldLoadMapCount = 8;
+
   // Construct the IC structure with the given number of extra
   // JavaScript frames on the stack.
   IC(Isolate* isolate, Handle<FeedbackVector> vector, FeedbackSlot slot,
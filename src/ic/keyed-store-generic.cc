@@ -496,12 +496,14 @@ void KeyedStoreGenericAssembler::StoreElementWithCapacity(
 void KeyedStoreGenericAssembler::EmitGenericElementStore(
     Node* receiver, Node* receiver_map, Node* instance_type, Node* intptr_index,
     Node* value, Node* context, Label* slow) {
-  Label if_fast(this), if_in_bounds(this), if_out_of_bounds(this),
-      if_increment_length_by_one(this), if_bump_length_with_gap(this),
-      if_grow(this), if_nonfast(this), if_typed_array(this),
-      if_dictionary(this);
   Node* elements = LoadElements(receiver);
-  Node* elements_kind = LoadMapElementsKind(receiver_map);
+  // The backing store to store into, which changes if it has to grow.
+  VARIABLE(var_elements, MachineRepresentation::kTagged, elements);
+  Label if_fast(this), if_in_bounds(this, &var_elements),
+      if_out_of_bounds(this), if_increment_length_by_one(this, &var_elements),
+      if_bump_length_with_gap(this, &var_elements), if_grow(this),
+      if_nonfast(this), if_typed_array(this), if_dictionary(this);
+  TNode<Int32T> elements_kind = LoadMapElementsKind(receiver_map);
   Branch(IsFastElementsKind(elements_kind), &if_fast, &if_nonfast);
   BIND(&if_fast);
 
@@ -524,8 +526,8 @@ void KeyedStoreGenericAssembler::EmitGenericElementStore(
 
   BIND(&if_in_bounds);
   {
-    StoreElementWithCapacity(receiver, receiver_map, elements, elements_kind,
-                             intptr_index, value, context, slow,
+    StoreElementWithCapacity(receiver, receiver_map, var_elements.value(),
+                             elements_kind, intptr_index, value, context, slow,
                              kDontChangeLength);
   }
 
@@ -541,15 +543,15 @@ void KeyedStoreGenericAssembler::EmitGenericElementStore(
 
   BIND(&if_increment_length_by_one);
   {
-    StoreElementWithCapacity(receiver, receiver_map, elements, elements_kind,
-                             intptr_index, value, context, slow,
+    StoreElementWithCapacity(receiver, receiver_map, var_elements.value(),
+                             elements_kind, intptr_index, value, context, slow,
                              kIncrementLengthByOne);
   }
 
   BIND(&if_bump_length_with_gap);
   {
-    StoreElementWithCapacity(receiver, receiver_map, elements, elements_kind,
-                             intptr_index, value, context, slow,
+    StoreElementWithCapacity(receiver, receiver_map, var_elements.value(),
+                             elements_kind, intptr_index, value, context, slow,
                              kBumpLengthWithGap);
   }
 
@@ -560,8 +562,43 @@ void KeyedStoreGenericAssembler::EmitGenericElementStore(
   BIND(&if_grow);
   {
     Comment("Grow backing store");
-    // TODO(jkummerow): Support inline backing store growth.
-    Goto(slow);
+    GotoIf(IntPtrLessThan(intptr_index, IntPtrConstant(0)), slow);
+    GotoIfNot(IsExtensibleMap(receiver_map), slow);
+    // Copy-on-write backing stores are copied by the runtime.
+    GotoIf(WordEqual(LoadMap(elements), LoadRoot(RootIndex::kFixedCOWArrayMap)),
+           slow);
+
+    // The new backing store keeps the ElementsKind of the {receiver_map},
+    // the stores below take care of any necessary transitions. Stores that
+    // would leave too big a gap go to the runtime, which switches to
+    // dictionary elements instead.
+    Node* capacity = SmiUntag(LoadFixedArrayBaseLength(elements));
+    Label if_grow_double(this), if_grow_tagged(this), if_grown(this);
+    Branch(IsDoubleElementsKind(elements_kind), &if_grow_double,
+           &if_grow_tagged);
+
+    BIND(&if_grow_double);
+    {
+      var_elements.Bind(TryGrowElementsCapacity(
+          receiver, elements, HOLEY_DOUBLE_ELEMENTS, intptr_index, capacity,
+          INTPTR_PARAMETERS, slow));
+      Goto(&if_grown);
+    }
+
+    BIND(&if_grow_tagged);
+    {
+      var_elements.Bind(TryGrowElementsCapacity(receiver, elements,
+                                                HOLEY_ELEMENTS, intptr_index,
+                                                capacity, INTPTR_PARAMETERS,
+                                                slow));
+      Goto(&if_grown);
+    }
+
+    BIND(&if_grown);
+    GotoIfNot(InstanceTypeEqual(instance_type, JS_ARRAY_TYPE), &if_in_bounds);
+    Node* length = SmiUntag(LoadFastJSArrayLength(receiver));
+    Branch(WordEqual(intptr_index, length), &if_increment_length_by_one,
+           &if_bump_length_with_gap);
   }
 
   // Any ElementsKind > LAST_FAST_ELEMENTS_KIND jumps here for further
@@ -581,8 +618,14 @@ void KeyedStoreGenericAssembler::EmitGenericElementStore(
   BIND(&if_dictionary);
   {
     Comment("Dictionary");
-    // TODO(jkummerow): Support storing to dictionary elements.
-    Goto(slow);
+    // Overwrite existing writable data elements. Adding new elements needs
+    // extensibility and prototype chain checks and may also make the
+    // elements fast again, so that is left to the runtime.
+    GotoIf(IntPtrLessThan(intptr_index, IntPtrConstant(0)), slow);
+    BasicStoreNumberDictionaryElement(CAST(elements),
+                                      UncheckedCast<IntPtrT>(intptr_index),
+                                      CAST(value), slow, slow, slow);
+    Return(value);
   }
 
   BIND(&if_typed_array);
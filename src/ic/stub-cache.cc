@@ -17,6 +17,12 @@ StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {
   // Ensure the nullptr (aka Smi::kZero) which StubCache::Get() returns
   // when the entry is not found is not considered as a handler.
   DCHECK(!IC::IsHandler(MaybeObject()));
+  Resize(kPrimaryTableBits, kSecondaryTableBits);
+}
+
+StubCache::~StubCache() {
+  DeleteArray(primary_);
+  DeleteArray(secondary_);
 }
 
 void StubCache::Initialize() {
@@ -25,6 +31,42 @@ void StubCache::Initialize() {
   Clear();
 }
 
+void StubCache::Resize(int primary_bits, int secondary_bits) {
+  DCHECK_LE(primary_bits, kMaxPrimaryTableBits);
+  DCHECK_LE(secondary_bits, kMaxSecondaryTableBits);
+  DeleteArray(primary_);
+  DeleteArray(secondary_);
+  primary_bits_ = primary_bits;
+  secondary_bits_ = secondary_bits;
+  primary_size_ = 1 << primary_bits;
+  secondary_size_ = 1 << secondary_bits;
+  primary_mask_ = (primary_size_ - 1) << kCacheIndexShift;
+  secondary_mask_ = (secondary_size_ - 1) << kCacheIndexShift;
+  primary_ = NewArray<Entry>(primary_size_);
+  secondary_ = NewArray<Entry>(secondary_size_);
+}
+
+void StubCache::MaybeGrow() {
+  // Every eviction drops a handler that was still reachable through the
+  // cache. Evicting more entries than the secondary table holds within one
+  // GC cycle means the working set of (map, name) pairs does not fit.
+  if (evictions_since_clear_ <= secondary_size_) return;
+  if (primary_bits_ >= kMaxPrimaryTableBits &&
+      secondary_bits_ >= kMaxSecondaryTableBits) {
+    return;
+  }
+  int primary_bits = Min(primary_bits_ + 1, kMaxPrimaryTableBits);
+  int secondary_bits = Min(secondary_bits_ + 1, kMaxSecondaryTableBits);
+  if (FLAG_trace_stub_cache) {
+    PrintIsolate(isolate_,
+                 "stub cache %p: %d evictions, growing to %d+%d entries\n",
+                 static_cast<void*>(this), evictions_since_clear_,
+                 1 << primary_bits, 1 << secondary_bits);
+  }
+  Resize(primary_bits, secondary_bits);
+  isolate_->counters()->megamorphic_stub_cache_resizes()->Increment();
+}
+
 // Hash algorithm for the primary table.  This algorithm is replicated in
 // assembler for every architecture.  Returns an index into the table that
 // is scaled by 1 << kCacheIndexShift.
@@ -39,7 +81,7 @@ int StubCache::PrimaryOffset(Name name, Map map) {
   uint32_t map_low32bits = static_cast<uint32_t>(map.ptr());
   // Base the offset on a simple combination of name and map.
   uint32_t key = map_low32bits + field;
-  return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+  return key & primary_mask_;
 }
 
 // Hash algorithm for the secondary table.  This algorithm is replicated in
@@ -49,7 +91,7 @@ int StubCache::SecondaryOffset(Name name, int seed) {
   // Use the seed from the primary cache in the secondary cache.
   uint32_t name_low32bits = static_cast<uint32_t>(name.ptr());
   uint32_t key = (seed - name_low32bits) + kSecondaryMagic;
-  return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+  return key & secondary_mask_;
 }
 
 int StubCache::PrimaryOffsetForTesting(Name name, Map map) {
@@ -96,6 +138,13 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
     int secondary_offset =
         SecondaryOffset(Name::cast(ObjectPtr(primary->key)), seed);
     Entry* secondary = entry(secondary_, secondary_offset);
+    if (secondary->map != kNullAddress &&
+        MaybeObject(secondary->value) !=
+            MaybeObject::FromObject(
+                isolate_->builtins()->builtin(Builtins::kIllegal))) {
+      evictions_since_clear_++;
+      isolate()->counters()->megamorphic_stub_cache_evictions()->Increment();
+    }
     *secondary = *primary;
   }
 
@@ -122,15 +171,17 @@ MaybeObject StubCache::Get(Name name, Map map) {
 }
 
 void StubCache::Clear() {
+  if (FLAG_stub_cache_adaptive_size) MaybeGrow();
+  evictions_since_clear_ = 0;
   MaybeObject empty = MaybeObject::FromObject(
       isolate_->builtins()->builtin(Builtins::kIllegal));
   Name empty_string = ReadOnlyRoots(isolate()).empty_string();
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_size_; i++) {
     primary_[i].key = empty_string.ptr();
     primary_[i].map = kNullAddress;
     primary_[i].value = empty.ptr();
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < secondary_size_; j++) {
     secondary_[j].key = empty_string.ptr();
     secondary_[j].map = kNullAddress;
     secondary_[j].value = empty.ptr();
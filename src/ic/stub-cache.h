@@ -47,32 +47,41 @@ class StubCache {
   // Access cache for entry hash(name, map).
   void Set(Name name, Map map, MaybeObject handler);
   MaybeObject Get(Name name, Map map);
-  // Clear the lookup table (@ mark compact collection).
+  // Clear the lookup table (@ mark compact collection). With
+  // --stub-cache-adaptive-size, this is also where the tables grow if the
+  // previous GC cycle evicted too many entries.
   void Clear();
 
   enum Table { kPrimary, kSecondary };
 
-  SCTableReference key_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->key));
-  }
-
-  SCTableReference map_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->map));
+  // Generated code loads the current table and mask through these references,
+  // since both change when the cache grows.
+  SCTableReference table_reference(StubCache::Table table) {
+    switch (table) {
+      case StubCache::kPrimary:
+        return SCTableReference(reinterpret_cast<Address>(&primary_));
+      case StubCache::kSecondary:
+        return SCTableReference(reinterpret_cast<Address>(&secondary_));
+    }
+    UNREACHABLE();
   }
 
-  SCTableReference value_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->value));
+  SCTableReference mask_reference(StubCache::Table table) {
+    switch (table) {
+      case StubCache::kPrimary:
+        return SCTableReference(reinterpret_cast<Address>(&primary_mask_));
+      case StubCache::kSecondary:
+        return SCTableReference(reinterpret_cast<Address>(&secondary_mask_));
+    }
+    UNREACHABLE();
   }
 
-  StubCache::Entry* first_entry(StubCache::Table table) {
+  int table_size(StubCache::Table table) const {
     switch (table) {
       case StubCache::kPrimary:
-        return StubCache::primary_;
+        return primary_size_;
       case StubCache::kSecondary:
-        return StubCache::secondary_;
+        return secondary_size_;
     }
     UNREACHABLE();
   }
@@ -84,19 +93,28 @@ class StubCache {
   // automatically discards the hash bit field.
   static const int kCacheIndexShift = Name::kHashShift;
 
+  // Initial table sizes.
   static const int kPrimaryTableBits = 11;
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
   static const int kSecondaryTableBits = 9;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
 
+  // Upper bounds for adaptive growth.
+  static const int kMaxPrimaryTableBits = 14;
+  static const int kMaxSecondaryTableBits = 12;
+
   // Some magic number used in the secondary hash computation.
   static const int kSecondaryMagic = 0xb16ca6e5;
 
-  static int PrimaryOffsetForTesting(Name name, Map map);
-  static int SecondaryOffsetForTesting(Name name, int seed);
+  int PrimaryOffsetForTesting(Name name, Map map);
+  int SecondaryOffsetForTesting(Name name, int seed);
+
+  // Number of live secondary entries overwritten since the last Clear().
+  int evictions_since_clear() const { return evictions_since_clear_; }
 
   // The constructor is made public only for the purposes of testing.
   explicit StubCache(Isolate* isolate);
+  ~StubCache();
 
  private:
   // The stub cache has a primary and secondary level.  The two levels have
@@ -109,12 +127,12 @@ class StubCache {
   // Hash algorithm for the primary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int PrimaryOffset(Name name, Map map);
+  int PrimaryOffset(Name name, Map map);
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int SecondaryOffset(Name name, int seed);
+  int SecondaryOffset(Name name, int seed);
 
   // Compute the entry for a given offset in exactly the same way as
   // we do in generated code.  We generate an hash code that already
@@ -127,9 +145,22 @@ class StubCache {
                                     offset * multiplier);
   }
 
+  // Reallocates both tables with the given sizes. Leaves the entries
+  // uninitialized; callers must Clear() afterwards.
+  void Resize(int primary_bits, int secondary_bits);
+  // Grows the tables if the last cycle saw too many evictions.
+  void MaybeGrow();
+
  private:
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  Entry* primary_ = nullptr;
+  Entry* secondary_ = nullptr;
+  uint32_t primary_mask_ = 0;
+  uint32_t secondary_mask_ = 0;
+  int primary_bits_ = 0;
+  int secondary_bits_ = 0;
+  int primary_size_ = 0;
+  int secondary_size_ = 0;
+  int evictions_since_clear_ = 0;
   Isolate* isolate_;
 
   friend class Isolate;
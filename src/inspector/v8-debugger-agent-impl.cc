@@ -50,6 +50,7 @@ static const char breakpointHints[] = "breakpointHints";
 }  // namespace DebuggerAgentState
 
 static const char kBacktraceObjectGroup[] = "backtrace";
+static const char kTracepointObjectGroup[] = "tracepoint";
 static const char kDebuggerNotEnabled[] = "Debugger agent is not enabled";
 static const char kDebuggerNotPaused[] =
     "Can only perform operation while paused.";
@@ -58,6 +59,7 @@ static const size_t kBreakpointHintMaxLength = 128;
 static const intptr_t kBreakpointHintMaxSearchOffset = 80 * 10;
 
 static const int kMaxScriptFailedToParseScripts = 1000;
+static const size_t kMaxTracepointRecords = 1000;
 
 namespace {
 
@@ -81,7 +83,8 @@ enum class BreakpointType {
   kByScriptId,
   kDebugCommand,
   kMonitorCommand,
-  kBreakpointAtEntry
+  kBreakpointAtEntry,
+  kTracepoint
 };
 
 String16 generateBreakpointId(BreakpointType type,
@@ -115,7 +118,7 @@ bool parseBreakpointId(const String16& breakpointId, BreakpointType* type,
 
   int rawType = breakpointId.substring(0, typeLineSeparator).toInteger();
   if (rawType < static_cast<int>(BreakpointType::kByUrl) ||
-      rawType > static_cast<int>(BreakpointType::kBreakpointAtEntry)) {
+      rawType > static_cast<int>(BreakpointType::kTracepoint)) {
     return false;
   }
   if (type) *type = static_cast<BreakpointType>(rawType);
@@ -375,6 +378,10 @@ Response V8DebuggerAgentImpl::disable() {
   }
   m_breakpointIdToDebuggerBreakpointIds.clear();
   m_debuggerBreakpointIdToBreakpointId.clear();
+  m_tracepointVariables.clear();
+  m_tracepointRecords.clear();
+  m_droppedTracepointRecords = 0;
+  m_session->releaseObjectGroup(kTracepointObjectGroup);
   m_debugger->setAsyncCallStackDepth(this, 0);
   clearBreakDetails();
   m_skipAllPauses = false;
@@ -555,6 +562,137 @@ Response V8DebuggerAgentImpl::setBreakpoint(
   return Response::OK();
 }
 
+Response V8DebuggerAgentImpl::setTracepoint(
+    std::unique_ptr<protocol::Debugger::Location> location,
+    std::unique_ptr<protocol::Array<String16>> variables,
+    String16* outBreakpointId,
+    std::unique_ptr<protocol::Debugger::Location>* actualLocation) {
+  if (!enabled()) return Response::Error(kDebuggerNotEnabled);
+  String16 breakpointId = generateBreakpointId(
+      BreakpointType::kTracepoint, location->getScriptId(),
+      location->getLineNumber(), location->getColumnNumber(0));
+  if (m_breakpointIdToDebuggerBreakpointIds.find(breakpointId) !=
+      m_breakpointIdToDebuggerBreakpointIds.end()) {
+    return Response::Error("Tracepoint at specified location already exists.");
+  }
+  *actualLocation = setBreakpointImpl(breakpointId, location->getScriptId(),
+                                      String16(), location->getLineNumber(),
+                                      location->getColumnNumber(0));
+  if (!*actualLocation) return Response::Error("Could not resolve tracepoint");
+  std::vector<String16>& names = m_tracepointVariables[breakpointId];
+  for (size_t i = 0; i < variables->length(); ++i) {
+    names.push_back(variables->get(i));
+  }
+  *outBreakpointId = breakpointId;
+  return Response::OK();
+}
+
+Response V8DebuggerAgentImpl::takeTracepointRecords(
+    std::unique_ptr<Array<protocol::Debugger::TracepointRecord>>* records,
+    int* droppedRecords) {
+  if (!enabled()) return Response::Error(kDebuggerNotEnabled);
+  *records = Array<protocol::Debugger::TracepointRecord>::create();
+  for (auto& record : m_tracepointRecords) {
+    (*records)->addItem(std::move(record));
+  }
+  m_tracepointRecords.clear();
+  *droppedRecords = m_droppedTracepointRecords;
+  m_droppedTracepointRecords = 0;
+  return Response::OK();
+}
+
+bool V8DebuggerAgentImpl::recordTracepoint(
+    v8::Local<v8::Context> context,
+    v8::debug::BreakpointId debuggerBreakpointId) {
+  auto breakpointIterator =
+      m_debuggerBreakpointIdToBreakpointId.find(debuggerBreakpointId);
+  if (breakpointIterator == m_debuggerBreakpointIdToBreakpointId.end()) {
+    return false;
+  }
+  auto tracepointIterator =
+      m_tracepointVariables.find(breakpointIterator->second);
+  if (tracepointIterator == m_tracepointVariables.end()) return false;
+  const std::vector<String16>& variables = tracepointIterator->second;
+
+  v8::HandleScope handles(m_isolate);
+  InjectedScript* injectedScript = nullptr;
+  Response response = m_session->findInjectedScript(
+      InspectedContext::contextId(context), injectedScript);
+  if (!response.isSuccess()) return true;
+
+  // Read the variables straight from the scope objects of the top frame
+  // instead of evaluating code. Global and with scopes are skipped since
+  // looking up a name on them may run accessors.
+  std::vector<v8::Local<v8::Value>> values(variables.size());
+  std::unique_ptr<v8::debug::StackTraceIterator> iterator =
+      v8::debug::StackTraceIterator::Create(m_isolate);
+  if (!iterator->Done()) {
+    for (auto scopes = iterator->GetScopeIterator(); !scopes->Done();
+         scopes->Advance()) {
+      v8::debug::ScopeIterator::ScopeType type = scopes->GetType();
+      if (type == v8::debug::ScopeIterator::ScopeTypeGlobal ||
+          type == v8::debug::ScopeIterator::ScopeTypeWith) {
+        continue;
+      }
+      v8::Local<v8::Object> object = scopes->GetObject();
+      for (size_t i = 0; i < variables.size(); ++i) {
+        if (!values[i].IsEmpty()) continue;
+        v8::Local<v8::String> name = toV8String(m_isolate, variables[i]);
+        if (!object->HasRealNamedProperty(context, name).FromMaybe(false)) {
+          continue;
+        }
+        object->GetRealNamedProperty(context, name).ToLocal(&values[i]);
+      }
+    }
+  }
+
+  std::unique_ptr<Array<RemoteObject>> remoteValues =
+      Array<RemoteObject>::create();
+  for (v8::Local<v8::Value> value : values) {
+    if (value.IsEmpty()) value = v8::Undefined(m_isolate);
+    std::unique_ptr<RemoteObject> remoteValue;
+    response = injectedScript->wrapObject(value, kTracepointObjectGroup,
+                                          WrapMode::kNoPreview, &remoteValue);
+    if (!response.isSuccess()) {
+      remoteValue = RemoteObject::create()
+                        .setType(RemoteObject::TypeEnum::Undefined)
+                        .build();
+    }
+    remoteValues->addItem(std::move(remoteValue));
+  }
+
+  if (m_tracepointRecords.size() == kMaxTracepointRecords) {
+    releaseTracepointRecord(m_tracepointRecords.front().get());
+    m_tracepointRecords.pop_front();
+    ++m_droppedTracepointRecords;
+  }
+  m_tracepointRecords.push_back(
+      protocol::Debugger::TracepointRecord::create()
+          .setBreakpointId(breakpointIterator->second)
+          .setTimestamp(m_inspector->client()->currentTimeMS())
+          .setValues(std::move(remoteValues))
+          .build());
+  return true;
+}
+
+void V8DebuggerAgentImpl::releaseTracepointRecord(
+    protocol::Debugger::TracepointRecord* record) {
+  Array<RemoteObject>* values = record->getValues();
+  for (size_t i = 0; i < values->length(); ++i) {
+    RemoteObject* value = values->get(i);
+    if (!value->hasObjectId()) continue;
+    String16 objectId = value->getObjectId("");
+    std::unique_ptr<RemoteObjectId> remoteId;
+    InjectedScript* injectedScript = nullptr;
+    if (!RemoteObjectId::parse(objectId, &remoteId).isSuccess()) continue;
+    if (!m_session->findInjectedScript(remoteId.get(), injectedScript)
+             .isSuccess()) {
+      continue;
+    }
+    injectedScript->releaseObject(objectId);
+  }
+}
+
 Response V8DebuggerAgentImpl::setBreakpointOnFunctionCall(
     const String16& functionObjectId, Maybe<String16> optionalCondition,
     String16* outBreakpointId) {
@@ -630,6 +768,7 @@ void V8DebuggerAgentImpl::removeBreakpointImpl(const String16& breakpointId) {
     m_debuggerBreakpointIdToBreakpointId.erase(id);
   }
   m_breakpointIdToDebuggerBreakpointIds.erase(breakpointId);
+  m_tracepointVariables.erase(breakpointId);
 }
 
 Response V8DebuggerAgentImpl::getPossibleBreakpoints(
@@ -59,6 +59,14 @@ class V8DebuggerAgentImpl : public protocol::Debugger::Backend {
   Response setBreakpointOnFunctionCall(const String16& functionObjectId,
                                        Maybe<String16> optionalCondition,
                                        String16* outBreakpointId) override;
+  Response setTracepoint(
+      std::unique_ptr<protocol::Debugger::Location>,
+      std::unique_ptr<protocol::Array<String16>> variables, String16*,
+      std::unique_ptr<protocol::Debugger::Location>* actualLocation) override;
+  Response takeTracepointRecords(
+      std::unique_ptr<protocol::Array<protocol::Debugger::TracepointRecord>>*
+          records,
+      int* droppedRecords) override;
   Response removeBreakpoint(const String16& breakpointId) override;
   Response continueToLocation(std::unique_ptr<protocol::Debugger::Location>,
                               Maybe<String16> targetCallFrames) override;
@@ -151,6 +159,11 @@ class V8DebuggerAgentImpl : public protocol::Debugger::Backend {
 
   bool acceptsPause(bool isOOMBreak) const;
 
+  // Records the values for a hit of |debuggerBreakpointId| if it belongs to
+  // a tracepoint of this agent. Returns false for any other breakpoint.
+  bool recordTracepoint(v8::Local<v8::Context> context,
+                        v8::debug::BreakpointId debuggerBreakpointId);
+
   v8::Isolate* isolate() { return m_isolate; }
 
  private:
@@ -171,6 +184,7 @@ class V8DebuggerAgentImpl : public protocol::Debugger::Backend {
                          v8::Local<v8::Function> function,
                          v8::Local<v8::String> condition);
   void removeBreakpointImpl(const String16& breakpointId);
+  void releaseTracepointRecord(protocol::Debugger::TracepointRecord* record);
   void clearBreakDetails();
 
   void internalSetAsyncCallStackDepth(int);
@@ -199,6 +213,12 @@ class V8DebuggerAgentImpl : public protocol::Debugger::Backend {
   BreakpointIdToDebuggerBreakpointIdsMap m_breakpointIdToDebuggerBreakpointIds;
   DebuggerBreakpointIdToBreakpointIdMap m_debuggerBreakpointIdToBreakpointId;
 
+  // Tracepoint id -> names of the variables recorded on each hit.
+  std::unordered_map<String16, std::vector<String16>> m_tracepointVariables;
+  std::deque<std::unique_ptr<protocol::Debugger::TracepointRecord>>
+      m_tracepointRecords;
+  int m_droppedTracepointRecords = 0;
+
   std::deque<String16> m_failedToParseAnonymousScriptIds;
   void cleanupOldFailedToParseAnonymousScriptsIfNeeded();
 
@@ -382,6 +382,31 @@ void V8Debugger::handleProgramBreak(
     v8::debug::PrepareStep(m_isolate, v8::debug::StepOut);
     return;
   }
+
+  // Tracepoints only record values and never pause on their own. Continue
+  // right away unless a step or an explicit pause is pending as well.
+  if (!breakpointIds.empty() && exception.IsEmpty()) {
+    bool onlyTracepoints = true;
+    for (v8::debug::BreakpointId id : breakpointIds) {
+      bool isTracepoint = false;
+      m_inspector->forEachSession(
+          contextGroupId, [&pausedContext, &id,
+                           &isTracepoint](V8InspectorSessionImpl* session) {
+            if (session->debuggerAgent()->enabled() &&
+                session->debuggerAgent()->recordTracepoint(pausedContext,
+                                                           id)) {
+              isTracepoint = true;
+            }
+          });
+      onlyTracepoints = onlyTracepoints && isTracepoint;
+    }
+    if (onlyTracepoints && !m_targetContextGroupId && !m_breakRequested &&
+        !m_pauseOnAsyncCall && !m_scheduledOOMBreak &&
+        !m_scheduledAssertBreak) {
+      return;
+    }
+  }
+
   m_targetContextGroupId = 0;
   m_breakRequested = false;
   m_pauseOnAsyncCall = false;
@@ -663,7 +663,12 @@ struct EntryMirror {
                          bool* overflow, std::vector<EntryMirror>* mirrors) {
     bool isKeyValue = false;
     v8::Local<v8::Array> entries;
-    if (!object->PreviewEntries(&isKeyValue).ToLocal(&entries)) return false;
+    // Collect one entry more than requested to detect overflow.
+    if (!v8::debug::PreviewEntries(object, static_cast<int>(limit) + 1,
+                                   &isKeyValue)
+             .ToLocal(&entries)) {
+      return false;
+    }
     for (uint32_t i = 0; i < entries->Length(); i += isKeyValue ? 2 : 1) {
       v8::Local<v8::Value> tmp;
 
@@ -761,7 +766,7 @@ bool getPropertiesForPreview(v8::Local<v8::Context> context,
                       : -1;
   PreviewPropertyAccumulator accumulator(blacklist, skipIndex, nameLimit,
                                          indexLimit, overflow, properties);
-  return ValueMirror::getProperties(context, object, false, false,
+  return ValueMirror::getProperties(context, object, false, false, false,
                                     &accumulator);
 }
 
@@ -1130,6 +1135,7 @@ ValueMirror::~ValueMirror() = default;
 bool ValueMirror::getProperties(v8::Local<v8::Context> context,
                                 v8::Local<v8::Object> object,
                                 bool ownProperties, bool accessorPropertiesOnly,
+                                bool nonIndexedPropertiesOnly,
                                 PropertyAccumulator* accumulator) {
   v8::Isolate* isolate = context->GetIsolate();
   v8::TryCatch tryCatch(isolate);
@@ -1165,10 +1171,12 @@ bool ValueMirror::getProperties(v8::Local<v8::Context> context,
                        accumulator);
   }
 
-  for (auto iterator = v8::debug::PropertyIterator::Create(object);
+  for (auto iterator = v8::debug::PropertyIterator::Create(
+           object, nonIndexedPropertiesOnly);
        !iterator->Done(); iterator->Advance()) {
     bool isOwn = iterator->is_own();
     if (!isOwn && ownProperties) break;
+    if (nonIndexedPropertiesOnly && iterator->is_array_index()) continue;
     v8::Local<v8::Name> v8Name = iterator->name();
     v8::Maybe<bool> result = set->Has(context, v8Name);
     if (result.IsNothing()) return false;
@@ -90,6 +90,9 @@ class V8_EXPORT_PRIVATE BytecodeArrayAccessor {
   uint32_t GetRegisterCountOperand(int operand_index) const;
   Register GetRegisterOperand(int operand_index) const;
   int GetRegisterOperandRange(int operand_index) const;
+  // Returns the register written by the current Star or one-byte Star
+  // bytecode.
+  Register GetStarTargetRegister() const;
   Runtime::FunctionId GetRuntimeIdOperand(int operand_index) const;
   Runtime::FunctionId GetIntrinsicIdOperand(int operand_index) const;
   uint32_t GetNativeContextIndexOperand(int operand_index) const;
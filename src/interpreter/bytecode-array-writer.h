@@ -96,6 +96,7 @@ class V8_EXPORT_PRIVATE BytecodeArrayWriter final {
   size_t last_bytecode_offset_;
   bool last_bytecode_had_source_info_;
   bool elide_noneffectful_bytecodes_;
+  bool emit_short_star_bytecodes_;
 
   bool exit_seen_in_block_;
 
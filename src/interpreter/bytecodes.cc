@@ -274,14 +274,30 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       case Bytecode::kLdaKeyedProperty:
       case Bytecode::kLdaContextSlot:
       case Bytecode::kLdaCurrentContextSlot:
+      case Bytecode::kLdaImmutableContextSlot:
+      case Bytecode::kLdaImmutableCurrentContextSlot:
+      case Bytecode::kLdaModuleVariable:
       case Bytecode::kAdd:
       case Bytecode::kSub:
       case Bytecode::kMul:
+      case Bytecode::kDiv:
+      case Bytecode::kMod:
+      case Bytecode::kBitwiseOr:
+      case Bytecode::kBitwiseXor:
+      case Bytecode::kBitwiseAnd:
+      case Bytecode::kShiftLeft:
+      case Bytecode::kShiftRight:
+      case Bytecode::kShiftRightLogical:
       case Bytecode::kAddSmi:
       case Bytecode::kSubSmi:
+      case Bytecode::kMulSmi:
+      case Bytecode::kBitwiseOrSmi:
+      case Bytecode::kBitwiseAndSmi:
+      case Bytecode::kShiftRightLogicalSmi:
       case Bytecode::kInc:
       case Bytecode::kDec:
       case Bytecode::kTypeOf:
+      case Bytecode::kToNumeric:
       case Bytecode::kCallAnyReceiver:
       case Bytecode::kCallNoFeedback:
       case Bytecode::kCallProperty:
@@ -292,8 +308,40 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       case Bytecode::kCallUndefinedReceiver0:
       case Bytecode::kCallUndefinedReceiver1:
       case Bytecode::kCallUndefinedReceiver2:
+      case Bytecode::kCallRuntime:
       case Bytecode::kConstruct:
       case Bytecode::kConstructWithSpread:
+      case Bytecode::kCreateClosure:
+      case Bytecode::kCreateArrayLiteral:
+      case Bytecode::kCreateEmptyArrayLiteral:
+      case Bytecode::kCreateObjectLiteral:
+      case Bytecode::kCreateEmptyObjectLiteral:
+        return true;
+      default:
+        return false;
+    }
+  }
+  return false;
+}
+
+// static
+bool Bytecodes::IsJumpIfBooleanLookahead(Bytecode bytecode,
+                                         OperandScale operand_scale) {
+  if (operand_scale == OperandScale::kSingle) {
+    switch (bytecode) {
+      case Bytecode::kTestEqual:
+      case Bytecode::kTestEqualStrict:
+      case Bytecode::kTestLessThan:
+      case Bytecode::kTestGreaterThan:
+      case Bytecode::kTestLessThanOrEqual:
+      case Bytecode::kTestGreaterThanOrEqual:
+      case Bytecode::kTestReferenceEqual:
+      case Bytecode::kTestInstanceOf:
+      case Bytecode::kTestIn:
+      case Bytecode::kTestUndetectable:
+      case Bytecode::kTestNull:
+      case Bytecode::kTestUndefined:
+      case Bytecode::kTestTypeOf:
         return true;
       default:
         return false;
@@ -21,6 +21,27 @@ namespace v8 {
 namespace internal {
 namespace interpreter {
 
+// The list of one-byte Star bytecodes, which store the accumulator to one of
+// the first registers of the register file without a register operand.
+// Only emitted with --ignition-short-star.
+#define SHORT_STAR_BYTECODE_LIST(V)                                            \
+  V(Star0, AccumulatorUse::kRead)                                              \
+  V(Star1, AccumulatorUse::kRead)                                              \
+  V(Star2, AccumulatorUse::kRead)                                              \
+  V(Star3, AccumulatorUse::kRead)                                              \
+  V(Star4, AccumulatorUse::kRead)                                              \
+  V(Star5, AccumulatorUse::kRead)                                              \
+  V(Star6, AccumulatorUse::kRead)                                              \
+  V(Star7, AccumulatorUse::kRead)                                              \
+  V(Star8, AccumulatorUse::kRead)                                              \
+  V(Star9, AccumulatorUse::kRead)                                              \
+  V(Star10, AccumulatorUse::kRead)                                             \
+  V(Star11, AccumulatorUse::kRead)                                             \
+  V(Star12, AccumulatorUse::kRead)                                             \
+  V(Star13, AccumulatorUse::kRead)                                             \
+  V(Star14, AccumulatorUse::kRead)                                             \
+  V(Star15, AccumulatorUse::kRead)
+
 // The list of bytecodes which are interpreted by the interpreter.
 // Format is V(<bytecode>, <accumulator_use>, <operands>).
 #define BYTECODE_LIST(V)                                                       \
@@ -91,6 +112,7 @@ namespace interpreter {
   /* Register-accumulator transfers */                                         \
   V(Ldar, AccumulatorUse::kWrite, OperandType::kReg)                           \
   V(Star, AccumulatorUse::kRead, OperandType::kRegOut)                         \
+  SHORT_STAR_BYTECODE_LIST(V)                                                  \
                                                                                \
   /* Register-register transfers */                                            \
   V(Mov, AccumulatorUse::kNone, OperandType::kReg, OperandType::kRegOut)       \
@@ -472,6 +494,10 @@ class V8_EXPORT_PRIVATE Bytecodes final : public AllStatic {
   // The total number of bytecodes used.
   static const int kBytecodeCount = static_cast<int>(Bytecode::kLast) + 1;
 
+  // The number of one-byte Star bytecodes, i.e. Star0 .. Star15.
+  static const int kShortStarCount = static_cast<int>(Bytecode::kStar15) -
+                                     static_cast<int>(Bytecode::kStar0) + 1;
+
   // Returns string representation of |bytecode|.
   static const char* ToString(Bytecode bytecode);
 
@@ -570,7 +596,8 @@ class V8_EXPORT_PRIVATE Bytecodes final : public AllStatic {
   // e.g. Mov, Star.
   static constexpr bool IsRegisterLoadWithoutEffects(Bytecode bytecode) {
     return bytecode == Bytecode::kMov || bytecode == Bytecode::kPopContext ||
-           bytecode == Bytecode::kPushContext || bytecode == Bytecode::kStar;
+           bytecode == Bytecode::kPushContext || bytecode == Bytecode::kStar ||
+           IsShortStar(bytecode);
   }
 
   // Returns true if the bytecode is a conditional jump taking
@@ -657,9 +684,15 @@ class V8_EXPORT_PRIVATE Bytecodes final : public AllStatic {
             IsJumpWithoutEffects(bytecode) || IsSwitch(bytecode));
   }
 
+  // Returns true if the bytecode is one of the one-byte Star bytecodes.
+  static constexpr bool IsShortStar(Bytecode bytecode) {
+    return bytecode >= Bytecode::kStar0 && bytecode <= Bytecode::kStar15;
+  }
+
   // Returns true if the bytecode is Ldar or Star.
   static constexpr bool IsLdarOrStar(Bytecode bytecode) {
-    return bytecode == Bytecode::kLdar || bytecode == Bytecode::kStar;
+    return bytecode == Bytecode::kLdar || bytecode == Bytecode::kStar ||
+           IsShortStar(bytecode);
   }
 
   // Returns true if the bytecode is a call or a constructor call.
@@ -844,6 +877,11 @@ class V8_EXPORT_PRIVATE Bytecodes final : public AllStatic {
   // dispatch to a Star bytecode.
   static bool IsStarLookahead(Bytecode bytecode, OperandScale operand_scale);
 
+  // Returns true if the handler for |bytecode| should look ahead and inline a
+  // dispatch to a JumpIfTrue or JumpIfFalse bytecode.
+  static bool IsJumpIfBooleanLookahead(Bytecode bytecode,
+                                       OperandScale operand_scale);
+
   // Returns the number of registers represented by a register operand. For
   // instance, a RegPair represents two registers. Should not be called for
   // kRegList which has a variable number of registers based on the following
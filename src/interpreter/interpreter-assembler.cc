@@ -1321,6 +1321,7 @@ Node* InterpreterAssembler::Advance(Node* delta, bool backward) {
 
 Node* InterpreterAssembler::Jump(Node* delta, bool backward) {
   DCHECK(!Bytecodes::IsStarLookahead(bytecode_, operand_scale_));
+  DCHECK(!Bytecodes::IsJumpIfBooleanLookahead(bytecode_, operand_scale_));
 
   UpdateInterruptBudget(TruncateIntPtrToInt32(delta), backward);
   Node* new_bytecode_offset = Advance(delta, backward);
@@ -1360,14 +1361,22 @@ Node* InterpreterAssembler::LoadBytecode(Node* bytecode_offset) {
 }
 
 Node* InterpreterAssembler::StarDispatchLookahead(Node* target_bytecode) {
-  Label do_inline_star(this), done(this);
+  Label do_inline_star(this), do_inline_short_star(this), done(this);
 
   Variable var_bytecode(this, MachineType::PointerRepresentation());
   var_bytecode.Bind(target_bytecode);
 
   Node* star_bytecode = IntPtrConstant(static_cast<int>(Bytecode::kStar));
   Node* is_star = WordEqual(target_bytecode, star_bytecode);
-  Branch(is_star, &do_inline_star, &done);
+  GotoIf(is_star, &do_inline_star);
+
+  // The one-byte Star bytecodes are contiguous, so a single unsigned
+  // comparison checks for all of them.
+  Node* short_star_index = IntPtrSub(
+      target_bytecode, IntPtrConstant(static_cast<int>(Bytecode::kStar0)));
+  Node* is_short_star = UintPtrLessThan(
+      short_star_index, IntPtrConstant(Bytecodes::kShortStarCount));
+  Branch(is_short_star, &do_inline_short_star, &done);
 
   BIND(&do_inline_star);
   {
@@ -1375,6 +1384,13 @@ Node* InterpreterAssembler::StarDispatchLookahead(Node* target_bytecode) {
     var_bytecode.Bind(LoadBytecode(BytecodeOffset()));
     Goto(&done);
   }
+
+  BIND(&do_inline_short_star);
+  {
+    InlineShortStar(short_star_index);
+    var_bytecode.Bind(LoadBytecode(BytecodeOffset()));
+    Goto(&done);
+  }
   BIND(&done);
   return var_bytecode.value();
 }
@@ -1399,6 +1415,101 @@ void InterpreterAssembler::InlineStar() {
   accumulator_use_ = previous_acc_use;
 }
 
+void InterpreterAssembler::InlineShortStar(Node* short_star_index) {
+  Bytecode previous_bytecode = bytecode_;
+  AccumulatorUse previous_acc_use = accumulator_use_;
+
+  // All one-byte Star bytecodes have the same size and accumulator use, so
+  // Star0 stands in for whichever one is actually being inlined.
+  bytecode_ = Bytecode::kStar0;
+  accumulator_use_ = AccumulatorUse::kNone;
+
+#ifdef V8_TRACE_IGNITION
+  TraceBytecode(Runtime::kInterpreterTraceBytecodeEntry);
+#endif
+  // Register operands grow downwards from the first register's operand.
+  Node* reg_index =
+      IntPtrSub(IntPtrConstant(Register(0).ToOperand()), short_star_index);
+  StoreRegister(GetAccumulator(), reg_index);
+
+  DCHECK_EQ(accumulator_use_, Bytecodes::GetAccumulatorUse(bytecode_));
+
+  Advance();
+  bytecode_ = previous_bytecode;
+  accumulator_use_ = previous_acc_use;
+}
+
+Node* InterpreterAssembler::JumpIfBooleanDispatchLookahead(
+    Node* target_bytecode) {
+  Label do_inline_jump_if_true(this), do_inline_jump_if_false(this),
+      done(this);
+
+  Variable var_bytecode(this, MachineType::PointerRepresentation());
+  var_bytecode.Bind(target_bytecode);
+
+  GotoIf(WordEqual(target_bytecode,
+                   IntPtrConstant(static_cast<int>(Bytecode::kJumpIfTrue))),
+         &do_inline_jump_if_true);
+  Branch(WordEqual(target_bytecode,
+                   IntPtrConstant(static_cast<int>(Bytecode::kJumpIfFalse))),
+         &do_inline_jump_if_false, &done);
+
+  BIND(&do_inline_jump_if_true);
+  {
+    InlineJumpIfBoolean(Bytecode::kJumpIfTrue, TrueConstant());
+    var_bytecode.Bind(LoadBytecode(BytecodeOffset()));
+    Goto(&done);
+  }
+
+  BIND(&do_inline_jump_if_false);
+  {
+    InlineJumpIfBoolean(Bytecode::kJumpIfFalse, FalseConstant());
+    var_bytecode.Bind(LoadBytecode(BytecodeOffset()));
+    Goto(&done);
+  }
+  BIND(&done);
+  return var_bytecode.value();
+}
+
+void InterpreterAssembler::InlineJumpIfBoolean(Bytecode jump_bytecode,
+                                               Node* jump_value) {
+  Bytecode previous_bytecode = bytecode_;
+  AccumulatorUse previous_acc_use = accumulator_use_;
+
+  bytecode_ = jump_bytecode;
+  accumulator_use_ = AccumulatorUse::kNone;
+
+#ifdef V8_TRACE_IGNITION
+  TraceBytecode(Runtime::kInterpreterTraceBytecodeEntry);
+#endif
+  Node* accumulator = GetAccumulator();
+  Node* relative_jump = BytecodeOperandUImmWord(0);
+  CSA_ASSERT(this, TaggedIsNotSmi(accumulator));
+  CSA_ASSERT(this, IsBoolean(accumulator));
+
+  Label if_jump(this), if_fallthrough(this), done(this);
+  Branch(WordEqual(accumulator, jump_value), &if_jump, &if_fallthrough);
+
+  BIND(&if_jump);
+  {
+    UpdateInterruptBudget(TruncateIntPtrToInt32(relative_jump), false);
+    Advance(relative_jump);
+    Goto(&done);
+  }
+
+  BIND(&if_fallthrough);
+  {
+    Advance();
+    Goto(&done);
+  }
+  BIND(&done);
+
+  DCHECK_EQ(accumulator_use_, Bytecodes::GetAccumulatorUse(bytecode_));
+
+  bytecode_ = previous_bytecode;
+  accumulator_use_ = previous_acc_use;
+}
+
 Node* InterpreterAssembler::Dispatch() {
   Comment("========= Dispatch");
   DCHECK_IMPLIES(Bytecodes::MakesCallAlongCriticalPath(bytecode_), made_call_);
@@ -1407,6 +1518,8 @@ Node* InterpreterAssembler::Dispatch() {
 
   if (Bytecodes::IsStarLookahead(bytecode_, operand_scale_)) {
     target_bytecode = StarDispatchLookahead(target_bytecode);
+  } else if (Bytecodes::IsJumpIfBooleanLookahead(bytecode_, operand_scale_)) {
+    target_bytecode = JumpIfBooleanDispatchLookahead(target_bytecode);
   }
   return DispatchToBytecode(target_bytecode, BytecodeOffset());
 }
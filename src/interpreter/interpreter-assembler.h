@@ -405,6 +405,22 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   // next dispatch offset.
   void InlineStar();
 
+  // Build code for the one-byte Star bytecode with index |short_star_index|
+  // (i.e. Star<short_star_index>) at the current BytecodeOffset() and
+  // Advance() to the next dispatch offset.
+  void InlineShortStar(compiler::Node* short_star_index);
+
+  // Look ahead for JumpIfTrue and JumpIfFalse and inline them in a branch.
+  // Returns a new target bytecode node for dispatch.
+  compiler::Node* JumpIfBooleanDispatchLookahead(
+      compiler::Node* target_bytecode);
+
+  // Build code for the |jump_bytecode| (either JumpIfTrue or JumpIfFalse) at
+  // the current BytecodeOffset() and Advance() to the next dispatch offset,
+  // which is the jump target if the accumulator is |jump_value|.
+  void InlineJumpIfBoolean(Bytecode jump_bytecode,
+                           compiler::Node* jump_value);
+
   // Dispatch to the bytecode handler with code offset |handler|.
   compiler::Node* DispatchToBytecodeHandler(compiler::Node* handler,
                                             compiler::Node* bytecode_offset,
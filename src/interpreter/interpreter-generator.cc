@@ -140,6 +140,18 @@ IGNITION_HANDLER(Star, InterpreterAssembler) {
   Dispatch();
 }
 
+// Star0 .. Star15
+//
+// Store accumulator to register r0 .. r15. These are one-byte forms of Star
+// for the first registers of the register file.
+#define SHORT_STAR_HANDLER(Name, ...)                                     \
+  IGNITION_HANDLER(Name, InterpreterAssembler) {                          \
+    StoreRegister(GetAccumulator(), Register::FromShortStar(bytecode())); \
+    Dispatch();                                                           \
+  }
+SHORT_STAR_BYTECODE_LIST(SHORT_STAR_HANDLER)
+#undef SHORT_STAR_HANDLER
+
 // Mov <src> <dst>
 //
 // Stores the value of register <src> to register <dst>.
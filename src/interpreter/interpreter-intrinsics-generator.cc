@@ -200,6 +200,13 @@ Node* IntrinsicsGenerator::CreateIterResultObject(
       Builtins::CallableFor(isolate(), Builtins::kCreateIterResultObject));
 }
 
+Node* IntrinsicsGenerator::CopyDataProperties(
+    const InterpreterAssembler::RegListNodePair& args, Node* context) {
+  return IntrinsicAsStubCall(
+      args, context,
+      Builtins::CallableFor(isolate(), Builtins::kCopyDataProperties));
+}
+
 Node* IntrinsicsGenerator::HasProperty(
     const InterpreterAssembler::RegListNodePair& args, Node* context) {
   return IntrinsicAsStubCall(
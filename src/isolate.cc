@@ -35,6 +35,7 @@
 #include "src/deoptimizer.h"
 #include "src/elements.h"
 #include "src/frames-inl.h"
+#include "src/ic/ic-stats.h"
 #include "src/ic/stub-cache.h"
 #include "src/interpreter/interpreter.h"
 #include "src/isolate-inl.h"
@@ -702,6 +703,30 @@ bool IsBuiltinFunction(Isolate* isolate, HeapObject* object,
   return function->code() == isolate->builtins()->builtin(builtin_index);
 }
 
+// Returns the async function or async generator that is going to be resumed
+// by the promise reaction {handler}, or an empty handle if {handler} is not
+// one of the known async function or async generator continuations.
+MaybeHandle<JSGeneratorObject> TryGetGeneratorObjectFromHandler(
+    Isolate* isolate, HeapObject* handler) {
+  // Await in async functions registers the JSAsyncFunctionObject itself as
+  // the reaction handler, unless closures are required for debugging.
+  if (handler->IsJSAsyncFunctionObject()) {
+    return handle(JSGeneratorObject::cast(handler), isolate);
+  }
+  if (IsBuiltinFunction(isolate, handler,
+                        Builtins::kAsyncFunctionAwaitResolveClosure) ||
+      IsBuiltinFunction(isolate, handler,
+                        Builtins::kAsyncGeneratorAwaitResolveClosure) ||
+      IsBuiltinFunction(isolate, handler,
+                        Builtins::kAsyncGeneratorYieldResolveClosure)) {
+    // Now peak into the handlers' AwaitContext to get to
+    // the JSGeneratorObject for the async function.
+    Context context = JSFunction::cast(handler)->context();
+    return handle(JSGeneratorObject::cast(context->extension()), isolate);
+  }
+  return MaybeHandle<JSGeneratorObject>();
+}
+
 void CaptureAsyncStackTrace(Isolate* isolate, Handle<JSPromise> promise,
                             FrameArrayBuilder* builder) {
   while (!builder->full()) {
@@ -716,18 +741,9 @@ void CaptureAsyncStackTrace(Isolate* isolate, Handle<JSPromise> promise,
 
     // Check if the {reaction} has one of the known async function or
     // async generator continuations as its fulfill handler.
-    if (IsBuiltinFunction(isolate, reaction->fulfill_handler(),
-                          Builtins::kAsyncFunctionAwaitResolveClosure) ||
-        IsBuiltinFunction(isolate, reaction->fulfill_handler(),
-                          Builtins::kAsyncGeneratorAwaitResolveClosure) ||
-        IsBuiltinFunction(isolate, reaction->fulfill_handler(),
-                          Builtins::kAsyncGeneratorYieldResolveClosure)) {
-      // Now peak into the handlers' AwaitContext to get to
-      // the JSGeneratorObject for the async function.
-      Handle<Context> context(
-          JSFunction::cast(reaction->fulfill_handler())->context(), isolate);
-      Handle<JSGeneratorObject> generator_object(
-          JSGeneratorObject::cast(context->extension()), isolate);
+    Handle<JSGeneratorObject> generator_object;
+    if (TryGetGeneratorObjectFromHandler(isolate, reaction->fulfill_handler())
+            .ToHandle(&generator_object)) {
       CHECK(generator_object->is_suspended());
 
       // Append async frame corresponding to the {generator_object}.
@@ -866,19 +882,10 @@ Handle<Object> Isolate::CaptureSimpleStackTrace(Handle<JSReceiver> error_object,
           Handle<PromiseReactionJobTask>::cast(current_microtask);
       // Check if the {reaction} has one of the known async function or
       // async generator continuations as its fulfill handler.
-      if (IsBuiltinFunction(this, promise_reaction_job_task->handler(),
-                            Builtins::kAsyncFunctionAwaitResolveClosure) ||
-          IsBuiltinFunction(this, promise_reaction_job_task->handler(),
-                            Builtins::kAsyncGeneratorAwaitResolveClosure) ||
-          IsBuiltinFunction(this, promise_reaction_job_task->handler(),
-                            Builtins::kAsyncGeneratorYieldResolveClosure)) {
-        // Now peak into the handlers' AwaitContext to get to
-        // the JSGeneratorObject for the async function.
-        Handle<Context> context(
-            JSFunction::cast(promise_reaction_job_task->handler())->context(),
-            this);
-        Handle<JSGeneratorObject> generator_object(
-            JSGeneratorObject::cast(context->extension()), this);
+      Handle<JSGeneratorObject> generator_object;
+      if (TryGetGeneratorObjectFromHandler(this,
+                                           promise_reaction_job_task->handler())
+              .ToHandle(&generator_object)) {
         if (generator_object->is_executing()) {
           if (generator_object->IsJSAsyncFunctionObject()) {
             Handle<JSAsyncFunctionObject> async_function_object =
@@ -2780,6 +2787,7 @@ Isolate::Isolate(std::unique_ptr<i::IsolateAllocator> isolate_allocator)
       builtins_(this),
       rail_mode_(PERFORMANCE_ANIMATION),
       code_event_dispatcher_(new CodeEventDispatcher()),
+      function_ic_transitions_(new FunctionICTransitions()),
       cancelable_task_manager_(new CancelableTaskManager()) {
   TRACE_ISOLATE(constructor);
   CheckIsolateLayout();
@@ -3505,8 +3513,7 @@ CodeTracer* Isolate::GetCodeTracer() {
 }
 
 bool Isolate::use_optimizer() {
-  return FLAG_opt && !serializer_enabled_ && CpuFeatures::SupportsOptimizer() &&
-         !is_precise_count_code_coverage() && !is_block_count_code_coverage();
+  return FLAG_opt && !serializer_enabled_ && CpuFeatures::SupportsOptimizer();
 }
 
 bool Isolate::NeedsDetailedOptimizedCodeLineInfo() const {
@@ -4054,7 +4061,11 @@ void Isolate::PromiseHookStateUpdated() {
       promise_hook_ || async_event_delegate_;
   bool promise_hook_or_debug_is_active_or_async_event_delegate =
       promise_hook_or_async_event_delegate || debug()->is_active();
-  if (promise_hook_or_debug_is_active_or_async_event_delegate &&
+  // TurboFan doesn't call any promise hooks from inlined promise operations,
+  // so JavaScript promise hooks have to invalidate the protector as well,
+  // even though they remain on the fast paths in the builtins.
+  if ((promise_hook_or_debug_is_active_or_async_event_delegate ||
+       has_context_promise_hooks_) &&
       IsPromiseHookProtectorIntact()) {
     HandleScope scope(this);
     InvalidatePromiseHookProtector();
@@ -4189,14 +4200,49 @@ void Isolate::SetPromiseHook(PromiseHook hook) {
   PromiseHookStateUpdated();
 }
 
+void Isolate::SetHasContextPromiseHooks() {
+  has_context_promise_hooks_ = true;
+  PromiseHookStateUpdated();
+}
+
 void Isolate::RunPromiseHook(PromiseHookType type, Handle<JSPromise> promise,
                              Handle<Object> parent) {
   RunPromiseHookForAsyncEventDelegate(type, promise);
+  RunContextPromiseHook(type, promise, parent);
   if (promise_hook_ == nullptr) return;
   promise_hook_(type, v8::Utils::PromiseToLocal(promise),
                 v8::Utils::ToLocal(parent));
 }
 
+void Isolate::RunContextPromiseHook(PromiseHookType type,
+                                    Handle<JSPromise> promise,
+                                    Handle<Object> parent) {
+  if (!has_context_promise_hooks_ || context().is_null()) return;
+  Handle<Object> hook;
+  switch (type) {
+    case PromiseHookType::kInit:
+      hook = handle(raw_native_context()->promise_hook_init_function(), this);
+      break;
+    case PromiseHookType::kResolve:
+      hook =
+          handle(raw_native_context()->promise_hook_resolve_function(), this);
+      break;
+    case PromiseHookType::kBefore:
+      hook = handle(raw_native_context()->promise_hook_before_function(), this);
+      break;
+    case PromiseHookType::kAfter:
+      hook = handle(raw_native_context()->promise_hook_after_function(), this);
+      break;
+  }
+  if (hook->IsUndefined(this)) return;
+
+  // Just like the builtins, report exceptions thrown by the hook and carry on
+  // with the promise operation.
+  Handle<Object> argv[] = {promise, parent};
+  Execution::TryCall(this, hook, factory()->undefined_value(), arraysize(argv),
+                     argv, Execution::MessageHandling::kReport, nullptr);
+}
+
 void Isolate::RunPromiseHookForAsyncEventDelegate(PromiseHookType type,
                                                   Handle<JSPromise> promise) {
   if (!async_event_delegate_) return;
@@ -4279,7 +4325,13 @@ void Isolate::ReportPromiseReject(Handle<JSPromise> promise,
 }
 
 void Isolate::EnqueueMicrotask(Handle<Microtask> microtask) {
-  default_microtask_queue()->EnqueueMicrotask(*microtask);
+  // Use the MicrotaskQueue of the current native context, which is the
+  // default MicrotaskQueue unless the embedder gave the context its own.
+  MicrotaskQueue* microtask_queue = default_microtask_queue();
+  if (!context().is_null()) {
+    microtask_queue = context()->native_context()->microtask_queue();
+  }
+  microtask_queue->EnqueueMicrotask(*microtask);
 }
 
 
@@ -4304,7 +4356,6 @@ void Isolate::RunMicrotasks() {
     if (default_microtask_queue()->RunMicrotasks(this) < 0) {
       SetTerminationOnExternalTryCatch();
     }
-    DCHECK_EQ(0, default_microtask_queue()->size());
     is_running_microtasks_ = false;
   }
   // TODO(marja): (spec) The discussion about when to clear the KeepDuringJob
@@ -4455,13 +4506,18 @@ void Isolate::SetIdle(bool is_idle) {
 }
 
 #ifdef V8_INTL_SUPPORT
-icu::UObject* Isolate::get_cached_icu_object(ICUObjectCacheType cache_type) {
-  return icu_object_cache_[cache_type].get();
+icu::UObject* Isolate::get_cached_icu_object(ICUObjectCacheType cache_type,
+                                             const std::string& locales_key) {
+  auto it = icu_object_cache_.find(cache_type);
+  if (it == icu_object_cache_.end()) return nullptr;
+  if (it->second.locales_key != locales_key) return nullptr;
+  return it->second.obj.get();
 }
 
 void Isolate::set_icu_object_in_cache(ICUObjectCacheType cache_type,
+                                      const std::string& locales_key,
                                       std::shared_ptr<icu::UObject> obj) {
-  icu_object_cache_[cache_type] = obj;
+  icu_object_cache_[cache_type] = {locales_key, std::move(obj)};
 }
 
 void Isolate::clear_cached_icu_object(ICUObjectCacheType cache_type) {
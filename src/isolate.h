@@ -76,6 +76,7 @@ class DeoptimizerData;
 class DescriptorLookupCache;
 class EternalHandles;
 class ExternalCallbackScope;
+class FunctionICTransitions;
 class HandleScopeImplementer;
 class HeapObjectToIndexHashMap;
 class HeapProfiler;
@@ -478,6 +479,7 @@ typedef std::vector<HeapObject*> DebugObjectCache;
   V(AddressToIndexHashMap*, external_reference_map, nullptr)                  \
   V(HeapObjectToIndexHashMap*, root_index_map, nullptr)                       \
   V(MicrotaskQueue*, default_microtask_queue, nullptr)                        \
+  V(MicrotaskQueue*, running_microtask_queue, nullptr)                        \
   V(CompilationStatistics*, turbo_statistics, nullptr)                        \
   V(CodeTracer*, code_tracer, nullptr)                                        \
   V(uint32_t, per_isolate_assert_data, 0xFFFFFFFFu)                           \
@@ -1108,6 +1110,9 @@ class Isolate final : private HiddenFactory {
   CodeEventDispatcher* code_event_dispatcher() const {
     return code_event_dispatcher_.get();
   }
+  FunctionICTransitions* function_ic_transitions() const {
+    return function_ic_transitions_.get();
+  }
   HeapProfiler* heap_profiler() const { return heap_profiler_; }
 
 #ifdef DEBUG
@@ -1216,8 +1221,13 @@ class Isolate final : private HiddenFactory {
       kDefaultCollator, kDefaultNumberFormat, kDefaultSimpleDateFormat,
       kDefaultSimpleDateFormatForTime, kDefaultSimpleDateFormatForDate};
 
-  icu::UObject* get_cached_icu_object(ICUObjectCacheType cache_type);
+  // The cache holds one ICU object per type, together with the key of the
+  // locales it was created for (see Intl::GetICUObjectCacheKey). A lookup
+  // with a different key misses.
+  icu::UObject* get_cached_icu_object(ICUObjectCacheType cache_type,
+                                      const std::string& locales_key);
   void set_icu_object_in_cache(ICUObjectCacheType cache_type,
+                               const std::string& locales_key,
                                std::shared_ptr<icu::UObject> obj);
   void clear_cached_icu_object(ICUObjectCacheType cache_type);
 
@@ -1418,6 +1428,17 @@ class Isolate final : private HiddenFactory {
                            bool private_symbol);
 
   void SetUseCounterCallback(v8::Isolate::UseCounterCallback callback);
+  void SetDeoptimizationCallback(v8::DeoptimizationCallback callback,
+                                 void* data) {
+    deoptimization_callback_ = callback;
+    deoptimization_callback_data_ = data;
+  }
+  v8::DeoptimizationCallback deoptimization_callback() const {
+    return deoptimization_callback_;
+  }
+  void* deoptimization_callback_data() const {
+    return deoptimization_callback_data_;
+  }
   void CountUsage(v8::Isolate::UseCounterFeature feature);
 
   static std::string GetTurboCfgFileName(Isolate* isolate);
@@ -1438,8 +1459,12 @@ class Isolate final : private HiddenFactory {
     return reinterpret_cast<Address>(&promise_hook_or_async_event_delegate_);
   }
 
-  Address default_microtask_queue_address() {
-    return reinterpret_cast<Address>(&default_microtask_queue_);
+  Address has_context_promise_hooks_address() {
+    return reinterpret_cast<Address>(&has_context_promise_hooks_);
+  }
+
+  Address running_microtask_queue_address() {
+    return reinterpret_cast<Address>(&running_microtask_queue_);
   }
 
   Address promise_hook_or_debug_is_active_or_async_event_delegate_address() {
@@ -1460,6 +1485,10 @@ class Isolate final : private HiddenFactory {
                               AtomicsWaitWakeHandle* stop_handle);
 
   void SetPromiseHook(PromiseHook hook);
+  // Called once some native context got JavaScript promise hooks installed,
+  // see v8::Context::SetPromiseHooks(). This is sticky for the lifetime of
+  // the isolate, builtins then check the native context for hooks to call.
+  void SetHasContextPromiseHooks();
   void RunPromiseHook(PromiseHookType type, Handle<JSPromise> promise,
                       Handle<Object> parent);
   void PromiseHookStateUpdated();
@@ -1677,6 +1706,8 @@ class Isolate final : private HiddenFactory {
 
   void RunPromiseHookForAsyncEventDelegate(PromiseHookType type,
                                            Handle<JSPromise> promise);
+  void RunContextPromiseHook(PromiseHookType type, Handle<JSPromise> promise,
+                             Handle<Object> parent);
 
   const char* RAILModeName(RAILMode rail_mode) const {
     switch (rail_mode) {
@@ -1762,7 +1793,11 @@ class Isolate final : private HiddenFactory {
       return static_cast<std::size_t>(a);
     }
   };
-  std::unordered_map<ICUObjectCacheType, std::shared_ptr<icu::UObject>,
+  struct ICUObjectCacheEntry {
+    std::string locales_key;
+    std::shared_ptr<icu::UObject> obj;
+  };
+  std::unordered_map<ICUObjectCacheType, ICUObjectCacheEntry,
                      ICUObjectCacheTypeHash>
       icu_object_cache_;
 
@@ -1801,6 +1836,7 @@ class Isolate final : private HiddenFactory {
   Debug* debug_ = nullptr;
   HeapProfiler* heap_profiler_ = nullptr;
   std::unique_ptr<CodeEventDispatcher> code_event_dispatcher_;
+  std::unique_ptr<FunctionICTransitions> function_ic_transitions_;
 
   const AstStringConstants* ast_string_constants_ = nullptr;
 
@@ -1861,6 +1897,9 @@ class Isolate final : private HiddenFactory {
 
   v8::Isolate::UseCounterCallback use_counter_callback_ = nullptr;
 
+  v8::DeoptimizationCallback deoptimization_callback_ = nullptr;
+  void* deoptimization_callback_data_ = nullptr;
+
   std::vector<Object*> read_only_object_cache_;
   std::vector<Object*> partial_snapshot_cache_;
 
@@ -1889,6 +1928,7 @@ class Isolate final : private HiddenFactory {
   debug::AsyncEventDelegate* async_event_delegate_ = nullptr;
   bool promise_hook_or_async_event_delegate_ = false;
   bool promise_hook_or_debug_is_active_or_async_event_delegate_ = false;
+  bool has_context_promise_hooks_ = false;
   int async_task_count_ = 0;
 
   v8::Isolate::AbortOnUncaughtExceptionCallback
@@ -1896,7 +1936,8 @@ class Isolate final : private HiddenFactory {
 
   bool allow_atomics_wait_ = true;
 
-  base::Mutex managed_ptr_destructors_mutex_;
+  base::Mutex managed_ptr_destructors_mutex_{
+      "Isolate::managed_ptr_destructors_mutex"};
   ManagedPtrDestructor* managed_ptr_destructors_head_ = nullptr;
 
   size_t total_regexp_code_generated_ = 0;
@@ -1916,7 +1957,7 @@ class Isolate final : private HiddenFactory {
   // TODO(kenton@cloudflare.com): This mutex can be removed if
   // thread_data_table_ is always accessed under the isolate lock. I do not
   // know if this is the case, so I'm preserving it for now.
-  base::Mutex thread_data_table_mutex_;
+  base::Mutex thread_data_table_mutex_{"Isolate::thread_data_table_mutex"};
   ThreadDataTable thread_data_table_;
 
   // Delete new/delete operators to ensure that Isolate::New() and
@@ -1926,6 +1967,7 @@ class Isolate final : private HiddenFactory {
   void operator delete(void*) = delete;
 
   friend class heap::HeapTester;
+  friend class MicrotaskQueue;
   friend class TestSerializer;
 
   DISALLOW_COPY_AND_ASSIGN(Isolate);
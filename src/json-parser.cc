@@ -279,7 +279,7 @@ bool JsonParser<seq_one_byte>::ParseJsonString(Handle<String> expected) {
 
 // Parse any JSON value.
 template <bool seq_one_byte>
-Handle<Object> JsonParser<seq_one_byte>::ParseJsonValue() {
+Handle<Object> JsonParser<seq_one_byte>::ParseJsonValue(Handle<Map> feedback) {
   StackLimitCheck stack_check(isolate_);
   if (stack_check.HasOverflowed()) {
     isolate_->StackOverflow();
@@ -293,7 +293,7 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonValue() {
 
   if (c0_ == '"') return ParseJsonString();
   if ((c0_ >= '0' && c0_ <= '9') || c0_ == '-') return ParseJsonNumber();
-  if (c0_ == '{') return ParseJsonObject();
+  if (c0_ == '{') return ParseJsonObject(feedback);
   if (c0_ == '[') return ParseJsonArray();
   if (c0_ == 'f') {
     if (AdvanceGetChar() == 'a' && AdvanceGetChar() == 'l' &&
@@ -358,19 +358,48 @@ ParseElementResult JsonParser<seq_one_byte>::ParseElement(
   return kElementNotFound;
 }
 
+template <bool seq_one_byte>
+bool JsonParser<seq_one_byte>::IsUsableFeedback(Map feedback, Map root) {
+  DisallowHeapAllocation no_gc;
+  if (feedback->is_dictionary_map() || feedback->is_deprecated()) return false;
+  if (feedback->elements_kind() != root->elements_kind()) return false;
+  return feedback->FindRootMap(isolate()) == root;
+}
+
+template <bool seq_one_byte>
+Handle<Map> JsonParser<seq_one_byte>::FeedbackPrefixMap(Handle<Map> feedback,
+                                                        int length,
+                                                        Handle<Map> root) {
+  if (length == 0) return root;
+  // Each map on the transition path adds exactly one field, so the owner of
+  // field {length - 1} is the map with {length} fields.
+  return handle(feedback->FindFieldOwner(isolate(), length - 1), isolate());
+}
+
 // Parse a JSON object. Position must be right at '{'.
 template <bool seq_one_byte>
-Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
+Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject(
+    Handle<Map> feedback) {
   HandleScope scope(isolate());
   Handle<JSObject> json_object =
       factory()->NewJSObject(object_constructor(), pretenure_);
   Handle<Map> map(json_object->map(), isolate());
+  Handle<Map> root = map;
   int descriptor = 0;
   VectorSegment<ZoneVector<Handle<Object>>> properties(&properties_);
   DCHECK_EQ(c0_, '{');
 
   bool transitioning = true;
 
+  // While the keys match the fields of {feedback} in order, {map} is not
+  // updated. Once an unexpected key or value shows up, {map} is recovered
+  // from {feedback} and the transition tree is used from there on.
+  int feedback_descriptors = 0;
+  if (seq_one_byte && !feedback.is_null() &&
+      IsUsableFeedback(*feedback, *map)) {
+    feedback_descriptors = feedback->NumberOfOwnDescriptors();
+  }
+
   AdvanceSkipWhitespace();
   if (c0_ != '}') {
     do {
@@ -397,11 +426,38 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
       // Try to follow existing transitions as long as possible. Once we stop
       // transitioning, no transition can be found anymore.
       DCHECK(transitioning);
-      // First check whether there is a single expected transition. If so, try
-      // to parse it first.
       bool follow_expected = false;
       Handle<Map> target;
-      if (seq_one_byte) {
+      if (feedback_descriptors > 0) {
+        if (descriptor < feedback_descriptors) {
+          // Expect the key of the same field in the previous sibling. Its
+          // details are shared by all maps on the path to {feedback}.
+          Handle<String> expected_key;
+          {
+            DisallowHeapAllocation no_gc;
+            DescriptorArray descriptors = feedback->instance_descriptors();
+            PropertyDetails details = descriptors->GetDetails(descriptor);
+            Name name = descriptors->GetKey(descriptor);
+            if (details.location() == kField && details.kind() == kData &&
+                details.attributes() == NONE && name->IsString()) {
+              expected_key = handle(String::cast(name), isolate());
+            }
+          }
+          follow_expected =
+              !expected_key.is_null() && ParseJsonString(expected_key);
+          if (follow_expected) {
+            key = expected_key;
+            target = feedback;
+          }
+        }
+        if (!follow_expected) {
+          map = FeedbackPrefixMap(feedback, descriptor, root);
+          feedback_descriptors = 0;
+        }
+      }
+      // Next check whether there is a single expected transition. If so, try
+      // to parse it first.
+      if (seq_one_byte && !follow_expected) {
         DisallowHeapAllocation no_gc;
         TransitionsAccessor transitions(isolate(), *map, &no_gc);
         key = transitions.ExpectedTransitionKey();
@@ -448,7 +504,7 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
                      ->GetFieldType(descriptor)
                      ->NowContains(value));
           properties.push_back(value);
-          map = target;
+          if (feedback_descriptors == 0) map = target;
           descriptor++;
           continue;
         } else {
@@ -457,6 +513,10 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
       }
 
       DCHECK(!transitioning);
+      if (feedback_descriptors > 0) {
+        map = FeedbackPrefixMap(feedback, descriptor, root);
+        feedback_descriptors = 0;
+      }
 
       // Commit the intermediate state to the object and stop transitioning.
       CommitStateToJsonObject(json_object, map, properties.GetVector());
@@ -467,6 +527,9 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
 
     // If we transitioned until the very end, transition the map now.
     if (transitioning) {
+      if (feedback_descriptors > 0) {
+        map = FeedbackPrefixMap(feedback, descriptor, root);
+      }
       CommitStateToJsonObject(json_object, map, properties.GetVector());
     } else {
       while (MatchSkipWhiteSpace(',')) {
@@ -576,14 +639,20 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonArray() {
   DCHECK_EQ(c0_, '[');
 
   ElementKindLattice lattice;
+  // The map of the last object element, which likely has the same shape as
+  // the next one.
+  Handle<Map> feedback;
 
   AdvanceSkipWhitespace();
   if (c0_ != ']') {
     do {
-      Handle<Object> element = ParseJsonValue();
+      Handle<Object> element = ParseJsonValue(feedback);
       if (element.is_null()) return ReportUnexpectedCharacter();
       elements.push_back(element);
       lattice.Update(element);
+      if (element->IsJSObject()) {
+        feedback = handle(JSObject::cast(*element)->map(), isolate());
+      }
     } while (MatchSkipWhiteSpace(','));
     if (c0_ != ']') {
       return ReportUnexpectedCharacter();
@@ -864,8 +933,11 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
           index = (index * 10) + d;
         }
       }
-      running_hash = StringHasher::AddCharacterCore(running_hash,
-                                                    static_cast<uint16_t>(c0));
+      // Long keys are hashed with the wide hash once their length is known.
+      if (position - position_ < StringHasher::kWideHashMinLength) {
+        running_hash = StringHasher::AddCharacterCore(
+            running_hash, static_cast<uint16_t>(c0));
+      }
       position++;
       if (position >= source_length_) {
         c0_ = kEndOfString;
@@ -880,6 +952,12 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
       hash =
           StringHasher::MakeArrayIndexHash(index, length) >> String::kHashShift;
     } else if (length <= String::kMaxHashCalcLength) {
+      if (length >= StringHasher::kWideHashMinLength) {
+        DisallowHeapAllocation no_gc;
+        running_hash = StringHasher::ComputeWideHash(
+            isolate()->heap()->HashSeed(),
+            seq_source_->GetChars(no_gc) + position_, length);
+      }
       hash = StringHasher::GetHashCore(running_hash);
     } else {
       hash = static_cast<uint32_t>(length);
@@ -950,5 +1028,69 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
 template class JsonParser<true>;
 template class JsonParser<false>;
 
+void JsonChunkAccumulator::AddCodePoint(unibrow::uchar c) {
+  if (c == unibrow::Utf8::kIncomplete) return;
+  if (c <= unibrow::Utf16::kMaxNonSurrogateCharCode) {
+    if (c > String::kMaxOneByteCharCodeU) is_one_byte_ = false;
+    chars_.push_back(static_cast<uc16>(c));
+  } else {
+    is_one_byte_ = false;
+    chars_.push_back(unibrow::Utf16::LeadSurrogate(c));
+    chars_.push_back(unibrow::Utf16::TrailSurrogate(c));
+  }
+}
+
+void JsonChunkAccumulator::Append(const uint8_t* data, size_t length) {
+  size_t i = 0;
+  while (i < length) {
+    // Widen runs of ASCII directly. Only the surroundings of non-ASCII
+    // characters go through the decoder.
+    if (state_ == unibrow::Utf8::State::kAccept) {
+      int max_run = static_cast<int>(std::min(length - i, size_t{kMaxInt}));
+      int run = String::NonAsciiStart(
+          reinterpret_cast<const char*>(data + i), max_run);
+      chars_.insert(chars_.end(), data + i, data + i + run);
+      i += run;
+      if (i == length) break;
+    }
+    AddCodePoint(unibrow::Utf8::ValueOfIncremental(data[i], &i, &state_,
+                                                   &incomplete_char_));
+  }
+}
+
+MaybeHandle<Object> JsonChunkAccumulator::Parse(Isolate* isolate) {
+  // An incomplete sequence at the end is replaced by kBadChar.
+  unibrow::uchar last = unibrow::Utf8::ValueOfIncrementalFinish(&state_);
+  if (last != unibrow::Utf8::kBufferEmpty) AddCodePoint(last);
+  incomplete_char_ = 0;
+  std::vector<uc16> chars;
+  chars.swap(chars_);
+  bool is_one_byte = is_one_byte_;
+  is_one_byte_ = true;
+
+  if (chars.size() > static_cast<size_t>(String::kMaxLength)) {
+    THROW_NEW_ERROR(isolate, NewInvalidStringLengthError(), Object);
+  }
+  int length = static_cast<int>(chars.size());
+  Handle<String> source = isolate->factory()->empty_string();
+  if (length > 0 && is_one_byte) {
+    Handle<SeqOneByteString> string =
+        isolate->factory()->NewRawOneByteString(length).ToHandleChecked();
+    DisallowHeapAllocation no_gc;
+    CopyChars(string->GetChars(no_gc), chars.data(), length);
+    source = string;
+  } else if (length > 0) {
+    Handle<SeqTwoByteString> string =
+        isolate->factory()->NewRawTwoByteString(length).ToHandleChecked();
+    DisallowHeapAllocation no_gc;
+    CopyChars(string->GetChars(no_gc), chars.data(), length);
+    source = string;
+  }
+  Handle<Object> undefined = isolate->factory()->undefined_value();
+  return source->IsSeqOneByteString()
+             ? JsonParser<true>::Parse(isolate, source, undefined)
+             : JsonParser<false>::Parse(isolate, source, undefined);
+}
+
 }  // namespace internal
 }  // namespace v8
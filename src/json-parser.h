@@ -5,9 +5,12 @@
 #ifndef V8_JSON_PARSER_H_
 #define V8_JSON_PARSER_H_
 
+#include <vector>
+
 #include "src/heap/factory.h"
 #include "src/isolate.h"
 #include "src/objects.h"
+#include "src/unicode.h"
 #include "src/zone/zone-containers.h"
 
 namespace v8 {
@@ -101,7 +104,8 @@ class JsonParser {
   // Parse a single JSON value from input (grammar production JSONValue).
   // A JSON value is either a (double-quoted) string literal, a number literal,
   // one of "true", "false", or "null", or an object or array literal.
-  Handle<Object> ParseJsonValue();
+  // {feedback} is passed on to ParseJsonObject.
+  Handle<Object> ParseJsonValue(Handle<Map> feedback = Handle<Map>());
 
   // Parse a JSON object literal (grammar production JSONObject).
   // An object literal is a squiggly-braced and comma separated sequence
@@ -109,7 +113,17 @@ class JsonParser {
   // literal, the value is a JSON value, and the two are separated by a colon.
   // A JSON array doesn't allow numbers and identifiers as keys, like a
   // JavaScript array.
-  Handle<Object> ParseJsonObject();
+  // If {feedback} is the map of the previous object in the same array, the
+  // keys are first matched against its fields in order. This avoids a
+  // transition lookup per property for arrays of similarly shaped objects.
+  Handle<Object> ParseJsonObject(Handle<Map> feedback);
+
+  // Helpers for ParseJsonObject. {feedback} can only be used if it was built
+  // by following field transitions from {root}; FeedbackPrefixMap returns the
+  // map on that path which has the first {length} fields of {feedback}.
+  bool IsUsableFeedback(Map feedback, Map root);
+  Handle<Map> FeedbackPrefixMap(Handle<Map> feedback, int length,
+                                Handle<Map> root);
 
   // Helper for ParseJsonObject. Parses the form "123": obj, which is recorded
   // as an element, not a property.
@@ -157,6 +171,30 @@ class JsonParser {
   ZoneVector<Handle<Object>> properties_;
 };
 
+// Collects UTF-8 encoded JSON text which arrives in chunks. Each chunk is
+// decoded as soon as it is appended, so the chunks never have to be joined;
+// Parse() copies the decoded text into a sequential string once.
+class JsonChunkAccumulator {
+ public:
+  JsonChunkAccumulator() = default;
+
+  // Does not touch the heap.
+  void Append(const uint8_t* data, size_t length);
+
+  // Parses the text appended so far and resets the accumulator.
+  V8_WARN_UNUSED_RESULT MaybeHandle<Object> Parse(Isolate* isolate);
+
+ private:
+  V8_INLINE void AddCodePoint(unibrow::uchar c);
+
+  std::vector<uc16> chars_;
+  bool is_one_byte_ = true;
+  unibrow::Utf8::State state_ = unibrow::Utf8::State::kAccept;
+  unibrow::Utf8::Utf8IncrementalBuffer incomplete_char_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(JsonChunkAccumulator);
+};
+
 }  // namespace internal
 }  // namespace v8
 
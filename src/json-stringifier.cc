@@ -4,6 +4,8 @@
 
 #include "src/json-stringifier.h"
 
+#include "src/base/bits.h"
+#include "src/base/build_config.h"
 #include "src/conversions.h"
 #include "src/lookup.h"
 #include "src/message-template.h"
@@ -11,8 +13,17 @@
 #include "src/objects/js-array-inl.h"
 #include "src/objects/smi.h"
 #include "src/string-builder-inl.h"
+#include "src/unicode-inl.h"
 #include "src/utils.h"
 
+#if V8_HOST_ARCH_X64 || V8_HOST_ARCH_IA32
+#include <emmintrin.h>
+#define V8_JSON_SIMD_SSE2 1
+#elif V8_HOST_ARCH_ARM64
+#include <arm_neon.h>
+#define V8_JSON_SIMD_NEON 1
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -95,6 +106,11 @@ class JsonStringifier {
   template <typename Char>
   V8_INLINE static bool DoNotEscape(Char c);
 
+  // Returns the number of leading characters in [chars, chars + length) for
+  // which DoNotEscape() holds.
+  template <typename Char>
+  V8_INLINE static int DoNotEscapeRunLength(const Char* chars, int length);
+
   V8_INLINE void NewLine();
   V8_INLINE void Indent() { indent_++; }
   V8_INLINE void Unindent() { indent_--; }
@@ -127,6 +143,97 @@ MaybeHandle<Object> JsonStringify(Isolate* isolate, Handle<Object> object,
   return stringifier.Stringify(object, replacer, gap);
 }
 
+namespace {
+
+// Encodes the flat parts of a string as UTF-8 into a fixed size buffer, which
+// is handed to the sink whenever it fills up. Surrogate pairs may be split
+// between two parts.
+class Utf8SinkWriter {
+ public:
+  explicit Utf8SinkWriter(v8::JSON::OutputSink* sink)
+      : sink_(sink), cursor_(0), lead_surrogate_(0) {}
+
+  void VisitOneByteString(const uint8_t* chars, int length) {
+    WriteChars(chars, length);
+  }
+
+  void VisitTwoByteString(const uint16_t* chars, int length) {
+    WriteChars(chars, length);
+  }
+
+  void Finish() {
+    if (lead_surrogate_ != 0) {
+      cursor_ += unibrow::Utf8::Encode(buffer_ + cursor_, lead_surrogate_,
+                                       unibrow::Utf16::kNoPreviousCharacter);
+    }
+    Flush();
+  }
+
+ private:
+  template <typename Char>
+  void WriteChars(const Char* chars, int length) {
+    for (int i = 0; i < length; i++) {
+      // A lone lead surrogate followed by another character takes up to two
+      // encoded characters.
+      if (cursor_ > kBufferSize - 2 * unibrow::Utf8::kMaxEncodedSize) Flush();
+      uc16 c = chars[i];
+      if (c <= unibrow::Utf8::kMaxOneByteChar && lead_surrogate_ == 0) {
+        buffer_[cursor_++] = static_cast<char>(c);
+        continue;
+      }
+      if (lead_surrogate_ != 0) {
+        if (unibrow::Utf16::IsTrailSurrogate(c)) {
+          cursor_ += unibrow::Utf8::Encode(
+              buffer_ + cursor_,
+              unibrow::Utf16::CombineSurrogatePair(lead_surrogate_, c),
+              unibrow::Utf16::kNoPreviousCharacter);
+          lead_surrogate_ = 0;
+          continue;
+        }
+        cursor_ += unibrow::Utf8::Encode(buffer_ + cursor_, lead_surrogate_,
+                                         unibrow::Utf16::kNoPreviousCharacter);
+        lead_surrogate_ = 0;
+      }
+      if (unibrow::Utf16::IsLeadSurrogate(c)) {
+        lead_surrogate_ = c;
+      } else {
+        cursor_ += unibrow::Utf8::Encode(buffer_ + cursor_, c,
+                                         unibrow::Utf16::kNoPreviousCharacter);
+      }
+    }
+  }
+
+  void Flush() {
+    if (cursor_ == 0) return;
+    sink_->Write(buffer_, cursor_);
+    cursor_ = 0;
+  }
+
+  static const int kBufferSize = 8 * KB;
+
+  v8::JSON::OutputSink* sink_;
+  int cursor_;
+  uc16 lead_surrogate_;
+  char buffer_[kBufferSize];
+};
+
+}  // namespace
+
+void JsonWriteUtf8(Handle<String> json, v8::JSON::OutputSink* sink) {
+  DisallowHeapAllocation no_gc;
+  Utf8SinkWriter writer(sink);
+  ConsString cons_string = String::VisitFlat(&writer, *json);
+  if (!cons_string.is_null()) {
+    ConsStringIterator iter(cons_string);
+    int offset;
+    for (String part = iter.Next(&offset); !part.is_null();
+         part = iter.Next(&offset)) {
+      String::VisitFlat(&writer, part);
+    }
+  }
+  writer.Finish();
+}
+
 // Translation table to escape Latin1 characters.
 // Table entries start at a multiple of 8 and are null-terminated.
 const char* const JsonStringifier::JsonEscapeTable =
@@ -753,10 +860,16 @@ void JsonStringifier::SerializeStringUnchecked_(
   // The <uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
   for (int i = 0; i < src.length(); i++) {
+    // Copy runs of characters which need no escaping in bulk.
+    int run_length = DoNotEscapeRunLength(&src[i], src.length() - i);
+    if (run_length > 0) {
+      dest->AppendChars(&src[i], run_length);
+      i += run_length;
+      if (i == src.length()) break;
+    }
     SrcChar c = src[i];
-    if (DoNotEscape(c)) {
-      dest->Append(c);
-    } else if (FLAG_harmony_json_stringify && c >= 0xD800 && c <= 0xDFFF) {
+    DCHECK(!DoNotEscape(c));
+    if (FLAG_harmony_json_stringify && c >= 0xD800 && c <= 0xDFFF) {
       // The current character is a surrogate.
       if (c <= 0xDBFF) {
         // The current character is a leading surrogate.
@@ -805,63 +918,25 @@ template <typename SrcChar, typename DestChar>
 void JsonStringifier::SerializeString_(Handle<String> string) {
   int length = string->length();
   builder_.Append<uint8_t, DestChar>('"');
-  // We might be able to fit the whole escaped string in the current string
-  // part, or we might need to allocate.
-  if (int worst_case_length = builder_.EscapedLengthIfCurrentPartFits(length)) {
+  // Serialize the string in slices whose escaped form is guaranteed to fit
+  // into the current string part, so that no slice has to check for the end
+  // of the part. Short strings usually take a single slice; long ones get
+  // parts sized for them up front.
+  int start = 0;
+  while (start < length) {
+    int slice_length = builder_.EscapedSliceLength(length - start);
     DisallowHeapAllocation no_gc;
-    Vector<const SrcChar> vector = string->GetCharVector<SrcChar>(no_gc);
-    IncrementalStringBuilder::NoExtendBuilder<DestChar> no_extend(
-        &builder_, worst_case_length, no_gc);
-    SerializeStringUnchecked_(vector, &no_extend);
-  } else {
-    FlatStringReader reader(isolate_, string);
-    for (int i = 0; i < reader.length(); i++) {
-      SrcChar c = reader.Get<SrcChar>(i);
-      if (DoNotEscape(c)) {
-        builder_.Append<SrcChar, DestChar>(c);
-      } else if (FLAG_harmony_json_stringify && c >= 0xD800 && c <= 0xDFFF) {
-        // The current character is a surrogate.
-        if (c <= 0xDBFF) {
-          // The current character is a leading surrogate.
-          if (i + 1 < reader.length()) {
-            // There is a next character.
-            SrcChar next = reader.Get<SrcChar>(i + 1);
-            if (next >= 0xDC00 && next <= 0xDFFF) {
-              // The next character is a trailing surrogate, meaning this is a
-              // surrogate pair.
-              builder_.Append<SrcChar, DestChar>(c);
-              builder_.Append<SrcChar, DestChar>(next);
-              i++;
-            } else {
-              // The next character is not a trailing surrogate. Thus, the
-              // current character is a lone leading surrogate.
-              builder_.AppendCString("\\u");
-              char* const hex = DoubleToRadixCString(c, 16);
-              builder_.AppendCString(hex);
-              DeleteArray(hex);
-            }
-          } else {
-            // There is no next character. Thus, the current character is a
-            // lone leading surrogate.
-            builder_.AppendCString("\\u");
-            char* const hex = DoubleToRadixCString(c, 16);
-            builder_.AppendCString(hex);
-            DeleteArray(hex);
-          }
-        } else {
-          // The current character is a lone trailing surrogate. (If it had
-          // been preceded by a leading surrogate, we would've ended up in the
-          // other branch earlier on, and the current character would've been
-          // handled as part of the surrogate pair already.)
-          builder_.AppendCString("\\u");
-          char* const hex = DoubleToRadixCString(c, 16);
-          builder_.AppendCString(hex);
-          DeleteArray(hex);
-        }
-      } else {
-        builder_.AppendCString(&JsonEscapeTable[c * kJsonEscapeTableEntrySize]);
-      }
+    Vector<const SrcChar> vector =
+        string->GetCharVector<SrcChar>(no_gc).SubVector(start, length);
+    if (slice_length < vector.length() && sizeof(SrcChar) == 2) {
+      // Do not split surrogate pairs between slices.
+      SrcChar last = vector[slice_length - 1];
+      if (last >= 0xD800 && last <= 0xDBFF) slice_length--;
     }
+    IncrementalStringBuilder::NoExtendBuilder<DestChar> no_extend(
+        &builder_, slice_length << 3, no_gc);
+    SerializeStringUnchecked_(vector.SubVector(0, slice_length), &no_extend);
+    start += slice_length;
   }
   builder_.Append<uint8_t, DestChar>('"');
 }
@@ -869,16 +944,103 @@ void JsonStringifier::SerializeString_(Handle<String> string) {
 template <>
 bool JsonStringifier::DoNotEscape(uint8_t c) {
   // https://tc39.github.io/ecma262/#table-json-single-character-escapes
-  return c >= 0x23 && c <= 0x7E && c != 0x5C;
+  return c >= 0x20 && c != 0x22 && c != 0x5C;
 }
 
 template <>
 bool JsonStringifier::DoNotEscape(uint16_t c) {
   // https://tc39.github.io/ecma262/#table-json-single-character-escapes
-  return c >= 0x23 && c != 0x5C && c != 0x7F &&
+  return c >= 0x20 && c != 0x22 && c != 0x5C &&
          (!FLAG_harmony_json_stringify || (c < 0xD800 || c > 0xDFFF));
 }
 
+// Both scans below compare 16 bytes at a time where SIMD is available, which
+// pays off for the long runs of plain text that make up most strings.
+template <>
+int JsonStringifier::DoNotEscapeRunLength(const uint8_t* chars, int length) {
+  int i = 0;
+#if V8_JSON_SIMD_SSE2
+  const __m128i max_control = _mm_set1_epi8(0x1F);
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i zero = _mm_setzero_si128();
+  for (; length - i >= 16; i += 16) {
+    __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i));
+    // Control characters saturate to zero when subtracting 0x1F.
+    __m128i match =
+        _mm_or_si128(_mm_cmpeq_epi8(_mm_subs_epu8(c, max_control), zero),
+                     _mm_or_si128(_mm_cmpeq_epi8(c, quote),
+                                  _mm_cmpeq_epi8(c, backslash)));
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(match));
+    if (mask != 0) return i + base::bits::CountTrailingZeros32(mask);
+  }
+#elif V8_JSON_SIMD_NEON
+  const uint8x16_t min_printable = vdupq_n_u8(0x20);
+  const uint8x16_t quote = vdupq_n_u8('"');
+  const uint8x16_t backslash = vdupq_n_u8('\\');
+  for (; length - i >= 16; i += 16) {
+    uint8x16_t c = vld1q_u8(chars + i);
+    uint8x16_t match =
+        vorrq_u8(vcltq_u8(c, min_printable),
+                 vorrq_u8(vceqq_u8(c, quote), vceqq_u8(c, backslash)));
+    if (vmaxvq_u8(match) != 0) break;  // Locate the match below.
+  }
+#endif
+  while (i < length && DoNotEscape(chars[i])) i++;
+  return i;
+}
+
+template <>
+int JsonStringifier::DoNotEscapeRunLength(const uint16_t* chars, int length) {
+  int i = 0;
+  // Surrogates are masked to 0xD800 when they need escaping; otherwise the
+  // comparison below never matches.
+  const uint16_t surrogate_mask = FLAG_harmony_json_stringify ? 0xF800 : 0;
+  const uint16_t surrogate_value = FLAG_harmony_json_stringify ? 0xD800 : 1;
+#if V8_JSON_SIMD_SSE2
+  const __m128i max_control = _mm_set1_epi16(0x1F);
+  const __m128i quote = _mm_set1_epi16('"');
+  const __m128i backslash = _mm_set1_epi16('\\');
+  const __m128i surrogate_bits =
+      _mm_set1_epi16(static_cast<int16_t>(surrogate_mask));
+  const __m128i surrogate =
+      _mm_set1_epi16(static_cast<int16_t>(surrogate_value));
+  const __m128i zero = _mm_setzero_si128();
+  for (; length - i >= 8; i += 8) {
+    __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i));
+    __m128i match =
+        _mm_or_si128(_mm_cmpeq_epi16(_mm_subs_epu16(c, max_control), zero),
+                     _mm_or_si128(_mm_cmpeq_epi16(c, quote),
+                                  _mm_cmpeq_epi16(c, backslash)));
+    match = _mm_or_si128(
+        match,
+        _mm_cmpeq_epi16(_mm_and_si128(c, surrogate_bits), surrogate));
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(match));
+    if (mask != 0) {
+      // Each 16-bit lane contributes two bits to the byte mask.
+      return i + (base::bits::CountTrailingZeros32(mask) >> 1);
+    }
+  }
+#elif V8_JSON_SIMD_NEON
+  const uint16x8_t min_printable = vdupq_n_u16(0x20);
+  const uint16x8_t quote = vdupq_n_u16('"');
+  const uint16x8_t backslash = vdupq_n_u16('\\');
+  const uint16x8_t surrogate_bits = vdupq_n_u16(surrogate_mask);
+  const uint16x8_t surrogate = vdupq_n_u16(surrogate_value);
+  for (; length - i >= 8; i += 8) {
+    uint16x8_t c = vld1q_u16(chars + i);
+    uint16x8_t match =
+        vorrq_u16(vcltq_u16(c, min_printable),
+                  vorrq_u16(vceqq_u16(c, quote), vceqq_u16(c, backslash)));
+    match = vorrq_u16(match,
+                      vceqq_u16(vandq_u16(c, surrogate_bits), surrogate));
+    if (vmaxvq_u16(match) != 0) break;  // Locate the match below.
+  }
+#endif
+  while (i < length && DoNotEscape(chars[i])) i++;
+  return i;
+}
+
 void JsonStringifier::NewLine() {
   if (gap_ == nullptr) return;
   builder_.AppendCharacter('\n');
@@ -918,3 +1080,6 @@ void JsonStringifier::SerializeString(Handle<String> object) {
 
 }  // namespace internal
 }  // namespace v8
+
+#undef V8_JSON_SIMD_SSE2
+#undef V8_JSON_SIMD_NEON
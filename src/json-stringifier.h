@@ -14,6 +14,11 @@ V8_WARN_UNUSED_RESULT MaybeHandle<Object> JsonStringify(Isolate* isolate,
                                                         Handle<Object> object,
                                                         Handle<Object> replacer,
                                                         Handle<Object> gap);
+
+// Writes {json}, usually the result of JsonStringify, to {sink} as UTF-8. The
+// parts of a cons string are visited directly instead of flattening it.
+void JsonWriteUtf8(Handle<String> json, v8::JSON::OutputSink* sink);
+
 }  // namespace internal
 }  // namespace v8
 
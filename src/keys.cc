@@ -14,6 +14,7 @@
 #include "src/objects/api-callbacks.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/module-inl.h"
+#include "src/objects/prototype-info-inl.h"
 #include "src/property-descriptor.h"
 #include "src/prototype.h"
 
@@ -244,6 +245,16 @@ bool CheckAndInitalizeEmptyEnumCache(JSReceiver object) {
   DCHECK(object->IsJSObject());
   return !JSObject::cast(object)->HasEnumerableElements();
 }
+
+// The for-in keys of {object} only depend on its map and on the maps of its
+// prototypes if all of them are fast-mode objects without elements.
+bool KeysOnlyDependOnMap(JSReceiver object) {
+  Map map = object->map();
+  if (map->IsCustomElementsReceiverMap() || map->is_dictionary_map()) {
+    return false;
+  }
+  return !JSObject::cast(object)->HasEnumerableElements();
+}
 }  // namespace
 
 void FastKeyAccumulator::Prepare() {
@@ -253,15 +264,23 @@ void FastKeyAccumulator::Prepare() {
   // Fully walk the prototype chain and find the last prototype with keys.
   is_receiver_simple_enum_ = false;
   has_empty_prototype_ = true;
+  may_use_prototype_chain_cache_ = is_for_in_ &&
+                                   filter_ == ENUMERABLE_STRINGS &&
+                                   KeysOnlyDependOnMap(*receiver_);
   JSReceiver last_prototype;
   for (PrototypeIterator iter(isolate_, *receiver_); !iter.IsAtEnd();
        iter.Advance()) {
     JSReceiver current = iter.GetCurrent<JSReceiver>();
+    if (!KeysOnlyDependOnMap(current) || !current->map()->is_prototype_map()) {
+      may_use_prototype_chain_cache_ = false;
+    }
     bool has_no_properties = CheckAndInitalizeEmptyEnumCache(current);
     if (has_no_properties) continue;
     last_prototype = current;
     has_empty_prototype_ = false;
   }
+  // Receivers with empty prototypes are handled by the enum cache.
+  if (has_empty_prototype_) may_use_prototype_chain_cache_ = false;
   if (has_empty_prototype_) {
     is_receiver_simple_enum_ =
         receiver_->map()->EnumLength() != kInvalidEnumCacheSentinel &&
@@ -399,6 +418,12 @@ MaybeHandle<FixedArray> FastKeyAccumulator::GetKeys(
     if (isolate_->has_pending_exception()) return MaybeHandle<FixedArray>();
   }
 
+  if (may_use_prototype_chain_cache_) {
+    DCHECK_EQ(GetKeysConversion::kConvertToString, keys_conversion);
+    Handle<FixedArray> keys;
+    if (GetKeysFromPrototypeChainCache().ToHandle(&keys)) return keys;
+  }
+
   return GetKeysSlow(keys_conversion);
 }
 
@@ -468,9 +493,61 @@ MaybeHandle<FixedArray> FastKeyAccumulator::GetKeysSlow(
   accumulator.set_skip_indices(skip_indices_);
   accumulator.set_last_non_empty_prototype(last_non_empty_prototype_);
 
+  Handle<Map> receiver_map(receiver_->map(), isolate_);
   MAYBE_RETURN(accumulator.CollectKeys(receiver_, receiver_),
                MaybeHandle<FixedArray>());
-  return accumulator.GetKeys(keys_conversion);
+  Handle<FixedArray> keys = accumulator.GetKeys(keys_conversion);
+  if (may_use_prototype_chain_cache_ && receiver_->map() == *receiver_map) {
+    UpdatePrototypeChainCache(receiver_map, keys);
+  }
+  return keys;
+}
+
+MaybeHandle<FixedArray> FastKeyAccumulator::GetKeysFromPrototypeChainCache() {
+  DisallowHeapAllocation no_gc;
+  Map map = receiver_->map();
+  Object* maybe_info =
+      JSObject::cast(map->prototype())->map()->prototype_info();
+  if (!maybe_info->IsPrototypeInfo()) return MaybeHandle<FixedArray>();
+  Object* cache = PrototypeInfo::cast(maybe_info)->for_in_cache();
+  if (!cache->IsWeakFixedArray()) return MaybeHandle<FixedArray>();
+  WeakFixedArray entry = WeakFixedArray::cast(cache);
+  if (entry->Get(PrototypeInfo::kForInCacheMapIndex) !=
+      HeapObjectReference::Weak(map)) {
+    return MaybeHandle<FixedArray>();
+  }
+  // Any change to the prototypes' maps invalidates the cell.
+  Cell* cell = Cell::cast(
+      entry->Get(PrototypeInfo::kForInCacheValidityCellIndex)
+          ->GetHeapObjectAssumeStrong());
+  if (cell->value() != Smi::FromInt(Map::kPrototypeChainValid)) {
+    return MaybeHandle<FixedArray>();
+  }
+  isolate_->counters()->enum_cache_hits()->Increment();
+  return handle(FixedArray::cast(entry->Get(PrototypeInfo::kForInCacheKeysIndex)
+                                     ->GetHeapObjectAssumeStrong()),
+                isolate_);
+}
+
+void FastKeyAccumulator::UpdatePrototypeChainCache(Handle<Map> receiver_map,
+                                                   Handle<FixedArray> keys) {
+  Handle<Object> cell =
+      Map::GetOrCreatePrototypeChainValidityCell(receiver_map, isolate_);
+  if (!cell->IsCell()) return;
+  Handle<JSObject> prototype(JSObject::cast(receiver_map->prototype()),
+                             isolate_);
+  Handle<PrototypeInfo> info =
+      Map::GetOrCreatePrototypeInfo(prototype, isolate_);
+  Handle<WeakFixedArray> entry =
+      isolate_->factory()->NewWeakFixedArray(PrototypeInfo::kForInCacheLength);
+  entry->Set(PrototypeInfo::kForInCacheMapIndex,
+             HeapObjectReference::Weak(*receiver_map));
+  entry->Set(PrototypeInfo::kForInCacheValidityCellIndex,
+             MaybeObject::FromObject(*cell));
+  entry->Set(PrototypeInfo::kForInCacheKeysIndex,
+             MaybeObject::FromObject(*keys));
+  info->set_for_in_cache(*entry);
+  isolate_->counters()->enum_cache_misses()->Increment();
 }
 
 namespace {
@@ -643,6 +720,27 @@ Handle<FixedArray> GetOwnEnumPropertyDictionaryKeys(Isolate* isolate,
   T::CopyEnumKeysTo(isolate, dictionary, storage, mode, accumulator);
   return storage;
 }
+
+// Dictionary-mode objects keep their enumerable keys on the property
+// dictionary, which drops them whenever an entry is added, removed or
+// reconfigured. Like the enum cache, the result must not be leaked.
+Handle<FixedArray> GetCachedOwnEnumPropertyDictionaryKeys(
+    Isolate* isolate, Handle<JSObject> object) {
+  Handle<NameDictionary> dictionary(object->property_dictionary(), isolate);
+  if (dictionary->NumberOfElements() == 0) {
+    return isolate->factory()->empty_fixed_array();
+  }
+  Object* cache = dictionary->enum_keys_cache();
+  if (cache->IsFixedArray()) {
+    isolate->counters()->enum_cache_hits()->Increment();
+    return handle(FixedArray::cast(cache), isolate);
+  }
+  isolate->counters()->enum_cache_misses()->Increment();
+  Handle<FixedArray> keys = GetOwnEnumPropertyDictionaryKeys(
+      isolate, KeyCollectionMode::kOwnOnly, nullptr, object, *dictionary);
+  dictionary->set_enum_keys_cache(*keys);
+  return keys;
+}
 }  // namespace
 
 Maybe<bool> KeyAccumulator::CollectOwnPropertyNames(Handle<JSReceiver> receiver,
@@ -779,9 +877,7 @@ Handle<FixedArray> KeyAccumulator::GetOwnEnumPropertyKeys(
         isolate, KeyCollectionMode::kOwnOnly, nullptr, object,
         JSGlobalObject::cast(*object)->global_dictionary());
   } else {
-    return GetOwnEnumPropertyDictionaryKeys(
-        isolate, KeyCollectionMode::kOwnOnly, nullptr, object,
-        object->property_dictionary());
+    return GetCachedOwnEnumPropertyDictionaryKeys(isolate, object);
   }
 }
 
@@ -154,6 +154,12 @@ class FastKeyAccumulator {
 
   MaybeHandle<FixedArray> GetOwnKeysWithUninitializedEnumCache();
 
+  // for-in keys of receivers with enumerable prototypes are cached on the
+  // PrototypeInfo of the receiver's prototype.
+  MaybeHandle<FixedArray> GetKeysFromPrototypeChainCache();
+  void UpdatePrototypeChainCache(Handle<Map> receiver_map,
+                                 Handle<FixedArray> keys);
+
   Isolate* isolate_;
   Handle<JSReceiver> receiver_;
   Handle<JSReceiver> last_non_empty_prototype_;
@@ -163,6 +169,7 @@ class FastKeyAccumulator {
   bool skip_indices_ = false;
   bool is_receiver_simple_enum_ = false;
   bool has_empty_prototype_ = false;
+  bool may_use_prototype_chain_cache_ = false;
 
   DISALLOW_COPY_AND_ASSIGN(FastKeyAccumulator);
 };
@@ -0,0 +1,156 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/libplatform/default-job.h"
+
+#include <algorithm>
+
+#include "src/base/logging.h"
+#include "src/base/template-utils.h"
+
+namespace v8 {
+namespace platform {
+
+DefaultJobState::DefaultJobState(Platform* platform,
+                                 std::unique_ptr<JobTask> job_task,
+                                 TaskPriority priority,
+                                 size_t num_worker_threads)
+    : platform_(platform),
+      job_task_(std::move(job_task)),
+      priority_(priority),
+      num_worker_threads_(std::max(num_worker_threads, size_t{1})) {}
+
+DefaultJobState::~DefaultJobState() { DCHECK_EQ(0U, active_workers_); }
+
+void DefaultJobState::NotifyConcurrencyIncrease() {
+  if (is_canceled_.load(std::memory_order_relaxed)) return;
+
+  size_t num_tasks_to_post = 0;
+  TaskPriority priority;
+  {
+    base::MutexGuard guard(&mutex_);
+    const size_t max_concurrency = CappedMaxConcurrency();
+    // Consider |pending_tasks_| to avoid posting too many tasks.
+    if (max_concurrency > (active_workers_ + pending_tasks_)) {
+      num_tasks_to_post = max_concurrency - active_workers_ - pending_tasks_;
+      pending_tasks_ += num_tasks_to_post;
+    }
+    priority = priority_;
+  }
+  PostWorkerTasks(num_tasks_to_post, priority);
+}
+
+void DefaultJobState::Join() {
+  bool can_run = false;
+  {
+    base::MutexGuard guard(&mutex_);
+    priority_ = TaskPriority::kUserBlocking;
+    // Reserve a worker for the joining thread. GetMaxConcurrency() is ignored
+    // here, but WaitForParticipationOpportunityLockRequired() waits for
+    // workers to return if necessary so we don't exceed GetMaxConcurrency().
+    num_worker_threads_ = platform_->NumberOfWorkerThreads() + 1;
+    ++active_workers_;
+    can_run = WaitForParticipationOpportunityLockRequired();
+  }
+  DefaultJobState::JobDelegate delegate(this);
+  while (can_run) {
+    job_task_->Run(&delegate);
+    base::MutexGuard guard(&mutex_);
+    can_run = WaitForParticipationOpportunityLockRequired();
+  }
+}
+
+void DefaultJobState::CancelAndWait() {
+  base::MutexGuard guard(&mutex_);
+  is_canceled_.store(true, std::memory_order_relaxed);
+  while (active_workers_ > 0) {
+    worker_released_condition_.Wait(&mutex_);
+  }
+}
+
+bool DefaultJobState::CanRunFirstTask() {
+  base::MutexGuard guard(&mutex_);
+  --pending_tasks_;
+  if (is_canceled_.load(std::memory_order_relaxed)) return false;
+  if (active_workers_ >= CappedMaxConcurrency()) return false;
+  // Acquire current worker.
+  ++active_workers_;
+  return true;
+}
+
+bool DefaultJobState::DidRunTask() {
+  size_t num_tasks_to_post = 0;
+  TaskPriority priority;
+  {
+    base::MutexGuard guard(&mutex_);
+    const size_t max_concurrency = CappedMaxConcurrency();
+    if (is_canceled_.load(std::memory_order_relaxed) ||
+        active_workers_ > max_concurrency) {
+      // Release current worker and notify.
+      --active_workers_;
+      worker_released_condition_.NotifyOne();
+      return false;
+    }
+    // Consider |pending_tasks_| to avoid posting too many tasks.
+    if (max_concurrency > active_workers_ + pending_tasks_) {
+      num_tasks_to_post = max_concurrency - active_workers_ - pending_tasks_;
+      pending_tasks_ += num_tasks_to_post;
+    }
+    priority = priority_;
+  }
+  // Post additional worker tasks to reach |max_concurrency| in the case that
+  // max concurrency increased. This is not strictly necessary, since
+  // NotifyConcurrencyIncrease() should eventually be invoked. However, some
+  // users of PostJob() batch work and tend to call NotifyConcurrencyIncrease()
+  // late. Posting here allows us to spawn new workers sooner.
+  PostWorkerTasks(num_tasks_to_post, priority);
+  return true;
+}
+
+bool DefaultJobState::WaitForParticipationOpportunityLockRequired() {
+  size_t max_concurrency = CappedMaxConcurrency();
+  while (active_workers_ > max_concurrency && active_workers_ > 1) {
+    worker_released_condition_.Wait(&mutex_);
+    max_concurrency = CappedMaxConcurrency();
+  }
+  if (active_workers_ <= max_concurrency) return true;
+  DCHECK_EQ(1U, active_workers_);
+  DCHECK_EQ(0U, max_concurrency);
+  active_workers_ = 0;
+  is_canceled_.store(true, std::memory_order_relaxed);
+  return false;
+}
+
+size_t DefaultJobState::CappedMaxConcurrency() const {
+  return std::min(job_task_->GetMaxConcurrency(), num_worker_threads_);
+}
+
+void DefaultJobState::PostWorkerTasks(size_t num_tasks,
+                                      TaskPriority priority) {
+  for (size_t i = 0; i < num_tasks; ++i) {
+    platform_->PostTaskOnWorkerThread(
+        priority,
+        base::make_unique<DefaultJobWorker>(shared_from_this(), job_task()));
+  }
+}
+
+DefaultJobHandle::DefaultJobHandle(std::shared_ptr<DefaultJobState> state)
+    : state_(std::move(state)) {
+  state_->NotifyConcurrencyIncrease();
+}
+
+DefaultJobHandle::~DefaultJobHandle() { DCHECK_EQ(nullptr, state_); }
+
+void DefaultJobHandle::Join() {
+  state_->Join();
+  state_ = nullptr;
+}
+
+void DefaultJobHandle::Cancel() {
+  state_->CancelAndWait();
+  state_ = nullptr;
+}
+
+}  // namespace platform
+}  // namespace v8
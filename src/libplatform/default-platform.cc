@@ -14,7 +14,9 @@
 #include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
 #include "src/base/sys-info.h"
+#include "src/base/template-utils.h"
 #include "src/libplatform/default-foreground-task-runner.h"
+#include "src/libplatform/default-job.h"
 #include "src/libplatform/default-worker-threads-task-runner.h"
 
 namespace v8 {
@@ -67,6 +69,13 @@ void RunIdleTasks(v8::Platform* platform, v8::Isolate* isolate,
                                                         idle_time_in_seconds);
 }
 
+std::unique_ptr<v8::JobHandle> NewDefaultJobHandle(
+    v8::Platform* platform, v8::TaskPriority priority,
+    std::unique_ptr<v8::JobTask> job_task, size_t num_worker_threads) {
+  return base::make_unique<DefaultJobHandle>(std::make_shared<DefaultJobState>(
+      platform, std::move(job_task), priority, num_worker_threads));
+}
+
 void SetTracingController(
     v8::Platform* platform,
     v8::platform::tracing::TracingController* tracing_controller) {
@@ -189,8 +198,18 @@ std::shared_ptr<TaskRunner> DefaultPlatform::GetForegroundTaskRunner(
 }
 
 void DefaultPlatform::CallOnWorkerThread(std::unique_ptr<Task> task) {
+  PostTaskOnWorkerThread(TaskPriority::kUserVisible, std::move(task));
+}
+
+void DefaultPlatform::CallBlockingTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  PostTaskOnWorkerThread(TaskPriority::kUserBlocking, std::move(task));
+}
+
+void DefaultPlatform::PostTaskOnWorkerThread(TaskPriority priority,
+                                             std::unique_ptr<Task> task) {
   EnsureBackgroundTaskRunnerInitialized();
-  worker_threads_task_runner_->PostTask(std::move(task));
+  worker_threads_task_runner_->PostTaskWithPriority(std::move(task), priority);
 }
 
 void DefaultPlatform::CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
@@ -200,6 +219,17 @@ void DefaultPlatform::CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
                                                delay_in_seconds);
 }
 
+std::unique_ptr<JobHandle> DefaultPlatform::PostJob(
+    TaskPriority priority, std::unique_ptr<JobTask> job_task) {
+  size_t num_worker_threads = NumberOfWorkerThreads();
+  // Best effort jobs must not take over all workers.
+  if (priority == TaskPriority::kBestEffort && num_worker_threads > 2) {
+    num_worker_threads = 2;
+  }
+  return NewDefaultJobHandle(this, priority, std::move(job_task),
+                             num_worker_threads);
+}
+
 void DefaultPlatform::CallOnForegroundThread(v8::Isolate* isolate, Task* task) {
   GetForegroundTaskRunner(isolate)->PostTask(std::unique_ptr<Task>(task));
 }
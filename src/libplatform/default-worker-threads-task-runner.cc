@@ -5,23 +5,21 @@
 #include "src/libplatform/default-worker-threads-task-runner.h"
 
 #include "src/base/platform/mutex.h"
-#include "src/libplatform/worker-thread.h"
+#include "src/base/template-utils.h"
 
 namespace v8 {
 namespace platform {
 
 DefaultWorkerThreadsTaskRunner::DefaultWorkerThreadsTaskRunner(
-    uint32_t thread_pool_size) {
+    uint32_t thread_pool_size)
+    : queue_(static_cast<int>(thread_pool_size)) {
   for (uint32_t i = 0; i < thread_pool_size; ++i) {
-    thread_pool_.push_back(base::make_unique<WorkerThread>(&queue_));
+    thread_pool_.push_back(
+        base::make_unique<WorkerThread>(&queue_, static_cast<int>(i)));
   }
 }
 
-// NOLINTNEXTLINE
-DefaultWorkerThreadsTaskRunner::~DefaultWorkerThreadsTaskRunner() {
-  // This destructor is needed because we have unique_ptr to the WorkerThreads,
-  // und the {WorkerThread} class is forward declared in the header file.
-}
+DefaultWorkerThreadsTaskRunner::~DefaultWorkerThreadsTaskRunner() = default;
 
 void DefaultWorkerThreadsTaskRunner::Terminate() {
   base::MutexGuard guard(&lock_);
@@ -32,14 +30,18 @@ void DefaultWorkerThreadsTaskRunner::Terminate() {
 }
 
 void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
-  base::MutexGuard guard(&lock_);
   if (terminated_) return;
   queue_.Append(std::move(task));
 }
 
+void DefaultWorkerThreadsTaskRunner::PostTaskWithPriority(
+    std::unique_ptr<Task> task, TaskPriority priority) {
+  if (terminated_) return;
+  queue_.Append(std::move(task), priority);
+}
+
 void DefaultWorkerThreadsTaskRunner::PostDelayedTask(std::unique_ptr<Task> task,
                                                      double delay_in_seconds) {
-  base::MutexGuard guard(&lock_);
   if (terminated_) return;
   if (delay_in_seconds == 0) {
     queue_.Append(std::move(task));
@@ -61,5 +63,21 @@ bool DefaultWorkerThreadsTaskRunner::IdleTasksEnabled() {
   return false;
 }
 
+DefaultWorkerThreadsTaskRunner::WorkerThread::WorkerThread(
+    WorkStealingTaskQueue* queue, int worker_id)
+    : Thread(Options("V8 DefaultWorkerThreadsTaskRunner WorkerThread")),
+      queue_(queue),
+      worker_id_(worker_id) {
+  Start();
+}
+
+DefaultWorkerThreadsTaskRunner::WorkerThread::~WorkerThread() { Join(); }
+
+void DefaultWorkerThreadsTaskRunner::WorkerThread::Run() {
+  while (std::unique_ptr<Task> task = queue_->GetNext(worker_id_)) {
+    task->Run();
+  }
+}
+
 }  // namespace platform
 }  // namespace v8
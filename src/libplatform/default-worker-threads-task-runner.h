@@ -5,15 +5,18 @@
 #ifndef V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 #define V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 
+#include <atomic>
+#include <memory>
+#include <vector>
+
 #include "include/v8-platform.h"
-#include "src/libplatform/task-queue.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
+#include "src/libplatform/work-stealing-task-queue.h"
 
 namespace v8 {
 namespace platform {
 
-class Thread;
-class WorkerThread;
-
 class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
     : public NON_EXPORTED_BASE(TaskRunner) {
  public:
@@ -33,10 +36,30 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
 
   bool IdleTasksEnabled() override;
 
+  // Posts |task| with the given |priority|. Workers always pick the highest
+  // priority task that is available.
+  void PostTaskWithPriority(std::unique_ptr<Task> task, TaskPriority priority);
+
  private:
-  bool terminated_ = false;
-  base::Mutex lock_;
-  TaskQueue queue_;
+  class WorkerThread : public base::Thread {
+   public:
+    WorkerThread(WorkStealingTaskQueue* queue, int worker_id);
+    ~WorkerThread() override;
+
+    // base::Thread implementation.
+    void Run() override;
+
+   private:
+    WorkStealingTaskQueue* queue_;
+    const int worker_id_;
+
+    DISALLOW_COPY_AND_ASSIGN(WorkerThread);
+  };
+
+  // Posting tasks does not take |lock_|, it only guards termination.
+  std::atomic<bool> terminated_{false};
+  base::Mutex lock_{"DefaultWorkerThreadsTaskRunner::lock"};
+  WorkStealingTaskQueue queue_;
   std::vector<std::unique_ptr<WorkerThread>> thread_pool_;
 };
 
@@ -4,48 +4,109 @@
 
 #include "src/libplatform/tracing/trace-buffer.h"
 
+#include <algorithm>
+
 namespace v8 {
 namespace platform {
 namespace tracing {
 
+const size_t TraceBufferRingBuffer::kMaxLanes;
+const size_t TraceBufferRingBuffer::kNoChunk;
+
 TraceBufferRingBuffer::TraceBufferRingBuffer(size_t max_chunks,
                                              TraceWriter* trace_writer)
-    : max_chunks_(max_chunks) {
+    : max_chunks_(max_chunks),
+      // With at most one lane per chunk, a lane always finds a chunk that no
+      // other lane writes to.
+      num_lanes_(std::min(max_chunks, kMaxLanes)),
+      lane_key_(base::Thread::CreateThreadLocalKey()) {
+  DCHECK_LT(0, max_chunks);
   trace_writer_.reset(trace_writer);
   chunks_.resize(max_chunks);
+  chunk_in_use_.resize(max_chunks, false);
+  lanes_.reset(new Lane[num_lanes_]);
 }
 
-TraceObject* TraceBufferRingBuffer::AddTraceEvent(uint64_t* handle) {
+TraceBufferRingBuffer::~TraceBufferRingBuffer() {
+  base::Thread::DeleteThreadLocalKey(lane_key_);
+}
+
+TraceBufferRingBuffer::Lane* TraceBufferRingBuffer::CurrentLane() {
+  int lane = base::Thread::GetThreadLocalInt(lane_key_);
+  if (lane == 0) {
+    lane = static_cast<int>(base::Relaxed_AtomicIncrement(&next_lane_, 1) %
+                            num_lanes_) +
+           1;
+    base::Thread::SetThreadLocalInt(lane_key_, lane);
+  }
+  return &lanes_[lane - 1];
+}
+
+void TraceBufferRingBuffer::ClaimChunk(Lane* lane) {
   base::MutexGuard guard(&mutex_);
-  if (is_empty_ || chunks_[chunk_index_]->IsFull()) {
-    chunk_index_ = is_empty_ ? 0 : NextChunkIndex(chunk_index_);
+  if (is_empty_) {
+    // The buffer was flushed, which released the chunks of all lanes.
+    DCHECK_EQ(kNoChunk, lane->chunk_index);
+    chunk_index_ = 0;
     is_empty_ = false;
-    auto& chunk = chunks_[chunk_index_];
-    if (chunk) {
-      chunk->Reset(current_chunk_seq_++);
-    } else {
-      chunk.reset(new TraceBufferChunk(current_chunk_seq_++));
+  } else {
+    if (lane->chunk_index != kNoChunk) {
+      chunk_in_use_[lane->chunk_index] = false;
     }
+    chunk_index_ = NextChunkIndex(chunk_index_);
   }
+  while (chunk_in_use_[chunk_index_]) {
+    chunk_index_ = NextChunkIndex(chunk_index_);
+  }
+  chunk_in_use_[chunk_index_] = true;
   auto& chunk = chunks_[chunk_index_];
+  if (chunk) {
+    chunk->Reset(current_chunk_seq_++);
+  } else {
+    chunk.reset(new TraceBufferChunk(current_chunk_seq_++));
+  }
+  lane->chunk_index = chunk_index_;
+}
+
+TraceObject* TraceBufferRingBuffer::AddTraceEvent(uint64_t* handle) {
+  Lane* lane = CurrentLane();
+  base::MutexGuard lane_guard(&lane->mutex);
+  if (lane->chunk_index == kNoChunk || chunks_[lane->chunk_index]->IsFull()) {
+    ClaimChunk(lane);
+  }
+  auto& chunk = chunks_[lane->chunk_index];
   size_t event_index;
   TraceObject* trace_object = chunk->AddTraceEvent(&event_index);
-  *handle = MakeHandle(chunk_index_, chunk->seq(), event_index);
+  *handle = MakeHandle(lane->chunk_index, chunk->seq(), event_index);
   return trace_object;
 }
 
 TraceObject* TraceBufferRingBuffer::GetEventByHandle(uint64_t handle) {
-  base::MutexGuard guard(&mutex_);
   size_t chunk_index, event_index;
   uint32_t chunk_seq;
   ExtractHandle(handle, &chunk_index, &chunk_seq, &event_index);
   if (chunk_index >= chunks_.size()) return nullptr;
+  {
+    // Events are usually looked up by the thread that added them, while the
+    // chunk is still held by its lane and cannot be recycled.
+    Lane* lane = CurrentLane();
+    base::MutexGuard lane_guard(&lane->mutex);
+    if (lane->chunk_index == chunk_index) {
+      auto& chunk = chunks_[chunk_index];
+      if (chunk->seq() != chunk_seq) return nullptr;
+      return chunk->GetEventAt(event_index);
+    }
+  }
+  base::MutexGuard guard(&mutex_);
   auto& chunk = chunks_[chunk_index];
   if (!chunk || chunk->seq() != chunk_seq) return nullptr;
   return chunk->GetEventAt(event_index);
 }
 
 bool TraceBufferRingBuffer::Flush() {
+  // Stop all lanes. The lane locks are taken before |mutex_|, like in
+  // AddTraceEvent.
+  for (size_t i = 0; i < num_lanes_; ++i) lanes_[i].mutex.Lock();
   base::MutexGuard guard(&mutex_);
   // This flushes all the traces stored in the buffer.
   if (!is_empty_) {
@@ -61,6 +122,11 @@ bool TraceBufferRingBuffer::Flush() {
   trace_writer_->Flush();
   // This resets the trace buffer.
   is_empty_ = true;
+  std::fill(chunk_in_use_.begin(), chunk_in_use_.end(), false);
+  for (size_t i = 0; i < num_lanes_; ++i) {
+    lanes_[i].chunk_index = kNoChunk;
+    lanes_[i].mutex.Unlock();
+  }
   return true;
 }
 
@@ -0,0 +1,88 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/libplatform/work-stealing-task-queue.h"
+
+#include "include/v8-platform.h"
+#include "src/base/logging.h"
+#include "src/base/template-utils.h"
+
+namespace v8 {
+namespace platform {
+
+void WorkStealingTaskQueue::WorkerDeque::Push(std::unique_ptr<Task> task) {
+  base::MutexGuard guard(&lock_);
+  tasks_.push_back(std::move(task));
+}
+
+bool WorkStealingTaskQueue::WorkerDeque::Pop(std::unique_ptr<Task>* task) {
+  base::MutexGuard guard(&lock_);
+  if (tasks_.empty()) return false;
+  *task = std::move(tasks_.front());
+  tasks_.pop_front();
+  return true;
+}
+
+WorkStealingTaskQueue::WorkStealingTaskQueue(int num_workers)
+    : num_workers_(num_workers), process_queue_semaphore_(0) {
+  DCHECK_LT(0, num_workers);
+  for (auto& deques : deques_) {
+    for (int i = 0; i < num_workers; i++) {
+      deques.push_back(base::make_unique<WorkerDeque>());
+    }
+  }
+}
+
+WorkStealingTaskQueue::~WorkStealingTaskQueue() { DCHECK(terminated_); }
+
+void WorkStealingTaskQueue::Append(std::unique_ptr<Task> task,
+                                   TaskPriority priority) {
+  // Tasks that race with termination are dropped, just like tasks posted
+  // after termination.
+  if (terminated_) return;
+  // Picking the deque only requires an atomic increment, so producers only
+  // contend on the lock of the deque they push to.
+  const int index = static_cast<int>(
+      next_deque_.fetch_add(1, std::memory_order_relaxed) % num_workers_);
+  deque(priority, index)->Push(std::move(task));
+  process_queue_semaphore_.Signal();
+}
+
+bool WorkStealingTaskQueue::TryPop(int worker_id, std::unique_ptr<Task>* task) {
+  for (int priority = kNumPriorities - 1; priority >= 0; priority--) {
+    for (int i = 0; i < num_workers_; i++) {
+      WorkerDeque* candidate = deque(static_cast<TaskPriority>(priority),
+                                     (worker_id + i) % num_workers_);
+      if (candidate->Pop(task)) return true;
+    }
+  }
+  return false;
+}
+
+std::unique_ptr<Task> WorkStealingTaskQueue::GetNext(int worker_id) {
+  DCHECK_LE(0, worker_id);
+  DCHECK_LT(worker_id, num_workers());
+  process_queue_semaphore_.Wait();
+  for (;;) {
+    std::unique_ptr<Task> task;
+    if (TryPop(worker_id, &task)) return task;
+    if (terminated_) {
+      // Wake up the next waiting worker so that it can terminate as well.
+      process_queue_semaphore_.Signal();
+      return nullptr;
+    }
+    // Every signal corresponds to a task that has been pushed before. Other
+    // workers may have taken the tasks we passed while scanning, which
+    // guarantees that a task is left for us and we simply rescan.
+  }
+}
+
+void WorkStealingTaskQueue::Terminate() {
+  DCHECK(!terminated_);
+  terminated_ = true;
+  process_queue_semaphore_.Signal();
+}
+
+}  // namespace platform
+}  // namespace v8
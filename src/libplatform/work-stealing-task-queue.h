@@ -0,0 +1,82 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_LIBPLATFORM_WORK_STEALING_TASK_QUEUE_H_
+#define V8_LIBPLATFORM_WORK_STEALING_TASK_QUEUE_H_
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "include/libplatform/libplatform-export.h"
+#include "include/v8-platform.h"
+#include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/semaphore.h"
+
+namespace v8 {
+namespace platform {
+
+// A task queue consisting of one deque per worker and priority. Tasks are
+// distributed round-robin over the deques so that concurrent producers do not
+// serialize on a single lock. Workers always pick the highest priority task
+// available, first from their own deque and then by stealing from the other
+// deques.
+class V8_PLATFORM_EXPORT WorkStealingTaskQueue {
+ public:
+  explicit WorkStealingTaskQueue(int num_workers);
+  ~WorkStealingTaskQueue();
+
+  // Appends a task to one of the worker deques of |priority|. The queue takes
+  // ownership of |task|. Tasks appended after termination are dropped.
+  void Append(std::unique_ptr<Task> task,
+              TaskPriority priority = TaskPriority::kUserVisible);
+
+  // Returns the next task to process for the worker with index |worker_id|.
+  // Blocks if no task is available. Returns nullptr if the queue is
+  // terminated and no tasks are left.
+  std::unique_ptr<Task> GetNext(int worker_id);
+
+  // Terminate the queue.
+  void Terminate();
+
+  int num_workers() const { return num_workers_; }
+
+ private:
+  class WorkerDeque {
+   public:
+    void Push(std::unique_ptr<Task> task);
+    bool Pop(std::unique_ptr<Task>* task);
+
+   private:
+    base::Mutex lock_;
+    std::deque<std::unique_ptr<Task>> tasks_;
+  };
+
+  static const int kNumPriorities =
+      static_cast<int>(TaskPriority::kUserBlocking) + 1;
+
+  // Takes the highest priority task from the deques of |worker_id| or steals
+  // one from any other deque. Returns false if all deques are empty.
+  bool TryPop(int worker_id, std::unique_ptr<Task>* task);
+
+  WorkerDeque* deque(TaskPriority priority, int worker_id) {
+    return deques_[static_cast<int>(priority)][worker_id].get();
+  }
+
+  const int num_workers_;
+  // Counts the tasks that are available to workers.
+  base::Semaphore process_queue_semaphore_;
+  std::vector<std::unique_ptr<WorkerDeque>> deques_[kNumPriorities];
+  std::atomic<unsigned> next_deque_{0};
+  std::atomic<bool> terminated_{false};
+
+  DISALLOW_COPY_AND_ASSIGN(WorkStealingTaskQueue);
+};
+
+}  // namespace platform
+}  // namespace v8
+
+#endif  // V8_LIBPLATFORM_WORK_STEALING_TASK_QUEUE_H_
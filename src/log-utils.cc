@@ -210,6 +210,11 @@ void Log::MessageBuilder::AppendRawCharacter(char c) { log_->os_ << c; }
 
 void Log::MessageBuilder::WriteToLogFile() { log_->os_ << std::endl; }
 
+void Log::MessageBuilder::WriteBinaryRecord(const char* bytes, size_t size) {
+  DCHECK_EQ('\0', bytes[0]);
+  log_->WriteToFile(bytes, static_cast<int>(size));
+}
+
 template <>
 Log::MessageBuilder& Log::MessageBuilder::operator<<<const char*>(
     const char* string) {
@@ -85,6 +85,11 @@ class Log {
     // Finish the current log line an flush the it to the log file.
     void WriteToLogFile();
 
+    // Writes |size| bytes verbatim, without escaping, line termination or
+    // flushing. Used for the binary records of --log-binary-ticks, which
+    // start with a NUL byte so that decoders can tell them from text lines.
+    void WriteBinaryRecord(const char* bytes, size_t size);
+
    private:
     // Prints the format string into |log_->format_buffer_|. Returns the length
     // of the result, or kMessageBufferSize if it was truncated.
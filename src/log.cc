@@ -1617,12 +1617,69 @@ void Logger::RuntimeCallTimerEvent() {
   msg.WriteToLogFile();
 }
 
+namespace {
+
+// The fixed part of a binary tick record, see tools/decode-binary-log.py.
+// All fields are naturally aligned, so the layout has no padding.
+struct BinaryTickRecord {
+  static const uint8_t kTick = 1;
+  static const uint8_t kHasExternalCallback = 1 << 0;
+  static const uint8_t kOverflow = 1 << 1;
+
+  uint8_t marker;  // Always '\0', text lines never start with it.
+  uint8_t type;
+  uint8_t flags;
+  uint8_t state;
+  uint32_t frames_count;
+  uint64_t pc;
+  int64_t timestamp;
+  uint64_t tos_or_external_callback;
+  // Followed by |frames_count| uint64_t frame addresses.
+};
+STATIC_ASSERT(sizeof(BinaryTickRecord) == 32);
+
+}  // namespace
+
+void Logger::BinaryTickEvent(v8::TickSample* sample, bool overflow) {
+  char buffer[sizeof(BinaryTickRecord) +
+              TickSample::kMaxFramesCount * sizeof(uint64_t)];
+  BinaryTickRecord record;
+  record.marker = 0;
+  record.type = BinaryTickRecord::kTick;
+  record.flags = 0;
+  if (sample->has_external_callback) {
+    record.flags |= BinaryTickRecord::kHasExternalCallback;
+  }
+  if (overflow) record.flags |= BinaryTickRecord::kOverflow;
+  record.state = static_cast<uint8_t>(sample->state);
+  record.frames_count = sample->frames_count;
+  record.pc = reinterpret_cast<uintptr_t>(sample->pc);
+  record.timestamp = timer_.Elapsed().InMicroseconds();
+  record.tos_or_external_callback = reinterpret_cast<uintptr_t>(
+      sample->has_external_callback ? sample->external_callback_entry
+                                    : sample->tos);
+  memcpy(buffer, &record, sizeof(record));
+  size_t size = sizeof(record);
+  for (unsigned i = 0; i < sample->frames_count; ++i) {
+    uint64_t frame = reinterpret_cast<uintptr_t>(sample->stack[i]);
+    memcpy(buffer + size, &frame, sizeof(frame));
+    size += sizeof(frame);
+  }
+  Log::MessageBuilder msg(log_);
+  msg.WriteBinaryRecord(buffer, size);
+}
+
 void Logger::TickEvent(v8::TickSample* sample, bool overflow) {
   if (!log_->IsEnabled() || !FLAG_prof_cpp) return;
   if (V8_UNLIKELY(FLAG_runtime_stats ==
-                  v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE)) {
+                      v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE ||
+                  RuntimeCallStats::IsCounterSamplingEnabled())) {
     RuntimeCallTimerEvent();
   }
+  if (FLAG_log_binary_ticks) {
+    BinaryTickEvent(sample, overflow);
+    return;
+  }
   Log::MessageBuilder msg(log_);
   msg << kLogEventsNames[CodeEventListener::TICK_EVENT] << kNext
       << reinterpret_cast<void*>(sample->pc) << kNext
@@ -306,6 +306,8 @@ class Logger : public CodeEventListener {
 
   // Emits a profiler tick event. Used by the profiler thread.
   void TickEvent(TickSample* sample, bool overflow);
+  // The --log-binary-ticks variant of TickEvent.
+  void BinaryTickEvent(TickSample* sample, bool overflow);
   void RuntimeCallTimerEvent();
 
   // Logs a StringEvent regardless of whether FLAG_log is true.
@@ -663,6 +663,9 @@ MapUpdater::State MapUpdater::ConstructNewMap() {
       GetKey(split_nof), split_details.kind(), split_details.attributes());
   if (!maybe_transition.is_null()) {
     maybe_transition->DeprecateTransitionTree(isolate_);
+    if (FLAG_batch_instance_migration) {
+      isolate_->heap()->ScheduleDeprecatedInstanceMigration();
+    }
   }
 
   // If |maybe_transition| is not nullptr then the transition array already
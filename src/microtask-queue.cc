@@ -6,25 +6,32 @@
 
 #include <stddef.h>
 #include <algorithm>
+#include <limits>
 
+#include "src/api-inl.h"
 #include "src/base/logging.h"
+#include "src/execution.h"
 #include "src/handles-inl.h"
 #include "src/isolate.h"
-#include "src/objects/microtask.h"
+#include "src/objects/microtask-inl.h"
 #include "src/roots-inl.h"
+#include "src/tracing/trace-event.h"
 #include "src/visitors.h"
 
 namespace v8 {
 namespace internal {
 
 const size_t MicrotaskQueue::kRingBufferOffset =
-    offsetof(MicrotaskQueue, ring_buffer_);
+    OFFSET_OF(MicrotaskQueue, ring_buffer_);
 const size_t MicrotaskQueue::kCapacityOffset =
-    offsetof(MicrotaskQueue, capacity_);
-const size_t MicrotaskQueue::kSizeOffset = offsetof(MicrotaskQueue, size_);
-const size_t MicrotaskQueue::kStartOffset = offsetof(MicrotaskQueue, start_);
+    OFFSET_OF(MicrotaskQueue, capacity_);
+const size_t MicrotaskQueue::kSizeOffset = OFFSET_OF(MicrotaskQueue, size_);
+const size_t MicrotaskQueue::kStartOffset = OFFSET_OF(MicrotaskQueue, start_);
+const size_t MicrotaskQueue::kRunCountdownOffset =
+    OFFSET_OF(MicrotaskQueue, run_countdown_);
 
 const intptr_t MicrotaskQueue::kMinimumCapacity = 8;
+const intptr_t MicrotaskQueue::kRunBudgetCheckInterval = 32;
 
 // static
 void MicrotaskQueue::SetUpDefaultMicrotaskQueue(Isolate* isolate) {
@@ -72,41 +79,153 @@ Object* MicrotaskQueue::CallEnqueueMicrotask(Isolate* isolate,
   return ReadOnlyRoots(isolate).undefined_value();
 }
 
-void MicrotaskQueue::EnqueueMicrotask(Microtask* microtask) {
-  if (size_ == capacity_) {
-    // Keep the capacity of |ring_buffer_| power of 2, so that the JIT
-    // implementation can calculate the modulo easily.
-    intptr_t new_capacity = std::max(kMinimumCapacity, capacity_ << 1);
-    ResizeBuffer(new_capacity);
+// static
+intptr_t MicrotaskQueue::CallRefillRunCountdown(
+    intptr_t microtask_queue_pointer) {
+  return reinterpret_cast<MicrotaskQueue*>(microtask_queue_pointer)
+      ->RefillRunCountdown();
+}
+
+void MicrotaskQueue::EnqueueMicrotask(v8::Isolate* v8_isolate,
+                                      v8::Local<Function> function) {
+  Isolate* isolate = reinterpret_cast<Isolate*>(v8_isolate);
+  HandleScope scope(isolate);
+  Handle<CallableTask> microtask = isolate->factory()->NewCallableTask(
+      Utils::OpenHandle(*function), isolate->native_context());
+  EnqueueMicrotask(*microtask);
+}
+
+void MicrotaskQueue::EnqueueMicrotask(v8::Isolate* v8_isolate,
+                                      v8::MicrotaskCallback callback,
+                                      void* data) {
+  EnqueueMicrotasks(v8_isolate, callback, &data, 1);
+}
+
+void MicrotaskQueue::EnqueueMicrotasks(v8::Isolate* v8_isolate,
+                                       v8::MicrotaskCallback callback,
+                                       void* const* data, size_t count) {
+  Isolate* isolate = reinterpret_cast<Isolate*>(v8_isolate);
+  HandleScope scope(isolate);
+  EnsureCapacity(size_ + static_cast<intptr_t>(count));
+  Handle<Foreign> callback_foreign =
+      isolate->factory()->NewForeign(reinterpret_cast<Address>(callback));
+  for (size_t i = 0; i < count; ++i) {
+    // Each microtask lives in the ring buffer as soon as it's allocated, so
+    // no handles are needed for the earlier ones.
+    HandleScope inner_scope(isolate);
+    Handle<CallbackTask> microtask = isolate->factory()->NewCallbackTask(
+        callback_foreign,
+        isolate->factory()->NewForeign(reinterpret_cast<Address>(data[i])));
+    EnqueueMicrotask(*microtask);
   }
+}
+
+void MicrotaskQueue::SetRunBudget(size_t max_microtasks,
+                                  double max_duration_ms) {
+  DCHECK(!is_running_microtasks_);
+  DCHECK_GE(max_duration_ms, 0);
+  max_microtasks_per_run_ = static_cast<intptr_t>(max_microtasks);
+  max_run_duration_ms_ = max_duration_ms;
+}
+
+int MicrotaskQueue::PerformCheckpoint(v8::Isolate* v8_isolate) {
+  if (is_running_microtasks_ || !size_) return 0;
+  Isolate* isolate = reinterpret_cast<Isolate*>(v8_isolate);
+
+  // Increase call depth to prevent recursive callbacks.
+  v8::Isolate::SuppressMicrotaskExecutionScope suppress(v8_isolate);
+  TRACE_EVENT0("v8.execute", "RunMicrotasks");
+  TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8", "V8.RunMicrotasks");
+
+  HandleScopeImplementer::EnteredContextRewindScope scope(
+      isolate->handle_scope_implementer());
+  is_running_microtasks_ = true;
+  int processed = RunMicrotasks(isolate);
+  is_running_microtasks_ = false;
+  // If execution is terminating, propagate that to the TryCatch scope.
+  if (processed < 0) isolate->SetTerminationOnExternalTryCatch();
+
+  isolate->heap()->ClearKeepDuringJobSet();
+  return processed;
+}
+
+void MicrotaskQueue::EnqueueMicrotask(Microtask* microtask) {
+  if (size_ == capacity_) EnsureCapacity(size_ + 1);
 
   DCHECK_LT(size_, capacity_);
   ring_buffer_[(start_ + size_) % capacity_] = microtask;
   ++size_;
 }
 
+void MicrotaskQueue::EnsureCapacity(intptr_t new_size) {
+  if (new_size <= capacity_) return;
+  // Keep the capacity of |ring_buffer_| power of 2, so that the JIT
+  // implementation can calculate the modulo easily.
+  intptr_t new_capacity = std::max(kMinimumCapacity, capacity_ << 1);
+  while (new_capacity < new_size) new_capacity <<= 1;
+  ResizeBuffer(new_capacity);
+}
+
 int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
+  if (!size_) return 0;
+
   HandleScope scope(isolate);
   MaybeHandle<Object> maybe_exception;
 
-  // TODO(tzik): Execution::RunMicrotasks() runs default_microtask_queue.
-  // Give it as a parameter to support non-default MicrotaskQueue.
-  DCHECK_EQ(this, isolate->default_microtask_queue());
+  // The RunMicrotasks builtin drains the queue that the isolate currently
+  // points it to.
+  MicrotaskQueue* outer_queue = isolate->running_microtask_queue();
+  isolate->set_running_microtask_queue(this);
+  run_granted_ = 0;
+  run_countdown_ = 0;
+  run_start_ = base::TimeTicks::HighResolutionNow();
+  RefillRunCountdown();
+
   MaybeHandle<Object> maybe_result = Execution::RunMicrotasks(
       isolate, Execution::MessageHandling::kReport, &maybe_exception);
 
+  isolate->set_running_microtask_queue(outer_queue);
+  intptr_t processed = run_granted_ - run_countdown_;
+  run_count_ += processed;
+  run_granted_ = 0;
+  run_countdown_ = 0;
+
   // If execution is terminating, clean up and propagate that to the caller.
   if (maybe_result.is_null() && maybe_exception.is_null()) {
     delete[] ring_buffer_;
     ring_buffer_ = nullptr;
+    dropped_count_ += size_;
     capacity_ = 0;
     size_ = 0;
     start_ = 0;
     return -1;
   }
 
-  // TODO(tzik): Return the number of microtasks run in this round.
-  return 0;
+  return static_cast<int>(processed);
+}
+
+intptr_t MicrotaskQueue::RefillRunCountdown() {
+  DCHECK_EQ(0, run_countdown_);
+  intptr_t grant = std::numeric_limits<intptr_t>::max() - run_granted_;
+  if (max_run_duration_ms_ > 0) {
+    if (run_granted_ > 0 &&
+        (base::TimeTicks::HighResolutionNow() - run_start_)
+                .InMillisecondsF() >= max_run_duration_ms_) {
+      ++budget_exhausted_count_;
+      return 0;
+    }
+    grant = kRunBudgetCheckInterval;
+  }
+  if (max_microtasks_per_run_ > 0) {
+    if (run_granted_ >= max_microtasks_per_run_) {
+      ++budget_exhausted_count_;
+      return 0;
+    }
+    grant = std::min(grant, max_microtasks_per_run_ - run_granted_);
+  }
+  run_granted_ += grant;
+  run_countdown_ = grant;
+  return grant;
 }
 
 void MicrotaskQueue::IterateMicrotasks(RootVisitor* visitor) {
@@ -8,7 +8,9 @@
 #include <stdint.h>
 #include <memory>
 
+#include "include/v8.h"
 #include "src/base/macros.h"
+#include "src/base/platform/time.h"
 
 namespace v8 {
 namespace internal {
@@ -18,22 +20,50 @@ class Microtask;
 class Object;
 class RootVisitor;
 
-class V8_EXPORT_PRIVATE MicrotaskQueue {
+class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
  public:
   static void SetUpDefaultMicrotaskQueue(Isolate* isolate);
   static std::unique_ptr<MicrotaskQueue> New(Isolate* isolate);
 
-  ~MicrotaskQueue();
+  ~MicrotaskQueue() override;
 
   static Object* CallEnqueueMicrotask(Isolate* isolate,
                                       intptr_t microtask_queue_pointer,
                                       Microtask* microtask);
 
+  // Called by the RunMicrotasks builtin once it used up |run_countdown_|.
+  // Returns the number of microtasks it may run next, or 0 if the run budget
+  // is exhausted.
+  static intptr_t CallRefillRunCountdown(intptr_t microtask_queue_pointer);
+
+  // v8::MicrotaskQueue implementation.
+  void EnqueueMicrotask(v8::Isolate* isolate,
+                        v8::Local<Function> microtask) override;
+  void EnqueueMicrotask(v8::Isolate* isolate, v8::MicrotaskCallback callback,
+                        void* data) override;
+  void EnqueueMicrotasks(v8::Isolate* isolate, v8::MicrotaskCallback callback,
+                         void* const* data, size_t count) override;
+  void SetRunBudget(size_t max_microtasks, double max_duration_ms) override;
+  int PerformCheckpoint(v8::Isolate* isolate) override;
+  size_t GetSize() const override { return static_cast<size_t>(size_); }
+  size_t GetEnqueuedCount() const override {
+    return static_cast<size_t>(run_count_ + dropped_count_ + size_);
+  }
+  size_t GetRunCount() const override {
+    return static_cast<size_t>(run_count_);
+  }
+  size_t GetBudgetExhaustedCount() const override {
+    return static_cast<size_t>(budget_exhausted_count_);
+  }
+
   void EnqueueMicrotask(Microtask* microtask);
 
-  // Returns -1 if the execution is terminating, otherwise, returns 0.
-  // TODO(tzik): Update the implementation to return the number of processed
-  // microtasks.
+  // Grows the ring buffer so that it can hold |new_size| microtasks.
+  void EnsureCapacity(intptr_t new_size);
+
+  // Runs pending microtasks until the queue is empty or the run budget is
+  // exhausted. Returns -1 if the execution is terminating, otherwise, returns
+  // the number of microtasks that ran.
   int RunMicrotasks(Isolate* isolate);
 
   // Iterate all pending Microtasks in this queue as strong roots, so that
@@ -51,12 +81,18 @@ class V8_EXPORT_PRIVATE MicrotaskQueue {
   static const size_t kCapacityOffset;
   static const size_t kSizeOffset;
   static const size_t kStartOffset;
+  static const size_t kRunCountdownOffset;
 
   static const intptr_t kMinimumCapacity;
 
+  // With a time budget, the RunMicrotasks builtin checks the elapsed time
+  // after this many microtasks.
+  static const intptr_t kRunBudgetCheckInterval;
+
  private:
   MicrotaskQueue();
   void ResizeBuffer(intptr_t new_capacity);
+  intptr_t RefillRunCountdown();
 
   // MicrotaskQueue instances form a doubly linked list loop, so that all
   // instances are reachable through |next_|.
@@ -70,6 +106,24 @@ class V8_EXPORT_PRIVATE MicrotaskQueue {
   intptr_t capacity_ = 0;
   intptr_t size_ = 0;
   intptr_t start_ = 0;
+
+  // The number of microtasks the RunMicrotasks builtin may still run before
+  // it has to call CallRefillRunCountdown(), and the number of microtasks
+  // handed out that way during the current run.
+  intptr_t run_countdown_ = 0;
+  intptr_t run_granted_ = 0;
+  base::TimeTicks run_start_;
+
+  // The run budget, see v8::MicrotaskQueue::SetRunBudget().
+  intptr_t max_microtasks_per_run_ = 0;
+  double max_run_duration_ms_ = 0;
+
+  bool is_running_microtasks_ = false;
+
+  // Statistics.
+  intptr_t run_count_ = 0;
+  intptr_t dropped_count_ = 0;
+  intptr_t budget_exhausted_count_ = 0;
 };
 
 }  // namespace internal
@@ -1413,7 +1413,8 @@ void PromiseReactionJobTask::PromiseReactionJobTaskVerify(Isolate* isolate) {
   VerifyHeapPointer(isolate, context());
   CHECK(context()->IsContext());
   VerifyHeapPointer(isolate, handler());
-  CHECK(handler()->IsUndefined(isolate) || handler()->IsCallable());
+  CHECK(handler()->IsUndefined(isolate) || handler()->IsCallable() ||
+        handler()->IsJSAsyncFunctionObject());
   VerifyHeapPointer(isolate, promise_or_capability());
   CHECK(promise_or_capability()->IsJSPromise() ||
         promise_or_capability()->IsPromiseCapability() ||
@@ -1463,10 +1464,12 @@ void PromiseReaction::PromiseReactionVerify(Isolate* isolate) {
   CHECK(next()->IsSmi() || next()->IsPromiseReaction());
   VerifyHeapPointer(isolate, reject_handler());
   CHECK(reject_handler()->IsUndefined(isolate) ||
-        reject_handler()->IsCallable());
+        reject_handler()->IsCallable() ||
+        reject_handler()->IsJSAsyncFunctionObject());
   VerifyHeapPointer(isolate, fulfill_handler());
   CHECK(fulfill_handler()->IsUndefined(isolate) ||
-        fulfill_handler()->IsCallable());
+        fulfill_handler()->IsCallable() ||
+        fulfill_handler()->IsJSAsyncFunctionObject());
   VerifyHeapPointer(isolate, promise_or_capability());
   CHECK(promise_or_capability()->IsJSPromise() ||
         promise_or_capability()->IsPromiseCapability() ||
@@ -1552,18 +1555,25 @@ void JSRegExp::JSRegExpVerify(Isolate* isolate) {
       FixedArray arr = FixedArray::cast(data());
       Object* one_byte_data = arr->get(JSRegExp::kIrregexpLatin1CodeIndex);
       // Smi : Not compiled yet (-1).
-      // Code/ByteArray: Compiled code.
+      // Code/ByteArray: Compiled code, or bytecode which has not been tiered
+      // up to native code yet.
       CHECK(
           (one_byte_data->IsSmi() &&
            Smi::ToInt(one_byte_data) == JSRegExp::kUninitializedValue) ||
-          (is_native ? one_byte_data->IsCode() : one_byte_data->IsByteArray()));
+          (is_native && one_byte_data->IsCode()) ||
+          one_byte_data->IsByteArray());
       Object* uc16_data = arr->get(JSRegExp::kIrregexpUC16CodeIndex);
       CHECK((uc16_data->IsSmi() &&
              Smi::ToInt(uc16_data) == JSRegExp::kUninitializedValue) ||
-            (is_native ? uc16_data->IsCode() : uc16_data->IsByteArray()));
+            (is_native && uc16_data->IsCode()) || uc16_data->IsByteArray());
 
       CHECK(arr->get(JSRegExp::kIrregexpCaptureCountIndex)->IsSmi());
       CHECK(arr->get(JSRegExp::kIrregexpMaxRegisterCountIndex)->IsSmi());
+      CHECK(arr->get(JSRegExp::kIrregexpTicksUntilTierUpIndex)->IsSmi());
+      Object* linear_code = arr->get(JSRegExp::kIrregexpLinearCodeIndex);
+      CHECK(linear_code->IsSmi() || linear_code->IsByteArray());
+      Object* prefix = arr->get(JSRegExp::kIrregexpLiteralPrefixIndex);
+      CHECK(prefix == Smi::kZero || prefix->IsString());
       break;
     }
     default:
@@ -1712,6 +1722,8 @@ void PrototypeInfo::PrototypeInfoVerify(Isolate* isolate) {
   } else {
     CHECK(prototype_users()->IsSmi());
   }
+  CHECK(for_in_cache()->IsWeakFixedArray() ||
+        for_in_cache()->IsUndefined(isolate));
 }
 
 void PrototypeUsers::Verify(WeakArrayList array) {
@@ -1943,6 +1955,8 @@ void FunctionTemplateRareData::FunctionTemplateRareDataVerify(
   VerifyPointer(isolate, indexed_property_handler());
   VerifyPointer(isolate, instance_template());
   VerifyPointer(isolate, access_check_info());
+  VerifyPointer(isolate, c_function());
+  VerifyPointer(isolate, c_signature());
 }
 
 void ObjectTemplateInfo::ObjectTemplateInfoVerify(Isolate* isolate) {
@@ -1712,6 +1712,7 @@ void PrototypeInfo::PrototypeInfoPrint(std::ostream& os) {  // NOLINT
   os << "\n - prototype users: " << Brief(prototype_users());
   os << "\n - registry slot: " << registry_slot();
   os << "\n - object create map: " << Brief(object_create_map());
+  os << "\n - for-in cache: " << Brief(for_in_cache());
   os << "\n - should_be_fast_map: " << should_be_fast_map();
   os << "\n";
 }
@@ -1936,6 +1937,8 @@ void FunctionTemplateRareData::FunctionTemplateRareDataPrint(
   os << "\n - instance_template: " << Brief(instance_template());
   os << "\n - instance_call_handler: " << Brief(instance_call_handler());
   os << "\n - access_check_info: " << Brief(access_check_info());
+  os << "\n - c_function: " << Brief(c_function());
+  os << "\n - c_signature: " << Brief(c_signature());
   os << "\n";
 }
 
@@ -2639,6 +2639,8 @@ Handle<String> String::SlowFlatten(Isolate* isolate, Handle<ConsString> cons,
 
   DCHECK(AllowHeapAllocation::IsAllowed());
   int length = cons->length();
+  isolate->counters()->string_flatten()->Increment();
+  isolate->counters()->string_flatten_characters()->Increment(length);
   PretenureFlag tenure = Heap::InNewSpace(*cons) ? pretenure : TENURED;
   Handle<SeqString> result;
   if (cons->IsOneByteRepresentation()) {
@@ -12508,7 +12510,12 @@ uint32_t StringHasher::GetHashField() {
     if (is_array_index_) {
       return MakeArrayIndexHash(array_index_, length_);
     }
-    return (GetHashCore(raw_running_hash_) << String::kHashShift) |
+    uint32_t running_hash = raw_running_hash_;
+    if (uses_wide_hash()) {
+      DCHECK_EQ(length_, wide_position_);
+      running_hash = FinalizeWideHash(wide_lanes_);
+    }
+    return (GetHashCore(running_hash) << String::kHashShift) |
            String::kIsNotArrayIndexMask;
   } else {
     return (length_ << String::kHashShift) | String::kIsNotArrayIndexMask;
@@ -12527,6 +12534,29 @@ uint32_t StringHasher::ComputeUtf8Hash(Vector<const char> chars, uint64_t seed,
     return HashSequentialString(chars.start(), vector_length, seed);
   }
 
+  // The hash function depends on the length, so long strings are measured
+  // before they are hashed.
+  if (vector_length >= kWideHashMinLength) {
+    int utf16_length = 0;
+    for (unibrow::Utf8Iterator it(chars); !it.Done(); ++it) utf16_length++;
+    if (utf16_length >= kWideHashMinLength) {
+      *utf16_length_out = utf16_length;
+      StringHasher hasher(utf16_length, seed);
+      if (hasher.has_trivial_hash()) return hasher.GetHashField();
+      uint16_t buffer[kWideHashMinLength];
+      int buffer_length = 0;
+      for (unibrow::Utf8Iterator it(chars); !it.Done(); ++it) {
+        buffer[buffer_length++] = *it;
+        if (buffer_length == kWideHashMinLength) {
+          hasher.AddCharacters(buffer, buffer_length);
+          buffer_length = 0;
+        }
+      }
+      hasher.AddCharacters(buffer, buffer_length);
+      return hasher.GetHashField();
+    }
+  }
+
   // Start with a fake length which won't affect computation.
   // It will be updated later.
   StringHasher hasher(String::kMaxArrayIndexSize, seed);
@@ -12713,7 +12743,9 @@ void JSFunction::EnsureFeedbackVector(Handle<JSFunction> function) {
       Handle<FeedbackVector> feedback_vector =
           FeedbackVector::New(isolate, shared);
       if (function->raw_feedback_cell() ==
-          isolate->heap()->many_closures_cell()) {
+              isolate->heap()->many_closures_cell() ||
+          function->raw_feedback_cell() ==
+              isolate->heap()->no_feedback_cell()) {
         Handle<FeedbackCell> feedback_cell =
             isolate->factory()->NewOneClosureCell(feedback_vector);
         function->set_raw_feedback_cell(*feedback_cell);
@@ -12724,6 +12756,36 @@ void JSFunction::EnsureFeedbackVector(Handle<JSFunction> function) {
   }
 }
 
+// static
+void JSFunction::InitializeFeedbackVector(Handle<JSFunction> function) {
+  Isolate* const isolate = function->GetIsolate();
+  // Code coverage and type profiles are collected in the feedback vector, and
+  // --always-opt needs it right away to optimize the function.
+  bool needs_feedback_vector = !FLAG_lazy_feedback_allocation ||
+                               FLAG_always_opt ||
+                               !isolate->is_best_effort_code_coverage() ||
+                               isolate->is_collecting_type_profile();
+  if (needs_feedback_vector || function->shared()->HasAsmWasmData()) {
+    EnsureFeedbackVector(function);
+    return;
+  }
+  if (function->has_feedback_vector()) return;
+
+  // The interpreter and the ICs run without feedback until the function has
+  // used up an interrupt budget of a few times its bytecode length, either
+  // by returning (roughly once per invocation) or by looping. At that point
+  // the RuntimeProfiler allocates the feedback vector. Functions that run
+  // only once, like most top-level and module initialization code, never get
+  // one.
+  BytecodeArray bytecode_array = function->shared()->GetBytecodeArray();
+  int64_t budget =
+      static_cast<int64_t>(bytecode_array->length()) *
+      std::max(FLAG_invocations_for_feedback_vector_allocation, 1);
+  if (budget < bytecode_array->interrupt_budget()) {
+    bytecode_array->set_interrupt_budget(static_cast<int>(budget));
+  }
+}
+
 static void GetMinInobjectSlack(Map map, void* data) {
   int slack = map->UnusedPropertyFields();
   if (*reinterpret_cast<int*>(data) > slack) {
@@ -15388,7 +15450,15 @@ void BytecodeArray::MakeOlder() {
 }
 
 bool BytecodeArray::IsOld() const {
-  return bytecode_age() >= kIsOldBytecodeAge;
+  return bytecode_age() >= OldBytecodeAge();
+}
+
+// static
+BytecodeArray::Age BytecodeArray::OldBytecodeAge() {
+  int age = std::max(static_cast<int>(kQuadragenarianBytecodeAge),
+                     std::min(FLAG_bytecode_old_age,
+                              static_cast<int>(kLastBytecodeAge)));
+  return static_cast<Age>(age);
 }
 
 // static
@@ -17244,8 +17314,8 @@ MaybeHandle<String> StringTable::LookupTwoCharsStringIfExists(
   return result;
 }
 
-void StringTable::EnsureCapacityForDeserialization(Isolate* isolate,
-                                                   int expected) {
+void StringTable::EnsureCapacityForBulkInsertion(Isolate* isolate,
+                                                 int expected) {
   Handle<StringTable> table = isolate->factory()->string_table();
   // We need a key instance for the virtual hash function.
   table = StringTable::EnsureCapacity(isolate, table, expected);
@@ -17754,6 +17824,8 @@ MaybeHandle<SharedFunctionInfo> CompilationCacheTable::LookupScript(
   }
   Object* obj = table->get(index + 1);
   if (obj->IsSharedFunctionInfo()) {
+    // Mark the entry as most recently used.
+    table->set(index + 2, Smi::zero());
     return handle(SharedFunctionInfo::cast(obj), native_context->GetIsolate());
   }
   return MaybeHandle<SharedFunctionInfo>();
@@ -17808,6 +17880,7 @@ Handle<CompilationCacheTable> CompilationCacheTable::PutScript(
   int entry = cache->FindInsertionEntry(key.Hash());
   cache->set(EntryToIndex(entry), *k);
   cache->set(EntryToIndex(entry) + 1, *value);
+  cache->set(EntryToIndex(entry) + 2, Smi::zero());
   cache->ElementAdded();
   return cache;
 }
@@ -17863,6 +17936,8 @@ Handle<CompilationCacheTable> CompilationCacheTable::PutRegExp(
 void CompilationCacheTable::Age() {
   DisallowHeapAllocation no_allocation;
   Object* the_hole_value = GetReadOnlyRoots().the_hole_value();
+  // Script entries as (GCs since last use, entry) pairs.
+  std::vector<std::pair<int, int>> scripts;
   for (int entry = 0, size = Capacity(); entry < size; entry++) {
     int entry_index = EntryToIndex(entry);
     int value_index = entry_index + 1;
@@ -17878,14 +17953,51 @@ void CompilationCacheTable::Age() {
         NoWriteBarrierSet(*this, value_index, count);
       }
     } else if (get(entry_index)->IsFixedArray()) {
-      SharedFunctionInfo info = SharedFunctionInfo::cast(get(value_index));
-      if (info->IsInterpreted() && info->GetBytecodeArray()->IsOld()) {
-        for (int i = 0; i < kEntrySize; i++) {
-          NoWriteBarrierSet(*this, entry_index + i, the_hole_value);
-        }
-        ElementRemoved();
+      // Only script entries keep their last use in the third slot.
+      if (FLAG_compilation_cache_script_budget > 0 &&
+          get(entry_index + 2)->IsSmi()) {
+        int last_use = Smi::ToInt(get(entry_index + 2)) + 1;
+        NoWriteBarrierSet(*this, entry_index + 2, Smi::FromInt(last_use));
+        scripts.push_back(std::make_pair(last_use, entry));
+        continue;
+      }
+      RemoveIfOld(entry);
+    }
+  }
+
+  // Keep the bytecode of the most recently used scripts young as long as
+  // they fit into the budget, so that they survive bytecode flushing and
+  // aging. Entries beyond the budget are evicted once their bytecode is old.
+  std::stable_sort(scripts.begin(), scripts.end());
+  size_t budget =
+      static_cast<size_t>(FLAG_compilation_cache_script_budget) * KB;
+  size_t used = 0;
+  for (const std::pair<int, int>& script : scripts) {
+    int entry_index = EntryToIndex(script.second);
+    SharedFunctionInfo info = SharedFunctionInfo::cast(get(entry_index + 1));
+    if (used < budget && info->HasBytecodeArray()) {
+      BytecodeArray bytecode = info->GetBytecodeArray();
+      FixedArray key = FixedArray::cast(get(entry_index));
+      used += bytecode->Size() + String::cast(key->get(1))->Size();
+      if (used <= budget) {
+        bytecode->set_bytecode_age(BytecodeArray::kNoAgeBytecodeAge);
+        continue;
       }
     }
+    RemoveIfOld(script.second);
+  }
+}
+
+void CompilationCacheTable::RemoveIfOld(int entry) {
+  DisallowHeapAllocation no_allocation;
+  int entry_index = EntryToIndex(entry);
+  SharedFunctionInfo info = SharedFunctionInfo::cast(get(entry_index + 1));
+  if (info->IsInterpreted() && info->GetBytecodeArray()->IsOld()) {
+    Object* the_hole_value = GetReadOnlyRoots().the_hole_value();
+    for (int i = 0; i < kEntrySize; i++) {
+      NoWriteBarrierSet(*this, entry_index + i, the_hole_value);
+    }
+    ElementRemoved();
   }
 }
 
@@ -19,6 +19,9 @@
 
 #include "src/objects/bigint.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "src/double.h"
 #include "src/objects-inl.h"
 #include "src/objects/smi.h"
@@ -131,6 +134,56 @@ class MutableBigInt : public FreshlyAllocatedBigInt {
                                Handle<MutableBigInt>* remainder);
   static bool ProductGreaterThan(digit_t factor1, digit_t factor2, digit_t high,
                                  digit_t low);
+
+  // Asymptotically faster algorithms for large inputs, operating on raw
+  // digit arrays. Below these lengths (in digits), the simple algorithms are
+  // faster.
+  static const int kKaratsubaThreshold = 34;
+  static const int kBurnikelThreshold = 57;
+  static const int kToStringFastThreshold = 43;
+  static int CompareDigits(const digit_t* x, int x_length, const digit_t* y,
+                           int y_length);
+  static digit_t AddDigits(digit_t* z, int z_length, const digit_t* x,
+                           int x_length);
+  static digit_t SubDigits(digit_t* z, int z_length, const digit_t* x,
+                           int x_length);
+  static bool AbsoluteDifferenceDigits(digit_t* z, const digit_t* x,
+                                       int x_length, const digit_t* y,
+                                       int y_length);
+  static digit_t LeftShiftDigits(digit_t* z, const digit_t* x, int length,
+                                 int shift);
+  static void RightShiftDigits(digit_t* z, const digit_t* x, int length,
+                               int shift);
+  static void MultiplySchoolbook(digit_t* z, const digit_t* x, int x_length,
+                                 const digit_t* y, int y_length);
+  static void MultiplyKaratsuba(digit_t* z, const digit_t* x, const digit_t* y,
+                                int n);
+  static void MultiplyDigits(digit_t* z, const digit_t* x, int x_length,
+                             const digit_t* y, int y_length);
+  static void DivideSchoolbook(digit_t* q, digit_t* r, const digit_t* a,
+                               int a_length, const digit_t* b, int b_length);
+  static void DivideTwoDigitsByOne(digit_t* q, digit_t* r, const digit_t* a,
+                                   const digit_t* b, int n);
+  static void DivideThreeHalvesByTwo(digit_t* q, digit_t* r, const digit_t* a,
+                                     const digit_t* b, int half);
+  static void DivideBurnikelZiegler(digit_t* q, digit_t* r, const digit_t* a,
+                                    int a_length, const digit_t* b,
+                                    int b_length);
+  static void DivideDigits(digit_t* q, digit_t* r, const digit_t* a,
+                           int a_length, const digit_t* b, int b_length);
+  static void ToStringBaseCase(uint8_t* end, const digit_t* x, int x_length,
+                               int width, int radix, int chunk_chars,
+                               digit_t chunk_divisor);
+  static void ToStringDivideAndConquer(
+      uint8_t* end, const digit_t* x, int x_length, int level,
+      const std::vector<std::vector<digit_t>>& powers, int radix,
+      int chunk_chars);
+  static void ToStringLarge(const digit_t* x, int x_length, int radix,
+                            std::vector<uint8_t>* result);
+  static void CopyDigits(BigIntBase x, std::vector<digit_t>* digits) {
+    digits->resize(x->length());
+    for (int i = 0; i < x->length(); i++) (*digits)[i] = x->digit(i);
+  }
   digit_t InplaceAdd(Handle<BigIntBase> summand, int start_index);
   digit_t InplaceSub(Handle<BigIntBase> subtrahend, int start_index);
   void InplaceRightShift(int shift);
@@ -478,9 +531,20 @@ MaybeHandle<BigInt> BigInt::Multiply(Isolate* isolate, Handle<BigInt> x,
   if (!MutableBigInt::New(isolate, result_length).ToHandle(&result)) {
     return MaybeHandle<BigInt>();
   }
-  result->InitializeDigits(result_length);
-  for (int i = 0; i < x->length(); i++) {
-    MutableBigInt::MultiplyAccumulate(y, x->digit(i), result, i);
+  if (x->length() < MutableBigInt::kKaratsubaThreshold ||
+      y->length() < MutableBigInt::kKaratsubaThreshold) {
+    result->InitializeDigits(result_length);
+    for (int i = 0; i < x->length(); i++) {
+      MutableBigInt::MultiplyAccumulate(y, x->digit(i), result, i);
+    }
+  } else {
+    std::vector<digit_t> x_digits, y_digits;
+    MutableBigInt::CopyDigits(*x, &x_digits);
+    MutableBigInt::CopyDigits(*y, &y_digits);
+    std::vector<digit_t> product(result_length);
+    MutableBigInt::MultiplyDigits(product.data(), x_digits.data(),
+                                  x->length(), y_digits.data(), y->length());
+    for (int i = 0; i < result_length; i++) result->set_digit(i, product[i]);
   }
   result->set_sign(x->sign() != y->sign());
   return MutableBigInt::MakeImmutable(result);
@@ -1495,6 +1559,29 @@ bool MutableBigInt::AbsoluteDivLarge(Isolate* isolate,
   int n = divisor->length();
   int m = dividend->length() - n;
 
+  if (n >= kBurnikelThreshold && m >= kBurnikelThreshold) {
+    std::vector<digit_t> a, b;
+    CopyDigits(*dividend, &a);
+    CopyDigits(*divisor, &b);
+    std::vector<digit_t> q_digits(m + 1), r_digits(n);
+    DivideBurnikelZiegler(quotient != nullptr ? q_digits.data() : nullptr,
+                          remainder != nullptr ? r_digits.data() : nullptr,
+                          a.data(), m + n, b.data(), n);
+    if (quotient != nullptr) {
+      Handle<MutableBigInt> q;
+      if (!New(isolate, m + 1).ToHandle(&q)) return false;
+      for (int i = 0; i <= m; i++) q->set_digit(i, q_digits[i]);
+      *quotient = q;  // Caller will right-trim.
+    }
+    if (remainder != nullptr) {
+      Handle<MutableBigInt> r;
+      if (!New(isolate, n).ToHandle(&r)) return false;
+      for (int i = 0; i < n; i++) r->set_digit(i, r_digits[i]);
+      *remainder = r;
+    }
+    return true;
+  }
+
   // The quotient to be computed.
   Handle<MutableBigInt> q;
   if (quotient != nullptr) q = New(isolate, m + 1).ToHandleChecked();
@@ -1674,6 +1761,415 @@ MaybeHandle<MutableBigInt> MutableBigInt::SpecialLeftShift(
   return result;
 }
 
+// The following helpers operate on raw little-endian digit arrays instead of
+// BigInt objects. They are used for the asymptotically faster algorithms
+// below, which need many temporary values of varying sizes; those are kept
+// off the V8 heap so that no allocation can fail or cause a GC.
+
+// Compares {x} and {y}, either of which may have leading zero digits.
+int MutableBigInt::CompareDigits(const digit_t* x, int x_length,
+                                 const digit_t* y, int y_length) {
+  while (x_length > y_length) {
+    if (x[--x_length] != 0) return 1;
+  }
+  while (y_length > x_length) {
+    if (y[--y_length] != 0) return -1;
+  }
+  for (int i = x_length - 1; i >= 0; i--) {
+    if (x[i] != y[i]) return x[i] > y[i] ? 1 : -1;
+  }
+  return 0;
+}
+
+// Adds {x} onto {z}, propagating the carry through all of {z}'s digits.
+// Returns the carry out of {z}'s most significant digit.
+BigInt::digit_t MutableBigInt::AddDigits(digit_t* z, int z_length,
+                                         const digit_t* x, int x_length) {
+  DCHECK_GE(z_length, x_length);
+  digit_t carry = 0;
+  int i = 0;
+  for (; i < x_length; i++) {
+    digit_t new_carry = 0;
+    digit_t sum = digit_add(z[i], x[i], &new_carry);
+    z[i] = digit_add(sum, carry, &new_carry);
+    carry = new_carry;
+  }
+  for (; carry != 0 && i < z_length; i++) {
+    digit_t new_carry = 0;
+    z[i] = digit_add(z[i], carry, &new_carry);
+    carry = new_carry;
+  }
+  return carry;
+}
+
+// Subtracts {x} from {z}, propagating the borrow through all of {z}'s
+// digits. Returns the borrow out of {z}'s most significant digit.
+BigInt::digit_t MutableBigInt::SubDigits(digit_t* z, int z_length,
+                                         const digit_t* x, int x_length) {
+  DCHECK_GE(z_length, x_length);
+  digit_t borrow = 0;
+  int i = 0;
+  for (; i < x_length; i++) {
+    digit_t new_borrow = 0;
+    digit_t difference = digit_sub(z[i], x[i], &new_borrow);
+    z[i] = digit_sub(difference, borrow, &new_borrow);
+    borrow = new_borrow;
+  }
+  for (; borrow != 0 && i < z_length; i++) {
+    digit_t new_borrow = 0;
+    z[i] = digit_sub(z[i], borrow, &new_borrow);
+    borrow = new_borrow;
+  }
+  return borrow;
+}
+
+// Computes z := |x - y|, where {z} has {x_length} digits and
+// {x_length} >= {y_length}. Returns whether x < y.
+bool MutableBigInt::AbsoluteDifferenceDigits(digit_t* z, const digit_t* x,
+                                             int x_length, const digit_t* y,
+                                             int y_length) {
+  DCHECK_GE(x_length, y_length);
+  bool negative = CompareDigits(x, x_length, y, y_length) < 0;
+  if (!negative) {
+    std::copy(x, x + x_length, z);
+    SubDigits(z, x_length, y, y_length);
+  } else {
+    std::copy(y, y + y_length, z);
+    std::fill(z + y_length, z + x_length, 0);
+    SubDigits(z, x_length, x, x_length);
+  }
+  return negative;
+}
+
+// Computes z := x << shift, where {z} has {length} digits like {x} and
+// {shift} is less than kDigitBits. Returns the digit shifted out at the top.
+// {z} may alias {x}.
+BigInt::digit_t MutableBigInt::LeftShiftDigits(digit_t* z, const digit_t* x,
+                                               int length, int shift) {
+  DCHECK_LT(shift, kDigitBits);
+  if (shift == 0) {
+    std::copy(x, x + length, z);
+    return 0;
+  }
+  digit_t carry = 0;
+  for (int i = 0; i < length; i++) {
+    digit_t d = x[i];
+    z[i] = (d << shift) | carry;
+    carry = d >> (kDigitBits - shift);
+  }
+  return carry;
+}
+
+// Computes z := x >> shift, where {z} has {length} digits like {x} and
+// {shift} is less than kDigitBits. {z} may alias {x}.
+void MutableBigInt::RightShiftDigits(digit_t* z, const digit_t* x, int length,
+                                     int shift) {
+  DCHECK_LT(shift, kDigitBits);
+  if (shift == 0) {
+    std::copy(x, x + length, z);
+    return;
+  }
+  for (int i = 0; i < length - 1; i++) {
+    z[i] = (x[i] >> shift) | (x[i + 1] << (kDigitBits - shift));
+  }
+  z[length - 1] = x[length - 1] >> shift;
+}
+
+// Computes z := x * y with the schoolbook algorithm. {z} must have
+// {x_length} + {y_length} digits and must not alias the inputs.
+void MutableBigInt::MultiplySchoolbook(digit_t* z, const digit_t* x,
+                                       int x_length, const digit_t* y,
+                                       int y_length) {
+  std::fill(z, z + x_length + y_length, 0);
+  for (int i = 0; i < x_length; i++) {
+    digit_t factor = x[i];
+    digit_t carry = 0;
+    if (factor != 0) {
+      for (int j = 0; j < y_length; j++) {
+        digit_t high;
+        digit_t low = digit_mul(factor, y[j], &high);
+        digit_t new_carry = 0;
+        digit_t sum = digit_add(z[i + j], low, &new_carry);
+        z[i + j] = digit_add(sum, carry, &new_carry);
+        // The full product plus both summands always fits into two digits.
+        carry = high + new_carry;
+      }
+    }
+    z[i + y_length] = carry;
+  }
+}
+
+// Computes z := x * y for two factors of {n} digits each with Karatsuba's
+// algorithm, which needs three half-sized multiplications instead of four:
+// for x = x1 * B + x0 and y = y1 * B + y0,
+// x * y = x1 * y1 * B^2 + (x1 * y1 + x0 * y0 - (x0 - x1) * (y0 - y1)) * B +
+//         x0 * y0.
+// {z} must have 2 * {n} digits and must not alias the inputs.
+void MutableBigInt::MultiplyKaratsuba(digit_t* z, const digit_t* x,
+                                      const digit_t* y, int n) {
+  if (n < kKaratsubaThreshold) {
+    MultiplySchoolbook(z, x, n, y, n);
+    return;
+  }
+  int low_length = (n + 1) / 2;
+  int high_length = n - low_length;
+  // x0 * y0 and x1 * y1 go straight into the low and high halves of {z}.
+  MultiplyKaratsuba(z, x, y, low_length);
+  MultiplyKaratsuba(z + 2 * low_length, x + low_length, y + low_length,
+                    high_length);
+  std::vector<digit_t> scratch(6 * low_length + 1);
+  digit_t* x_difference = scratch.data();
+  digit_t* y_difference = x_difference + low_length;
+  digit_t* product = y_difference + low_length;
+  digit_t* middle = product + 2 * low_length;
+  bool x_negative = AbsoluteDifferenceDigits(x_difference, x, low_length,
+                                             x + low_length, high_length);
+  bool y_negative = AbsoluteDifferenceDigits(y_difference, y, low_length,
+                                             y + low_length, high_length);
+  MultiplyKaratsuba(product, x_difference, y_difference, low_length);
+  // middle := x0 * y0 + x1 * y1 -/+ |x0 - x1| * |y0 - y1|, which is never
+  // negative.
+  int middle_length = 2 * low_length + 1;
+  std::copy(z, z + 2 * low_length, middle);
+  middle[2 * low_length] = 0;
+  AddDigits(middle, middle_length, z + 2 * low_length, 2 * high_length);
+  if (x_negative == y_negative) {
+    SubDigits(middle, middle_length, product, 2 * low_length);
+  } else {
+    AddDigits(middle, middle_length, product, 2 * low_length);
+  }
+  int z_length = 2 * n - low_length;
+  DCHECK_GE(z_length, middle_length);
+  digit_t carry = AddDigits(z + low_length, z_length, middle, middle_length);
+  USE(carry);
+  DCHECK_EQ(carry, 0);
+}
+
+// Computes z := x * y, picking an algorithm based on the factors' lengths.
+// {z} must have {x_length} + {y_length} digits and must not alias the inputs.
+void MutableBigInt::MultiplyDigits(digit_t* z, const digit_t* x, int x_length,
+                                   const digit_t* y, int y_length) {
+  if (x_length < y_length) {
+    std::swap(x, y);
+    std::swap(x_length, y_length);
+  }
+  if (y_length < kKaratsubaThreshold) {
+    MultiplySchoolbook(z, x, x_length, y, y_length);
+    return;
+  }
+  if (x_length == y_length) {
+    MultiplyKaratsuba(z, x, y, x_length);
+    return;
+  }
+  // Karatsuba needs factors of equal length, so multiply {y} with {x} in
+  // chunks of {y_length} digits and add up the partial products.
+  int z_length = x_length + y_length;
+  std::fill(z, z + z_length, 0);
+  std::vector<digit_t> product(2 * y_length);
+  for (int i = 0; i < x_length; i += y_length) {
+    int chunk_length = std::min(y_length, x_length - i);
+    MultiplyDigits(product.data(), x + i, chunk_length, y, y_length);
+    AddDigits(z + i, z_length - i, product.data(), chunk_length + y_length);
+  }
+}
+
+// Computes q := a / b and r := a % b with Knuth's Algorithm D, like
+// AbsoluteDivLarge. {q} must have {a_length} - {b_length} + 1 digits, {r}
+// must have {b_length} digits; either may be nullptr. {b} must not have a
+// leading zero digit, and {a_length} must be at least {b_length}.
+void MutableBigInt::DivideSchoolbook(digit_t* q, digit_t* r, const digit_t* a,
+                                     int a_length, const digit_t* b,
+                                     int b_length) {
+  DCHECK_GE(a_length, b_length);
+  DCHECK_NE(b[b_length - 1], 0);
+  int n = b_length;
+  int m = a_length - n;
+  if (n == 1) {
+    digit_t remainder = 0;
+    for (int i = a_length - 1; i >= 0; i--) {
+      digit_t quotient_digit = digit_div(remainder, a[i], b[0], &remainder);
+      if (q != nullptr) q[i] = quotient_digit;
+    }
+    if (r != nullptr) r[0] = remainder;
+    return;
+  }
+  int shift = base::bits::CountLeadingZeros(b[n - 1]);
+  std::vector<digit_t> scratch(n + (a_length + 1) + (n + 1));
+  digit_t* v = scratch.data();
+  digit_t* u = v + n;
+  digit_t* qhatv = u + a_length + 1;
+  LeftShiftDigits(v, b, n, shift);
+  u[a_length] = LeftShiftDigits(u, a, a_length, shift);
+  digit_t vn1 = v[n - 1];
+  digit_t vn2 = v[n - 2];
+  for (int j = m; j >= 0; j--) {
+    // See AbsoluteDivLarge for the individual steps.
+    digit_t qhat = std::numeric_limits<digit_t>::max();
+    digit_t ujn = u[j + n];
+    if (ujn != vn1) {
+      digit_t rhat = 0;
+      qhat = digit_div(ujn, u[j + n - 1], vn1, &rhat);
+      digit_t ujn2 = u[j + n - 2];
+      while (ProductGreaterThan(qhat, vn2, rhat, ujn2)) {
+        qhat--;
+        digit_t prev_rhat = rhat;
+        rhat += vn1;
+        if (rhat < prev_rhat) break;
+      }
+    }
+    digit_t carry = 0;
+    for (int i = 0; i < n; i++) {
+      digit_t high;
+      digit_t low = digit_mul(qhat, v[i], &high);
+      digit_t new_carry = 0;
+      qhatv[i] = digit_add(low, carry, &new_carry);
+      carry = high + new_carry;
+    }
+    qhatv[n] = carry;
+    if (SubDigits(u + j, n + 1, qhatv, n + 1) != 0) {
+      AddDigits(u + j, n + 1, v, n);
+      qhat--;
+    }
+    if (q != nullptr) q[j] = qhat;
+  }
+  if (r != nullptr) RightShiftDigits(r, u, n, shift);
+}
+
+// Computes q := a / b and r := a % b for {a} of 2 * {n} digits and {b} of
+// {n} digits, where a < b * B^n and {b}'s most significant bit is set.
+// {q} and {r} have {n} digits each. See Burnikel and Ziegler, "Fast
+// Recursive Division", Algorithm 1.
+void MutableBigInt::DivideTwoDigitsByOne(digit_t* q, digit_t* r,
+                                         const digit_t* a, const digit_t* b,
+                                         int n) {
+  if (n % 2 != 0 || n < kBurnikelThreshold) {
+    std::vector<digit_t> quotient(n + 1);
+    DivideSchoolbook(quotient.data(), r, a, 2 * n, b, n);
+    DCHECK_EQ(quotient[n], 0);
+    std::copy(quotient.begin(), quotient.begin() + n, q);
+    return;
+  }
+  int half = n / 2;
+  // With a = [a1, a2, a3, a4] in half-sized digits, divide [a1, a2, a3] by
+  // {b} first, and then [r1, a4], where r1 is the first remainder.
+  std::vector<digit_t> scratch(3 * half);
+  digit_t* r1 = scratch.data() + half;
+  DivideThreeHalvesByTwo(q + half, r1, a + half, b, half);
+  std::copy(a, a + half, scratch.data());
+  DivideThreeHalvesByTwo(q, r, scratch.data(), b, half);
+}
+
+// Computes q := a / b and r := a % b for {a} of 3 * {half} digits and {b}
+// of 2 * {half} digits, where a < b * B^half and {b}'s most significant bit
+// is set. {q} has {half} digits, {r} has 2 * {half} digits. See Burnikel and
+// Ziegler, "Fast Recursive Division", Algorithm 2.
+void MutableBigInt::DivideThreeHalvesByTwo(digit_t* q, digit_t* r,
+                                           const digit_t* a, const digit_t* b,
+                                           int half) {
+  int n = 2 * half;
+  const digit_t* a1 = a + n;
+  const digit_t* b1 = b + half;
+  const digit_t* b2 = b;
+  // [r1, a3] needs one more digit than {b}, because r1 can exceed b1 when
+  // a1 == b1.
+  std::vector<digit_t> scratch(n + 1 + n);
+  digit_t* remainder = scratch.data();
+  digit_t* r1 = remainder + half;
+  digit_t* d = remainder + n + 1;
+  if (CompareDigits(a1, half, b1, half) < 0) {
+    DivideTwoDigitsByOne(q, r1, a + half, b1, half);
+  } else {
+    // Then a1 == b1, because a < b * B^half. Let q := B^half - 1, so
+    // r1 := [a1, a2] - q * b1 = [a1, a2] - [b1, 0] + b1 = a2 + b1.
+    DCHECK_EQ(CompareDigits(a1, half, b1, half), 0);
+    std::fill(q, q + half, std::numeric_limits<digit_t>::max());
+    std::copy(a + half, a + n, r1);
+    AddDigits(r1, half + 1, b1, half);
+  }
+  std::copy(a, a + half, remainder);
+  // remainder := [r1, a3] - q * b2, corrected by adding {b} while negative.
+  MultiplyDigits(d, q, half, b2, half);
+  digit_t borrow = SubDigits(remainder, n + 1, d, n);
+  while (borrow != 0) {
+    digit_t one = 1;
+    SubDigits(q, half, &one, 1);
+    if (AddDigits(remainder, n + 1, b, n) != 0) borrow = 0;
+  }
+  DCHECK_EQ(remainder[n], 0);
+  std::copy(remainder, remainder + n, r);
+}
+
+// Computes q := a / b and r := a % b for large inputs with Burnikel and
+// Ziegler's recursive division, which reduces division to multiplication.
+// Same interface as DivideSchoolbook.
+void MutableBigInt::DivideBurnikelZiegler(digit_t* q, digit_t* r,
+                                          const digit_t* a, int a_length,
+                                          const digit_t* b, int b_length) {
+  DCHECK_GE(a_length, b_length);
+  DCHECK_NE(b[b_length - 1], 0);
+  // Pad {b} to n = j * 2^k digits with j < kBurnikelThreshold, so that the
+  // recursion keeps splitting it evenly until the schoolbook base case.
+  int m = 1;
+  while (b_length / m >= kBurnikelThreshold) m *= 2;
+  int j = (b_length + m - 1) / m;
+  int n = j * m;
+  // Shift both inputs left so that the padded divisor's most significant bit
+  // is set. This doesn't change the quotient; the remainder gets shifted
+  // back at the end.
+  int shift_digits = n - b_length;
+  int shift_bits = base::bits::CountLeadingZeros(b[b_length - 1]);
+  std::vector<digit_t> divisor(n);
+  LeftShiftDigits(divisor.data() + shift_digits, b, b_length, shift_bits);
+  // Split the shifted dividend into t blocks of n digits, such that the top
+  // block has a zero top digit and is hence less than the divisor.
+  int t = std::max(2, (a_length + shift_digits + 1 + n) / n);
+  std::vector<digit_t> dividend(t * n);
+  dividend[shift_digits + a_length] = LeftShiftDigits(
+      dividend.data() + shift_digits, a, a_length, shift_bits);
+  int q_length = a_length - b_length + 1;
+  if (q != nullptr) std::fill(q, q + q_length, 0);
+  std::vector<digit_t> scratch(4 * n);
+  digit_t* z = scratch.data();
+  digit_t* block_quotient = z + 2 * n;
+  digit_t* block_remainder = z + 3 * n;
+  std::copy(dividend.begin() + (t - 2) * n, dividend.end(), z);
+  for (int i = t - 2; i >= 0; i--) {
+    DivideTwoDigitsByOne(block_quotient, block_remainder, z, divisor.data(),
+                         n);
+    if (q != nullptr) {
+      for (int k = 0; k < n; k++) {
+        if (i * n + k < q_length) {
+          q[i * n + k] = block_quotient[k];
+        } else {
+          DCHECK_EQ(block_quotient[k], 0);
+        }
+      }
+    }
+    if (i > 0) {
+      std::copy(dividend.begin() + (i - 1) * n, dividend.begin() + i * n, z);
+      std::copy(block_remainder, block_remainder + n, z + n);
+    }
+  }
+  if (r != nullptr) {
+    RightShiftDigits(block_remainder, block_remainder, n, shift_bits);
+    std::copy(block_remainder + shift_digits, block_remainder + n, r);
+  }
+}
+
+// Computes q := a / b and r := a % b, picking an algorithm based on the
+// inputs' lengths. Same interface as DivideSchoolbook.
+void MutableBigInt::DivideDigits(digit_t* q, digit_t* r, const digit_t* a,
+                                 int a_length, const digit_t* b,
+                                 int b_length) {
+  if (b_length < kBurnikelThreshold ||
+      a_length - b_length < kBurnikelThreshold) {
+    DivideSchoolbook(q, r, a, a_length, b, b_length);
+  } else {
+    DivideBurnikelZiegler(q, r, a, a_length, b, b_length);
+  }
+}
+
+
 MaybeHandle<BigInt> MutableBigInt::LeftShiftByAbsolute(Isolate* isolate,
                                                        Handle<BigIntBase> x,
                                                        Handle<BigIntBase> y) {
@@ -2009,6 +2505,98 @@ MaybeHandle<String> MutableBigInt::ToStringBasePowerOfTwo(
   return result;
 }
 
+// Writes the {width} least significant characters of {x} in radix {radix}
+// right to left, ending just before {end}, with repeated division by
+// {chunk_divisor} = {radix}^{chunk_chars}. Pads with zeros as needed.
+void MutableBigInt::ToStringBaseCase(uint8_t* end, const digit_t* x,
+                                     int x_length, int width, int radix,
+                                     int chunk_chars, digit_t chunk_divisor) {
+  std::vector<digit_t> rest(x, x + x_length);
+  uint8_t* pos = end;
+  while (x_length > 0 && pos > end - width) {
+    digit_t chunk = 0;
+    for (int i = x_length - 1; i >= 0; i--) {
+      rest[i] = digit_div(chunk, rest[i], chunk_divisor, &chunk);
+    }
+    if (rest[x_length - 1] == 0) x_length--;
+    for (int i = 0; i < chunk_chars && pos > end - width; i++) {
+      *(--pos) = kConversionChars[chunk % radix];
+      chunk /= radix;
+    }
+  }
+  std::fill(end - width, pos, '0');
+}
+
+// Writes the 2 * {chunk_chars} * 2^{level} least significant characters of
+// {x} right to left, ending just before {end}. {powers}[k] holds
+// {radix}^({chunk_chars} * 2^k), and {x} must be less than
+// {powers}[{level}]^2. Splitting {x} by division through the largest such
+// power and converting both halves recursively makes the conversion as fast
+// as the division, instead of quadratic in {x}'s length.
+void MutableBigInt::ToStringDivideAndConquer(
+    uint8_t* end, const digit_t* x, int x_length, int level,
+    const std::vector<std::vector<digit_t>>& powers, int radix,
+    int chunk_chars) {
+  while (x_length > 0 && x[x_length - 1] == 0) x_length--;
+  int width = chunk_chars << (level + 1);
+  if (level < 0 || x_length < kToStringFastThreshold) {
+    ToStringBaseCase(end, x, x_length, width, radix, chunk_chars,
+                     powers[0][0]);
+    return;
+  }
+  const std::vector<digit_t>& divisor = powers[level];
+  int divisor_length = static_cast<int>(divisor.size());
+  uint8_t* middle = end - (chunk_chars << level);
+  if (x_length < divisor_length) {
+    std::fill(end - width, middle, '0');
+    ToStringDivideAndConquer(end, x, x_length, level - 1, powers, radix,
+                             chunk_chars);
+    return;
+  }
+  int quotient_length = x_length - divisor_length + 1;
+  std::vector<digit_t> scratch(quotient_length + divisor_length);
+  digit_t* quotient = scratch.data();
+  digit_t* remainder = quotient + quotient_length;
+  DivideDigits(quotient, remainder, x, x_length, divisor.data(),
+               divisor_length);
+  ToStringDivideAndConquer(end, remainder, divisor_length, level - 1, powers,
+                           radix, chunk_chars);
+  ToStringDivideAndConquer(middle, quotient, quotient_length, level - 1,
+                           powers, radix, chunk_chars);
+}
+
+// Converts the non-zero {x} to radix {radix} with ToStringDivideAndConquer.
+// Stores the characters into {result}, most significant first and without
+// leading zeros.
+void MutableBigInt::ToStringLarge(const digit_t* x, int x_length, int radix,
+                                  std::vector<uint8_t>* result) {
+  const uint8_t max_bits_per_char = kMaxBitsPerChar[radix];
+  int chunk_chars =
+      kDigitBits * kBitsPerCharTableMultiplier / max_bits_per_char;
+  digit_t chunk_divisor = digit_pow(radix, chunk_chars);
+  // Square the chunk divisor until its square is certainly larger than {x}.
+  std::vector<std::vector<digit_t>> powers;
+  powers.push_back(std::vector<digit_t>(1, chunk_divisor));
+  while (2 * static_cast<int>(powers.back().size()) - 2 < x_length) {
+    const std::vector<digit_t>& last = powers.back();
+    int last_length = static_cast<int>(last.size());
+    std::vector<digit_t> square(2 * last_length);
+    MultiplyDigits(square.data(), last.data(), last_length, last.data(),
+                   last_length);
+    while (square.back() == 0) square.pop_back();
+    powers.push_back(std::move(square));
+  }
+  int level = static_cast<int>(powers.size()) - 1;
+  result->resize(static_cast<size_t>(chunk_chars) << (level + 1));
+  uint8_t* end = result->data() + result->size();
+  ToStringDivideAndConquer(end, x, x_length, level, powers, radix,
+                           chunk_chars);
+  auto first_nonzero = std::find_if(result->begin(), result->end(),
+                                    [](uint8_t c) { return c != '0'; });
+  DCHECK(first_nonzero != result->end());
+  result->erase(result->begin(), first_nonzero);
+}
+
 MaybeHandle<String> MutableBigInt::ToStringGeneric(Isolate* isolate,
                                                    Handle<BigIntBase> x,
                                                    int radix,
@@ -2063,48 +2651,61 @@ MaybeHandle<String> MutableBigInt::ToStringGeneric(Isolate* isolate,
   // left-shifting it if the length estimate was too large.
   int pos = 0;
 
-  digit_t last_digit;
-  if (length == 1) {
-    last_digit = x->digit(0);
+  if (length >= kToStringFastThreshold) {
+    std::vector<digit_t> digits;
+    CopyDigits(*x, &digits);
+    std::vector<uint8_t> large_chars;
+    ToStringLarge(digits.data(), length, radix, &large_chars);
+    DisallowHeapAllocation no_gc;
+    uint8_t* chars = result->GetChars(no_gc);
+    std::reverse_copy(large_chars.begin(), large_chars.end(), chars);
+    pos = static_cast<int>(large_chars.size());
   } else {
-    int chunk_chars =
-        kDigitBits * kBitsPerCharTableMultiplier / max_bits_per_char;
-    digit_t chunk_divisor = digit_pow(radix, chunk_chars);
-    // By construction of chunk_chars, there can't have been overflow.
-    DCHECK_NE(chunk_divisor, 0);
-    int nonzero_digit = length - 1;
-    DCHECK_NE(x->digit(nonzero_digit), 0);
-    // {rest} holds the part of the BigInt that we haven't looked at yet.
-    // Not to be confused with "remainder"!
-    Handle<MutableBigInt> rest;
-    // In the first round, divide the input, allocating a new BigInt for
-    // the result == rest; from then on divide the rest in-place.
-    Handle<BigIntBase>* dividend = &x;
+    digit_t last_digit;
+    if (length == 1) {
+      last_digit = x->digit(0);
+    } else {
+      int chunk_chars =
+          kDigitBits * kBitsPerCharTableMultiplier / max_bits_per_char;
+      digit_t chunk_divisor = digit_pow(radix, chunk_chars);
+      // By construction of chunk_chars, there can't have been overflow.
+      DCHECK_NE(chunk_divisor, 0);
+      int nonzero_digit = length - 1;
+      DCHECK_NE(x->digit(nonzero_digit), 0);
+      // {rest} holds the part of the BigInt that we haven't looked at yet.
+      // Not to be confused with "remainder"!
+      Handle<MutableBigInt> rest;
+      // In the first round, divide the input, allocating a new BigInt for
+      // the result == rest; from then on divide the rest in-place.
+      Handle<BigIntBase>* dividend = &x;
+      do {
+        digit_t chunk;
+        AbsoluteDivSmall(isolate, *dividend, chunk_divisor, &rest, &chunk);
+        DCHECK(!rest.is_null());
+        dividend = reinterpret_cast<Handle<BigIntBase>*>(&rest);
+        DisallowHeapAllocation no_gc;
+        uint8_t* chars = result->GetChars(no_gc);
+        for (int i = 0; i < chunk_chars; i++) {
+          chars[pos++] = kConversionChars[chunk % radix];
+          chunk /= radix;
+        }
+        DCHECK_EQ(chunk, 0);
+        if (rest->digit(nonzero_digit) == 0) nonzero_digit--;
+        // We can never clear more than one digit per iteration, because
+        // chunk_divisor is smaller than max digit value.
+        DCHECK_GT(rest->digit(nonzero_digit), 0);
+      } while (nonzero_digit > 0);
+      last_digit = rest->digit(0);
+    }
+    DisallowHeapAllocation no_gc;
+    uint8_t* chars = result->GetChars(no_gc);
     do {
-      digit_t chunk;
-      AbsoluteDivSmall(isolate, *dividend, chunk_divisor, &rest, &chunk);
-      DCHECK(!rest.is_null());
-      dividend = reinterpret_cast<Handle<BigIntBase>*>(&rest);
-      DisallowHeapAllocation no_gc;
-      uint8_t* chars = result->GetChars(no_gc);
-      for (int i = 0; i < chunk_chars; i++) {
-        chars[pos++] = kConversionChars[chunk % radix];
-        chunk /= radix;
-      }
-      DCHECK_EQ(chunk, 0);
-      if (rest->digit(nonzero_digit) == 0) nonzero_digit--;
-      // We can never clear more than one digit per iteration, because
-      // chunk_divisor is smaller than max digit value.
-      DCHECK_GT(rest->digit(nonzero_digit), 0);
-    } while (nonzero_digit > 0);
-    last_digit = rest->digit(0);
+      chars[pos++] = kConversionChars[last_digit % radix];
+      last_digit /= radix;
+    } while (last_digit > 0);
   }
   DisallowHeapAllocation no_gc;
   uint8_t* chars = result->GetChars(no_gc);
-  do {
-    chars[pos++] = kConversionChars[last_digit % radix];
-    last_digit /= radix;
-  } while (last_digit > 0);
   DCHECK_GE(pos, 1);
   DCHECK(pos <= static_cast<int>(chars_required));
   // Remove leading zeroes.
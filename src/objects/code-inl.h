@@ -725,6 +725,29 @@ void BytecodeArray::set_bytecode_age(BytecodeArray::Age age) {
   RELAXED_WRITE_INT8_FIELD(this, kBytecodeAgeOffset, static_cast<int8_t>(age));
 }
 
+bool BytecodeArray::has_optimization_hint() const {
+  return (READ_INT8_FIELD(this, kOptimizationHintOffset) &
+          kOptimizedHintBit) != 0;
+}
+
+void BytecodeArray::set_has_optimization_hint(bool value) {
+  // Masking keeps the unused bits clear, even on freshly allocated arrays.
+  int hints = READ_INT8_FIELD(this, kOptimizationHintOffset) & kInlinedHintBit;
+  if (value) hints |= kOptimizedHintBit;
+  WRITE_INT8_FIELD(this, kOptimizationHintOffset, static_cast<int8_t>(hints));
+}
+
+bool BytecodeArray::has_inlining_hint() const {
+  return (READ_INT8_FIELD(this, kOptimizationHintOffset) & kInlinedHintBit) !=
+         0;
+}
+
+void BytecodeArray::set_has_inlining_hint(bool value) {
+  int hints = READ_INT8_FIELD(this, kOptimizationHintOffset) & kOptimizedHintBit;
+  if (value) hints |= kInlinedHintBit;
+  WRITE_INT8_FIELD(this, kOptimizationHintOffset, static_cast<int8_t>(hints));
+}
+
 int BytecodeArray::parameter_count() const {
   // Parameter count is stored as the size on stack of the parameters to allow
   // it to be used directly by generated code.
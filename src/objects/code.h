@@ -757,6 +757,18 @@ class BytecodeArray : public FixedArrayBase {
   inline Age bytecode_age() const;
   inline void set_bytecode_age(Age age);
 
+  // Accessors for the optimization hint. The hint records that this bytecode
+  // has been optimized by TurboFan before and survives code caching, so that a
+  // later isolate deserializing it can tier up without re-warming.
+  inline bool has_optimization_hint() const;
+  inline void set_has_optimization_hint(bool value);
+
+  // Accessors for the inlining hint, which is cached alongside the
+  // optimization hint. It records that this bytecode has been inlined into
+  // optimized code before, so that TurboFan prefers inlining it again.
+  inline bool has_inlining_hint() const;
+  inline void set_has_inlining_hint(bool value);
+
   // Accessors for the constant pool.
   DECL_ACCESSORS2(constant_pool, FixedArray)
 
@@ -793,6 +805,8 @@ class BytecodeArray : public FixedArrayBase {
 
   // Bytecode aging
   bool IsOld() const;
+  // The age at which bytecode is considered old, see --bytecode-old-age.
+  static Age OldBytecodeAge();
   void MakeOlder();
 
   // Clear uninitialized padding space. This ensures that the snapshot content
@@ -811,6 +825,7 @@ class BytecodeArray : public FixedArrayBase {
   V(kInterruptBudgetOffset, kIntSize)                      \
   V(kOSRNestingLevelOffset, kCharSize)                     \
   V(kBytecodeAgeOffset, kCharSize)                         \
+  V(kOptimizationHintOffset, kCharSize)                    \
   /* Total size. */                                        \
   V(kHeaderSize, 0)
 
@@ -818,6 +833,10 @@ class BytecodeArray : public FixedArrayBase {
                                 BYTECODE_ARRAY_FIELDS)
 #undef BYTECODE_ARRAY_FIELDS
 
+  // Bits of the field at kOptimizationHintOffset.
+  static const int kOptimizedHintBit = 1 << 0;
+  static const int kInlinedHintBit = 1 << 1;
+
   // Maximal memory consumption for a single BytecodeArray.
   static const int kMaxSize = 512 * MB;
   // Maximal length of a single BytecodeArray.
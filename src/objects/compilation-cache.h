@@ -79,6 +79,9 @@ class InfoCellPair {
 // Such entries are identified by SharedFunctionInfos pointing to either the
 // recompilation stub, or to "old" code. This avoids memory leaks due to
 // premature caching of scripts and eval strings that are never needed later.
+// Script entries additionally record the number of GCs since their last use.
+// With --compilation-cache-script-budget, the least recently used scripts are
+// only evicted once the cached scripts exceed that budget.
 class CompilationCacheTable
     : public HashTable<CompilationCacheTable, CompilationCacheShape> {
  public:
@@ -111,6 +114,8 @@ class CompilationCacheTable
   DECL_CAST2(CompilationCacheTable)
 
  private:
+  void RemoveIfOld(int entry);
+
   OBJECT_CONSTRUCTORS(CompilationCacheTable,
                       HashTable<CompilationCacheTable, CompilationCacheShape>);
 };
@@ -97,6 +97,22 @@ RootIndex GlobalDictionaryShape::GetMapRootIndex() {
 
 Name NameDictionary::NameAt(int entry) { return Name::cast(KeyAt(entry)); }
 
+Object* NameDictionary::enum_keys_cache() const {
+  return get(kEnumKeysCacheIndex);
+}
+
+void NameDictionary::set_enum_keys_cache(FixedArray keys) {
+  set(kEnumKeysCacheIndex, keys);
+}
+
+template <typename Dictionary>
+void NameDictionaryShape::DetailsAtPut(Isolate* isolate, Dictionary dict,
+                                       int entry, PropertyDetails value) {
+  BaseDictionaryShape<Handle<Name>>::DetailsAtPut(isolate, dict, entry, value);
+  dict->set(Dictionary::kEnumKeysCacheIndex,
+            dict->GetReadOnlyRoots().undefined_value());
+}
+
 RootIndex NameDictionaryShape::GetMapRootIndex() {
   return RootIndex::kNameDictionaryMap;
 }
@@ -117,7 +117,12 @@ class NameDictionaryShape : public BaseDictionaryShape<Handle<Name>> {
   static inline uint32_t HashForObject(Isolate* isolate, Object* object);
   static inline Handle<Object> AsHandle(Isolate* isolate, Handle<Name> key);
   static inline RootIndex GetMapRootIndex();
-  static const int kPrefixSize = 2;
+  // Also clears the enum keys cache, since every change to the keys or to
+  // their enumerability goes through the details.
+  template <typename Dictionary>
+  static inline void DetailsAtPut(Isolate* isolate, Dictionary dict, int entry,
+                                  PropertyDetails value);
+  static const int kPrefixSize = 3;
   static const int kEntrySize = 3;
   static const int kEntryValueIndex = 1;
   static const bool kNeedsHoleCheck = false;
@@ -131,6 +136,7 @@ class BaseNameDictionary : public Dictionary<Derived, Shape> {
   static const int kNextEnumerationIndexIndex =
       HashTableBase::kPrefixStartIndex;
   static const int kObjectHashIndex = kNextEnumerationIndexIndex + 1;
+  static const int kEnumKeysCacheIndex = kObjectHashIndex + 1;
   static const int kEntryValueIndex = 1;
 
   // Accessors for next enumeration index.
@@ -203,6 +209,11 @@ class NameDictionary
   inline void set_hash(int hash);
   inline int hash() const;
 
+  // [enum_keys_cache]: The enumerable string keys in enumeration order, or
+  // undefined if they have not been collected since the last change.
+  inline Object* enum_keys_cache() const;
+  inline void set_enum_keys_cache(FixedArray keys);
+
   OBJECT_CONSTRUCTORS(NameDictionary,
                       BaseNameDictionary<NameDictionary, NameDictionaryShape>)
 };
@@ -215,6 +215,35 @@ int BinarySearch(T* array, Name name, int valid_entries,
 
   DCHECK(low <= high);
 
+  // Hashes are uniformly distributed, so in wide arrays (like the transition
+  // arrays of maps with many different successors) interpolating between the
+  // hashes at the ends of the range narrows it much faster than bisection.
+  // Only a few rounds are done to bound the cost of a skewed distribution.
+  const int kMinEntriesForInterpolation = 64;
+  const int kMaxInterpolationRounds = 3;
+  for (int round = 0; round < kMaxInterpolationRounds &&
+                      high - low >= kMinEntriesForInterpolation;
+       ++round) {
+    uint32_t low_hash = array->GetSortedKey(low)->hash_field();
+    uint32_t high_hash = array->GetSortedKey(high)->hash_field();
+    if (hash <= low_hash) {
+      high = low;
+      break;
+    }
+    if (hash > high_hash) {
+      low = high;
+      break;
+    }
+    uint64_t offset = static_cast<uint64_t>(hash - low_hash) * (high - low) /
+                      (high_hash - low_hash);
+    int mid = Min(low + static_cast<int>(offset), high - 1);
+    if (array->GetSortedKey(mid)->hash_field() >= hash) {
+      high = mid;
+    } else {
+      low = mid + 1;
+    }
+  }
+
   while (low != high) {
     int mid = low + (high - low) / 2;
     Name mid_name = array->GetSortedKey(mid);
@@ -116,6 +116,12 @@ class V8_EXPORT_PRIVATE HashTableBase : public NON_EXPORTED_BASE(FixedArray) {
     return (hash + GetProbeOffset(number)) & (size - 1);
   }
 
+  // The probe sequence (and the entry layout it indexes) is replicated in
+  // CodeStubAssembler::NameDictionaryLookup and friends, and relied upon by
+  // the GC body descriptors and the snapshot, so these must stay in sync.
+  // TODO(v8:swisstable): Large dictionaries would benefit from a separate
+  // control byte array of hash fingerprints probed a group at a time, which
+  // requires a new dictionary object type rather than a change here.
   inline static uint32_t FirstProbe(uint32_t hash, uint32_t size) {
     return hash & (size - 1);
   }
@@ -34,6 +34,7 @@
 #include "unicode/numfmt.h"
 #include "unicode/numsys.h"
 #include "unicode/timezone.h"
+#include "unicode/tztrans.h"
 #include "unicode/ustring.h"
 #include "unicode/uvernum.h"  // U_ICU_VERSION_MAJOR_NUM
 
@@ -191,14 +192,22 @@ const uint8_t* Intl::ToLatin1LowerTable() { return &kToLower[0]; }
 icu::UnicodeString Intl::ToICUUnicodeString(Isolate* isolate,
                                             Handle<String> string) {
   string = String::Flatten(isolate, string);
-  {
-    DisallowHeapAllocation no_gc;
-    std::unique_ptr<uc16[]> sap;
+  int32_t length = string->length();
+  DisallowHeapAllocation no_gc;
+  String::FlatContent flat = string->GetFlatContent(no_gc);
+  if (flat.IsTwoByte()) {
     return icu::UnicodeString(
-        GetUCharBufferFromFlat(string->GetFlatContent(no_gc), &sap,
-                               string->length()),
-        string->length());
+        reinterpret_cast<const UChar*>(flat.ToUC16Vector().start()), length);
   }
+  // Widen one-byte characters directly into the ICU string's buffer, rather
+  // than into a temporary two-byte copy that ICU then copies again.
+  icu::UnicodeString result;
+  UChar* buffer = result.getBuffer(length);
+  CHECK_NOT_NULL(buffer);
+  CopyChars(reinterpret_cast<uc16*>(buffer), flat.ToOneByteVector().start(),
+            length);
+  result.releaseBuffer(length);
+  return result;
 }
 
 namespace {
@@ -904,21 +913,35 @@ MaybeHandle<String> Intl::StringLocaleConvertCase(Isolate* isolate,
   }
 }
 
+bool Intl::GetICUObjectCacheKey(Isolate* isolate, Handle<Object> locales,
+                                Handle<Object> options,
+                                std::string* locales_key) {
+  if (!options->IsUndefined(isolate)) return false;
+  if (locales->IsUndefined(isolate)) {
+    locales_key->clear();
+    return true;
+  }
+  // The empty string is not a valid locale and would collide with the key
+  // for undefined above.
+  if (!locales->IsString() || String::cast(*locales)->length() == 0) {
+    return false;
+  }
+  *locales_key = String::cast(*locales)->ToCString().get();
+  return true;
+}
+
 MaybeHandle<Object> Intl::StringLocaleCompare(Isolate* isolate,
                                               Handle<String> string1,
                                               Handle<String> string2,
                                               Handle<Object> locales,
                                               Handle<Object> options) {
-  // We only cache the instance when both locales and options are undefined,
-  // as that is the only case when the specified side-effects of examining
-  // those arguments are unobservable.
+  std::string locales_key;
   bool can_cache =
-      locales->IsUndefined(isolate) && options->IsUndefined(isolate);
+      GetICUObjectCacheKey(isolate, locales, options, &locales_key);
   if (can_cache) {
-    // Both locales and options are undefined, check the cache.
     icu::Collator* cached_icu_collator =
         static_cast<icu::Collator*>(isolate->get_cached_icu_object(
-            Isolate::ICUObjectCacheType::kDefaultCollator));
+            Isolate::ICUObjectCacheType::kDefaultCollator, locales_key));
     // We may use the cached icu::Collator for a fast path.
     if (cached_icu_collator != nullptr) {
       return Intl::CompareStrings(isolate, *cached_icu_collator, string1,
@@ -937,7 +960,7 @@ MaybeHandle<Object> Intl::StringLocaleCompare(Isolate* isolate,
       New<JSCollator>(isolate, constructor, locales, options), Object);
   if (can_cache) {
     isolate->set_icu_object_in_cache(
-        Isolate::ICUObjectCacheType::kDefaultCollator,
+        Isolate::ICUObjectCacheType::kDefaultCollator, locales_key,
         std::static_pointer_cast<icu::UObject>(
             collator->icu_collator()->get()));
   }
@@ -977,15 +1000,13 @@ MaybeHandle<String> Intl::NumberToLocaleString(Isolate* isolate,
   // Spec treats -0 and +0 as 0.
   double number = number_obj->Number() + 0;
 
-  // We only cache the instance when both locales and options are undefined,
-  // as that is the only case when the specified side-effects of examining
-  // those arguments are unobservable.
+  std::string locales_key;
   bool can_cache =
-      locales->IsUndefined(isolate) && options->IsUndefined(isolate);
+      GetICUObjectCacheKey(isolate, locales, options, &locales_key);
   if (can_cache) {
     icu::NumberFormat* cached_number_format =
         static_cast<icu::NumberFormat*>(isolate->get_cached_icu_object(
-            Isolate::ICUObjectCacheType::kDefaultNumberFormat));
+            Isolate::ICUObjectCacheType::kDefaultNumberFormat, locales_key));
     // We may use the cached icu::NumberFormat for a fast path.
     if (cached_number_format != nullptr) {
       return JSNumberFormat::FormatNumber(isolate, *cached_number_format,
@@ -1005,7 +1026,7 @@ MaybeHandle<String> Intl::NumberToLocaleString(Isolate* isolate,
 
   if (can_cache) {
     isolate->set_icu_object_in_cache(
-        Isolate::ICUObjectCacheType::kDefaultNumberFormat,
+        Isolate::ICUObjectCacheType::kDefaultNumberFormat, locales_key,
         std::static_pointer_cast<icu::UObject>(
             number_format->icu_number_format()->get()));
   }
@@ -1744,8 +1765,28 @@ class ICUTimezoneCache : public base::TimezoneCache {
   bool GetOffsets(double time_ms, bool is_utc, int32_t* raw_offset,
                   int32_t* dst_offset);
 
+  // The offsets of UTC times only change at the transitions of the time zone,
+  // so they are cached per transition interval. Dates from many different
+  // years each need their own intervals, so the cache is kept in most recently
+  // used order and the least recently used interval is evicted.
+  struct OffsetInterval {
+    double start_ms;  // Inclusive.
+    double end_ms;    // Exclusive.
+    int32_t raw_offset;
+    int32_t dst_offset;
+  };
+  static const int kOffsetCacheSize = 64;
+
+  bool LookupOffsetCache(double time_ms, int32_t* raw_offset,
+                         int32_t* dst_offset);
+  void AddToOffsetCache(double time_ms, int32_t raw_offset,
+                        int32_t dst_offset);
+
   icu::TimeZone* timezone_;
 
+  OffsetInterval offset_cache_[kOffsetCacheSize];
+  int offset_cache_length_;
+
   std::string timezone_name_;
   std::string dst_timezone_name_;
 };
@@ -1786,7 +1827,11 @@ bool ICUTimezoneCache::GetOffsets(double time_ms, bool is_utc,
   // TimeZone to BasicTimeZone is safe because we know that icu::TimeZone used
   // here is a BasicTimeZone.
   if (is_utc) {
+    if (LookupOffsetCache(time_ms, raw_offset, dst_offset)) return true;
     GetTimeZone()->getOffset(time_ms, false, *raw_offset, *dst_offset, status);
+    if (U_SUCCESS(status)) {
+      AddToOffsetCache(time_ms, *raw_offset, *dst_offset);
+    }
   } else {
     static_cast<const icu::BasicTimeZone*>(GetTimeZone())
         ->getOffsetFromLocal(time_ms, icu::BasicTimeZone::kFormer,
@@ -1797,6 +1842,45 @@ bool ICUTimezoneCache::GetOffsets(double time_ms, bool is_utc,
   return U_SUCCESS(status);
 }
 
+bool ICUTimezoneCache::LookupOffsetCache(double time_ms, int32_t* raw_offset,
+                                         int32_t* dst_offset) {
+  for (int i = 0; i < offset_cache_length_; i++) {
+    if (offset_cache_[i].start_ms <= time_ms &&
+        time_ms < offset_cache_[i].end_ms) {
+      OffsetInterval hit = offset_cache_[i];
+      // Move the hit to the front.
+      std::copy_backward(offset_cache_, offset_cache_ + i,
+                         offset_cache_ + i + 1);
+      offset_cache_[0] = hit;
+      *raw_offset = hit.raw_offset;
+      *dst_offset = hit.dst_offset;
+      return true;
+    }
+  }
+  return false;
+}
+
+void ICUTimezoneCache::AddToOffsetCache(double time_ms, int32_t raw_offset,
+                                        int32_t dst_offset) {
+  const icu::BasicTimeZone* timezone =
+      static_cast<const icu::BasicTimeZone*>(GetTimeZone());
+  icu::TimeZoneTransition transition;
+  OffsetInterval interval = {-std::numeric_limits<double>::infinity(),
+                             std::numeric_limits<double>::infinity(),
+                             raw_offset, dst_offset};
+  if (timezone->getPreviousTransition(time_ms, true, transition)) {
+    interval.start_ms = transition.getTime();
+  }
+  if (timezone->getNextTransition(time_ms, false, transition)) {
+    interval.end_ms = transition.getTime();
+  }
+  // Drop the least recently used interval if the cache is full.
+  if (offset_cache_length_ < kOffsetCacheSize) offset_cache_length_++;
+  std::copy_backward(offset_cache_, offset_cache_ + offset_cache_length_ - 1,
+                     offset_cache_ + offset_cache_length_);
+  offset_cache_[0] = interval;
+}
+
 double ICUTimezoneCache::DaylightSavingsOffset(double time_ms) {
   int32_t raw_offset, dst_offset;
   if (!GetOffsets(time_ms, true, &raw_offset, &dst_offset)) return 0;
@@ -1812,6 +1896,7 @@ double ICUTimezoneCache::LocalTimeOffset(double time_ms, bool is_utc) {
 void ICUTimezoneCache::Clear() {
   delete timezone_;
   timezone_ = nullptr;
+  offset_cache_length_ = 0;
   timezone_name_.clear();
   dst_timezone_name_.clear();
 }
@@ -154,6 +154,15 @@ class Intl {
   V8_WARN_UNUSED_RESULT static MaybeHandle<String> ConvertToLower(
       Isolate* isolate, Handle<String> s);
 
+  // The ICU objects created by the toLocaleString-style functions are cached
+  // on the isolate when examining {locales} and {options} has no observable
+  // side effects: {options} is undefined and {locales} is undefined or a
+  // non-empty string. Returns whether that is the case, and if so sets
+  // {locales_key} to the key to cache the ICU object under.
+  static bool GetICUObjectCacheKey(Isolate* isolate, Handle<Object> locales,
+                                   Handle<Object> options,
+                                   std::string* locales_key);
+
   V8_WARN_UNUSED_RESULT static MaybeHandle<Object> StringLocaleCompare(
       Isolate* isolate, Handle<String> s1, Handle<String> s2,
       Handle<Object> locales, Handle<Object> options);
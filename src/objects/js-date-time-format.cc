@@ -506,16 +506,13 @@ MaybeHandle<String> JSDateTimeFormat::ToLocaleDateTime(
     return factory->Invalid_Date_string();
   }
 
-  // We only cache the instance when both locales and options are undefined,
-  // as that is the only case when the specified side-effects of examining
-  // those arguments are unobservable.
+  std::string locales_key;
   bool can_cache =
-      locales->IsUndefined(isolate) && options->IsUndefined(isolate);
+      Intl::GetICUObjectCacheKey(isolate, locales, options, &locales_key);
   if (can_cache) {
-    // Both locales and options are undefined, check the cache.
     icu::SimpleDateFormat* cached_icu_simple_date_format =
         static_cast<icu::SimpleDateFormat*>(
-            isolate->get_cached_icu_object(cache_type));
+            isolate->get_cached_icu_object(cache_type, locales_key));
     if (cached_icu_simple_date_format != nullptr) {
       return FormatDateTime(isolate, *cached_icu_simple_date_format, x);
     }
@@ -546,8 +543,9 @@ MaybeHandle<String> JSDateTimeFormat::ToLocaleDateTime(
 
   if (can_cache) {
     isolate->set_icu_object_in_cache(
-        cache_type, std::static_pointer_cast<icu::UObject>(
-                        date_time_format->icu_simple_date_format()->get()));
+        cache_type, locales_key,
+        std::static_pointer_cast<icu::UObject>(
+            date_time_format->icu_simple_date_format()->get()));
   }
   // 5. Return FormatDateTime(dateFormat, x).
   return FormatDateTime(
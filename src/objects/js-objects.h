@@ -1045,6 +1045,11 @@ class JSFunction : public JSObject {
   inline bool has_feedback_vector() const;
   static void EnsureFeedbackVector(Handle<JSFunction> function);
 
+  // Allocates the feedback vector for a freshly compiled or instantiated
+  // {function}, unless --lazy-feedback-allocation defers that to the point
+  // where the function turns out to run more than a few times.
+  static void InitializeFeedbackVector(Handle<JSFunction> function);
+
   // Unconditionally clear the type feedback vector.
   void ClearTypeFeedbackInfo();
 
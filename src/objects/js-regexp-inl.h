@@ -78,6 +78,35 @@ void JSRegExp::SetDataAt(int index, Object* value) {
   FixedArray::cast(data())->set(index, value);
 }
 
+void JSRegExp::TierUpTick() {
+  DCHECK_EQ(TypeTag(), IRREGEXP);
+  int ticks = Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex));
+  if (ticks == 0) return;
+  FixedArray::cast(data())->set(kIrregexpTicksUntilTierUpIndex,
+                                Smi::FromInt(ticks - 1));
+}
+
+bool JSRegExp::MarkedForTierUp() {
+  DCHECK_EQ(TypeTag(), IRREGEXP);
+  return Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex)) == 0;
+}
+
+void JSRegExp::MarkTierUpForNextExec() {
+  DCHECK_EQ(TypeTag(), IRREGEXP);
+  FixedArray::cast(data())->set(kIrregexpTicksUntilTierUpIndex, Smi::kZero);
+}
+
+bool JSRegExp::UsesLinearEngine() {
+  DCHECK_EQ(TypeTag(), IRREGEXP);
+  return DataAt(kIrregexpLinearCodeIndex)->IsByteArray();
+}
+
+bool JSRegExp::HasLinearFallback() {
+  DCHECK_EQ(TypeTag(), IRREGEXP);
+  return DataAt(kIrregexpLinearCodeIndex) ==
+         Smi::FromInt(kLinearEngineOnFallback);
+}
+
 }  // namespace internal
 }  // namespace v8
 
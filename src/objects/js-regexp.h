@@ -29,6 +29,9 @@ namespace internal {
 // used for tracking the last usage (used for regexp code flushing).
 // - max number of registers used by irregexp implementations.
 // - number of capture registers (output values) of the regexp.
+// - number of interpreted executions left before tier-up to native code.
+// - the program for the linear-time engine, if the regexp uses it.
+// - the literal prefix of all matches, if any.
 class JSRegExp : public JSObject {
  public:
   // Meaning of Type:
@@ -102,6 +105,21 @@ class JSRegExp : public JSObject {
   // Set implementation data after the object has been prepared.
   inline void SetDataAt(int index, Object* value);
 
+  // Counts an interpreted execution of an irregexp regexp.
+  inline void TierUpTick();
+  // Whether an irregexp regexp has been interpreted often enough to be
+  // compiled to native code.
+  inline bool MarkedForTierUp();
+  // Makes the next execution compile the regexp to native code.
+  inline void MarkTierUpForNextExec();
+
+  // Whether an irregexp regexp is matched by the linear-time engine, see
+  // --regexp-linear-engine.
+  inline bool UsesLinearEngine();
+  // Whether an irregexp regexp switches to the linear-time engine when it
+  // backtracks excessively, see --regexp-linear-fallback.
+  inline bool HasLinearFallback();
+
   static int code_index(bool is_latin1) {
     if (is_latin1) {
       return kIrregexpLatin1CodeIndex;
@@ -157,8 +175,17 @@ class JSRegExp : public JSObject {
   // Maps names of named capture groups (at indices 2i) to their corresponding
   // (1-based) capture group indices (at indices 2i + 1).
   static const int kIrregexpCaptureNameMapIndex = kDataIndex + 4;
-
-  static const int kIrregexpDataSize = kIrregexpCaptureNameMapIndex + 1;
+  // Number of interpreted executions left before the regexp is compiled to
+  // native code, see --regexp-tier-up.
+  static const int kIrregexpTicksUntilTierUpIndex = kDataIndex + 5;
+  // The program for the linear-time engine (a ByteArray) once the regexp uses
+  // it, otherwise kLinearEngineUnused or kLinearEngineOnFallback.
+  static const int kIrregexpLinearCodeIndex = kDataIndex + 6;
+  // A string which every match starts with, or Smi::kZero if there is none.
+  // Matching starts at its first occurrence instead of trying every position.
+  static const int kIrregexpLiteralPrefixIndex = kDataIndex + 7;
+
+  static const int kIrregexpDataSize = kIrregexpLiteralPrefixIndex + 1;
 
   // In-object fields.
   static const int kLastIndexFieldIndex = 0;
@@ -175,6 +202,10 @@ class JSRegExp : public JSObject {
   // The uninitialized value for a regexp code object.
   static const int kUninitializedValue = -1;
 
+  // Values of the linear-time engine slot before the regexp uses the engine.
+  static const int kLinearEngineUnused = 0;
+  static const int kLinearEngineOnFallback = 1;
+
   OBJECT_CONSTRUCTORS(JSRegExp, JSObject)
 };
 
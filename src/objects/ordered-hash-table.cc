@@ -93,24 +93,27 @@ bool OrderedHashTable<Derived, entrysize>::HasKey(Isolate* isolate,
 template <class Derived, int entrysize>
 int OrderedHashTable<Derived, entrysize>::FindEntry(Isolate* isolate,
                                                     Object* key) {
-  int entry;
+  int hash;
   // This special cases for Smi, so that we avoid the HandleScope
   // creation below.
   if (key->IsSmi()) {
-    uint32_t hash = ComputeUnseededHash(Smi::ToInt(key));
-    entry = HashToEntry(hash & Smi::kMaxValue);
+    hash = ComputeUnseededHash(Smi::ToInt(key)) & Smi::kMaxValue;
   } else {
     HandleScope scope(isolate);
-    Object* hash = key->GetHash();
+    Object* hash_obj = key->GetHash();
     // If the object does not have an identity hash, it was never used as a key
-    if (hash->IsUndefined(isolate)) return kNotFound;
-    entry = HashToEntry(Smi::ToInt(hash));
+    if (hash_obj->IsUndefined(isolate)) return kNotFound;
+    hash = Smi::ToInt(hash_obj);
   }
 
-  // Walk the chain in the bucket to find the key.
+  // Walk the chain in the bucket to find the key. Deleted entries keep their
+  // hash but never match, because their key is the hole.
+  int entry = HashToEntry(hash);
   while (entry != kNotFound) {
-    Object* candidate_key = KeyAt(entry);
-    if (candidate_key->SameValueZero(key)) break;
+    if (HashAt(entry) == hash) {
+      Object* candidate_key = KeyAt(entry);
+      if (candidate_key->SameValueZero(key)) break;
+    }
     entry = NextChainEntry(entry);
   }
 
@@ -126,7 +129,9 @@ Handle<OrderedHashSet> OrderedHashSet::Add(Isolate* isolate,
   while (entry != kNotFound) {
     Object* candidate_key = table->KeyAt(entry);
     // Do not add if we have the key already
-    if (candidate_key->SameValueZero(*key)) return table;
+    if (table->HashAt(entry) == hash && candidate_key->SameValueZero(*key)) {
+      return table;
+    }
     entry = table->NextChainEntry(entry);
   }
 
@@ -139,6 +144,7 @@ Handle<OrderedHashSet> OrderedHashSet::Add(Isolate* isolate,
   int new_entry = nof + table->NumberOfDeletedElements();
   int new_index = table->EntryToIndex(new_entry);
   table->set(new_index, *key);
+  table->set(new_index + kHashOffset, Smi::FromInt(hash));
   table->set(new_index + kChainOffset, Smi::FromInt(previous_entry));
   // and point the bucket to the new entry.
   table->set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
@@ -203,13 +209,14 @@ Handle<Derived> OrderedHashTable<Derived, entrysize>::Rehash(
       continue;
     }
 
-    Object* hash = key->GetHash();
-    int bucket = Smi::ToInt(hash) & (new_buckets - 1);
+    // Use the stored hash rather than reloading it from the key.
+    DCHECK_EQ(Smi::ToInt(key->GetHash()), table->HashAt(old_entry));
+    int bucket = table->HashAt(old_entry) & (new_buckets - 1);
     Object* chain_entry = new_table->get(HashTableStartIndex() + bucket);
     new_table->set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
     int new_index = new_table->EntryToIndex(new_entry);
     int old_index = table->EntryToIndex(old_entry);
-    for (int i = 0; i < entrysize; ++i) {
+    for (int i = 0; i <= kHashOffset; ++i) {
       Object* value = table->get(old_index + i);
       new_table->set(new_index + i, value);
     }
@@ -294,7 +301,10 @@ Handle<OrderedHashMap> OrderedHashMap::Add(Isolate* isolate,
     while (entry != kNotFound) {
       Object* candidate_key = table->KeyAt(entry);
       // Do not add if we have the key already
-      if (candidate_key->SameValueZero(raw_key)) return table;
+      if (table->HashAt(entry) == hash &&
+          candidate_key->SameValueZero(raw_key)) {
+        return table;
+      }
       entry = table->NextChainEntry(entry);
     }
   }
@@ -309,6 +319,7 @@ Handle<OrderedHashMap> OrderedHashMap::Add(Isolate* isolate,
   int new_index = table->EntryToIndex(new_entry);
   table->set(new_index, *key);
   table->set(new_index + kValueOffset, *value);
+  table->set(new_index + kHashOffset, Smi::FromInt(hash));
   table->set(new_index + kChainOffset, Smi::FromInt(previous_entry));
   // and point the bucket to the new entry.
   table->set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
@@ -354,6 +365,7 @@ Handle<OrderedNameDictionary> OrderedNameDictionary::Add(
   // (by not doing the Smi conversion).
   table->set(new_index + kPropertyDetailsOffset, details.AsSmi());
 
+  table->set(new_index + kHashOffset, Smi::FromInt(hash));
   table->set(new_index + kChainOffset, Smi::FromInt(previous_entry));
   // and point the bucket to the new entry.
   table->set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
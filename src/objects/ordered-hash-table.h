@@ -39,10 +39,16 @@ namespace internal {
 //   [kPrefixSize + 3 + NumberOfBuckets()..length]: "data table", an
 //                            array of length Capacity() * kEntrySize,
 //                            where the first entrysize items are
-//                            handled by the derived class and the
-//                            item at kChainOffset is another entry
-//                            into the data table indicating the next
-//                            entry in this hash bucket.
+//                            handled by the derived class, the item
+//                            at kHashOffset is the hash of the key
+//                            and the item at kChainOffset is another
+//                            entry into the data table indicating the
+//                            next entry in this hash bucket.
+//
+// Keeping the hash next to the key lets lookups skip the comparison of
+// keys that merely share the bucket, and lets Rehash redistribute the
+// entries without touching the keys themselves, which for large tables
+// are spread all over the heap.
 //
 // When we transition the table to a new version we obsolete it and reuse parts
 // of the memory to store information how to transition an iterator to the new
@@ -118,6 +124,12 @@ class OrderedHashTable : public FixedArray {
     return Smi::ToInt(next_entry);
   }
 
+  // Returns the hash of the key stored at entry, which must not be deleted.
+  int HashAt(int entry) {
+    DCHECK_LT(entry, this->UsedCapacity());
+    return Smi::ToInt(get(EntryToIndex(entry) + kHashOffset));
+  }
+
   // use KeyAt(i)->IsTheHole(isolate) to determine if this is a deleted entry.
   Object* KeyAt(int entry) {
     DCHECK_LT(entry, this->UsedCapacity());
@@ -134,9 +146,11 @@ class OrderedHashTable : public FixedArray {
     return Smi::ToInt(get(RemovedHolesIndex() + index));
   }
 
-  // The extra +1 is for linking the bucket chains together.
-  static const int kEntrySize = entrysize + 1;
-  static const int kChainOffset = entrysize;
+  // The extra +2 is for the hash of the key and for linking the bucket
+  // chains together.
+  static const int kEntrySize = entrysize + 2;
+  static const int kHashOffset = entrysize;
+  static const int kChainOffset = entrysize + 1;
 
   static const int kNotFound = -1;
   static const int kMinCapacity = 4;
@@ -37,6 +37,7 @@ bool PrototypeInfo::HasObjectCreateMap() {
 ACCESSORS(PrototypeInfo, module_namespace, Object, kJSModuleNamespaceOffset)
 ACCESSORS(PrototypeInfo, prototype_users, Object, kPrototypeUsersOffset)
 WEAK_ACCESSORS(PrototypeInfo, object_create_map, kObjectCreateMapOffset)
+ACCESSORS(PrototypeInfo, for_in_cache, Object, kForInCacheOffset)
 SMI_ACCESSORS(PrototypeInfo, registry_slot, kRegistrySlotOffset)
 SMI_ACCESSORS(PrototypeInfo, bit_field, kBitFieldOffset)
 BOOL_ACCESSORS(PrototypeInfo, bit_field, should_be_fast_map, kShouldBeFastBit)
@@ -35,6 +35,15 @@ class PrototypeInfo : public Struct {
   inline Map ObjectCreateMap();
   inline bool HasObjectCreateMap();
 
+  // [for_in_cache]: A WeakFixedArray of kForInCacheLength caching the for-in
+  // keys of one receiver map that has this prototype, or undefined. The keys
+  // are valid as long as the recorded prototype validity cell is.
+  DECL_ACCESSORS(for_in_cache, Object)
+  static const int kForInCacheMapIndex = 0;
+  static const int kForInCacheValidityCellIndex = 1;
+  static const int kForInCacheKeysIndex = 2;
+  static const int kForInCacheLength = 3;
+
   // [registry_slot]: Slot in prototype's user registry where this user
   // is stored. Returns UNREGISTERED if this prototype has not been registered.
   inline int registry_slot() const;
@@ -59,6 +68,7 @@ class PrototypeInfo : public Struct {
   V(kRegistrySlotOffset, kTaggedSize)      \
   V(kValidityCellOffset, kTaggedSize)      \
   V(kObjectCreateMapOffset, kTaggedSize)   \
+  V(kForInCacheOffset, kTaggedSize)        \
   V(kBitFieldOffset, kTaggedSize)          \
   /* Total size. */                        \
   V(kSize, 0)
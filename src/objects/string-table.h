@@ -80,7 +80,9 @@ class StringTable : public HashTable<StringTable, StringTableShape> {
   static Address LookupStringIfExists_NoAllocate(Isolate* isolate,
                                                  Address raw_string);
 
-  static void EnsureCapacityForDeserialization(Isolate* isolate, int expected);
+  // Grows the string table so that |expected| more strings can be added
+  // without further rehashing.
+  static void EnsureCapacityForBulkInsertion(Isolate* isolate, int expected);
 
   DECL_CAST2(StringTable)
 
@@ -619,6 +619,11 @@ class ConsString : public String {
   // Minimum length for a cons string.
   static const int kMinLength = 13;
 
+  // Maximum length of a sequential right-hand side that appending to a cons
+  // string extends by copying, instead of adding another level of cons
+  // strings.
+  static const int kMaxCoalescedLength = 64;
+
   typedef FixedBodyDescriptor<kFirstOffset, kSize, kSize> BodyDescriptor;
 
   DECL_VERIFIER(ConsString)
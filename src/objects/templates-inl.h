@@ -80,6 +80,8 @@ RARE_ACCESSORS(indexed_property_handler, IndexedPropertyHandler, Object)
 RARE_ACCESSORS(instance_template, InstanceTemplate, Object)
 RARE_ACCESSORS(instance_call_handler, InstanceCallHandler, Object)
 RARE_ACCESSORS(access_check_info, AccessCheckInfo, Object)
+RARE_ACCESSORS(c_function, CFunction, Object)
+RARE_ACCESSORS(c_signature, CSignature, Object)
 #undef RARE_ACCESSORS
 
 ACCESSORS(FunctionTemplateRareData, prototype_template, Object,
@@ -98,6 +100,8 @@ ACCESSORS(FunctionTemplateRareData, instance_call_handler, Object,
           kInstanceCallHandlerOffset)
 ACCESSORS(FunctionTemplateRareData, access_check_info, Object,
           kAccessCheckInfoOffset)
+ACCESSORS(FunctionTemplateRareData, c_function, Object, kCFunctionOffset)
+ACCESSORS(FunctionTemplateRareData, c_signature, Object, kCSignatureOffset)
 
 ACCESSORS(ObjectTemplateInfo, constructor, Object, kConstructorOffset)
 ACCESSORS(ObjectTemplateInfo, data, Object, kDataOffset)
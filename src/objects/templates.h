@@ -61,6 +61,8 @@ class FunctionTemplateRareData : public Struct {
   DECL_ACCESSORS(instance_template, Object)
   DECL_ACCESSORS(instance_call_handler, Object)
   DECL_ACCESSORS(access_check_info, Object)
+  DECL_ACCESSORS(c_function, Object)
+  DECL_ACCESSORS(c_signature, Object)
 
   DECL_CAST(FunctionTemplateRareData)
 
@@ -78,6 +80,8 @@ class FunctionTemplateRareData : public Struct {
   V(kInstanceTemplateOffset, kTaggedSize)          \
   V(kInstanceCallHandlerOffset, kTaggedSize)       \
   V(kAccessCheckInfoOffset, kTaggedSize)           \
+  V(kCFunctionOffset, kTaggedSize)                 \
+  V(kCSignatureOffset, kTaggedSize)                \
   /* Total size. */                                \
   V(kSize, 0)
 
@@ -146,6 +150,12 @@ class FunctionTemplateInfo : public TemplateInfo {
   DECL_RARE_ACCESSORS(instance_call_handler, InstanceCallHandler, Object)
 
   DECL_RARE_ACCESSORS(access_check_info, AccessCheckInfo, Object)
+
+  // Either a Foreign holding the address of the embedder's fast C function
+  // or Undefined, see v8-fast-api-calls.h. If present, {c_signature} holds
+  // the v8::CFunctionInfo describing its parameter and return types.
+  DECL_RARE_ACCESSORS(c_function, CFunction, Object)
+  DECL_RARE_ACCESSORS(c_signature, CSignature, Object)
 #undef DECL_RARE_ACCESSORS
 
   DECL_ACCESSORS(shared_function_info, Object)
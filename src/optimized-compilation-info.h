@@ -51,7 +51,9 @@ class V8_EXPORT_PRIVATE OptimizedCompilationInfo final {
     kTraceTurboJson = 1 << 14,
     kTraceTurboGraph = 1 << 15,
     kTraceTurboScheduled = 1 << 16,
-    kWasmRuntimeExceptionSupport = 1 << 17
+    kWasmRuntimeExceptionSupport = 1 << 17,
+    kFastPipeline = 1 << 18,
+    kConservativeSpeculation = 1 << 19
   };
 
   // Construct a compilation info for optimized compilation.
@@ -118,6 +120,18 @@ class V8_EXPORT_PRIVATE OptimizedCompilationInfo final {
   void MarkAsLoopPeelingEnabled() { SetFlag(kLoopPeelingEnabled); }
   bool is_loop_peeling_enabled() const { return GetFlag(kLoopPeelingEnabled); }
 
+  // The fast pipeline skips the most expensive optimizations and register
+  // allocation refinements to reduce compile time for very large functions.
+  void MarkAsFastPipeline() { SetFlag(kFastPipeline); }
+  bool is_fast_pipeline() const { return GetFlag(kFastPipeline); }
+
+  // Conservative speculation ignores small integer feedback for number
+  // operations, for functions stuck in a deoptimization loop.
+  void MarkAsConservativeSpeculation() { SetFlag(kConservativeSpeculation); }
+  bool is_conservative_speculation() const {
+    return GetFlag(kConservativeSpeculation);
+  }
+
   bool has_untrusted_code_mitigations() const {
     return GetFlag(kUntrustedCodeMitigations);
   }
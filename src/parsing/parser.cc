@@ -2455,7 +2455,8 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
   }
 
   FunctionLiteral::EagerCompileHint eager_compile_hint =
-      function_state_->next_function_is_likely_called() || is_wrapped
+      function_state_->next_function_is_likely_called() || is_wrapped ||
+              scanner()->HasCompileHint(pos)
           ? FunctionLiteral::kShouldEagerCompile
           : default_eager_compile_hint();
 
@@ -2531,9 +2532,14 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
 
   // If parallel compile tasks are enabled, and the function is an eager
   // top level function, then we can pre-parse the function and parse / compile
-  // in a parallel task on a worker thread.
+  // in a parallel task on a worker thread. With
+  // --parallel-compile-tasks-for-lazy the same is done for lazy top level
+  // functions, so that the full parse of their bodies happens on workers
+  // before they are first called.
   bool should_post_parallel_task =
-      parse_lazily() && is_eager_top_level_function &&
+      parse_lazily() &&
+      (is_eager_top_level_function ||
+       (FLAG_parallel_compile_tasks_for_lazy && is_lazy_top_level_function)) &&
       FLAG_parallel_compile_tasks && info()->parallel_tasks() &&
       scanner()->stream()->can_be_cloned_for_parallel_access();
 
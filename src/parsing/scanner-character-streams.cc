@@ -564,7 +564,21 @@ void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
   }
 
   size_t it = current_.pos.bytes - chunk.start.bytes;
-  while (it < chunk.length && cursor + 1 < buffer_start_ + kBufferSize) {
+  const uint16_t* buffer_limit = buffer_start_ + kBufferSize;
+  while (it < chunk.length && cursor + 1 < buffer_limit) {
+    // Widen runs of ASCII directly, a word at a time. Only the surroundings
+    // of non-ASCII characters go through the decoder.
+    if (state == unibrow::Utf8::State::kAccept) {
+      size_t max_run = std::min(chunk.length - it,
+                                static_cast<size_t>(buffer_limit - cursor - 1));
+      int run = String::NonAsciiStart(
+          reinterpret_cast<const char*>(chunk.data + it),
+          static_cast<int>(max_run));
+      CopyChars(cursor, chunk.data + it, run);
+      cursor += run;
+      it += run;
+      if (it == chunk.length || cursor + 1 >= buffer_limit) break;
+    }
     unibrow::uchar t = unibrow::Utf8::ValueOfIncremental(
         chunk.data[it], &it, &state, &incomplete_char);
     if (V8_LIKELY(t < kUtf8Bom)) {
@@ -0,0 +1,90 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_SCANNER_SIMD_H_
+#define V8_PARSING_SCANNER_SIMD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "src/base/bits.h"
+#include "src/base/build_config.h"
+#include "src/base/macros.h"
+
+#if V8_HOST_ARCH_X64 || V8_HOST_ARCH_IA32
+#include <emmintrin.h>
+#define V8_SCANNER_SIMD_SSE2 1
+#elif V8_HOST_ARCH_ARM64
+#include <arm_neon.h>
+#define V8_SCANNER_SIMD_NEON 1
+#endif
+
+namespace v8 {
+namespace internal {
+
+// Returns true if the UTF-16 code unit |c| is either outside the ASCII range
+// or equal to one of |stop_chars|.
+template <size_t N>
+V8_INLINE bool IsNonAsciiOrOneOf(uint16_t c, const uint16_t (&stop_chars)[N]) {
+  if (c > 0x7F) return true;
+  for (size_t i = 0; i < N; i++) {
+    if (c == stop_chars[i]) return true;
+  }
+  return false;
+}
+
+// Returns a pointer to the first code unit in [start, end) which is either
+// non-ASCII or one of |stop_chars|, or |end| if there is none. The scanner
+// uses this to skip over the bodies of comments and string literals, which
+// are long runs of ASCII in minified code, 8 code units at a time.
+template <size_t N>
+V8_INLINE const uint16_t* FindNonAsciiOrOneOf(const uint16_t* start,
+                                              const uint16_t* end,
+                                              const uint16_t (&stop_chars)[N]) {
+  const uint16_t* cursor = start;
+  static constexpr size_t kStride = 8;
+#if V8_SCANNER_SIMD_SSE2
+  const __m128i non_ascii_mask = _mm_set1_epi16(static_cast<int16_t>(0xFF80));
+  const __m128i zero = _mm_setzero_si128();
+  while (static_cast<size_t>(end - cursor) >= kStride) {
+    __m128i chars =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    // Non-ASCII code units have a bit set in 0xFF80.
+    __m128i match = _mm_andnot_si128(
+        _mm_cmpeq_epi16(_mm_and_si128(chars, non_ascii_mask), zero),
+        _mm_set1_epi16(-1));
+    for (size_t i = 0; i < N; i++) {
+      match = _mm_or_si128(
+          match, _mm_cmpeq_epi16(chars, _mm_set1_epi16(stop_chars[i])));
+    }
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(match));
+    if (mask != 0) {
+      // Each 16-bit lane contributes two bits to the byte mask.
+      return cursor + (base::bits::CountTrailingZeros32(mask) >> 1);
+    }
+    cursor += kStride;
+  }
+#elif V8_SCANNER_SIMD_NEON
+  const uint16x8_t max_ascii = vdupq_n_u16(0x7F);
+  while (static_cast<size_t>(end - cursor) >= kStride) {
+    uint16x8_t chars = vld1q_u16(cursor);
+    uint16x8_t match = vcgtq_u16(chars, max_ascii);
+    for (size_t i = 0; i < N; i++) {
+      match = vorrq_u16(match, vceqq_u16(chars, vdupq_n_u16(stop_chars[i])));
+    }
+    if (vmaxvq_u16(match) != 0) break;  // Locate the match below.
+    cursor += kStride;
+  }
+#endif
+  while (cursor < end && !IsNonAsciiOrOneOf(*cursor, stop_chars)) cursor++;
+  return cursor;
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#undef V8_SCANNER_SIMD_SSE2
+#undef V8_SCANNER_SIMD_NEON
+
+#endif  // V8_PARSING_SCANNER_SIMD_H_
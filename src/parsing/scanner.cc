@@ -70,8 +70,8 @@ int Scanner::LiteralBuffer::NewCapacity(int min_capacity) {
   return new_capacity;
 }
 
-void Scanner::LiteralBuffer::ExpandBuffer() {
-  Vector<byte> new_store = Vector<byte>::New(NewCapacity(kInitialCapacity));
+void Scanner::LiteralBuffer::ExpandBuffer(int min_capacity) {
+  Vector<byte> new_store = Vector<byte>::New(NewCapacity(min_capacity));
   MemCopy(new_store.start(), backing_store_.start(), position_);
   backing_store_.Dispose();
   backing_store_ = new_store;
@@ -285,7 +285,11 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](uc32 c0_) { return unibrow::IsLineTerminator(c0_); });
+  static const uint16_t kLineTerminators[] = {'\n', '\r'};
+  do {
+    // Non-ASCII characters other than U+2028/U+2029 are part of the comment.
+    SkipUntilNonAsciiOrOneOf(kLineTerminators);
+  } while (c0_ != kEndOfInput && !unibrow::IsLineTerminator(c0_));
 
   return Token::WHITESPACE;
 }
@@ -316,10 +320,13 @@ void Scanner::TryToParseSourceURLComment() {
   if (!name.is_one_byte()) return;
   Vector<const uint8_t> name_literal = name.one_byte_literal();
   LiteralBuffer* value;
+  LiteralBuffer compile_hints;
   if (name_literal == STATIC_CHAR_VECTOR("sourceURL")) {
     value = &source_url_;
   } else if (name_literal == STATIC_CHAR_VECTOR("sourceMappingURL")) {
     value = &source_mapping_url_;
+  } else if (name_literal == STATIC_CHAR_VECTOR("compileHints")) {
+    value = &compile_hints;
   } else {
     return;
   }
@@ -350,6 +357,34 @@ void Scanner::TryToParseSourceURLComment() {
     }
     Advance();
   }
+  if (value == &compile_hints && compile_hints.is_one_byte()) {
+    AddCompileHints(compile_hints.one_byte_literal());
+  }
+}
+
+void Scanner::AddCompileHints(Vector<const uint8_t> positions) {
+  // The value is a comma-separated list of decimal source positions. The
+  // whole comment is ignored if it is malformed.
+  std::vector<int> hints;
+  int position = 0;
+  bool has_digits = false;
+  for (int i = 0; i <= positions.length(); i++) {
+    if (i == positions.length() || positions[i] == ',') {
+      if (!has_digits) return;
+      hints.push_back(position);
+      position = 0;
+      has_digits = false;
+    } else if (IsDecimalDigit(positions[i])) {
+      int digit = positions[i] - '0';
+      if (position > (kMaxInt - digit) / 10) return;
+      position = position * 10 + digit;
+      has_digits = true;
+    } else {
+      return;
+    }
+  }
+  compile_hints_.insert(compile_hints_.end(), hints.begin(), hints.end());
+  std::sort(compile_hints_.begin(), compile_hints_.end());
 }
 
 Token::Value Scanner::SkipMultiLineComment() {
@@ -371,7 +406,9 @@ Token::Value Scanner::SkipMultiLineComment() {
         return Token::WHITESPACE;
       }
     }
-    Advance();
+    // Skip to the next character the loop above has to look at.
+    static const uint16_t kCommentStops[] = {'*', '\n', '\r'};
+    SkipUntilNonAsciiOrOneOf(kCommentStops);
   }
 
   // Unterminated multi-line comment.
@@ -518,19 +555,18 @@ Token::Value Scanner::ScanString() {
          !unibrow::IsStringLiteralLineTerminator(c0_)) ||
         !MayTerminateString(character_scan_flags[c0_])) {
       AddLiteralChar(c0_);
-      AdvanceUntil([this](uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
-            return true;
-          }
-          AddLiteralChar(c0);
-          return false;
+      static const uint16_t kStringStops[] = {'\'', '"', '\\', '\n', '\r'};
+      while (true) {
+        c0_ = source_->AdvanceUntilNonAsciiOrOneOf(
+            kStringStops, [this](const uint16_t* start, const uint16_t* end) {
+              next().literal_chars.AddAsciiChars(start, end);
+            });
+        if (c0_ == kEndOfInput || static_cast<uint32_t>(c0_) <= kMaxAscii ||
+            unibrow::IsStringLiteralLineTerminator(c0_)) {
+          break;
         }
-        uint8_t char_flags = character_scan_flags[c0];
-        if (MayTerminateString(char_flags)) return true;
-        AddLiteralChar(c0);
-        return false;
-      });
+        AddLiteralChar(c0_);
+      }
     }
     if (c0_ == quote) {
       Advance();
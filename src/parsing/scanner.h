@@ -8,12 +8,14 @@
 #define V8_PARSING_SCANNER_H_
 
 #include <algorithm>
+#include <vector>
 
 #include "src/allocation.h"
 #include "src/base/logging.h"
 #include "src/char-predicates.h"
 #include "src/globals.h"
 #include "src/message-template.h"
+#include "src/parsing/scanner-simd.h"
 #include "src/parsing/token.h"
 #include "src/pointer-with-payload.h"
 #include "src/unicode-decoder.h"
@@ -90,6 +92,31 @@ class Utf16CharacterStream {
     }
   }
 
+  // Like AdvanceUntil, but stops at the first code unit that is non-ASCII or
+  // one of |stop_chars|, and searches for it with SIMD where available. The
+  // code units skipped in each buffered block are passed to |on_run| as a
+  // [start, end) range.
+  template <size_t N, typename RunCallback>
+  V8_INLINE uc32 AdvanceUntilNonAsciiOrOneOf(const uint16_t (&stop_chars)[N],
+                                             RunCallback on_run) {
+    while (true) {
+      const uint16_t* next_cursor_pos =
+          FindNonAsciiOrOneOf(buffer_cursor_, buffer_end_, stop_chars);
+      on_run(buffer_cursor_, next_cursor_pos);
+
+      if (next_cursor_pos == buffer_end_) {
+        buffer_cursor_ = buffer_end_;
+        if (!ReadBlockChecked()) {
+          buffer_cursor_++;
+          return kEndOfInput;
+        }
+      } else {
+        buffer_cursor_ = next_cursor_pos + 1;
+        return static_cast<uc32>(*next_cursor_pos);
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -391,6 +418,14 @@ class Scanner {
   Handle<String> SourceUrl(Isolate* isolate) const;
   Handle<String> SourceMappingUrl(Isolate* isolate) const;
 
+  // Returns true if a //# compileHints= magic comment seen so far lists
+  // |position| as the position of a function the embedder expects to be
+  // called during startup.
+  bool HasCompileHint(int position) const {
+    return std::binary_search(compile_hints_.begin(), compile_hints_.end(),
+                              position);
+  }
+
   bool FoundHtmlComment() const { return found_html_comment_; }
 
   bool allow_harmony_private_fields() const {
@@ -437,6 +472,23 @@ class Scanner {
       AddTwoByteChar(code_unit);
     }
 
+    // Adds a run of ASCII code units.
+    V8_INLINE void AddAsciiChars(const uint16_t* start, const uint16_t* end) {
+      if (!is_one_byte()) {
+        for (const uint16_t* c = start; c < end; c++) AddTwoByteChar(*c);
+        return;
+      }
+      int count = static_cast<int>(end - start);
+      if (position_ + count > backing_store_.length()) {
+        ExpandBuffer(position_ + count);
+      }
+      for (int i = 0; i < count; i++) {
+        DCHECK_LE(start[i], unibrow::Utf8::kMaxOneByteChar);
+        backing_store_[position_ + i] = static_cast<byte>(start[i]);
+      }
+      position_ += count;
+    }
+
     bool is_one_byte() const { return is_one_byte_; }
 
     bool Equals(Vector<const char> keyword) const {
@@ -490,7 +542,7 @@ class Scanner {
 
     void AddTwoByteChar(uc32 code_unit);
     int NewCapacity(int min_capacity);
-    void ExpandBuffer();
+    void ExpandBuffer(int min_capacity = kInitialCapacity);
     void ConvertToTwoByte();
 
     Vector<byte> backing_store_;
@@ -600,6 +652,14 @@ class Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  // Skips to the next code unit that is non-ASCII or one of |stop_chars|,
+  // without recording the skipped characters.
+  template <size_t N>
+  V8_INLINE void SkipUntilNonAsciiOrOneOf(const uint16_t (&stop_chars)[N]) {
+    c0_ = source_->AdvanceUntilNonAsciiOrOneOf(
+        stop_chars, [](const uint16_t* start, const uint16_t* end) {});
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
@@ -710,6 +770,7 @@ class Scanner {
   Token::Value SkipSingleLineComment();
   Token::Value SkipSourceURLComment();
   void TryToParseSourceURLComment();
+  void AddCompileHints(Vector<const uint8_t> positions);
   Token::Value SkipMultiLineComment();
   // Scans a possible HTML comment -- begins with '<!'.
   Token::Value ScanHtmlComment();
@@ -799,6 +860,8 @@ class Scanner {
   // Values parsed from magic comments.
   LiteralBuffer source_url_;
   LiteralBuffer source_mapping_url_;
+  // Sorted function positions from //# compileHints= comments.
+  std::vector<int> compile_hints_;
 
   // Last-seen positions of potentially problematic tokens.
   Location octal_pos_;
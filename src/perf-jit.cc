@@ -85,6 +85,16 @@ struct PerfJitCodeLoad : PerfJitBase {
   uint64_t code_id_;
 };
 
+struct PerfJitCodeMove : PerfJitBase {
+  uint32_t process_id_;
+  uint32_t thread_id_;
+  uint64_t vma_;
+  uint64_t old_code_address_;
+  uint64_t new_code_address_;
+  uint64_t code_size_;
+  uint64_t code_id_;
+};
+
 struct PerfJitDebugEntry {
   uint64_t address_;
   int line_number_;
@@ -116,6 +126,8 @@ uint64_t PerfJitLogger::reference_count_ = 0;
 void* PerfJitLogger::marker_address_ = nullptr;
 uint64_t PerfJitLogger::code_index_ = 0;
 FILE* PerfJitLogger::perf_output_handle_ = nullptr;
+std::unordered_map<const uint8_t*, uint64_t>* PerfJitLogger::code_indices_ =
+    nullptr;
 
 void PerfJitLogger::OpenJitDumpFile() {
   // Open the perf JIT dump file.
@@ -172,6 +184,7 @@ PerfJitLogger::PerfJitLogger(Isolate* isolate) : CodeEventLogger(isolate) {
   if (reference_count_ == 1) {
     OpenJitDumpFile();
     if (perf_output_handle_ == nullptr) return;
+    code_indices_ = new std::unordered_map<const uint8_t*, uint64_t>();
     LogWriteHeader();
   }
 }
@@ -183,6 +196,8 @@ PerfJitLogger::~PerfJitLogger() {
   // If this was the last logger, close the file.
   if (reference_count_ == 0) {
     CloseJitDumpFile();
+    delete code_indices_;
+    code_indices_ = nullptr;
   }
 }
 
@@ -195,6 +210,17 @@ uint64_t PerfJitLogger::GetTimestamp() {
   return (ts.tv_sec * kNsecPerSec) + ts.tv_nsec;
 }
 
+namespace {
+
+uint32_t GetCodeSize(Code code) {
+  // Code generated by Turbofan will have the safepoint table directly after
+  // instructions. There is no need to record the safepoint table itself.
+  return code->is_turbofanned() ? code->safepoint_table_offset()
+                                : code->InstructionSize();
+}
+
+}  // namespace
+
 void PerfJitLogger::LogRecordedBuffer(AbstractCode abstract_code,
                                       SharedFunctionInfo shared,
                                       const char* name, int length) {
@@ -224,10 +250,7 @@ void PerfJitLogger::LogRecordedBuffer(AbstractCode abstract_code,
 
   const char* code_name = name;
   uint8_t* code_pointer = reinterpret_cast<uint8_t*>(code->InstructionStart());
-  // Code generated by Turbofan will have the safepoint table directly after
-  // instructions. There is no need to record the safepoint table itself.
-  uint32_t code_size = code->is_turbofanned() ? code->safepoint_table_offset()
-                                              : code->InstructionSize();
+  uint32_t code_size = GetCodeSize(code);
 
   // Unwinding info comes right after debug info.
   if (FLAG_perf_prof_unwinding_info) LogWriteUnwindingInfo(code);
@@ -262,6 +285,7 @@ void PerfJitLogger::WriteJitCodeLoadEntry(const uint8_t* code_pointer,
   code_load.code_size_ = code_size;
   code_load.code_id_ = code_index_;
 
+  (*code_indices_)[code_pointer] = code_index_;
   code_index_++;
 
   LogWriteBytes(reinterpret_cast<const char*>(&code_load), sizeof(code_load));
@@ -421,10 +445,49 @@ void PerfJitLogger::LogWriteUnwindingInfo(Code code) {
   LogWriteBytes(padding_bytes, static_cast<int>(padding_size));
 }
 
+void PerfJitLogger::WriteJitCodeMoveEntry(uint64_t code_index,
+                                          const uint8_t* from_pointer,
+                                          const uint8_t* to_pointer,
+                                          uint32_t code_size) {
+  PerfJitCodeMove code_move;
+  code_move.event_ = PerfJitCodeMove::kMove;
+  code_move.size_ = sizeof(code_move);
+  code_move.time_stamp_ = GetTimestamp();
+  code_move.process_id_ =
+      static_cast<uint32_t>(base::OS::GetCurrentProcessId());
+  code_move.thread_id_ = static_cast<uint32_t>(base::OS::GetCurrentThreadId());
+  code_move.vma_ = reinterpret_cast<uint64_t>(to_pointer);
+  code_move.old_code_address_ = reinterpret_cast<uint64_t>(from_pointer);
+  code_move.new_code_address_ = reinterpret_cast<uint64_t>(to_pointer);
+  code_move.code_size_ = code_size;
+  code_move.code_id_ = code_index;
+
+  LogWriteBytes(reinterpret_cast<const char*>(&code_move), sizeof(code_move));
+}
+
 void PerfJitLogger::CodeMoveEvent(AbstractCode from, AbstractCode to) {
-  // We may receive a CodeMove event if a BytecodeArray object moves. Otherwise
-  // code relocation is not supported.
-  CHECK(from->IsBytecodeArray());
+  // Only Code objects got load records, BytecodeArray moves don't matter.
+  if (!to->IsCode()) return;
+
+  // Called from the (possibly parallel) evacuation of the code space. The
+  // object has already been copied, so its header can be read from |to|.
+  base::LockGuard<base::RecursiveMutex> guard_file(file_mutex_.Pointer());
+
+  if (perf_output_handle_ == nullptr) return;
+
+  Code code = to->GetCode();
+  const uint8_t* from_pointer =
+      reinterpret_cast<const uint8_t*>(from->address() + Code::kHeaderSize);
+  const uint8_t* to_pointer =
+      reinterpret_cast<const uint8_t*>(code->raw_instruction_start());
+  auto it = code_indices_->find(from_pointer);
+  if (it == code_indices_->end()) return;
+  uint64_t code_index = it->second;
+  code_indices_->erase(it);
+  (*code_indices_)[to_pointer] = code_index;
+
+  WriteJitCodeMoveEntry(code_index, from_pointer, to_pointer,
+                        GetCodeSize(code));
 }
 
 void PerfJitLogger::LogWriteBytes(const char* bytes, int size) {
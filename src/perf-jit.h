@@ -28,6 +28,8 @@
 #ifndef V8_PERF_JIT_H_
 #define V8_PERF_JIT_H_
 
+#include <unordered_map>
+
 #include "src/log.h"
 
 namespace v8 {
@@ -67,6 +69,8 @@ class PerfJitLogger : public CodeEventLogger {
 
   void WriteJitCodeLoadEntry(const uint8_t* code_pointer, uint32_t code_size,
                              const char* name, int name_length);
+  void WriteJitCodeMoveEntry(uint64_t code_index, const uint8_t* from_pointer,
+                             const uint8_t* to_pointer, uint32_t code_size);
 
   void LogWriteBytes(const char* bytes, int size);
   void LogWriteHeader();
@@ -111,6 +115,9 @@ class PerfJitLogger : public CodeEventLogger {
   static uint64_t reference_count_;
   static void* marker_address_;
   static uint64_t code_index_;
+  // Maps the start of every code region that got a load record to its code
+  // index, which move records have to refer to.
+  static std::unordered_map<const uint8_t*, uint64_t>* code_indices_;
 };
 
 #else
@@ -0,0 +1,127 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/pooled-array-buffer-allocator.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#include "src/base/bits.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+void* SystemCalloc(size_t length) {
+#if V8_OS_AIX && _LINUX_SOURCE_COMPAT
+  // Work around for GCC bug on AIX
+  // See: https://gcc.gnu.org/bugzilla/show_bug.cgi?id=79839
+  return __linux_calloc(length, 1);
+#else
+  return calloc(length, 1);
+#endif
+}
+
+void* SystemMalloc(size_t length) {
+#if V8_OS_AIX && _LINUX_SOURCE_COMPAT
+  // Work around for GCC bug on AIX
+  // See: https://gcc.gnu.org/bugzilla/show_bug.cgi?id=79839
+  return __linux_malloc(length);
+#else
+  return malloc(length);
+#endif
+}
+
+}  // namespace
+
+PooledArrayBufferAllocator::PooledArrayBufferAllocator() = default;
+
+PooledArrayBufferAllocator::~PooledArrayBufferAllocator() {
+  ReleaseCachedMemory();
+}
+
+// static
+int PooledArrayBufferAllocator::SizeClassFor(size_t length) {
+  if (length == 0 || length > kMaxPooledSize) return -1;
+  if (length <= kMinPooledSize) return 0;
+  int power = 64 - base::bits::CountLeadingZeros64(length - 1);
+  DCHECK_LE(length, size_t{1} << power);
+  return power - kMinSizeClassPower;
+}
+
+void* PooledArrayBufferAllocator::TakeFromPool(int size_class) {
+  SizeClass& pool = size_classes_[size_class];
+  base::MutexGuard guard(&pool.mutex);
+  FreeBlock* block = pool.head;
+  if (block == nullptr) return nullptr;
+  pool.head = block->next;
+  pool.pooled_blocks--;
+  return block;
+}
+
+void* PooledArrayBufferAllocator::Allocate(size_t length) {
+  int size_class = SizeClassFor(length);
+  if (size_class < 0) return SystemCalloc(length);
+  if (void* data = TakeFromPool(size_class)) {
+    // Reused blocks are dirty, but only the requested part is ever read.
+    memset(data, 0, length);
+    return data;
+  }
+  return SystemCalloc(BlockSize(size_class));
+}
+
+void* PooledArrayBufferAllocator::AllocateUninitialized(size_t length) {
+  int size_class = SizeClassFor(length);
+  if (size_class < 0) return SystemMalloc(length);
+  if (void* data = TakeFromPool(size_class)) return data;
+  return SystemMalloc(BlockSize(size_class));
+}
+
+void PooledArrayBufferAllocator::Free(void* data, size_t length) {
+  if (data == nullptr) return;
+  int size_class = SizeClassFor(length);
+  if (size_class >= 0) {
+    SizeClass& pool = size_classes_[size_class];
+    base::MutexGuard guard(&pool.mutex);
+    if ((pool.pooled_blocks + 1) * BlockSize(size_class) <=
+        kMaxPoolSizePerClass) {
+      FreeBlock* block = reinterpret_cast<FreeBlock*>(data);
+      block->next = pool.head;
+      pool.head = block;
+      pool.pooled_blocks++;
+      return;
+    }
+  }
+  free(data);
+}
+
+void PooledArrayBufferAllocator::ReleaseCachedMemory() {
+  for (SizeClass& pool : size_classes_) {
+    FreeBlock* block;
+    {
+      base::MutexGuard guard(&pool.mutex);
+      block = pool.head;
+      pool.head = nullptr;
+      pool.pooled_blocks = 0;
+    }
+    while (block != nullptr) {
+      FreeBlock* next = block->next;
+      free(block);
+      block = next;
+    }
+  }
+}
+
+size_t PooledArrayBufferAllocator::GetPoolSize() const {
+  size_t size = 0;
+  for (int i = 0; i < kNumberOfSizeClasses; i++) {
+    base::MutexGuard guard(&size_classes_[i].mutex);
+    size += size_classes_[i].pooled_blocks * BlockSize(i);
+  }
+  return size;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,76 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_POOLED_ARRAY_BUFFER_ALLOCATOR_H_
+#define V8_POOLED_ARRAY_BUFFER_ALLOCATOR_H_
+
+#include "include/v8.h"
+#include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+#include "src/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// An ArrayBuffer::Allocator that keeps freed backing stores of up to
+// kMaxPooledSize bytes in per-size-class free lists, so that short-lived
+// small buffers do not go through malloc and free every time. Blocks that
+// come from the system are zeroed by calloc, and only reused blocks have to
+// be cleared again.
+class V8_EXPORT_PRIVATE PooledArrayBufferAllocator final
+    : public v8::ArrayBuffer::Allocator {
+ public:
+  static const size_t kMinPooledSize = 64;
+  static const size_t kMaxPooledSize = 64 * KB;
+  // The number of bytes each size class may keep around for reuse.
+  static const size_t kMaxPoolSizePerClass = 512 * KB;
+
+  PooledArrayBufferAllocator();
+  ~PooledArrayBufferAllocator() override;
+
+  void* Allocate(size_t length) override;
+  void* AllocateUninitialized(size_t length) override;
+  void Free(void* data, size_t length) override;
+  void ReleaseCachedMemory() override;
+
+  // The number of bytes currently kept in the free lists.
+  size_t GetPoolSize() const;
+
+ private:
+  static const int kMinSizeClassPower = 6;
+  static const int kMaxSizeClassPower = 16;
+  static const int kNumberOfSizeClasses =
+      kMaxSizeClassPower - kMinSizeClassPower + 1;
+  STATIC_ASSERT(size_t{1} << kMinSizeClassPower == kMinPooledSize);
+  STATIC_ASSERT(size_t{1} << kMaxSizeClassPower == kMaxPooledSize);
+
+  // Freed blocks are linked through their first word.
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  struct SizeClass {
+    mutable base::Mutex mutex;
+    FreeBlock* head = nullptr;
+    size_t pooled_blocks = 0;
+  };
+
+  static int SizeClassFor(size_t length);
+  static size_t BlockSize(int size_class) {
+    return size_t{1} << (size_class + kMinSizeClassPower);
+  }
+
+  // Returns a block from the free list of |size_class|, or nullptr if it is
+  // empty.
+  void* TakeFromPool(int size_class);
+
+  SizeClass size_classes_[kNumberOfSizeClasses];
+
+  DISALLOW_COPY_AND_ASSIGN(PooledArrayBufferAllocator);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_POOLED_ARRAY_BUFFER_ALLOCATOR_H_
@@ -353,16 +353,22 @@ void CpuProfiler::CollectSample() {
 }
 
 void CpuProfiler::StartProfiling(const char* title, bool record_samples,
-                                 ProfilingMode mode) {
-  if (profiles_->StartProfiling(title, record_samples, mode)) {
+                                 ProfilingMode mode,
+                                 CpuProfile::SampleBatchCallback callback,
+                                 void* callback_data, int batch_size) {
+  if (profiles_->StartProfiling(title, record_samples, mode, callback,
+                                callback_data, batch_size)) {
     TRACE_EVENT0("v8", "CpuProfiler::StartProfiling");
     StartProcessorIfNotStarted();
   }
 }
 
 void CpuProfiler::StartProfiling(String title, bool record_samples,
-                                 ProfilingMode mode) {
-  StartProfiling(profiles_->GetName(title), record_samples, mode);
+                                 ProfilingMode mode,
+                                 CpuProfile::SampleBatchCallback callback,
+                                 void* callback_data, int batch_size) {
+  StartProfiling(profiles_->GetName(title), record_samples, mode, callback,
+                 callback_data, batch_size);
   isolate_->debug()->feature_tracker()->Track(DebugFeatureTracker::kProfiler);
 }
 
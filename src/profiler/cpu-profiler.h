@@ -223,8 +223,12 @@ class CpuProfiler {
   void set_sampling_interval(base::TimeDelta value);
   void CollectSample();
   void StartProfiling(const char* title, bool record_samples = false,
-                      ProfilingMode mode = ProfilingMode::kLeafNodeLineNumbers);
-  void StartProfiling(String title, bool record_samples, ProfilingMode mode);
+                      ProfilingMode mode = ProfilingMode::kLeafNodeLineNumbers,
+                      CpuProfile::SampleBatchCallback callback = nullptr,
+                      void* callback_data = nullptr, int batch_size = 0);
+  void StartProfiling(String title, bool record_samples, ProfilingMode mode,
+                      CpuProfile::SampleBatchCallback callback = nullptr,
+                      void* callback_data = nullptr, int batch_size = 0);
   CpuProfile* StopProfiling(const char* title);
   CpuProfile* StopProfiling(String title);
   int GetProfilesCount();
@@ -2308,6 +2308,16 @@ class OutputStreamWriter {
   void AddSubstring(const char* s, int n) {
     if (n <= 0) return;
     DCHECK(static_cast<size_t>(n) <= strlen(s));
+    AddBytes(s, n);
+  }
+  // Unlike the methods above, these may write arbitrary bytes including \0
+  // and are used for the binary format.
+  void AddByte(uint8_t b) {
+    DCHECK(chunk_pos_ < chunk_size_);
+    chunk_[chunk_pos_++] = static_cast<char>(b);
+    MaybeWriteChunk();
+  }
+  void AddBytes(const char* s, int n) {
     const char* s_end = s + n;
     while (s < s_end) {
       int s_chunk_size =
@@ -2320,6 +2330,14 @@ class OutputStreamWriter {
     }
   }
   void AddNumber(unsigned n) { AddNumberImpl<unsigned>(n, "%u"); }
+  // Writes |n| as an unsigned LEB128 varint.
+  void AddVarint(uint64_t n) {
+    while (n >= 0x80) {
+      AddByte(static_cast<uint8_t>(n | 0x80));
+      n >>= 7;
+    }
+    AddByte(static_cast<uint8_t>(n));
+  }
   void Finalize() {
     if (aborted_) return;
     DCHECK(chunk_pos_ < chunk_size_);
@@ -2863,5 +2881,111 @@ void HeapSnapshotJSONSerializer::SerializeLocations() {
   }
 }
 
+void HeapSnapshotBinarySerializer::Serialize(v8::OutputStream* stream) {
+  DCHECK_NULL(writer_);
+  writer_ = new OutputStreamWriter(stream);
+  SerializeImpl();
+  delete writer_;
+  writer_ = nullptr;
+}
+
+void HeapSnapshotBinarySerializer::SerializeImpl() {
+  DCHECK_EQ(0, snapshot_->root()->index());
+  writer_->AddBytes("V8HS", 4);
+  writer_->AddVarint(kFormatVersion);
+  SerializeNodes();
+  if (writer_->aborted()) return;
+  SerializeEdges();
+  if (writer_->aborted()) return;
+  SerializeLocations();
+  if (writer_->aborted()) return;
+  SerializeSamples();
+  if (writer_->aborted()) return;
+  SerializeStrings();
+  if (writer_->aborted()) return;
+  writer_->Finalize();
+}
+
+int HeapSnapshotBinarySerializer::GetStringId(const char* s) {
+  base::HashMap::Entry* cache_entry = strings_.LookupOrInsert(
+      const_cast<char*>(s), HeapSnapshotJSONSerializer::StringHash(s));
+  if (cache_entry->value == nullptr) {
+    cache_entry->value = reinterpret_cast<void*>(next_string_id_++);
+  }
+  return static_cast<int>(reinterpret_cast<intptr_t>(cache_entry->value));
+}
+
+void HeapSnapshotBinarySerializer::SerializeNodes() {
+  const std::deque<HeapEntry>& entries = snapshot_->entries();
+  writer_->AddVarint(entries.size());
+  for (const HeapEntry& entry : entries) {
+    writer_->AddVarint(entry.type());
+    writer_->AddVarint(GetStringId(entry.name()));
+    writer_->AddVarint(entry.id());
+    writer_->AddVarint(entry.self_size());
+    writer_->AddVarint(entry.children_count());
+    writer_->AddVarint(entry.trace_node_id());
+    if (writer_->aborted()) return;
+  }
+}
+
+void HeapSnapshotBinarySerializer::SerializeEdges() {
+  std::vector<HeapGraphEdge*>& edges = snapshot_->children();
+  writer_->AddVarint(edges.size());
+  for (HeapGraphEdge* edge : edges) {
+    int edge_name_or_index = edge->type() == HeapGraphEdge::kElement ||
+                                     edge->type() == HeapGraphEdge::kHidden
+                                 ? edge->index()
+                                 : GetStringId(edge->name());
+    writer_->AddVarint(edge->type());
+    writer_->AddVarint(edge_name_or_index);
+    // Unlike JSON, edges refer to the ordinal of the target node.
+    writer_->AddVarint(edge->to()->index());
+    if (writer_->aborted()) return;
+  }
+}
+
+void HeapSnapshotBinarySerializer::SerializeLocations() {
+  const std::vector<SourceLocation>& locations = snapshot_->locations();
+  writer_->AddVarint(locations.size());
+  for (const SourceLocation& location : locations) {
+    writer_->AddVarint(location.entry_index);
+    writer_->AddVarint(static_cast<uint32_t>(location.scriptId));
+    writer_->AddVarint(static_cast<uint32_t>(location.line));
+    writer_->AddVarint(static_cast<uint32_t>(location.col));
+    if (writer_->aborted()) return;
+  }
+}
+
+void HeapSnapshotBinarySerializer::SerializeSamples() {
+  const std::vector<HeapObjectsMap::TimeInterval>& samples =
+      snapshot_->profiler()->heap_object_map()->samples();
+  writer_->AddVarint(samples.size());
+  if (samples.empty()) return;
+  base::TimeTicks start_time = samples[0].timestamp;
+  for (const HeapObjectsMap::TimeInterval& sample : samples) {
+    base::TimeDelta time_delta = sample.timestamp - start_time;
+    writer_->AddVarint(static_cast<uint64_t>(time_delta.InMicroseconds()));
+    writer_->AddVarint(sample.last_assigned_id());
+  }
+}
+
+void HeapSnapshotBinarySerializer::SerializeStrings() {
+  ScopedVector<const char*> sorted_strings(strings_.occupancy() + 1);
+  for (base::HashMap::Entry* entry = strings_.Start(); entry != nullptr;
+       entry = strings_.Next(entry)) {
+    int index = static_cast<int>(reinterpret_cast<uintptr_t>(entry->value));
+    sorted_strings[index] = reinterpret_cast<const char*>(entry->key);
+  }
+  // String 0 is reserved, just like the "<dummy>" entry in JSON.
+  writer_->AddVarint(sorted_strings.length() - 1);
+  for (int i = 1; i < sorted_strings.length(); ++i) {
+    int length = StrLength(sorted_strings[i]);
+    writer_->AddVarint(length);
+    writer_->AddBytes(sorted_strings[i], length);
+    if (writer_->aborted()) return;
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -603,12 +603,45 @@ class HeapSnapshotJSONSerializer {
   int next_string_id_;
   OutputStreamWriter* writer_;
 
+  friend class HeapSnapshotBinarySerializer;
   friend class HeapSnapshotJSONSerializerEnumerator;
   friend class HeapSnapshotJSONSerializerIterator;
 
   DISALLOW_COPY_AND_ASSIGN(HeapSnapshotJSONSerializer);
 };
 
+// Writes the nodes, edges, locations, samples and strings of a snapshot in the
+// compact binary layout documented at v8::HeapSnapshot::Serialize. Records
+// are streamed out in the order they are visited, without the text encoding
+// overhead of their JSON counterparts.
+class HeapSnapshotBinarySerializer {
+ public:
+  static const uint32_t kFormatVersion = 1;
+
+  explicit HeapSnapshotBinarySerializer(HeapSnapshot* snapshot)
+      : snapshot_(snapshot),
+        strings_(HeapSnapshotJSONSerializer::StringsMatch),
+        next_string_id_(1),
+        writer_(nullptr) {}
+  void Serialize(v8::OutputStream* stream);
+
+ private:
+  int GetStringId(const char* s);
+  void SerializeImpl();
+  void SerializeNodes();
+  void SerializeEdges();
+  void SerializeLocations();
+  void SerializeSamples();
+  void SerializeStrings();
+
+  HeapSnapshot* snapshot_;
+  base::CustomMatcherHashMap strings_;
+  int next_string_id_;
+  OutputStreamWriter* writer_;
+
+  DISALLOW_COPY_AND_ASSIGN(HeapSnapshotBinarySerializer);
+};
+
 
 }  // namespace internal
 }  // namespace v8
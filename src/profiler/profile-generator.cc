@@ -18,16 +18,24 @@
 namespace v8 {
 namespace internal {
 
-void SourcePositionTable::SetPosition(int pc_offset, int line) {
+void SourcePositionTable::SetPosition(int pc_offset, int line,
+                                      int inlining_id) {
   DCHECK_GE(pc_offset, 0);
   DCHECK_GT(line, 0);  // The 1-based number of the source line.
   // Check that we are inserting in ascending order, so that the vector remains
   // sorted.
   DCHECK(pc_offsets_to_lines_.empty() ||
-         pc_offsets_to_lines_.back().pc_offset < pc_offset);
+         pc_offsets_to_lines_.back().pc_offset <= pc_offset);
+  // Optimized code can have several positions at the same offset, the last
+  // one describes the code that follows.
+  if (!pc_offsets_to_lines_.empty() &&
+      pc_offsets_to_lines_.back().pc_offset == pc_offset) {
+    pc_offsets_to_lines_.pop_back();
+  }
   if (pc_offsets_to_lines_.empty() ||
-      pc_offsets_to_lines_.back().line_number != line) {
-    pc_offsets_to_lines_.push_back({pc_offset, line});
+      pc_offsets_to_lines_.back().line_number != line ||
+      pc_offsets_to_lines_.back().inlining_id != inlining_id) {
+    pc_offsets_to_lines_.push_back({pc_offset, line, inlining_id});
   }
 }
 
@@ -37,11 +45,22 @@ int SourcePositionTable::GetSourceLineNumber(int pc_offset) const {
   }
   auto it =
       std::upper_bound(pc_offsets_to_lines_.begin(), pc_offsets_to_lines_.end(),
-                       PCOffsetAndLineNumber{pc_offset, 0});
+                       SourcePositionTuple{pc_offset, 0, 0});
   if (it != pc_offsets_to_lines_.begin()) --it;
   return it->line_number;
 }
 
+int SourcePositionTable::GetInliningId(int pc_offset) const {
+  if (pc_offsets_to_lines_.empty()) {
+    return SourcePosition::kNotInlined;
+  }
+  auto it =
+      std::upper_bound(pc_offsets_to_lines_.begin(), pc_offsets_to_lines_.end(),
+                       SourcePositionTuple{pc_offset, 0, 0});
+  if (it != pc_offsets_to_lines_.begin()) --it;
+  return it->inlining_id;
+}
+
 const char* const CodeEntry::kWasmResourceNamePrefix = "wasm ";
 const char* const CodeEntry::kEmptyResourceName = "";
 const char* const CodeEntry::kEmptyBailoutReason = "";
@@ -120,15 +139,24 @@ int CodeEntry::GetSourceLine(int pc_offset) const {
 }
 
 void CodeEntry::AddInlineStack(
-    int pc_offset, std::vector<std::unique_ptr<CodeEntry>> inline_stack) {
+    int inlining_id, std::vector<CodeEntryAndLineNumber> inline_stack) {
+  DCHECK_NE(SourcePosition::kNotInlined, inlining_id);
   EnsureRareData()->inline_locations_.insert(
-      std::make_pair(pc_offset, std::move(inline_stack)));
+      std::make_pair(inlining_id, std::move(inline_stack)));
 }
 
-const std::vector<std::unique_ptr<CodeEntry>>* CodeEntry::GetInlineStack(
+CodeEntry* CodeEntry::AddInlinedEntry(std::unique_ptr<CodeEntry> entry) {
+  CodeEntry* result = entry.get();
+  EnsureRareData()->inline_entries_.push_back(std::move(entry));
+  return result;
+}
+
+const std::vector<CodeEntryAndLineNumber>* CodeEntry::GetInlineStack(
     int pc_offset) const {
-  if (!rare_data_) return nullptr;
-  auto it = rare_data_->inline_locations_.find(pc_offset);
+  if (!rare_data_ || !line_info_) return nullptr;
+  int inlining_id = line_info_->GetInliningId(pc_offset);
+  if (inlining_id == SourcePosition::kNotInlined) return nullptr;
+  auto it = rare_data_->inline_locations_.find(inlining_id);
   return it != rare_data_->inline_locations_.end() ? &it->second : nullptr;
 }
 
@@ -389,7 +417,9 @@ using v8::tracing::TracedValue;
 std::atomic<uint32_t> CpuProfile::last_id_;
 
 CpuProfile::CpuProfile(CpuProfiler* profiler, const char* title,
-                       bool record_samples, ProfilingMode mode)
+                       bool record_samples, ProfilingMode mode,
+                       SampleBatchCallback callback, void* callback_data,
+                       int batch_size)
     : title_(title),
       record_samples_(record_samples),
       mode_(mode),
@@ -397,7 +427,11 @@ CpuProfile::CpuProfile(CpuProfiler* profiler, const char* title,
       top_down_(profiler->isolate()),
       profiler_(profiler),
       streaming_next_sample_(0),
+      sample_batch_callback_(callback),
+      sample_batch_callback_data_(callback_data),
+      sample_batch_size_(static_cast<size_t>(batch_size)),
       id_(++last_id_) {
+  DCHECK_IMPLIES(sample_batch_callback_, sample_batch_size_ > 0);
   auto value = TracedValue::Create();
   value->SetDouble("startTime",
                    (start_time_ - base::TimeTicks()).InMicroseconds());
@@ -422,6 +456,20 @@ void CpuProfile::AddPath(base::TimeTicks timestamp,
       top_down_.pending_nodes_count() >= kNodesFlushCount) {
     StreamPendingTraceEvents();
   }
+
+  if (sample_batch_callback_ && samples_.size() >= sample_batch_size_) {
+    FlushSampleBatch();
+  }
+}
+
+void CpuProfile::FlushSampleBatch() {
+  // Emit the trace events first, they refer to the samples being dropped.
+  StreamPendingTraceEvents();
+  sample_batch_callback_(reinterpret_cast<const v8::CpuProfile*>(this),
+                        sample_batch_callback_data_);
+  samples_.clear();
+  timestamps_.clear();
+  streaming_next_sample_ = 0;
 }
 
 namespace {
@@ -499,7 +547,11 @@ void CpuProfile::StreamPendingTraceEvents() {
 
 void CpuProfile::FinishProfile() {
   end_time_ = base::TimeTicks::HighResolutionNow();
-  StreamPendingTraceEvents();
+  if (sample_batch_callback_ && !samples_.empty()) {
+    FlushSampleBatch();
+  } else {
+    StreamPendingTraceEvents();
+  }
   auto value = TracedValue::Create();
   value->SetDouble("endTime", (end_time_ - base::TimeTicks()).InMicroseconds());
   TRACE_EVENT_SAMPLE_WITH_ID1(TRACE_DISABLED_BY_DEFAULT("v8.cpu_profiler"),
@@ -603,9 +655,10 @@ void CodeMap::Print() {
 CpuProfilesCollection::CpuProfilesCollection(Isolate* isolate)
     : profiler_(nullptr), current_profiles_semaphore_(1) {}
 
-bool CpuProfilesCollection::StartProfiling(const char* title,
-                                           bool record_samples,
-                                           ProfilingMode mode) {
+bool CpuProfilesCollection::StartProfiling(
+    const char* title, bool record_samples, ProfilingMode mode,
+    CpuProfile::SampleBatchCallback callback, void* callback_data,
+    int batch_size) {
   current_profiles_semaphore_.Wait();
   if (static_cast<int>(current_profiles_.size()) >= kMaxSimultaneousProfiles) {
     current_profiles_semaphore_.Signal();
@@ -620,7 +673,8 @@ bool CpuProfilesCollection::StartProfiling(const char* title,
     }
   }
   current_profiles_.emplace_back(
-      new CpuProfile(profiler_, title, record_samples, mode));
+      new CpuProfile(profiler_, title, record_samples, mode, callback,
+                     callback_data, batch_size));
   current_profiles_semaphore_.Signal();
   return true;
 }
@@ -686,6 +740,28 @@ void CpuProfilesCollection::AddPathToCurrentProfiles(
 ProfileGenerator::ProfileGenerator(CpuProfilesCollection* profiles)
     : profiles_(profiles) {}
 
+namespace {
+
+// Appends the frames inlined at |pc_offset| of |entry| to |stack_trace|, from
+// the innermost inlined function to |entry| itself. Returns false if there is
+// no inlining at |pc_offset|.
+bool AddInlineFrames(CodeEntry* entry, int pc_offset, int line_number,
+                     ProfileStackTrace* stack_trace) {
+  const std::vector<CodeEntryAndLineNumber>* inline_stack =
+      entry->GetInlineStack(pc_offset);
+  if (!inline_stack) return false;
+  DCHECK(!inline_stack->empty());
+  size_t innermost = stack_trace->size();
+  stack_trace->insert(stack_trace->end(), inline_stack->begin(),
+                      inline_stack->end());
+  // The inline stack is shared by all positions with the same inlining id, so
+  // the line within the innermost function comes from the position itself.
+  (*stack_trace)[innermost].line_number = line_number;
+  return true;
+}
+
+}  // namespace
+
 void ProfileGenerator::RecordTickSample(const TickSample& sample) {
   ProfileStackTrace stack_trace;
   // Conservatively reserve space for stack frames + pc + function + vm-state.
@@ -732,7 +808,9 @@ void ProfileGenerator::RecordTickSample(const TickSample& sample) {
           src_line = pc_entry->line_number();
         }
         src_line_not_found = false;
-        stack_trace.push_back({pc_entry, src_line});
+        if (!AddInlineFrames(pc_entry, pc_offset, src_line, &stack_trace)) {
+          stack_trace.push_back({pc_entry, src_line});
+        }
 
         if (pc_entry->builtin_id() == Builtins::kFunctionPrototypeApply ||
             pc_entry->builtin_id() == Builtins::kFunctionPrototypeCall) {
@@ -755,20 +833,9 @@ void ProfileGenerator::RecordTickSample(const TickSample& sample) {
       CodeEntry* entry = FindEntry(stack_pos);
       int line_number = no_line_info;
       if (entry) {
-        // Find out if the entry has an inlining stack associated.
         int pc_offset =
             static_cast<int>(stack_pos - entry->instruction_start());
         // TODO(petermarshall): pc_offset can still be negative in some cases.
-        const std::vector<std::unique_ptr<CodeEntry>>* inline_stack =
-            entry->GetInlineStack(pc_offset);
-        if (inline_stack) {
-          std::transform(
-              inline_stack->rbegin(), inline_stack->rend(),
-              std::back_inserter(stack_trace),
-              [=](const std::unique_ptr<CodeEntry>& ptr) {
-                return CodeEntryAndLineNumber{ptr.get(), no_line_info};
-              });
-        }
         // Skip unresolved frames (e.g. internal frame) and get source line of
         // the first JS caller.
         if (src_line_not_found) {
@@ -779,6 +846,11 @@ void ProfileGenerator::RecordTickSample(const TickSample& sample) {
           src_line_not_found = false;
         }
         line_number = entry->GetSourceLine(pc_offset);
+        // Optimized code with inlined calls contributes one frame per inlined
+        // function.
+        if (AddInlineFrames(entry, pc_offset, line_number, &stack_trace)) {
+          continue;
+        }
       }
       stack_trace.push_back({entry, line_number});
     }
@@ -23,32 +23,43 @@
 namespace v8 {
 namespace internal {
 
+class CodeEntry;
 struct TickSample;
 
 // Provides a mapping from the offsets within generated code or a bytecode array
-// to the source line.
+// to the source line and the inlining id of the position.
 class SourcePositionTable : public Malloced {
  public:
   SourcePositionTable() = default;
 
-  void SetPosition(int pc_offset, int line);
+  void SetPosition(int pc_offset, int line,
+                   int inlining_id = SourcePosition::kNotInlined);
   int GetSourceLineNumber(int pc_offset) const;
+  int GetInliningId(int pc_offset) const;
 
  private:
-  struct PCOffsetAndLineNumber {
-    bool operator<(const PCOffsetAndLineNumber& other) const {
+  struct SourcePositionTuple {
+    bool operator<(const SourcePositionTuple& other) const {
       return pc_offset < other.pc_offset;
     }
     int pc_offset;
     int line_number;
+    int inlining_id;
   };
-  // This is logically a map, but we store it as a vector of pairs, sorted by
+  // This is logically a map, but we store it as a vector of tuples, sorted by
   // the pc offset, so that we can save space and look up items using binary
   // search.
-  std::vector<PCOffsetAndLineNumber> pc_offsets_to_lines_;
+  std::vector<SourcePositionTuple> pc_offsets_to_lines_;
   DISALLOW_COPY_AND_ASSIGN(SourcePositionTable);
 };
 
+struct CodeEntryAndLineNumber {
+  CodeEntry* code_entry;
+  int line_number;
+};
+
+typedef std::vector<CodeEntryAndLineNumber> ProfileStackTrace;
+
 class CodeEntry {
  public:
   // CodeEntry doesn't own name strings, just references them.
@@ -103,9 +114,13 @@ class CodeEntry {
 
   int GetSourceLine(int pc_offset) const;
 
-  void AddInlineStack(int pc_offset,
-                      std::vector<std::unique_ptr<CodeEntry>> inline_stack);
-  const std::vector<std::unique_ptr<CodeEntry>>* GetInlineStack(
+  // Inline stacks are keyed by the inlining id of the source positions and
+  // list the frames from the innermost inlined function to this function.
+  // The entries of the inlined functions are owned by this entry.
+  void AddInlineStack(int inlining_id,
+                      std::vector<CodeEntryAndLineNumber> inline_stack);
+  CodeEntry* AddInlinedEntry(std::unique_ptr<CodeEntry> entry);
+  const std::vector<CodeEntryAndLineNumber>* GetInlineStack(
       int pc_offset) const;
 
   void set_instruction_start(Address start) { instruction_start_ = start; }
@@ -141,8 +156,9 @@ class CodeEntry {
     const char* deopt_reason_ = kNoDeoptReason;
     const char* bailout_reason_ = kEmptyBailoutReason;
     int deopt_id_ = kNoDeoptimizationId;
-    std::unordered_map<int, std::vector<std::unique_ptr<CodeEntry>>>
+    std::unordered_map<int, std::vector<CodeEntryAndLineNumber>>
         inline_locations_;
+    std::vector<std::unique_ptr<CodeEntry>> inline_entries_;
     std::vector<CpuProfileDeoptFrame> deopt_inlined_frames_;
   };
 
@@ -188,13 +204,6 @@ class CodeEntry {
   DISALLOW_COPY_AND_ASSIGN(CodeEntry);
 };
 
-struct CodeEntryAndLineNumber {
-  CodeEntry* code_entry;
-  int line_number;
-};
-
-typedef std::vector<CodeEntryAndLineNumber> ProfileStackTrace;
-
 class ProfileTree;
 
 class ProfileNode {
@@ -317,9 +326,13 @@ class ProfileTree {
 class CpuProfile {
  public:
   typedef v8::CpuProfilingMode ProfilingMode;
+  typedef v8::CpuProfileSampleBatchCallback SampleBatchCallback;
 
+  // If |callback| is set, the recorded samples are handed to it in batches of
+  // |batch_size| and discarded afterwards.
   CpuProfile(CpuProfiler* profiler, const char* title, bool record_samples,
-             ProfilingMode mode);
+             ProfilingMode mode, SampleBatchCallback callback = nullptr,
+             void* callback_data = nullptr, int batch_size = 0);
 
   // Add pc -> ... -> main() call path to the profile.
   void AddPath(base::TimeTicks timestamp, const ProfileStackTrace& path,
@@ -345,6 +358,7 @@ class CpuProfile {
 
  private:
   void StreamPendingTraceEvents();
+  void FlushSampleBatch();
 
   const char* title_;
   bool record_samples_;
@@ -356,6 +370,9 @@ class CpuProfile {
   ProfileTree top_down_;
   CpuProfiler* const profiler_;
   size_t streaming_next_sample_;
+  SampleBatchCallback sample_batch_callback_;
+  void* sample_batch_callback_data_;
+  size_t sample_batch_size_;
   uint32_t id_;
 
   static std::atomic<uint32_t> last_id_;
@@ -407,7 +424,9 @@ class CpuProfilesCollection {
 
   void set_cpu_profiler(CpuProfiler* profiler) { profiler_ = profiler; }
   bool StartProfiling(const char* title, bool record_samples,
-                      ProfilingMode mode = ProfilingMode::kLeafNodeLineNumbers);
+                      ProfilingMode mode = ProfilingMode::kLeafNodeLineNumbers,
+                      CpuProfile::SampleBatchCallback callback = nullptr,
+                      void* callback_data = nullptr, int batch_size = 0);
   CpuProfile* StopProfiling(const char* title);
   std::vector<std::unique_ptr<CpuProfile>>* profiles() {
     return &finished_profiles_;
@@ -39,7 +39,6 @@ void ProfilerListener::CodeCreateEvent(CodeEventListener::LogEventsAndTags tag,
                             CpuProfileNode::kNoLineNumberInfo,
                             CpuProfileNode::kNoColumnNumberInfo, nullptr,
                             code->InstructionStart());
-  RecordInliningInfo(rec->entry, code);
   rec->instruction_size = code->InstructionSize();
   DispatchCodeEvent(evt_rec);
 }
@@ -53,7 +52,6 @@ void ProfilerListener::CodeCreateEvent(CodeEventListener::LogEventsAndTags tag,
                             CpuProfileNode::kNoLineNumberInfo,
                             CpuProfileNode::kNoColumnNumberInfo, nullptr,
                             code->InstructionStart());
-  RecordInliningInfo(rec->entry, code);
   rec->instruction_size = code->InstructionSize();
   DispatchCodeEvent(evt_rec);
 }
@@ -70,7 +68,6 @@ void ProfilerListener::CodeCreateEvent(CodeEventListener::LogEventsAndTags tag,
                             CpuProfileNode::kNoLineNumberInfo,
                             CpuProfileNode::kNoColumnNumberInfo, nullptr,
                             code->InstructionStart());
-  RecordInliningInfo(rec->entry, code);
   rec->entry->FillFunctionInfo(shared);
   rec->instruction_size = code->InstructionSize();
   DispatchCodeEvent(evt_rec);
@@ -85,24 +82,16 @@ void ProfilerListener::CodeCreateEvent(CodeEventListener::LogEventsAndTags tag,
   rec->instruction_start = abstract_code->InstructionStart();
   std::unique_ptr<SourcePositionTable> line_table;
   if (shared->script()->IsScript()) {
-    Script* script = Script::cast(shared->script());
     line_table.reset(new SourcePositionTable());
-    for (SourcePositionTableIterator it(abstract_code->source_position_table());
-         !it.done(); it.Advance()) {
-      // TODO(alph,tebbi) Skipping inlined positions for now, because they might
-      // refer to a different script.
-      if (it.source_position().InliningId() != SourcePosition::kNotInlined)
-        continue;
-      int position = it.source_position().ScriptOffset();
-      int line_number = script->GetLineNumber(position) + 1;
-      line_table->SetPosition(it.code_offset(), line_number);
-    }
   }
+  SourcePositionTable* positions = line_table.get();
   rec->entry =
       NewCodeEntry(tag, GetName(shared->DebugName()),
                    GetName(InferScriptName(script_name, shared)), line, column,
                    std::move(line_table), abstract_code->InstructionStart());
-  RecordInliningInfo(rec->entry, abstract_code);
+  if (positions) {
+    RecordSourcePositions(rec->entry, positions, abstract_code, shared);
+  }
   rec->entry->FillFunctionInfo(shared);
   rec->instruction_size = abstract_code->InstructionSize();
   DispatchCodeEvent(evt_rec);
@@ -114,10 +103,23 @@ void ProfilerListener::CodeCreateEvent(CodeEventListener::LogEventsAndTags tag,
   CodeEventsContainer evt_rec(CodeEventRecord::CODE_CREATION);
   CodeCreateEventRecord* rec = &evt_rec.CodeCreateEventRecord_;
   rec->instruction_start = code->instruction_start();
+  std::unique_ptr<SourcePositionTable> line_table;
+  if (!code->source_positions().is_empty()) {
+    // Wasm source positions are byte offsets into the function body. Store
+    // them 1-based in place of the line, so that ticks are attributed to the
+    // instruction of the function that was executing.
+    line_table.reset(new SourcePositionTable());
+    for (SourcePositionTableIterator it(code->source_positions()); !it.done();
+         it.Advance()) {
+      int byte_offset = it.source_position().ScriptOffset();
+      if (byte_offset < 0) continue;
+      line_table->SetPosition(it.code_offset(), byte_offset + 1);
+    }
+  }
   rec->entry = NewCodeEntry(
       tag, GetName(name.start()), CodeEntry::kWasmResourceNamePrefix,
       CpuProfileNode::kNoLineNumberInfo, CpuProfileNode::kNoColumnNumberInfo,
-      nullptr, code->instruction_start());
+      std::move(line_table), code->instruction_start());
   rec->instruction_size = code->instructions().length();
   DispatchCodeEvent(evt_rec);
 }
@@ -195,58 +197,80 @@ Name ProfilerListener::InferScriptName(Name name, SharedFunctionInfo info) {
   return source_url->IsName() ? Name::cast(source_url) : name;
 }
 
-void ProfilerListener::RecordInliningInfo(CodeEntry* entry,
-                                          AbstractCode abstract_code) {
-  if (!abstract_code->IsCode()) return;
-  Code code = abstract_code->GetCode();
-  if (code->kind() != Code::OPTIMIZED_FUNCTION) return;
-  DeoptimizationData deopt_input_data =
-      DeoptimizationData::cast(code->deoptimization_data());
-  int deopt_count = deopt_input_data->DeoptCount();
-  for (int i = 0; i < deopt_count; i++) {
-    int pc_offset = deopt_input_data->Pc(i)->value();
-    if (pc_offset == -1) continue;
-    int translation_index = deopt_input_data->TranslationIndex(i)->value();
-    TranslationIterator it(deopt_input_data->TranslationByteArray(),
-                           translation_index);
-    Translation::Opcode opcode = static_cast<Translation::Opcode>(it.Next());
-    DCHECK_EQ(Translation::BEGIN, opcode);
-    it.Skip(Translation::NumberOfOperandsFor(opcode));
-    int depth = 0;
-    std::vector<std::unique_ptr<CodeEntry>> inline_stack;
-    while (it.HasNext() &&
-           Translation::BEGIN !=
-               (opcode = static_cast<Translation::Opcode>(it.Next()))) {
-      if (opcode != Translation::INTERPRETED_FRAME) {
-        it.Skip(Translation::NumberOfOperandsFor(opcode));
-        continue;
+namespace {
+
+// Returns the 1-based line of |script_offset| in the script of |shared|.
+int GetLineNumber(SharedFunctionInfo shared, int script_offset) {
+  if (!shared->script()->IsScript() || script_offset == kNoSourcePosition) {
+    return CpuProfileNode::kNoLineNumberInfo;
+  }
+  return Script::cast(shared->script())->GetLineNumber(script_offset) + 1;
+}
+
+}  // namespace
+
+void ProfilerListener::RecordSourcePositions(CodeEntry* entry,
+                                             SourcePositionTable* line_table,
+                                             AbstractCode abstract_code,
+                                             SharedFunctionInfo shared) {
+  // Entries for the inlined functions, indexed by their literal id in the
+  // deoptimization data, so that all inline stacks of the code share them.
+  std::unordered_map<int, CodeEntry*> inlined_entries;
+  for (SourcePositionTableIterator it(abstract_code->source_position_table());
+       !it.done(); it.Advance()) {
+    SourcePosition position = it.source_position();
+    int inlining_id = position.InliningId();
+    if (inlining_id == SourcePosition::kNotInlined) {
+      int line_number = GetLineNumber(shared, position.ScriptOffset());
+      if (line_number != CpuProfileNode::kNoLineNumberInfo) {
+        line_table->SetPosition(it.code_offset(), line_number);
       }
-      it.Next();  // Skip ast_id
-      int shared_info_id = it.Next();
-      it.Next();  // Skip height
-      it.Next();  // Skip return value offset
-      it.Next();  // Skip return value count
-      SharedFunctionInfo shared_info = SharedFunctionInfo::cast(
-          deopt_input_data->LiteralArray()->get(shared_info_id));
-      if (!depth++) continue;  // Skip the current function itself.
-
-      const char* resource_name =
-          (shared_info->script()->IsScript() &&
-           Script::cast(shared_info->script())->name()->IsName())
-              ? GetName(Name::cast(Script::cast(shared_info->script())->name()))
-              : CodeEntry::kEmptyResourceName;
-
-      CodeEntry* inline_entry =
-          new CodeEntry(entry->tag(), GetName(shared_info->DebugName()),
-                        resource_name, CpuProfileNode::kNoLineNumberInfo,
-                        CpuProfileNode::kNoColumnNumberInfo, nullptr,
-                        code->InstructionStart());
-      inline_entry->FillFunctionInfo(shared_info);
-      inline_stack.emplace_back(inline_entry);
+      continue;
     }
-    if (!inline_stack.empty()) {
-      entry->AddInlineStack(pc_offset, std::move(inline_stack));
+
+    // Inlined positions only occur in optimized code, whose deoptimization
+    // data describes the chain of inlined calls. The inlined functions might
+    // come from a different script.
+    DCHECK(abstract_code->IsCode());
+    DeoptimizationData deopt_data = DeoptimizationData::cast(
+        abstract_code->GetCode()->deoptimization_data());
+    std::vector<CodeEntryAndLineNumber> inline_stack;
+    while (position.isInlined()) {
+      InliningPosition inlining =
+          deopt_data->InliningPositions()->get(position.InliningId());
+      SharedFunctionInfo function =
+          deopt_data->GetInlinedFunction(inlining.inlined_function_id);
+      CodeEntry*& inlined_entry = inlined_entries[inlining.inlined_function_id];
+      if (!inlined_entry) {
+        const char* resource_name =
+            (function->script()->IsScript() &&
+             Script::cast(function->script())->name()->IsName())
+                ? GetName(Name::cast(Script::cast(function->script())->name()))
+                : CodeEntry::kEmptyResourceName;
+        std::unique_ptr<CodeEntry> new_entry(new CodeEntry(
+            entry->tag(), GetName(function->DebugName()), resource_name,
+            GetLineNumber(function, function->StartPosition()),
+            CpuProfileNode::kNoColumnNumberInfo, nullptr,
+            entry->instruction_start()));
+        new_entry->FillFunctionInfo(function);
+        inlined_entry = entry->AddInlinedEntry(std::move(new_entry));
+      }
+      inline_stack.push_back(
+          {inlined_entry, GetLineNumber(function, position.ScriptOffset())});
+      position = inlining.position;
     }
+    inline_stack.push_back(
+        {entry, GetLineNumber(shared, position.ScriptOffset())});
+
+    // Attribute the code to the line in the innermost function that has one.
+    auto frame = std::find_if(inline_stack.begin(), inline_stack.end(),
+                              [](const CodeEntryAndLineNumber& candidate) {
+                                return candidate.line_number !=
+                                       CpuProfileNode::kNoLineNumberInfo;
+                              });
+    if (frame == inline_stack.end()) continue;
+    line_table->SetPosition(it.code_offset(), frame->line_number, inlining_id);
+    entry->AddInlineStack(inlining_id, std::move(inline_stack));
   }
 }
 
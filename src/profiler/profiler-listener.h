@@ -76,7 +76,11 @@ class ProfilerListener : public CodeEventListener {
   }
 
  private:
-  void RecordInliningInfo(CodeEntry* entry, AbstractCode abstract_code);
+  // Fills |line_table| with the lines of the code positions and records the
+  // inline stacks of the inlined positions on |entry|.
+  void RecordSourcePositions(CodeEntry* entry, SourcePositionTable* line_table,
+                             AbstractCode abstract_code,
+                             SharedFunctionInfo shared);
   void AttachDeoptInlinedFrames(Code code, CodeDeoptEventRecord* rec);
   Name InferScriptName(Name name, SharedFunctionInfo info);
   V8_INLINE void DispatchCodeEvent(const CodeEventsContainer& evt_rec) {
@@ -301,7 +301,8 @@ SamplingHeapProfiler::BuildSamples() const {
     const Sample* sample = it.second.get();
     samples.emplace_back(v8::AllocationProfile::Sample{
         sample->owner->id_, sample->size, ScaleSample(sample->size, 1).count,
-        sample->sample_id});
+        sample->sample_id, heap_->gc_count() - sample->gc_count,
+        heap_->ms_count() - sample->ms_count});
   }
   return samples;
 }
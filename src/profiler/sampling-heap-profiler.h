@@ -108,13 +108,18 @@ class SamplingHeapProfiler {
           global(Global<Value>(
               reinterpret_cast<v8::Isolate*>(profiler_->isolate_), local_)),
           profiler(profiler_),
-          sample_id(sample_id) {}
+          sample_id(sample_id),
+          gc_count(profiler_->heap_->gc_count()),
+          ms_count(profiler_->heap_->ms_count()) {}
     ~Sample() { global.Reset(); }
     const size_t size;
     AllocationNode* const owner;
     Global<Value> global;
     SamplingHeapProfiler* const profiler;
     const uint64_t sample_id;
+    // The GC counters of the heap at the time the object was allocated.
+    const unsigned int gc_count;
+    const unsigned int ms_count;
 
    private:
     DISALLOW_COPY_AND_ASSIGN(Sample);
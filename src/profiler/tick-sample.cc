@@ -238,8 +238,16 @@ bool TickSample::GetStackSample(Isolate* v8_isolate, RegisterState* regs,
        it.top_frame_type() == internal::StackFrame::BUILTIN_EXIT)) {
     frames[i++] = reinterpret_cast<void*>(isolate->c_function());
   }
-  i::RuntimeCallTimer* timer =
-      isolate->counters()->runtime_call_stats()->current_timer();
+  i::RuntimeCallStats* stats = isolate->counters()->runtime_call_stats();
+  i::RuntimeCallTimer* timer = stats->current_timer();
+  if (i::RuntimeCallStats::IsCounterSamplingEnabled()) {
+    // Without timers only the innermost counter is known, attribute the tick
+    // to it.
+    i::RuntimeCallCounter* counter = stats->current_counter();
+    if (counter != nullptr && i < frames_limit) {
+      frames[i++] = reinterpret_cast<void*>(counter);
+    }
+  }
   for (; !it.done() && i < frames_limit; it.Advance()) {
     while (timer && reinterpret_cast<i::Address>(timer) < it.frame()->fp() &&
            i < frames_limit) {
@@ -4,8 +4,6 @@
 
 // A simple interpreter for the Irregexp byte code.
 
-#ifdef V8_INTERPRETED_REGEXP
-
 #include "src/regexp/interpreter-irregexp.h"
 
 #include "src/ast/ast.h"
@@ -156,7 +154,8 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
                                            Vector<const Char> subject,
                                            int* registers,
                                            int current,
-                                           uint32_t current_char) {
+                                           uint32_t current_char,
+                                           int backtrack_limit) {
   const byte* pc = code_base;
   // BacktrackStack ensures that the memory allocated for the backtracking stack
   // is returned to the system or cached if there is no stack being cached at
@@ -165,6 +164,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
   int* backtrack_stack_base = backtrack_stack.data();
   int* backtrack_sp = backtrack_stack_base;
   int backtrack_stack_space = backtrack_stack.max_size();
+  int backtrack_count = 0;
 #ifdef DEBUG
   if (FLAG_trace_regexp_bytecodes) {
     PrintF("\n\nStart bytecode interpreter\n\n");
@@ -230,6 +230,10 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         pc += BC_POP_CP_LENGTH;
         break;
       BYTECODE(POP_BT)
+        if (backtrack_limit != IrregexpInterpreter::kNoBacktrackLimit &&
+            ++backtrack_count > backtrack_limit) {
+          return RegExpImpl::RE_EXCEPTION;
+        }
         backtrack_stack_space++;
         --backtrack_sp;
         pc = code_base + *backtrack_sp;
@@ -592,7 +596,8 @@ RegExpImpl::IrregexpResult IrregexpInterpreter::Match(
     Handle<ByteArray> code_array,
     Handle<String> subject,
     int* registers,
-    int start_position) {
+    int start_position,
+    int backtrack_limit) {
   DCHECK(subject->IsFlat());
 
   DisallowHeapAllocation no_gc;
@@ -607,7 +612,8 @@ RegExpImpl::IrregexpResult IrregexpInterpreter::Match(
                     subject_vector,
                     registers,
                     start_position,
-                    previous_char);
+                    previous_char,
+                    backtrack_limit);
   } else {
     DCHECK(subject_content.IsTwoByte());
     Vector<const uc16> subject_vector = subject_content.ToUC16Vector();
@@ -617,11 +623,10 @@ RegExpImpl::IrregexpResult IrregexpInterpreter::Match(
                     subject_vector,
                     registers,
                     start_position,
-                    previous_char);
+                    previous_char,
+                    backtrack_limit);
   }
 }
 
 }  // namespace internal
 }  // namespace v8
-
-#endif  // V8_INTERPRETED_REGEXP
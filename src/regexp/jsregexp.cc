@@ -10,6 +10,7 @@
 #include "src/base/platform/platform.h"
 #include "src/code-tracer.h"
 #include "src/compilation-cache.h"
+#include "src/counters.h"
 #include "src/elements.h"
 #include "src/execution.h"
 #include "src/heap/factory.h"
@@ -18,6 +19,7 @@
 #include "src/ostreams.h"
 #include "src/regexp/interpreter-irregexp.h"
 #include "src/regexp/jsregexp-inl.h"
+#include "src/regexp/regexp-linear-engine.h"
 #include "src/regexp/regexp-macro-assembler-irregexp.h"
 #include "src/regexp/regexp-macro-assembler-tracer.h"
 #include "src/regexp/regexp-macro-assembler.h"
@@ -127,6 +129,52 @@ static bool HasFewDifferentCharacters(Handle<String> pattern) {
   return true;
 }
 
+// Longer prefixes make the search for them only marginally faster.
+const int kMaxLiteralPrefixLength = 32;
+
+// Appends the code units which all matches of {tree} start with to {prefix}.
+// Returns true if {tree} matches exactly {prefix}, so that the code units
+// matched after {tree} can be appended as well.
+static bool AppendLiteralPrefix(RegExpTree* tree, ZoneVector<uc16>* prefix) {
+  if (static_cast<int>(prefix->size()) >= kMaxLiteralPrefixLength) {
+    return false;
+  }
+  if (tree->IsAtom()) {
+    RegExpAtom* atom = tree->AsAtom();
+    if (atom->ignore_case()) return false;
+    for (uc16 c : atom->data()) prefix->push_back(c);
+    return true;
+  }
+  if (tree->IsText()) {
+    for (TextElement& element : *tree->AsText()->elements()) {
+      if (!AppendLiteralPrefix(element.tree(), prefix)) return false;
+    }
+    return true;
+  }
+  if (tree->IsAlternative()) {
+    for (RegExpTree* node : *tree->AsAlternative()->nodes()) {
+      if (!AppendLiteralPrefix(node, prefix)) return false;
+    }
+    return true;
+  }
+  if (tree->IsCapture()) {
+    return AppendLiteralPrefix(tree->AsCapture()->body(), prefix);
+  }
+  if (tree->IsGroup()) {
+    return AppendLiteralPrefix(tree->AsGroup()->body(), prefix);
+  }
+  if (tree->IsQuantifier()) {
+    // The first iteration is required.
+    RegExpQuantifier* quantifier = tree->AsQuantifier();
+    if (quantifier->min() > 0) {
+      AppendLiteralPrefix(quantifier->body(), prefix);
+    }
+    return false;
+  }
+  // Assertions and lookarounds don't consume any input.
+  return tree->IsAssertion() || tree->IsLookaround() || tree->IsEmpty();
+}
+
 // Generic RegExp methods. Dispatches to implementation specific methods.
 
 MaybeHandle<Object> RegExpImpl::Compile(Isolate* isolate, Handle<JSRegExp> re,
@@ -176,6 +224,28 @@ MaybeHandle<Object> RegExpImpl::Compile(Isolate* isolate, Handle<JSRegExp> re,
   }
   if (!has_been_compiled) {
     IrregexpInitialize(isolate, re, pattern, flags, parse_result.capture_count);
+    // Sticky regexps only match at one position anyway.
+    ZoneVector<uc16> prefix(&zone);
+    if (!IgnoreCase(flags) && !IsSticky(flags)) {
+      AppendLiteralPrefix(parse_result.tree, &prefix);
+    }
+    if (!prefix.empty()) {
+      Handle<String> prefix_string;
+      ASSIGN_RETURN_ON_EXCEPTION(
+          isolate, prefix_string,
+          isolate->factory()->NewStringFromTwoByte(&prefix), Object);
+      re->SetDataAt(JSRegExp::kIrregexpLiteralPrefixIndex, *prefix_string);
+    }
+    if ((FLAG_regexp_linear_engine || FLAG_regexp_linear_fallback) &&
+        RegExpLinearEngine::CanBeHandled(parse_result.tree, flags,
+                                         parse_result.capture_count, &zone)) {
+      if (FLAG_regexp_linear_engine) {
+        RegExpLinearEngine::Initialize(isolate, re, parse_result.tree, &zone);
+      } else {
+        re->SetDataAt(JSRegExp::kIrregexpLinearCodeIndex,
+                      Smi::FromInt(JSRegExp::kLinearEngineOnFallback));
+      }
+    }
   }
   DCHECK(re->data()->IsFixedArray());
   // Compilation succeeded so the data is set on the regexp
@@ -290,6 +360,22 @@ Handle<Object> RegExpImpl::AtomExec(Isolate* isolate, Handle<JSRegExp> re,
 
 // Irregexp implementation.
 
+namespace {
+
+// Whether the regexp is executed as bytecode. Only the interpreter counts
+// backtracks, so regexps which may fall back to the linear-time engine are
+// never tiered up to native code.
+bool UseIrregexpBytecode(JSRegExp re) {
+#ifdef V8_INTERPRETED_REGEXP
+  return true;
+#else
+  if (re->HasLinearFallback()) return true;
+  return FLAG_regexp_tier_up && !re->MarkedForTierUp();
+#endif
+}
+
+}  // namespace
+
 // Ensures that the regexp object contains a compiled version of the
 // source for either one-byte or two-byte subject strings.
 // If the compiled version doesn't already exist, it is compiled
@@ -299,11 +385,15 @@ Handle<Object> RegExpImpl::AtomExec(Isolate* isolate, Handle<JSRegExp> re,
 bool RegExpImpl::EnsureCompiledIrregexp(Isolate* isolate, Handle<JSRegExp> re,
                                         Handle<String> sample_subject,
                                         bool is_one_byte) {
+  if (re->UsesLinearEngine()) return true;
   Object* compiled_code = re->DataAt(JSRegExp::code_index(is_one_byte));
 #ifdef V8_INTERPRETED_REGEXP
   if (compiled_code->IsByteArray()) return true;
 #else  // V8_INTERPRETED_REGEXP (RegExp native code)
   if (compiled_code->IsCode()) return true;
+  // Bytecode is used until the regexp has been executed often enough to be
+  // worth compiling to native code.
+  if (compiled_code->IsByteArray() && UseIrregexpBytecode(*re)) return true;
 #endif
   return CompileIrregexp(isolate, re, sample_subject, is_one_byte);
 }
@@ -317,10 +407,10 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
 #ifdef DEBUG
   Object* entry = re->DataAt(JSRegExp::code_index(is_one_byte));
   // When arriving here entry can only be a smi representing an uncompiled
-  // regexp.
-  DCHECK(entry->IsSmi());
-  int entry_value = Smi::ToInt(entry);
-  DCHECK_EQ(JSRegExp::kUninitializedValue, entry_value);
+  // regexp, or bytecode which is being tiered up to native code.
+  DCHECK(entry->IsByteArray() ||
+         (entry->IsSmi() &&
+          Smi::ToInt(entry) == JSRegExp::kUninitializedValue));
 #endif
 
   JSRegExp::Flags flags = re->GetFlags();
@@ -336,9 +426,11 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
     USE(ThrowRegExpException(isolate, re, pattern, compile_data.error));
     return false;
   }
-  RegExpEngine::CompilationResult result =
-      RegExpEngine::Compile(isolate, &zone, &compile_data, flags, pattern,
-                            sample_subject, is_one_byte);
+  // Regexps start out as bytecode, which is much cheaper to generate, and
+  // are compiled to native code once they have been executed often enough.
+  RegExpEngine::CompilationResult result = RegExpEngine::Compile(
+      isolate, &zone, &compile_data, flags, pattern, sample_subject,
+      is_one_byte, UseIrregexpBytecode(*re));
   if (result.error_message != nullptr) {
     // Unable to compile regexp.
     if (FLAG_abort_on_stack_or_string_length_overflow &&
@@ -427,6 +519,39 @@ int RegExpImpl::IrregexpPrepare(Isolate* isolate, Handle<JSRegExp> regexp,
 #endif  // V8_INTERPRETED_REGEXP
 }
 
+namespace {
+
+// Runs the bytecode for the given subject encoding. The interpreter keeps all
+// of the regexp's registers in {registers}; on success, the capture registers
+// are copied to {output}. RE_EXCEPTION means that the interpreter ran out of
+// backtracking stack or exceeded {backtrack_limit}; no exception is thrown
+// yet.
+RegExpImpl::IrregexpResult IrregexpExecBytecode(
+    Isolate* isolate, Handle<FixedArray> irregexp, Handle<String> subject,
+    int index, bool is_one_byte, int32_t* output, int32_t* registers,
+    int backtrack_limit) {
+  int number_of_capture_registers =
+      (RegExpImpl::IrregexpNumberOfCaptures(*irregexp) + 1) * 2;
+  // We do not touch the actual capture result registers until we know there
+  // has been a match so that we can use those capture results to set the
+  // last match info.
+  for (int i = number_of_capture_registers - 1; i >= 0; i--) {
+    registers[i] = -1;
+  }
+  Handle<ByteArray> byte_codes(
+      RegExpImpl::IrregexpByteCode(*irregexp, is_one_byte), isolate);
+
+  RegExpImpl::IrregexpResult result = IrregexpInterpreter::Match(
+      isolate, byte_codes, subject, registers, index, backtrack_limit);
+  if (result == RegExpImpl::RE_SUCCESS) {
+    // Copy capture results to the start of the registers array.
+    MemCopy(output, registers, number_of_capture_registers * sizeof(int32_t));
+  }
+  return result;
+}
+
+}  // namespace
+
 int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
                                 Handle<String> subject, int index,
                                 int32_t* output, int output_size) {
@@ -438,10 +563,50 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
 
   bool is_one_byte = String::IsOneByteRepresentationUnderneath(*subject);
 
+  // No match can start before the first occurrence of the literal prefix.
+  Object* prefix = irregexp->get(JSRegExp::kIrregexpLiteralPrefixIndex);
+  if (prefix->IsString()) {
+    index = String::IndexOf(isolate, subject,
+                            handle(String::cast(prefix), isolate), index);
+    if (index == -1) return RE_FAILURE;
+  }
+
+  if (regexp->UsesLinearEngine()) {
+    return RegExpLinearEngine::Exec(isolate, regexp, subject, index, output);
+  }
+
 #ifndef V8_INTERPRETED_REGEXP
   DCHECK(output_size >= (IrregexpNumberOfCaptures(*irregexp) + 1) * 2);
   do {
     EnsureCompiledIrregexp(isolate, regexp, subject, is_one_byte);
+    if (irregexp->get(JSRegExp::code_index(is_one_byte))->IsByteArray()) {
+      // The regexp has not been tiered up to native code yet. The output
+      // array is only sized for the captures, so the interpreter gets its own
+      // array for all registers.
+      regexp->TierUpTick();
+      std::unique_ptr<int32_t[]> registers(
+          NewArray<int32_t>(IrregexpNumberOfRegisters(*irregexp)));
+      // Unlike native code, the interpreter does not check for interrupts,
+      // so it is only allowed a limited amount of backtracking.
+      static const int kBacktrackLimit = 64 * KB;
+      bool has_linear_fallback = regexp->HasLinearFallback();
+      IrregexpResult result = IrregexpExecBytecode(
+          isolate, irregexp, subject, index, is_one_byte, output,
+          registers.get(),
+          has_linear_fallback ? FLAG_regexp_backtracks_before_fallback
+                              : kBacktrackLimit);
+      if (result != RE_EXCEPTION) return result;
+      if (has_linear_fallback) {
+        RegExpLinearEngine::InitializeOnFallback(isolate, regexp);
+        return RegExpLinearEngine::Exec(isolate, regexp, subject, index,
+                                        output);
+      }
+      // The regexp backtracks too much for the interpreter, or needs more
+      // backtracking stack than it has. Rather than throwing, tier up right
+      // away and retry.
+      regexp->MarkTierUpForNextExec();
+      continue;
+    }
     Handle<Code> code(IrregexpNativeCode(*irregexp, is_one_byte), isolate);
     // The stack is used to allocate registers for the compiled regexp code.
     // This means that in case of failure, the output registers array is left
@@ -479,27 +644,18 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
 
   DCHECK(output_size >= IrregexpNumberOfRegisters(*irregexp));
   // We must have done EnsureCompiledIrregexp, so we can get the number of
-  // registers.
+  // registers. The registers follow the capture results in {output}.
   int number_of_capture_registers =
       (IrregexpNumberOfCaptures(*irregexp) + 1) * 2;
   int32_t* raw_output = &output[number_of_capture_registers];
-  // We do not touch the actual capture result registers until we know there
-  // has been a match so that we can use those capture results to set the
-  // last match info.
-  for (int i = number_of_capture_registers - 1; i >= 0; i--) {
-    raw_output[i] = -1;
-  }
-  Handle<ByteArray> byte_codes(IrregexpByteCode(*irregexp, is_one_byte),
-                               isolate);
-
-  IrregexpResult result = IrregexpInterpreter::Match(isolate,
-                                                     byte_codes,
-                                                     subject,
-                                                     raw_output,
-                                                     index);
-  if (result == RE_SUCCESS) {
-    // Copy capture results to the start of the registers array.
-    MemCopy(output, raw_output, number_of_capture_registers * sizeof(int32_t));
+  bool has_linear_fallback = regexp->HasLinearFallback();
+  IrregexpResult result = IrregexpExecBytecode(
+      isolate, irregexp, subject, index, is_one_byte, output, raw_output,
+      has_linear_fallback ? FLAG_regexp_backtracks_before_fallback
+                          : IrregexpInterpreter::kNoBacktrackLimit);
+  if (result == RE_EXCEPTION && has_linear_fallback) {
+    RegExpLinearEngine::InitializeOnFallback(isolate, regexp);
+    return RegExpLinearEngine::Exec(isolate, regexp, subject, index, output);
   }
   if (result == RE_EXCEPTION) {
     DCHECK(!isolate->has_pending_exception());
@@ -618,6 +774,15 @@ RegExpImpl::GlobalCache::GlobalCache(Handle<JSRegExp> regexp,
       num_matches_ = -1;  // Signal exception.
       return;
     }
+#ifndef V8_INTERPRETED_REGEXP
+    // Like in interpreted builds, bytecode which has not been tiered up yet
+    // only finds a single match per execution.
+    bool is_one_byte = String::IsOneByteRepresentationUnderneath(*subject_);
+    interpreted =
+        regexp_->DataAt(JSRegExp::code_index(is_one_byte))->IsByteArray();
+#endif  // V8_INTERPRETED_REGEXP
+    // So does the linear-time engine.
+    if (regexp_->UsesLinearEngine()) interpreted = true;
   }
 
   DCHECK(IsGlobal(regexp->GetFlags()));
@@ -1077,7 +1242,7 @@ RegExpEngine::CompilationResult RegExpCompiler::Assemble(
   isolate->IncreaseTotalRegexpCodeGenerated(code->Size());
   work_list_ = nullptr;
 #if defined(ENABLE_DISASSEMBLER) && !defined(V8_INTERPRETED_REGEXP)
-  if (FLAG_print_code) {
+  if (FLAG_print_code && code->IsCode()) {
     CodeTracer::Scope trace_scope(isolate->GetCodeTracer());
     OFStream os(trace_scope.file());
     Handle<Code>::cast(code)->Disassemble(pattern->ToCString().get(), os);
@@ -6622,7 +6787,7 @@ RegExpNode* OptionallyStepBackToLeadSurrogate(RegExpCompiler* compiler,
 RegExpEngine::CompilationResult RegExpEngine::Compile(
     Isolate* isolate, Zone* zone, RegExpCompileData* data,
     JSRegExp::Flags flags, Handle<String> pattern,
-    Handle<String> sample_subject, bool is_one_byte) {
+    Handle<String> sample_subject, bool is_one_byte, bool use_bytecode) {
   if ((data->capture_count + 1) * 2 - 1 > RegExpMacroAssembler::kMaxRegister) {
     return IrregexpRegExpTooBig(isolate);
   }
@@ -6697,56 +6862,64 @@ RegExpEngine::CompilationResult RegExpEngine::Compile(
     return CompilationResult(isolate, error_message);
   }
 
-  // Create the correct assembler for the architecture.
+  // Create the correct assembler for the architecture, or the bytecode
+  // assembler if the regexp is going to be interpreted.
+#ifdef V8_INTERPRETED_REGEXP
+  use_bytecode = true;
+#endif  // V8_INTERPRETED_REGEXP
+  std::unique_ptr<RegExpMacroAssembler> macro_assembler;
+  EmbeddedVector<byte, 1024> codes;
+  if (use_bytecode) {
+    macro_assembler.reset(
+        new RegExpMacroAssemblerIrregexp(isolate, codes, zone));
+  } else {
 #ifndef V8_INTERPRETED_REGEXP
-  // Native regexp implementation.
-
-  NativeRegExpMacroAssembler::Mode mode =
-      is_one_byte ? NativeRegExpMacroAssembler::LATIN1
-                  : NativeRegExpMacroAssembler::UC16;
+    // Native regexp implementation.
+    NativeRegExpMacroAssembler::Mode mode =
+        is_one_byte ? NativeRegExpMacroAssembler::LATIN1
+                    : NativeRegExpMacroAssembler::UC16;
+    const int output_registers = (data->capture_count + 1) * 2;
 
 #if V8_TARGET_ARCH_IA32
-  RegExpMacroAssemblerIA32 macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerIA32(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_X64
-  RegExpMacroAssemblerX64 macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerX64(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_ARM
-  RegExpMacroAssemblerARM macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerARM(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_ARM64
-  RegExpMacroAssemblerARM64 macro_assembler(isolate, zone, mode,
-                                            (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerARM64(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_S390
-  RegExpMacroAssemblerS390 macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerS390(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_PPC
-  RegExpMacroAssemblerPPC macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerPPC(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_MIPS
-  RegExpMacroAssemblerMIPS macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerMIPS(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_MIPS64
-  RegExpMacroAssemblerMIPS macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerMIPS(isolate, zone, mode, output_registers));
 #else
 #error "Unsupported architecture"
 #endif
-
-#else  // V8_INTERPRETED_REGEXP
-  // Interpreted regexp implementation.
-  EmbeddedVector<byte, 1024> codes;
-  RegExpMacroAssemblerIrregexp macro_assembler(isolate, codes, zone);
+#else   // V8_INTERPRETED_REGEXP
+    UNREACHABLE();
 #endif  // V8_INTERPRETED_REGEXP
+  }
 
-  macro_assembler.set_slow_safe(TooMuchRegExpCode(isolate, pattern));
+  macro_assembler->set_slow_safe(TooMuchRegExpCode(isolate, pattern));
 
   // Inserted here, instead of in Assembler, because it depends on information
   // in the AST that isn't replicated in the Node structure.
   static const int kMaxBacksearchLimit = 1024;
   if (is_end_anchored && !is_start_anchored && !is_sticky &&
       max_length < kMaxBacksearchLimit) {
-    macro_assembler.SetCurrentPositionFromEnd(max_length);
+    macro_assembler->SetCurrentPositionFromEnd(max_length);
   }
 
   if (is_global) {
@@ -6756,11 +6929,11 @@ RegExpEngine::CompilationResult RegExpEngine::Compile(
     } else if (is_unicode) {
       mode = RegExpMacroAssembler::GLOBAL_UNICODE;
     }
-    macro_assembler.set_global_mode(mode);
+    macro_assembler->set_global_mode(mode);
   }
 
-  return compiler.Assemble(isolate, &macro_assembler, node, data->capture_count,
-                           pattern);
+  return compiler.Assemble(isolate, macro_assembler.get(), node,
+                           data->capture_count, pattern);
 }
 
 bool RegExpEngine::TooMuchRegExpCode(Isolate* isolate, Handle<String> pattern) {
@@ -6792,18 +6965,19 @@ Object* RegExpResultsCache::Lookup(Heap* heap, String key_string,
   }
 
   uint32_t hash = key_string->Hash();
-  uint32_t index = ((hash & (kRegExpResultsCacheSize - 1)) &
-                    ~(kArrayEntriesPerCacheEntry - 1));
+  uint32_t mask = cache->length() - 1;
+  uint32_t index = ((hash & mask) & ~(kArrayEntriesPerCacheEntry - 1));
   if (cache->get(index + kStringOffset) != key_string ||
       cache->get(index + kPatternOffset) != key_pattern) {
-    index =
-        ((index + kArrayEntriesPerCacheEntry) & (kRegExpResultsCacheSize - 1));
+    index = ((index + kArrayEntriesPerCacheEntry) & mask);
     if (cache->get(index + kStringOffset) != key_string ||
         cache->get(index + kPatternOffset) != key_pattern) {
+      heap->isolate()->counters()->regexp_results_cache_misses()->Increment();
       return Smi::kZero;
     }
   }
 
+  heap->isolate()->counters()->regexp_results_cache_hits()->Increment();
   *last_match_cache = FixedArray::cast(cache->get(index + kLastMatchOffset));
   return cache->get(index + kArrayOffset);
 }
@@ -6826,32 +7000,14 @@ void RegExpResultsCache::Enter(Isolate* isolate, Handle<String> key_string,
     cache = factory->regexp_multiple_cache();
   }
 
-  uint32_t hash = key_string->Hash();
-  uint32_t index = ((hash & (kRegExpResultsCacheSize - 1)) &
-                    ~(kArrayEntriesPerCacheEntry - 1));
-  if (cache->get(index + kStringOffset) == Smi::kZero) {
-    cache->set(index + kStringOffset, *key_string);
-    cache->set(index + kPatternOffset, *key_pattern);
-    cache->set(index + kArrayOffset, *value_array);
-    cache->set(index + kLastMatchOffset, *last_match_cache);
-  } else {
-    uint32_t index2 =
-        ((index + kArrayEntriesPerCacheEntry) & (kRegExpResultsCacheSize - 1));
-    if (cache->get(index2 + kStringOffset) == Smi::kZero) {
-      cache->set(index2 + kStringOffset, *key_string);
-      cache->set(index2 + kPatternOffset, *key_pattern);
-      cache->set(index2 + kArrayOffset, *value_array);
-      cache->set(index2 + kLastMatchOffset, *last_match_cache);
-    } else {
-      cache->set(index2 + kStringOffset, Smi::kZero);
-      cache->set(index2 + kPatternOffset, Smi::kZero);
-      cache->set(index2 + kArrayOffset, Smi::kZero);
-      cache->set(index2 + kLastMatchOffset, Smi::kZero);
-      cache->set(index + kStringOffset, *key_string);
-      cache->set(index + kPatternOffset, *key_pattern);
-      cache->set(index + kArrayOffset, *value_array);
-      cache->set(index + kLastMatchOffset, *last_match_cache);
-    }
+  if (!StoreEntry(*cache, *key_string, *key_pattern, *value_array,
+                  *last_match_cache) &&
+      cache->length() < kMaxSize &&
+      isolate->heap()->RecordCacheEviction(
+          type == STRING_SPLIT_SUBSTRINGS ? RootIndex::kStringSplitCache
+                                          : RootIndex::kRegExpMultipleCache,
+          cache->length() / kArrayEntriesPerCacheEntry)) {
+    Grow(isolate, cache, type);
   }
   // If the array is a reasonably short list of substrings, convert it into a
   // list of internalized strings.
@@ -6867,8 +7023,55 @@ void RegExpResultsCache::Enter(Isolate* isolate, Handle<String> key_string,
       ReadOnlyRoots(isolate).fixed_cow_array_map());
 }
 
+bool RegExpResultsCache::StoreEntry(FixedArray cache, String key_string,
+                                    Object* key_pattern,
+                                    FixedArray value_array,
+                                    FixedArray last_match_cache) {
+  uint32_t hash = key_string->Hash();
+  uint32_t mask = cache->length() - 1;
+  uint32_t index = ((hash & mask) & ~(kArrayEntriesPerCacheEntry - 1));
+  bool evicted = false;
+  if (cache->get(index + kStringOffset) != Smi::kZero) {
+    uint32_t index2 = ((index + kArrayEntriesPerCacheEntry) & mask);
+    if (cache->get(index2 + kStringOffset) == Smi::kZero) {
+      index = index2;
+    } else {
+      cache->set(index2 + kStringOffset, Smi::kZero);
+      cache->set(index2 + kPatternOffset, Smi::kZero);
+      cache->set(index2 + kArrayOffset, Smi::kZero);
+      cache->set(index2 + kLastMatchOffset, Smi::kZero);
+      evicted = true;
+    }
+  }
+  cache->set(index + kStringOffset, key_string);
+  cache->set(index + kPatternOffset, key_pattern);
+  cache->set(index + kArrayOffset, value_array);
+  cache->set(index + kLastMatchOffset, last_match_cache);
+  return !evicted;
+}
+
+void RegExpResultsCache::Grow(Isolate* isolate, Handle<FixedArray> cache,
+                              ResultsCacheType type) {
+  Handle<FixedArray> new_cache =
+      isolate->factory()->NewFixedArray(cache->length() * 2, TENURED);
+  DisallowHeapAllocation no_gc;
+  Clear(*new_cache);
+  for (int i = 0; i < cache->length(); i += kArrayEntriesPerCacheEntry) {
+    if (cache->get(i + kStringOffset) == Smi::kZero) continue;
+    StoreEntry(*new_cache, String::cast(cache->get(i + kStringOffset)),
+               cache->get(i + kPatternOffset),
+               FixedArray::cast(cache->get(i + kArrayOffset)),
+               FixedArray::cast(cache->get(i + kLastMatchOffset)));
+  }
+  if (type == STRING_SPLIT_SUBSTRINGS) {
+    isolate->heap()->set_string_split_cache(*new_cache);
+  } else {
+    isolate->heap()->set_regexp_multiple_cache(*new_cache);
+  }
+}
+
 void RegExpResultsCache::Clear(FixedArray cache) {
-  for (int i = 0; i < kRegExpResultsCacheSize; i++) {
+  for (int i = 0; i < cache->length(); i++) {
     cache->set(i, Smi::kZero);
   }
 }
@@ -1517,7 +1517,8 @@ class RegExpEngine: public AllStatic {
                                    JSRegExp::Flags flags,
                                    Handle<String> pattern,
                                    Handle<String> sample_subject,
-                                   bool is_one_byte);
+                                   bool is_one_byte,
+                                   bool use_bytecode = false);
 
   static bool TooMuchRegExpCode(Isolate* isolate, Handle<String> pattern);
 
@@ -1539,9 +1540,21 @@ class RegExpResultsCache : public AllStatic {
                     Handle<Object> key_pattern, Handle<FixedArray> value_array,
                     Handle<FixedArray> last_match_cache, ResultsCacheType type);
   static void Clear(FixedArray cache);
-  static const int kRegExpResultsCacheSize = 0x100;
+
+  // The caches start out with kInitialSize elements and double whenever they
+  // have evicted a quarter of their entries, up to kMaxSize elements.
+  static const int kInitialSize = 0x100;
+  static const int kMaxSize = 0x2000;
 
  private:
+  // Stores an entry into {cache}. Returns false if another entry had to be
+  // evicted to make room for it.
+  static bool StoreEntry(FixedArray cache, String key_string,
+                         Object* key_pattern, FixedArray value_array,
+                         FixedArray last_match_cache);
+  static void Grow(Isolate* isolate, Handle<FixedArray> cache,
+                   ResultsCacheType type);
+
   static const int kArrayEntriesPerCacheEntry = 4;
   static const int kStringOffset = 0;
   static const int kPatternOffset = 1;
@@ -0,0 +1,525 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-linear-engine.h"
+
+#include <vector>
+
+#include "src/char-predicates-inl.h"
+#include "src/heap/factory.h"
+#include "src/objects-inl.h"
+#include "src/regexp/regexp-ast.h"
+#include "src/regexp/regexp-parser.h"
+#include "src/unicode.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// An instruction of the automaton program. Instructions which do not consume
+// a character are followed immediately when a thread reaches them.
+struct Instruction {
+  enum Opcode : int32_t {
+    // Consumes one code unit in the range [payload, extra], or fails.
+    CONSUME_RANGE,
+    // Fails unless the RegExpAssertion::AssertionType {payload} holds.
+    ASSERTION,
+    // Continues at the next instruction, and also at {payload} with lower
+    // priority.
+    FORK,
+    // Continues at {payload}.
+    JMP,
+    // Stores the current position to register {payload}.
+    SET_REGISTER_TO_CP,
+    // Resets register {payload} to -1.
+    CLEAR_REGISTER,
+    // Fails if register {payload} holds the current position, i.e. if a
+    // quantifier iteration did not consume anything.
+    CHECK_NOT_EMPTY,
+    // Reports a match.
+    ACCEPT
+  };
+
+  Opcode opcode;
+  int32_t payload;
+  int32_t extra;
+};
+
+// Larger quantifier bounds are unrolled into too much code.
+const int kMaxReplication = 64;
+const int kMaxInstructions = 64 * KB;
+
+class LinearCompiler final : private RegExpVisitor {
+ public:
+  LinearCompiler(JSRegExp::Flags flags, int capture_count, Zone* zone)
+      : flags_(flags),
+        code_(zone),
+        register_count_(RegExpCapture::EndRegister(capture_count) + 1),
+        zone_(zone),
+        bailed_out_(false) {}
+
+  // Returns false if the pattern is not supported.
+  bool Compile(RegExpTree* tree) {
+    if (IgnoreCase(flags_) || IsUnicode(flags_)) return false;
+    Emit(Instruction::SET_REGISTER_TO_CP, RegExpCapture::StartRegister(0));
+    tree->Accept(this, nullptr);
+    Emit(Instruction::SET_REGISTER_TO_CP, RegExpCapture::EndRegister(0));
+    Emit(Instruction::ACCEPT);
+    return !bailed_out_;
+  }
+
+  const ZoneVector<Instruction>& code() const { return code_; }
+  int register_count() const { return register_count_; }
+
+ private:
+  int pc() const { return static_cast<int>(code_.size()); }
+
+  int Emit(Instruction::Opcode opcode, int payload = 0, int extra = 0) {
+    if (pc() >= kMaxInstructions) {
+      bailed_out_ = true;
+      return 0;
+    }
+    code_.push_back({opcode, payload, extra});
+    return pc() - 1;
+  }
+
+  void PatchTarget(int at, int target) {
+    if (bailed_out_) return;
+    DCHECK(code_[at].opcode == Instruction::FORK ||
+           code_[at].opcode == Instruction::JMP);
+    code_[at].payload = target;
+  }
+
+  void* VisitDisjunction(RegExpDisjunction* node, void*) override {
+    ZoneList<RegExpTree*>* alternatives = node->alternatives();
+    ZoneVector<int> jumps_to_end(zone_);
+    for (int i = 0; i < alternatives->length() - 1; i++) {
+      int fork = Emit(Instruction::FORK);
+      alternatives->at(i)->Accept(this, nullptr);
+      jumps_to_end.push_back(Emit(Instruction::JMP));
+      PatchTarget(fork, pc());
+    }
+    alternatives->last()->Accept(this, nullptr);
+    for (int jump : jumps_to_end) PatchTarget(jump, pc());
+    return nullptr;
+  }
+
+  void* VisitAlternative(RegExpAlternative* node, void*) override {
+    for (RegExpTree* child : *node->nodes()) child->Accept(this, nullptr);
+    return nullptr;
+  }
+
+  void* VisitAssertion(RegExpAssertion* node, void*) override {
+    Emit(Instruction::ASSERTION, node->assertion_type());
+    return nullptr;
+  }
+
+  void* VisitCharacterClass(RegExpCharacterClass* node, void*) override {
+    if (IgnoreCase(node->flags())) {
+      bailed_out_ = true;
+      return nullptr;
+    }
+    ZoneList<CharacterRange>* ranges =
+        new (zone_) ZoneList<CharacterRange>(2, zone_);
+    ranges->AddAll(*node->ranges(zone_), zone_);
+    CharacterRange::Canonicalize(ranges);
+    if (node->is_negated()) {
+      ZoneList<CharacterRange>* negated =
+          new (zone_) ZoneList<CharacterRange>(ranges->length() + 1, zone_);
+      CharacterRange::Negate(ranges, negated, zone_);
+      ranges = negated;
+    }
+    // Without the unicode flag, the subject is matched code unit by code
+    // unit.
+    int count = 0;
+    while (count < ranges->length() &&
+           ranges->at(count).from() <= String::kMaxUtf16CodeUnit) {
+      count++;
+    }
+    if (count == 0) {
+      // An empty range never matches.
+      Emit(Instruction::CONSUME_RANGE, 1, 0);
+      return nullptr;
+    }
+    ZoneVector<int> jumps_to_end(zone_);
+    for (int i = 0; i < count; i++) {
+      CharacterRange range = ranges->at(i);
+      int fork = i < count - 1 ? Emit(Instruction::FORK) : -1;
+      Emit(Instruction::CONSUME_RANGE, range.from(),
+           Min<uc32>(range.to(), String::kMaxUtf16CodeUnit));
+      if (fork == -1) break;
+      jumps_to_end.push_back(Emit(Instruction::JMP));
+      PatchTarget(fork, pc());
+    }
+    for (int jump : jumps_to_end) PatchTarget(jump, pc());
+    return nullptr;
+  }
+
+  void* VisitAtom(RegExpAtom* node, void*) override {
+    if (node->ignore_case()) {
+      bailed_out_ = true;
+      return nullptr;
+    }
+    for (uc16 c : node->data()) Emit(Instruction::CONSUME_RANGE, c, c);
+    return nullptr;
+  }
+
+  void* VisitText(RegExpText* node, void*) override {
+    for (TextElement& element : *node->elements()) {
+      element.tree()->Accept(this, nullptr);
+    }
+    return nullptr;
+  }
+
+  // Emits one iteration of {node}'s body. Captures inside the body are reset
+  // on each iteration, and optional iterations must not match the empty
+  // string.
+  void EmitIteration(RegExpQuantifier* node, bool optional) {
+    Interval captures = node->body()->CaptureRegisters();
+    if (!captures.is_empty()) {
+      for (int reg = captures.from(); reg <= captures.to(); reg++) {
+        Emit(Instruction::CLEAR_REGISTER, reg);
+      }
+    }
+    bool check_empty = optional && node->body()->min_match() == 0;
+    int start_register = check_empty ? register_count_++ : -1;
+    if (check_empty) Emit(Instruction::SET_REGISTER_TO_CP, start_register);
+    node->body()->Accept(this, nullptr);
+    if (check_empty) Emit(Instruction::CHECK_NOT_EMPTY, start_register);
+  }
+
+  void* VisitQuantifier(RegExpQuantifier* node, void*) override {
+    int min = node->min();
+    int max = node->max();
+    if (node->is_possessive() || min > kMaxReplication ||
+        (max != RegExpTree::kInfinity && max > kMaxReplication)) {
+      bailed_out_ = true;
+      return nullptr;
+    }
+    for (int i = 0; i < min && !bailed_out_; i++) EmitIteration(node, false);
+    if (max == RegExpTree::kInfinity) {
+      int loop = pc();
+      if (node->is_greedy()) {
+        int fork = Emit(Instruction::FORK);
+        EmitIteration(node, true);
+        Emit(Instruction::JMP, loop);
+        PatchTarget(fork, pc());
+      } else {
+        int fork = Emit(Instruction::FORK);
+        int jump_to_end = Emit(Instruction::JMP);
+        PatchTarget(fork, pc());
+        EmitIteration(node, true);
+        Emit(Instruction::JMP, loop);
+        PatchTarget(jump_to_end, pc());
+      }
+      return nullptr;
+    }
+    ZoneVector<int> jumps_to_end(zone_);
+    for (int i = min; i < max && !bailed_out_; i++) {
+      int fork = Emit(Instruction::FORK);
+      if (node->is_greedy()) {
+        jumps_to_end.push_back(fork);
+      } else {
+        jumps_to_end.push_back(Emit(Instruction::JMP));
+        PatchTarget(fork, pc());
+      }
+      EmitIteration(node, true);
+    }
+    for (int jump : jumps_to_end) PatchTarget(jump, pc());
+    return nullptr;
+  }
+
+  void* VisitCapture(RegExpCapture* node, void*) override {
+    Emit(Instruction::SET_REGISTER_TO_CP,
+         RegExpCapture::StartRegister(node->index()));
+    node->body()->Accept(this, nullptr);
+    Emit(Instruction::SET_REGISTER_TO_CP,
+         RegExpCapture::EndRegister(node->index()));
+    return nullptr;
+  }
+
+  void* VisitGroup(RegExpGroup* node, void*) override {
+    return node->body()->Accept(this, nullptr);
+  }
+
+  void* VisitLookaround(RegExpLookaround* node, void*) override {
+    bailed_out_ = true;
+    return nullptr;
+  }
+
+  void* VisitBackReference(RegExpBackReference* node, void*) override {
+    bailed_out_ = true;
+    return nullptr;
+  }
+
+  void* VisitEmpty(RegExpEmpty* node, void*) override { return nullptr; }
+
+  const JSRegExp::Flags flags_;
+  ZoneVector<Instruction> code_;
+  int register_count_;
+  Zone* zone_;
+  bool bailed_out_;
+};
+
+// Simulates all threads of the automaton in lockstep over the subject. Each
+// instruction is visited at most once per subject position, so the amount of
+// work per position is bounded by the size of the program.
+template <typename Char>
+class LinearInterpreter {
+ public:
+  LinearInterpreter(const Instruction* code, int code_length,
+                    int register_count, Vector<const Char> subject)
+      : code_(code),
+        register_count_(register_count),
+        subject_(subject),
+        visited_(code_length, -1) {}
+
+  // Returns true and the registers of the highest priority match, if any.
+  bool Match(int start, bool sticky, int32_t* output, int output_count) {
+    bool matched = false;
+    int position = start;
+    std::vector<Thread> current;
+    std::vector<Thread> next;
+    AddThread(&current, Thread{0, NewRegisters()}, position);
+    while (!current.empty()) {
+      next.clear();
+      for (size_t i = 0; i < current.size(); i++) {
+        Thread thread = current[i];
+        const Instruction& instruction = code_[thread.pc];
+        if (instruction.opcode == Instruction::ACCEPT) {
+          // Threads of lower priority than this one can't produce the
+          // match, so they are dropped.
+          MemCopy(output, Registers(thread), output_count * sizeof(int32_t));
+          matched = true;
+          for (size_t j = i; j < current.size(); j++) {
+            FreeRegisters(current[j]);
+          }
+          break;
+        }
+        DCHECK_EQ(Instruction::CONSUME_RANGE, instruction.opcode);
+        if (position < subject_.length() &&
+            instruction.payload <= subject_[position] &&
+            subject_[position] <= instruction.extra) {
+          AddThread(&next, Thread{thread.pc + 1, thread.registers},
+                    position + 1);
+        } else {
+          FreeRegisters(thread);
+        }
+      }
+      if (position == subject_.length()) break;
+      position++;
+      // Unless a match was found already, also try to match starting at the
+      // next position, with the lowest priority.
+      if (!matched && !sticky) {
+        AddThread(&next, Thread{0, NewRegisters()}, position);
+      }
+      current.swap(next);
+    }
+    for (const Thread& thread : next) FreeRegisters(thread);
+    return matched;
+  }
+
+ private:
+  struct Thread {
+    int pc;
+    // Offset of the registers in {register_memory_}.
+    int registers;
+  };
+
+  int32_t* Registers(const Thread& thread) {
+    return &register_memory_[thread.registers];
+  }
+
+  int NewRegisters() {
+    int registers;
+    if (free_registers_.empty()) {
+      registers = static_cast<int>(register_memory_.size());
+      register_memory_.resize(register_memory_.size() + register_count_);
+    } else {
+      registers = free_registers_.back();
+      free_registers_.pop_back();
+    }
+    std::fill_n(&register_memory_[registers], register_count_, -1);
+    return registers;
+  }
+
+  int CopyRegisters(const Thread& thread) {
+    int copy = NewRegisters();
+    std::copy_n(&register_memory_[thread.registers], register_count_,
+                &register_memory_[copy]);
+    return copy;
+  }
+
+  void FreeRegisters(const Thread& thread) {
+    free_registers_.push_back(thread.registers);
+  }
+
+  bool IsWordAt(int position) {
+    return position >= 0 && position < subject_.length() &&
+           IsRegExpWord(subject_[position]);
+  }
+
+  bool IsLineTerminatorAt(int position) {
+    return unibrow::IsLineTerminator(subject_[position]);
+  }
+
+  bool AssertionHolds(int type, int position) {
+    switch (static_cast<RegExpAssertion::AssertionType>(type)) {
+      case RegExpAssertion::START_OF_INPUT:
+        return position == 0;
+      case RegExpAssertion::END_OF_INPUT:
+        return position == subject_.length();
+      case RegExpAssertion::START_OF_LINE:
+        return position == 0 || IsLineTerminatorAt(position - 1);
+      case RegExpAssertion::END_OF_LINE:
+        return position == subject_.length() || IsLineTerminatorAt(position);
+      case RegExpAssertion::BOUNDARY:
+        return IsWordAt(position - 1) != IsWordAt(position);
+      case RegExpAssertion::NON_BOUNDARY:
+        return IsWordAt(position - 1) == IsWordAt(position);
+    }
+    UNREACHABLE();
+  }
+
+  // Follows {thread} at {position} through all instructions which don't
+  // consume a character, and appends the resulting threads to {list} in
+  // priority order.
+  void AddThread(std::vector<Thread>* list, Thread thread, int position) {
+    stack_.push_back(thread);
+    while (!stack_.empty()) {
+      Thread t = stack_.back();
+      stack_.pop_back();
+      while (true) {
+        if (visited_[t.pc] == position) {
+          // A thread of higher priority got here first.
+          FreeRegisters(t);
+          break;
+        }
+        visited_[t.pc] = position;
+        const Instruction& instruction = code_[t.pc];
+        if (instruction.opcode == Instruction::CONSUME_RANGE ||
+            instruction.opcode == Instruction::ACCEPT) {
+          list->push_back(t);
+          break;
+        }
+        if (instruction.opcode == Instruction::FORK) {
+          // The alternative runs after everything reachable from here.
+          stack_.push_back(Thread{instruction.payload, CopyRegisters(t)});
+          t.pc++;
+        } else if (instruction.opcode == Instruction::JMP) {
+          t.pc = instruction.payload;
+        } else if (instruction.opcode == Instruction::SET_REGISTER_TO_CP) {
+          Registers(t)[instruction.payload] = position;
+          t.pc++;
+        } else if (instruction.opcode == Instruction::CLEAR_REGISTER) {
+          Registers(t)[instruction.payload] = -1;
+          t.pc++;
+        } else {
+          bool holds =
+              instruction.opcode == Instruction::CHECK_NOT_EMPTY
+                  ? Registers(t)[instruction.payload] != position
+                  : AssertionHolds(instruction.payload, position);
+          if (!holds) {
+            FreeRegisters(t);
+            break;
+          }
+          t.pc++;
+        }
+      }
+    }
+  }
+
+  const Instruction* const code_;
+  const int register_count_;
+  const Vector<const Char> subject_;
+  // The last position at which each instruction was visited.
+  std::vector<int> visited_;
+  std::vector<int32_t> register_memory_;
+  std::vector<int> free_registers_;
+  std::vector<Thread> stack_;
+};
+
+}  // namespace
+
+bool RegExpLinearEngine::CanBeHandled(RegExpTree* tree, JSRegExp::Flags flags,
+                                      int capture_count, Zone* zone) {
+  LinearCompiler compiler(flags, capture_count, zone);
+  return compiler.Compile(tree);
+}
+
+void RegExpLinearEngine::Initialize(Isolate* isolate, Handle<JSRegExp> re,
+                                    RegExpTree* tree, Zone* zone) {
+  LinearCompiler compiler(re->GetFlags(), re->CaptureCount(), zone);
+  CHECK(compiler.Compile(tree));
+  // The program is prefixed with the number of registers it uses.
+  const ZoneVector<Instruction>& code = compiler.code();
+  int32_t register_count = compiler.register_count();
+  int code_size = static_cast<int>(code.size() * sizeof(Instruction));
+  Handle<ByteArray> program = isolate->factory()->NewByteArray(
+      static_cast<int>(sizeof(register_count)) + code_size, TENURED);
+  program->copy_in(0, reinterpret_cast<const byte*>(&register_count),
+                   sizeof(register_count));
+  program->copy_in(sizeof(register_count),
+                   reinterpret_cast<const byte*>(code.data()), code_size);
+
+  Handle<FixedArray> data(FixedArray::cast(re->data()), isolate);
+  data->set(JSRegExp::kIrregexpLinearCodeIndex, *program);
+  // Drop the backtracking engine's code, so that it is not used anymore.
+  Smi uninitialized = Smi::FromInt(JSRegExp::kUninitializedValue);
+  data->set(JSRegExp::kIrregexpLatin1CodeIndex, uninitialized);
+  data->set(JSRegExp::kIrregexpUC16CodeIndex, uninitialized);
+}
+
+void RegExpLinearEngine::InitializeOnFallback(Isolate* isolate,
+                                              Handle<JSRegExp> re) {
+  DCHECK(re->HasLinearFallback());
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  Handle<String> pattern(re->Pattern(), isolate);
+  pattern = String::Flatten(isolate, pattern);
+  RegExpCompileData compile_data;
+  FlatStringReader reader(isolate, pattern);
+  // The pattern has been parsed successfully before.
+  CHECK(RegExpParser::ParseRegExp(isolate, &zone, &reader, re->GetFlags(),
+                                  &compile_data));
+  Initialize(isolate, re, compile_data.tree, &zone);
+}
+
+RegExpImpl::IrregexpResult RegExpLinearEngine::Exec(Isolate* isolate,
+                                                    Handle<JSRegExp> re,
+                                                    Handle<String> subject,
+                                                    int index,
+                                                    int32_t* output) {
+  DCHECK(re->UsesLinearEngine());
+  DCHECK(subject->IsFlat());
+  DCHECK_LE(0, index);
+  DCHECK_LE(index, subject->length());
+  DisallowHeapAllocation no_gc;
+  ByteArray program =
+      ByteArray::cast(re->DataAt(JSRegExp::kIrregexpLinearCodeIndex));
+  int32_t register_count = program->get_int(0);
+  const Instruction* code = reinterpret_cast<const Instruction*>(
+      program->GetDataStartAddress() + sizeof(register_count));
+  int code_length = static_cast<int>(
+      (program->length() - sizeof(register_count)) / sizeof(Instruction));
+  bool sticky = IsSticky(re->GetFlags());
+  int output_count = RegExpCapture::EndRegister(re->CaptureCount()) + 1;
+
+  String::FlatContent content = subject->GetFlatContent(no_gc);
+  bool matched;
+  if (content.IsOneByte()) {
+    LinearInterpreter<uint8_t> interpreter(code, code_length, register_count,
+                                           content.ToOneByteVector());
+    matched = interpreter.Match(index, sticky, output, output_count);
+  } else {
+    LinearInterpreter<uc16> interpreter(code, code_length, register_count,
+                                        content.ToUC16Vector());
+    matched = interpreter.Match(index, sticky, output, output_count);
+  }
+  return matched ? RegExpImpl::RE_SUCCESS : RegExpImpl::RE_FAILURE;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,49 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_LINEAR_ENGINE_H_
+#define V8_REGEXP_REGEXP_LINEAR_ENGINE_H_
+
+#include "src/regexp/jsregexp.h"
+
+namespace v8 {
+namespace internal {
+
+class RegExpTree;
+
+// A regexp engine which never backtracks. Patterns are compiled to a small
+// automaton program which is simulated on all possible paths at once (a
+// Pike VM), so matching takes time linear in the length of the subject
+// string for a given pattern. Threads are kept in priority order, which
+// gives the same results as the backtracking engine.
+//
+// Only patterns without backreferences and lookarounds, and without the
+// ignore-case and unicode flags, are supported.
+class RegExpLinearEngine final : public AllStatic {
+ public:
+  // Whether the parsed pattern {tree} can be matched by this engine.
+  static bool CanBeHandled(RegExpTree* tree, JSRegExp::Flags flags,
+                           int capture_count, Zone* zone);
+
+  // Compiles the parsed pattern {tree} and makes the irregexp regexp {re}
+  // use this engine from now on. The pattern must be supported.
+  static void Initialize(Isolate* isolate, Handle<JSRegExp> re,
+                         RegExpTree* tree, Zone* zone);
+
+  // Like Initialize, but parses the pattern of {re} again. Used to switch a
+  // regexp over after it backtracked excessively.
+  static void InitializeOnFallback(Isolate* isolate, Handle<JSRegExp> re);
+
+  // Matches {re} against the flat {subject}, starting at {index}. On success
+  // the capture registers are stored to {output}. Never throws.
+  static RegExpImpl::IrregexpResult Exec(Isolate* isolate,
+                                         Handle<JSRegExp> re,
+                                         Handle<String> subject, int index,
+                                         int32_t* output);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_LINEAR_ENGINE_H_
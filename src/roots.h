@@ -255,8 +255,6 @@ class RootVisitor;
   V(PropertyCell*, string_iterator_protector, StringIteratorProtector)        \
   /* Caches */                                                                \
   V(FixedArray, single_character_string_cache, SingleCharacterStringCache)    \
-  V(FixedArray, string_split_cache, StringSplitCache)                         \
-  V(FixedArray, regexp_multiple_cache, RegExpMultipleCache)                   \
   /* Indirection lists for isolate-independent builtins */                    \
   V(FixedArray, builtins_constants_table, BuiltinsConstantsTable)
 
@@ -264,6 +262,8 @@ class RootVisitor;
 #define STRONG_MUTABLE_MOVABLE_ROOT_LIST(V)                                \
   /* Caches */                                                             \
   V(FixedArray, number_string_cache, NumberStringCache)                    \
+  V(FixedArray, string_split_cache, StringSplitCache)                      \
+  V(FixedArray, regexp_multiple_cache, RegExpMultipleCache)                \
   /* Lists and dictionaries */                                             \
   V(NameDictionary, public_symbol_table, PublicSymbolTable)                \
   V(NameDictionary, api_symbol_table, ApiSymbolTable)                      \
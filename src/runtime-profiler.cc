@@ -194,6 +194,11 @@ OptimizationReason RuntimeProfiler::ShouldOptimize(JSFunction function,
   int ticks_for_optimization =
       kProfilerTicksBeforeOptimization +
       (bytecode->length() / kBytecodeSizeAllowancePerTick);
+  if (FLAG_code_cache_optimization_hints && bytecode->has_optimization_hint()) {
+    // The function was optimized in a previous run; only wait for the minimal
+    // number of ticks needed to collect fresh type feedback.
+    ticks_for_optimization = kProfilerTicksBeforeOptimization;
+  }
   if (ticks >= ticks_for_optimization) {
     return OptimizationReason::kHotAndStable;
   } else if (!any_ic_changed_ &&
@@ -216,9 +221,32 @@ OptimizationReason RuntimeProfiler::ShouldOptimize(JSFunction function,
   return OptimizationReason::kDoNotOptimize;
 }
 
+void RuntimeProfiler::MaybeAllocateFeedbackVector() {
+  // With --lazy-feedback-allocation, the interrupt budget of a function
+  // without a feedback vector runs out once the function has been executed
+  // a few times (see JSFunction::InitializeFeedbackVector). The function is
+  // the topmost JavaScript frame then.
+  JavaScriptFrameIterator it(isolate_);
+  if (it.done() || !it.frame()->is_interpreted()) return;
+  Handle<JSFunction> function(it.frame()->function(), isolate_);
+  if (function->has_feedback_vector()) return;
+  if (!function->shared()->IsInterpreted()) return;
+
+  if (FLAG_trace_opt_verbose) {
+    PrintF("[allocating feedback vector for ");
+    function->ShortPrint();
+    PrintF("]\n");
+  }
+  JSFunction::EnsureFeedbackVector(function);
+  // The invocation that got us here counts as well.
+  function->feedback_vector()->set_invocation_count(1);
+}
+
 void RuntimeProfiler::MarkCandidatesForOptimization() {
   HandleScope scope(isolate_);
 
+  if (FLAG_lazy_feedback_allocation) MaybeAllocateFeedbackVector();
+
   if (!isolate_->use_optimizer()) return;
 
   DisallowHeapAllocation no_gc;
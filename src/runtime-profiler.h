@@ -29,6 +29,7 @@ class RuntimeProfiler {
 
  private:
   void MaybeOptimize(JSFunction function, InterpretedFrame* frame);
+  void MaybeAllocateFeedbackVector();
   // Potentially attempts OSR from and returns whether no other
   // optimization attempts should be made.
   bool MaybeOSR(JSFunction function, InterpretedFrame* frame);
@@ -8,6 +8,7 @@
 #include "src/debug/debug.h"
 #include "src/elements.h"
 #include "src/heap/factory.h"
+#include "src/interpreter/bytecode-array-iterator.h"
 #include "src/isolate-inl.h"
 #include "src/keys.h"
 #include "src/objects/arguments-inl.h"
@@ -371,6 +372,73 @@ MaybeHandle<Object> CopyFromPrototype(Isolate* isolate,
 
 }  // namespace
 
+namespace {
+
+// Returns true if the bytecode is exactly "return lhs - rhs;" for the
+// parameters {lhs} and {rhs}.
+bool IsParameterSubtraction(Handle<BytecodeArray> bytecode, int lhs, int rhs) {
+  const int parameter_count = bytecode->parameter_count();
+  interpreter::BytecodeArrayIterator iterator(bytecode);
+  if (iterator.done() ||
+      iterator.current_bytecode() != interpreter::Bytecode::kStackCheck) {
+    return false;
+  }
+  iterator.Advance();
+  if (iterator.done() ||
+      iterator.current_bytecode() != interpreter::Bytecode::kLdar ||
+      iterator.GetRegisterOperand(0) !=
+          interpreter::Register::FromParameterIndex(rhs, parameter_count)) {
+    return false;
+  }
+  iterator.Advance();
+  if (iterator.done() ||
+      iterator.current_bytecode() != interpreter::Bytecode::kSub ||
+      iterator.GetRegisterOperand(0) !=
+          interpreter::Register::FromParameterIndex(lhs, parameter_count)) {
+    return false;
+  }
+  iterator.Advance();
+  if (iterator.done() ||
+      iterator.current_bytecode() != interpreter::Bytecode::kReturn) {
+    return false;
+  }
+  iterator.Advance();
+  return iterator.done();
+}
+
+}  // namespace
+
+// Recognizes the numeric comparators "(a, b) => a - b" and "(a, b) => b - a",
+// for which Array.prototype.sort can compare Numbers without calling into JS.
+// Returns 1 for the former, -1 for the latter and 0 for anything else.
+RUNTIME_FUNCTION(Runtime_ClassifySortComparator) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_ARG_CHECKED(Object, comparefn, 0);
+
+  if (!comparefn->IsJSFunction()) return Smi::kZero;
+  // Skipping the calls must not be observable through the debugger or
+  // through precise code coverage.
+  if (isolate->debug()->is_active() ||
+      !isolate->is_best_effort_code_coverage()) {
+    return Smi::kZero;
+  }
+  SharedFunctionInfo shared = JSFunction::cast(comparefn)->shared();
+  if (shared->kind() != FunctionKind::kNormalFunction &&
+      shared->kind() != FunctionKind::kArrowFunction) {
+    return Smi::kZero;
+  }
+  // The comparator is only recognized once it was compiled, i.e. after its
+  // first call.
+  if (!shared->HasBytecodeArray()) return Smi::kZero;
+  Handle<BytecodeArray> bytecode(shared->GetBytecodeArray(), isolate);
+  // The receiver is parameter 0, the two arguments are 1 and 2.
+  if (bytecode->parameter_count() != 3) return Smi::kZero;
+  if (IsParameterSubtraction(bytecode, 1, 2)) return Smi::FromInt(1);
+  if (IsParameterSubtraction(bytecode, 2, 1)) return Smi::FromInt(-1);
+  return Smi::kZero;
+}
+
 RUNTIME_FUNCTION(Runtime_PrepareElementsForSort) {
   HandleScope scope(isolate);
   DCHECK_EQ(2, args.length());
@@ -172,9 +172,14 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   JavaScriptFrame* top_frame = top_it.frame();
   isolate->set_context(Context::cast(top_frame->context()));
 
-  // Invalidate the underlying optimized code on non-lazy deopts.
+  // Invalidate the underlying optimized code on non-lazy deopts. The code
+  // didn't stick, so don't hint code caches to optimize the function early.
   if (type != DeoptimizeKind::kLazy) {
     Deoptimizer::DeoptimizeFunction(*function);
+    if (FLAG_code_cache_optimization_hints &&
+        function->shared()->HasBytecodeArray()) {
+      function->shared()->GetBytecodeArray()->set_has_optimization_hint(false);
+    }
   }
 
   return ReadOnlyRoots(isolate).undefined_value();
@@ -281,9 +286,12 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
     }
   }
 
-  // Failed.
+  // Failed, or the code is still being compiled concurrently.
   if (FLAG_trace_osr) {
-    PrintF("[OSR - Failed: ");
+    bool queued = isolate->concurrent_recompilation_enabled() &&
+                  isolate->optimizing_compile_dispatcher()->IsQueuedForOSR(
+                      function);
+    PrintF(queued ? "[OSR - Compiling concurrently: " : "[OSR - Failed: ");
     function->PrintName();
     PrintF(" at AST id %d]\n", ast_id.ToInt());
   }
@@ -102,6 +102,102 @@ bool CompareNum(T x, T y) {
   return false;
 }
 
+// Maps elements to unsigned keys whose natural order is the default sort
+// order of %TypedArray%.prototype.sort.
+template <typename T, typename = void>
+struct SortKey {
+  typedef T Key;
+  static Key Of(T value) { return value; }
+};
+
+template <typename T>
+struct SortKey<T, typename std::enable_if<std::is_integral<T>::value &&
+                                          std::is_signed<T>::value>::type> {
+  typedef typename std::make_unsigned<T>::type Key;
+  static Key Of(T value) {
+    // Flipping the sign bit moves the negative values below the others.
+    return static_cast<Key>(static_cast<Key>(value) ^
+                            (Key{1} << (sizeof(Key) * kBitsPerByte - 1)));
+  }
+};
+
+template <typename T, typename Bits>
+Bits FloatSortKey(T value) {
+  // NaNs go last, in any order and regardless of their sign.
+  if (std::isnan(value)) return std::numeric_limits<Bits>::max();
+  // Flipping all bits of negative values reverses their order and moves them
+  // below the positive ones, whose sign bit gets set. This sorts -0 before
+  // +0, too.
+  Bits bits = bit_cast<Bits>(value);
+  const Bits kSignBit = Bits{1} << (sizeof(Bits) * kBitsPerByte - 1);
+  return (bits & kSignBit) ? ~bits : (bits | kSignBit);
+}
+
+template <>
+struct SortKey<float> {
+  typedef uint32_t Key;
+  static Key Of(float value) { return FloatSortKey<float, Key>(value); }
+};
+
+template <>
+struct SortKey<double> {
+  typedef uint64_t Key;
+  static Key Of(double value) { return FloatSortKey<double, Key>(value); }
+};
+
+// Sorts {data} by SortKey with a least significant digit first radix sort
+// on 8-bit digits. This takes one pass over the data per digit, and skips
+// the digits which are the same in all elements.
+template <typename T>
+void RadixSort(T* data, size_t length) {
+  typedef typename SortKey<T>::Key Key;
+  const int kDigits = sizeof(Key);
+  const int kBuckets = 1 << kBitsPerByte;
+  std::vector<size_t> counts(kDigits * kBuckets);
+  for (size_t i = 0; i < length; i++) {
+    Key key = SortKey<T>::Of(data[i]);
+    for (int digit = 0; digit < kDigits; digit++) {
+      counts[digit * kBuckets + ((key >> (digit * kBitsPerByte)) & 0xFF)]++;
+    }
+  }
+  std::vector<T> buffer(length);
+  T* from = data;
+  T* to = buffer.data();
+  for (int digit = 0; digit < kDigits; digit++) {
+    size_t* count = &counts[digit * kBuckets];
+    if (std::find(count, count + kBuckets, length) != count + kBuckets) {
+      continue;
+    }
+    size_t offset = 0;
+    for (int bucket = 0; bucket < kBuckets; bucket++) {
+      size_t bucket_count = count[bucket];
+      count[bucket] = offset;
+      offset += bucket_count;
+    }
+    for (size_t i = 0; i < length; i++) {
+      T value = from[i];
+      Key key = SortKey<T>::Of(value);
+      to[count[(key >> (digit * kBitsPerByte)) & 0xFF]++] = value;
+    }
+    std::swap(from, to);
+  }
+  if (from != data) std::copy(from, from + length, data);
+}
+
+// Below this length, std::sort is faster than the radix sort.
+const size_t kRadixSortThreshold = 256;
+
+template <typename T>
+void TypedArraySort(T* data, size_t length) {
+  if (length >= kRadixSortThreshold) {
+    RadixSort(data, length);
+  } else if (std::is_floating_point<T>::value) {
+    std::sort(data, data + length, CompareNum<T>);
+  } else {
+    std::sort(data, data + length);
+  }
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
@@ -128,11 +224,7 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
 #define TYPED_ARRAY_SORT(Type, type, TYPE, ctype)           \
   case kExternal##Type##Array: {                            \
     ctype* data = static_cast<ctype*>(elements->DataPtr()); \
-    if (kExternal##Type##Array == kExternalFloat64Array ||  \
-        kExternal##Type##Array == kExternalFloat32Array)    \
-      std::sort(data, data + length, CompareNum<ctype>);    \
-    else                                                    \
-      std::sort(data, data + length);                       \
+    TypedArraySort(data, length);                           \
     break;                                                  \
   }
 
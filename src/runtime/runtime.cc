@@ -107,6 +107,7 @@ bool Runtime::NeedsExactContext(FunctionId id) {
       return false;
     case Runtime::kAddPrivateField:
     case Runtime::kCopyDataProperties:
+    case Runtime::kInlineCopyDataProperties:
     case Runtime::kCreateDataProperty:
     case Runtime::kCreatePrivateNameSymbol:
     case Runtime::kReThrow:
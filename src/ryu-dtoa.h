@@ -0,0 +1,36 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_RYU_DTOA_H_
+#define V8_RYU_DTOA_H_
+
+#include "src/vector.h"
+
+namespace v8 {
+namespace internal {
+
+// RyuDtoa will produce at most kRyuDtoaMaximalLength digits. This does not
+// include the terminating '\0' character.
+const int kRyuDtoaMaximalLength = 17;
+
+// Provides the shortest decimal representation of v, using Ulf Adams' Ryu
+// algorithm ("Ryu: Fast Float-to-String Conversion", PLDI 2018).
+// The result should be interpreted as buffer * 10^(point - length).
+//
+// Precondition:
+//   * v must be a strictly positive finite double.
+//
+// Unlike FastDtoa, this always succeeds and needs no bignum fallback. The
+// result is the same as FastDtoa's in FAST_DTOA_SHORTEST mode: it satisfies
+//     v == (double) (buffer * 10^(point - length)),
+// has the fewest possible digits, and among those is closest to v, with ties
+// broken towards an even last digit. There will be *length digits inside the
+// buffer followed by a null terminator. The buffer must be large enough to
+// hold the result.
+void RyuDtoa(double v, Vector<char> buffer, int* length, int* decimal_point);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_RYU_DTOA_H_
@@ -19,7 +19,11 @@ namespace v8 {
 namespace internal {
 
 ScriptData::ScriptData(const byte* data, int length)
-    : owns_data_(false), rejected_(false), data_(data), length_(length) {
+    : owns_data_(false),
+      rejected_(false),
+      checksum_verified_(false),
+      data_(data),
+      length_(length) {
   if (!IsAligned(reinterpret_cast<intptr_t>(data), kPointerAlignment)) {
     byte* copy = NewArray<byte>(length);
     DCHECK(IsAligned(reinterpret_cast<intptr_t>(copy), kPointerAlignment));
@@ -58,11 +62,31 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
 
   isolate->heap()->read_only_space()->ClearStringPaddingIfNeeded();
 
+  // With --code-cache-lazy-functions, inner functions are serialized as if
+  // they had never been compiled. The serializer must not allocate, so create
+  // their uncompiled data up front.
+  std::unordered_map<Address, Handle<UncompiledData>> lazy_function_data;
+  if (FLAG_code_cache_lazy_functions) {
+    SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+    for (SharedFunctionInfo sfi = iter.Next(); !sfi.is_null();
+         sfi = iter.Next()) {
+      if (sfi->is_toplevel() || !sfi->HasBytecodeArray()) continue;
+      Handle<SharedFunctionInfo> shared(sfi, isolate);
+      Handle<UncompiledData> data =
+          isolate->factory()->NewUncompiledDataWithoutPreParsedScope(
+              handle(shared->inferred_name(), isolate),
+              shared->StartPosition(), shared->EndPosition(),
+              shared->FunctionLiteralId(isolate));
+      lazy_function_data[shared->ptr()] = data;
+    }
+  }
+
   // Serialize code object.
   Handle<String> source(String::cast(script->source()), isolate);
   CodeSerializer cs(isolate, SerializedCodeData::SourceHash(
                                  source, script->origin_options()));
   DisallowHeapAllocation no_gc;
+  cs.lazy_function_data_ = std::move(lazy_function_data);
   cs.reference_map()->AddAttachedReference(*source);
   ScriptData* script_data = cs.SerializeSharedFunctionInfo(info);
 
@@ -194,12 +218,33 @@ void CodeSerializer::SerializeObject(HeapObject* obj, HowToCode how_to_code,
     }
     DCHECK(!sfi->HasDebugInfo());
 
+    // Drop the compiled data of functions that should be compiled lazily.
+    Object* function_data = nullptr;
+    HeapObjectPtr feedback_metadata;
+    auto lazy_data = lazy_function_data_.find(sfi->ptr());
+    if (lazy_data != lazy_function_data_.end()) {
+      function_data = sfi->function_data();
+      feedback_metadata = sfi->raw_outer_scope_info_or_feedback_metadata();
+      HeapObjectPtr outer_scope_info =
+          sfi->scope_info()->HasOuterScopeInfo()
+              ? HeapObjectPtr::cast(sfi->scope_info()->OuterScopeInfo())
+              : HeapObjectPtr::cast(roots.the_hole_value());
+      sfi->set_raw_outer_scope_info_or_feedback_metadata(outer_scope_info);
+      sfi->set_function_data(*lazy_data->second);
+    }
+
     // Mark SFI to indicate whether the code is cached.
     bool was_deserialized = sfi->deserialized();
     sfi->set_deserialized(sfi->is_compiled());
     SerializeGeneric(obj, how_to_code, where_to_point);
     sfi->set_deserialized(was_deserialized);
 
+    // Restore compiled data.
+    if (function_data != nullptr) {
+      sfi->set_function_data(function_data);
+      sfi->set_raw_outer_scope_info_or_feedback_metadata(feedback_metadata);
+    }
+
     // Restore debug info
     if (debug_info != nullptr) {
       sfi->set_script_or_debug_info(debug_info);
@@ -354,7 +399,8 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
 }
 
 SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
-    Isolate* isolate, uint32_t expected_source_hash) const {
+    Isolate* isolate, uint32_t expected_source_hash,
+    bool checksum_verified) const {
   if (this->size_ < kHeaderSize) return INVALID_HEADER;
   uint32_t magic_number = GetMagicNumber();
   if (magic_number != kMagicNumber) return MAGIC_NUMBER_MISMATCH;
@@ -376,10 +422,20 @@ SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
       POINTER_SIZE_ALIGN(kHeaderSize +
                          GetHeaderValue(kNumReservationsOffset) * kInt32Size);
   if (payload_length > max_payload_length) return LENGTH_MISMATCH;
-  if (!Checksum(ChecksummedContent()).Check(c1, c2)) return CHECKSUM_MISMATCH;
+  if (!checksum_verified && !Checksum(ChecksummedContent()).Check(c1, c2)) {
+    return CHECKSUM_MISMATCH;
+  }
   return CHECK_SUCCESS;
 }
 
+bool SerializedCodeData::VerifyChecksum(ScriptData* cached_data) {
+  SerializedCodeData scd(cached_data);
+  if (scd.size_ < kHeaderSize) return false;
+  uint32_t c1 = scd.GetHeaderValue(kChecksumPartAOffset);
+  uint32_t c2 = scd.GetHeaderValue(kChecksumPartBOffset);
+  return Checksum(scd.ChecksummedContent()).Check(c1, c2);
+}
+
 uint32_t SerializedCodeData::SourceHash(Handle<String> source,
                                         ScriptOriginOptions origin_options) {
   const uint32_t source_length = source->length();
@@ -429,7 +485,8 @@ SerializedCodeData SerializedCodeData::FromCachedData(
     SanityCheckResult* rejection_result) {
   DisallowHeapAllocation no_gc;
   SerializedCodeData scd(cached_data);
-  *rejection_result = scd.SanityCheck(isolate, expected_source_hash);
+  *rejection_result = scd.SanityCheck(isolate, expected_source_hash,
+                                      cached_data->checksum_verified());
   if (*rejection_result != CHECK_SUCCESS) {
     cached_data->Reject();
     return SerializedCodeData(nullptr, 0);
@@ -437,5 +494,24 @@ SerializedCodeData SerializedCodeData::FromCachedData(
   return scd;
 }
 
+BackgroundDeserializeTask::BackgroundDeserializeTask(
+    const ScriptCompiler::CachedData* cached_data)
+    : cached_data_(cached_data) {}
+
+void BackgroundDeserializeTask::Run() {
+  DCHECK(!script_data_);
+  // ScriptData takes care of pointer-aligning the data.
+  script_data_.reset(new ScriptData(cached_data_->data, cached_data_->length));
+  // A failed check is not recorded here; the main thread repeats it and
+  // reports the rejection reason as usual.
+  if (SerializedCodeData::VerifyChecksum(script_data_.get())) {
+    script_data_->MarkChecksumVerified();
+  }
+}
+
+ScriptData* BackgroundDeserializeTask::ReleaseScriptData() {
+  return script_data_.release();
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,8 @@
 #ifndef V8_SNAPSHOT_CODE_SERIALIZER_H_
 #define V8_SNAPSHOT_CODE_SERIALIZER_H_
 
+#include <unordered_map>
+
 #include "src/snapshot/serializer.h"
 
 namespace v8 {
@@ -20,8 +22,10 @@ class ScriptData {
   const byte* data() const { return data_; }
   int length() const { return length_; }
   bool rejected() const { return rejected_; }
+  bool checksum_verified() const { return checksum_verified_; }
 
   void Reject() { rejected_ = true; }
+  void MarkChecksumVerified() { checksum_verified_ = true; }
 
   void AcquireDataOwnership() {
     DCHECK(!owns_data_);
@@ -36,6 +40,7 @@ class ScriptData {
  private:
   bool owns_data_ : 1;
   bool rejected_ : 1;
+  bool checksum_verified_ : 1;
   const byte* data_;
   int length_;
 
@@ -76,6 +81,9 @@ class CodeSerializer : public Serializer {
 
   DISALLOW_HEAP_ALLOCATION(no_gc_);
   uint32_t source_hash_;
+  // Uncompiled data to serialize in place of the bytecode of functions that
+  // are to be compiled lazily after deserialization, keyed by function.
+  std::unordered_map<Address, Handle<UncompiledData>> lazy_function_data_;
   DISALLOW_COPY_AND_ASSIGN(CodeSerializer);
 };
 
@@ -141,6 +149,10 @@ class SerializedCodeData : public SerializedData {
   static uint32_t SourceHash(Handle<String> source,
                              ScriptOriginOptions origin_options);
 
+  // Verifies the payload checksum without touching the heap. May be called on
+  // a background thread.
+  static bool VerifyChecksum(ScriptData* cached_data);
+
  private:
   explicit SerializedCodeData(ScriptData* data);
   SerializedCodeData(const byte* data, int size)
@@ -151,7 +163,31 @@ class SerializedCodeData : public SerializedData {
   }
 
   SanityCheckResult SanityCheck(Isolate* isolate,
-                                uint32_t expected_source_hash) const;
+                                uint32_t expected_source_hash,
+                                bool checksum_verified) const;
+};
+
+// Performs the parts of consuming a code cache which do not access the heap,
+// so that they can run on a background thread ahead of
+// CodeSerializer::Deserialize.
+class BackgroundDeserializeTask {
+ public:
+  explicit BackgroundDeserializeTask(
+      const ScriptCompiler::CachedData* cached_data);
+
+  void Run();
+
+  // Returns the prepared ScriptData and transfers ownership to the caller, or
+  // nullptr if Run has not been called.
+  ScriptData* ReleaseScriptData();
+
+  const ScriptCompiler::CachedData* cached_data() const { return cached_data_; }
+
+ private:
+  const ScriptCompiler::CachedData* cached_data_;
+  std::unique_ptr<ScriptData> script_data_;
+
+  DISALLOW_COPY_AND_ASSIGN(BackgroundDeserializeTask);
 };
 
 }  // namespace internal
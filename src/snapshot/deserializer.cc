@@ -207,8 +207,11 @@ uint32_t StringTableInsertionKey::ComputeHashField(String string) {
 }
 
 HeapObject* Deserializer::PostProcessNewObject(HeapObject* obj, int space) {
+  // This runs for every deserialized object, so look at the instance type
+  // only once rather than reloading it for each of the checks below.
+  InstanceType instance_type = obj->map()->instance_type();
   if ((FLAG_rehash_snapshot && can_rehash_) || deserializing_user_code()) {
-    if (obj->IsString()) {
+    if (InstanceTypeChecker::IsString(instance_type)) {
       // Uninitialize hash field as we need to recompute the hash.
       String string = String::cast(obj);
       string->set_hash_field(String::kEmptyHashField);
@@ -218,7 +221,7 @@ HeapObject* Deserializer::PostProcessNewObject(HeapObject* obj, int space) {
   }
 
   if (deserializing_user_code()) {
-    if (obj->IsString()) {
+    if (InstanceTypeChecker::IsString(instance_type)) {
       String string = String::cast(obj);
       if (string->IsInternalizedString()) {
         // Canonicalize the internalized string. If it already exists in the
@@ -232,9 +235,9 @@ HeapObject* Deserializer::PostProcessNewObject(HeapObject* obj, int space) {
         new_internalized_strings_.push_back(handle(string, isolate_));
         return string;
       }
-    } else if (obj->IsScript()) {
+    } else if (InstanceTypeChecker::IsScript(instance_type)) {
       new_scripts_.push_back(handle(Script::cast(obj), isolate_));
-    } else if (obj->IsAllocationSite()) {
+    } else if (InstanceTypeChecker::IsAllocationSite(instance_type)) {
       // We should link new allocation sites, but we can't do this immediately
       // because |AllocationSite::HasWeakNext()| internally accesses
       // |Heap::roots_| that may not have been initialized yet. So defer this to
@@ -244,28 +247,29 @@ HeapObject* Deserializer::PostProcessNewObject(HeapObject* obj, int space) {
       DCHECK(CanBeDeferred(obj));
     }
   }
-  if (obj->IsScript()) {
+  if (InstanceTypeChecker::IsScript(instance_type)) {
     LogScriptEvents(Script::cast(obj));
-  } else if (obj->IsCode()) {
+  } else if (InstanceTypeChecker::IsCode(instance_type)) {
     // We flush all code pages after deserializing the startup snapshot.
     // Hence we only remember each individual code object when deserializing
     // user code.
     if (deserializing_user_code() || space == LO_SPACE) {
       new_code_objects_.push_back(Code::cast(obj));
     }
-  } else if (FLAG_trace_maps && obj->IsMap()) {
+  } else if (FLAG_trace_maps && InstanceTypeChecker::IsMap(instance_type)) {
     // Keep track of all seen Maps to log them later since they might be only
     // partially initialized at this point.
     new_maps_.push_back(Map::cast(obj));
-  } else if (obj->IsAccessorInfo()) {
+  } else if (InstanceTypeChecker::IsAccessorInfo(instance_type)) {
 #ifdef USE_SIMULATOR
     accessor_infos_.push_back(AccessorInfo::cast(obj));
 #endif
-  } else if (obj->IsCallHandlerInfo()) {
+  } else if (InstanceTypeChecker::IsCallHandlerInfo(instance_type)) {
 #ifdef USE_SIMULATOR
     call_handler_infos_.push_back(CallHandlerInfo::cast(obj));
 #endif
-  } else if (obj->IsExternalString()) {
+  } else if (InstanceTypeChecker::IsString(instance_type) &&
+             StringShape(instance_type).IsExternal()) {
     if (obj->map() == ReadOnlyRoots(isolate_).native_source_string_map()) {
       ExternalOneByteString string = ExternalOneByteString::cast(obj);
       DCHECK(string->is_uncached());
@@ -282,7 +286,7 @@ HeapObject* Deserializer::PostProcessNewObject(HeapObject* obj, int space) {
                                              string->ExternalPayloadSize());
     }
     isolate_->heap()->RegisterExternalString(String::cast(obj));
-  } else if (obj->IsJSTypedArray()) {
+  } else if (InstanceTypeChecker::IsJSTypedArray(instance_type)) {
     JSTypedArray typed_array = JSTypedArray::cast(obj);
     CHECK_LE(typed_array->byte_offset(), Smi::kMaxValue);
     int32_t byte_offset = static_cast<int32_t>(typed_array->byte_offset());
@@ -297,7 +301,7 @@ HeapObject* Deserializer::PostProcessNewObject(HeapObject* obj, int space) {
           byte_offset);
       elements->set_external_pointer(pointer_with_offset);
     }
-  } else if (obj->IsJSArrayBuffer()) {
+  } else if (InstanceTypeChecker::IsJSArrayBuffer(instance_type)) {
     JSArrayBuffer buffer = JSArrayBuffer::cast(obj);
     // Only fixup for the off-heap case.
     if (buffer->backing_store() != nullptr) {
@@ -307,7 +311,7 @@ HeapObject* Deserializer::PostProcessNewObject(HeapObject* obj, int space) {
       buffer->set_backing_store(backing_store);
       isolate_->heap()->RegisterNewArrayBuffer(buffer);
     }
-  } else if (obj->IsFixedTypedArrayBase()) {
+  } else if (InstanceTypeChecker::IsFixedTypedArrayBase(instance_type)) {
     FixedTypedArrayBase fta = FixedTypedArrayBase::cast(obj);
     // Only fixup for the off-heap case.
     if (fta->base_pointer() == Smi::kZero) {
@@ -315,7 +319,7 @@ HeapObject* Deserializer::PostProcessNewObject(HeapObject* obj, int space) {
       void* backing_store = off_heap_backing_stores_[store_index->value()];
       fta->set_external_pointer(backing_store);
     }
-  } else if (obj->IsBytecodeArray()) {
+  } else if (InstanceTypeChecker::IsBytecodeArray(instance_type)) {
     // TODO(mythria): Remove these once we store the default values for these
     // fields in the serializer.
     BytecodeArray bytecode_array = BytecodeArray::cast(obj);
@@ -4,6 +4,11 @@
 
 #include "src/snapshot/embedded-data.h"
 
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
 #include "src/assembler-inl.h"
 #include "src/callable.h"
 #include "src/macro-assembler.h"
@@ -28,7 +33,9 @@ Code InstructionStream::TryLookupCode(Isolate* isolate, Address address) {
   if (!PcIsOffHeap(isolate, address)) return Code();
 
   EmbeddedData d = EmbeddedData::FromBlob();
-  if (address < d.InstructionStartOfBuiltin(0)) return Code();
+  if (address < d.InstructionStartOfBuiltin(d.BuiltinAtLayoutPosition(0))) {
+    return Code();
+  }
 
   // Note: Addresses within the padding section between builtins (i.e. within
   // start + size <= address < start + padded_size) are interpreted as belonging
@@ -37,15 +44,16 @@ Code InstructionStream::TryLookupCode(Isolate* isolate, Address address) {
   int l = 0, r = Builtins::builtin_count;
   while (l < r) {
     const int mid = (l + r) / 2;
-    Address start = d.InstructionStartOfBuiltin(mid);
-    Address end = start + d.PaddedInstructionSizeOfBuiltin(mid);
+    const int builtin = d.BuiltinAtLayoutPosition(mid);
+    Address start = d.InstructionStartOfBuiltin(builtin);
+    Address end = start + d.PaddedInstructionSizeOfBuiltin(builtin);
 
     if (address < start) {
       r = mid;
     } else if (address >= end) {
       l = mid + 1;
     } else {
-      return isolate->builtins()->builtin(mid);
+      return isolate->builtins()->builtin(builtin);
     }
   }
 
@@ -170,6 +178,51 @@ void FinalizeEmbeddedCodeTargets(Isolate* isolate, EmbeddedData* blob) {
   }
 }
 
+// Returns all builtin ids in the order in which their instruction streams are
+// laid out. That is the id order, unless --embedded-builtins-profile names a
+// profile: then the builtins in it come first, hottest first, followed by the
+// remaining ones in id order. Builtins that run together thereby share cache
+// lines and pages.
+std::vector<uint32_t> BuiltinLayoutOrder() {
+  std::vector<uint32_t> order;
+  std::vector<bool> ordered(Builtins::builtin_count, false);
+  if (FLAG_embedded_builtins_profile != nullptr) {
+    std::ifstream profile(FLAG_embedded_builtins_profile);
+    CHECK_WITH_MSG(profile.good(), "Cannot read the embedded builtins profile");
+    std::unordered_map<std::string, int> ids;
+    for (int i = 0; i < Builtins::builtin_count; i++) {
+      ids[Builtins::name(i)] = i;
+    }
+    std::vector<std::pair<uint64_t, int>> hot;
+    std::string line;
+    while (std::getline(profile, line)) {
+      std::istringstream fields(line);
+      std::string name;
+      uint64_t count;
+      if (!(fields >> name) || name[0] == '#') continue;
+      auto it = ids.find(name);
+      if (!(fields >> count) || it == ids.end() || ordered[it->second]) {
+        // Profiles may come from other V8 versions, so this is not fatal.
+        fprintf(stderr, "Ignoring builtins profile line: %s\n", line.c_str());
+        continue;
+      }
+      ordered[it->second] = true;
+      hot.emplace_back(count, it->second);
+    }
+    // Ties are broken by id, to keep the layout reproducible.
+    std::stable_sort(hot.begin(), hot.end(),
+                     [](const std::pair<uint64_t, int>& a,
+                        const std::pair<uint64_t, int>& b) {
+                       return a.first > b.first;
+                     });
+    for (const auto& entry : hot) order.push_back(entry.second);
+  }
+  for (int i = 0; i < Builtins::builtin_count; i++) {
+    if (!ordered[i]) order.push_back(i);
+  }
+  return order;
+}
+
 }  // namespace
 
 // static
@@ -178,10 +231,13 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
 
   // Store instruction stream lengths and offsets.
   std::vector<struct Metadata> metadata(kTableSize);
+  const std::vector<uint32_t> layout_order = BuiltinLayoutOrder();
+  DCHECK_EQ(kTableSize, layout_order.size());
 
   bool saw_unsafe_builtin = false;
   uint32_t raw_data_size = 0;
-  for (int i = 0; i < Builtins::builtin_count; i++) {
+  for (uint32_t position = 0; position < kTableSize; position++) {
+    const int i = static_cast<int>(layout_order[position]);
     Code code = builtins->builtin(i);
 
     if (Builtins::IsIsolateIndependent(i)) {
@@ -236,6 +292,9 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
   // Write the metadata tables.
   DCHECK_EQ(MetadataSize(), sizeof(metadata[0]) * metadata.size());
   std::memcpy(blob + MetadataOffset(), metadata.data(), MetadataSize());
+  DCHECK_EQ(LayoutOrderSize(), sizeof(layout_order[0]) * layout_order.size());
+  std::memcpy(blob + LayoutOrderOffset(), layout_order.data(),
+              LayoutOrderSize());
 
   // Write the raw data section.
   for (int i = 0; i < Builtins::builtin_count; i++) {
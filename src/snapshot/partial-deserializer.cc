@@ -66,6 +66,8 @@ void PartialDeserializer::DeserializeEmbedderFields(
   DisallowJavascriptExecution no_js(isolate());
   DisallowCompilation no_compile(isolate());
   DCHECK_NOT_NULL(embedder_fields_deserializer.callback);
+  // The callback doesn't keep the data, so one buffer serves all fields.
+  std::vector<byte> data;
   for (int code = source()->Get(); code != kSynchronize;
        code = source()->Get()) {
     HandleScope scope(isolate());
@@ -76,13 +78,12 @@ void PartialDeserializer::DeserializeEmbedderFields(
                          isolate());
     int index = source()->GetInt();
     int size = source()->GetInt();
-    // TODO(yangguo,jgruber): Turn this into a reusable shared buffer.
-    byte* data = new byte[size];
-    source()->CopyRaw(data, size);
-    embedder_fields_deserializer.callback(v8::Utils::ToLocal(obj), index,
-                                          {reinterpret_cast<char*>(data), size},
-                                          embedder_fields_deserializer.data);
-    delete[] data;
+    if (data.size() < static_cast<size_t>(size)) data.resize(size);
+    source()->CopyRaw(data.data(), size);
+    embedder_fields_deserializer.callback(
+        v8::Utils::ToLocal(obj), index,
+        {reinterpret_cast<char*>(data.data()), size},
+        embedder_fields_deserializer.data);
   }
 }
 }  // namespace internal
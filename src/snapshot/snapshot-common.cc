@@ -6,6 +6,8 @@
 
 #include "src/snapshot/snapshot.h"
 
+#include <atomic>
+
 #include "src/base/platform/platform.h"
 #include "src/counters.h"
 #include "src/snapshot/partial-deserializer.h"
@@ -21,6 +23,28 @@ bool Snapshot::SnapshotIsValid(const v8::StartupData* snapshot_blob) {
 }
 #endif  // DEBUG
 
+namespace {
+
+// The data of the default snapshot blob once its checksum has been verified.
+// The default blob stays alive and unchanged for the lifetime of the process,
+// so isolates created from it don't need to checksum all of it again.
+std::atomic<const char*> verified_default_blob_data{nullptr};
+
+bool VerifyChecksumOnce(const v8::StartupData* blob) {
+  bool is_default_blob = blob == Snapshot::DefaultSnapshotBlob();
+  if (is_default_blob && verified_default_blob_data.load(
+                             std::memory_order_relaxed) == blob->data) {
+    return true;
+  }
+  if (!Snapshot::VerifyChecksum(blob)) return false;
+  if (is_default_blob) {
+    verified_default_blob_data.store(blob->data, std::memory_order_relaxed);
+  }
+  return true;
+}
+
+}  // namespace
+
 bool Snapshot::HasContextSnapshot(Isolate* isolate, size_t index) {
   // Do not use snapshots if the isolate is used to create snapshots.
   const v8::StartupData* blob = isolate->snapshot_blob();
@@ -39,7 +63,7 @@ bool Snapshot::Initialize(Isolate* isolate) {
 
   const v8::StartupData* blob = isolate->snapshot_blob();
   CheckVersion(blob);
-  CHECK(VerifyChecksum(blob));
+  CHECK(VerifyChecksumOnce(blob));
   Vector<const byte> startup_data = ExtractStartupData(blob);
   SnapshotData startup_snapshot_data(startup_data);
   Vector<const byte> read_only_data = ExtractReadOnlyData(blob);
@@ -9,6 +9,7 @@
 #include "src/handles-inl.h"
 #include "src/heap/factory.h"
 #include "src/isolate.h"
+#include "src/memcopy.h"
 #include "src/objects.h"
 #include "src/objects/fixed-array.h"
 #include "src/objects/string-inl.h"
@@ -163,6 +164,20 @@ class IncrementalStringBuilder {
     return CurrentPartCanFit(worst_case_length) ? worst_case_length : 0;
   }
 
+  // Returns how many of the next {length} characters can be escaped into the
+  // current part, using the same estimate as EscapedLengthIfCurrentPartFits.
+  // If the current part is nearly full, it is finished early and a new part
+  // sized for the remaining {length} characters is started, so that long
+  // strings can be serialized in a few large slices.
+  V8_INLINE int EscapedSliceLength(int length) {
+    int slice_length = (part_length_ - current_index_ - 1) >> 3;
+    if (slice_length < length && slice_length < kMinEscapedSliceLength) {
+      ExtendToFit(length);
+      slice_length = (part_length_ - 1) >> 3;
+    }
+    return std::min(length, slice_length);
+  }
+
   void AppendString(Handle<String> string);
 
   MaybeHandle<String> Finish();
@@ -196,6 +211,11 @@ class IncrementalStringBuilder {
     }
 
     V8_INLINE void Append(DestChar c) { *(cursor_++) = c; }
+    template <typename SrcChar>
+    V8_INLINE void AppendChars(const SrcChar* chars, int length) {
+      CopyChars(cursor_, chars, length);
+      cursor_ += length;
+    }
     V8_INLINE void AppendCString(const char* s) {
       const uint8_t* u = reinterpret_cast<const uint8_t*>(s);
       while (*u != '\0') Append(*(u++));
@@ -269,6 +289,10 @@ class IncrementalStringBuilder {
   // Finish the current part and allocate a new part.
   void Extend();
 
+  // Finish the current part early and allocate a new part which is large
+  // enough for {length} characters, up to the maximum part length.
+  void ExtendToFit(int length);
+
   // Shrink current part to the right size.
   void ShrinkCurrentPart() {
     DCHECK(current_index_ < part_length_);
@@ -279,6 +303,7 @@ class IncrementalStringBuilder {
   static const int kInitialPartLength = 32;
   static const int kMaxPartLength = 16 * 1024;
   static const int kPartLengthGrowthFactor = 2;
+  static const int kMinEscapedSliceLength = 64;
 
   Isolate* isolate_;
   String::Encoding encoding_;
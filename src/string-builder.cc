@@ -277,6 +277,18 @@ void IncrementalStringBuilder::Extend() {
   current_index_ = 0;
 }
 
+void IncrementalStringBuilder::ExtendToFit(int length) {
+  ShrinkCurrentPart();
+  // Grow the part length right away rather than one part at a time; Extend()
+  // applies the last growth step.
+  while (part_length_ * kPartLengthGrowthFactor < length &&
+         part_length_ <= kMaxPartLength / (kPartLengthGrowthFactor *
+                                           kPartLengthGrowthFactor)) {
+    part_length_ *= kPartLengthGrowthFactor;
+  }
+  Extend();
+}
+
 
 MaybeHandle<String> IncrementalStringBuilder::Finish() {
   ShrinkCurrentPart();
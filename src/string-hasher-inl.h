@@ -7,6 +7,7 @@
 
 #include "src/string-hasher.h"
 
+#include "src/base/bits.h"
 #include "src/char-predicates-inl.h"
 #include "src/objects.h"
 #include "src/objects/string-inl.h"
@@ -19,14 +20,20 @@ StringHasher::StringHasher(int length, uint64_t seed)
     : length_(length),
       raw_running_hash_(static_cast<uint32_t>(seed)),
       array_index_(0),
-      is_array_index_(IsInRange(length, 1, String::kMaxArrayIndexSize)) {
+      is_array_index_(IsInRange(length, 1, String::kMaxArrayIndexSize)),
+      wide_position_(0) {
   DCHECK(FLAG_randomize_hashes || raw_running_hash_ == 0);
+  if (uses_wide_hash()) InitializeWideHash(wide_lanes_, seed);
 }
 
 bool StringHasher::has_trivial_hash() {
   return length_ > String::kMaxHashCalcLength;
 }
 
+bool StringHasher::uses_wide_hash() const {
+  return length_ >= kWideHashMinLength;
+}
+
 uint32_t StringHasher::AddCharacterCore(uint32_t running_hash, uint16_t c) {
   running_hash += c;
   running_hash += (running_hash << 10);
@@ -55,6 +62,64 @@ uint32_t StringHasher::ComputeRunningHash(uint32_t running_hash,
   return running_hash;
 }
 
+uint32_t StringHasher::WideHashRound(uint32_t lane, uint16_t c) {
+  lane += c * 0x85EBCA77u;
+  lane = base::bits::RotateLeft32(lane, 13);
+  return lane * 0x9E3779B1u;
+}
+
+void StringHasher::InitializeWideHash(uint32_t* lanes, uint64_t seed) {
+  // Use all of the seed, the one-at-a-time hash only takes its low half.
+  const uint32_t seed_low = static_cast<uint32_t>(seed);
+  const uint32_t seed_high = static_cast<uint32_t>(seed >> 32);
+  for (int i = 0; i < kWideHashLanes; i++) {
+    lanes[i] = ((i & 1) ? seed_high : seed_low) + (i + 1) * 0xC2B2AE3Du;
+  }
+}
+
+template <typename Char>
+void StringHasher::AddWideCharacters(uint32_t* lanes, int position,
+                                     const Char* chars, int length) {
+  DCHECK_LE(0, length);
+  int i = 0;
+  for (; i < length && (position + i) % kWideHashLanes != 0; i++) {
+    int lane = (position + i) % kWideHashLanes;
+    lanes[lane] = WideHashRound(lanes[lane], chars[i]);
+  }
+  // Work on a copy, since one-byte {chars} could alias the lanes otherwise,
+  // which keeps the compiler from vectorizing the loop.
+  uint32_t block[kWideHashLanes];
+  for (int j = 0; j < kWideHashLanes; j++) block[j] = lanes[j];
+  for (; i + kWideHashLanes <= length; i += kWideHashLanes) {
+    for (int j = 0; j < kWideHashLanes; j++) {
+      block[j] = WideHashRound(block[j], chars[i + j]);
+    }
+  }
+  for (int j = 0; j < kWideHashLanes; j++) lanes[j] = block[j];
+  for (; i < length; i++) {
+    int lane = (position + i) % kWideHashLanes;
+    lanes[lane] = WideHashRound(lanes[lane], chars[i]);
+  }
+}
+
+uint32_t StringHasher::FinalizeWideHash(const uint32_t* lanes) {
+  uint32_t hash = 0;
+  for (int i = 0; i < kWideHashLanes; i++) {
+    hash = base::bits::RotateLeft32(hash ^ lanes[i], 17) * 0x27D4EB2Fu;
+  }
+  return hash ^ (hash >> 15);
+}
+
+template <typename Char>
+uint32_t StringHasher::ComputeWideHash(uint64_t seed, const Char* chars,
+                                       int length) {
+  DCHECK_LE(kWideHashMinLength, length);
+  uint32_t lanes[kWideHashLanes];
+  InitializeWideHash(lanes, seed);
+  AddWideCharacters(lanes, 0, chars, length);
+  return FinalizeWideHash(lanes);
+}
+
 void StringHasher::AddCharacter(uint16_t c) {
   // Use the Jenkins one-at-a-time hash function to update the hash
   // for the given character.
@@ -74,6 +139,12 @@ bool StringHasher::UpdateIndex(uint16_t c) {
 template <typename Char>
 inline void StringHasher::AddCharacters(const Char* chars, int length) {
   DCHECK(sizeof(Char) == 1 || sizeof(Char) == 2);
+  if (uses_wide_hash()) {
+    DCHECK(!is_array_index_);
+    AddWideCharacters(wide_lanes_, wide_position_, chars, length);
+    wide_position_ += length;
+    return;
+  }
   int i = 0;
   if (is_array_index_) {
     for (; i < length; i++) {
@@ -122,7 +193,9 @@ uint32_t StringHasher::HashSequentialString(const schar* chars, int length,
 
   // Non-array-index hash.
   uint32_t hash =
-      ComputeRunningHash(static_cast<uint32_t>(seed), chars, length);
+      length >= kWideHashMinLength
+          ? ComputeWideHash(seed, chars, length)
+          : ComputeRunningHash(static_cast<uint32_t>(seed), chars, length);
 
   uint32_t result =
       (GetHashCore(hash) << String::kHashShift) | String::kIsNotArrayIndexMask;
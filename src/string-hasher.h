@@ -38,12 +38,23 @@ class V8_EXPORT_PRIVATE StringHasher {
   // use 27 instead.
   static const int kZeroHash = 27;
 
+  // Strings of at least this many characters are hashed with the wide hash
+  // instead of the one-at-a-time hash. It keeps kWideHashLanes independent
+  // running hashes and feeds character i into lane i % kWideHashLanes, so
+  // whole blocks of characters can be mixed in parallel.
+  static const int kWideHashMinLength = 32;
+  static const int kWideHashLanes = 8;
+
   // Reusable parts of the hashing algorithm.
   V8_INLINE static uint32_t AddCharacterCore(uint32_t running_hash, uint16_t c);
   V8_INLINE static uint32_t GetHashCore(uint32_t running_hash);
   template <typename Char>
   V8_INLINE static uint32_t ComputeRunningHash(uint32_t running_hash,
                                                const Char* chars, int length);
+  // Returns the wide hash of a whole string, to be finished by GetHashCore.
+  template <typename Char>
+  V8_INLINE static uint32_t ComputeWideHash(uint64_t seed, const Char* chars,
+                                            int length);
 
  protected:
   // Returns the value to store in the hash field of a string with
@@ -59,6 +70,16 @@ class V8_EXPORT_PRIVATE StringHasher {
  private:
   // Add a character to the hash.
   inline void AddCharacter(uint16_t c);
+  inline bool uses_wide_hash() const;
+
+  V8_INLINE static uint32_t WideHashRound(uint32_t lane, uint16_t c);
+  V8_INLINE static void InitializeWideHash(uint32_t* lanes, uint64_t seed);
+  // Adds characters to the lanes, the first of which is at {position} in the
+  // string.
+  template <typename Char>
+  V8_INLINE static void AddWideCharacters(uint32_t* lanes, int position,
+                                          const Char* chars, int length);
+  V8_INLINE static uint32_t FinalizeWideHash(const uint32_t* lanes);
   // Update index. Returns true if string is still an index.
   inline bool UpdateIndex(uint16_t c);
 
@@ -66,6 +87,8 @@ class V8_EXPORT_PRIVATE StringHasher {
   uint32_t raw_running_hash_;
   uint32_t array_index_;
   bool is_array_index_;
+  int wide_position_;
+  uint32_t wide_lanes_[kWideHashLanes];
   DISALLOW_COPY_AND_ASSIGN(StringHasher);
 };
 
@@ -5,9 +5,19 @@
 #ifndef V8_STRING_SEARCH_H_
 #define V8_STRING_SEARCH_H_
 
+#include "src/base/bits.h"
+#include "src/base/build_config.h"
 #include "src/isolate.h"
 #include "src/vector.h"
 
+#if V8_HOST_ARCH_X64 || V8_HOST_ARCH_IA32
+#include <emmintrin.h>
+#define V8_STRING_SEARCH_SIMD_SSE2 1
+#elif V8_HOST_ARCH_ARM64
+#include <arm_neon.h>
+#define V8_STRING_SEARCH_SIMD_NEON 1
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -230,6 +240,128 @@ inline int FindFirstCharacter(Vector<const PatternChar> pattern,
 }
 
 
+template <typename PatternChar, typename SubjectChar>
+inline bool CharCompare(const PatternChar* pattern,
+                        const SubjectChar* subject,
+                        int length) {
+  DCHECK_GT(length, 0);
+  int pos = 0;
+  do {
+    if (pattern[pos] != subject[pos]) {
+      return false;
+    }
+    pos++;
+  } while (pos < length);
+  return true;
+}
+
+#if V8_STRING_SEARCH_SIMD_SSE2 || V8_STRING_SEARCH_SIMD_NEON
+#define V8_STRING_SEARCH_SIMD 1
+
+// Masks of the lanes of a 16-byte block which hold a candidate match, with
+// kSimdMaskBitsPerByte bits set for every byte of a matching lane.
+#if V8_STRING_SEARCH_SIMD_SSE2
+typedef uint32_t SimdMask;
+const int kSimdMaskBitsPerByte = 1;
+
+inline SimdMask FirstAndLastCharacterMask(const uint8_t* first,
+                                          const uint8_t* last,
+                                          uint8_t first_char,
+                                          uint8_t last_char) {
+  __m128i first_eq =
+      _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)),
+                     _mm_set1_epi8(static_cast<char>(first_char)));
+  __m128i last_eq =
+      _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(last)),
+                     _mm_set1_epi8(static_cast<char>(last_char)));
+  return static_cast<SimdMask>(
+      _mm_movemask_epi8(_mm_and_si128(first_eq, last_eq)));
+}
+
+inline SimdMask FirstAndLastCharacterMask(const uc16* first, const uc16* last,
+                                          uc16 first_char, uc16 last_char) {
+  __m128i first_eq =
+      _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)),
+                      _mm_set1_epi16(static_cast<int16_t>(first_char)));
+  __m128i last_eq =
+      _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(last)),
+                      _mm_set1_epi16(static_cast<int16_t>(last_char)));
+  return static_cast<SimdMask>(
+      _mm_movemask_epi8(_mm_and_si128(first_eq, last_eq)));
+}
+#elif V8_STRING_SEARCH_SIMD_NEON
+typedef uint64_t SimdMask;
+const int kSimdMaskBitsPerByte = 4;
+
+// Narrows every byte of the comparison result to a nibble.
+inline SimdMask NarrowToMask(uint8x16_t eq) {
+  return vget_lane_u64(
+      vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+}
+
+inline SimdMask FirstAndLastCharacterMask(const uint8_t* first,
+                                          const uint8_t* last,
+                                          uint8_t first_char,
+                                          uint8_t last_char) {
+  uint8x16_t first_eq = vceqq_u8(vld1q_u8(first), vdupq_n_u8(first_char));
+  uint8x16_t last_eq = vceqq_u8(vld1q_u8(last), vdupq_n_u8(last_char));
+  return NarrowToMask(vandq_u8(first_eq, last_eq));
+}
+
+inline SimdMask FirstAndLastCharacterMask(const uc16* first, const uc16* last,
+                                          uc16 first_char, uc16 last_char) {
+  uint16x8_t first_eq = vceqq_u16(vld1q_u16(first), vdupq_n_u16(first_char));
+  uint16x8_t last_eq = vceqq_u16(vld1q_u16(last), vdupq_n_u16(last_char));
+  return NarrowToMask(vreinterpretq_u8_u16(vandq_u16(first_eq, last_eq)));
+}
+#endif
+
+// Finds the pattern by comparing its first and last character at 16 bytes
+// worth of positions at once, and the remaining characters only at the
+// positions where both match. This filters out most candidates of short
+// patterns, for which Boyer-Moore doesn't pay off.
+template <typename PatternChar, typename SubjectChar>
+inline int FindFirstAndLastCharacter(Vector<const PatternChar> pattern,
+                                     Vector<const SubjectChar> subject,
+                                     int index) {
+  const int pattern_length = pattern.length();
+  // Callers make sure that the pattern fits into SubjectChar.
+  const SubjectChar first_char = static_cast<SubjectChar>(pattern[0]);
+  const SubjectChar last_char =
+      static_cast<SubjectChar>(pattern[pattern_length - 1]);
+  const int max_n = subject.length() - pattern_length + 1;
+  const int kLanes = 16 / sizeof(SubjectChar);
+  const int kBitsPerLane = kSimdMaskBitsPerByte * sizeof(SubjectChar);
+  const SimdMask kLaneMask = (SimdMask{1} << kBitsPerLane) - 1;
+
+  int i = index;
+  for (; i + kLanes <= max_n; i += kLanes) {
+    const SubjectChar* block = subject.start() + i;
+    SimdMask mask = FirstAndLastCharacterMask(
+        block, block + pattern_length - 1, first_char, last_char);
+    while (mask != 0) {
+      int lane = base::bits::CountTrailingZeros(mask) / kBitsPerLane;
+      if (pattern_length <= 2 ||
+          CharCompare(pattern.start() + 1, block + lane + 1,
+                      pattern_length - 2)) {
+        return i + lane;
+      }
+      mask &= ~(kLaneMask << (lane * kBitsPerLane));
+    }
+  }
+  for (; i < max_n; i++) {
+    if (subject[i] == first_char &&
+        subject[i + pattern_length - 1] == last_char &&
+        (pattern_length <= 2 || CharCompare(pattern.start() + 1,
+                                            subject.start() + i + 1,
+                                            pattern_length - 2))) {
+      return i;
+    }
+  }
+  return -1;
+}
+#endif  // V8_STRING_SEARCH_SIMD_SSE2 || V8_STRING_SEARCH_SIMD_NEON
+
 //---------------------------------------------------------------------
 // Single Character Pattern Search Strategy
 //---------------------------------------------------------------------
@@ -246,6 +378,13 @@ int StringSearch<PatternChar, SubjectChar>::SingleCharSearch(
       return -1;
     }
   }
+#if V8_STRING_SEARCH_SIMD
+  // memchr only helps for one-byte subjects, since it can't skip over the
+  // high bytes of two-byte subjects.
+  if (sizeof(SubjectChar) == 2) {
+    return FindFirstAndLastCharacter(search->pattern_, subject, index);
+  }
+#endif
   return FindFirstCharacter(search->pattern_, subject, index);
 }
 
@@ -254,22 +393,6 @@ int StringSearch<PatternChar, SubjectChar>::SingleCharSearch(
 //---------------------------------------------------------------------
 
 
-template <typename PatternChar, typename SubjectChar>
-inline bool CharCompare(const PatternChar* pattern,
-                        const SubjectChar* subject,
-                        int length) {
-  DCHECK_GT(length, 0);
-  int pos = 0;
-  do {
-    if (pattern[pos] != subject[pos]) {
-      return false;
-    }
-    pos++;
-  } while (pos < length);
-  return true;
-}
-
-
 // Simple linear search for short patterns. Never bails out.
 template <typename PatternChar, typename SubjectChar>
 int StringSearch<PatternChar, SubjectChar>::LinearSearch(
@@ -278,6 +401,9 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
     int index) {
   Vector<const PatternChar> pattern = search->pattern_;
   DCHECK_GT(pattern.length(), 1);
+#if V8_STRING_SEARCH_SIMD
+  return FindFirstAndLastCharacter(pattern, subject, index);
+#else
   int pattern_length = pattern.length();
   int i = index;
   int n = subject.length() - pattern_length;
@@ -295,6 +421,7 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
     }
   }
   return -1;
+#endif
 }
 
 //---------------------------------------------------------------------
@@ -579,4 +706,8 @@ intptr_t SearchStringRaw(Isolate* isolate, const SubjectChar* subject_ptr,
 }  // namespace internal
 }  // namespace v8
 
+#undef V8_STRING_SEARCH_SIMD
+#undef V8_STRING_SEARCH_SIMD_SSE2
+#undef V8_STRING_SEARCH_SIMD_NEON
+
 #endif  // V8_STRING_SEARCH_H_
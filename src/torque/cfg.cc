@@ -160,6 +160,52 @@ void CfgAssembler::DebugBreak() {
   Emit(AbortInstruction{AbortInstruction::Kind::kDebugBreak});
 }
 
+void CfgAssembler::OptimizeCfg() {
+  // The start block is entered from outside the graph, and the end block is
+  // always emitted, so both are treated as reachable.
+  std::unordered_map<Block*, size_t> predecessor_count;
+  predecessor_count[cfg_.start()] = 1;
+  std::vector<Block*> worklist = {cfg_.start()};
+  std::vector<Block*> successors;
+  while (!worklist.empty()) {
+    Block* block = worklist.back();
+    worklist.pop_back();
+    successors.clear();
+    for (const Instruction& instruction : block->instructions()) {
+      instruction->AppendSuccessorBlocks(&successors);
+    }
+    for (Block* successor : successors) {
+      if (predecessor_count[successor]++ == 0) worklist.push_back(successor);
+    }
+  }
+  if (base::Optional<Block*> end = cfg_.end()) {
+    predecessor_count[*end] = std::max<size_t>(predecessor_count[*end], 1);
+  }
+
+  for (Block* block : cfg_.blocks()) {
+    if (predecessor_count[block] == 0) continue;
+    while (!block->instructions().empty()) {
+      const Instruction& last = block->instructions().back();
+      if (!last.Is<GotoInstruction>()) break;
+      Block* destination = last.Cast<GotoInstruction>().destination;
+      if (destination == block || destination == cfg_.end()) break;
+      if (predecessor_count[destination] != 1) break;
+      // Keep deferred code out of the hot path.
+      if (destination->IsDeferred() && !block->IsDeferred()) break;
+      std::vector<Instruction>& instructions = block->instructions();
+      instructions.pop_back();
+      instructions.insert(instructions.end(),
+                          destination->instructions().begin(),
+                          destination->instructions().end());
+      // The destination is now unreachable and removed below.
+      predecessor_count[destination] = 0;
+    }
+  }
+
+  cfg_.UnplaceBlockIf(
+      [&](Block* block) { return predecessor_count[block] == 0; });
+}
+
 }  // namespace torque
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,7 @@
 #ifndef V8_TORQUE_CFG_H_
 #define V8_TORQUE_CFG_H_
 
+#include <algorithm>
 #include <list>
 #include <memory>
 #include <unordered_map>
@@ -46,6 +47,7 @@ class Block {
   }
 
   const std::vector<Instruction>& instructions() const { return instructions_; }
+  std::vector<Instruction>& instructions() { return instructions_; }
   bool IsComplete() const {
     return !instructions_.empty() && instructions_.back()->IsBlockTerminator();
   }
@@ -74,6 +76,12 @@ class ControlFlowGraph {
     return &blocks_.back();
   }
   void PlaceBlock(Block* block) { placed_blocks_.push_back(block); }
+  template <class UnaryPredicate>
+  void UnplaceBlockIf(UnaryPredicate&& predicate) {
+    auto new_end = std::remove_if(placed_blocks_.begin(), placed_blocks_.end(),
+                                  std::forward<UnaryPredicate>(predicate));
+    placed_blocks_.erase(new_end, placed_blocks_.end());
+  }
   Block* start() const { return start_; }
   base::Optional<Block*> end() const { return end_; }
   void set_end(Block* end) { end_ = end; }
@@ -106,9 +114,15 @@ class CfgAssembler {
     if (!CurrentBlockIsComplete()) {
       cfg_.set_end(current_block_);
     }
+    OptimizeCfg();
     return cfg_;
   }
 
+  // Removes blocks that are unreachable from the start block, and merges
+  // blocks ending in a goto into their destination if they are its only
+  // predecessor. This leaves fewer labels and phis in the generated CSA code.
+  void OptimizeCfg();
+
   Block* NewBlock(
       base::Optional<Stack<const Type*>> input_types = base::nullopt,
       bool is_deferred = false) {
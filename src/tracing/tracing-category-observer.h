@@ -16,6 +16,8 @@ class TracingCategoryObserver : public TracingController::TraceStateObserver {
     ENABLED_BY_NATIVE = 1 << 0,
     ENABLED_BY_TRACING = 1 << 1,
     ENABLED_BY_SAMPLING = 1 << 2,
+    // Only track the innermost active counter, without any timing.
+    ENABLED_BY_COUNTER_SAMPLING = 1 << 3,
   };
 
   static void SetUp();
@@ -7,6 +7,7 @@
 #include "src/unicode-decoder.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <limits>
 
 namespace unibrow {
 
@@ -53,11 +54,16 @@ bool Utf8Iterator::Done() {
 void Utf8DecoderBase::Reset(uint16_t* buffer, size_t buffer_length,
                             const v8::internal::Vector<const char>& stream) {
   size_t utf16_length = 0;
+  // The bitwise or of all code units, to find out whether they all fit into
+  // one byte.
+  uint16_t all_chars = 0;
 
   Utf8Iterator it = Utf8Iterator(stream);
   // Loop until stream is read, writing to buffer as long as buffer has space.
   while (utf16_length < buffer_length && !it.Done()) {
-    *buffer++ = *it;
+    uint16_t c = *it;
+    *buffer++ = c;
+    all_chars |= c;
     ++it;
     utf16_length++;
   }
@@ -67,22 +73,34 @@ void Utf8DecoderBase::Reset(uint16_t* buffer, size_t buffer_length,
 
   // Now that writing to buffer is done, we just need to calculate utf16_length
   while (!it.Done()) {
+    all_chars |= *it;
     ++it;
     utf16_length++;
   }
   utf16_length_ = utf16_length;
+  is_one_byte_ = all_chars <= Latin1::kMaxChar;
 }
 
-void Utf8DecoderBase::WriteUtf16Slow(
-    uint16_t* data, size_t length,
-    const v8::internal::Vector<const char>& stream, size_t offset,
-    bool trailing) {
+template <typename Char>
+void Utf8DecoderBase::WriteSlow(Char* data, size_t length,
+                                const v8::internal::Vector<const char>& stream,
+                                size_t offset, bool trailing) {
   Utf8Iterator it = Utf8Iterator(stream, offset, trailing);
   while (!it.Done()) {
     DCHECK_GT(length--, 0);
-    *data++ = *it;
+    DCHECK_LE(*it, std::numeric_limits<Char>::max());
+    *data++ = static_cast<Char>(*it);
     ++it;
   }
 }
 
+template void Utf8DecoderBase::WriteSlow(
+    uint8_t* data, size_t length,
+    const v8::internal::Vector<const char>& stream, size_t offset,
+    bool trailing);
+template void Utf8DecoderBase::WriteSlow(
+    uint16_t* data, size_t length,
+    const v8::internal::Vector<const char>& stream, size_t offset,
+    bool trailing);
+
 }  // namespace unibrow
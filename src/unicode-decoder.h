@@ -59,20 +59,25 @@ class V8_EXPORT_PRIVATE Utf8DecoderBase {
   inline Utf8DecoderBase(uint16_t* buffer, size_t buffer_length,
                          const v8::internal::Vector<const char>& stream);
   inline size_t Utf16Length() const { return utf16_length_; }
+  // Whether all decoded code units fit into one byte, i.e. the stream can be
+  // decoded with WriteOneByte().
+  inline bool IsOneByte() const { return is_one_byte_; }
 
  protected:
   // This reads all characters and sets the utf16_length_.
   // The first buffer_length utf16 chars are cached in the buffer.
   void Reset(uint16_t* buffer, size_t buffer_length,
              const v8::internal::Vector<const char>& vector);
-  static void WriteUtf16Slow(uint16_t* data, size_t length,
-                             const v8::internal::Vector<const char>& stream,
-                             size_t offset, bool trailing);
+  template <typename Char>
+  static void WriteSlow(Char* data, size_t length,
+                        const v8::internal::Vector<const char>& stream,
+                        size_t offset, bool trailing);
 
   size_t bytes_read_;
   size_t chars_written_;
   size_t utf16_length_;
   bool trailing_;
+  bool is_one_byte_;
 
  private:
   DISALLOW_COPY_AND_ASSIGN(Utf8DecoderBase);
@@ -87,13 +92,21 @@ class Utf8Decoder : public Utf8DecoderBase {
   inline size_t WriteUtf16(
       uint16_t* data, size_t length,
       const v8::internal::Vector<const char>& stream) const;
+  // Like WriteUtf16, but may only be used if IsOneByte().
+  inline size_t WriteOneByte(
+      uint8_t* data, size_t length,
+      const v8::internal::Vector<const char>& stream) const;
 
  private:
   uint16_t buffer_[kBufferSize];
 };
 
 Utf8DecoderBase::Utf8DecoderBase()
-    : bytes_read_(0), chars_written_(0), utf16_length_(0), trailing_(false) {}
+    : bytes_read_(0),
+      chars_written_(0),
+      utf16_length_(0),
+      trailing_(false),
+      is_one_byte_(true) {}
 
 Utf8DecoderBase::Utf8DecoderBase(
     uint16_t* buffer, size_t buffer_length,
@@ -126,8 +139,28 @@ size_t Utf8Decoder<kBufferSize>::WriteUtf16(
   if (data_length <= chars_written_) return data_length;
 
   // Copy the rest the slow way.
-  WriteUtf16Slow(data + chars_written_, data_length - chars_written_, stream,
-                 bytes_read_, trailing_);
+  WriteSlow(data + chars_written_, data_length - chars_written_, stream,
+            bytes_read_, trailing_);
+  return data_length;
+}
+
+template <size_t kBufferSize>
+size_t Utf8Decoder<kBufferSize>::WriteOneByte(
+    uint8_t* data, size_t data_length,
+    const v8::internal::Vector<const char>& stream) const {
+  DCHECK_GT(data_length, 0);
+  DCHECK(is_one_byte_);
+  data_length = std::min(data_length, utf16_length_);
+
+  // Narrow everything in buffer.
+  size_t copy_length = std::min(data_length, chars_written_);
+  v8::internal::CopyChars(data, buffer_, copy_length);
+
+  if (data_length <= chars_written_) return data_length;
+
+  // Copy the rest the slow way.
+  WriteSlow(data + chars_written_, data_length - chars_written_, stream,
+            bytes_read_, trailing_);
   return data_length;
 }
 
@@ -59,11 +59,22 @@ bool AddressIsInStack(const void* address, const void* stack_base,
 bool Unwinder::TryUnwindV8Frames(const UnwindState& unwind_state,
                                  RegisterState* register_state,
                                  const void* stack_base) {
+  return TryUnwindV8Frames(unwind_state, register_state, stack_base, nullptr,
+                           0, nullptr);
+}
+
+bool Unwinder::TryUnwindV8Frames(const UnwindState& unwind_state,
+                                 RegisterState* register_state,
+                                 const void* stack_base, void** frame_pcs,
+                                 size_t max_frames, size_t* frame_count) {
   const void* stack_top = register_state->sp;
+  size_t count = 0;
+  if (frame_count != nullptr) *frame_count = 0;
 
   void* pc = register_state->pc;
   if (PCIsInV8(unwind_state, pc) &&
       !IsInUnsafeJSEntryRange(unwind_state.js_entry_stub, pc)) {
+    if (count < max_frames) frame_pcs[count++] = pc;
     void* current_fp = register_state->fp;
     if (!AddressIsInStack(current_fp, stack_base, stack_top)) return false;
 
@@ -71,6 +82,7 @@ bool Unwinder::TryUnwindV8Frames(const UnwindState& unwind_state,
     // assume the caller frame is a JS frame and continue to unwind.
     void* next_pc = GetReturnAddressFromFP(current_fp);
     while (PCIsInV8(unwind_state, next_pc)) {
+      if (count < max_frames) frame_pcs[count++] = next_pc;
       current_fp = GetCallerFPFromFP(current_fp);
       if (!AddressIsInStack(current_fp, stack_base, stack_top)) return false;
       next_pc = GetReturnAddressFromFP(current_fp);
@@ -78,13 +90,13 @@ bool Unwinder::TryUnwindV8Frames(const UnwindState& unwind_state,
 
     void* final_sp = GetCallerSPFromFP(current_fp);
     if (!AddressIsInStack(final_sp, stack_base, stack_top)) return false;
-    register_state->sp = final_sp;
-
     void* final_fp = GetCallerFPFromFP(current_fp);
     if (!AddressIsInStack(final_fp, stack_base, stack_top)) return false;
-    register_state->fp = final_fp;
 
+    register_state->sp = final_sp;
+    register_state->fp = final_fp;
     register_state->pc = next_pc;
+    if (frame_count != nullptr) *frame_count = count;
     return true;
   }
   return false;
@@ -15,6 +15,7 @@
 #include "src/deoptimizer.h"
 #include "src/elements.h"
 #include "src/frames.h"
+#include "src/heap/page-pool.h"
 #include "src/interface-descriptors.h"
 #include "src/isolate.h"
 #include "src/libsampler/sampler.h"
@@ -56,6 +57,7 @@ void V8::TearDown() {
   ElementsAccessor::TearDown();
   RegisteredExtension::UnregisterAll();
   sampler::Sampler::TearDown();
+  PagePool::Get()->ReleaseAll();
   FlagList::ResetAllFlags();  // Frees memory held by string arguments.
 }
 
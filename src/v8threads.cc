@@ -130,8 +130,7 @@ bool ThreadManager::RestoreThread() {
   Isolate::PerIsolateThreadData* per_thread =
       isolate_->FindPerThreadDataForThisThread();
   if (per_thread == nullptr || per_thread->thread_state() == nullptr) {
-    // This is a new thread.
-    InitThread(access);
+    // This is a new thread. The caller sets up its thread-local state.
     return false;
   }
   ThreadState* state = per_thread->thread_state();
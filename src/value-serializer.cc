@@ -37,6 +37,7 @@ namespace internal {
 // Version 12: regexp and string objects share normal string encoding
 // Version 13: host objects have an explicit tag (rather than handling all
 //             unknown tags)
+// Version 14: fast-mode objects write their keys once per shape
 //
 // WARNING: Increasing this value is a change which cannot safely be rolled
 // back without breaking compatibility with data stored on disk. It is
@@ -45,7 +46,7 @@ namespace internal {
 //
 // Recent changes are routinely reverted in preparation for branch, and this
 // has been the cause of at least one bug in the past.
-static const uint32_t kLatestVersion = 13;
+static const uint32_t kLatestVersion = 14;
 static_assert(kLatestVersion == v8::CurrentValueSerializerFormatVersion(),
               "Exported format version must match latest version.");
 
@@ -94,12 +95,19 @@ enum class SerializationTag : uint8_t {
   kUtf8String = 'S',
   kOneByteString = '"',
   kTwoByteString = 'c',
+  // External string passed by reference. cloneID:uint32_t
+  kExternalString = 'e',
   // Reference to a serialized object. objectID:uint32_t
   kObjectReference = '^',
   // Beginning of a JS object.
   kBeginJSObject = 'o',
   // End of a JS object. numProperties:uint32_t
   kEndJSObject = '{',
+  // A JS object with the keys given by a shape. shapeID:uint32_t. If this is
+  // the first use of the shape, numKeys:uint32_t and that many keys (as
+  // strings) follow. Then there is one value per key, or kTheHole if the
+  // property was removed during serialization.
+  kShapedJSObject = 'k',
   // Beginning of a sparse JS array. length:uint32_t
   // Elements and properties are written as key/value pairs, like objects.
   kBeginSparseJSArray = 'a',
@@ -136,6 +144,8 @@ enum class SerializationTag : uint8_t {
   kArrayBuffer = 'B',
   // Array buffer (transferred). transferID:uint32_t
   kArrayBufferTransfer = 't',
+  // Array buffer whose contents were passed by reference. cloneID:uint32_t
+  kArrayBufferContents = 'b',
   // View into an array buffer.
   // subtag:ArrayBufferViewTag, byteOffset:uint32_t, byteLength:uint32_t
   // For typed arrays, byteOffset and byteLength must be divisible by the size
@@ -190,6 +200,7 @@ ValueSerializer::ValueSerializer(Isolate* isolate,
       delegate_(delegate),
       zone_(isolate->allocator(), ZONE_NAME),
       id_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)),
+      shape_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)),
       array_buffer_transfer_map_(isolate->heap(),
                                  ZoneAllocationPolicy(&zone_)) {}
 
@@ -382,7 +393,11 @@ Maybe<bool> ValueSerializer::WriteObject(Handle<Object> object) {
     }
     default:
       if (object->IsString()) {
-        WriteString(Handle<String>::cast(object));
+        Handle<String> string = Handle<String>::cast(object);
+        if (delegate_ != nullptr && string->IsExternalString()) {
+          return WriteExternalString(string);
+        }
+        WriteString(string);
         return ThrowIfOutOfMemory();
       } else if (object->IsJSReceiver()) {
         return WriteJSReceiver(Handle<JSReceiver>::cast(object));
@@ -458,6 +473,21 @@ void ValueSerializer::WriteString(Handle<String> string) {
   }
 }
 
+Maybe<bool> ValueSerializer::WriteExternalString(Handle<String> string) {
+  DCHECK_NOT_NULL(delegate_);
+  Maybe<uint32_t> clone_id = delegate_->GetExternalStringId(
+      reinterpret_cast<v8::Isolate*>(isolate_), Utils::ToLocal(string));
+  RETURN_VALUE_IF_SCHEDULED_EXCEPTION(isolate_, Nothing<bool>());
+  uint32_t id = 0;
+  if (clone_id.To(&id)) {
+    WriteTag(SerializationTag::kExternalString);
+    WriteVarint<uint32_t>(id);
+  } else {
+    WriteString(string);
+  }
+  return ThrowIfOutOfMemory();
+}
+
 Maybe<bool> ValueSerializer::WriteJSReceiver(Handle<JSReceiver> receiver) {
   // If the object has already been serialized, just write its ID.
   uint32_t* id_map_entry = id_map_.Get(receiver);
@@ -544,11 +574,34 @@ Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
   if (!can_serialize_fast) return WriteJSObjectSlow(object);
 
   Handle<Map> map(object->map(), isolate_);
-  WriteTag(SerializationTag::kBeginJSObject);
+  WriteTag(SerializationTag::kShapedJSObject);
+
+  // Objects with the same map share the same keys, so these are written only
+  // the first time the map is seen. As in id_map_, ID+1 is stored.
+  uint32_t* shape_map_entry = shape_map_.Get(map);
+  if (uint32_t shape_id = *shape_map_entry) {
+    WriteVarint(shape_id - 1);
+  } else {
+    shape_id = next_shape_id_++;
+    *shape_map_entry = shape_id + 1;
+    WriteVarint(shape_id);
+    uint32_t num_keys = 0;
+    for (int i = 0; i < map->NumberOfOwnDescriptors(); i++) {
+      Name key = map->instance_descriptors()->GetKey(i);
+      PropertyDetails details = map->instance_descriptors()->GetDetails(i);
+      if (key->IsString() && !details.IsDontEnum()) num_keys++;
+    }
+    WriteVarint(num_keys);
+    for (int i = 0; i < map->NumberOfOwnDescriptors(); i++) {
+      Handle<Name> key(map->instance_descriptors()->GetKey(i), isolate_);
+      PropertyDetails details = map->instance_descriptors()->GetDetails(i);
+      if (!key->IsString() || details.IsDontEnum()) continue;
+      WriteString(Handle<String>::cast(key));
+    }
+  }
 
   // Write out fast properties as long as they are only data properties and the
   // map doesn't change.
-  uint32_t properties_written = 0;
   bool map_changed = false;
   for (int i = 0; i < map->NumberOfOwnDescriptors(); i++) {
     Handle<Name> key(map->instance_descriptors()->GetKey(i), isolate_);
@@ -557,7 +610,7 @@ Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
     if (details.IsDontEnum()) continue;
 
     Handle<Object> value;
-    if (V8_LIKELY(!map_changed)) map_changed = *map == object->map();
+    if (V8_LIKELY(!map_changed)) map_changed = *map != object->map();
     if (V8_LIKELY(!map_changed && details.location() == kField)) {
       DCHECK_EQ(kData, details.kind());
       FieldIndex field_index = FieldIndex::ForDescriptor(*map, i);
@@ -568,19 +621,16 @@ Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
       // If the property is no longer found, do not serialize it.
       // This could happen if a getter deleted the property.
       LookupIterator it(isolate_, object, key, LookupIterator::OWN);
-      if (!it.IsFound()) continue;
+      if (!it.IsFound()) {
+        WriteTag(SerializationTag::kTheHole);
+        continue;
+      }
       if (!Object::GetProperty(&it).ToHandle(&value)) return Nothing<bool>();
     }
 
-    if (!WriteObject(key).FromMaybe(false) ||
-        !WriteObject(value).FromMaybe(false)) {
-      return Nothing<bool>();
-    }
-    properties_written++;
+    if (!WriteObject(value).FromMaybe(false)) return Nothing<bool>();
   }
 
-  WriteTag(SerializationTag::kEndJSObject);
-  WriteVarint<uint32_t>(properties_written);
   return ThrowIfOutOfMemory();
 }
 
@@ -838,6 +888,18 @@ Maybe<bool> ValueSerializer::WriteJSArrayBuffer(
     ThrowDataCloneError(MessageTemplate::kDataCloneError, array_buffer);
     return Nothing<bool>();
   }
+  if (delegate_ != nullptr) {
+    Maybe<uint32_t> clone_id = delegate_->GetArrayBufferContentsId(
+        reinterpret_cast<v8::Isolate*>(isolate_),
+        Utils::ToLocal(array_buffer));
+    RETURN_VALUE_IF_SCHEDULED_EXCEPTION(isolate_, Nothing<bool>());
+    uint32_t id = 0;
+    if (clone_id.To(&id)) {
+      WriteTag(SerializationTag::kArrayBufferContents);
+      WriteVarint<uint32_t>(id);
+      return ThrowIfOutOfMemory();
+    }
+  }
   WriteTag(SerializationTag::kArrayBuffer);
   WriteVarint<uint32_t>(byte_length);
   WriteRawBytes(array_buffer->backing_store(), byte_length);
@@ -1001,10 +1063,13 @@ ValueDeserializer::ValueDeserializer(Isolate* isolate,
       end_(data.start() + data.length()),
       pretenure_(data.length() > kPretenureThreshold ? TENURED : NOT_TENURED),
       id_map_(isolate->global_handles()->Create(
+          ReadOnlyRoots(isolate_).empty_fixed_array())),
+      shape_map_(isolate->global_handles()->Create(
           ReadOnlyRoots(isolate_).empty_fixed_array())) {}
 
 ValueDeserializer::~ValueDeserializer() {
   GlobalHandles::Destroy(id_map_.location());
+  GlobalHandles::Destroy(shape_map_.location());
 
   Handle<Object> transfer_map_handle;
   if (array_buffer_transfer_map_.ToHandle(&transfer_map_handle)) {
@@ -1207,6 +1272,8 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
       return ReadOneByteString();
     case SerializationTag::kTwoByteString:
       return ReadTwoByteString();
+    case SerializationTag::kExternalString:
+      return ReadExternalString();
     case SerializationTag::kObjectReference: {
       uint32_t id;
       if (!ReadVarint<uint32_t>().To(&id)) return MaybeHandle<Object>();
@@ -1214,6 +1281,8 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
     }
     case SerializationTag::kBeginJSObject:
       return ReadJSObject();
+    case SerializationTag::kShapedJSObject:
+      return ReadShapedJSObject();
     case SerializationTag::kBeginSparseJSArray:
       return ReadSparseJSArray();
     case SerializationTag::kBeginDenseJSArray:
@@ -1239,6 +1308,8 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
     case SerializationTag::kArrayBufferTransfer: {
       return ReadTransferredJSArrayBuffer();
     }
+    case SerializationTag::kArrayBufferContents:
+      return ReadJSArrayBufferFromContentsId();
     case SerializationTag::kSharedArrayBuffer: {
       const bool is_shared = true;
       return ReadJSArrayBuffer(is_shared);
@@ -1271,6 +1342,20 @@ MaybeHandle<String> ValueDeserializer::ReadString() {
   return Handle<String>::cast(object);
 }
 
+MaybeHandle<String> ValueDeserializer::ReadExternalString() {
+  uint32_t clone_id;
+  v8::Local<v8::String> string;
+  if (!ReadVarint<uint32_t>().To(&clone_id) || delegate_ == nullptr ||
+      !delegate_
+           ->GetExternalStringFromId(reinterpret_cast<v8::Isolate*>(isolate_),
+                                     clone_id)
+           .ToLocal(&string)) {
+    RETURN_EXCEPTION_IF_SCHEDULED_EXCEPTION(isolate_, String);
+    return MaybeHandle<String>();
+  }
+  return Utils::OpenHandle(*string);
+}
+
 MaybeHandle<BigInt> ValueDeserializer::ReadBigInt() {
   uint32_t bitfield;
   if (!ReadVarint<uint32_t>().To(&bitfield)) return MaybeHandle<BigInt>();
@@ -1404,6 +1489,69 @@ MaybeHandle<JSObject> ValueDeserializer::ReadJSObject() {
   return scope.CloseAndEscape(object);
 }
 
+MaybeHandle<JSObject> ValueDeserializer::ReadShapedJSObject() {
+  // If we are at the end of the stack, abort. This function may recurse.
+  STACK_CHECK(isolate_, MaybeHandle<JSObject>());
+
+  uint32_t shape_id;
+  if (!ReadVarint<uint32_t>().To(&shape_id)) return MaybeHandle<JSObject>();
+  HandleScope scope(isolate_);
+  Handle<FixedArray> keys;
+  if (shape_id == next_shape_id_) {
+    if (!ReadShape().ToHandle(&keys)) return MaybeHandle<JSObject>();
+  } else if (shape_id < next_shape_id_) {
+    keys = handle(FixedArray::cast(shape_map_->get(shape_id)), isolate_);
+  } else {
+    return MaybeHandle<JSObject>();
+  }
+
+  // Allocate the object with room for all properties in-object, the maps
+  // from the object literal map cache have the same layout that literals
+  // with as many properties get.
+  uint32_t id = next_id_++;
+  Handle<JSObject> object;
+  Handle<Map> map = isolate_->factory()->ObjectLiteralMapFromCache(
+      isolate_->native_context(), keys->length());
+  if (map->is_dictionary_map()) {
+    object = isolate_->factory()->NewJSObject(isolate_->object_function(),
+                                              pretenure_);
+  } else {
+    object = isolate_->factory()->NewJSObjectFromMap(map, pretenure_);
+  }
+  AddObjectWithID(id, object);
+
+  if (ReadJSObjectPropertiesWithShape(object, keys).IsNothing()) {
+    return MaybeHandle<JSObject>();
+  }
+
+  DCHECK(HasObjectWithID(id));
+  return scope.CloseAndEscape(object);
+}
+
+MaybeHandle<FixedArray> ValueDeserializer::ReadShape() {
+  // Every key takes at least two bytes.
+  uint32_t num_keys;
+  if (!ReadVarint<uint32_t>().To(&num_keys) ||
+      num_keys > static_cast<size_t>(end_ - position_) / 2 ||
+      num_keys > static_cast<uint32_t>(FixedArray::kMaxLength)) {
+    return MaybeHandle<FixedArray>();
+  }
+  Handle<FixedArray> keys = isolate_->factory()->NewFixedArray(num_keys);
+  for (uint32_t i = 0; i < num_keys; i++) {
+    Handle<String> key;
+    if (!ReadString().ToHandle(&key)) return MaybeHandle<FixedArray>();
+    keys->set(i, *isolate_->factory()->InternalizeString(key));
+  }
+
+  Handle<FixedArray> new_array =
+      FixedArray::SetAndGrow(isolate_, shape_map_, next_shape_id_++, keys);
+  if (!new_array.is_identical_to(shape_map_)) {
+    GlobalHandles::Destroy(shape_map_.location());
+    shape_map_ = isolate_->global_handles()->Create(*new_array);
+  }
+  return keys;
+}
+
 MaybeHandle<JSArray> ValueDeserializer::ReadSparseJSArray() {
   // If we are at the end of the stack, abort. This function may recurse.
   STACK_CHECK(isolate_, MaybeHandle<JSArray>());
@@ -1710,6 +1858,24 @@ MaybeHandle<JSArrayBuffer> ValueDeserializer::ReadTransferredJSArrayBuffer() {
   return array_buffer;
 }
 
+MaybeHandle<JSArrayBuffer>
+ValueDeserializer::ReadJSArrayBufferFromContentsId() {
+  uint32_t id = next_id_++;
+  uint32_t clone_id;
+  Local<ArrayBuffer> array_buffer_value;
+  if (!ReadVarint<uint32_t>().To(&clone_id) || delegate_ == nullptr ||
+      !delegate_
+           ->GetArrayBufferFromContentsId(
+               reinterpret_cast<v8::Isolate*>(isolate_), clone_id)
+           .ToLocal(&array_buffer_value)) {
+    RETURN_EXCEPTION_IF_SCHEDULED_EXCEPTION(isolate_, JSArrayBuffer);
+    return MaybeHandle<JSArrayBuffer>();
+  }
+  Handle<JSArrayBuffer> array_buffer = Utils::OpenHandle(*array_buffer_value);
+  AddObjectWithID(id, array_buffer);
+  return array_buffer;
+}
+
 MaybeHandle<JSArrayBufferView> ValueDeserializer::ReadJSArrayBufferView(
     Handle<JSArrayBuffer> buffer) {
   uint32_t buffer_byte_length = static_cast<uint32_t>(buffer->byte_length());
@@ -1892,6 +2058,86 @@ static bool IsValidObjectKey(Handle<Object> value) {
   return value->IsName() || value->IsNumber();
 }
 
+Maybe<uint32_t> ValueDeserializer::ReadJSObjectPropertiesWithShape(
+    Handle<JSObject> object, Handle<FixedArray> keys) {
+  Handle<Map> map(object->map(), isolate_);
+  DCHECK(!map->is_dictionary_map());
+  DCHECK_EQ(0, map->instance_descriptors()->number_of_descriptors());
+  std::vector<Handle<Object>> properties;
+  properties.reserve(keys->length());
+  uint32_t num_properties = 0;
+
+  // Like the fast path in ReadJSObjectProperties, but the keys are known up
+  // front, so there is no need to read and compare them.
+  bool transitioning = true;
+  for (int i = 0; i < keys->length(); i++) {
+    SerializationTag tag;
+    if (!PeekTag().To(&tag)) return Nothing<uint32_t>();
+    if (tag == SerializationTag::kTheHole) {
+      ConsumeTag(SerializationTag::kTheHole);
+      continue;
+    }
+
+    Handle<String> key(String::cast(keys->get(i)), isolate_);
+    Handle<Map> target;
+    if (transitioning) {
+      transitioning = TransitionsAccessor(isolate_, map)
+                          .FindTransitionToField(key)
+                          .ToHandle(&target);
+    }
+
+    Handle<Object> value;
+    if (!ReadObject().ToHandle(&value)) return Nothing<uint32_t>();
+
+    if (transitioning) {
+      int descriptor = static_cast<int>(properties.size());
+      PropertyDetails details =
+          target->instance_descriptors()->GetDetails(descriptor);
+      Representation expected_representation = details.representation();
+      if (value->FitsRepresentation(expected_representation)) {
+        if (expected_representation.IsHeapObject() &&
+            !target->instance_descriptors()
+                 ->GetFieldType(descriptor)
+                 ->NowContains(value)) {
+          Handle<FieldType> value_type =
+              value->OptimalType(isolate_, expected_representation);
+          Map::GeneralizeField(isolate_, target, descriptor,
+                               details.constness(), expected_representation,
+                               value_type);
+        }
+        DCHECK(target->instance_descriptors()
+                   ->GetFieldType(descriptor)
+                   ->NowContains(value));
+        properties.push_back(value);
+        map = target;
+        continue;
+      }
+
+      // Commit the properties gathered so far, and then start setting
+      // properties slowly instead.
+      transitioning = false;
+      CommitProperties(object, map, properties);
+      num_properties = static_cast<uint32_t>(properties.size());
+    }
+
+    bool success;
+    LookupIterator it = LookupIterator::PropertyOrElement(
+        isolate_, object, key, &success, LookupIterator::OWN);
+    if (!success || it.state() != LookupIterator::NOT_FOUND ||
+        JSObject::DefineOwnPropertyIgnoreAttributes(&it, value, NONE)
+            .is_null()) {
+      return Nothing<uint32_t>();
+    }
+    num_properties++;
+  }
+
+  if (transitioning) {
+    CommitProperties(object, map, properties);
+    num_properties = static_cast<uint32_t>(properties.size());
+  }
+  return Just(num_properties);
+}
+
 Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
     Handle<JSObject> object, SerializationTag end_tag,
     bool can_use_transitions) {
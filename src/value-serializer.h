@@ -114,6 +114,7 @@ class ValueSerializer {
   void WriteMutableHeapNumber(MutableHeapNumber* number);
   void WriteBigInt(BigInt bigint);
   void WriteString(Handle<String> string);
+  Maybe<bool> WriteExternalString(Handle<String> string) V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSReceiver(Handle<JSReceiver> receiver)
       V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSObject(Handle<JSObject> object) V8_WARN_UNUSED_RESULT;
@@ -166,6 +167,10 @@ class ValueSerializer {
   IdentityMap<uint32_t, ZoneAllocationPolicy> id_map_;
   uint32_t next_id_ = 0;
 
+  // A similar map, from object maps to the IDs of their shapes.
+  IdentityMap<uint32_t, ZoneAllocationPolicy> shape_map_;
+  uint32_t next_shape_id_ = 0;
+
   // A similar map, for transferred array buffers.
   IdentityMap<uint32_t, ZoneAllocationPolicy> array_buffer_transfer_map_;
 
@@ -260,7 +265,10 @@ class ValueDeserializer {
   MaybeHandle<String> ReadUtf8String() V8_WARN_UNUSED_RESULT;
   MaybeHandle<String> ReadOneByteString() V8_WARN_UNUSED_RESULT;
   MaybeHandle<String> ReadTwoByteString() V8_WARN_UNUSED_RESULT;
+  MaybeHandle<String> ReadExternalString() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSObject> ReadJSObject() V8_WARN_UNUSED_RESULT;
+  MaybeHandle<JSObject> ReadShapedJSObject() V8_WARN_UNUSED_RESULT;
+  MaybeHandle<FixedArray> ReadShape() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadSparseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadDenseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSDate> ReadJSDate() V8_WARN_UNUSED_RESULT;
@@ -272,6 +280,8 @@ class ValueDeserializer {
       V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArrayBuffer> ReadTransferredJSArrayBuffer()
       V8_WARN_UNUSED_RESULT;
+  MaybeHandle<JSArrayBuffer> ReadJSArrayBufferFromContentsId()
+      V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArrayBufferView> ReadJSArrayBufferView(
       Handle<JSArrayBuffer> buffer) V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSObject> ReadWasmModule() V8_WARN_UNUSED_RESULT;
@@ -287,6 +297,11 @@ class ValueDeserializer {
                                          SerializationTag end_tag,
                                          bool can_use_transitions);
 
+  // Reads one value (or a hole) for each of the |keys| into the object. If
+  // successful, returns the number of properties read.
+  Maybe<uint32_t> ReadJSObjectPropertiesWithShape(Handle<JSObject> object,
+                                                  Handle<FixedArray> keys);
+
   // Manipulating the map from IDs to reified objects.
   bool HasObjectWithID(uint32_t id);
   MaybeHandle<JSReceiver> GetObjectWithID(uint32_t id);
@@ -299,10 +314,12 @@ class ValueDeserializer {
   PretenureFlag pretenure_;
   uint32_t version_ = 0;
   uint32_t next_id_ = 0;
+  uint32_t next_shape_id_ = 0;
   bool expect_inline_wasm_ = false;
 
   // Always global handles.
   Handle<FixedArray> id_map_;
+  Handle<FixedArray> shape_map_;
   MaybeHandle<SimpleNumberDictionary> array_buffer_transfer_map_;
 
   DISALLOW_COPY_AND_ASSIGN(ValueDeserializer);
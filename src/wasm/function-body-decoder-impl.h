@@ -715,6 +715,10 @@ struct ControlWithNamedConstructors : public ControlBase<Value> {
   F(CallIndirect, const Value& index,                                         \
     const CallIndirectImmediate<validate>& imm, const Value args[],           \
     Value returns[])                                                          \
+  F(ReturnCall, const CallFunctionImmediate<validate>& imm,                   \
+    const Value args[])                                                       \
+  F(ReturnCallIndirect, const Value& index,                                   \
+    const CallIndirectImmediate<validate>& imm, const Value args[])           \
   F(SimdOp, WasmOpcode opcode, Vector<Value> args, Value* result)             \
   F(SimdLaneOp, WasmOpcode opcode, const SimdLaneImmediate<validate>& imm,    \
     const Vector<Value> inputs, Value* result)                                \
@@ -1149,11 +1153,13 @@ class WasmDecoder : public Decoder {
         return 1 + imm.length;
       }
 
-      case kExprCallFunction: {
+      case kExprCallFunction:
+      case kExprReturnCall: {
         CallFunctionImmediate<validate> imm(decoder, pc);
         return 1 + imm.length;
       }
-      case kExprCallIndirect: {
+      case kExprCallIndirect:
+      case kExprReturnCallIndirect: {
         CallIndirectImmediate<validate> imm(decoder, pc);
         return 1 + imm.length;
       }
@@ -1344,6 +1350,16 @@ class WasmDecoder : public Decoder {
         return {imm.sig->parameter_count() + 1,
                 imm.sig->return_count()};
       }
+      case kExprReturnCall: {
+        CallFunctionImmediate<validate> imm(this, pc);
+        CHECK(Complete(pc, imm));
+        return {imm.sig->parameter_count(), 0};
+      }
+      case kExprReturnCallIndirect: {
+        CallIndirectImmediate<validate> imm(this, pc);
+        CHECK(Complete(pc, imm));
+        return {imm.sig->parameter_count() + 1, 0};
+      }
       case kExprBr:
       case kExprBlock:
       case kExprLoop:
@@ -2099,6 +2115,36 @@ class WasmFullDecoder : public WasmDecoder<validate> {
                                         returns);
             break;
           }
+          case kExprReturnCall: {
+            CHECK_PROTOTYPE_OPCODE(return_call);
+            CallFunctionImmediate<validate> imm(this, this->pc_);
+            len = 1 + imm.length;
+            if (!this->Validate(this->pc_, imm)) break;
+            if (!this->CanReturnCall(imm.sig)) {
+              OPCODE_ERROR(opcode, "tail call return types mismatch");
+              break;
+            }
+            PopArgs(imm.sig);
+            CALL_INTERFACE_IF_REACHABLE(ReturnCall, imm, args_.data());
+            EndControl();
+            break;
+          }
+          case kExprReturnCallIndirect: {
+            CHECK_PROTOTYPE_OPCODE(return_call);
+            CallIndirectImmediate<validate> imm(this, this->pc_);
+            len = 1 + imm.length;
+            if (!this->Validate(this->pc_, imm)) break;
+            if (!this->CanReturnCall(imm.sig)) {
+              OPCODE_ERROR(opcode, "tail call return types mismatch");
+              break;
+            }
+            auto index = Pop(0, kWasmI32);
+            PopArgs(imm.sig);
+            CALL_INTERFACE_IF_REACHABLE(ReturnCallIndirect, index, imm,
+                                        args_.data());
+            EndControl();
+            break;
+          }
           case kNumericPrefix: {
             ++len;
             byte numeric_index = this->template read_u8<validate>(
@@ -2706,6 +2752,18 @@ class WasmFullDecoder : public WasmDecoder<validate> {
     return TypeCheckMergeValues(c, c->br_merge());
   }
 
+  // A tail call is only valid if the callee returns exactly the values of the
+  // current function.
+  bool CanReturnCall(FunctionSig* target_sig) {
+    if (target_sig == nullptr) return false;
+    size_t num_returns = this->sig_->return_count();
+    if (num_returns != target_sig->return_count()) return false;
+    for (size_t i = 0; i < num_returns; ++i) {
+      if (this->sig_->GetReturn(i) != target_sig->GetReturn(i)) return false;
+    }
+    return true;
+  }
+
   bool TypeCheckReturn() {
     // Returns must have at least the number of values expected; can have more.
     uint32_t num_returns = static_cast<uint32_t>(this->sig_->return_count());
@@ -66,6 +66,18 @@ void WasmCompilationUnit::ExecuteCompilation(
   const WasmModule* module = native_module_->module();
   DCHECK_EQ(module, env->module);
 
+  // If Liftoff bailed out on this function (e.g. because it uses SIMD), the
+  // baseline unit already compiled it with TurboFan, and the tiering unit has
+  // nothing left to do.
+  if (tier_ == ExecutionTier::kOptimized &&
+      native_module_->HasTurbofanCode(func_index_)) {
+    if (FLAG_trace_wasm_compiler) {
+      PrintF("Skipping wasm function %d, already compiled with %s\n\n",
+             func_index_, GetExecutionTierAsString(tier_));
+    }
+    return;
+  }
+
   auto* func = &env->module->functions[func_index_];
   Vector<const uint8_t> code = wire_bytes_storage->GetCode(func->code);
   wasm::FunctionBody func_body{func->sig, func->code.offset(), code.start(),
@@ -91,8 +103,6 @@ void WasmCompilationUnit::ExecuteCompilation(
       }
       // Otherwise, fall back to turbofan.
       SwitchTier(ExecutionTier::kOptimized);
-      // TODO(wasm): We could actually stop or remove the tiering unit for this
-      // function to avoid compiling it twice with TurboFan.
       V8_FALLTHROUGH;
     case ExecutionTier::kOptimized:
       turbofan_unit_->ExecuteCompilation(env, func_body, counters, detected);
@@ -387,6 +387,18 @@ class WasmGraphBuildingInterface {
     DoCall(decoder, index.node, imm.sig, imm.sig_index, args, returns);
   }
 
+  void ReturnCall(FullDecoder* decoder,
+                  const CallFunctionImmediate<validate>& imm,
+                  const Value args[]) {
+    DoReturnCall(decoder, nullptr, imm.sig, imm.index, args);
+  }
+
+  void ReturnCallIndirect(FullDecoder* decoder, const Value& index,
+                          const CallIndirectImmediate<validate>& imm,
+                          const Value args[]) {
+    DoReturnCall(decoder, index.node, imm.sig, imm.sig_index, args);
+  }
+
   void SimdOp(FullDecoder* decoder, WasmOpcode opcode, Vector<Value> args,
               Value* result) {
     TFNode** inputs = GetNodes(args);
@@ -859,6 +871,21 @@ class WasmGraphBuildingInterface {
     // reload mem_size and mem_start.
     LoadContextIntoSsa(ssa_env_);
   }
+
+  void DoReturnCall(FullDecoder* decoder, TFNode* index_node, FunctionSig* sig,
+                    uint32_t index, const Value args[]) {
+    int arg_count = static_cast<int>(sig->parameter_count());
+    TFNode** arg_nodes = builder_->Buffer(arg_count + 1);
+    arg_nodes[0] = index_node;
+    for (int i = 0; i < arg_count; ++i) {
+      arg_nodes[i + 1] = args[i].node;
+    }
+    if (index_node) {
+      BUILD(ReturnCallIndirect, index, arg_nodes, decoder->position());
+    } else {
+      BUILD(ReturnCall, index, arg_nodes, decoder->position());
+    }
+  }
 };
 
 }  // namespace
@@ -15,6 +15,7 @@
 #include "src/task-utils.h"
 #include "src/tracing/trace-event.h"
 #include "src/trap-handler/trap-handler.h"
+#include "src/wasm/function-body-decoder-impl.h"
 #include "src/wasm/module-decoder.h"
 #include "src/wasm/streaming-decoder.h"
 #include "src/wasm/wasm-code-manager.h"
@@ -93,6 +94,12 @@ class CompilationStateImpl {
   void ScheduleCodeLogging(WasmCode*);
 
   void OnBackgroundTaskStopped(const WasmFeatures& detected);
+  // Called by background tasks before fetching the next unit. Once only
+  // tier-up units are left, tasks in excess of {max_tiering_background_tasks_}
+  // stop here, such that tier-up does not occupy all worker threads. Returns
+  // whether the calling task was stopped; in that case
+  // {OnBackgroundTaskStopped} must not be called.
+  bool StopBackgroundTaskIfThrottled(const WasmFeatures& detected);
   void PublishDetectedFeatures(Isolate* isolate, const WasmFeatures& detected);
   void RestartBackgroundTasks(size_t max = std::numeric_limits<size_t>::max());
   // Only one foreground thread (finisher) is allowed to run at a time.
@@ -280,6 +287,8 @@ class CompilationStateImpl {
   std::shared_ptr<v8::TaskRunner> foreground_task_runner_;
 
   const size_t max_background_tasks_ = 0;
+  // Tier-up is not urgent, so it only runs on a part of the worker threads.
+  const size_t max_tiering_background_tasks_ = 0;
 
   size_t outstanding_baseline_units_ = 0;
   size_t outstanding_tiering_units_ = 0;
@@ -546,13 +555,20 @@ WasmCode* LazyCompileFunction(Isolate* isolate, NativeModule* native_module,
 
 Address CompileLazy(Isolate* isolate, NativeModule* native_module,
                     uint32_t func_index) {
+  NativeModuleModificationScope native_module_modification_scope(native_module);
+
+  // Deserialized code is relocated on its first call instead of compiled.
+  if (WasmCode* code = native_module->TakeDeferredCode(func_index)) {
+    PublishDeserializedCode(native_module, code);
+    if (WasmCode::ShouldBeLogged(isolate)) code->LogCode(isolate);
+    return code->instruction_start();
+  }
+
   HistogramTimerScope lazy_time_scope(
       isolate->counters()->wasm_lazy_compilation_time());
 
   DCHECK(!native_module->lazy_compile_frozen());
 
-  NativeModuleModificationScope native_module_modification_scope(native_module);
-
   WasmCode* result = LazyCompileFunction(isolate, native_module, func_index);
   DCHECK_NOT_NULL(result);
   DCHECK_EQ(func_index, result->index());
@@ -567,28 +583,41 @@ namespace {
 // {CompilationStateImpl} when {Commit} is called.
 class CompilationUnitBuilder {
  public:
-  explicit CompilationUnitBuilder(NativeModule* native_module,
-                                  WasmEngine* wasm_engine)
-      : native_module_(native_module), wasm_engine_(wasm_engine) {}
+  // {start_function_callees} optionally marks the functions called
+  // (transitively) from the start function, which are compiled with the same
+  // priority as the module's entry points.
+  explicit CompilationUnitBuilder(
+      NativeModule* native_module, WasmEngine* wasm_engine,
+      std::vector<bool> start_function_callees = {})
+      : native_module_(native_module),
+        wasm_engine_(wasm_engine),
+        start_function_callees_(std::move(start_function_callees)) {}
 
   void AddUnit(uint32_t func_index) {
+    bool priority = IsPriority(func_index);
     switch (compilation_state()->compile_mode()) {
       case CompileMode::kTiering:
-        tiering_units_.emplace_back(
-            CreateUnit(func_index, ExecutionTier::kOptimized));
-        baseline_units_.emplace_back(
-            CreateUnit(func_index, ExecutionTier::kBaseline));
+        (priority ? priority_tiering_units_ : tiering_units_)
+            .emplace_back(CreateUnit(func_index, ExecutionTier::kOptimized));
+        (priority ? priority_baseline_units_ : baseline_units_)
+            .emplace_back(CreateUnit(func_index, ExecutionTier::kBaseline));
         return;
       case CompileMode::kRegular:
-        baseline_units_.emplace_back(CreateUnit(
-            func_index, WasmCompilationUnit::GetDefaultExecutionTier()));
+        (priority ? priority_baseline_units_ : baseline_units_)
+            .emplace_back(CreateUnit(
+                func_index, WasmCompilationUnit::GetDefaultExecutionTier()));
         return;
     }
     UNREACHABLE();
   }
 
   bool Commit() {
-    if (baseline_units_.empty() && tiering_units_.empty()) return false;
+    if (baseline_units_.empty() && tiering_units_.empty() &&
+        priority_baseline_units_.empty() && priority_tiering_units_.empty()) {
+      return false;
+    }
+    MergeInQueueOrder(&baseline_units_, &priority_baseline_units_);
+    MergeInQueueOrder(&tiering_units_, &priority_tiering_units_);
     compilation_state()->AddCompilationUnits(baseline_units_, tiering_units_);
     Clear();
     return true;
@@ -597,9 +626,39 @@ class CompilationUnitBuilder {
   void Clear() {
     baseline_units_.clear();
     tiering_units_.clear();
+    priority_baseline_units_.clear();
+    priority_tiering_units_.clear();
   }
 
  private:
+  using UnitVector = std::vector<std::unique_ptr<WasmCompilationUnit>>;
+
+  // Without execution counts, the best guess at which functions are hot is
+  // the module's entry points: exported functions and the start function,
+  // plus everything the start function calls during instantiation. These are
+  // compiled before all others.
+  bool IsPriority(uint32_t func_index) const {
+    const WasmModule* module = native_module_->module();
+    if (module->functions[func_index].exported) return true;
+    if (module->start_function_index == static_cast<int>(func_index)) {
+      return true;
+    }
+    return func_index < start_function_callees_.size() &&
+           start_function_callees_[func_index];
+  }
+
+  // Units are taken from the back of the queue. Arrange {units} such that
+  // the {priority_units} are taken first, and all units are otherwise taken
+  // in the order in which they were added, i.e. in function index order.
+  static void MergeInQueueOrder(UnitVector* units, UnitVector* priority_units) {
+    std::reverse(units->begin(), units->end());
+    std::reverse(priority_units->begin(), priority_units->end());
+    units->insert(units->end(),
+                  std::make_move_iterator(priority_units->begin()),
+                  std::make_move_iterator(priority_units->end()));
+    priority_units->clear();
+  }
+
   std::unique_ptr<WasmCompilationUnit> CreateUnit(uint32_t func_index,
                                                   ExecutionTier tier) {
     return base::make_unique<WasmCompilationUnit>(wasm_engine_, native_module_,
@@ -612,10 +671,47 @@ class CompilationUnitBuilder {
 
   NativeModule* const native_module_;
   WasmEngine* const wasm_engine_;
-  std::vector<std::unique_ptr<WasmCompilationUnit>> baseline_units_;
-  std::vector<std::unique_ptr<WasmCompilationUnit>> tiering_units_;
+  const std::vector<bool> start_function_callees_;
+  UnitVector baseline_units_;
+  UnitVector tiering_units_;
+  UnitVector priority_baseline_units_;
+  UnitVector priority_tiering_units_;
 };
 
+// Returns a vector indexed by function index which marks all functions that
+// are called directly or transitively from the start function. Indirect calls
+// are not followed.
+std::vector<bool> ComputeStartFunctionCallees(NativeModule* native_module,
+                                              WasmEngine* wasm_engine) {
+  const WasmModule* module = native_module->module();
+  std::vector<bool> reachable(module->functions.size(), false);
+  if (module->start_function_index < 0) return reachable;
+  ModuleWireBytes wire_bytes(native_module->wire_bytes());
+  Zone zone(wasm_engine->allocator(), ZONE_NAME);
+  std::vector<uint32_t> worklist{
+      static_cast<uint32_t>(module->start_function_index)};
+  reachable[worklist.back()] = true;
+  while (!worklist.empty()) {
+    const WasmFunction& function = module->functions[worklist.back()];
+    worklist.pop_back();
+    if (function.imported) continue;
+    Vector<const uint8_t> code = wire_bytes.GetFunctionBytes(&function);
+    BodyLocalDecls locals(&zone);
+    for (BytecodeIterator it(code.start(), code.end(), &locals); it.has_next();
+         it.next()) {
+      if (it.current() != kExprCallFunction &&
+          it.current() != kExprReturnCall) {
+        continue;
+      }
+      CallFunctionImmediate<Decoder::kNoValidate> imm(&it, it.pc());
+      if (imm.index >= reachable.size() || reachable[imm.index]) continue;
+      reachable[imm.index] = true;
+      worklist.push_back(imm.index);
+    }
+  }
+  return reachable;
+}
+
 bool compile_lazy(const WasmModule* module) {
   return FLAG_wasm_lazy_compilation ||
          (FLAG_asm_wasm_lazy_compilation && module->origin == kAsmJsOrigin);
@@ -673,7 +769,9 @@ void InitializeCompilationUnits(NativeModule* native_module,
                                 WasmEngine* wasm_engine) {
   ModuleWireBytes wire_bytes(native_module->wire_bytes());
   const WasmModule* module = native_module->module();
-  CompilationUnitBuilder builder(native_module, wasm_engine);
+  CompilationUnitBuilder builder(
+      native_module, wasm_engine,
+      ComputeStartFunctionCallees(native_module, wasm_engine));
   uint32_t start = module->num_imported_functions;
   uint32_t end = start + module->num_declared_functions;
   for (uint32_t i = start; i < end; ++i) {
@@ -804,38 +902,29 @@ void CompileSequentially(Isolate* isolate, NativeModule* native_module,
   UpdateFeatureUseCounts(isolate, detected);
 }
 
-void ValidateSequentially(Isolate* isolate, NativeModule* native_module,
-                          ErrorThrower* thrower) {
-  DCHECK(!thrower->error());
-
+void ReportValidationError(ErrorThrower* thrower, NativeModule* native_module,
+                           uint32_t func_index, const DecodeResult& result) {
+  DCHECK(result.failed());
   ModuleWireBytes wire_bytes(native_module->wire_bytes());
   const WasmModule* module = native_module->module();
-  uint32_t start = module->num_imported_functions;
-  uint32_t end = start + module->num_declared_functions;
-  for (uint32_t i = start; i < end; ++i) {
-    const WasmFunction& func = module->functions[i];
+  const WasmFunction& func = module->functions[func_index];
+  TruncatedUserString<> name(wire_bytes.GetNameOrNull(&func, module));
+  thrower->CompileError("Compiling function #%d:%.*s failed: %s @+%u",
+                        func_index, name.length(), name.start(),
+                        result.error_msg().c_str(), result.error_offset());
+}
 
-    const byte* base = wire_bytes.start();
-    FunctionBody body{func.sig, func.code.offset(), base + func.code.offset(),
-                      base + func.code.end_offset()};
-    DecodeResult result;
-    {
-      auto time_counter = SELECT_WASM_COUNTER(
-          isolate->counters(), module->origin, wasm_decode, function_time);
-
-      TimedHistogramScope wasm_decode_function_time_scope(time_counter);
-      WasmFeatures detected;
-      result = VerifyWasmCode(isolate->allocator(),
-                              native_module->enabled_features(), module,
-                              &detected, body);
-    }
-    if (result.failed()) {
-      TruncatedUserString<> name(wire_bytes.GetNameOrNull(&func, module));
-      thrower->CompileError("Compiling function #%d:%.*s failed: %s @+%u", i,
-                            name.length(), name.start(),
-                            result.error_msg().c_str(), result.error_offset());
-      break;
-    }
+void ValidateFunctions(Isolate* isolate, NativeModule* native_module,
+                       ErrorThrower* thrower) {
+  DCHECK(!thrower->error());
+
+  DecodeResult result;
+  uint32_t func_index = ValidateFunctionBodies(
+      isolate->allocator(), isolate->counters(),
+      native_module->enabled_features(), native_module->module(),
+      ModuleWireBytes(native_module->wire_bytes()), &result);
+  if (result.failed()) {
+    ReportValidationError(thrower, native_module, func_index, result);
   }
 }
 
@@ -852,7 +941,7 @@ void CompileNativeModule(Isolate* isolate, ErrorThrower* thrower,
       // TODO(clemensh): According to the spec, we can actually skip validation
       // at module creation time, and return a function that always traps at
       // (lazy) compilation time.
-      ValidateSequentially(isolate, native_module, thrower);
+      ValidateFunctions(isolate, native_module, thrower);
       if (thrower->error()) return;
     }
 
@@ -957,6 +1046,9 @@ class BackgroundCompileTask : public CancelableTask {
     auto* compilation_state = Impl(native_module_->compilation_state());
     WasmFeatures detected_features = kNoWasmFeatures;
     while (!compilation_state->failed()) {
+      if (compilation_state->StopBackgroundTaskIfThrottled(detected_features)) {
+        return;
+      }
       if (!FetchAndExecuteCompilationUnit(&env, compilation_state,
                                           &detected_features, counters_)) {
         break;
@@ -1961,8 +2053,12 @@ Handle<JSArrayBuffer> InstanceBuilder::AllocateMemory(uint32_t num_pages) {
   const bool is_shared_memory = module_->has_shared_memory && enabled_.threads;
   SharedFlag shared_flag =
       is_shared_memory ? SharedFlag::kShared : SharedFlag::kNotShared;
+  uint32_t maximum_pages = module_->has_maximum_pages ? module_->maximum_pages
+                                                      : max_mem_pages();
   Handle<JSArrayBuffer> mem_buffer;
-  if (!NewArrayBuffer(isolate_, num_pages * kWasmPageSize, shared_flag)
+  if (!NewArrayBuffer(isolate_, num_pages * kWasmPageSize,
+                      static_cast<size_t>(maximum_pages) * kWasmPageSize,
+                      shared_flag)
            .ToHandle(&mem_buffer)) {
     thrower_->RangeError("Out of memory: wasm memory");
   }
@@ -2433,6 +2529,9 @@ void AsyncCompileJob::FinishCompile(bool compile_wrappers) {
   compilation_state->PublishDetectedFeatures(
       isolate_, *compilation_state->detected_features());
 
+  isolate_->wasm_engine()->UpdateNativeModuleCache(
+      module_object_->shared_native_module());
+
   // TODO(bbudge) Allow deserialization without wrapper compilation, so we can
   // just compile wrappers here.
   if (compile_wrappers) {
@@ -3004,7 +3103,9 @@ CompilationStateImpl::CompilationStateImpl(internal::Isolate* isolate,
       should_log_code_(WasmCode::ShouldBeLogged(isolate)),
       max_background_tasks_(std::max(
           1, std::min(FLAG_wasm_num_compilation_tasks,
-                      V8::GetCurrentPlatform()->NumberOfWorkerThreads()))) {
+                      V8::GetCurrentPlatform()->NumberOfWorkerThreads()))),
+      max_tiering_background_tasks_(
+          std::max<size_t>(1, max_background_tasks_ / 2)) {
   v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
   v8::Platform* platform = V8::GetCurrentPlatform();
   foreground_task_runner_ = platform->GetForegroundTaskRunner(v8_isolate);
@@ -3109,6 +3210,9 @@ void CompilationStateImpl::OnFinishedUnit() {
     if (outstanding_tiering_units_ == 0) {
       // We currently finish all baseline units before finishing tiering units.
       DCHECK_EQ(0, outstanding_baseline_units_);
+      // All baseline code got replaced now. Trigger the code GC before the
+      // callbacks, which might delete this compilation state.
+      if (FLAG_wasm_code_gc) isolate_->wasm_engine()->TriggerCodeGC();
       NotifyOnEvent(CompilationEvent::kFinishedTopTierCompilation, nullptr);
     }
   } else {
@@ -3162,6 +3266,16 @@ void CompilationStateImpl::OnBackgroundTaskStopped(
   UnionFeaturesInto(&detected_features_, detected);
 }
 
+bool CompilationStateImpl::StopBackgroundTaskIfThrottled(
+    const WasmFeatures& detected) {
+  base::MutexGuard guard(&mutex_);
+  if (!baseline_compilation_units_.empty()) return false;
+  if (num_background_tasks_ <= max_tiering_background_tasks_) return false;
+  --num_background_tasks_;
+  UnionFeaturesInto(&detected_features_, detected);
+  return true;
+}
+
 void CompilationStateImpl::PublishDetectedFeatures(
     Isolate* isolate, const WasmFeatures& detected) {
   // Notifying the isolate of the feature counts must take place under
@@ -3174,18 +3288,25 @@ void CompilationStateImpl::PublishDetectedFeatures(
 
 void CompilationStateImpl::RestartBackgroundTasks(size_t max) {
   size_t num_restart;
+  TaskPriority priority;
   {
     base::MutexGuard guard(&mutex_);
     // No need to restart tasks if compilation already failed.
     if (failed()) return;
 
     DCHECK_LE(num_background_tasks_, max_background_tasks_);
-    if (num_background_tasks_ == max_background_tasks_) return;
+    bool only_tiering = baseline_compilation_units_.empty();
+    size_t max_tasks =
+        only_tiering ? max_tiering_background_tasks_ : max_background_tasks_;
+    if (num_background_tasks_ >= max_tasks) return;
     size_t num_compilation_units =
         baseline_compilation_units_.size() + tiering_compilation_units_.size();
-    size_t stopped_tasks = max_background_tasks_ - num_background_tasks_;
+    size_t stopped_tasks = max_tasks - num_background_tasks_;
     num_restart = std::min(max, std::min(num_compilation_units, stopped_tasks));
     num_background_tasks_ += num_restart;
+    // Tier-up compilation must not delay more important background work.
+    priority = only_tiering ? TaskPriority::kBestEffort
+                            : TaskPriority::kUserVisible;
   }
 
   for (; num_restart > 0; --num_restart) {
@@ -3195,7 +3316,8 @@ void CompilationStateImpl::RestartBackgroundTasks(size_t max) {
     // If --wasm-num-compilation-tasks=0 is passed, do only spawn foreground
     // tasks. This is used to make timing deterministic.
     if (FLAG_wasm_num_compilation_tasks > 0) {
-      V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
+      V8::GetCurrentPlatform()->PostTaskOnWorkerThread(priority,
+                                                       std::move(task));
     } else {
       foreground_task_runner_->PostTask(std::move(task));
     }
@@ -5,13 +5,16 @@
 #include "src/wasm/module-decoder.h"
 
 #include "src/base/functional.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
 #include "src/base/template-utils.h"
+#include "src/cancelable-task.h"
 #include "src/counters.h"
 #include "src/flags.h"
 #include "src/macro-assembler.h"
 #include "src/objects-inl.h"
 #include "src/ostreams.h"
+#include "src/tracing/trace-event.h"
 #include "src/v8.h"
 #include "src/wasm/decoder.h"
 #include "src/wasm/function-body-decoder-impl.h"
@@ -1036,12 +1039,18 @@ class ModuleDecoderImpl : public Decoder {
 
     WasmSectionIterator section_iter(decoder);
 
+    // Unless each function is traced, function bodies are validated after all
+    // sections are decoded, in parallel.
+    bool validate_after_decoding = verify_functions &&
+                                   !FLAG_trace_wasm_decoder &&
+                                   !FLAG_trace_wasm_decode_time;
+
     while (ok() && section_iter.more()) {
       // Shift the offset by the section header length
       offset += section_iter.payload_start() - section_iter.section_start();
       if (section_iter.section_code() != SectionCode::kUnknownSectionCode) {
         DecodeSection(section_iter.section_code(), section_iter.payload(),
-                      offset, verify_functions);
+                      offset, verify_functions && !validate_after_decoding);
       }
       // Shift the offset by the remaining section payload
       offset += section_iter.payload_length();
@@ -1054,6 +1063,8 @@ class ModuleDecoderImpl : public Decoder {
       return decoder.toResult<std::unique_ptr<WasmModule>>(nullptr);
     }
 
+    if (validate_after_decoding && ok()) VerifyFunctionBodies(allocator);
+
     return FinishDecoding(verify_functions);
   }
 
@@ -1233,8 +1244,28 @@ class ModuleDecoderImpl : public Decoder {
                               &unused_detected_features, body);
     }
 
-    // If the decode failed and this is the first error, set error code and
-    // location.
+    SetFunctionError(func_name, result);
+  }
+
+  // Verifies the bodies of all declared functions of {module_}, using worker
+  // threads. The error reported is the one of the first invalid function.
+  void VerifyFunctionBodies(AccountingAllocator* allocator) {
+    ModuleWireBytes wire_bytes(start_, end_);
+    DecodeResult result;
+    uint32_t func_index =
+        ValidateFunctionBodies(allocator, GetCounters(), enabled_features_,
+                               module_.get(), wire_bytes, &result);
+    if (result.ok()) return;
+    const WasmFunction* function = &module_->functions[func_index];
+    WasmFunctionName func_name(
+        function, wire_bytes.GetNameOrNull(function, module_.get()));
+    SetFunctionError(func_name, result);
+  }
+
+  // If the decode failed and this is the first error, set error code and
+  // location.
+  void SetFunctionError(const WasmFunctionName& func_name,
+                        const DecodeResult& result) {
     if (result.failed() && intermediate_result_.ok()) {
       // Wrap the error message from the function decoder.
       std::ostringstream error_msg;
@@ -1620,6 +1651,121 @@ class ModuleDecoderImpl : public Decoder {
   }
 };
 
+namespace {
+
+// Validation of the declared functions of a module, shared between the calling
+// thread and worker threads. Functions are handed out in index order, and
+// every function handed out is validated to the end, so the error reported is
+// the one of the first invalid function, as with sequential validation.
+class FunctionBodiesValidation {
+ public:
+  FunctionBodiesValidation(AccountingAllocator* allocator, Counters* counters,
+                           const WasmFeatures& enabled,
+                           const WasmModule* module,
+                           const ModuleWireBytes& wire_bytes)
+      : allocator_(allocator),
+        counters_(counters),
+        enabled_(enabled),
+        module_(module),
+        wire_bytes_(wire_bytes),
+        next_func_index_(module->num_imported_functions),
+        end_func_index_(module->num_imported_functions +
+                        module->num_declared_functions),
+        error_func_index_(end_func_index_) {}
+
+  void ValidateFunctions() {
+    while (!has_error_.load(std::memory_order_relaxed)) {
+      uint32_t func_index = next_func_index_.fetch_add(1);
+      if (func_index >= end_func_index_) return;
+      DecodeResult result = ValidateFunction(func_index);
+      if (result.ok()) continue;
+      base::MutexGuard guard(&mutex_);
+      if (func_index < error_func_index_) {
+        error_func_index_ = func_index;
+        error_ = std::move(result);
+      }
+      has_error_.store(true, std::memory_order_relaxed);
+    }
+  }
+
+  // Must only be called once no thread is validating anymore.
+  uint32_t GetError(DecodeResult* error) {
+    if (has_error_.load(std::memory_order_relaxed)) *error = std::move(error_);
+    return error_func_index_;
+  }
+
+ private:
+  DecodeResult ValidateFunction(uint32_t func_index) {
+    const WasmFunction& func = module_->functions[func_index];
+    const byte* base = wire_bytes_.start();
+    FunctionBody body{func.sig, func.code.offset(), base + func.code.offset(),
+                      base + func.code.end_offset()};
+    auto time_counter = SELECT_WASM_COUNTER(counters_, module_->origin,
+                                            wasm_decode, function_time);
+    TimedHistogramScope wasm_decode_function_time_scope(time_counter);
+    WasmFeatures unused_detected_features;
+    return VerifyWasmCode(allocator_, enabled_, module_,
+                          &unused_detected_features, body);
+  }
+
+  AccountingAllocator* const allocator_;
+  Counters* const counters_;
+  const WasmFeatures enabled_;
+  const WasmModule* const module_;
+  const ModuleWireBytes wire_bytes_;
+  std::atomic<uint32_t> next_func_index_;
+  const uint32_t end_func_index_;
+  std::atomic<bool> has_error_{false};
+  base::Mutex mutex_;
+  uint32_t error_func_index_;
+  DecodeResult error_;
+};
+
+class FunctionBodiesValidationTask : public CancelableTask {
+ public:
+  FunctionBodiesValidationTask(CancelableTaskManager* task_manager,
+                               FunctionBodiesValidation* validation)
+      : CancelableTask(task_manager), validation_(validation) {}
+
+  void RunInternal() override {
+    TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.wasm"),
+                 "FunctionBodiesValidationTask::RunInternal");
+    validation_->ValidateFunctions();
+  }
+
+ private:
+  FunctionBodiesValidation* const validation_;
+};
+
+}  // namespace
+
+uint32_t ValidateFunctionBodies(AccountingAllocator* allocator,
+                                Counters* counters,
+                                const WasmFeatures& enabled,
+                                const WasmModule* module,
+                                const ModuleWireBytes& wire_bytes,
+                                DecodeResult* error) {
+  FunctionBodiesValidation validation(allocator, counters, enabled, module,
+                                      wire_bytes);
+  CancelableTaskManager task_manager;
+  int num_tasks = 0;
+  if (!FLAG_trace_wasm_decoder && FLAG_wasm_num_compilation_tasks > 0 &&
+      module->num_declared_functions > 1) {
+    num_tasks = std::min(FLAG_wasm_num_compilation_tasks,
+                         V8::GetCurrentPlatform()->NumberOfWorkerThreads());
+  }
+  for (int i = 0; i < num_tasks; ++i) {
+    V8::GetCurrentPlatform()->CallOnWorkerThread(
+        base::make_unique<FunctionBodiesValidationTask>(&task_manager,
+                                                        &validation));
+  }
+  // The calling thread validates as well, and then waits for the tasks that
+  // are still running. Tasks that did not start yet are not needed anymore.
+  validation.ValidateFunctions();
+  task_manager.CancelAndWait();
+  return validation.GetError(error);
+}
+
 ModuleResult DecodeWasmModule(const WasmFeatures& enabled,
                               const byte* module_start, const byte* module_end,
                               bool verify_functions, ModuleOrigin origin,
@@ -64,6 +64,15 @@ V8_EXPORT_PRIVATE ModuleResult DecodeWasmModule(
     const byte* module_end, bool verify_functions, ModuleOrigin origin,
     Counters* counters, AccountingAllocator* allocator);
 
+// Validates the bodies of all functions declared in {module}. Unless decoding
+// is traced, worker threads help the calling thread. Returns the index of the
+// first invalid function and stores its error in {error}, or returns the end
+// of the declared functions if they are all valid.
+V8_EXPORT_PRIVATE uint32_t ValidateFunctionBodies(
+    AccountingAllocator* allocator, Counters* counters,
+    const WasmFeatures& enabled, const WasmModule* module,
+    const ModuleWireBytes& wire_bytes, DecodeResult* error);
+
 // Exposed for testing. Decodes a single function signature, allocating it
 // in the given zone. Returns {nullptr} upon failure.
 V8_EXPORT_PRIVATE FunctionSig* DecodeWasmSignatureForTesting(
@@ -16,6 +16,7 @@
 #include "src/wasm/wasm-limits.h"
 #include "src/wasm/wasm-objects.h"
 #include "src/wasm/wasm-result.h"
+#include "src/wasm/wasm-serialization.h"
 
 #define TRACE_STREAMING(...)                            \
   do {                                                  \
@@ -30,6 +31,19 @@ void StreamingDecoder::OnBytesReceived(Vector<const uint8_t> bytes) {
   if (deserializing()) {
     wire_bytes_for_deserializing_.insert(wire_bytes_for_deserializing_.end(),
                                          bytes.begin(), bytes.end());
+    if (wire_bytes_for_deserializing_.size() <=
+        GetSerializedWireBytesSize(compiled_module_bytes_)) {
+      return;
+    }
+    // The cached module was compiled from fewer wire bytes and cannot be
+    // used. Don't wait for the end of the stream to find out, but start
+    // decoding the bytes received so far right away.
+    TRACE_STREAMING("Cached module does not match the wire bytes\n");
+    compiled_module_bytes_ = {};
+    DCHECK(!deserializing());
+    std::vector<uint8_t> wire_bytes;
+    wire_bytes.swap(wire_bytes_for_deserializing_);
+    OnBytesReceived(VectorOf(wire_bytes));
     return;
   }
 
@@ -634,17 +634,35 @@ WasmCode* NativeModule::AddDeserializedCode(
                    code_comments_offset, unpadded_binary_size,
                    std::move(protected_instructions), std::move(reloc_info),
                    std::move(source_position_table), WasmCode::kFunction, tier);
-
-  if (!code->protected_instructions_.is_empty()) {
-    code->RegisterTrapHandlerData();
-  }
-  base::MutexGuard lock(&allocation_mutex_);
-  InstallCode(code);
   // Note: we do not flush the i-cache here, since the code needs to be
   // relocated anyway. The caller is responsible for flushing the i-cache later.
   return code;
 }
 
+void NativeModule::DeferPublishing(WasmCode* code) {
+  base::MutexGuard lock(&allocation_mutex_);
+  DCHECK_EQ(0, deferred_code_.count(code->index()));
+  deferred_code_.emplace(code->index(), code);
+}
+
+WasmCode* NativeModule::TakeDeferredCode(uint32_t index) {
+  base::MutexGuard lock(&allocation_mutex_);
+  auto it = deferred_code_.find(index);
+  if (it == deferred_code_.end()) return nullptr;
+  WasmCode* code = it->second;
+  deferred_code_.erase(it);
+  return code;
+}
+
+std::vector<WasmCode*> NativeModule::TakeAllDeferredCode() {
+  base::MutexGuard lock(&allocation_mutex_);
+  std::vector<WasmCode*> result;
+  result.reserve(deferred_code_.size());
+  for (auto& entry : deferred_code_) result.push_back(entry.second);
+  deferred_code_.clear();
+  return result;
+}
+
 void NativeModule::PublishCode(WasmCode* code) {
   base::MutexGuard lock(&allocation_mutex_);
   // Skip publishing code if there is an active redirection to the interpreter
@@ -665,6 +683,12 @@ void NativeModule::PublishInterpreterEntry(WasmCode* code,
   SetInterpreterRedirection(func_index);
 }
 
+bool NativeModule::HasTurbofanCode(uint32_t index) const {
+  base::MutexGuard lock(&allocation_mutex_);
+  WasmCode* code = this->code(index);
+  return code != nullptr && code->tier() == WasmCode::kTurbofan;
+}
+
 std::vector<WasmCode*> NativeModule::SnapshotCodeTable() const {
   base::MutexGuard lock(&allocation_mutex_);
   std::vector<WasmCode*> result;
@@ -700,7 +724,15 @@ void NativeModule::InstallCode(WasmCode* code) {
 
   // Update code table, except for interpreter entries.
   if (code->kind() != WasmCode::kInterpreterEntry) {
-    code_table_[code->index() - module_->num_imported_functions] = code;
+    WasmCode** entry =
+        &code_table_[code->index() - module_->num_imported_functions];
+    // Replaced code (e.g. Liftoff code after tier-up) is unreachable by new
+    // calls, and can be freed once it is not on any stack anymore.
+    if (FLAG_wasm_code_gc && *entry != nullptr &&
+        (*entry)->kind() == WasmCode::kFunction) {
+      replaced_code_.push_back(*entry);
+    }
+    *entry = code;
   }
 
   // Patch jump table.
@@ -792,6 +824,53 @@ Vector<byte> NativeModule::AllocateForCode(size_t size) {
   return {reinterpret_cast<byte*>(code_space.begin()), code_space.size()};
 }
 
+void NativeModule::TakeReplacedCode(std::vector<WasmCode*>* replaced_code) {
+  base::MutexGuard lock(&allocation_mutex_);
+  replaced_code->insert(replaced_code->end(), replaced_code_.begin(),
+                        replaced_code_.end());
+  replaced_code_.clear();
+}
+
+void NativeModule::AddReplacedCode(Vector<WasmCode* const> replaced_code) {
+  base::MutexGuard lock(&allocation_mutex_);
+  replaced_code_.insert(replaced_code_.end(), replaced_code.begin(),
+                        replaced_code.end());
+}
+
+void NativeModule::FreeCode(Vector<WasmCode* const> codes) {
+  base::MutexGuard lock(&allocation_mutex_);
+  std::unordered_set<WasmCode*> dead_code(codes.begin(), codes.end());
+  for (WasmCode* code : dead_code) {
+    DCHECK_NE(code,
+              code_table_[code->index() - module_->num_imported_functions]);
+    TRACE_HEAP("Freeing code %p (index %u)\n",
+               reinterpret_cast<void*>(code->instruction_start()),
+               code->index());
+    freed_code_space_.Merge(
+        {code->instruction_start(),
+         RoundUp(code->instructions().size(), kCodeAlignment)});
+  }
+  // Deleting the code objects also releases their trap handler data.
+  owned_code_.erase(
+      std::remove_if(owned_code_.begin(), owned_code_.end(),
+                     [&dead_code](const std::unique_ptr<WasmCode>& code) {
+                       return dead_code.count(code.get()) != 0;
+                     }),
+      owned_code_.end());
+  // Discard the pages which contain only freed code. The code space bump
+  // allocator assumes that the first page of free code space is committed, so
+  // freed code space is never handed out again.
+  v8::PageAllocator* page_allocator = GetPlatformPageAllocator();
+  size_t page_size = page_allocator->CommitPageSize();
+  for (auto& region : freed_code_space_.regions()) {
+    Address discard_start = RoundUp(region.begin(), page_size);
+    Address discard_end = RoundDown(region.end(), page_size);
+    if (discard_start >= discard_end) continue;
+    page_allocator->DiscardSystemPages(
+        reinterpret_cast<void*>(discard_start), discard_end - discard_start);
+  }
+}
+
 namespace {
 class NativeModuleWireBytesStorage final : public WireBytesStorage {
  public:
@@ -1120,6 +1199,16 @@ bool NativeModule::SetExecutable(bool executable) {
 }
 
 void WasmCodeManager::FreeNativeModule(NativeModule* native_module) {
+  // Stop any code GC from freeing code of this module.
+  base::MutexGuard code_gc_lock(&code_gc_mutex_);
+  for (auto it = code_gc_candidates_.begin();
+       it != code_gc_candidates_.end();) {
+    if (it->first->native_module() == native_module) {
+      it = code_gc_candidates_.erase(it);
+    } else {
+      ++it;
+    }
+  }
   base::MutexGuard lock(&native_modules_mutex_);
   DCHECK_EQ(1, native_modules_.count(native_module));
   native_modules_.erase(native_module);
@@ -1142,6 +1231,47 @@ void WasmCodeManager::FreeNativeModule(NativeModule* native_module) {
   DCHECK_LE(remaining_uncommitted_code_space_.load(), kMaxWasmCodeMemory);
 }
 
+bool WasmCodeManager::StartCodeGC() {
+  base::MutexGuard code_gc_lock(&code_gc_mutex_);
+  DCHECK(code_gc_candidates_.empty());
+  std::vector<NativeModule*> native_modules;
+  {
+    base::MutexGuard lock(&native_modules_mutex_);
+    native_modules.assign(native_modules_.begin(), native_modules_.end());
+  }
+  // The native modules cannot die while we hold {code_gc_mutex_}.
+  std::vector<WasmCode*> replaced_code;
+  for (NativeModule* native_module : native_modules) {
+    native_module->TakeReplacedCode(&replaced_code);
+  }
+  for (WasmCode* code : replaced_code) code_gc_candidates_.emplace(code, false);
+  return !code_gc_candidates_.empty();
+}
+
+void WasmCodeManager::MarkLiveCodeForGC(Vector<WasmCode* const> live_code) {
+  base::MutexGuard code_gc_lock(&code_gc_mutex_);
+  for (WasmCode* code : live_code) {
+    auto it = code_gc_candidates_.find(code);
+    if (it != code_gc_candidates_.end()) it->second = true;
+  }
+}
+
+void WasmCodeManager::FinishCodeGC() {
+  base::MutexGuard code_gc_lock(&code_gc_mutex_);
+  std::unordered_map<NativeModule*, std::vector<WasmCode*>> dead_code;
+  std::unordered_map<NativeModule*, std::vector<WasmCode*>> live_code;
+  for (auto& candidate : code_gc_candidates_) {
+    WasmCode* code = candidate.first;
+    bool is_live = candidate.second;
+    (is_live ? live_code : dead_code)[code->native_module()].push_back(code);
+  }
+  code_gc_candidates_.clear();
+  for (auto& entry : dead_code) entry.first->FreeCode(VectorOf(entry.second));
+  for (auto& entry : live_code) {
+    entry.first->AddReplacedCode(VectorOf(entry.second));
+  }
+}
+
 NativeModule* WasmCodeManager::LookupNativeModule(Address pc) const {
   base::MutexGuard lock(&native_modules_mutex_);
   if (lookup_map_.empty()) return nullptr;
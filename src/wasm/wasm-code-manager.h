@@ -232,6 +232,8 @@ class V8_EXPORT_PRIVATE NativeModule final {
                     OwnedVector<const byte> source_position_table,
                     WasmCode::Kind kind, WasmCode::Tier tier);
 
+  // Adds code from a serialized module. The code still needs to be relocated
+  // before it is published via {PublishCode} or {DeferPublishing}.
   WasmCode* AddDeserializedCode(
       uint32_t index, Vector<const byte> instructions, uint32_t stack_slots,
       size_t safepoint_table_offset, size_t handler_table_offset,
@@ -261,6 +263,14 @@ class V8_EXPORT_PRIVATE NativeModule final {
   // threads executing the old code.
   void PublishCode(WasmCode* code);
 
+  // Keeps deserialized but not yet relocated {code} until the function is
+  // first called through its jump table slot, which has to point to the lazy
+  // compile stub. {TakeDeferredCode} then hands it out to be relocated and
+  // published.
+  void DeferPublishing(WasmCode* code);
+  WasmCode* TakeDeferredCode(uint32_t index);
+  std::vector<WasmCode*> TakeAllDeferredCode();
+
   // Switch a function to an interpreter entry wrapper. When adding interpreter
   // wrappers, we do not insert them in the code_table, however, we let them
   // self-identify as the {index} function.
@@ -278,6 +288,10 @@ class V8_EXPORT_PRIVATE NativeModule final {
 
   bool has_code(uint32_t index) const { return code(index) != nullptr; }
 
+  // Whether the code currently installed for function {index} was compiled
+  // with TurboFan. Safe to call concurrently with {PublishCode}.
+  bool HasTurbofanCode(uint32_t index) const;
+
   WasmCode* runtime_stub(WasmCode::RuntimeStubId index) const {
     DCHECK_LT(index, WasmCode::kRuntimeStubCount);
     WasmCode* code = runtime_stub_table_[index];
@@ -368,6 +382,16 @@ class V8_EXPORT_PRIVATE NativeModule final {
   // Allocate code space. Returns a valid buffer or fails with OOM (crash).
   Vector<byte> AllocateForCode(size_t size);
 
+  // Moves the code which got replaced in the code table since the last call
+  // into {replaced_code}. Code which is still alive after a code GC is given
+  // back via {AddReplacedCode}, to be considered by the next code GC.
+  void TakeReplacedCode(std::vector<WasmCode*>* replaced_code);
+  void AddReplacedCode(Vector<WasmCode* const> replaced_code);
+
+  // Frees code which got replaced and is not on any stack anymore. The pages
+  // only occupied by freed code are discarded, their code space is not reused.
+  void FreeCode(Vector<WasmCode* const> codes);
+
   // Primitive for adding code to the native module. All code added to a native
   // module is owned by that module. Various callers get to decide on how the
   // code is obtained (CodeDesc vs, as a point in time, Code), the kind,
@@ -441,7 +465,7 @@ class V8_EXPORT_PRIVATE NativeModule final {
   std::unique_ptr<WasmImportWrapperCache> import_wrapper_cache_;
 
   // This mutex protects concurrent calls to {AddCode} and friends.
-  mutable base::Mutex allocation_mutex_;
+  mutable base::Mutex allocation_mutex_{"NativeModule::allocation_mutex"};
 
   //////////////////////////////////////////////////////////////////////////////
   // Protected by {allocation_mutex_}:
@@ -458,8 +482,17 @@ class V8_EXPORT_PRIVATE NativeModule final {
 
   DisjointAllocationPool free_code_space_;
   DisjointAllocationPool allocated_code_space_;
+  DisjointAllocationPool freed_code_space_;
   std::list<VirtualMemory> owned_code_space_;
 
+  // Code which got replaced in {code_table_}, to be freed by a code GC once it
+  // is not on any stack anymore (see {WasmCodeManager::StartCodeGC}).
+  std::vector<WasmCode*> replaced_code_;
+
+  // Deserialized code which is not relocated and published yet, by function
+  // index (see {DeferPublishing}).
+  std::unordered_map<uint32_t, WasmCode*> deferred_code_;
+
   // End of fields protected by {allocation_mutex_}.
   //////////////////////////////////////////////////////////////////////////////
 
@@ -498,6 +531,15 @@ class V8_EXPORT_PRIVATE WasmCodeManager final {
 
   void SetMaxCommittedMemoryForTesting(size_t limit);
 
+  // Code GC, see {WasmEngine::TriggerCodeGC}. Starts collecting the code which
+  // got replaced in any native module so far, and returns false if there is
+  // none.
+  bool StartCodeGC();
+  // Keeps code which is on a stack from being freed by the current code GC.
+  void MarkLiveCodeForGC(Vector<WasmCode* const> live_code);
+  // Frees all code of the current code GC which was not marked live.
+  void FinishCodeGC();
+
   // TODO(v8:7424): For now we sample module sizes in a GC callback. This will
   // bias samples towards apps with high memory pressure. We should switch to
   // using sampling based on regular intervals independent of the GC.
@@ -523,7 +565,8 @@ class V8_EXPORT_PRIVATE WasmCodeManager final {
 
   WasmMemoryTracker* const memory_tracker_;
   std::atomic<size_t> remaining_uncommitted_code_space_;
-  mutable base::Mutex native_modules_mutex_;
+  mutable base::Mutex native_modules_mutex_{
+      "WasmCodeManager::native_modules_mutex"};
 
   //////////////////////////////////////////////////////////////////////////////
   // Protected by {native_modules_mutex_}:
@@ -534,6 +577,19 @@ class V8_EXPORT_PRIVATE WasmCodeManager final {
   // End of fields protected by {native_modules_mutex_}.
   //////////////////////////////////////////////////////////////////////////////
 
+  // Protects the code GC. Native modules cannot die while it is held, so it
+  // must be taken before {native_modules_mutex_} and {allocation_mutex_}.
+  base::Mutex code_gc_mutex_;
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Protected by {code_gc_mutex_}:
+
+  // Code of the current code GC, mapped to whether it was marked live.
+  std::unordered_map<WasmCode*, bool> code_gc_candidates_;
+
+  // End of fields protected by {code_gc_mutex_}.
+  //////////////////////////////////////////////////////////////////////////////
+
   DISALLOW_COPY_AND_ASSIGN(WasmCodeManager);
 };
 
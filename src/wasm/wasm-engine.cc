@@ -6,6 +6,7 @@
 
 #include "src/code-tracer.h"
 #include "src/compilation-statistics.h"
+#include "src/frames-inl.h"
 #include "src/objects-inl.h"
 #include "src/objects/js-promise.h"
 #include "src/wasm/function-compiler.h"
@@ -87,6 +88,11 @@ Handle<WasmModuleObject> WasmEngine::FinalizeTranslatedAsmJs(
 MaybeHandle<WasmModuleObject> WasmEngine::SyncCompile(
     Isolate* isolate, const WasmFeatures& enabled, ErrorThrower* thrower,
     const ModuleWireBytes& bytes) {
+  if (std::shared_ptr<NativeModule> cached_module =
+          MaybeGetCachedNativeModule(enabled, bytes.module_bytes())) {
+    return ImportNativeModule(isolate, std::move(cached_module));
+  }
+
   ModuleResult result =
       DecodeWasmModule(enabled, bytes.start(), bytes.end(), false, kWasmOrigin,
                        isolate->counters(), allocator());
@@ -124,6 +130,7 @@ MaybeHandle<WasmModuleObject> WasmEngine::SyncCompile(
 
   // Finish the Wasm script now and make it public to the debugger.
   isolate->debug()->OnAfterCompile(script);
+  UpdateNativeModuleCache(module_object->shared_native_module());
   return module_object;
 }
 
@@ -197,6 +204,16 @@ void WasmEngine::AsyncCompile(
     return;
   }
 
+  // Shared wire bytes could change concurrently, don't look them up.
+  std::shared_ptr<NativeModule> cached_module =
+      is_shared ? nullptr
+                : MaybeGetCachedNativeModule(enabled, bytes.module_bytes());
+  if (cached_module) {
+    resolver->OnCompilationSucceeded(
+        ImportNativeModule(isolate, std::move(cached_module)));
+    return;
+  }
+
   if (FLAG_wasm_test_streaming) {
     std::shared_ptr<StreamingDecoder> streaming_decoder =
         StartStreamingCompilation(isolate, enabled,
@@ -254,6 +271,47 @@ Handle<WasmModuleObject> WasmEngine::ImportNativeModule(
   return module_object;
 }
 
+namespace {
+
+size_t WireBytesHash(Vector<const uint8_t> wire_bytes) {
+  return base::hash_range(wire_bytes.begin(), wire_bytes.end());
+}
+
+}  // namespace
+
+std::shared_ptr<NativeModule> WasmEngine::MaybeGetCachedNativeModule(
+    const WasmFeatures& enabled, Vector<const uint8_t> wire_bytes) {
+  if (!FLAG_wasm_native_module_cache) return nullptr;
+  size_t hash = WireBytesHash(wire_bytes);
+  base::MutexGuard guard(&mutex_);
+  auto range = native_module_cache_.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    std::shared_ptr<NativeModule> native_module = it->second.lock();
+    if (!native_module) continue;
+    Vector<const uint8_t> cached_bytes = native_module->wire_bytes();
+    if (native_module->enabled_features() == enabled &&
+        cached_bytes.size() == wire_bytes.size() &&
+        memcmp(cached_bytes.start(), wire_bytes.start(), wire_bytes.size()) ==
+            0) {
+      return native_module;
+    }
+  }
+  return nullptr;
+}
+
+void WasmEngine::UpdateNativeModuleCache(
+    std::shared_ptr<NativeModule> native_module) {
+  if (!FLAG_wasm_native_module_cache) return;
+  size_t hash = WireBytesHash(native_module->wire_bytes());
+  base::MutexGuard guard(&mutex_);
+  // Drop the entries of modules that died in the meantime.
+  for (auto it = native_module_cache_.begin();
+       it != native_module_cache_.end();) {
+    it = it->second.expired() ? native_module_cache_.erase(it) : std::next(it);
+  }
+  native_module_cache_.emplace(hash, std::move(native_module));
+}
+
 CompilationStatistics* WasmEngine::GetOrCreateTurboStatistics() {
   base::MutexGuard guard(&mutex_);
   if (compilation_stats_ == nullptr) {
@@ -331,6 +389,51 @@ void WasmEngine::RemoveIsolate(Isolate* isolate) {
   base::MutexGuard guard(&mutex_);
   DCHECK_EQ(1, isolates_.count(isolate));
   isolates_.erase(isolate);
+  // An isolate which dies does not keep any code alive.
+  if (code_gc_outstanding_isolates_.erase(isolate) != 0 &&
+      code_gc_outstanding_isolates_.empty()) {
+    FinishCodeGC();
+  }
+}
+
+void WasmEngine::TriggerCodeGC() {
+  base::MutexGuard guard(&mutex_);
+  if (!code_gc_outstanding_isolates_.empty()) {
+    // Collect the newly replaced code once the running code GC finished.
+    code_gc_requested_again_ = true;
+    return;
+  }
+  StartCodeGC();
+}
+
+void WasmEngine::ReportLiveCodeFromStackForGC(Isolate* isolate) {
+  // The wasm frames on this thread's stack cannot change while we report them.
+  std::vector<WasmCode*> live_code;
+  for (StackFrameIterator it(isolate); !it.done(); it.Advance()) {
+    StackFrame* const frame = it.frame();
+    if (frame->type() != StackFrame::WASM_COMPILED) continue;
+    live_code.push_back(WasmCompiledFrame::cast(frame)->wasm_code());
+  }
+  base::MutexGuard guard(&mutex_);
+  if (code_gc_outstanding_isolates_.erase(isolate) == 0) return;
+  code_manager_.MarkLiveCodeForGC(VectorOf(live_code));
+  if (code_gc_outstanding_isolates_.empty()) FinishCodeGC();
+}
+
+void WasmEngine::StartCodeGC() {
+  DCHECK(code_gc_outstanding_isolates_.empty());
+  code_gc_requested_again_ = false;
+  if (isolates_.empty() || !code_manager_.StartCodeGC()) return;
+  code_gc_outstanding_isolates_ = isolates_;
+  for (Isolate* isolate : isolates_) {
+    isolate->stack_guard()->RequestWasmCodeGC();
+  }
+}
+
+void WasmEngine::FinishCodeGC() {
+  DCHECK(code_gc_outstanding_isolates_.empty());
+  code_manager_.FinishCodeGC();
+  if (code_gc_requested_again_) StartCodeGC();
 }
 
 namespace {
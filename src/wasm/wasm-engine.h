@@ -6,6 +6,7 @@
 #define V8_WASM_WASM_ENGINE_H_
 
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "src/wasm/wasm-code-manager.h"
@@ -114,6 +115,17 @@ class V8_EXPORT_PRIVATE WasmEngine {
   Handle<WasmModuleObject> ImportNativeModule(
       Isolate* isolate, std::shared_ptr<NativeModule> shared_module);
 
+  // With --wasm-native-module-cache, returns the native module of an earlier
+  // compilation of {wire_bytes} with the same {enabled} features, if it is
+  // still alive in any isolate. Returns nullptr otherwise.
+  std::shared_ptr<NativeModule> MaybeGetCachedNativeModule(
+      const WasmFeatures& enabled, Vector<const uint8_t> wire_bytes);
+
+  // With --wasm-native-module-cache, makes {native_module} available to later
+  // compilations of the same wire bytes. The cache doesn't keep the module
+  // alive.
+  void UpdateNativeModuleCache(std::shared_ptr<NativeModule> native_module);
+
   WasmCodeManager* code_manager() { return &code_manager_; }
 
   WasmMemoryTracker* memory_tracker() { return &memory_tracker_; }
@@ -145,6 +157,14 @@ class V8_EXPORT_PRIVATE WasmEngine {
   void AddIsolate(Isolate* isolate);
   void RemoveIsolate(Isolate* isolate);
 
+  // Triggers a GC of the wasm code which got replaced so far (e.g. by tier-up).
+  // Every isolate is interrupted to report the wasm code on its stack, and the
+  // replaced code which is not on any stack is freed afterwards.
+  void TriggerCodeGC();
+
+  // Called by each isolate on the interrupt requested by {TriggerCodeGC}.
+  void ReportLiveCodeFromStackForGC(Isolate* isolate);
+
   // Call on process start and exit.
   static void InitializeOncePerProcess();
   static void GlobalTearDown();
@@ -160,6 +180,10 @@ class V8_EXPORT_PRIVATE WasmEngine {
       Handle<Context> context,
       std::shared_ptr<CompilationResultResolver> resolver);
 
+  // Start and finish a code GC. Must be called while holding {mutex_}.
+  void StartCodeGC();
+  void FinishCodeGC();
+
   WasmMemoryTracker memory_tracker_;
   WasmCodeManager code_manager_;
   AccountingAllocator allocator_;
@@ -181,6 +205,17 @@ class V8_EXPORT_PRIVATE WasmEngine {
   // Set of isolates which use this WasmEngine. Used for cross-isolate GCs.
   std::unordered_set<Isolate*> isolates_;
 
+  // Isolates which did not report their live code for the current code GC
+  // yet. The code GC is running iff this is not empty.
+  std::unordered_set<Isolate*> code_gc_outstanding_isolates_;
+
+  // Set if another code GC should start once the current one finished.
+  bool code_gc_requested_again_ = false;
+
+  // Compiled native modules, keyed by a hash of their wire bytes.
+  std::unordered_multimap<size_t, std::weak_ptr<NativeModule>>
+      native_module_cache_;
+
   // End of fields protected by {mutex_}.
   //////////////////////////////////////////////////////////////////////////////
 
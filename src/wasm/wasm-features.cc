@@ -15,11 +15,16 @@ namespace wasm {
 #define SPACE
 #define DO_UNION(feat, desc, val) dst->feat |= src.feat;
 #define FLAG_REF(feat, desc, val) FLAG_experimental_wasm_##feat
+#define DO_COMPARE(feat, desc, val) a.feat == b.feat
 
 void UnionFeaturesInto(WasmFeatures* dst, const WasmFeatures& src) {
   FOREACH_WASM_FEATURE(DO_UNION, SPACE);
 }
 
+bool operator==(const WasmFeatures& a, const WasmFeatures& b) {
+  return FOREACH_WASM_FEATURE(DO_COMPARE, &&);
+}
+
 WasmFeatures WasmFeaturesFromFlags() {
   return WasmFeatures{FOREACH_WASM_FEATURE(FLAG_REF, COMMA)};
 }
@@ -33,6 +38,7 @@ WasmFeatures WasmFeaturesFromIsolate(Isolate* isolate) {
 
 #undef DO_UNION
 #undef FLAG_REF
+#undef DO_COMPARE
 #undef SPACE
 #undef COMMA
 }  // namespace wasm
@@ -60,6 +60,8 @@ V8_EXPORT_PRIVATE WasmFeatures WasmFeaturesFromIsolate(Isolate* isolate);
 V8_EXPORT_PRIVATE void UnionFeaturesInto(WasmFeatures* dst,
                                          const WasmFeatures& src);
 
+V8_EXPORT_PRIVATE bool operator==(const WasmFeatures& a, const WasmFeatures& b);
+
 }  // namespace wasm
 }  // namespace internal
 }  // namespace v8
@@ -658,16 +658,31 @@ struct InterpreterCode {
   const byte* at(pc_t pc) { return start + pc; }
 };
 
+// The immediate of an instruction, decoded once up front so that executing
+// the instruction does not need to re-read LEB128-encoded bytes.
+struct PredecodedImmediate {
+  // Local, global or function index, branch depth, memory offset, or the
+  // value of an i32 constant.
+  uint32_t value;
+  // Length of the whole instruction, including the opcode.
+  uint32_t length;
+};
+
 // A helper class to compute the control transfers for each bytecode offset.
 // Control transfers allow Br, BrIf, BrTable, If, Else, and End bytecodes to
 // be directly executed without the need to dynamically track blocks.
+// Additionally, the immediates of the most frequently executed instructions
+// are pre-decoded, indexed by bytecode offset.
 class SideTable : public ZoneObject {
  public:
   ControlTransferMap map_;
+  ZoneVector<PredecodedImmediate> immediates_;
   uint32_t max_stack_height_ = 0;
 
   SideTable(Zone* zone, const WasmModule* module, InterpreterCode* code)
-      : map_(zone) {
+      : map_(zone),
+        immediates_(static_cast<size_t>(code->orig_end - code->orig_start),
+                    zone) {
     // Create a zone for all temporary objects.
     Zone control_transfer_zone(zone->allocator(), ZONE_NAME);
 
@@ -790,6 +805,7 @@ class SideTable : public ZoneObject {
         stack_height = stack_height - stack_effect.first + stack_effect.second;
         if (stack_height > max_stack_height_) max_stack_height_ = stack_height;
       }
+      PredecodeImmediate(opcode, &i);
       switch (opcode) {
         case kExprBlock:
         case kExprLoop: {
@@ -902,6 +918,69 @@ class SideTable : public ZoneObject {
     DCHECK(result != map_.end());
     return result->second;
   }
+
+  const PredecodedImmediate& Immediate(pc_t pc) const {
+    DCHECK_LT(pc, immediates_.size());
+    DCHECK_NE(0, immediates_[pc].length);
+    return immediates_[pc];
+  }
+
+ private:
+  void PredecodeImmediate(WasmOpcode opcode, BytecodeIterator* i) {
+    PredecodedImmediate& entry = immediates_[i->pc_offset()];
+    switch (opcode) {
+      case kExprBlock:
+      case kExprLoop:
+      case kExprIf: {
+        BlockTypeImmediate<Decoder::kNoValidate> imm(kAllWasmFeatures, i,
+                                                     i->pc());
+        entry = {0, 1 + imm.length};
+        break;
+      }
+      case kExprBr:
+      case kExprBrIf: {
+        BranchDepthImmediate<Decoder::kNoValidate> imm(i, i->pc());
+        entry = {imm.depth, 1 + imm.length};
+        break;
+      }
+      case kExprI32Const: {
+        ImmI32Immediate<Decoder::kNoValidate> imm(i, i->pc());
+        entry = {static_cast<uint32_t>(imm.value), 1 + imm.length};
+        break;
+      }
+      case kExprGetLocal:
+      case kExprSetLocal:
+      case kExprTeeLocal: {
+        LocalIndexImmediate<Decoder::kNoValidate> imm(i, i->pc());
+        entry = {imm.index, 1 + imm.length};
+        break;
+      }
+      case kExprGetGlobal:
+      case kExprSetGlobal: {
+        GlobalIndexImmediate<Decoder::kNoValidate> imm(i, i->pc());
+        entry = {imm.index, 1 + imm.length};
+        break;
+      }
+      case kExprCallFunction:
+      case kExprReturnCall: {
+        CallFunctionImmediate<Decoder::kNoValidate> imm(i, i->pc());
+        entry = {imm.index, 1 + imm.length};
+        break;
+      }
+#define PREDECODE_MEM_CASE(name, ...) case kExpr##name:
+        FOREACH_LOAD_MEM_OPCODE(PREDECODE_MEM_CASE)
+        FOREACH_STORE_MEM_OPCODE(PREDECODE_MEM_CASE) {
+          // The alignment hint is not needed by the interpreter.
+          MemoryAccessImmediate<Decoder::kNoValidate> imm(i, i->pc(),
+                                                          kMaxUInt32);
+          entry = {imm.offset, 1 + imm.length};
+          break;
+        }
+#undef PREDECODE_MEM_CASE
+      default:
+        break;
+    }
+  }
 };
 
 // The main storage for interpreter code. It maps {WasmFunction} to the
@@ -1325,6 +1404,10 @@ class ThreadImpl {
     return false;
   }
 
+  const PredecodedImmediate& Immediate(InterpreterCode* code, pc_t pc) {
+    return code->side_table->Immediate(pc);
+  }
+
   int LookupTargetDelta(InterpreterCode* code, pc_t pc) {
     return static_cast<int>(code->side_table->Lookup(pc).pc_diff);
   }
@@ -1389,6 +1472,25 @@ class ThreadImpl {
     return true;
   }
 
+  // Replaces the current frame with a frame for {target}. The arguments on top
+  // of the stack are moved down to where the parameters of the current frame
+  // start, so the interpreter stack does not grow with each tail call.
+  // Returns false if the stack check failed and the current activation was
+  // fully unwound.
+  bool DoReturnCall(Decoder* decoder, InterpreterCode* target, pc_t* pc,
+                    pc_t* limit) V8_WARN_UNUSED_RESULT {
+    size_t arity = target->function->sig->parameter_count();
+    WasmValue* sp_dest = stack_.get() + frames_.back().sp;
+    frames_.pop_back();
+    DoStackTransfer(sp_dest, arity);
+    PushFrame(target);
+    if (!DoStackCheck()) return false;
+    *pc = frames_.back().pc;
+    *limit = target->end - target->start;
+    decoder->Reset(target->start, target->end);
+    return true;
+  }
+
   // Copies {arity} values on the top of the stack down the stack to {dest},
   // dropping the values in-between.
   void DoStackTransfer(WasmValue* dest, size_t arity) {
@@ -1416,12 +1518,10 @@ class ThreadImpl {
   }
 
   template <typename ctype, typename mtype>
-  bool ExecuteLoad(Decoder* decoder, InterpreterCode* code, pc_t pc, int& len,
+  bool ExecuteLoad(InterpreterCode* code, pc_t pc, uint32_t offset,
                    MachineRepresentation rep) {
-    MemoryAccessImmediate<Decoder::kNoValidate> imm(decoder, code->at(pc),
-                                                    sizeof(ctype));
     uint32_t index = Pop().to<uint32_t>();
-    Address addr = BoundsCheckMem<mtype>(imm.offset, index);
+    Address addr = BoundsCheckMem<mtype>(offset, index);
     if (!addr) {
       DoTrap(kTrapMemOutOfBounds, pc);
       return false;
@@ -1430,10 +1530,9 @@ class ThreadImpl {
         converter<ctype, mtype>{}(ReadLittleEndianValue<mtype>(addr)));
 
     Push(result);
-    len = 1 + imm.length;
 
     if (FLAG_trace_wasm_memory) {
-      MemoryTracingInfo info(imm.offset + index, false, rep);
+      MemoryTracingInfo info(offset + index, false, rep);
       TraceMemoryOperation(ExecutionTier::kInterpreter, &info,
                            code->function->func_index, static_cast<int>(pc),
                            instance_object_->memory_start());
@@ -1443,23 +1542,20 @@ class ThreadImpl {
   }
 
   template <typename ctype, typename mtype>
-  bool ExecuteStore(Decoder* decoder, InterpreterCode* code, pc_t pc, int& len,
+  bool ExecuteStore(InterpreterCode* code, pc_t pc, uint32_t offset,
                     MachineRepresentation rep) {
-    MemoryAccessImmediate<Decoder::kNoValidate> imm(decoder, code->at(pc),
-                                                    sizeof(ctype));
     ctype val = Pop().to<ctype>();
 
     uint32_t index = Pop().to<uint32_t>();
-    Address addr = BoundsCheckMem<mtype>(imm.offset, index);
+    Address addr = BoundsCheckMem<mtype>(offset, index);
     if (!addr) {
       DoTrap(kTrapMemOutOfBounds, pc);
       return false;
     }
     WriteLittleEndianValue<mtype>(addr, converter<mtype, ctype>{}(val));
-    len = 1 + imm.length;
 
     if (FLAG_trace_wasm_memory) {
-      MemoryTracingInfo info(imm.offset + index, true, rep);
+      MemoryTracingInfo info(offset + index, true, rep);
       TraceMemoryOperation(ExecutionTier::kInterpreter, &info,
                            code->function->func_index, static_cast<int>(pc),
                            instance_object_->memory_start());
@@ -1879,12 +1975,20 @@ class ThreadImpl {
       REPLACE_LANE_CASE(I16x8, i16x8, int8, int32_t)
       REPLACE_LANE_CASE(I8x16, i8x16, int16, int32_t)
 #undef REPLACE_LANE_CASE
-      case kExprS128LoadMem:
-        return ExecuteLoad<Simd128, Simd128>(decoder, code, pc, len,
+      case kExprS128LoadMem: {
+        MemoryAccessImmediate<Decoder::kNoValidate> imm(decoder, code->at(pc),
+                                                        sizeof(Simd128));
+        len = 1 + imm.length;
+        return ExecuteLoad<Simd128, Simd128>(code, pc, imm.offset,
                                              MachineRepresentation::kSimd128);
-      case kExprS128StoreMem:
-        return ExecuteStore<Simd128, Simd128>(decoder, code, pc, len,
+      }
+      case kExprS128StoreMem: {
+        MemoryAccessImmediate<Decoder::kNoValidate> imm(decoder, code->at(pc),
+                                                        sizeof(Simd128));
+        len = 1 + imm.length;
+        return ExecuteStore<Simd128, Simd128>(code, pc, imm.offset,
                                               MachineRepresentation::kSimd128);
+      }
 #define SHIFT_CASE(op, name, stype, count, expr)                         \
   case kExpr##op: {                                                      \
     SimdShiftImmediate<Decoder::kNoValidate> imm(decoder, code->at(pc)); \
@@ -2151,26 +2255,17 @@ class ThreadImpl {
       switch (orig) {
         case kExprNop:
           break;
-        case kExprBlock: {
-          BlockTypeImmediate<Decoder::kNoValidate> imm(kAllWasmFeatures,
-                                                       &decoder, code->at(pc));
-          len = 1 + imm.length;
-          break;
-        }
+        case kExprBlock:
         case kExprLoop: {
-          BlockTypeImmediate<Decoder::kNoValidate> imm(kAllWasmFeatures,
-                                                       &decoder, code->at(pc));
-          len = 1 + imm.length;
+          len = Immediate(code, pc).length;
           break;
         }
         case kExprIf: {
-          BlockTypeImmediate<Decoder::kNoValidate> imm(kAllWasmFeatures,
-                                                       &decoder, code->at(pc));
           WasmValue cond = Pop();
           bool is_true = cond.to<uint32_t>() != 0;
           if (is_true) {
             // fall through to the true block.
-            len = 1 + imm.length;
+            len = Immediate(code, pc).length;
             TRACE("  true => fallthrough\n");
           } else {
             len = LookupTargetDelta(code, pc);
@@ -2191,23 +2286,20 @@ class ThreadImpl {
           break;
         }
         case kExprBr: {
-          BranchDepthImmediate<Decoder::kNoValidate> imm(&decoder,
-                                                         code->at(pc));
-          len = DoBreak(code, pc, imm.depth);
+          len = DoBreak(code, pc, Immediate(code, pc).value);
           TRACE("  br => @%zu\n", pc + len);
           break;
         }
         case kExprBrIf: {
-          BranchDepthImmediate<Decoder::kNoValidate> imm(&decoder,
-                                                         code->at(pc));
+          const PredecodedImmediate& imm = Immediate(code, pc);
           WasmValue cond = Pop();
           bool is_true = cond.to<uint32_t>() != 0;
           if (is_true) {
-            len = DoBreak(code, pc, imm.depth);
+            len = DoBreak(code, pc, imm.value);
             TRACE("  br_if => @%zu\n", pc + len);
           } else {
             TRACE("  false => fallthrough\n");
-            len = 1 + imm.length;
+            len = imm.length;
           }
           break;
         }
@@ -2239,9 +2331,9 @@ class ThreadImpl {
           break;
         }
         case kExprI32Const: {
-          ImmI32Immediate<Decoder::kNoValidate> imm(&decoder, code->at(pc));
-          Push(WasmValue(imm.value));
-          len = 1 + imm.length;
+          const PredecodedImmediate& imm = Immediate(code, pc);
+          Push(WasmValue(static_cast<int32_t>(imm.value)));
+          len = imm.length;
           break;
         }
         case kExprI64Const: {
@@ -2263,24 +2355,24 @@ class ThreadImpl {
           break;
         }
         case kExprGetLocal: {
-          LocalIndexImmediate<Decoder::kNoValidate> imm(&decoder, code->at(pc));
-          Push(GetStackValue(frames_.back().sp + imm.index));
-          len = 1 + imm.length;
+          const PredecodedImmediate& imm = Immediate(code, pc);
+          Push(GetStackValue(frames_.back().sp + imm.value));
+          len = imm.length;
           break;
         }
         case kExprSetLocal: {
-          LocalIndexImmediate<Decoder::kNoValidate> imm(&decoder, code->at(pc));
+          const PredecodedImmediate& imm = Immediate(code, pc);
           WasmValue val = Pop();
-          SetStackValue(frames_.back().sp + imm.index, val);
-          len = 1 + imm.length;
+          SetStackValue(frames_.back().sp + imm.value, val);
+          len = imm.length;
           break;
         }
         case kExprTeeLocal: {
-          LocalIndexImmediate<Decoder::kNoValidate> imm(&decoder, code->at(pc));
+          const PredecodedImmediate& imm = Immediate(code, pc);
           WasmValue val = Pop();
-          SetStackValue(frames_.back().sp + imm.index, val);
+          SetStackValue(frames_.back().sp + imm.value, val);
           Push(val);
-          len = 1 + imm.length;
+          len = imm.length;
           break;
         }
         case kExprDrop: {
@@ -2288,9 +2380,8 @@ class ThreadImpl {
           break;
         }
         case kExprCallFunction: {
-          CallFunctionImmediate<Decoder::kNoValidate> imm(&decoder,
-                                                          code->at(pc));
-          InterpreterCode* target = codemap()->GetCode(imm.index);
+          const PredecodedImmediate& imm = Immediate(code, pc);
+          InterpreterCode* target = codemap()->GetCode(imm.value);
           if (target->function->imported) {
             CommitPc(pc);
             ExternalCallResult result =
@@ -2307,7 +2398,7 @@ class ThreadImpl {
                 UNREACHABLE();
               case ExternalCallResult::EXTERNAL_RETURNED:
                 PAUSE_IF_BREAK_FLAG(AfterCall);
-                len = 1 + imm.length;
+                len = imm.length;
                 break;
               case ExternalCallResult::EXTERNAL_UNWOUND:
                 return;
@@ -2349,10 +2440,77 @@ class ThreadImpl {
               return;
           }
         } break;
+        case kExprReturnCall: {
+          const PredecodedImmediate& imm = Immediate(code, pc);
+          InterpreterCode* target = codemap()->GetCode(imm.value);
+          if (target->function->imported) {
+            CommitPc(pc);
+            ExternalCallResult result =
+                CallImportedFunction(target->function->func_index);
+            switch (result.type) {
+              case ExternalCallResult::INTERNAL:
+                // The import is a function of this instance. Call it directly.
+                target = result.interpreter_code;
+                DCHECK(!target->function->imported);
+                break;
+              case ExternalCallResult::INVALID_FUNC:
+              case ExternalCallResult::SIGNATURE_MISMATCH:
+                // Direct calls are checked statically.
+                UNREACHABLE();
+              case ExternalCallResult::EXTERNAL_RETURNED: {
+                // External code cannot reuse our frame; return its results.
+                size_t arity = code->function->sig->return_count();
+                if (!DoReturn(&decoder, &code, &pc, &limit, arity)) return;
+                PAUSE_IF_BREAK_FLAG(AfterReturn);
+                continue;
+              }
+              case ExternalCallResult::EXTERNAL_UNWOUND:
+                return;
+            }
+          }
+          // Execute an internal tail call.
+          if (!DoReturnCall(&decoder, target, &pc, &limit)) return;
+          code = target;
+          PAUSE_IF_BREAK_FLAG(AfterCall);
+          continue;  // don't bump pc
+        }
+        case kExprReturnCallIndirect: {
+          CallIndirectImmediate<Decoder::kNoValidate> imm(&decoder,
+                                                          code->at(pc));
+          uint32_t entry_index = Pop().to<uint32_t>();
+          // Assume only one table for now.
+          DCHECK_LE(module()->tables.size(), 1u);
+          CommitPc(pc);
+          ExternalCallResult result =
+              CallIndirectFunction(0, entry_index, imm.sig_index);
+          switch (result.type) {
+            case ExternalCallResult::INTERNAL:
+              // The target is a function of this instance. Call it directly.
+              if (!DoReturnCall(&decoder, result.interpreter_code, &pc,
+                                &limit)) {
+                return;
+              }
+              code = result.interpreter_code;
+              PAUSE_IF_BREAK_FLAG(AfterCall);
+              continue;  // don't bump pc
+            case ExternalCallResult::INVALID_FUNC:
+              return DoTrap(kTrapFuncInvalid, pc);
+            case ExternalCallResult::SIGNATURE_MISMATCH:
+              return DoTrap(kTrapFuncSigMismatch, pc);
+            case ExternalCallResult::EXTERNAL_RETURNED: {
+              // External code cannot reuse our frame; return its results.
+              size_t arity = code->function->sig->return_count();
+              if (!DoReturn(&decoder, &code, &pc, &limit, arity)) return;
+              PAUSE_IF_BREAK_FLAG(AfterReturn);
+              continue;
+            }
+            case ExternalCallResult::EXTERNAL_UNWOUND:
+              return;
+          }
+        } break;
         case kExprGetGlobal: {
-          GlobalIndexImmediate<Decoder::kNoValidate> imm(&decoder,
-                                                         code->at(pc));
-          const WasmGlobal* global = &module()->globals[imm.index];
+          const PredecodedImmediate& imm = Immediate(code, pc);
+          const WasmGlobal* global = &module()->globals[imm.value];
           byte* ptr = GetGlobalPtr(global);
           WasmValue val;
           switch (global->type) {
@@ -2367,13 +2525,12 @@ class ThreadImpl {
               UNREACHABLE();
           }
           Push(val);
-          len = 1 + imm.length;
+          len = imm.length;
           break;
         }
         case kExprSetGlobal: {
-          GlobalIndexImmediate<Decoder::kNoValidate> imm(&decoder,
-                                                         code->at(pc));
-          const WasmGlobal* global = &module()->globals[imm.index];
+          const PredecodedImmediate& imm = Immediate(code, pc);
+          const WasmGlobal* global = &module()->globals[imm.value];
           byte* ptr = GetGlobalPtr(global);
           WasmValue val = Pop();
           switch (global->type) {
@@ -2387,16 +2544,18 @@ class ThreadImpl {
             default:
               UNREACHABLE();
           }
-          len = 1 + imm.length;
+          len = imm.length;
           break;
         }
 
-#define LOAD_CASE(name, ctype, mtype, rep)                      \
-  case kExpr##name: {                                           \
-    if (!ExecuteLoad<ctype, mtype>(&decoder, code, pc, len,     \
-                                   MachineRepresentation::rep)) \
-      return;                                                   \
-    break;                                                      \
+#define LOAD_CASE(name, ctype, mtype, rep)                             \
+  case kExpr##name: {                                                  \
+    const PredecodedImmediate& imm = Immediate(code, pc);              \
+    if (!ExecuteLoad<ctype, mtype>(code, pc, imm.value,                \
+                                   MachineRepresentation::rep))        \
+      return;                                                          \
+    len = imm.length;                                                  \
+    break;                                                             \
   }
 
           LOAD_CASE(I32LoadMem8S, int32_t, int8_t, kWord8);
@@ -2415,12 +2574,14 @@ class ThreadImpl {
           LOAD_CASE(F64LoadMem, Float64, uint64_t, kFloat64);
 #undef LOAD_CASE
 
-#define STORE_CASE(name, ctype, mtype, rep)                      \
-  case kExpr##name: {                                            \
-    if (!ExecuteStore<ctype, mtype>(&decoder, code, pc, len,     \
-                                    MachineRepresentation::rep)) \
-      return;                                                    \
-    break;                                                       \
+#define STORE_CASE(name, ctype, mtype, rep)                            \
+  case kExpr##name: {                                                  \
+    const PredecodedImmediate& imm = Immediate(code, pc);              \
+    if (!ExecuteStore<ctype, mtype>(code, pc, imm.value,               \
+                                    MachineRepresentation::rep))       \
+      return;                                                          \
+    len = imm.length;                                                  \
+    break;                                                             \
   }
 
           STORE_CASE(I32StoreMem8, int32_t, int8_t, kWord8);
@@ -1096,7 +1096,11 @@ void WebAssemblyMemory(const v8::FunctionCallbackInfo<v8::Value>& args) {
   i::Handle<i::JSArrayBuffer> buffer;
   size_t size = static_cast<size_t>(i::wasm::kWasmPageSize) *
                 static_cast<size_t>(initial);
-  if (!i::wasm::NewArrayBuffer(i_isolate, size, shared_flag)
+  size_t max_size = maximum == -1
+                        ? static_cast<size_t>(i::wasm::max_mem_bytes())
+                        : static_cast<size_t>(i::wasm::kWasmPageSize) *
+                              static_cast<size_t>(maximum);
+  if (!i::wasm::NewArrayBuffer(i_isolate, size, max_size, shared_flag)
            .ToHandle(&buffer)) {
     thrower.RangeError("could not allocate memory");
     return;
@@ -33,10 +33,12 @@ constexpr DoubleRegister kFpReturnRegisters[] = {xmm1, xmm2};
 // == x64 ====================================================================
 // ===========================================================================
 constexpr Register kGpParamRegisters[] = {rsi, rax, rdx, rcx, rbx, r9};
-constexpr Register kGpReturnRegisters[] = {rax, rdx};
+// rcx is not used for returns since the return sequence may need it as a
+// scratch register.
+constexpr Register kGpReturnRegisters[] = {rax, rdx, r8, r9};
 constexpr DoubleRegister kFpParamRegisters[] = {xmm1, xmm2, xmm3,
                                                 xmm4, xmm5, xmm6};
-constexpr DoubleRegister kFpReturnRegisters[] = {xmm1, xmm2};
+constexpr DoubleRegister kFpReturnRegisters[] = {xmm1, xmm2, xmm3, xmm4};
 
 #elif V8_TARGET_ARCH_ARM
 // ===========================================================================
@@ -53,9 +55,9 @@ constexpr DoubleRegister kFpReturnRegisters[] = {d0, d1};
 // == arm64 ====================================================================
 // ===========================================================================
 constexpr Register kGpParamRegisters[] = {x7, x0, x2, x3, x4, x5, x6};
-constexpr Register kGpReturnRegisters[] = {x0, x1};
+constexpr Register kGpReturnRegisters[] = {x0, x1, x2, x3};
 constexpr DoubleRegister kFpParamRegisters[] = {d0, d1, d2, d3, d4, d5, d6, d7};
-constexpr DoubleRegister kFpReturnRegisters[] = {d0, d1};
+constexpr DoubleRegister kFpReturnRegisters[] = {d0, d1, d2, d3};
 
 #elif V8_TARGET_ARCH_MIPS
 // ===========================================================================
@@ -28,13 +28,19 @@ void AddAllocationStatusSample(Isolate* isolate,
 }
 
 void* TryAllocateBackingStore(WasmMemoryTracker* memory_tracker, Heap* heap,
-                              size_t size, void** allocation_base,
+                              size_t size, size_t max_size,
+                              void** allocation_base,
                               size_t* allocation_length) {
   using AllocationStatus = WasmMemoryTracker::AllocationStatus;
+  DCHECK_LE(size, max_size);
 #if V8_TARGET_ARCH_64_BIT
   bool require_full_guard_regions = true;
+  // Without full guard regions, reserve the address space for the maximum
+  // size, so that the memory never has to be copied when it grows.
+  size_t reservation_size = max_size;
 #else
   bool require_full_guard_regions = false;
+  size_t reservation_size = size;
 #endif
   // Let the WasmMemoryTracker know we are going to reserve a bunch of
   // address space.
@@ -54,9 +60,11 @@ void* TryAllocateBackingStore(WasmMemoryTracker* memory_tracker, Heap* heap,
     *allocation_length =
         require_full_guard_regions
             ? RoundUp(kWasmMaxHeapOffset + kNegativeGuardSize, CommitPageSize())
-            : RoundUp(base::bits::RoundUpToPowerOfTwo32(
-                          static_cast<uint32_t>(size)),
-                      kWasmPageSize);
+            : reservation_size > size
+                  ? RoundUp(reservation_size, kWasmPageSize)
+                  : RoundUp(base::bits::RoundUpToPowerOfTwo32(
+                                static_cast<uint32_t>(size)),
+                            kWasmPageSize);
     DCHECK_GE(*allocation_length, size);
     DCHECK_GE(*allocation_length, kWasmPageSize);
 
@@ -74,6 +82,13 @@ void* TryAllocateBackingStore(WasmMemoryTracker* memory_tracker, Heap* heap,
         --trial;  // one more try.
         continue;
       }
+      // If we fail to reserve the maximum size, then retry with the initial
+      // size. Growing the memory may copy it then.
+      if (!require_full_guard_regions && reservation_size > size) {
+        reservation_size = size;
+        --trial;  // one more try.
+        continue;
+      }
 
       // We are over the address space limit. Fail.
       //
@@ -157,7 +172,7 @@ WasmMemoryTracker::~WasmMemoryTracker() {
 void* WasmMemoryTracker::TryAllocateBackingStoreForTesting(
     Heap* heap, size_t size, void** allocation_base,
     size_t* allocation_length) {
-  return TryAllocateBackingStore(this, heap, size, allocation_base,
+  return TryAllocateBackingStore(this, heap, size, size, allocation_base,
                                  allocation_length);
 }
 
@@ -292,8 +307,14 @@ Handle<JSArrayBuffer> SetupArrayBuffer(Isolate* isolate, void* backing_store,
 
 MaybeHandle<JSArrayBuffer> NewArrayBuffer(Isolate* isolate, size_t size,
                                           SharedFlag shared) {
+  return NewArrayBuffer(isolate, size, size, shared);
+}
+
+MaybeHandle<JSArrayBuffer> NewArrayBuffer(Isolate* isolate, size_t size,
+                                          size_t max_size, SharedFlag shared) {
   // Enforce flag-limited maximum allocation size.
   if (size > max_mem_bytes()) return {};
+  max_size = std::max(size, std::min<size_t>(max_size, max_mem_bytes()));
 
   WasmMemoryTracker* memory_tracker = isolate->wasm_engine()->memory_tracker();
 
@@ -301,8 +322,9 @@ MaybeHandle<JSArrayBuffer> NewArrayBuffer(Isolate* isolate, size_t size,
   void* allocation_base = nullptr;
   size_t allocation_length = 0;
 
-  void* memory = TryAllocateBackingStore(memory_tracker, isolate->heap(), size,
-                                         &allocation_base, &allocation_length);
+  void* memory =
+      TryAllocateBackingStore(memory_tracker, isolate->heap(), size, max_size,
+                              &allocation_base, &allocation_length);
   if (memory == nullptr) return {};
 
 #if DEBUG
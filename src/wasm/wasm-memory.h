@@ -145,6 +145,12 @@ class WasmMemoryTracker {
 MaybeHandle<JSArrayBuffer> NewArrayBuffer(
     Isolate*, size_t size, SharedFlag shared = SharedFlag::kNotShared);
 
+// Like above, but if the buffer cannot have guard regions, address space for
+// {max_size} bytes is reserved if possible, such that the buffer can grow in
+// place up to that size.
+MaybeHandle<JSArrayBuffer> NewArrayBuffer(Isolate*, size_t size,
+                                          size_t max_size, SharedFlag shared);
+
 Handle<JSArrayBuffer> SetupArrayBuffer(
     Isolate*, void* backing_store, size_t size, bool is_external,
     SharedFlag shared = SharedFlag::kNotShared);
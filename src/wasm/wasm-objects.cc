@@ -901,7 +901,7 @@ void WasmTableObject::ClearDispatchTables(Isolate* isolate,
 namespace {
 MaybeHandle<JSArrayBuffer> MemoryGrowBuffer(Isolate* isolate,
                                             Handle<JSArrayBuffer> old_buffer,
-                                            size_t new_size) {
+                                            size_t new_size, size_t max_size) {
   CHECK_EQ(0, new_size % wasm::kWasmPageSize);
   size_t old_size = old_buffer->byte_length();
   void* old_mem_start = old_buffer->backing_store();
@@ -910,16 +910,17 @@ MaybeHandle<JSArrayBuffer> MemoryGrowBuffer(Isolate* isolate,
   // lead to Blink not knowing about the other reference to the buffer and
   // freeing it too early.
   if (!old_buffer->is_external() &&
-      ((new_size < old_buffer->allocation_length()) || old_size == new_size)) {
+      ((new_size <= old_buffer->allocation_length()) || old_size == new_size)) {
     if (old_size != new_size) {
       DCHECK_NOT_NULL(old_buffer->backing_store());
-      // If adjusting permissions fails, propagate error back to return
-      // failure to grow.
-      if (!i::SetPermissions(GetPlatformPageAllocator(), old_mem_start,
-                             new_size, PageAllocator::kReadWrite)) {
+      DCHECK_GE(new_size, old_size);
+      // Only the newly added pages need to be made accessible. If adjusting
+      // permissions fails, propagate error back to return failure to grow.
+      if (!i::SetPermissions(GetPlatformPageAllocator(),
+                             reinterpret_cast<byte*>(old_mem_start) + old_size,
+                             new_size - old_size, PageAllocator::kReadWrite)) {
         return {};
       }
-      DCHECK_GE(new_size, old_size);
       reinterpret_cast<v8::Isolate*>(isolate)
           ->AdjustAmountOfExternalAllocatedMemory(new_size - old_size);
     }
@@ -936,7 +937,9 @@ MaybeHandle<JSArrayBuffer> MemoryGrowBuffer(Isolate* isolate,
     // We couldn't reuse the old backing store, so create a new one and copy the
     // old contents in.
     Handle<JSArrayBuffer> new_buffer;
-    if (!wasm::NewArrayBuffer(isolate, new_size).ToHandle(&new_buffer)) {
+    if (!wasm::NewArrayBuffer(isolate, new_size, max_size,
+                              SharedFlag::kNotShared)
+             .ToHandle(&new_buffer)) {
       return {};
     }
     wasm::WasmMemoryTracker* const memory_tracker =
@@ -1070,7 +1073,9 @@ int32_t WasmMemoryObject::Grow(Isolate* isolate,
 
   // Grow the buffer.
   Handle<JSArrayBuffer> new_buffer;
-  if (!MemoryGrowBuffer(isolate, old_buffer, new_size).ToHandle(&new_buffer)) {
+  size_t max_size = static_cast<size_t>(maximum_pages) * wasm::kWasmPageSize;
+  if (!MemoryGrowBuffer(isolate, old_buffer, new_size, max_size)
+           .ToHandle(&new_buffer)) {
     return -1;
   }
 
@@ -126,6 +126,11 @@ void WriteVersion(Writer* writer) {
   writer->Write(FlagList::Hash());
 }
 
+// The version is followed by the size of the wire bytes the module was
+// compiled from, which allows to reject a cached module without decoding the
+// wire bytes, or before all of them have been received.
+constexpr size_t kPrefixSize = kVersionSize + sizeof(uint32_t);
+
 // On Intel, call sites are encoded as a displacement. For linking and for
 // serialization/deserialization, we want to store/retrieve a tag (the function
 // index). On Intel, that means accessing the raw displacement.
@@ -424,21 +429,31 @@ bool NativeModuleSerializer::Write(Writer* writer) {
 }
 
 WasmSerializer::WasmSerializer(NativeModule* native_module)
-    : native_module_(native_module),
-      code_table_(native_module->SnapshotCodeTable()) {}
+    : native_module_(native_module) {
+  // Code whose relocation was deferred is not in the code table yet.
+  std::vector<WasmCode*> deferred_code = native_module->TakeAllDeferredCode();
+  if (!deferred_code.empty()) {
+    NativeModuleModificationScope modification_scope(native_module);
+    for (WasmCode* code : deferred_code) {
+      PublishDeserializedCode(native_module, code);
+    }
+  }
+  code_table_ = native_module->SnapshotCodeTable();
+}
 
 size_t WasmSerializer::GetSerializedNativeModuleSize() const {
   NativeModuleSerializer serializer(native_module_, VectorOf(code_table_));
-  return kVersionSize + serializer.Measure();
+  return kPrefixSize + serializer.Measure();
 }
 
 bool WasmSerializer::SerializeNativeModule(Vector<byte> buffer) const {
   NativeModuleSerializer serializer(native_module_, VectorOf(code_table_));
-  size_t measured_size = kVersionSize + serializer.Measure();
+  size_t measured_size = kPrefixSize + serializer.Measure();
   if (buffer.size() < measured_size) return false;
 
   Writer writer(buffer);
   WriteVersion(&writer);
+  writer.Write(static_cast<uint32_t>(native_module_->wire_bytes().size()));
 
   if (!serializer.Write(&writer)) return false;
   DCHECK_EQ(measured_size, writer.bytes_written());
@@ -518,6 +533,15 @@ bool NativeModuleDeserializer::ReadCode(uint32_t fn_index, Reader* reader) {
       unpadded_binary_size, std::move(protected_instructions),
       std::move(reloc_info), std::move(source_pos), tier);
 
+  if (FLAG_wasm_lazy_relocation) {
+    native_module_->DeferPublishing(code);
+  } else {
+    PublishDeserializedCode(native_module_, code);
+  }
+  return true;
+}
+
+void PublishDeserializedCode(NativeModule* native_module, WasmCode* code) {
   // Relocate the code.
   int mask = RelocInfo::ModeMask(RelocInfo::WASM_CALL) |
              RelocInfo::ModeMask(RelocInfo::WASM_STUB_CALL) |
@@ -531,7 +555,7 @@ bool NativeModuleDeserializer::ReadCode(uint32_t fn_index, Reader* reader) {
     switch (mode) {
       case RelocInfo::WASM_CALL: {
         uint32_t tag = GetWasmCalleeTag(iter.rinfo());
-        Address target = native_module_->GetCallTargetForFunction(tag);
+        Address target = native_module->GetCallTargetForFunction(tag);
         iter.rinfo()->set_wasm_call_address(target, SKIP_ICACHE_FLUSH);
         break;
       }
@@ -539,7 +563,7 @@ bool NativeModuleDeserializer::ReadCode(uint32_t fn_index, Reader* reader) {
         uint32_t tag = GetWasmCalleeTag(iter.rinfo());
         DCHECK_LT(tag, WasmCode::kRuntimeStubCount);
         Address target =
-            native_module_
+            native_module
                 ->runtime_stub(static_cast<WasmCode::RuntimeStubId>(tag))
                 ->instruction_start();
         iter.rinfo()->set_wasm_stub_call_address(target, SKIP_ICACHE_FLUSH);
@@ -567,11 +591,10 @@ bool NativeModuleDeserializer::ReadCode(uint32_t fn_index, Reader* reader) {
   if (FLAG_print_code || FLAG_print_wasm_code) code->Print();
   code->Validate();
 
-  // Finally, flush the icache for that code.
+  // Flush the icache for that code before making it callable.
   Assembler::FlushICache(code->instructions().start(),
                          code->instructions().size());
-
-  return true;
+  native_module->PublishCode(code);
 }
 
 bool IsSupportedVersion(Vector<const byte> version) {
@@ -582,11 +605,18 @@ bool IsSupportedVersion(Vector<const byte> version) {
   return memcmp(version.start(), current_version, kVersionSize) == 0;
 }
 
+size_t GetSerializedWireBytesSize(Vector<const byte> data) {
+  if (data.size() < kPrefixSize) return 0;
+  Reader reader(data + kVersionSize);
+  return reader.Read<uint32_t>();
+}
+
 MaybeHandle<WasmModuleObject> DeserializeNativeModule(
     Isolate* isolate, Vector<const byte> data,
     Vector<const byte> wire_bytes_vec) {
   if (!IsWasmCodegenAllowed(isolate, isolate->native_context())) return {};
   if (!IsSupportedVersion(data)) return {};
+  if (GetSerializedWireBytesSize(data) != wire_bytes_vec.size()) return {};
 
   ModuleWireBytes wire_bytes(wire_bytes_vec);
   // TODO(titzer): module features should be part of the serialization format.
@@ -608,12 +638,13 @@ MaybeHandle<WasmModuleObject> DeserializeNativeModule(
       std::move(wire_bytes_copy), script, Handle<ByteArray>::null());
   NativeModule* native_module = module_object->native_module();
 
-  if (FLAG_wasm_lazy_compilation) {
-    native_module->SetLazyBuiltin(BUILTIN_CODE(isolate, WasmCompileLazy));
-  }
+  // Functions without serialized code (e.g. because they were compiled lazily
+  // or not compiled yet when serializing) get compiled on their first call,
+  // and deferred code gets relocated on its first call.
+  native_module->SetLazyBuiltin(BUILTIN_CODE(isolate, WasmCompileLazy));
   NativeModuleDeserializer deserializer(native_module);
 
-  Reader reader(data + kVersionSize);
+  Reader reader(data + kPrefixSize);
   if (!deserializer.Read(&reader)) return {};
 
   CompileJsToWasmWrappers(isolate, native_module->module(),
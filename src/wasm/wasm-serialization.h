@@ -30,10 +30,19 @@ class WasmSerializer {
   std::vector<WasmCode*> code_table_;
 };
 
+// Relocates code of a deserialized module and publishes it in the code table
+// of {native_module}. With {FLAG_wasm_lazy_relocation}, this is deferred until
+// the first call of the function.
+void PublishDeserializedCode(NativeModule* native_module, WasmCode* code);
+
 // Support for deserializing WebAssembly {NativeModule} objects.
 // Checks the version header of the data against the current version.
 bool IsSupportedVersion(Vector<const byte> data);
 
+// Returns the size of the wire bytes that the module serialized in {data} was
+// compiled from, or 0 if {data} is too short to tell.
+size_t GetSerializedWireBytesSize(Vector<const byte> data);
+
 // Deserializes the given data to create a Wasm module object.
 MaybeHandle<WasmModuleObject> DeserializeNativeModule(
     Isolate* isolate, Vector<const byte> data, Vector<const byte> wire_bytes);
@@ -11,11 +11,13 @@
 #endif
 
 #include "src/allocation.h"
+#include "src/base/bits.h"
 
 namespace v8 {
 namespace internal {
 
-AccountingAllocator::AccountingAllocator() : unused_segments_mutex_() {
+AccountingAllocator::AccountingAllocator()
+    : unused_segments_mutex_("AccountingAllocator::unused_segments_mutex") {
   static const size_t kDefaultBucketMaxSize = 5;
 
   memory_pressure_level_.SetValue(MemoryPressureLevel::kNone);
@@ -64,7 +66,7 @@ void AccountingAllocator::ConfigureSegmentPool(const size_t max_pool_size) {
     if (total_size + (size_t(1) << (power + kMinSegmentSizePower)) <=
         max_pool_size) {
       unused_segments_max_sizes_[power] = fits_fully + 1;
-      total_size += size_t(1) << power;
+      total_size += size_t(1) << (power + kMinSegmentSizePower);
     } else {
       unused_segments_max_sizes_[power] = fits_fully;
     }
@@ -72,6 +74,14 @@ void AccountingAllocator::ConfigureSegmentPool(const size_t max_pool_size) {
 }
 
 Segment* AccountingAllocator::GetSegment(size_t bytes) {
+  // Segments that fit into the pool are allocated with the full size of their
+  // size class, so that they can serve any later request of that class once
+  // they are returned. Zones use all of a segment's size.
+  if (bytes <= (size_t(1) << kMaxSegmentSizePower) &&
+      memory_pressure_level_.Value() == MemoryPressureLevel::kNone) {
+    bytes = std::max(base::bits::RoundUpToPowerOfTwo(bytes),
+                     size_t(1) << kMinSegmentSizePower);
+  }
   Segment* result = GetSegmentFromPool(bytes);
   if (result == nullptr) {
     result = AllocateSegment(bytes);
@@ -196,10 +206,13 @@ void AccountingAllocator::ClearPool() {
     Segment* current = unused_segments_heads_[power];
     while (current) {
       Segment* next = current->next();
+      base::Relaxed_AtomicIncrement(
+          &current_pool_size_, -static_cast<base::AtomicWord>(current->size()));
       FreeSegment(current);
       current = next;
     }
     unused_segments_heads_[power] = nullptr;
+    unused_segments_sizes_[power] = 0;
   }
 }
 
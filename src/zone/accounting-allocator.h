@@ -37,11 +37,11 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
 
   size_t GetCurrentPoolSize() const;
 
+  // Releases all pooled segments and stops pooling until the level is back
+  // to kNone.
   void MemoryPressureNotification(MemoryPressureLevel level);
   // Configures the zone segment pool size limits so the pool does not
   // grow bigger than max_pool_size.
-  // TODO(heimbuef): Do not accept segments to pool that are larger than
-  // their size class requires. Sometimes the zones generate weird segments.
   void ConfigureSegmentPool(const size_t max_pool_size);
 
   virtual void ZoneCreation(const Zone* zone) {}
@@ -49,6 +49,7 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
 
  private:
   FRIEND_TEST(Zone, SegmentPoolConstraints);
+  FRIEND_TEST(Zone, SegmentPoolReuse);
 
   static const size_t kMinSegmentSizePower = 13;
   static const size_t kMaxSegmentSizePower = 18;
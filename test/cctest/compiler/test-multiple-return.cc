@@ -18,6 +18,7 @@
 #include "src/objects-inl.h"
 #include "src/wasm/function-compiler.h"
 #include "src/wasm/wasm-engine.h"
+#include "src/wasm/wasm-linkage.h"
 #include "src/wasm/wasm-objects-inl.h"
 #include "src/wasm/wasm-opcodes.h"
 #include "test/cctest/cctest.h"
@@ -44,6 +45,13 @@ CallDescriptor* CreateCallDescriptor(Zone* zone, int return_count,
   return compiler::GetWasmCallDescriptor(zone, builder.Build());
 }
 
+// The number of values of {type} the wasm linkage returns in registers.
+int NumReturnRegisters(MachineType type) {
+  return IsFloatingPoint(type.representation())
+             ? static_cast<int>(arraysize(wasm::kFpReturnRegisters))
+             : static_cast<int>(arraysize(wasm::kGpReturnRegisters));
+}
+
 Node* MakeConstant(RawMachineAssembler& m, MachineType type, int value) {
   switch (type.representation()) {
     case MachineRepresentation::kWord32:
@@ -245,9 +253,7 @@ void ReturnLastValue(MachineType type) {
   for (auto slot_count : slot_counts) {
     v8::internal::AccountingAllocator allocator;
     Zone zone(&allocator, ZONE_NAME);
-    // The wasm-linkage provides 2 return registers at the moment, on all
-    // platforms.
-    const int return_count = 2 + slot_count;
+    const int return_count = NumReturnRegisters(type) + slot_count;
 
     CallDescriptor* desc = CreateCallDescriptor(&zone, return_count, 0, type);
 
@@ -306,9 +312,8 @@ void ReturnSumOfReturns(MachineType type) {
     v8::internal::AccountingAllocator allocator;
     Zone zone(&allocator, ZONE_NAME);
     // Let {unused_stack_slots + 1} returns be on the stack.
-    // The wasm-linkage provides 2 return registers at the moment, on all
-    // platforms.
-    const int return_count = 2 + unused_stack_slots + 1;
+    const int return_count =
+        NumReturnRegisters(type) + unused_stack_slots + 1;
 
     CallDescriptor* desc = CreateCallDescriptor(&zone, return_count, 0, type);
 
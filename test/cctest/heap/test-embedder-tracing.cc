@@ -2,8 +2,11 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <map>
+
 #include "include/v8.h"
 #include "src/api-inl.h"
+#include "src/base/platform/mutex.h"
 #include "src/objects-inl.h"
 #include "src/objects/module.h"
 #include "src/objects/script.h"
@@ -93,6 +96,51 @@ class TemporaryEmbedderHeapTracerScope {
   v8::Isolate* const isolate_;
 };
 
+// Accepts wrappers from concurrent marking threads and counts how many were
+// reported from where.
+class ConcurrentRegistrationHeapTracer final : public v8::EmbedderHeapTracer {
+ public:
+  void RegisterV8References(
+      const std::vector<std::pair<void*, void*>>& embedder_fields) final {
+    base::MutexGuard guard(&mutex_);
+    Register(embedder_fields);
+  }
+
+  bool SupportsConcurrentRegistration() final { return true; }
+
+  void RegisterV8ReferencesConcurrently(
+      const std::vector<std::pair<void*, void*>>& embedder_fields) final {
+    base::MutexGuard guard(&mutex_);
+    concurrently_registered_ += embedder_fields.size();
+    Register(embedder_fields);
+  }
+
+  bool AdvanceTracing(double deadline_in_ms) final { return true; }
+  bool IsTracingDone() final { return true; }
+  void TracePrologue() final {}
+  void TraceEpilogue() final {}
+  void EnterFinalPause(EmbedderStackState) final {}
+
+  size_t NumberOfRegisteredFields(void* second_field) {
+    base::MutexGuard guard(&mutex_);
+    return registered_[second_field];
+  }
+
+  size_t concurrently_registered() {
+    base::MutexGuard guard(&mutex_);
+    return concurrently_registered_;
+  }
+
+ private:
+  void Register(const std::vector<std::pair<void*, void*>>& embedder_fields) {
+    for (auto pair : embedder_fields) registered_[pair.second]++;
+  }
+
+  base::Mutex mutex_;
+  std::map<void*, size_t> registered_;
+  size_t concurrently_registered_ = 0;
+};
+
 }  // namespace
 
 TEST(V8RegisteringEmbedderReference) {
@@ -115,6 +163,34 @@ TEST(V8RegisteringEmbedderReference) {
   CHECK(tracer.IsRegisteredFromV8(first_field));
 }
 
+TEST(V8RegisteringEmbedderReferencesConcurrently) {
+  // Tests that all wrappers are registered when concurrent markers may report
+  // them themselves.
+  ManualGCScope manual_gc;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  ConcurrentRegistrationHeapTracer tracer;
+  TemporaryEmbedderHeapTracerScope tracer_scope(isolate, &tracer);
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Context> context = v8::Context::New(isolate);
+  v8::Context::Scope context_scope(context);
+
+  const int kWrappers = 5000;
+  void* first_field = reinterpret_cast<void*>(0x2);
+  void* second_field = reinterpret_cast<void*>(0x4);
+  v8::Local<v8::Array> wrappers = v8::Array::New(isolate, kWrappers);
+  for (int i = 0; i < kWrappers; i++) {
+    wrappers->Set(context, i,
+                  ConstructTraceableJSApiObject(context, first_field,
+                                                second_field))
+        .FromJust();
+  }
+  CcTest::CollectGarbage(i::OLD_SPACE);
+  CHECK_LE(static_cast<size_t>(kWrappers),
+           tracer.NumberOfRegisteredFields(second_field));
+  if (!FLAG_concurrent_marking) CHECK_EQ(0u, tracer.concurrently_registered());
+}
+
 TEST(EmbedderRegisteringV8Reference) {
   // Tests that references that are registered by the embedder heap tracer are
   // considered live by V8.
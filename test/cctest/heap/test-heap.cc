@@ -1337,6 +1337,60 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+TEST(TestBytecodeFlushingOldAge) {
+#ifndef V8_LITE_MODE
+  FLAG_opt = false;
+  FLAG_always_opt = false;
+  i::FLAG_optimize_for_size = false;
+#endif  // V8_LITE_MODE
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_bytecode_old_age = 1;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Factory* factory = i_isolate->factory();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo() {"
+        "  var x = 42;"
+        "  var y = 42;"
+        "  var z = x + y;"
+        "};"
+        "foo()";
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+
+    {
+      v8::HandleScope scope(isolate);
+      CompileRun(source);
+    }
+
+    Handle<Object> func_value =
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked();
+    CHECK(func_value->IsJSFunction());
+    Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+    CHECK(function->shared()->is_compiled());
+    CHECK_EQ(BytecodeArray::kQuadragenarianBytecodeAge,
+             BytecodeArray::OldBytecodeAge());
+
+    // With the lowest age threshold, a few GCs are enough to flush foo.
+    const int kAgingThreshold = 3;
+    for (int i = 0; i < kAgingThreshold; i++) {
+      CcTest::CollectAllGarbage();
+    }
+    CHECK(!function->shared()->is_compiled());
+
+    // Call foo to get it recompiled.
+    CompileRun("foo()");
+    CHECK(function->shared()->is_compiled());
+    CHECK(function->is_compiled());
+  }
+}
+
 #ifndef V8_LITE_MODE
 
 TEST(TestOptimizeAfterBytecodeFlushingCandidate) {
@@ -1531,6 +1585,55 @@ TEST(CompilationCacheCachingBehavior) {
   }
 }
 
+TEST(CompilationCacheScriptBudget) {
+  if (!FLAG_compilation_cache) return;
+  FLAG_compilation_cache_script_budget = 1024;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  CompilationCache* compilation_cache = isolate->compilation_cache();
+  LanguageMode language_mode = construct_language_mode(FLAG_use_strict);
+
+  v8::HandleScope scope(CcTest::isolate());
+  const char* raw_source = "function foo() { return 42; }; foo();";
+  Handle<String> source = factory->InternalizeUtf8String(raw_source);
+  Handle<Context> native_context = isolate->native_context();
+
+  {
+    v8::HandleScope scope(CcTest::isolate());
+    CompileRun(raw_source);
+  }
+
+  // Make the bytecode old. A script within the budget survives the GC and
+  // has its bytecode age reset.
+  {
+    v8::HandleScope scope(CcTest::isolate());
+    MaybeHandle<SharedFunctionInfo> cached_script =
+        compilation_cache->LookupScript(source, Handle<Object>(), 0, 0,
+                                        v8::ScriptOriginOptions(true, false),
+                                        native_context, language_mode);
+    Handle<SharedFunctionInfo> shared = cached_script.ToHandleChecked();
+    CHECK(shared->HasBytecodeArray());
+    const int kAgingThreshold = 6;
+    for (int i = 0; i < kAgingThreshold; i++) {
+      shared->GetBytecodeArray()->MakeOlder();
+    }
+  }
+
+  CcTest::CollectAllGarbage();
+
+  {
+    v8::HandleScope scope(CcTest::isolate());
+    MaybeHandle<SharedFunctionInfo> cached_script =
+        compilation_cache->LookupScript(source, Handle<Object>(), 0, 0,
+                                        v8::ScriptOriginOptions(true, false),
+                                        native_context, language_mode);
+    Handle<SharedFunctionInfo> shared = cached_script.ToHandleChecked();
+    CHECK(shared->HasBytecodeArray());
+    CHECK(!shared->GetBytecodeArray()->IsOld());
+  }
+}
+
 
 static void OptimizeEmptyFunction(const char* name) {
   HandleScope scope(CcTest::i_isolate());
@@ -4874,6 +4977,25 @@ HEAP_TEST(NumberStringCacheSize) {
            heap->number_string_cache()->length());
 }
 
+TEST(NumberStringCacheGrowsOnEvictions) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+  int initial_length = heap->number_string_cache()->length();
+  Handle<String> last;
+  for (int i = 0; i < 4 * initial_length; i++) {
+    last = factory->NumberToString(Smi::FromInt(i));
+  }
+  int length = heap->number_string_cache()->length();
+  CHECK_LT(initial_length, length);
+  CHECK_LE(length, heap->MaxNumberToStringCacheSize());
+  // Entries are kept when the cache grows.
+  CHECK(last.is_identical_to(
+      factory->NumberToString(Smi::FromInt(4 * initial_length - 1))));
+}
+
 
 TEST(Regress3877) {
   CcTest::InitializeVM();
@@ -5509,6 +5631,35 @@ Handle<FixedArray> ShrinkArrayAndCheckSize(Heap* heap, int length) {
   return array;
 }
 
+TEST(ProgressBarChunkClaiming) {
+  if (!FLAG_use_marking_progress_bar) return;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Isolate* isolate = CcTest::i_isolate();
+  // An array spanning several scanning chunks.
+  const int kLength = 5 * MemoryChunk::kProgressBarScanningChunk / kPointerSize;
+  Handle<FixedArray> array =
+      isolate->factory()->NewFixedArray(kLength, TENURED);
+  MemoryChunk* chunk = MemoryChunk::FromHeapObject(*array);
+  CHECK(chunk->IsFlagSet(MemoryChunk::HAS_PROGRESS_BAR));
+  chunk->ResetProgressBar();
+
+  // Consecutive claims cover the array body without gaps or overlaps.
+  int size = array->Size();
+  int expected_start = FixedArray::kHeaderSize;
+  int start_offset, end_offset;
+  while (chunk->ClaimProgressBarChunk(FixedArray::kHeaderSize, size,
+                                      &start_offset, &end_offset)) {
+    CHECK_EQ(expected_start, start_offset);
+    CHECK_LT(start_offset, end_offset);
+    CHECK_LE(end_offset - start_offset, MemoryChunk::kProgressBarScanningChunk);
+    expected_start = end_offset;
+  }
+  CHECK_EQ(size, expected_start);
+  CHECK_EQ(size, chunk->progress_bar());
+  chunk->ResetProgressBar();
+}
+
 TEST(Regress609761) {
   CcTest::InitializeVM();
   v8::HandleScope scope(CcTest::isolate());
@@ -5905,6 +6056,35 @@ TEST(YoungGenerationLargeObjectAllocationReleaseScavenger) {
   CHECK_EQ(0, isolate->heap()->lo_space()->SizeOfObjects());
 }
 
+TEST(YoungGenerationLargeObjectAllocationCapacity) {
+  if (FLAG_minor_mc) return;
+  FLAG_young_generation_large_objects = true;
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Heap* heap = CcTest::heap();
+  Isolate* isolate = heap->isolate();
+  CcTest::CollectGarbage(NEW_SPACE);
+  CHECK(heap->new_lo_space()->IsEmpty());
+
+  // The first young large object is allocated independent of the capacity.
+  int length = static_cast<int>(heap->new_space()->Capacity() / kPointerSize);
+  Handle<FixedArray> first = isolate->factory()->NewFixedArray(length);
+  MemoryChunk* chunk = MemoryChunk::FromAddress(first->address());
+  CHECK_EQ(NEW_LO_SPACE, chunk->owner()->identity());
+  CHECK_EQ(0, heap->new_lo_space()->Available());
+
+  // The next one exceeds the capacity and triggers a scavenge, which promotes
+  // the first object by moving its page to the old generation.
+  int gc_count = heap->gc_count();
+  Handle<FixedArray> second = isolate->factory()->NewFixedArray(length);
+  CHECK_LT(gc_count, heap->gc_count());
+  chunk = MemoryChunk::FromAddress(first->address());
+  CHECK_EQ(LO_SPACE, chunk->owner()->identity());
+  chunk = MemoryChunk::FromAddress(second->address());
+  CHECK_EQ(NEW_LO_SPACE, chunk->owner()->identity());
+}
+
 TEST(UncommitUnusedLargeObjectMemory) {
   CcTest::InitializeVM();
   v8::HandleScope scope(CcTest::isolate());
@@ -6198,6 +6378,35 @@ UNINITIALIZED_TEST(ReinitializeStringHashSeed) {
   }
 }
 
+UNINITIALIZED_TEST(PretenuringResourceConstraints) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  create_params.constraints.set_pretenuring_ratio(0.5);
+  create_params.constraints.set_pretenuring_minimum_allocations(10);
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    Heap* heap = reinterpret_cast<Isolate*>(isolate)->heap();
+    CHECK_EQ(0.5, heap->pretenuring_ratio());
+    CHECK_EQ(10, heap->pretenuring_minimum_mementos());
+    // Zero keeps the configured values.
+    heap->ConfigurePretenuring(0, 0);
+    CHECK_EQ(0.5, heap->pretenuring_ratio());
+    CHECK_EQ(10, heap->pretenuring_minimum_mementos());
+  }
+  isolate->Dispose();
+
+  v8::Isolate::CreateParams default_params;
+  default_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  isolate = v8::Isolate::New(default_params);
+  {
+    Heap* heap = reinterpret_cast<Isolate*>(isolate)->heap();
+    CHECK_EQ(AllocationSite::kPretenureRatio, heap->pretenuring_ratio());
+    const int kDefaultMinimum = AllocationSite::kPretenureMinimumCreated;
+    CHECK_EQ(kDefaultMinimum, heap->pretenuring_minimum_mementos());
+  }
+  isolate->Dispose();
+}
+
 const int kHeapLimit = 100 * MB;
 Isolate* oom_isolate = nullptr;
 
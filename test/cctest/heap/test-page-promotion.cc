@@ -122,6 +122,37 @@ UNINITIALIZED_TEST(PagePromotion_NewToNew) {
   isolate->Dispose();
 }
 
+#ifdef ENABLE_MINOR_MC
+UNINITIALIZED_TEST(PagePromotion_MinorMCNewToNew) {
+  if (!i::FLAG_page_promotion) return;
+
+  FLAG_minor_mc = true;
+  FLAG_minor_mc_page_promotion_threshold = 0;
+  v8::Isolate* isolate = NewIsolateForPagePromotion();
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    Heap* heap = i_isolate->heap();
+
+    std::vector<Handle<FixedArray>> handles;
+    heap::SimulateFullSpace(heap->new_space(), &handles);
+    CHECK_GT(handles.size(), 0u);
+    Handle<FixedArray> last_object = handles.back();
+    Page* to_be_promoted_page = Page::FromAddress(last_object->address());
+    CHECK(!to_be_promoted_page->Contains(heap->new_space()->age_mark()));
+    CHECK(heap->new_space()->ToSpaceContainsSlow(last_object->address()));
+    // The minor mark compactor moves the page within the young generation
+    // instead of copying its objects.
+    heap->CollectGarbage(NEW_SPACE, i::GarbageCollectionReason::kTesting);
+    CHECK(heap->new_space()->ToSpaceContainsSlow(last_object->address()));
+    CHECK(to_be_promoted_page->Contains(last_object->address()));
+  }
+  isolate->Dispose();
+}
+#endif  // ENABLE_MINOR_MC
+
 UNINITIALIZED_TEST(PagePromotion_NewToNewJSArrayBuffer) {
   if (!i::FLAG_page_promotion) return;
 
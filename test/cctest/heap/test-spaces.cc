@@ -30,6 +30,7 @@
 #include "src/base/bounded-page-allocator.h"
 #include "src/base/platform/platform.h"
 #include "src/heap/factory.h"
+#include "src/heap/page-pool.h"
 #include "src/heap/spaces-inl.h"
 #include "src/objects-inl.h"
 #include "src/snapshot/snapshot.h"
@@ -213,6 +214,84 @@ TEST(MemoryAllocator) {
   delete memory_allocator;
 }
 
+TEST(MemoryAllocatorTransparentHugePages) {
+  FLAG_transparent_huge_pages = true;
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+
+  MemoryAllocator* memory_allocator =
+      new MemoryAllocator(isolate, heap->MaxReserved(), 0);
+  CHECK_NOT_NULL(memory_allocator);
+  TestMemoryAllocatorScope test_scope(isolate, memory_allocator);
+  // The code range, if any, is advised when the allocator is set up.
+  const size_t initial_advised_size = memory_allocator->HugePageAdvisedSize();
+
+  {
+    OldSpace faked_space(heap);
+    Page* page = memory_allocator->AllocatePage(
+        faked_space.AreaSize(), static_cast<PagedSpace*>(&faked_space),
+        NOT_EXECUTABLE);
+    faked_space.memory_chunk_list().PushBack(page);
+    // The kernel may refuse the advice, e.g. when THP support is compiled out.
+    if (page->IsFlagSet(MemoryChunk::HUGE_PAGES_ADVISED)) {
+      CHECK_LE(initial_advised_size + page->size(),
+               memory_allocator->HugePageAdvisedSize());
+    } else {
+      CHECK_EQ(initial_advised_size, memory_allocator->HugePageAdvisedSize());
+    }
+    // OldSpace's destructor will tear down the space and free up all pages.
+  }
+  memory_allocator->unmapper()->FreeQueuedChunks();
+  memory_allocator->unmapper()->EnsureUnmappingCompleted();
+  CHECK_EQ(initial_advised_size, memory_allocator->HugePageAdvisedSize());
+  memory_allocator->TearDown();
+  delete memory_allocator;
+  FLAG_transparent_huge_pages = false;
+}
+
+TEST(MemoryAllocatorPagePool) {
+  FLAG_page_pool_size = 1;
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  if (!PagePool::IsEnabledFor(heap->memory_allocator()->data_page_allocator()))
+    return;
+  PagePool::Get()->ReleaseAll();
+
+  MemoryAllocator* memory_allocator =
+      new MemoryAllocator(isolate, heap->MaxReserved(), 0);
+  CHECK_NOT_NULL(memory_allocator);
+  TestMemoryAllocatorScope test_scope(isolate, memory_allocator);
+
+  {
+    OldSpace faked_space(heap);
+    Page* page = memory_allocator->AllocatePage(
+        faked_space.AreaSize(), static_cast<PagedSpace*>(&faked_space),
+        NOT_EXECUTABLE);
+    Address last_word = page->area_end() - kPointerSize;
+    Memory<Address>(last_word) = static_cast<Address>(kZapValue);
+    memory_allocator->Free<MemoryAllocator::kFull>(page);
+    CHECK_EQ(static_cast<size_t>(Page::kPageSize), PagePool::Get()->Size());
+
+    // The page is handed out again without touching the OS and is zeroed.
+    Page* reused = memory_allocator->AllocatePage(
+        faked_space.AreaSize(), static_cast<PagedSpace*>(&faked_space),
+        NOT_EXECUTABLE);
+    CHECK_EQ(page, reused);
+    CHECK_EQ(0, PagePool::Get()->Size());
+    if (!Heap::ShouldZapGarbage()) {
+      CHECK_EQ(kNullAddress, Memory<Address>(last_word));
+    }
+    faked_space.memory_chunk_list().PushBack(reused);
+  }
+  // The pool has a high-water mark of --page-pool-size.
+  CHECK_LE(PagePool::Get()->Size(), FLAG_page_pool_size * MB);
+  memory_allocator->TearDown();
+  delete memory_allocator;
+  PagePool::Get()->ReleaseAll();
+  CHECK_EQ(0, PagePool::Get()->Size());
+  FLAG_page_pool_size = 0;
+}
+
 TEST(ComputeDiscardMemoryAreas) {
   base::AddressRegion memory_area;
   size_t page_size = MemoryAllocator::GetCommitPageSize();
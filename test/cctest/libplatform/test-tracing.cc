@@ -1,6 +1,7 @@
 // Copyright 2016 the V8 project authors. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
+#include <algorithm>
 #include <limits>
 
 #include "include/libplatform/v8-tracing.h"
@@ -128,6 +129,67 @@ TEST(TestTraceBufferRingBuffer) {
   delete ring_buffer;
 }
 
+namespace {
+
+class TraceEventThread : public base::Thread {
+ public:
+  TraceEventThread(TraceBuffer* buffer, const char* name, size_t count)
+      : base::Thread(base::Thread::Options("TraceEventThread")),
+        buffer_(buffer),
+        name_(name),
+        count_(count) {}
+
+  void Run() override {
+    uint8_t category_enabled_flag = 41;
+    for (size_t i = 0; i < count_; ++i) {
+      uint64_t handle;
+      TraceObject* trace_object = buffer_->AddTraceEvent(&handle);
+      CHECK_NOT_NULL(trace_object);
+      trace_object->Initialize('X', &category_enabled_flag, name_,
+                               "Test.Scope", 42, 123, 0, nullptr, nullptr,
+                               nullptr, nullptr, 0, 1729, 4104);
+      trace_object = buffer_->GetEventByHandle(handle);
+      CHECK_NOT_NULL(trace_object);
+      CHECK_EQ(name_, trace_object->name());
+    }
+  }
+
+ private:
+  TraceBuffer* buffer_;
+  const char* name_;
+  size_t count_;
+};
+
+}  // namespace
+
+TEST(TestTraceBufferRingBufferMultipleThreads) {
+  const size_t kThreads = 4;
+  const size_t kEventsPerThread = TraceBufferChunk::kChunkSize * 4 + 3;
+  const char* names[kThreads] = {"Thread0", "Thread1", "Thread2", "Thread3"};
+  MockTraceWriter* writer = new MockTraceWriter();
+  // Large enough for all events, so that no chunk gets recycled.
+  TraceBuffer* ring_buffer = TraceBuffer::CreateTraceBufferRingBuffer(
+      kThreads * (kEventsPerThread / TraceBufferChunk::kChunkSize + 1), writer);
+
+  std::vector<std::unique_ptr<TraceEventThread>> threads;
+  for (size_t i = 0; i < kThreads; ++i) {
+    threads.emplace_back(
+        new TraceEventThread(ring_buffer, names[i], kEventsPerThread));
+  }
+  for (auto& thread : threads) thread->Start();
+  for (auto& thread : threads) thread->Join();
+
+  ring_buffer->Flush();
+  auto events = writer->events();
+  CHECK_EQ(kThreads * kEventsPerThread, events.size());
+  for (size_t i = 0; i < kThreads; ++i) {
+    CHECK_EQ(kEventsPerThread,
+             static_cast<size_t>(
+                 std::count(events.begin(), events.end(), names[i])));
+  }
+  delete ring_buffer;
+}
+
 void PopulateJSONWriter(TraceWriter* writer) {
   v8::Platform* old_platform = i::V8::GetCurrentPlatform();
   std::unique_ptr<v8::Platform> default_platform(
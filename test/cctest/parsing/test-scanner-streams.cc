@@ -364,6 +364,38 @@ TEST(Utf8ChunkBoundaries) {
   }
 }
 
+TEST(Utf8LongAsciiRuns) {
+  // ASCII runs of every length up to a few words, each followed by a
+  // two-byte and a four-byte character, so that the ASCII fast path starts and
+  // stops at every possible alignment.
+  std::vector<uint8_t> utf8;
+  std::vector<uint16_t> utf16;
+  for (int run = 0; run < 40; run++) {
+    for (int i = 0; i < run; i++) {
+      utf8.push_back('a' + i % 26);
+      utf16.push_back('a' + i % 26);
+    }
+    // U+00E4 and U+1F600.
+    const uint8_t kMultiByte[] = {0xC3, 0xA4, 0xF0, 0x9F, 0x98, 0x80};
+    utf8.insert(utf8.end(), kMultiByte, kMultiByte + arraysize(kMultiByte));
+    utf16.push_back(0x00E4);
+    utf16.push_back(0xD83D);
+    utf16.push_back(0xDE00);
+  }
+
+  for (bool extra_chunky : {false, true}) {
+    ChunkSource chunk_source(utf8.data(), 1, utf8.size(), extra_chunky);
+    std::unique_ptr<v8::internal::Utf16CharacterStream> stream(
+        v8::internal::ScannerStream::For(
+            &chunk_source, v8::ScriptCompiler::StreamedSource::UTF8));
+    for (uint16_t c : utf16) {
+      CHECK_EQ(c, stream->Advance());
+    }
+    CHECK_EQ(v8::internal::Utf16CharacterStream::kEndOfInput,
+             stream->Advance());
+  }
+}
+
 TEST(Utf8SingleByteChunks) {
   // Have each byte as a single-byte chunk.
   size_t len = strlen(unicode_utf8);
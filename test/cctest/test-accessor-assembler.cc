@@ -26,17 +26,20 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
   const int kNumParams = 2;
   CodeAssemblerTester data(isolate, kNumParams);
   AccessorAssembler m(data.state());
+  StubCache* stub_cache = isolate->load_stub_cache();
 
   {
     Node* name = m.Parameter(0);
     Node* map = m.Parameter(1);
-    Node* primary_offset = m.StubCachePrimaryOffsetForTesting(name, map);
+    Node* primary_offset =
+        m.StubCachePrimaryOffsetForTesting(stub_cache, name, map);
     Node* result;
     if (table == StubCache::kPrimary) {
       result = primary_offset;
     } else {
       CHECK_EQ(StubCache::kSecondary, table);
-      result = m.StubCacheSecondaryOffsetForTesting(name, primary_offset);
+      result = m.StubCacheSecondaryOffsetForTesting(stub_cache, name,
+                                                    primary_offset);
     }
     m.Return(m.SmiTag(result));
   }
@@ -79,12 +82,12 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
 
       int expected_result;
       {
-        int primary_offset = StubCache::PrimaryOffsetForTesting(*name, *map);
+        int primary_offset = stub_cache->PrimaryOffsetForTesting(*name, *map);
         if (table == StubCache::kPrimary) {
           expected_result = primary_offset;
         } else {
           expected_result =
-              StubCache::SecondaryOffsetForTesting(*name, primary_offset);
+              stub_cache->SecondaryOffsetForTesting(*name, primary_offset);
         }
       }
       Handle<Object> result = ft.Call(name, map).ToHandleChecked();
@@ -258,5 +261,62 @@ TEST(TryProbeStubCache) {
   CHECK(queried_existing && queried_non_existing);
 }
 
+TEST(StubCacheAdaptiveSize) {
+  FLAG_stub_cache_adaptive_size = true;
+  Isolate* isolate(CcTest::InitIsolateOnce());
+  HandleScope scope(isolate);
+  Factory* factory = isolate->factory();
+
+  StubCache stub_cache(isolate);
+  stub_cache.Clear();
+  CHECK_EQ(StubCache::kPrimaryTableSize,
+           stub_cache.table_size(StubCache::kPrimary));
+  CHECK_EQ(StubCache::kSecondaryTableSize,
+           stub_cache.table_size(StubCache::kSecondary));
+
+  Handle<Name> name = factory->InternalizeUtf8String("name");
+  Handle<Code> handler = CreateCodeOfKind(Code::STUB);
+  std::vector<Handle<Map>> maps;
+  for (int i = 0; i < 4 * StubCache::kPrimaryTableSize; i++) {
+    maps.push_back(Map::Create(isolate, 0));
+  }
+
+  // A small working set does not make the cache grow.
+  {
+    DisallowHeapAllocation no_gc;
+    for (int i = 0; i < 8; i++) {
+      stub_cache.Set(*name, *maps[i], MaybeObject::FromObject(*handler));
+    }
+  }
+  stub_cache.Clear();
+  CHECK_EQ(StubCache::kPrimaryTableSize,
+           stub_cache.table_size(StubCache::kPrimary));
+
+  // Far more (map, name) pairs than the cache can hold evict live entries and
+  // make the next Clear() grow both tables.
+  {
+    DisallowHeapAllocation no_gc;
+    for (Handle<Map> map : maps) {
+      stub_cache.Set(*name, *map, MaybeObject::FromObject(*handler));
+    }
+    CHECK_LT(StubCache::kSecondaryTableSize,
+             stub_cache.evictions_since_clear());
+  }
+  stub_cache.Clear();
+  CHECK_EQ(2 * StubCache::kPrimaryTableSize,
+           stub_cache.table_size(StubCache::kPrimary));
+  CHECK_EQ(2 * StubCache::kSecondaryTableSize,
+           stub_cache.table_size(StubCache::kSecondary));
+  CHECK_EQ(0, stub_cache.evictions_since_clear());
+
+  // The grown cache is still consistent.
+  {
+    DisallowHeapAllocation no_gc;
+    stub_cache.Set(*name, *maps[0], MaybeObject::FromObject(*handler));
+    CHECK_EQ(MaybeObject::FromObject(*handler).ptr(),
+             stub_cache.Get(*name, *maps[0]).ptr());
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
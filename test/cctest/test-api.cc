@@ -37,6 +37,7 @@
 #include <unistd.h>  // NOLINT
 #endif
 
+#include "include/v8-fast-api-calls.h"
 #include "include/v8-util.h"
 #include "src/api-inl.h"
 #include "src/arguments.h"
@@ -48,6 +49,7 @@
 #include "src/global-handles.h"
 #include "src/heap/incremental-marking.h"
 #include "src/heap/local-allocator.h"
+#include "src/ic/ic.h"
 #include "src/lookup.h"
 #include "src/objects-inl.h"
 #include "src/objects/hash-table-inl.h"
@@ -2722,6 +2724,38 @@ THREADED_TEST(InternalFields) {
   CHECK_EQ(17, obj->GetInternalField(0)->Int32Value(env.local()).FromJust());
 }
 
+TEST(InstanceTemplateDataPropertiesInObject) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  Local<v8::FunctionTemplate> templ = v8::FunctionTemplate::New(isolate);
+  Local<v8::ObjectTemplate> instance_templ = templ->InstanceTemplate();
+  instance_templ->SetInternalFieldCount(1);
+  instance_templ->Set(v8_str("a"), v8_num(1));
+  instance_templ->Set(v8_str("b"), v8_num(2));
+  instance_templ->SetAccessorProperty(v8_str("c"),
+                                      v8::FunctionTemplate::New(isolate));
+  Local<Function> constructor =
+      templ->GetFunction(env.local()).ToLocalChecked();
+
+  // The data properties live in-object, both in the first instance and in
+  // the ones cloned from the cached boilerplate.
+  for (int i = 0; i < 3; i++) {
+    Local<v8::Object> obj =
+        constructor->NewInstance(env.local()).ToLocalChecked();
+    i::Handle<i::JSObject> i_obj =
+        i::Handle<i::JSObject>::cast(v8::Utils::OpenHandle(*obj));
+    CHECK_EQ(2, i_obj->map()->GetInObjectProperties());
+    CHECK_EQ(0, i_obj->property_array()->length());
+    CHECK_EQ(1, obj->InternalFieldCount());
+    CHECK_EQ(2, obj->Get(env.local(), v8_str("b"))
+                    .ToLocalChecked()
+                    ->Int32Value(env.local())
+                    .FromJust());
+  }
+}
+
 TEST(InternalFieldsSubclassing) {
   LocalContext env;
   v8::Isolate* isolate = env->GetIsolate();
@@ -3765,6 +3799,59 @@ THREADED_TEST(ArrayBuffer_External) {
   CHECK_EQ(0xDD, result->Int32Value(env.local()).FromJust());
 }
 
+namespace {
+
+struct ReleasedBackingStore {
+  void* data = nullptr;
+  size_t byte_length = 0;
+  int count = 0;
+};
+
+void RecordBackingStoreRelease(void* data, size_t byte_length,
+                               void* release_data) {
+  auto released = static_cast<ReleasedBackingStore*>(release_data);
+  released->data = data;
+  released->byte_length = byte_length;
+  released->count++;
+}
+
+}  // namespace
+
+TEST(ArrayBuffer_ExternalWithReleaseCallback) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+
+  i::ScopedVector<uint8_t> my_data(100);
+  memset(my_data.start(), 0, 100);
+  ReleasedBackingStore released;
+  v8::Global<v8::Uint8Array> slice;
+  {
+    v8::HandleScope inner_scope(isolate);
+    Local<v8::ArrayBuffer> ab = v8::ArrayBuffer::New(
+        isolate, my_data.start(), 100, RecordBackingStoreRelease, &released);
+    CHECK(ab->IsExternal());
+    CHECK_EQ(100, static_cast<int>(ab->ByteLength()));
+    Local<v8::Uint8Array> first = v8::Uint8Array::New(ab, 0, 10);
+    Local<v8::Uint8Array> second = v8::Uint8Array::New(ab, 90, 10);
+    CHECK(first->Set(env.local(), 0, v8_num(0xAA)).FromJust());
+    CHECK(second->Set(env.local(), 9, v8_num(0xBB)).FromJust());
+    CHECK_EQ(0xAA, my_data[0]);
+    CHECK_EQ(0xBB, my_data[99]);
+    slice.Reset(isolate, second);
+  }
+
+  // A live view keeps the buffer, and its memory block, alive.
+  CcTest::CollectAllAvailableGarbage();
+  CHECK_EQ(0, released.count);
+
+  slice.Reset();
+  CcTest::CollectAllAvailableGarbage();
+  CHECK_EQ(1, released.count);
+  CHECK_EQ(static_cast<void*>(my_data.start()), released.data);
+  CHECK_EQ(100u, released.byte_length);
+}
+
 THREADED_TEST(ArrayBuffer_DisableDetach) {
   LocalContext env;
   v8::Isolate* isolate = env->GetIsolate();
@@ -5462,6 +5549,37 @@ THREADED_TEST(FunctionCall) {
   CHECK(r10->StrictEquals(v8::True(isolate)));
 }
 
+THREADED_TEST(FunctionCallBatch) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+  CompileRun(
+      "var log = [];"
+      "function Add(a, b) {"
+      "  if (a < 0) throw a;"
+      "  log.push(a + b);"
+      "}");
+  Local<Function> add = Local<Function>::Cast(
+      context->Global()->Get(context.local(), v8_str("Add")).ToLocalChecked());
+
+  Local<Value> args[] = {v8_num(1), v8_num(2), v8_num(3), v8_num(4),
+                         v8_num(5), v8_num(6)};
+  CHECK(add->CallBatch(context.local(), Undefined(isolate), 2, 3, args)
+            .FromJust());
+  ExpectString("log.join()", "3,7,11");
+
+  // A throwing call stops the batch.
+  CompileRun("log = [];");
+  Local<Value> throwing_args[] = {v8_num(1), v8_num(1), v8_num(-1),
+                                  v8_num(1), v8_num(2), v8_num(2)};
+  v8::TryCatch try_catch(isolate);
+  CHECK(add->CallBatch(context.local(), Undefined(isolate), 2, 3,
+                       throwing_args)
+            .IsNothing());
+  CHECK(try_catch.HasCaught());
+  ExpectString("log.join()", "2");
+}
+
 
 THREADED_TEST(ConstructCall) {
   LocalContext context;
@@ -8922,7 +9040,7 @@ THREADED_TEST(Utf16MissingTrailing) {
   LocalContext context;
   v8::HandleScope scope(context->GetIsolate());
 
-  // Make sure it will go past the buffer, so it will call `WriteUtf16Slow`
+  // Make sure it will go past the buffer, so it will call `WriteSlow`
   int size = 1024 * 64;
   uint8_t* buffer = new uint8_t[size];
   for (int i = 0; i < size; i += 4) {
@@ -8947,7 +9065,7 @@ THREADED_TEST(Utf16Trailing3Byte) {
   v8::Isolate* isolate = context->GetIsolate();
   v8::HandleScope scope(isolate);
 
-  // Make sure it will go past the buffer, so it will call `WriteUtf16Slow`
+  // Make sure it will go past the buffer, so it will call `WriteSlow`
   int size = 1024 * 63;
   uint8_t* buffer = new uint8_t[size];
   for (int i = 0; i < size; i += 3) {
@@ -8970,6 +9088,43 @@ THREADED_TEST(Utf16Trailing3Byte) {
 }
 
 
+THREADED_TEST(Utf8Latin1) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  // Long enough to go past the decoder buffer, with "a\u00e9" repeated.
+  const int kRepeats = 1000;
+  std::string utf8;
+  for (int i = 0; i < kRepeats; i++) utf8 += "a\xC3\xA9";
+  v8::Local<v8::String> str =
+      v8::String::NewFromUtf8(isolate, utf8.data(), v8::NewStringType::kNormal,
+                              static_cast<int>(utf8.size()))
+          .ToLocalChecked();
+  CHECK(str->IsOneByte());
+  CHECK_EQ(2 * kRepeats, str->Length());
+  v8::String::Value value(isolate, str);
+  CHECK_EQ('a', (*value)[2 * kRepeats - 2]);
+  CHECK_EQ(0xE9, (*value)[2 * kRepeats - 1]);
+  CHECK_EQ(static_cast<int>(utf8.size()), str->Utf8Length(isolate));
+
+  // Writing it back produces the same bytes, and never a partial character.
+  std::vector<char> buffer(utf8.size() + 1);
+  int nchars = -1;
+  CHECK_EQ(static_cast<int>(utf8.size()) + 1,
+           str->WriteUtf8(isolate, buffer.data(),
+                          static_cast<int>(buffer.size()), &nchars));
+  CHECK_EQ(2 * kRepeats, nchars);
+  CHECK_EQ(0, memcmp(utf8.data(), buffer.data(), utf8.size() + 1));
+  CHECK_EQ(static_cast<int>(utf8.size()) - 2,
+           str->WriteUtf8(isolate, buffer.data(),
+                          static_cast<int>(utf8.size()) - 1, &nchars,
+                          v8::String::NO_NULL_TERMINATION));
+  CHECK_EQ(2 * kRepeats - 1, nchars);
+  CHECK_EQ(0, memcmp(utf8.data(), buffer.data(), utf8.size() - 2));
+}
+
+
 THREADED_TEST(ToArrayIndex) {
   LocalContext context;
   v8::Isolate* isolate = context->GetIsolate();
@@ -18715,6 +18870,66 @@ TEST(PromiseHook) {
   isolate->SetPromiseHook(nullptr);
 }
 
+TEST(ContextPromiseHooks) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Context> context = env.local();
+
+  CompileRun(
+      "var log = [];\n"
+      "function init(p, parent) {\n"
+      "  log.push(parent === undefined ? 'init' : 'init parent');\n"
+      "}\n"
+      "function before(p) { log.push('before'); }\n"
+      "function after(p) { log.push('after'); }\n"
+      "function resolve(p) { log.push('resolve'); }\n");
+  auto get_function = [&](const char* name) {
+    return v8::Local<v8::Function>::Cast(
+        env->Global()->Get(context, v8_str(name)).ToLocalChecked());
+  };
+  context->SetPromiseHooks(get_function("init"), get_function("before"),
+                           get_function("after"), get_function("resolve"));
+
+  CompileRun(
+      "var resolveP;\n"
+      "var p = new Promise(r => resolveP = r);\n"
+      "var p1 = p.then(() => {});\n"
+      "resolveP();\n");
+  CHECK(v8_str("init,init parent,resolve,before,resolve,after")
+            ->Equals(context, CompileRun("log.join()"))
+            .FromJust());
+
+  // Awaiting in an async function fires the before and after hooks for the
+  // throwaway promise, which the builtins allocate for the hooks.
+  CompileRun(
+      "log = [];\n"
+      "var done = false;\n"
+      "(async function() { await 1; done = true; })();\n");
+  CHECK(CompileRun("done")->IsTrue());
+  CHECK_EQ(1, CompileRun("log.filter(e => e == 'before').length")
+                  ->Int32Value(context)
+                  .FromJust());
+  CHECK_EQ(1, CompileRun("log.filter(e => e == 'after').length")
+                  ->Int32Value(context)
+                  .FromJust());
+
+  // Exceptions thrown by the hooks don't affect the promise operations.
+  CompileRun("function init() { throw new Error('init'); }");
+  context->SetPromiseHooks(get_function("init"), v8::Local<v8::Function>(),
+                           v8::Local<v8::Function>(),
+                           v8::Local<v8::Function>());
+  CompileRun("var value; Promise.resolve(42).then(v => value = v);");
+  CHECK_EQ(42, CompileRun("value")->Int32Value(context).FromJust());
+
+  // Removing the hooks stops the calls.
+  context->SetPromiseHooks(
+      v8::Local<v8::Function>(), v8::Local<v8::Function>(),
+      v8::Local<v8::Function>(), v8::Local<v8::Function>());
+  CompileRun("log = []; Promise.resolve().then(() => {});");
+  CHECK_EQ(0, CompileRun("log.length")->Int32Value(context).FromJust());
+}
+
 void AnalyzeStackOfDynamicScriptWithSourceURL(
     const v8::FunctionCallbackInfo<v8::Value>& args) {
   v8::HandleScope scope(args.GetIsolate());
@@ -18981,6 +19196,105 @@ THREADED_TEST(GetHeapStatistics) {
   CHECK_NE(static_cast<int>(heap_statistics.used_heap_size()), 0);
 }
 
+TEST(GetFunctionICStatistics) {
+  i::FLAG_function_ic_stats = true;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  isolate->ResetFunctionICStatistics();
+  CompileRun(
+      "function stable(o) { return o.x; }"
+      "function unstable(o) { return o.x; }"
+      "for (var i = 0; i < 3; i++) stable({x: i});"
+      "unstable({x: 1}); unstable({x: 1, a: 1}); unstable({x: 1, b: 1});"
+      "for (var i = 0; i < 10; i++) {"
+      "  var o = {x: 1};"
+      "  o['p' + i] = i;"
+      "  unstable(o);"
+      "}");
+
+  size_t count = isolate->NumberOfFunctionICStatistics();
+  bool found = false;
+  for (size_t i = 0; i < count; ++i) {
+    v8::FunctionICStatistics statistics;
+    CHECK(isolate->GetFunctionICStatistics(&statistics, i));
+    CHECK_NOT_NULL(statistics.function_name());
+    CHECK_NE(0, strcmp("stable", statistics.function_name()));
+    if (strcmp("unstable", statistics.function_name()) != 0) continue;
+    found = true;
+    CHECK_GT(statistics.script_id(), 0);
+    CHECK_GT(statistics.polymorphic_transitions(), 0u);
+    CHECK_EQ(static_cast<size_t>(i::IC::kMaxPolymorphicMapCount),
+             statistics.max_polymorphism());
+    CHECK_EQ(1u, statistics.megamorphic_transitions());
+  }
+  CHECK(found);
+  v8::FunctionICStatistics statistics;
+  CHECK(!isolate->GetFunctionICStatistics(&statistics, count));
+
+  isolate->ResetFunctionICStatistics();
+  CHECK_EQ(0u, isolate->NumberOfFunctionICStatistics());
+}
+
+namespace {
+
+struct RecordedDeoptimizations {
+  v8::Local<v8::Function> function;
+  int count = 0;
+  std::string kind;
+  std::string reason;
+  int deopt_count = 0;
+  bool reoptimized = false;
+};
+
+void RecordDeoptimization(v8::Isolate* isolate,
+                          const v8::DeoptimizationInfo& info, void* data) {
+  RecordedDeoptimizations* recorded =
+      static_cast<RecordedDeoptimizations*>(data);
+  CHECK(info.function == recorded->function);
+  CHECK_GE(info.bytecode_offset, 0);
+  recorded->count++;
+  recorded->kind = info.kind;
+  recorded->reason = info.reason;
+  recorded->deopt_count = info.deopt_count;
+  recorded->reoptimized = info.reoptimized;
+}
+
+}  // namespace
+
+TEST(DeoptimizationCallback) {
+  i::FLAG_allow_natives_syntax = true;
+  if (!CcTest::i_isolate()->use_optimizer() || i::FLAG_always_opt) return;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  RecordedDeoptimizations recorded;
+  recorded.function = CompileRun(
+                          "function f(o) { return o.x; };"
+                          "f({x: 1}); f({x: 2});"
+                          "f")
+                          .As<v8::Function>();
+  isolate->SetDeoptimizationCallback(&RecordDeoptimization, &recorded);
+
+  CompileRun("%OptimizeFunctionOnNextCall(f); f({x: 3}); f({y: 1, x: 2});");
+  CHECK_EQ(1, recorded.count);
+  CHECK_EQ(0, strcmp("eager", recorded.kind.c_str()));
+  CHECK_EQ(0, strcmp("wrong map", recorded.reason.c_str()));
+  CHECK_EQ(1, recorded.deopt_count);
+  CHECK(!recorded.reoptimized);
+
+  CompileRun(
+      "%OptimizeFunctionOnNextCall(f); f({x: 3});"
+      "f({z: 1, x: 2});");
+  CHECK_EQ(2, recorded.count);
+  CHECK_EQ(2, recorded.deopt_count);
+  CHECK(recorded.reoptimized);
+
+  isolate->SetDeoptimizationCallback(nullptr);
+  CompileRun("%OptimizeFunctionOnNextCall(f); f({x: 3}); f({w: 1});");
+  CHECK_EQ(2, recorded.count);
+}
+
 TEST(GetHeapSpaceStatistics) {
   LocalContext c1;
   v8::Isolate* isolate = c1->GetIsolate();
@@ -23276,6 +23590,103 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+THREADED_TEST(JSONChunkedParse) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  // UTF-8 with two-, three- and four-byte sequences, split at every byte.
+  const char* json = "{\"x\":[42,\"\xC3\xA9\xE2\x82\xAC\xF0\x9D\x8C\x86\"]}";
+  size_t length = strlen(json);
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(json);
+  v8::JSON::ChunkedParser parser;
+  for (size_t split = 0; split <= length; split++) {
+    parser.Append(bytes, split);
+    parser.Append(bytes + split, length - split);
+    Local<Value> value = parser.Finish(context.local()).ToLocalChecked();
+    CHECK(value->IsObject());
+    context->Global()->Set(context.local(), v8_str("obj"), value).FromJust();
+    ExpectTrue(
+        "obj.x.length == 2 && obj.x[0] == 42 && "
+        "obj.x[1] == '\\u00E9\\u20AC\\uD834\\uDF06'");
+  }
+
+  // One-byte input, one byte at a time.
+  const char* one_byte = "[1, 2, \"three\"]";
+  for (size_t i = 0; i < strlen(one_byte); i++) {
+    parser.Append(reinterpret_cast<const uint8_t*>(one_byte + i), 1);
+  }
+  Local<Value> array = parser.Finish(context.local()).ToLocalChecked();
+  CHECK(array->IsArray());
+  CHECK_EQ(3u, array.As<v8::Array>()->Length());
+
+  // Syntax errors are thrown like in JSON::Parse, and the parser can be used
+  // again afterwards.
+  {
+    v8::TryCatch try_catch(isolate);
+    const char* invalid = "{\"x\":";
+    parser.Append(reinterpret_cast<const uint8_t*>(invalid), strlen(invalid));
+    CHECK(parser.Finish(context.local()).IsEmpty());
+    CHECK(try_catch.HasCaught());
+  }
+  parser.Append(reinterpret_cast<const uint8_t*>("7"), 1);
+  CHECK_EQ(7, parser.Finish(context.local())
+                  .ToLocalChecked()
+                  ->Int32Value(context.local())
+                  .FromJust());
+}
+
+namespace {
+
+class StringOutputSink : public v8::JSON::OutputSink {
+ public:
+  void Write(const char* data, size_t length) override {
+    output_.append(data, length);
+    writes_++;
+  }
+
+  const std::string& output() const { return output_; }
+  int writes() const { return writes_; }
+
+ private:
+  std::string output_;
+  int writes_ = 0;
+};
+
+}  // namespace
+
+THREADED_TEST(JSONStringifyToSink) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  // Long enough to be built from many string parts, with surrogate pairs that
+  // end up on either side of part boundaries.
+  Local<Value> value = CompileRun(
+      "var parts = [];"
+      "for (var i = 0; i < 20000; i++) parts.push({s: 'abc\\u00E9' + i});"
+      "parts.push('\\uD834\\uDF06'.repeat(10000));"
+      "parts");
+  Local<String> json =
+      v8::JSON::Stringify(context.local(), value).ToLocalChecked();
+  v8::String::Utf8Value expected(isolate, json);
+
+  StringOutputSink sink;
+  CHECK(v8::JSON::Stringify(context.local(), value, &sink).FromJust());
+  CHECK_EQ(std::string(*expected, expected.length()), sink.output());
+  CHECK_LT(1, sink.writes());
+
+  StringOutputSink gap_sink;
+  CHECK(v8::JSON::Stringify(context.local(), v8_num(1), &gap_sink, v8_str("*"))
+            .FromJust());
+  CHECK_EQ(std::string("1"), gap_sink.output());
+
+  // Exceptions are propagated.
+  v8::TryCatch try_catch(isolate);
+  Local<Value> cyclic = CompileRun("var cyclic = {}; cyclic.x = cyclic");
+  StringOutputSink cyclic_sink;
+  CHECK(v8::JSON::Stringify(context.local(), cyclic, &cyclic_sink).IsNothing());
+  CHECK(try_catch.HasCaught());
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
@@ -24346,6 +24757,66 @@ TEST(ApiCallbackCanReturnSymbols) {
 }
 
 
+namespace {
+
+int fast_api_calls_count = 0;
+int slow_api_calls_count = 0;
+
+int32_t FastAddOneCallback(v8::ApiObject receiver, int32_t value) {
+  CHECK_NE(0, receiver.address);
+  fast_api_calls_count++;
+  return value + 1;
+}
+
+void SlowAddOneCallback(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  slow_api_calls_count++;
+  int32_t value =
+      info[0]->Int32Value(info.GetIsolate()->GetCurrentContext()).FromJust();
+  info.GetReturnValue().Set(value + 1);
+}
+
+}  // namespace
+
+TEST(FastApiCalls) {
+  i::FLAG_allow_natives_syntax = true;
+  i::FLAG_turbo_fast_api_calls = true;
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  v8::CFunction c_function = v8::CFunction::Make(FastAddOneCallback);
+  Local<FunctionTemplate> add_one = FunctionTemplate::New(
+      isolate, SlowAddOneCallback, Local<Value>(), Local<v8::Signature>(), 1,
+      v8::ConstructorBehavior::kThrow, v8::SideEffectType::kHasSideEffect,
+      &c_function);
+  Local<ObjectTemplate> object_template = ObjectTemplate::New(isolate);
+  object_template->Set(v8_str("addOne"), add_one);
+  Local<Object> receiver =
+      object_template->NewInstance(context.local()).ToLocalChecked();
+  context->Global()
+      ->Set(context.local(), v8_str("receiver"), receiver)
+      .FromJust();
+
+  fast_api_calls_count = 0;
+  slow_api_calls_count = 0;
+  CompileRun(
+      "function f(x) { return receiver.addOne(x); }"
+      "f(1); f(2);"
+      "%OptimizeFunctionOnNextCall(f);");
+  CHECK_EQ(0, fast_api_calls_count);
+  CHECK_EQ(2, slow_api_calls_count);
+  ExpectInt32("f(41)", 42);
+  ExpectInt32("f(-1.5)", 0);
+  CHECK_EQ(2, fast_api_calls_count);
+  CHECK_EQ(2, slow_api_calls_count);
+
+  // Non-number arguments take the regular callback.
+  ExpectInt32("f('41')", 42);
+  CHECK_EQ(2, fast_api_calls_count);
+  CHECK_EQ(3, slow_api_calls_count);
+}
+
+
 TEST(EmptyApiCallback) {
   LocalContext context;
   auto isolate = context->GetIsolate();
@@ -25979,6 +26450,40 @@ v8::MaybeLocal<Module> UnexpectedModuleResolveCallback(Local<Context> context,
   CHECK_WITH_MSG(false, "Unexpected call to resolve callback");
 }
 
+TEST(StreamingModule) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  v8::TryCatch try_catch(isolate);
+
+  const char* chunks[] = {"const x = 6; export def", "ault x; x + 7;", nullptr};
+  v8::ScriptCompiler::StreamedSource source(
+      new TestSourceStream(chunks),
+      v8::ScriptCompiler::StreamedSource::ONE_BYTE);
+  v8::ScriptCompiler::ScriptStreamingTask* task =
+      v8::ScriptCompiler::StartStreaming(isolate, &source,
+                                         v8::ScriptType::kModule);
+  task->Run();
+  delete task;
+  CHECK(!try_catch.HasCaught());
+
+  v8::ScriptOrigin origin(
+      v8_str("http://foo.com"), Local<v8::Integer>(), Local<v8::Integer>(),
+      Local<v8::Boolean>(), Local<v8::Integer>(), Local<v8::Value>(),
+      Local<v8::Boolean>(), Local<v8::Boolean>(), True(isolate));
+  char* full_source = TestSourceStream::FullSourceString(chunks);
+  Local<Module> module =
+      v8::ScriptCompiler::CompileModule(env.local(), &source,
+                                        v8_str(full_source), origin)
+          .ToLocalChecked();
+  module->InstantiateModule(env.local(), UnexpectedModuleResolveCallback)
+      .ToChecked();
+  Local<Value> result = module->Evaluate(env.local()).ToLocalChecked();
+  CHECK_EQ(13, result->Int32Value(env.local()).FromJust());
+  CHECK(!try_catch.HasCaught());
+  delete[] full_source;
+}
+
 namespace {
 
 Local<Module> CompileAndInstantiateModule(v8::Isolate* isolate,
@@ -373,6 +373,36 @@ TEST(FeedbackVectorUnaffectedByScopeChanges) {
   CHECK(!f->feedback_vector()->is_empty());
 }
 
+TEST(CompileHintsMagicComment) {
+  if (i::FLAG_always_opt || !i::FLAG_lazy) {
+    return;
+  }
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  v8::Local<v8::Context> context = CcTest::isolate()->GetCurrentContext();
+
+  // The hint is zero-padded so that its length doesn't depend on the
+  // position it lists.
+  const char* kHeader = "//# compileHints=00000\n";
+  const char* kBody =
+      "function lazy() { return 1; }\n"
+      "function eager() { return 2; }\n";
+  std::string source = std::string(kHeader) + kBody;
+  std::string position = std::to_string(source.find("function eager"));
+  source.replace(strlen(kHeader) - 1 - position.length(), position.length(),
+                 position);
+  CompileRun(source.c_str());
+
+  Handle<JSFunction> lazy = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+      *v8::Local<v8::Function>::Cast(
+          CcTest::global()->Get(context, v8_str("lazy")).ToLocalChecked())));
+  Handle<JSFunction> eager = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+      *v8::Local<v8::Function>::Cast(
+          CcTest::global()->Get(context, v8_str("eager")).ToLocalChecked())));
+  CHECK(!lazy->shared()->is_compiled());
+  CHECK(eager->shared()->is_compiled());
+}
+
 // Test that optimized code for different closures is actually shared.
 TEST(OptimizedCodeSharing1) {
   FLAG_stress_compaction = false;
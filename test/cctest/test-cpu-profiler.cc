@@ -265,6 +265,75 @@ TEST(TickEvents) {
   CHECK(top_down_ddd_children->empty());
 }
 
+namespace {
+
+struct SampleBatches {
+  std::vector<int> sizes;
+  std::vector<unsigned> node_ids;
+};
+
+void RecordSampleBatch(const v8::CpuProfile* profile, void* data) {
+  SampleBatches* batches = static_cast<SampleBatches*>(data);
+  batches->sizes.push_back(profile->GetSamplesCount());
+  for (int i = 0; i < profile->GetSamplesCount(); i++) {
+    batches->node_ids.push_back(profile->GetSample(i)->GetNodeId());
+  }
+}
+
+}  // namespace
+
+TEST(StreamSampleBatches) {
+  TestSetup test_setup;
+  LocalContext env;
+  i::Isolate* isolate = CcTest::i_isolate();
+  i::HandleScope scope(isolate);
+
+  i::AbstractCode frame1_code = CreateCode(&env);
+  i::AbstractCode frame2_code = CreateCode(&env);
+
+  CpuProfilesCollection* profiles = new CpuProfilesCollection(isolate);
+  ProfileGenerator* generator = new ProfileGenerator(profiles);
+  ProfilerEventsProcessor* processor =
+      new SamplingEventsProcessor(CcTest::i_isolate(), generator,
+                                  v8::base::TimeDelta::FromMicroseconds(100));
+  CpuProfiler profiler(isolate, profiles, generator, processor);
+  SampleBatches batches;
+  profiles->StartProfiling("", true, v8::CpuProfilingMode::kLeafNodeLineNumbers,
+                           RecordSampleBatch, &batches, 2);
+  processor->Start();
+  ProfilerListener profiler_listener(isolate, processor);
+  isolate->logger()->AddCodeEventListener(&profiler_listener);
+
+  profiler_listener.CodeCreateEvent(i::Logger::BUILTIN_TAG, frame1_code, "bbb");
+  profiler_listener.CodeCreateEvent(i::Logger::STUB_TAG, frame2_code, "ccc");
+
+  for (int i = 0; i < 5; i++) {
+    EnqueueTickSampleEvent(processor, frame2_code->raw_instruction_start(),
+                           frame1_code->raw_instruction_start());
+  }
+
+  isolate->logger()->RemoveCodeEventListener(&profiler_listener);
+  processor->StopSynchronously();
+  CpuProfile* profile = profiles->StopProfiling("");
+  CHECK(profile);
+
+  // Two full batches, and the remaining sample when the profile stopped.
+  CHECK_EQ(3, batches.sizes.size());
+  CHECK_EQ(2, batches.sizes[0]);
+  CHECK_EQ(2, batches.sizes[1]);
+  CHECK_EQ(1, batches.sizes[2]);
+  CHECK_EQ(0, profile->samples_count());
+
+  // The samples still refer to the nodes of the accumulated tree.
+  const ProfileNode* ccc_node =
+      profile->top_down()->root()->children()->back()->children()->back();
+  CHECK_EQ(0, strcmp("ccc", ccc_node->entry()->name()));
+  CHECK_EQ(5, ccc_node->self_ticks());
+  for (unsigned node_id : batches.node_ids) {
+    CHECK_EQ(ccc_node->id(), node_id);
+  }
+}
+
 // http://crbug/51594
 // This test must not crash.
 TEST(CrashIfStoppingLastNonExistentProfile) {
@@ -215,6 +215,65 @@ TEST(VectorCallFeedback) {
   CHECK_EQ(MONOMORPHIC, nexus.StateFromFeedback());
 }
 
+TEST(VectorDeoptimizationLoop) {
+  if (i::FLAG_always_opt) return;
+  i::FLAG_deopt_loop_threshold = 3;
+
+  CcTest::InitializeVM();
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+  Isolate* isolate = CcTest::i_isolate();
+  CompileRun("function f(a) { return a + 1; } f(1);");
+  Handle<JSFunction> f = GetFunction("f");
+  Handle<FeedbackVector> feedback_vector =
+      Handle<FeedbackVector>(f->feedback_vector(), isolate);
+  CHECK(!feedback_vector->has_conservative_speculation());
+
+  // Changing deoptimization reasons are not a loop.
+  CHECK(!feedback_vector->RecordDeoptimization(DeoptimizeReason::kOverflow));
+  CHECK(!feedback_vector->RecordDeoptimization(DeoptimizeReason::kOverflow));
+  CHECK(!feedback_vector->RecordDeoptimization(DeoptimizeReason::kNotASmi));
+  CHECK(!feedback_vector->RecordDeoptimization(DeoptimizeReason::kOverflow));
+  CHECK(!feedback_vector->has_conservative_speculation());
+
+  // The same reason over and over again is, but it is only reported once.
+  CHECK(!feedback_vector->RecordDeoptimization(DeoptimizeReason::kOverflow));
+  CHECK(feedback_vector->RecordDeoptimization(DeoptimizeReason::kOverflow));
+  CHECK(feedback_vector->has_conservative_speculation());
+  CHECK(!feedback_vector->RecordDeoptimization(DeoptimizeReason::kOverflow));
+  CHECK(feedback_vector->has_conservative_speculation());
+}
+
+TEST(LazyFeedbackAllocation) {
+  if (i::FLAG_always_opt) return;
+  i::FLAG_lazy_feedback_allocation = true;
+  i::FLAG_invocations_for_feedback_vector_allocation = 4;
+
+  CcTest::InitializeVM();
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+
+  // Functions that run only once don't get a feedback vector.
+  CompileRun("function f(a) { return a + 1; } f(1);");
+  Handle<JSFunction> f = GetFunction("f");
+  CHECK(!f->has_feedback_vector());
+
+  // Functions that keep running do.
+  CompileRun("for (var i = 0; i < 100; ++i) f(i);");
+  CHECK(f->has_feedback_vector());
+  CHECK_GT(f->feedback_vector()->invocation_count(), 0);
+
+  // So do functions which loop for a while.
+  CompileRun(
+      "function g() {"
+      "  var s = 0;"
+      "  for (var i = 0; i < 1000; ++i) s += i;"
+      "  return s;"
+      "}"
+      "g();");
+  CHECK(GetFunction("g")->has_feedback_vector());
+}
+
 TEST(VectorCallFeedbackForArray) {
   if (!i::FLAG_use_ic) return;
   if (i::FLAG_always_opt) return;
@@ -2852,6 +2852,44 @@ TEST(HoleyMutableHeapNumber) {
   CHECK_EQ(kHoleNanInt64, MutableHeapNumber::cast(*obj)->value_as_bits());
 }
 
+TEST(MigrateDeprecatedInstances) {
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Isolate* isolate = CcTest::i_isolate();
+
+  // Generalizing the Smi field to Double deprecates the map of the first
+  // hundred objects.
+  CompileRun(
+      "var objects = [];"
+      "for (var i = 0; i < 100; i++) objects.push({a: i, b: 'x'});"
+      "var generalized = {a: 1.5, b: 'y'};");
+
+  Handle<String> objects_name =
+      isolate->factory()->InternalizeUtf8String("objects");
+  Handle<JSArray> objects = Handle<JSArray>::cast(
+      Object::GetProperty(isolate, isolate->global_object(), objects_name)
+          .ToHandleChecked());
+  Handle<FixedArray> elements(FixedArray::cast(objects->elements()), isolate);
+  Handle<Map> deprecated_map(JSObject::cast(elements->get(0))->map(), isolate);
+  CHECK(deprecated_map->is_deprecated());
+
+  isolate->heap()->MigrateDeprecatedInstances();
+
+  Map new_map = JSObject::cast(elements->get(0))->map();
+  CHECK(!new_map->is_deprecated());
+  CHECK(new_map->instance_descriptors()->GetDetails(0).representation().Equals(
+      Representation::Double()));
+  for (int i = 0; i < 100; i++) {
+    Handle<JSObject> object(JSObject::cast(elements->get(i)), isolate);
+    CHECK_EQ(new_map, object->map());
+#ifdef VERIFY_HEAP
+    object->ObjectVerify(isolate);
+#endif
+  }
+  CHECK_EQ(99, CompileRun("objects[99].a")->Int32Value(
+                   CcTest::isolate()->GetCurrentContext()).FromJust());
+}
+
 }  // namespace test_field_type_tracking
 }  // namespace compiler
 }  // namespace internal
@@ -510,5 +510,33 @@ TEST(SecondPassPhantomCallbacks) {
   CHECK(fp.flag);
 }
 
+TEST(ReleaseEmptyNodeBlocks) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  GlobalHandles* global_handles = isolate->global_handles();
+  HandleScope scope(isolate);
+  Handle<Object> number = isolate->factory()->NewNumber(1.5);
+  size_t initial_blocks = global_handles->NumberOfBlocks();
+
+  const int kHandles = 100 * 256;
+  std::vector<Address*> locations;
+  for (int i = 0; i < kHandles; i++) {
+    locations.push_back(global_handles->Create(*number).location());
+  }
+  CHECK_LE(initial_blocks + 100, global_handles->NumberOfBlocks());
+  // Keep one handle so that its block stays alive.
+  for (int i = 1; i < kHandles; i++) GlobalHandles::Destroy(locations[i]);
+
+  CcTest::CollectAllGarbage();
+  CHECK_GE(initial_blocks + 3, global_handles->NumberOfBlocks());
+  CHECK_EQ(*number, ObjectPtr(*locations[0]));
+
+  // The remaining free nodes can still be used.
+  for (int i = 1; i < kHandles; i++) {
+    locations[i] = global_handles->Create(*number).location();
+  }
+  for (Address* location : locations) GlobalHandles::Destroy(location);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -1185,6 +1185,111 @@ TEST(HeapSnapshotJSONSerializationAborting) {
 
 namespace {
 
+class BinarySnapshotReader {
+ public:
+  explicit BinarySnapshotReader(i::Vector<char> data)
+      : data_(data), pos_(0) {}
+  uint64_t ReadVarint() {
+    uint64_t result = 0;
+    int shift = 0;
+    uint8_t byte;
+    do {
+      CHECK_LT(pos_, data_.length());
+      byte = static_cast<uint8_t>(data_[pos_++]);
+      result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      shift += 7;
+    } while (byte & 0x80);
+    return result;
+  }
+  std::string ReadString() {
+    int length = static_cast<int>(ReadVarint());
+    CHECK_LE(pos_ + length, data_.length());
+    std::string result(data_.start() + pos_, length);
+    pos_ += length;
+    return result;
+  }
+  bool AtEnd() const { return pos_ == data_.length(); }
+
+ private:
+  i::Vector<char> data_;
+  int pos_;
+};
+
+}  // namespace
+
+TEST(HeapSnapshotBinarySerialization) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  CompileRun(
+      "function BinaryA() { this.s = 'binary string'; }\n"
+      "var a = new BinaryA();");
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+
+  TestJSONStream stream;
+  snapshot->Serialize(&stream, v8::HeapSnapshot::kBinary);
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(1, stream.eos_signaled());
+  i::ScopedVector<char> data(stream.size());
+  stream.WriteTo(data);
+  CHECK_EQ(0, strncmp(data.start(), "V8HS", 4));
+
+  BinarySnapshotReader reader(data.SubVector(4, data.length()));
+  CHECK_EQ(1u, reader.ReadVarint());
+  uint64_t node_count = reader.ReadVarint();
+  CHECK_EQ(static_cast<uint64_t>(snapshot->GetNodesCount()), node_count);
+  uint64_t total_edge_count = 0;
+  uint64_t max_string_id = 0;
+  for (uint64_t i = 0; i < node_count; i++) {
+    const v8::HeapGraphNode* node = snapshot->GetNode(static_cast<int>(i));
+    CHECK_EQ(static_cast<uint64_t>(node->GetType()), reader.ReadVarint());
+    max_string_id = std::max(max_string_id, reader.ReadVarint());
+    CHECK_EQ(node->GetId(), reader.ReadVarint());
+    CHECK_EQ(node->GetShallowSize(), reader.ReadVarint());
+    uint64_t edge_count = reader.ReadVarint();
+    CHECK_EQ(static_cast<uint64_t>(node->GetChildrenCount()), edge_count);
+    total_edge_count += edge_count;
+    reader.ReadVarint();  // trace_node_id
+  }
+  CHECK_EQ(total_edge_count, reader.ReadVarint());
+  for (uint64_t i = 0; i < total_edge_count; i++) {
+    uint64_t type = reader.ReadVarint();
+    uint64_t name_or_index = reader.ReadVarint();
+    if (type != v8::HeapGraphEdge::kElement &&
+        type != v8::HeapGraphEdge::kHidden) {
+      max_string_id = std::max(max_string_id, name_or_index);
+    }
+    CHECK_LT(reader.ReadVarint(), node_count);
+  }
+  uint64_t location_count = reader.ReadVarint();
+  for (uint64_t i = 0; i < location_count * 4; i++) reader.ReadVarint();
+  uint64_t sample_count = reader.ReadVarint();
+  for (uint64_t i = 0; i < sample_count * 2; i++) reader.ReadVarint();
+  uint64_t string_count = reader.ReadVarint();
+  CHECK_EQ(max_string_id, string_count);
+  bool found_string = false;
+  for (uint64_t i = 0; i < string_count; i++) {
+    if (reader.ReadString() == "BinaryA") found_string = true;
+  }
+  CHECK(found_string);
+  CHECK(reader.AtEnd());
+}
+
+TEST(HeapSnapshotBinarySerializationAborting) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+  TestJSONStream stream(5);
+  snapshot->Serialize(&stream, v8::HeapSnapshot::kBinary);
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(0, stream.eos_signaled());
+}
+
+namespace {
+
 class TestStatsStream : public v8::OutputStream {
  public:
   TestStatsStream()
@@ -3699,6 +3804,45 @@ TEST(SamplingHeapProfilerApiSamples) {
   heap_profiler->StopSamplingHeapProfiler();
 }
 
+TEST(SamplingHeapProfilerSampleSurvival) {
+  v8::HandleScope scope(v8::Isolate::GetCurrent());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  // Suppress randomness to avoid flakiness in tests.
+  v8::internal::FLAG_sampling_heap_profiler_suppress_randomness = true;
+
+  heap_profiler->StartSamplingHeapProfiler(256);
+
+  CompileRun(
+      "var retained = [];\n"
+      "for (var i = 0; i < 4096; ++i) retained.push({});\n");
+  CcTest::CollectGarbage(v8::internal::NEW_SPACE);
+  CcTest::CollectAllGarbage();
+  CcTest::CollectAllGarbage();
+
+  // All live samples were taken before the three collections.
+  std::unique_ptr<v8::AllocationProfile> profile(
+      heap_profiler->GetAllocationProfile());
+  CHECK(!profile->GetSamples().empty());
+  for (auto& sample : profile->GetSamples()) {
+    CHECK_LE(3, sample.gc_count);
+    CHECK_LE(2, sample.full_gc_count);
+    CHECK_LE(sample.full_gc_count, sample.gc_count);
+  }
+
+  // New samples have not survived anything yet.
+  for (int i = 0; i < 1024; ++i) v8::Object::New(env->GetIsolate());
+  profile.reset(heap_profiler->GetAllocationProfile());
+  bool found_new_sample = false;
+  for (auto& sample : profile->GetSamples()) {
+    if (sample.gc_count == 0) found_new_sample = true;
+  }
+  CHECK(found_new_sample);
+
+  heap_profiler->StopSamplingHeapProfiler();
+}
+
 TEST(SamplingHeapProfilerLeftTrimming) {
   v8::HandleScope scope(v8::Isolate::GetCurrent());
   LocalContext env;
@@ -484,6 +484,51 @@ TEST(LiveEditPatchFunctions) {
            3);
 }
 
+TEST(LiveEditKeepsPreParsedScopeData) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::Local<v8::Context> context = env.local();
+  const char* kSource =
+      "function outer() { function inner() { return 1; } return inner(); }\n"
+      "var x = 1;";
+
+  CompileRun(kSource);
+  i::Handle<i::JSFunction> outer = i::Handle<i::JSFunction>::cast(
+      v8::Utils::OpenHandle(*env->Global()->Get(context, v8_str("outer"))
+                                 .ToLocalChecked()));
+  bool had_preparsed_data =
+      outer->shared()->HasUncompiledDataWithPreParsedScope();
+
+  // Edits after the function leave its preparsed scope data usable.
+  PatchFunctions(context, kSource,
+                 "function outer() { function inner() { return 1; } return "
+                 "inner(); }\nvar x = 2;");
+  outer = i::Handle<i::JSFunction>::cast(v8::Utils::OpenHandle(
+      *env->Global()->Get(context, v8_str("outer")).ToLocalChecked()));
+  CHECK_EQ(had_preparsed_data,
+           outer->shared()->HasUncompiledDataWithPreParsedScope());
+  CHECK_EQ(CompileRunChecked(env->GetIsolate(), "outer()")
+               ->ToInt32(context)
+               .ToLocalChecked()
+               ->Value(),
+           1);
+
+  // Edits before the function move it, so the data has to be dropped.
+  PatchFunctions(context, kSource,
+                 "var y = 0;\nfunction outer() { function inner() { return 1; "
+                 "} return inner(); }\nvar x = 1;");
+  outer = i::Handle<i::JSFunction>::cast(v8::Utils::OpenHandle(
+      *env->Global()->Get(context, v8_str("outer")).ToLocalChecked()));
+  if (had_preparsed_data) {
+    CHECK(!outer->shared()->HasUncompiledDataWithPreParsedScope());
+  }
+  CHECK_EQ(CompileRunChecked(env->GetIsolate(), "outer()")
+               ->ToInt32(context)
+               .ToLocalChecked()
+               ->Value(),
+           1);
+}
+
 TEST(LiveEditCompileError) {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
@@ -972,6 +972,94 @@ TEST(ExtensionsRegistration) {
   StartJoinAndDeleteThreads(threads);
 }
 
+class HandoffThread : public JoinableThread {
+ public:
+  HandoffThread(v8::Isolate* isolate, v8::Persistent<v8::Context>* context)
+      : JoinableThread("HandoffThread"), isolate_(isolate), context_(context) {}
+
+  void Run() override {
+    v8::Locker locker(isolate_);
+    v8::Isolate::Scope isolate_scope(isolate_);
+    v8::HandleScope handle_scope(isolate_);
+    v8::Local<v8::Context> context =
+        v8::Local<v8::Context>::New(isolate_, *context_);
+    v8::Context::Scope context_scope(context);
+    CalcFibAndCheck(context);
+    // The stack limit must have been set up for this thread.
+    v8::TryCatch try_catch(isolate_);
+    CompileRun("function recurse() { return recurse(); } recurse();");
+    CHECK(try_catch.HasCaught());
+  }
+
+ private:
+  v8::Isolate* isolate_;
+  v8::Persistent<v8::Context>* context_;
+};
+
+// Hand an isolate from thread to thread with top-level lockers, the way a
+// scheduler that multiplexes isolates over worker threads would, while
+// another thread holds an unlocked, archived state.
+TEST(IsolateHandoffBetweenThreads) {
+  const int kHandoffs = 10;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Persistent<v8::Context> persistent_context;
+    {
+      v8::Locker locker(isolate);
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      persistent_context.Reset(isolate, context);
+      v8::Context::Scope context_scope(context);
+      CalcFibAndCheck(context);
+      {
+        isolate->Exit();
+        v8::Unlocker unlocker(isolate);
+        for (int i = 0; i < kHandoffs; i++) {
+          HandoffThread thread(isolate, &persistent_context);
+          thread.Start();
+          thread.Join();
+        }
+      }
+      isolate->Enter();
+      CalcFibAndCheck(context);
+    }
+    for (int i = 0; i < kHandoffs; i++) {
+      HandoffThread thread(isolate, &persistent_context);
+      thread.Start();
+      thread.Join();
+    }
+    v8::Locker locker(isolate);
+    persistent_context.Reset();
+  }
+  isolate->Dispose();
+}
+
+TEST(IsolatePool) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::IsolatePool pool(create_params, 2);
+  // Take more isolates than the pool holds, so that some of them may have to
+  // be created synchronously.
+  for (int i = 0; i < 4; i++) {
+    v8::Global<v8::Context> global_context;
+    v8::Isolate* isolate = pool.Take(&global_context);
+    CHECK(!global_context.IsEmpty());
+    {
+      v8::Locker locker(isolate);
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = global_context.Get(isolate);
+      v8::Context::Scope context_scope(context);
+      CHECK_EQ(42, CompileRun("6 * 7")->Int32Value(context).FromJust());
+    }
+    global_context.Reset();
+    isolate->Dispose();
+  }
+}
+
 }  // namespace test_lockers
 }  // namespace internal
 }  // namespace v8
@@ -604,6 +604,61 @@ TEST(OrderedHashMapDuplicateHashCode) {
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key2));
 }
 
+TEST(OrderedHashMapStoredHash) {
+  LocalContext context;
+  Isolate* isolate = GetIsolateFrom(&context);
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+
+  Handle<OrderedHashMap> map = factory->NewOrderedHashMap();
+  Handle<JSObject> value = factory->NewJSObjectWithNullProto();
+  Handle<FixedArray> keys = factory->NewFixedArray(100);
+  for (int i = 0; i < keys->length(); i++) {
+    Handle<Object> key;
+    switch (i % 4) {
+      case 0:
+        key = handle(Smi::FromInt(i), isolate);
+        break;
+      case 1:
+        key = factory->NewHeapNumber(i + 0.5);
+        break;
+      case 2:
+        key = factory->NumberToString(factory->NewNumber(i * 1000));
+        break;
+      default:
+        key = factory->NewJSObjectWithNullProto();
+        break;
+    }
+    keys->set(i, *key);
+    map = OrderedHashMap::Add(isolate, map, key, value);
+    Verify(isolate, map);
+  }
+  CHECK_EQ(keys->length(), map->NumberOfElements());
+
+  // Every entry records the hash of its key, also after the table grew.
+  for (int i = 0; i < keys->length(); i++) {
+    int entry = map->FindEntry(isolate, keys->get(i));
+    CHECK_EQ(i, entry);
+    CHECK_EQ(Smi::ToInt(keys->get(i)->GetHash()), map->HashAt(entry));
+  }
+
+  // Rehashing after deletions carries the hashes over unchanged.
+  for (int i = 0; i < keys->length(); i += 2) {
+    CHECK(OrderedHashMap::Delete(isolate, *map, keys->get(i)));
+  }
+  map = OrderedHashMap::Rehash(isolate, map, 64);
+  Verify(isolate, map);
+  for (int i = 0; i < keys->length(); i++) {
+    int entry = map->FindEntry(isolate, keys->get(i));
+    if (i % 2 == 0) {
+      CHECK_EQ(OrderedHashMap::kNotFound, entry);
+    } else {
+      CHECK_EQ(i / 2, entry);
+      CHECK_EQ(Smi::ToInt(keys->get(i)->GetHash()), map->HashAt(entry));
+    }
+  }
+}
+
 TEST(OrderedHashMapDeletion) {
   LocalContext context;
   Isolate* isolate = GetIsolateFrom(&context);
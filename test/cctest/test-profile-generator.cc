@@ -433,6 +433,94 @@ TEST(RecordTickSample) {
   CHECK_EQ(entry1, node4->entry());
 }
 
+TEST(SourcePositionTableInliningId) {
+  SourcePositionTable table;
+  table.SetPosition(0, 10);
+  table.SetPosition(0x10, 3, 0);
+  table.SetPosition(0x20, 3, 1);
+  table.SetPosition(0x30, 11);
+
+  CHECK_EQ(10, table.GetSourceLineNumber(0x8));
+  CHECK_EQ(SourcePosition::kNotInlined, table.GetInliningId(0x8));
+  CHECK_EQ(3, table.GetSourceLineNumber(0x18));
+  CHECK_EQ(0, table.GetInliningId(0x18));
+  // Same line, but a different inlining id.
+  CHECK_EQ(3, table.GetSourceLineNumber(0x28));
+  CHECK_EQ(1, table.GetInliningId(0x28));
+  CHECK_EQ(11, table.GetSourceLineNumber(0x40));
+  CHECK_EQ(SourcePosition::kNotInlined, table.GetInliningId(0x40));
+}
+
+TEST(RecordTickSampleWithInlineStack) {
+  TestSetup test_setup;
+  i::Isolate* isolate = CcTest::i_isolate();
+  CpuProfilesCollection profiles(isolate);
+  CpuProfiler profiler(isolate);
+  profiles.set_cpu_profiler(&profiler);
+  profiles.StartProfiling("", false);
+  ProfileGenerator generator(&profiles);
+
+  // Code of aaa with bbb inlined at offsets [0x10, 0x30).
+  std::unique_ptr<SourcePositionTable> line_table(new SourcePositionTable());
+  line_table->SetPosition(0, 10);
+  line_table->SetPosition(0x10, 3, 0);
+  line_table->SetPosition(0x20, 4, 0);
+  line_table->SetPosition(0x30, 11);
+  CodeEntry* entry1 = new CodeEntry(
+      i::Logger::FUNCTION_TAG, "aaa", CodeEntry::kEmptyResourceName,
+      v8::CpuProfileNode::kNoLineNumberInfo,
+      v8::CpuProfileNode::kNoColumnNumberInfo, std::move(line_table),
+      0x1500);
+  CodeEntry* inlined_entry =
+      entry1->AddInlinedEntry(std::unique_ptr<CodeEntry>(
+          new CodeEntry(i::Logger::FUNCTION_TAG, "bbb")));
+  entry1->AddInlineStack(0, {{inlined_entry, 3}, {entry1, 10}});
+  CodeEntry* entry2 = new CodeEntry(i::Logger::FUNCTION_TAG, "ccc");
+  generator.code_map()->AddCode(ToAddress(0x1500), entry1, 0x100);
+  generator.code_map()->AddCode(ToAddress(0x1700), entry2, 0x100);
+
+  // We are building the following calls tree:
+  //  ccc -> aaa -> bbb  - sample1, sample2
+  //  ccc -> aaa         - sample3
+  TickSample sample1;
+  sample1.pc = ToPointer(0x1515);
+  sample1.tos = ToPointer(0x1500);
+  sample1.stack[0] = ToPointer(0x1710);
+  sample1.frames_count = 1;
+  generator.RecordTickSample(sample1);
+  TickSample sample2;
+  sample2.pc = ToPointer(0x1525);
+  sample2.tos = ToPointer(0x1500);
+  sample2.stack[0] = ToPointer(0x1710);
+  sample2.frames_count = 1;
+  generator.RecordTickSample(sample2);
+  TickSample sample3;
+  sample3.pc = ToPointer(0x1535);
+  sample3.tos = ToPointer(0x1500);
+  sample3.stack[0] = ToPointer(0x1710);
+  sample3.frames_count = 1;
+  generator.RecordTickSample(sample3);
+
+  CpuProfile* profile = profiles.StopProfiling("");
+  CHECK(profile);
+  ProfileTreeTestHelper top_down_test_helper(profile->top_down());
+  ProfileNode* node1 = top_down_test_helper.Walk(entry2, entry1);
+  CHECK(node1);
+  CHECK_EQ(1, node1->self_ticks());
+  ProfileNode* node2 = top_down_test_helper.Walk(entry2, entry1, inlined_entry);
+  CHECK(node2);
+  CHECK_EQ(2, node2->self_ticks());
+
+  // The ticks of the inlined function are attributed to its own lines.
+  v8::CpuProfileNode::LineTick line_ticks[2];
+  CHECK_EQ(2u, node2->GetHitLineCount());
+  CHECK(node2->GetLineTicks(line_ticks, 2));
+  int line_sum = line_ticks[0].line + line_ticks[1].line;
+  CHECK_EQ(3 + 4, line_sum);
+  CHECK_EQ(1, line_ticks[0].hit_count);
+  CHECK_EQ(1, line_ticks[1].hit_count);
+}
+
 static void CheckNodeIds(const ProfileNode* node, unsigned* expectedId) {
   CHECK_EQ((*expectedId)++, node->id());
   for (const ProfileNode* child : *node->children()) {
@@ -1970,6 +1970,151 @@ TEST(UncachedExternalString) {
   ExpectString("external.substring(1).match(re)[1]", "z");
 }
 
+#ifndef V8_INTERPRETED_REGEXP
+TEST(RegExpTierUp) {
+  FLAG_regexp_tier_up = true;
+  FLAG_regexp_tier_up_ticks = 2;
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  // Both regexps share their data, and thereby their code, through the
+  // compilation cache.
+  CompileRun("var re = /(x+)y\\1/; var other = new RegExp('(x+)y\\\\1');");
+  Handle<JSRegExp> re = Handle<JSRegExp>::cast(
+      v8::Utils::OpenHandle(*CompileRun("re").As<v8::Object>()));
+  Handle<JSRegExp> other = Handle<JSRegExp>::cast(
+      v8::Utils::OpenHandle(*CompileRun("other").As<v8::Object>()));
+  CHECK_EQ(re->data(), other->data());
+  CHECK_EQ(JSRegExp::IRREGEXP, re->TypeTag());
+
+  // The first executions interpret bytecode.
+  ExpectString("re.exec('axxyxx')[1]", "xx");
+  CHECK(re->DataAt(JSRegExp::code_index(true))->IsByteArray());
+  ExpectString("other.exec('axyx')[0]", "xyx");
+  CHECK(re->DataAt(JSRegExp::code_index(true))->IsByteArray());
+  CHECK(re->MarkedForTierUp());
+
+  // The next execution tiers up to native code, with the same results.
+  ExpectString("re.exec('axxyxx')[1]", "xx");
+  CHECK(re->DataAt(JSRegExp::code_index(true))->IsCode());
+  ExpectString("other.exec('axyx')[0]", "xyx");
+  ExpectTrue("re.exec('xyxx').index == 0 && re.exec('ay') === null");
+}
+
+TEST(RegExpTierUpOnBacktrackStackOverflow) {
+  FLAG_regexp_tier_up = true;
+  FLAG_regexp_tier_up_ticks = 100;
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  // The interpreter runs out of backtracking stack on this input, which
+  // native code can handle.
+  CompileRun("var re = /(a|b)*c/; var subject = 'ab'.repeat(20000) + 'c';");
+  ExpectInt32("re.exec(subject)[0].length", 40001);
+  Handle<JSRegExp> re = Handle<JSRegExp>::cast(
+      v8::Utils::OpenHandle(*CompileRun("re").As<v8::Object>()));
+  CHECK(re->DataAt(JSRegExp::code_index(true))->IsCode());
+}
+#endif  // V8_INTERPRETED_REGEXP
+
+TEST(RegExpLinearEngine) {
+  FLAG_regexp_linear_engine = true;
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  CompileRun("var re = /(a|ab)(c|bcd)(d*)/; var unsupported = /(a)\\1/;");
+  Handle<JSRegExp> re = Handle<JSRegExp>::cast(
+      v8::Utils::OpenHandle(*CompileRun("re").As<v8::Object>()));
+  CHECK(re->UsesLinearEngine());
+  Handle<JSRegExp> unsupported = Handle<JSRegExp>::cast(
+      v8::Utils::OpenHandle(*CompileRun("unsupported").As<v8::Object>()));
+  CHECK(!unsupported->UsesLinearEngine());
+
+  // Alternatives are tried in order, like in the backtracking engine.
+  ExpectString("re.exec('xabcd').join()", "abcd,a,bcd,");
+  ExpectString("'aaa'.replace(/a*?/g, 'x')", "xaxaxax");
+  ExpectString("/(z)((a+)?(b+)?(c))*/.exec('zaacbbbcac').join()",
+               "zaacbbbcac,z,ac,a,,c");
+  ExpectTrue("/^\\bfoo$/m.test('bar\\nfoo') && !/x{2,3}/y.test('axx')");
+  // Catastrophic backtracking patterns take linear time.
+  ExpectTrue("/(a*)*b/.exec('a'.repeat(100000)) === null");
+}
+
+TEST(RegExpLinearFallbackOnExcessiveBacktracks) {
+  FLAG_regexp_linear_fallback = true;
+  FLAG_regexp_backtracks_before_fallback = 1000;
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  CompileRun("var re = /(x+x+)+y/;");
+  Handle<JSRegExp> re = Handle<JSRegExp>::cast(
+      v8::Utils::OpenHandle(*CompileRun("re").As<v8::Object>()));
+  CHECK(re->HasLinearFallback());
+
+  // Regexps which don't backtrack much keep using the backtracking engine.
+  ExpectString("re.exec('xxxy')[1]", "xxx");
+  CHECK(re->HasLinearFallback());
+
+  // Exponential backtracking switches the regexp over.
+  ExpectTrue("re.exec('x'.repeat(50)) === null");
+  CHECK(re->UsesLinearEngine());
+  ExpectString("re.exec('axxxxy')[1]", "xxxx");
+}
+
+static Object* LiteralPrefix(const char* regexp) {
+  Handle<JSRegExp> re = Handle<JSRegExp>::cast(
+      v8::Utils::OpenHandle(*CompileRun(regexp).As<v8::Object>()));
+  CHECK_EQ(JSRegExp::IRREGEXP, re->TypeTag());
+  return re->DataAt(JSRegExp::kIrregexpLiteralPrefixIndex);
+}
+
+TEST(RegExpResultsCacheGrowsOnEvictions) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+  Handle<String> pattern = factory->InternalizeUtf8String(",");
+  Handle<String> last;
+  for (int i = 0; i < 4 * RegExpResultsCache::kInitialSize; i++) {
+    EmbeddedVector<char, 32> buffer;
+    SNPrintF(buffer, "key%d", i);
+    last = factory->InternalizeUtf8String(buffer.start());
+    Handle<FixedArray> value = factory->NewFixedArray(1);
+    value->set(0, *last);
+    RegExpResultsCache::Enter(isolate, last, pattern, value,
+                              factory->empty_fixed_array(),
+                              RegExpResultsCache::STRING_SPLIT_SUBSTRINGS);
+  }
+  CHECK_LT(RegExpResultsCache::kInitialSize,
+           isolate->heap()->string_split_cache()->length());
+  FixedArray last_match;
+  CHECK_NE(Smi::kZero, RegExpResultsCache::Lookup(
+                           isolate->heap(), *last, *pattern, &last_match,
+                           RegExpResultsCache::STRING_SPLIT_SUBSTRINGS));
+}
+
+TEST(RegExpLiteralPrefix) {
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  CHECK(String::cast(LiteralPrefix("/foo(\\d+)/"))->IsUtf8EqualTo(
+      CStrVector("foo")));
+  CHECK(String::cast(LiteralPrefix("/^\\b(?:ab)+c/m"))->IsUtf8EqualTo(
+      CStrVector("ab")));
+  CHECK(String::cast(LiteralPrefix("/(?=a)(a)(bc)?d/"))->IsUtf8EqualTo(
+      CStrVector("a")));
+  CHECK_EQ(Smi::kZero, LiteralPrefix("/a|b/"));
+  CHECK_EQ(Smi::kZero, LiteralPrefix("/x*y/"));
+  CHECK_EQ(Smi::kZero, LiteralPrefix("/foo\\d/i"));
+  CHECK_EQ(Smi::kZero, LiteralPrefix("/foo\\d/y"));
+
+  // Matching starts at the first occurrence of the prefix, from both the
+  // native fast path and the runtime.
+  CompileRun(
+      "var subject = 'x'.repeat(1000) + 'foo1 foo fo2 foo23';"
+      "var re = /foo(\\d+)/g;");
+  ExpectString("re.exec(subject)[1] + re.exec(subject)[1]", "123");
+  ExpectInt32("re.lastIndex", 1018);
+  ExpectTrue("re.exec(subject) === null && re.lastIndex == 0");
+  ExpectString("subject.replace(re, '[$1]').slice(1000)", "[1] foo fo2 [23]");
+  ExpectTrue("/(?<=x)foo/.exec(subject).index == 1000");
+}
+
 }  // namespace test_regexp
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,104 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <stdlib.h>
+
+#include "src/v8.h"
+
+#include "src/base/platform/platform.h"
+#include "src/bignum-dtoa.h"
+#include "src/double.h"
+#include "src/ryu-dtoa.h"
+#include "test/cctest/cctest.h"
+#include "test/cctest/gay-shortest.h"
+
+namespace v8 {
+namespace internal {
+namespace test_ryu_dtoa {
+
+static const int kBufferSize = 100;
+
+static void CheckShortest(double v, const char* expected, int expected_point) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+  RyuDtoa(v, buffer, &length, &point);
+  CHECK_EQ(0, strcmp(expected, buffer.start()));
+  CHECK_EQ(StrLength(expected), length);
+  CHECK_EQ(expected_point, point);
+}
+
+TEST(RyuDtoaShortestVariousDoubles) {
+  CheckShortest(5e-324, "5", -323);
+  CheckShortest(1.7976931348623157e308, "17976931348623157", 309);
+  CheckShortest(4294967272.0, "4294967272", 10);
+  CheckShortest(4.1855804968213567e298, "4185580496821357", 299);
+  CheckShortest(5.5626846462680035e-309, "5562684646268003", -308);
+  CheckShortest(2147483648.0, "2147483648", 10);
+  // FastDtoa fails on this one and needs the bignum fallback.
+  CheckShortest(3.5844466002796428e+298, "35844466002796428", 299);
+  CheckShortest(1.0, "1", 1);
+  CheckShortest(0.1, "1", 0);
+  CheckShortest(0.3, "3", 0);
+  CheckShortest(123e45, "123", 48);
+  CheckShortest(9007199254740991.0, "9007199254740991", 16);
+  CheckShortest(9007199254740992.0, "9007199254740992", 16);
+  CheckShortest(1e23, "1", 24);
+
+  uint64_t smallest_normal64 = V8_2PART_UINT64_C(0x00100000, 00000000);
+  CheckShortest(Double(smallest_normal64).value(), "22250738585072014", -307);
+
+  uint64_t largest_denormal64 = V8_2PART_UINT64_C(0x000FFFFF, FFFFFFFF);
+  CheckShortest(Double(largest_denormal64).value(), "2225073858507201", -307);
+}
+
+TEST(RyuDtoaGayShortest) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+  bool needed_max_length = false;
+
+  Vector<const PrecomputedShortest> precomputed =
+      PrecomputedShortestRepresentations();
+  for (int i = 0; i < precomputed.length(); ++i) {
+    const PrecomputedShortest current_test = precomputed[i];
+    RyuDtoa(current_test.v, buffer, &length, &point);
+    CHECK_GE(kRyuDtoaMaximalLength, length);
+    if (length == kRyuDtoaMaximalLength) needed_max_length = true;
+    CHECK_EQ(current_test.decimal_point, point);
+    CHECK_EQ(0, strcmp(current_test.representation, buffer.start()));
+  }
+  CHECK(needed_max_length);
+}
+
+// Compares against the bignum algorithm on pseudo-random bit patterns, which
+// cover all exponents including the denormals.
+TEST(RyuDtoaMatchesBignumDtoa) {
+  char ryu_container[kBufferSize];
+  Vector<char> ryu_buffer(ryu_container, kBufferSize);
+  char bignum_container[kBufferSize];
+  Vector<char> bignum_buffer(bignum_container, kBufferSize);
+  uint64_t bits = 42;
+  for (int i = 0; i < 100000; i++) {
+    bits = bits * V8_2PART_UINT64_C(0x5851F42D, 4C957F2D) +
+           V8_2PART_UINT64_C(0x14057B7E, F767814F);
+    Double d(bits & ~Double::kSignMask);
+    if (d.IsSpecial() || d.value() == 0) continue;
+    int ryu_length, ryu_point;
+    RyuDtoa(d.value(), ryu_buffer, &ryu_length, &ryu_point);
+    int bignum_length, bignum_point;
+    BignumDtoa(d.value(), BIGNUM_DTOA_SHORTEST, 0, bignum_buffer,
+               &bignum_length, &bignum_point);
+    bignum_buffer[bignum_length] = '\0';
+    CHECK_EQ(bignum_length, ryu_length);
+    CHECK_EQ(bignum_point, ryu_point);
+    CHECK_EQ(0, strcmp(bignum_buffer.start(), ryu_buffer.start()));
+  }
+}
+
+}  // namespace test_ryu_dtoa
+}  // namespace internal
+}  // namespace v8
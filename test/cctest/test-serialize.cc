@@ -2364,6 +2364,201 @@ TEST(CodeSerializerAfterExecute) {
   FLAG_always_opt = prev_always_opt_value;
 }
 
+static void TestConsumeCodeCacheTask(bool corrupt) {
+  const char* source_code = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(source_code);
+  if (corrupt) {
+    // Flip a bit in the payload so that the background checksum fails.
+    const_cast<uint8_t*>(cache->data)[cache->length - 1] ^= 1;
+  }
+
+  v8::ScriptCompiler::ConsumeCodeCacheTask* task =
+      v8::ScriptCompiler::StartConsumingCodeCache(cache);
+  task->Run();
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(source_code), origin, cache,
+                                      task);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK_EQ(corrupt, source.GetCachedData()->rejected);
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->ToString(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerConsumeCodeCacheTask) { TestConsumeCodeCacheTask(false); }
+
+TEST(CodeSerializerConsumeCodeCacheTaskBadChecksum) {
+  TestConsumeCodeCacheTask(true);
+}
+
+TEST(CodeSerializerOptimizationHints) {
+  if (!FLAG_opt) return;
+  FLAG_allow_natives_syntax = true;
+  FLAG_code_cache_optimization_hints = true;
+  const char* source =
+      "function f() { return 'abc'; };"
+      "function g() { return 'xyz'; };"
+      "f(); g(); %OptimizeFunctionOnNextCall(f); f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    // Only the function optimized before the cache was produced carries the
+    // hint.
+    Handle<SharedFunctionInfo> sfi = v8::Utils::OpenHandle(*script);
+    SharedFunctionInfo::ScriptIterator iterator(
+        reinterpret_cast<Isolate*>(isolate2), Script::cast(sfi->script()));
+    int hinted = 0;
+    for (SharedFunctionInfo next = iterator.Next(); !next.is_null();
+         next = iterator.Next()) {
+      if (!next->HasBytecodeArray()) continue;
+      if (next->GetBytecodeArray()->has_optimization_hint()) {
+        CHECK(next->Name()->IsUtf8EqualTo(i::CStrVector("f")));
+        hinted++;
+      }
+    }
+    CHECK_EQ(1, hinted);
+  }
+  isolate2->Dispose();
+  delete cache;
+}
+
+TEST(CodeSerializerLazyFunctions) {
+  FLAG_code_cache_lazy_functions = true;
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script;
+    {
+      DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate2));
+      script = v8::ScriptCompiler::CompileUnboundScript(
+                   isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+                   .ToLocalChecked();
+    }
+    CHECK(!cache->rejected);
+    CheckDeserializedFlag(script);
+
+    // Only the top-level code comes from the cache. f had been compiled when
+    // the cache was produced, but is only compiled again on its first call.
+    Handle<SharedFunctionInfo> sfi = v8::Utils::OpenHandle(*script);
+    SharedFunctionInfo::ScriptIterator iterator(
+        reinterpret_cast<Isolate*>(isolate2), Script::cast(sfi->script()));
+    for (SharedFunctionInfo next = iterator.Next(); !next.is_null();
+         next = iterator.Next()) {
+      CHECK_EQ(next->is_toplevel(), next->is_compiled());
+    }
+
+    v8::Local<v8::Value> result = script->BindToCurrentContext()
+                                      ->Run(isolate2->GetCurrentContext())
+                                      .ToLocalChecked();
+    CHECK(result->ToString(isolate2->GetCurrentContext())
+              .ToLocalChecked()
+              ->Equals(isolate2->GetCurrentContext(), v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+  delete cache;
+}
+
+TEST(CodeSerializerInliningHints) {
+  if (!FLAG_opt || !FLAG_turbo_inlining) return;
+  FLAG_allow_natives_syntax = true;
+  FLAG_code_cache_optimization_hints = true;
+  const char* source =
+      "function callee() { return 'abc'; };"
+      "function caller() { return callee() + 'def'; };"
+      "function other() { return 'xyz'; };"
+      "caller(); caller(); other();"
+      "%OptimizeFunctionOnNextCall(caller); caller()";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    // Only the function inlined into optimized code carries the hint.
+    Handle<SharedFunctionInfo> sfi = v8::Utils::OpenHandle(*script);
+    SharedFunctionInfo::ScriptIterator iterator(
+        reinterpret_cast<Isolate*>(isolate2), Script::cast(sfi->script()));
+    int hinted = 0;
+    for (SharedFunctionInfo next = iterator.Next(); !next.is_null();
+         next = iterator.Next()) {
+      if (!next->HasBytecodeArray()) continue;
+      if (next->GetBytecodeArray()->has_inlining_hint()) {
+        CHECK(next->Name()->IsUtf8EqualTo(i::CStrVector("callee")));
+        hinted++;
+      }
+    }
+    CHECK_EQ(1, hinted);
+  }
+  isolate2->Dispose();
+  delete cache;
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
@@ -38,6 +38,7 @@
 #include "src/heap/factory.h"
 #include "src/messages.h"
 #include "src/objects-inl.h"
+#include "src/string-search.h"
 #include "src/unicode-decoder.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
@@ -1243,6 +1244,49 @@ TEST(CachedHashOverflow) {
 }
 
 
+static int ConsStringDepth(String string) {
+  int depth = 0;
+  while (string->IsConsString()) {
+    string = ConsString::cast(string)->first();
+    depth++;
+  }
+  return depth;
+}
+
+TEST(ConsStringCoalescesShortAppends) {
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext context;
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  const int kAppends = 1000;
+
+  // Appends in generated code.
+  Handle<String> string =
+      Handle<String>::cast(v8::Utils::OpenHandle(*CompileRun(
+          "var s = 'abcdefghijklmnopqrstuvwxyz';"
+          "for (var i = 0; i < 1000; i++) s += '12';"
+          "s")));
+  CHECK(string->IsConsString());
+  CHECK_GT(kAppends / 8, ConsStringDepth(*string));
+  CHECK(CompileRun("s == 'abcdefghijklmnopqrstuvwxyz' + '12'.repeat(1000)")
+            ->IsTrue());
+
+  // Appends in the runtime.
+  Handle<String> part = factory->NewStringFromAsciiChecked("12");
+  string = factory->NewStringFromAsciiChecked("abcdefghijklmnopqrstuvwxyz");
+  for (int i = 0; i < kAppends; i++) {
+    string = factory->NewConsString(string, part).ToHandleChecked();
+  }
+  CHECK_GT(kAppends / 8, ConsStringDepth(*string));
+  string = String::Flatten(isolate, string);
+  CHECK_EQ(26 + 2 * kAppends, string->length());
+  for (int i = 26; i < string->length(); i += 2) {
+    CHECK_EQ('1', string->Get(i));
+    CHECK_EQ('2', string->Get(i + 1));
+  }
+}
+
 TEST(SliceFromCons) {
   if (!FLAG_string_slices) return;
   CcTest::InitializeVM();
@@ -1678,6 +1722,54 @@ TEST(ExternalStringIndexOf) {
                    .FromJust());
 }
 
+template <typename SubjectChar, typename PatternChar>
+static int NaiveSearch(Vector<const SubjectChar> subject,
+                       Vector<const PatternChar> pattern, int index) {
+  for (int i = index; i + pattern.length() <= subject.length(); i++) {
+    int j = 0;
+    while (j < pattern.length() && subject[i + j] == pattern[j]) j++;
+    if (j == pattern.length()) return i;
+  }
+  return -1;
+}
+
+template <typename SubjectChar, typename PatternChar>
+static void TestShortPatternSearch(uc16 high) {
+  Isolate* isolate = CcTest::i_isolate();
+  // A small alphabet produces many candidates which only match partially.
+  // Lengths cover both the vectorized loop and its scalar tail.
+  const int kLength = 83;
+  SubjectChar subject[kLength];
+  srand(42);
+  for (int i = 0; i < kLength; i++) {
+    subject[i] = static_cast<SubjectChar>((rand() % 3 == 0) ? high : 'a');
+  }
+  Vector<const SubjectChar> subject_vector(subject, kLength);
+  for (int pattern_length = 1; pattern_length <= 8; pattern_length++) {
+    for (int start = 0; start + pattern_length <= kLength; start += 7) {
+      PatternChar pattern[8];
+      for (int i = 0; i < pattern_length; i++) {
+        pattern[i] = static_cast<PatternChar>(subject[start + i]);
+      }
+      Vector<const PatternChar> pattern_vector(pattern, pattern_length);
+      for (int index = 0; index <= kLength; index += 5) {
+        CHECK_EQ(NaiveSearch(subject_vector, pattern_vector, index),
+                 SearchString(isolate, subject_vector, pattern_vector, index));
+      }
+    }
+  }
+}
+
+TEST(SearchStringShortPatterns) {
+  CcTest::InitializeVM();
+  TestShortPatternSearch<uint8_t, uint8_t>('b');
+  TestShortPatternSearch<uint8_t, uc16>('b');
+  TestShortPatternSearch<uc16, uint8_t>('b');
+  TestShortPatternSearch<uc16, uc16>('b');
+  // Two-byte characters whose low byte equals a one-byte character.
+  TestShortPatternSearch<uc16, uc16>(0x0161);
+}
+
 #define GC_INSIDE_NEW_STRING_FROM_UTF8_SUB_STRING(NAME, STRING)                \
   TEST(GCInsideNewStringFromUtf8SubStringWith##NAME) {                         \
     CcTest::InitializeVM();                                                    \
@@ -1749,6 +1841,57 @@ TEST(HashArrayIndexStrings) {
            isolate->factory()->one_string()->Hash());
 }
 
+TEST(WideStringHash) {
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  uint64_t seed = isolate->heap()->HashSeed();
+
+  const int kLengths[] = {StringHasher::kWideHashMinLength - 1,
+                          StringHasher::kWideHashMinLength,
+                          StringHasher::kWideHashMinLength + 1, 63, 64, 1000};
+  for (int length : kLengths) {
+    std::vector<char> chars(length);
+    for (int i = 0; i < length; i++) chars[i] = 'a' + (i * 7) % 26;
+    Vector<const char> vector(chars.data(), length);
+
+    // All representations of the same characters hash alike.
+    Handle<String> one_byte =
+        factory->NewStringFromOneByte(Vector<const uint8_t>::cast(vector))
+            .ToHandleChecked();
+    Handle<SeqTwoByteString> two_byte =
+        factory->NewRawTwoByteString(length).ToHandleChecked();
+    {
+      DisallowHeapAllocation no_gc;
+      CopyChars(two_byte->GetChars(no_gc), chars.data(), length);
+    }
+    // Split off an odd number of characters, so the second half isn't hashed
+    // from the start of a block.
+    Handle<String> left =
+        factory->NewStringFromOneByte(Vector<const uint8_t>::cast(
+                                          vector.SubVector(0, 5)))
+            .ToHandleChecked();
+    Handle<String> right =
+        factory->NewStringFromOneByte(Vector<const uint8_t>::cast(
+                                          vector.SubVector(5, length)))
+            .ToHandleChecked();
+    Handle<String> cons =
+        factory->NewConsString(left, right).ToHandleChecked();
+    uint32_t hash = one_byte->Hash();
+    CHECK_EQ(hash, two_byte->Hash());
+    CHECK_EQ(hash, cons->Hash());
+    int utf16_length;
+    CHECK_EQ(hash, StringHasher::ComputeUtf8Hash(vector, seed, &utf16_length) >>
+                       Name::kHashShift);
+    CHECK_EQ(length, utf16_length);
+
+    // The seed changes the hash.
+    CHECK_NE(StringHasher::HashSequentialString(chars.data(), length, 1),
+             StringHasher::HashSequentialString(chars.data(), length, 2));
+  }
+}
+
 TEST(StringEquals) {
   v8::V8::Initialize();
   v8::Isolate* isolate = CcTest::isolate();
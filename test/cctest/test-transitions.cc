@@ -4,6 +4,7 @@
 
 #include <stdlib.h>
 #include <utility>
+#include <vector>
 
 #include "src/v8.h"
 
@@ -183,6 +184,50 @@ TEST(TransitionArray_DifferentFieldNames) {
 }
 
 
+// Wide transition arrays are searched with interpolation on the hashes.
+TEST(TransitionArray_ManyFieldNames) {
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+
+  const int PROPS_COUNT = 1000;
+  std::vector<Handle<String>> names;
+  std::vector<Handle<Map>> maps;
+  PropertyAttributes attributes = NONE;
+
+  Handle<Map> map0 = Map::Create(isolate, 0);
+  for (int i = 0; i < PROPS_COUNT; i++) {
+    EmbeddedVector<char, 64> buffer;
+    SNPrintF(buffer, "prop%d", i);
+    Handle<String> name = factory->InternalizeUtf8String(buffer.start());
+    Handle<Map> map =
+        Map::CopyWithField(isolate, map0, name, FieldType::Any(isolate),
+                           attributes, PropertyConstness::kMutable,
+                           Representation::Tagged(), OMIT_TRANSITION)
+            .ToHandleChecked();
+    names.push_back(name);
+    maps.push_back(map);
+
+    TransitionsAccessor(isolate, map0).Insert(name, map, PROPERTY_TRANSITION);
+  }
+
+  TransitionsAccessor transitions(isolate, map0);
+  CHECK_EQ(PROPS_COUNT, transitions.NumberOfTransitions());
+  DCHECK(transitions.IsSortedNoDuplicates());
+  for (int i = 0; i < PROPS_COUNT; i++) {
+    CHECK_EQ(*maps[i],
+             transitions.SearchTransition(*names[i], kData, attributes));
+  }
+  for (int i = 0; i < PROPS_COUNT; i++) {
+    EmbeddedVector<char, 64> buffer;
+    SNPrintF(buffer, "absent%d", i);
+    Handle<String> name = factory->InternalizeUtf8String(buffer.start());
+    CHECK(transitions.SearchTransition(*name, kData, attributes).is_null());
+  }
+}
+
+
 TEST(TransitionArray_SameFieldNamesDifferentAttributesSimple) {
   CcTest::InitializeVM();
   v8::HandleScope scope(CcTest::isolate());
@@ -324,6 +324,64 @@ TEST(Unwind_TwoJSFrames_Success) {
   CHECK_EQ(reinterpret_cast<void*>(100), register_state.pc);
 }
 
+// Unwinding two JS frames should record the PC of each of them, innermost
+// first, and stop recording (but not unwinding) once the buffer is full.
+TEST(Unwind_TwoJSFrames_RecordsFramePCs) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+
+  UnwindState unwind_state = isolate->GetUnwindState();
+  RegisterState register_state;
+
+  const size_t code_length = 40;
+  uintptr_t code[code_length] = {0};
+  unwind_state.code_range.start = code;
+  unwind_state.code_range.length_in_bytes = code_length * sizeof(uintptr_t);
+
+  uintptr_t stack[10];
+  void* stack_base = stack + arraysize(stack);
+  stack[0] = 101;
+  stack[1] = 111;
+  stack[2] = reinterpret_cast<uintptr_t>(stack + 5);  // saved FP (rbp).
+  // The fake return address is in the JS code range.
+  stack[3] = reinterpret_cast<uintptr_t>(code + 10);
+  stack[4] = 141;
+  stack[5] = reinterpret_cast<uintptr_t>(stack + 9);  // saved FP (rbp).
+  stack[6] = 100;  // Return address into C++ code.
+  stack[7] = 303;  // The SP points here in the caller's frame.
+  stack[8] = 404;
+  stack[9] = 505;
+
+  register_state.sp = stack;
+  register_state.fp = stack + 2;
+  register_state.pc = code + 30;
+  RegisterState saved_register_state = register_state;
+
+  void* frame_pcs[4] = {nullptr};
+  size_t frame_count = 0;
+  bool unwound = v8::Unwinder::TryUnwindV8Frames(
+      unwind_state, &register_state, stack_base, frame_pcs,
+      arraysize(frame_pcs), &frame_count);
+
+  CHECK(unwound);
+  CHECK_EQ(2, frame_count);
+  CHECK_EQ(reinterpret_cast<void*>(code + 30), frame_pcs[0]);
+  CHECK_EQ(reinterpret_cast<void*>(code + 10), frame_pcs[1]);
+  CHECK_EQ(reinterpret_cast<void*>(stack + 9), register_state.fp);
+  CHECK_EQ(reinterpret_cast<void*>(stack + 7), register_state.sp);
+  CHECK_EQ(reinterpret_cast<void*>(100), register_state.pc);
+
+  // With room for only one PC, unwinding still reaches the C++ frame.
+  register_state = saved_register_state;
+  unwound = v8::Unwinder::TryUnwindV8Frames(unwind_state, &register_state,
+                                            stack_base, frame_pcs, 1,
+                                            &frame_count);
+  CHECK(unwound);
+  CHECK_EQ(1, frame_count);
+  CHECK_EQ(reinterpret_cast<void*>(code + 30), frame_pcs[0]);
+  CHECK_EQ(reinterpret_cast<void*>(100), register_state.pc);
+}
+
 // If the PC is in JSEntry then the frame might not be set up correctly, meaning
 // we can't unwind the stack properly.
 TEST(Unwind_JSEntry_Fail) {
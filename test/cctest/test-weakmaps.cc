@@ -247,6 +247,44 @@ TEST(Regress399527) {
   CcTest::CollectAllGarbage();
 }
 
+TEST(IncrementalEphemeronChain) {
+  if (!FLAG_incremental_marking) return;
+  FLAG_incremental_ephemerons = true;
+  ManualGCScope manual_gc_scope;
+  LocalContext context;
+  Isolate* isolate = GetIsolateFrom(&context);
+  Factory* factory = isolate->factory();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+  Handle<JSWeakMap> weakmap = factory->NewJSWeakMap();
+
+  // Build a chain of ephemerons in which each value is the key of the next
+  // entry. Entries are inserted back to front so that resolving the chain
+  // takes one visit per entry.
+  static const int kChainLength = 64;
+  Handle<JSObject> first;
+  {
+    HandleScope inner_scope(isolate);
+    Handle<Map> map = factory->NewMap(JS_OBJECT_TYPE, JSObject::kHeaderSize);
+    Handle<JSObject> value = factory->NewJSObjectFromMap(map);
+    for (int i = 0; i < kChainLength; i++) {
+      Handle<JSObject> key = factory->NewJSObjectFromMap(map);
+      int32_t hash = key->GetOrCreateHash(isolate)->value();
+      JSWeakCollection::Set(weakmap, key, value, hash);
+      value = key;
+    }
+    first = inner_scope.CloseAndEscape(value);
+  }
+  CHECK_EQ(kChainLength,
+           EphemeronHashTable::cast(weakmap->table())->NumberOfElements());
+
+  // The whole chain is reachable from |first|.
+  heap::SimulateIncrementalMarking(heap);
+  CcTest::CollectAllGarbage();
+  CHECK_EQ(kChainLength,
+           EphemeronHashTable::cast(weakmap->table())->NumberOfElements());
+}
+
 }  // namespace test_weakmaps
 }  // namespace internal
 }  // namespace v8
@@ -127,6 +127,30 @@ TEST(Run_WasmBlockBreakN) {
   }
 }
 
+TEST(Run_WasmPaddedImmediates) {
+  // Immediates are pre-decoded once; make sure the lengths of non-minimal
+  // LEB128 encodings are respected.
+  WasmRunner<int32_t, int32_t> r(ExecutionTier::kInterpreter);
+  int32_t* memory =
+      r.builder().AddMemoryElems<int32_t>(kWasmPageSize / sizeof(int32_t));
+  r.builder().WriteMemory(&memory[1], 11);
+  byte code[] = {
+      kExprBlock, kLocalI32,                          // block
+      kExprGetLocal, 0x80, 0x80, 0x00,                // local 0
+      kExprI32Const, 0x85, 0x80, 0x80, 0x80, 0x00,    // 5
+      kExprI32Add,                                    // add
+      kExprTeeLocal, 0x80, 0x00,                      // local 0
+      kExprGetLocal, 0x00,                            // local 0
+      kExprBrIf, 0x80, 0x00,                          // depth 0
+      kExprDrop,                                      // drop
+      kExprI32Const, 0x00,                            // 0
+      kExprI32LoadMem, 0x82, 0x00, 0x84, 0x80, 0x00,  // offset 4
+      kExprEnd};
+  r.Build(code, code + arraysize(code));
+  CHECK_EQ(7, r.Call(2));
+  CHECK_EQ(11, r.Call(-5));
+}
+
 TEST(Run_Wasm_nested_ifs_i) {
   WasmRunner<int32_t, int32_t, int32_t> r(ExecutionTier::kInterpreter);
 
@@ -2281,6 +2281,66 @@ WASM_EXEC_TEST(Call_Int32Add) {
   }
 }
 
+WASM_EXEC_TEST(ReturnCall_Sum) {
+  EXPERIMENTAL_FLAG_SCOPE(return_call);
+  TestSignatures sigs;
+  WasmRunner<int32_t, int32_t> r(execution_tier);
+
+  // sum(n, acc) = n == 0 ? acc : sum(n - 1, acc + n), deep enough to overflow
+  // the stack unless the recursive call reuses the frame.
+  WasmFunctionCompiler& sum = r.NewFunction(sigs.i_ii());
+  BUILD(sum,
+        WASM_IF(WASM_I32_EQZ(WASM_GET_LOCAL(0)),
+                WASM_RETURN1(WASM_GET_LOCAL(1))),
+        WASM_RETURN_CALL_FUNCTION(
+            sum.function_index(), WASM_I32_SUB(WASM_GET_LOCAL(0), WASM_ONE),
+            WASM_I32_ADD(WASM_GET_LOCAL(1), WASM_GET_LOCAL(0))));
+
+  BUILD(r, WASM_CALL_FUNCTION(sum.function_index(), WASM_GET_LOCAL(0),
+                              WASM_ZERO));
+
+  const int32_t kDepths[] = {0, 1, 10, 1000, 1000000};
+  for (int32_t depth : kDepths) {
+    uint32_t expected = 0;
+    for (int32_t i = 1; i <= depth; ++i) expected += static_cast<uint32_t>(i);
+    CHECK_EQ(static_cast<int32_t>(expected), r.Call(depth));
+  }
+}
+
+WASM_EXEC_TEST(ReturnCallIndirect) {
+  EXPERIMENTAL_FLAG_SCOPE(return_call);
+  TestSignatures sigs;
+  WasmRunner<int32_t, int32_t> r(execution_tier);
+
+  WasmFunctionCompiler& t1 = r.NewFunction(sigs.i_ii());
+  BUILD(t1, WASM_I32_ADD(WASM_GET_LOCAL(0), WASM_GET_LOCAL(1)));
+  t1.SetSigIndex(1);
+
+  WasmFunctionCompiler& t2 = r.NewFunction(sigs.i_ii());
+  BUILD(t2, WASM_I32_SUB(WASM_GET_LOCAL(0), WASM_GET_LOCAL(1)));
+  t2.SetSigIndex(1);
+
+  // Signature table.
+  r.builder().AddSignature(sigs.f_ff());
+  r.builder().AddSignature(sigs.i_ii());
+
+  // Function table.
+  uint16_t indirect_function_table[] = {
+      static_cast<uint16_t>(t1.function_index()),
+      static_cast<uint16_t>(t2.function_index())};
+  r.builder().AddIndirectFunctionTable(indirect_function_table,
+                                       arraysize(indirect_function_table));
+  r.builder().PopulateIndirectFunctionTable();
+
+  // Build the caller function.
+  BUILD(r, WASM_RETURN_CALL_INDIRECTN(2, 1, WASM_GET_LOCAL(0), WASM_I32V_2(66),
+                                      WASM_I32V_1(22)));
+
+  CHECK_EQ(88, r.Call(0));
+  CHECK_EQ(44, r.Call(1));
+  CHECK_TRAP(r.Call(2));
+}
+
 WASM_EXEC_TEST(Call_Float32Sub) {
   WasmRunner<float, float, float> r(execution_tier);
 
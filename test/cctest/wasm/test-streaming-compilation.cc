@@ -1085,6 +1085,31 @@ STREAM_TEST(TestDeserializationFails) {
   CHECK(tester.IsPromiseFulfilled());
 }
 
+// Test that cached bytes for different wire bytes are dropped as soon as more
+// wire bytes arrive than the cached module was compiled from.
+STREAM_TEST(TestDeserializationFailsForLargerWireBytes) {
+  StreamTester tester;
+  ZoneBuffer wire_bytes = GetValidModuleBytes(tester.zone());
+  ZoneBuffer module_bytes =
+      GetValidCompiledModuleBytes(tester.zone(), wire_bytes);
+  tester.SetCompiledModuleBytes(module_bytes.begin(), module_bytes.size());
+  tester.OnBytesReceived(wire_bytes.begin(), wire_bytes.size());
+  const uint8_t custom_section[] = {
+      kUnknownSectionCode,  // section code
+      U32V_1(2),            // section size
+      U32V_1(1),            // name length
+      'x',                  // name
+  };
+  tester.OnBytesReceived(custom_section, arraysize(custom_section));
+  tester.FinishStream();
+
+  tester.RunCompilerTasks();
+
+  CHECK(tester.IsPromiseFulfilled());
+  CHECK_EQ(wire_bytes.size() + arraysize(custom_section),
+           tester.native_module()->wire_bytes().size());
+}
+
 // Test that a non-empty function section with a missing code section fails.
 STREAM_TEST(TestFunctionSectionWithoutCodeSection) {
   StreamTester tester;
@@ -0,0 +1,76 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <map>
+
+#include "src/profiler/cpu-profiler.h"
+#include "src/profiler/profiler-listener.h"
+#include "src/source-position-table.h"
+#include "test/cctest/cctest.h"
+#include "test/cctest/wasm/wasm-run-utils.h"
+#include "test/common/wasm/wasm-macro-gen.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+namespace test_wasm_profiler {
+
+namespace {
+
+class CodeEntryRecorder : public CodeEventObserver {
+ public:
+  void CodeEventHandler(const CodeEventsContainer& evt_rec) override {
+    if (evt_rec.generic.type != CodeEventRecord::CODE_CREATION) return;
+    entry_.reset(evt_rec.CodeCreateEventRecord_.entry);
+  }
+
+  CodeEntry* entry() const { return entry_.get(); }
+
+ private:
+  std::unique_ptr<CodeEntry> entry_;
+};
+
+void CheckWasmLineTable(ExecutionTier tier) {
+  WasmRunner<int32_t> r(tier);
+  WasmFunctionCompiler& callee = r.NewFunction<int32_t>();
+  BUILD(callee, WASM_I32V_1(7));
+  BUILD(r, WASM_NOP, WASM_CALL_FUNCTION0(callee.function_index()));
+
+  WasmCode* code = r.builder().GetFunctionCode(r.function_index());
+  CHECK(!code->source_positions().is_empty());
+
+  CodeEntryRecorder recorder;
+  ProfilerListener listener(CcTest::i_isolate(), &recorder);
+  listener.CodeCreateEvent(CodeEventListener::FUNCTION_TAG, code,
+                           CStrVector("main"));
+  CodeEntry* entry = recorder.entry();
+  CHECK_NOT_NULL(entry);
+  CHECK_NOT_NULL(entry->line_info());
+
+  // Every code offset maps to the byte offset of its wasm instruction. If
+  // there are several positions at one offset, the last one counts.
+  std::map<int, int> byte_offsets;
+  for (SourcePositionTableIterator it(code->source_positions()); !it.done();
+       it.Advance()) {
+    byte_offsets[it.code_offset()] = it.source_position().ScriptOffset();
+  }
+  for (const auto& pair : byte_offsets) {
+    CHECK_EQ(pair.second + 1, entry->GetSourceLine(pair.first));
+  }
+}
+
+}  // namespace
+
+TEST(ProfilerWasmLineTableLiftoff) {
+  CheckWasmLineTable(ExecutionTier::kBaseline);
+}
+
+TEST(ProfilerWasmLineTableTurbofan) {
+  CheckWasmLineTable(ExecutionTier::kOptimized);
+}
+
+}  // namespace test_wasm_profiler
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
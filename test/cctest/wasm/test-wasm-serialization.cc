@@ -211,6 +211,17 @@ TEST(DeserializeValidModule) {
   Cleanup();
 }
 
+TEST(DeserializeWithLazyRelocation) {
+  FlagScope<bool> lazy_relocation(&FLAG_wasm_lazy_relocation, true);
+  WasmSerializationTest test;
+  {
+    HandleScope scope(test.current_isolate());
+    test.DeserializeAndRun();
+  }
+  Cleanup(test.current_isolate());
+  Cleanup();
+}
+
 TEST(DeserializeMismatchingVersion) {
   WasmSerializationTest test;
   {
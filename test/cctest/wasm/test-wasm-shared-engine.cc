@@ -12,6 +12,7 @@
 #include "src/wasm/wasm-objects-inl.h"
 
 #include "test/cctest/cctest.h"
+#include "test/common/wasm/flag-utils.h"
 #include "test/common/wasm/test-signatures.h"
 #include "test/common/wasm/wasm-macro-gen.h"
 #include "test/common/wasm/wasm-module-runner.h"
@@ -257,6 +258,35 @@ TEST(SharedEngineRunImported) {
   CHECK_EQ(1, module.use_count());
 }
 
+TEST(SharedEngineNativeModuleCache) {
+  FlagScope<bool> flag_scope(&FLAG_wasm_native_module_cache, true);
+  SharedEngine engine;
+  SharedModule module;
+  {
+    SharedEngineIsolate isolate(&engine);
+    HandleScope scope(isolate.isolate());
+    ZoneBuffer* buffer = BuildReturnConstantModule(isolate.zone(), 23);
+    Handle<WasmInstanceObject> instance = isolate.CompileAndInstantiate(buffer);
+    module = isolate.ExportInstance(instance);
+    CHECK_EQ(23, isolate.Run(instance));
+  }
+  {
+    // Compiling the same bytes in another isolate reuses the module.
+    SharedEngineIsolate isolate(&engine);
+    HandleScope scope(isolate.isolate());
+    ZoneBuffer* buffer = BuildReturnConstantModule(isolate.zone(), 23);
+    Handle<WasmInstanceObject> instance = isolate.CompileAndInstantiate(buffer);
+    CHECK_EQ(module.get(), isolate.ExportInstance(instance).get());
+    CHECK_EQ(23, isolate.Run(instance));
+
+    // Different bytes get their own module.
+    buffer = BuildReturnConstantModule(isolate.zone(), 42);
+    instance = isolate.CompileAndInstantiate(buffer);
+    CHECK_NE(module.get(), isolate.ExportInstance(instance).get());
+    CHECK_EQ(42, isolate.Run(instance));
+  }
+}
+
 TEST(SharedEngineRunThreadedBuildingSync) {
   SharedEngine engine;
   SharedEngineThread thread1(&engine, [](SharedEngineIsolate& isolate) {
@@ -0,0 +1,62 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --concurrent-recompilation --block-concurrent-recompilation
+// Flags: --no-always-opt
+
+if (!%IsConcurrentRecompilationSupported()) {
+  print("Concurrent recompilation is disabled. Skipping this test.");
+  quit();
+}
+
+Debug = debug.Debug;
+
+var listened = 0;
+function listener(event, exec_state, event_data, data) {
+  if (event == Debug.DebugEvent.Break) listened++;
+}
+
+function callee(x) {
+  return x + 1;
+}
+
+function caller(x) {
+  return callee(x) * 2;
+}
+
+function other(x) {
+  return x - 1;
+}
+
+function unrelated(x) {
+  return other(x) * 3;
+}
+
+caller(1);
+caller(2);
+unrelated(1);
+unrelated(2);
+%OptimizeFunctionOnNextCall(caller, "concurrent");
+%OptimizeFunctionOnNextCall(unrelated, "concurrent");
+caller(3);
+unrelated(3);
+
+// Set a break point in the inlined callee while both jobs are pending.
+Debug.setListener(listener);
+Debug.setBreakPoint(callee, 1, 0);
+
+assertUnoptimized(caller, "no sync");
+assertUnoptimized(unrelated, "no sync");
+%UnblockConcurrentRecompilation();
+
+// Code that inlines the callee is discarded, the other job is installed.
+assertUnoptimized(caller, "sync");
+assertOptimized(unrelated, "sync");
+
+assertEquals(10, caller(4));
+assertEquals(1, listened);
+assertEquals(9, unrelated(4));
+
+Debug.clearAllBreakPoints();
+Debug.setListener(null);
@@ -0,0 +1,48 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+let {session, contextGroup, Protocol} =
+    InspectorTest.start('Tests Debugger.setTracepoint.');
+
+contextGroup.addScript(`
+function foo(a) {
+  let b = a * 2;
+  const o = {x: a};
+  return b + o.x;
+}
+//# sourceURL=test.js`);
+
+(async function test() {
+  Protocol.Debugger.enable();
+  const {params: {scriptId}} = await Protocol.Debugger.onceScriptParsed();
+  Protocol.Debugger.onPaused(() => InspectorTest.log('Unexpected pause'));
+
+  InspectorTest.log('Set tracepoint');
+  const {result: {breakpointId}} = await Protocol.Debugger.setTracepoint({
+    location: {scriptId, lineNumber: 4, columnNumber: 0},
+    variables: ['a', 'b', 'o', 'missing']
+  });
+  await Protocol.Runtime.evaluate({expression: 'foo(1); foo(2);'});
+  InspectorTest.log('Evaluated without pause');
+  await logRecords(breakpointId);
+  await logRecords(breakpointId);
+
+  InspectorTest.log('Remove tracepoint');
+  await Protocol.Debugger.removeBreakpoint({breakpointId});
+  await Protocol.Runtime.evaluate({expression: 'foo(3);'});
+  await logRecords(breakpointId);
+  InspectorTest.completeTest();
+})();
+
+async function logRecords(breakpointId) {
+  const {result: {records, droppedRecords}} =
+      await Protocol.Debugger.takeTracepointRecords();
+  InspectorTest.log(`Records: ${records.length}, dropped: ${droppedRecords}`);
+  for (const record of records) {
+    const values = record.values.map(
+        v => v.type === 'object' ? v.description : String(v.value));
+    InspectorTest.log(
+        `  ${record.breakpointId === breakpointId}: ${values.join(', ')}`);
+  }
+}
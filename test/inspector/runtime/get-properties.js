@@ -54,6 +54,18 @@ InspectorTest.runAsyncTestSuite([
       this.Uint8Array = this.uint8array_old;
       delete this.uint8array_old;
     })()`);
+  },
+
+  function testObjectNonIndexedPropertiesOnly() {
+    return logExpressionProperties('({ a: 1, 0: 2, 1: 3, b: 4 })', { ownProperties: true, nonIndexedPropertiesOnly: true });
+  },
+
+  function testHugeArrayNonIndexedPropertiesOnly() {
+    return logExpressionProperties('new Array(1e6).fill(0)', { ownProperties: true, nonIndexedPropertiesOnly: true });
+  },
+
+  function testTypedArrayNonIndexedPropertiesOnly() {
+    return logExpressionProperties('(function(){var r = new Uint8Array(16); r.foo = 1; return r;})()', { ownProperties: true, nonIndexedPropertiesOnly: true });
   }
 ]);
 
@@ -0,0 +1,42 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The ICU objects used by the toLocaleString functions are cached per
+// locale string. Switching locales must not return stale results.
+
+const number = 1234567.891;
+const date = new Date(Date.UTC(2019, 0, 15, 12, 30));
+const options = {timeZone: 'UTC'};
+
+for (let i = 0; i < 3; i++) {
+  for (const locale of ['en-US', 'de-DE', 'en-US', undefined, 'fr']) {
+    assertEquals(new Intl.NumberFormat(locale).format(number),
+                 number.toLocaleString(locale));
+    assertEquals(new Intl.DateTimeFormat(locale).format(date),
+                 date.toLocaleDateString(locale));
+    assertEquals(
+        new Intl.DateTimeFormat(locale, {hour: 'numeric', minute: 'numeric',
+                                         second: 'numeric'}).format(date),
+        date.toLocaleTimeString(locale));
+    assertEquals(new Intl.Collator(locale).compare('a', 'B'),
+                 'a'.localeCompare('B', locale));
+  }
+}
+
+assertEquals('1.234.567,891', number.toLocaleString('de-DE'));
+assertEquals('1,234,567.891', number.toLocaleString('en-US'));
+
+// Options are not cached, and don't disturb the cached objects.
+assertEquals('1,234,567.9',
+             number.toLocaleString('en-US', {maximumFractionDigits: 1}));
+assertEquals('1,234,567.891', number.toLocaleString('en-US'));
+assertEquals('1/15/2019', date.toLocaleDateString('en-US', options));
+
+// Invalid locales keep throwing.
+for (let i = 0; i < 3; i++) {
+  assertThrows(() => number.toLocaleString(''), RangeError);
+  assertThrows(() => number.toLocaleString('x'), RangeError);
+  assertThrows(() => date.toLocaleString('x'), RangeError);
+  assertThrows(() => 'a'.localeCompare('b', 'x'), RangeError);
+}
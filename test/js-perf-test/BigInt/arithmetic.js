@@ -0,0 +1,45 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Operands are large enough to take the subquadratic multiplication,
+// division and toString algorithms.
+
+function RandomBigInt(bits) {
+  let seed = bits;
+  let hex = 'f';
+  for (let i = 1; i < bits / 4; i++) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    hex += ((seed >> 16) & 0xf).toString(16);
+  }
+  return BigInt('0x' + hex);
+}
+
+let x, y, product, result;
+
+function Setup(bits) {
+  return () => {
+    x = RandomBigInt(bits);
+    y = RandomBigInt(bits - 17);
+    product = x * y;
+  };
+}
+
+function Multiply() {
+  result = x * y;
+}
+
+function Divide() {
+  result = product / y;
+}
+
+function ToString() {
+  result = x.toString();
+}
+
+createSuite('Multiply-4096', 1000, Multiply, Setup(4096));
+createSuite('Multiply-65536', 10, Multiply, Setup(65536));
+createSuite('Divide-4096', 1000, Divide, Setup(4096));
+createSuite('Divide-65536', 10, Divide, Setup(65536));
+createSuite('ToString-4096', 1000, ToString, Setup(4096));
+createSuite('ToString-65536', 10, ToString, Setup(65536));
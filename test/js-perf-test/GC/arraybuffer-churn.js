@@ -0,0 +1,22 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// ArrayBuffers of mixed sizes, whose backing stores are freed by the GC.
+
+const kLiveBuffers = 64;
+const kBuffersPerIteration = 256;
+
+RunGCBenchmark('ArrayBufferChurn', () => {
+  return new Array(kLiveBuffers);
+}, (live, iteration) => {
+  for (let i = 0; i < kBuffersPerIteration; i++) {
+    // Sizes from 1 KB to 1 MB.
+    const size = 1024 << ((iteration + i) % 11);
+    const view = new Uint8Array(new ArrayBuffer(size));
+    view[0] = i;
+    view[size - 1] = iteration;
+    live[(iteration + i * 31) % kLiveBuffers] = view;
+  }
+  return live;
+});
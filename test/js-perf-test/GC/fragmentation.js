@@ -0,0 +1,28 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Keeps every fourth old object alive and drops the rest, which leaves old
+// space pages sparsely populated and exercises compaction.
+
+const kObjectsPerIteration = 50000;
+const kYoungIterations = 4;
+const kSurvivorIterations = 40;
+
+RunGCBenchmark('Fragmentation', () => {
+  return {young: [], survivors: new Array(kSurvivorIterations)};
+}, (state, iteration) => {
+  const objects = new Array(kObjectsPerIteration);
+  for (let i = 0; i < kObjectsPerIteration; i++) {
+    objects[i] = {i, iteration, data: new Array(i % 16)};
+  }
+  state.young.push(objects);
+  if (state.young.length > kYoungIterations) {
+    // By now the objects got promoted, keep a quarter of them for a while.
+    const old = state.young.shift();
+    const survivors = [];
+    for (let i = 0; i < old.length; i += 4) survivors.push(old[i]);
+    state.survivors[iteration % kSurvivorIterations] = survivors;
+  }
+  return state;
+});
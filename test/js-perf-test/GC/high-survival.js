@@ -0,0 +1,26 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Most young objects survive: each iteration replaces a slice of a large
+// retained tree, so scavenges copy and promote a lot.
+
+const kNodes = 200000;
+const kReplacedPerIteration = 20000;
+
+function MakeNode(i) {
+  return {id: i, name: 'node' + i, children: [i, i + 1], next: null};
+}
+
+RunGCBenchmark('HighSurvival', () => {
+  const nodes = new Array(kNodes);
+  for (let i = 0; i < kNodes; i++) nodes[i] = MakeNode(i);
+  return nodes;
+}, (nodes, iteration) => {
+  const start = (iteration * kReplacedPerIteration) % kNodes;
+  for (let i = start; i < start + kReplacedPerIteration; i++) {
+    nodes[i] = MakeNode(i);
+    nodes[i].next = nodes[(i * 7) % kNodes];
+  }
+  return nodes;
+});
@@ -0,0 +1,21 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Allocates and drops arrays that go straight to the large object space,
+// keeping a few of them alive at any time.
+
+const kLiveArrays = 8;
+const kArraysPerIteration = 16;
+const kArrayLength = 256 * 1024;
+
+RunGCBenchmark('LargeObjectChurn', () => {
+  return new Array(kLiveArrays);
+}, (live, iteration) => {
+  for (let i = 0; i < kArraysPerIteration; i++) {
+    const array = new Array(kArrayLength);
+    array.fill(iteration);
+    live[(iteration * kArraysPerIteration + i) % kLiveArrays] = array;
+  }
+  return live;
+});
@@ -0,0 +1,36 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Runs the GC workload named by the first argument and reports the pause time
+// distribution, promoted bytes and peak heap memory from d8's
+// performance.gcStatistics().
+
+// Number of times each workload runs its iteration function.
+const kIterations = 200;
+
+function Percentile(sorted, p) {
+  if (sorted.length == 0) return 0;
+  const index = Math.min(sorted.length - 1,
+                         Math.ceil(p / 100 * sorted.length) - 1);
+  return sorted[Math.max(0, index)];
+}
+
+function RunGCBenchmark(name, setup, iteration) {
+  let state = setup();
+  // Discard the collections caused by the setup.
+  performance.gcStatistics();
+  for (let i = 0; i < kIterations; i++) {
+    state = iteration(state, i);
+  }
+  const stats = performance.gcStatistics();
+  const pauses = stats.pauses.slice().sort((a, b) => a - b);
+  print(name + '-GC(P50Pause): ' + Percentile(pauses, 50));
+  print(name + '-GC(P99Pause): ' + Percentile(pauses, 99));
+  print(name + '-GC(MaxPause): ' + Percentile(pauses, 100));
+  print(name + '-GC(FullGCs): ' + stats.fullGCCount);
+  print(name + '-GC(PromotedBytes): ' + stats.promotedBytes);
+  print(name + '-GC(PeakMemory): ' + stats.peakMemorySize);
+}
+
+load(arguments[0] + '.js');
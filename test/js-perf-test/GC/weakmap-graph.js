@@ -0,0 +1,33 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Object graphs that are only reachable through WeakMap values, which full
+// collections have to process as ephemerons.
+
+const kMaps = 16;
+const kEntriesPerIteration = 10000;
+
+RunGCBenchmark('WeakMapGraph', () => {
+  const maps = [];
+  const keys = [];
+  for (let i = 0; i < kMaps; i++) {
+    maps.push(new WeakMap());
+    keys.push([]);
+  }
+  return {maps, keys};
+}, (state, iteration) => {
+  const index = iteration % kMaps;
+  const map = state.maps[index];
+  // Drops the previous keys of this map, so their values become garbage.
+  const keys = state.keys[index] = [];
+  let previous = {};
+  for (let i = 0; i < kEntriesPerIteration; i++) {
+    const key = {i};
+    // Chains the values through the keys, so marking must iterate.
+    map.set(key, {previous, payload: [i, i + 1, i + 2]});
+    previous = key;
+    if (i % 4 == 0) keys.push(key);
+  }
+  return state;
+});
@@ -0,0 +1,127 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A minimal encoder for the Wasm binary format, just enough for the kernels
+// of this suite. Function bodies are arrays of bytes, built from the helpers
+// below.
+
+const kI32 = 0x7f;
+const kF64 = 0x7c;
+const kVoid = 0x40;
+
+const kOp = {
+  block: 0x02, loop: 0x03, if: 0x04, else: 0x05, end: 0x0b, br: 0x0c,
+  br_if: 0x0d, br_table: 0x0e, return: 0x0f, call: 0x10, drop: 0x1a,
+  local_get: 0x20, local_set: 0x21, local_tee: 0x22,
+  i32_load: 0x28, f64_load: 0x2b, i32_load8_u: 0x2d, i32_store: 0x36,
+  f64_store: 0x39, i32_store8: 0x3a, i32_const: 0x41, f64_const: 0x44,
+  i32_eqz: 0x45, i32_eq: 0x46, i32_ne: 0x47, i32_lt_u: 0x49,
+  i32_add: 0x6a, i32_sub: 0x6b, i32_mul: 0x6c, i32_rem_u: 0x70,
+  i32_and: 0x71, i32_or: 0x72, i32_xor: 0x73, i32_shl: 0x74,
+  i32_shr_u: 0x76, f64_sqrt: 0x9f, f64_add: 0xa0, f64_sub: 0xa1,
+  f64_mul: 0xa2, f64_div: 0xa3, f64_convert_i32_u: 0xb8,
+};
+
+function Leb(value) {
+  const bytes = [];
+  do {
+    let byte = value & 0x7f;
+    value >>>= 7;
+    if (value != 0) byte |= 0x80;
+    bytes.push(byte);
+  } while (value != 0);
+  return bytes;
+}
+
+function Sleb(value) {
+  const bytes = [];
+  while (true) {
+    const byte = value & 0x7f;
+    value >>= 7;
+    if ((value == 0 && (byte & 0x40) == 0) ||
+        (value == -1 && (byte & 0x40) != 0)) {
+      bytes.push(byte);
+      return bytes;
+    }
+    bytes.push(byte | 0x80);
+  }
+}
+
+function I32(value) { return [kOp.i32_const, ...Sleb(value)]; }
+function F64(value) {
+  return [kOp.f64_const, ...new Uint8Array(new Float64Array([value]).buffer)];
+}
+function Get(local) { return [kOp.local_get, ...Leb(local)]; }
+function Set(local) { return [kOp.local_set, ...Leb(local)]; }
+function Tee(local) { return [kOp.local_tee, ...Leb(local)]; }
+// Memory accesses take the address from the stack plus a constant offset.
+function Load8(offset = 0) { return [kOp.i32_load8_u, 0, ...Leb(offset)]; }
+function Store8(offset = 0) { return [kOp.i32_store8, 0, ...Leb(offset)]; }
+function LoadI32(offset = 0) { return [kOp.i32_load, 2, ...Leb(offset)]; }
+function LoadF64(offset = 0) { return [kOp.f64_load, 3, ...Leb(offset)]; }
+function StoreF64(offset = 0) { return [kOp.f64_store, 3, ...Leb(offset)]; }
+
+class WasmModuleBuilder {
+  constructor() {
+    this.types = [];
+    this.functions = [];
+    this.exports = [];
+    this.memory_pages = 0;
+  }
+
+  addMemory(pages) {
+    this.memory_pages = pages;
+  }
+
+  addType(params, results) {
+    const key = params.join(',') + ':' + results.join(',');
+    let index = this.types.findIndex((type) => type.key == key);
+    if (index == -1) {
+      index = this.types.length;
+      this.types.push({key, params, results});
+    }
+    return index;
+  }
+
+  // |locals| lists the types of the locals after the parameters.
+  addFunction(params, results, locals, body) {
+    this.functions.push({type: this.addType(params, results), locals, body});
+    return this.functions.length - 1;
+  }
+
+  exportFunction(name, index) {
+    this.exports.push({name, kind: 0x00, index});
+  }
+
+  exportMemory(name) {
+    this.exports.push({name, kind: 0x02, index: 0});
+  }
+
+  toBuffer() {
+    const bytes = [0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00];
+    function Section(id, entries) {
+      const content = [...Leb(entries.length)];
+      for (const entry of entries) content.push(...entry);
+      bytes.push(id, ...Leb(content.length), ...content);
+    }
+    Section(1, this.types.map((type) => [
+      0x60, ...Leb(type.params.length), ...type.params,
+      ...Leb(type.results.length), ...type.results]));
+    Section(3, this.functions.map((func) => Leb(func.type)));
+    if (this.memory_pages > 0) {
+      Section(5, [[0x00, ...Leb(this.memory_pages)]]);
+    }
+    Section(7, this.exports.map((exp) => {
+      const name = [...exp.name].map((c) => c.charCodeAt(0));
+      return [...Leb(name.length), ...name, exp.kind, ...Leb(exp.index)];
+    }));
+    Section(10, this.functions.map((func) => {
+      const body = [...Leb(func.locals.length)];
+      for (const type of func.locals) body.push(1, type);
+      body.push(...func.body, kOp.end);
+      return [...Leb(body.length), ...body];
+    }));
+    return new Uint8Array(bytes);
+  }
+}
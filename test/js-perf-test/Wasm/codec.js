@@ -0,0 +1,90 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A byte codec kernel: delta-encodes and decodes a buffer in place and
+// checksums it with Adler-32, i.e. byte loads and stores and integer
+// arithmetic in tight loops.
+
+const kCodecLength = 64 * 1024;
+
+function AddCodecFunctions(builder) {
+  // adler32(ptr, len), locals a, b, i.
+  const adler32 = builder.addFunction(
+      [kI32, kI32], [kI32], [kI32, kI32, kI32], [
+    ...I32(1), ...Set(2),
+    kOp.block, kVoid, kOp.loop, kVoid,
+      ...Get(4), ...Get(1), kOp.i32_lt_u, kOp.i32_eqz, kOp.br_if, 1,
+      ...Get(2), ...Get(0), ...Get(4), kOp.i32_add, ...Load8(), kOp.i32_add,
+      ...I32(65521), kOp.i32_rem_u, ...Tee(2),
+      ...Get(3), kOp.i32_add, ...I32(65521), kOp.i32_rem_u, ...Set(3),
+      ...Get(4), ...I32(1), kOp.i32_add, ...Set(4),
+      kOp.br, 0,
+    kOp.end, kOp.end,
+    ...Get(3), ...I32(16), kOp.i32_shl, ...Get(2), kOp.i32_or,
+  ]);
+  // encode(ptr, len), locals prev, i, addr, x.
+  const encode = builder.addFunction(
+      [kI32, kI32], [], [kI32, kI32, kI32, kI32], [
+    kOp.block, kVoid, kOp.loop, kVoid,
+      ...Get(3), ...Get(1), kOp.i32_lt_u, kOp.i32_eqz, kOp.br_if, 1,
+      ...Get(0), ...Get(3), kOp.i32_add, ...Tee(4),
+      ...Get(4), ...Load8(), ...Tee(5), ...Get(2), kOp.i32_sub, ...Store8(),
+      ...Get(5), ...Set(2),
+      ...Get(3), ...I32(1), kOp.i32_add, ...Set(3),
+      kOp.br, 0,
+    kOp.end, kOp.end,
+  ]);
+  // decode(ptr, len), locals prev, i, addr.
+  const decode = builder.addFunction(
+      [kI32, kI32], [], [kI32, kI32, kI32], [
+    kOp.block, kVoid, kOp.loop, kVoid,
+      ...Get(3), ...Get(1), kOp.i32_lt_u, kOp.i32_eqz, kOp.br_if, 1,
+      ...Get(0), ...Get(3), kOp.i32_add, ...Tee(4),
+      ...Get(4), ...Load8(), ...Get(2), kOp.i32_add, ...I32(255), kOp.i32_and,
+      ...Tee(2), ...Store8(),
+      ...Get(3), ...I32(1), kOp.i32_add, ...Set(3),
+      kOp.br, 0,
+    kOp.end, kOp.end,
+  ]);
+  // roundtrip(ptr, len) encodes, decodes and returns the checksum.
+  return builder.addFunction([kI32, kI32], [kI32], [], [
+    ...Get(0), ...Get(1), kOp.call, ...Leb(encode),
+    ...Get(0), ...Get(1), kOp.call, ...Leb(decode),
+    ...Get(0), ...Get(1), kOp.call, ...Leb(adler32),
+  ]);
+}
+
+function BuildCodec(copies) {
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1);
+  for (let i = 0; i < copies; i++) {
+    const roundtrip = AddCodecFunctions(builder);
+    if (i == 0) builder.exportFunction('roundtrip', roundtrip);
+  }
+  builder.exportMemory('memory');
+  return builder;
+}
+
+let expected_checksum;
+
+function RunCodec(instance) {
+  if (expected_checksum === undefined) {
+    const data = new Uint8Array(instance.exports.memory.buffer);
+    let seed = 1;
+    let a = 1;
+    let b = 0;
+    for (let i = 0; i < kCodecLength; i++) {
+      seed = (Math.imul(seed, 1103515245) + 12345) | 0;
+      // Runs of repeated bytes, like in real data.
+      data[i] = (seed >>> 28) < 4 ? data[i - 1] | 0 : seed >>> 24;
+      a = (a + data[i]) % 65521;
+      b = (b + a) % 65521;
+    }
+    expected_checksum = (b << 16) | a;
+  }
+  const checksum = instance.exports.roundtrip(0, kCodecLength);
+  if (checksum != expected_checksum) throw new Error('Wrong checksum');
+}
+
+RunWasmBenchmark('Codec', BuildCodec, RunCodec);
@@ -0,0 +1,106 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A bytecode interpreter written in Wasm, i.e. a br_table dispatch loop with
+// unpredictable branches. Instructions are (opcode, argument) pairs of i32s:
+//
+//   0 halt               returns the accumulator
+//   1 add arg            acc += arg
+//   2 mul arg            acc *= arg
+//   3 xorshift arg       acc ^= acc >>> arg
+//   4 loop arg           if (--counter != 0) goto arg
+//   5 counter arg        counter = arg
+
+const kInterpreterIterations = 20000;
+
+function AddInterpreterFunctions(builder) {
+  // run(), locals pc, acc, counter, op, arg.
+  const pc = 0, acc = 1, counter = 2, op = 3, arg = 4;
+  return builder.addFunction([], [kI32], [kI32, kI32, kI32, kI32, kI32], [
+    kOp.block, kVoid, kOp.loop, kVoid,
+      ...Get(pc), ...LoadI32(0), ...Set(op),
+      ...Get(pc), ...LoadI32(4), ...Set(arg),
+      ...Get(pc), ...I32(8), kOp.i32_add, ...Set(pc),
+      kOp.block, kVoid, kOp.block, kVoid, kOp.block, kVoid,
+      kOp.block, kVoid, kOp.block, kVoid, kOp.block, kVoid,
+        ...Get(op), kOp.br_table, 6, 0, 1, 2, 3, 4, 5, 7,
+      kOp.end,
+      kOp.br, 6,
+      kOp.end,
+      ...Get(acc), ...Get(arg), kOp.i32_add, ...Set(acc),
+      kOp.br, 4,
+      kOp.end,
+      ...Get(acc), ...Get(arg), kOp.i32_mul, ...Set(acc),
+      kOp.br, 3,
+      kOp.end,
+      ...Get(acc), ...Get(acc), ...Get(arg), kOp.i32_shr_u, kOp.i32_xor,
+      ...Set(acc),
+      kOp.br, 2,
+      kOp.end,
+      ...Get(counter), ...I32(1), kOp.i32_sub, ...Tee(counter),
+      kOp.if, kVoid,
+        ...Get(arg), ...I32(3), kOp.i32_shl, ...Set(pc),
+      kOp.end,
+      kOp.br, 1,
+      kOp.end,
+      ...Get(arg), ...Set(counter),
+      kOp.br, 0,
+    kOp.end, kOp.end,
+    ...Get(acc),
+  ]);
+}
+
+function BuildInterpreter(copies) {
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1);
+  for (let i = 0; i < copies; i++) {
+    const run = AddInterpreterFunctions(builder);
+    if (i == 0) builder.exportFunction('run', run);
+  }
+  builder.exportMemory('memory');
+  return builder;
+}
+
+// A loop over a pseudo-random body of arithmetic instructions.
+function InterpreterProgram() {
+  const program = [5, kInterpreterIterations];
+  let seed = 7;
+  for (let i = 0; i < 32; i++) {
+    seed = (Math.imul(seed, 1103515245) + 12345) | 0;
+    program.push(1 + (seed >>> 16) % 3, ((seed >>> 8) & 0xff) | 1);
+  }
+  program.push(4, 1, 0, 0);
+  return program;
+}
+
+function Interpret(program) {
+  let pc = 0, acc = 0, counter = 0;
+  while (true) {
+    const op = program[pc], arg = program[pc + 1];
+    pc += 2;
+    switch (op) {
+      case 0: return acc;
+      case 1: acc = (acc + arg) | 0; break;
+      case 2: acc = Math.imul(acc, arg); break;
+      case 3: acc = (acc ^ (acc >>> (arg & 31))) | 0; break;
+      case 4: if (--counter != 0) pc = arg * 2; break;
+      case 5: counter = arg; break;
+    }
+  }
+}
+
+let expected_result;
+
+function RunInterpreter(instance) {
+  if (expected_result === undefined) {
+    const program = InterpreterProgram();
+    new Int32Array(instance.exports.memory.buffer).set(program);
+    expected_result = Interpret(program);
+  }
+  if (instance.exports.run() != expected_result) {
+    throw new Error('Wrong result');
+  }
+}
+
+RunWasmBenchmark('Interpreter', BuildInterpreter, RunInterpreter);
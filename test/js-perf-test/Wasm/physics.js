@@ -0,0 +1,148 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// An n-body physics kernel on the five Jovian planets, i.e. f64 loads,
+// stores and arithmetic including sqrt. Each body takes 64 bytes of memory:
+// x, y, z, vx, vy, vz and mass.
+
+const kBodies = 5;
+const kSteps = 1000;
+const kSimulations = 10;
+const kSolarMass = 4 * Math.PI * Math.PI;
+const kDaysPerYear = 365.24;
+
+function AddPhysicsFunctions(builder) {
+  // advance(n, dt), locals i, j, pi, pj, dx, dy, dz, mag.
+  const i = 2, j = 3, pi = 4, pj = 5, d = [6, 7, 8], mag = 9;
+  const pairs = [];
+  for (let k = 0; k < 3; k++) {
+    pairs.push(...Get(pi), ...Get(pi), ...LoadF64(8 * k),
+               ...Get(pj), ...LoadF64(8 * k), kOp.f64_sub, ...Set(d[k]));
+  }
+  pairs.push(...Get(d[0]), ...Get(d[0]), kOp.f64_mul,
+             ...Get(d[1]), ...Get(d[1]), kOp.f64_mul, kOp.f64_add,
+             ...Get(d[2]), ...Get(d[2]), kOp.f64_mul, kOp.f64_add, ...Set(mag),
+             ...Get(1), ...Get(mag), ...Get(mag), kOp.f64_sqrt, kOp.f64_mul,
+             kOp.f64_div, ...Set(mag));
+  for (let k = 0; k < 3; k++) {
+    const v = 24 + 8 * k;
+    pairs.push(...Get(pi), ...Get(pi), ...LoadF64(v), ...Get(d[k]),
+               ...Get(pj), ...LoadF64(48), kOp.f64_mul, ...Get(mag),
+               kOp.f64_mul, kOp.f64_sub, ...StoreF64(v));
+    pairs.push(...Get(pj), ...Get(pj), ...LoadF64(v), ...Get(d[k]),
+               ...Get(pi), ...LoadF64(48), kOp.f64_mul, ...Get(mag),
+               kOp.f64_mul, kOp.f64_add, ...StoreF64(v));
+  }
+  const positions = [];
+  for (let k = 0; k < 3; k++) {
+    positions.push(...Get(pi), ...Get(pi), ...LoadF64(8 * k), ...Get(1),
+                   ...Get(pi), ...LoadF64(24 + 8 * k), kOp.f64_mul,
+                   kOp.f64_add, ...StoreF64(8 * k));
+  }
+  const advance = builder.addFunction(
+      [kI32, kF64], [], [kI32, kI32, kI32, kI32, kF64, kF64, kF64, kF64], [
+    kOp.block, kVoid, kOp.loop, kVoid,
+      ...Get(i), ...Get(0), kOp.i32_lt_u, kOp.i32_eqz, kOp.br_if, 1,
+      ...Get(i), ...I32(6), kOp.i32_shl, ...Set(pi),
+      ...Get(i), ...I32(1), kOp.i32_add, ...Set(j),
+      kOp.block, kVoid, kOp.loop, kVoid,
+        ...Get(j), ...Get(0), kOp.i32_lt_u, kOp.i32_eqz, kOp.br_if, 1,
+        ...Get(j), ...I32(6), kOp.i32_shl, ...Set(pj),
+        ...pairs,
+        ...Get(j), ...I32(1), kOp.i32_add, ...Set(j),
+        kOp.br, 0,
+      kOp.end, kOp.end,
+      ...Get(i), ...I32(1), kOp.i32_add, ...Set(i),
+      kOp.br, 0,
+    kOp.end, kOp.end,
+    ...I32(0), ...Set(i),
+    kOp.block, kVoid, kOp.loop, kVoid,
+      ...Get(i), ...Get(0), kOp.i32_lt_u, kOp.i32_eqz, kOp.br_if, 1,
+      ...Get(i), ...I32(6), kOp.i32_shl, ...Set(pi),
+      ...positions,
+      ...Get(i), ...I32(1), kOp.i32_add, ...Set(i),
+      kOp.br, 0,
+    kOp.end, kOp.end,
+  ]);
+  // simulate(n, dt, steps), locals step.
+  return builder.addFunction([kI32, kF64, kI32], [], [kI32], [
+    kOp.block, kVoid, kOp.loop, kVoid,
+      ...Get(3), ...Get(2), kOp.i32_lt_u, kOp.i32_eqz, kOp.br_if, 1,
+      ...Get(0), ...Get(1), kOp.call, ...Leb(advance),
+      ...Get(3), ...I32(1), kOp.i32_add, ...Set(3),
+      kOp.br, 0,
+    kOp.end, kOp.end,
+  ]);
+}
+
+function BuildPhysics(copies) {
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1);
+  for (let i = 0; i < copies; i++) {
+    const simulate = AddPhysicsFunctions(builder);
+    if (i == 0) builder.exportFunction('simulate', simulate);
+  }
+  builder.exportMemory('memory');
+  return builder;
+}
+
+function InitBodies(bodies) {
+  const initial = [
+    [0, 0, 0, 0, 0, 0, kSolarMass],
+    [4.84143144246472090e+00, -1.16032004402742839e+00,
+     -1.03622044471123109e-01, 1.66007664274403694e-03 * kDaysPerYear,
+     7.69901118419740425e-03 * kDaysPerYear,
+     -6.90460016972063023e-05 * kDaysPerYear,
+     9.54791938424326609e-04 * kSolarMass],
+    [8.34336671824457987e+00, 4.12479856412430479e+00,
+     -4.03523417114321381e-01, -2.76742510726862411e-03 * kDaysPerYear,
+     4.99852801234917238e-03 * kDaysPerYear,
+     2.30417297573763929e-05 * kDaysPerYear,
+     2.85885980666130812e-04 * kSolarMass],
+    [1.28943695621391310e+01, -1.51111514016986312e+01,
+     -2.23307578892655734e-01, 2.96460137564761618e-03 * kDaysPerYear,
+     2.37847173959480950e-03 * kDaysPerYear,
+     -2.96589568540237556e-05 * kDaysPerYear,
+     4.36624404335156298e-05 * kSolarMass],
+    [1.53796971148509165e+01, -2.59193146099879641e+01,
+     1.79258772950371181e-01, 2.68067772490389322e-03 * kDaysPerYear,
+     1.62824170038242295e-03 * kDaysPerYear,
+     -9.51592254519715870e-05 * kDaysPerYear,
+     5.15138902046611451e-05 * kSolarMass],
+  ];
+  // Offset the momentum of the sun.
+  for (let k = 0; k < 3; k++) {
+    for (let i = 1; i < kBodies; i++) {
+      initial[0][3 + k] -= initial[i][3 + k] * initial[i][6] / kSolarMass;
+    }
+  }
+  for (let i = 0; i < kBodies; i++) bodies.set(initial[i], i * 8);
+}
+
+function Energy(bodies) {
+  let energy = 0;
+  for (let i = 0; i < kBodies; i++) {
+    const b = bodies.subarray(i * 8, i * 8 + 7);
+    energy += 0.5 * b[6] * (b[3] * b[3] + b[4] * b[4] + b[5] * b[5]);
+    for (let j = i + 1; j < kBodies; j++) {
+      const c = bodies.subarray(j * 8, j * 8 + 7);
+      const dx = b[0] - c[0], dy = b[1] - c[1], dz = b[2] - c[2];
+      energy -= b[6] * c[6] / Math.sqrt(dx * dx + dy * dy + dz * dz);
+    }
+  }
+  return energy;
+}
+
+function RunPhysics(instance) {
+  const bodies = new Float64Array(instance.exports.memory.buffer);
+  for (let i = 0; i < kSimulations; i++) {
+    InitBodies(bodies);
+    instance.exports.simulate(kBodies, 0.01, kSteps);
+    if (Math.abs(Energy(bodies) - -0.169087605) > 1e-9) {
+      throw new Error('Wrong energy');
+    }
+  }
+}
+
+RunWasmBenchmark('Physics', BuildPhysics, RunPhysics);
@@ -0,0 +1,57 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Runs the Wasm kernel named by the first argument and reports how long it
+// takes to compile and instantiate the module and to run the kernel. The
+// compiler tier is selected by the flags of the enclosing suite.
+
+// Number of copies of the kernel functions in each module, so that compile
+// times are large enough to measure.
+const kCopies = 200;
+const kCompileRuns = 5;
+const kExecutionRuns = 20;
+
+function Median(values) {
+  const sorted = values.slice().sort((a, b) => a - b);
+  return sorted[sorted.length >> 1];
+}
+
+// |build| returns a WasmModuleBuilder with the kernel exported from copy 0.
+// |run| runs the kernel once on an instance and throws on a wrong result.
+function RunWasmBenchmark(name, build, run) {
+  const builder = build(kCopies);
+  const bytes = builder.toBuffer();
+
+  let start = performance.now();
+  const instance = new WebAssembly.Instance(new WebAssembly.Module(bytes));
+  const first_instantiate = performance.now() - start;
+
+  // Each run compiles different bytes, so that no cache can hide the work.
+  const compile_times = [];
+  for (let i = 0; i < kCompileRuns; i++) {
+    builder.exportFunction('variant' + i, 0);
+    const variant = builder.toBuffer();
+    start = performance.now();
+    new WebAssembly.Module(variant);
+    compile_times.push(performance.now() - start);
+  }
+  const compile = Median(compile_times);
+
+  run(instance);
+  const execution_times = [];
+  for (let i = 0; i < kExecutionRuns; i++) {
+    start = performance.now();
+    run(instance);
+    execution_times.push(performance.now() - start);
+  }
+
+  print(name + '-Wasm(FirstInstantiate): ' + first_instantiate);
+  print(name + '-Wasm(Compile): ' + compile);
+  print(name + '-Wasm(CompileThroughput): ' +
+        bytes.length / 1024 / 1024 / (compile / 1000));
+  print(name + '-Wasm(Execution): ' + Median(execution_times));
+}
+
+load('builder.js');
+load(arguments[0] + '.js');
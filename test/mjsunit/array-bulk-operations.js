@@ -0,0 +1,114 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Checks the fast paths of indexOf, includes, fill and copyWithin against
+// their generic behavior, at lengths that do not fill whole vectors.
+
+(function TestSearchSmis() {
+  for (const length of [1, 2, 3, 5, 8, 17, 100]) {
+    const array = [];
+    for (let i = 0; i < length; i++) array.push(i * 3);
+    for (let i = 0; i < length; i++) {
+      assertEquals(i, array.indexOf(i * 3));
+      assertTrue(array.includes(i * 3));
+      assertEquals(-1, array.indexOf(i * 3 + 1));
+      assertEquals(i, array.indexOf(i * 3, i));
+      assertEquals(-1, array.indexOf(i * 3, i + 1));
+      assertEquals(i, array.indexOf(i * 3, i - length));
+    }
+    const holey = array.slice();
+    holey[length + 3] = 0;
+    assertEquals(0, holey.indexOf(0));
+    assertEquals(length + 3, holey.indexOf(0, 1));
+    assertEquals(-1, holey.indexOf(undefined));
+    assertTrue(holey.includes(undefined));
+  }
+})();
+
+(function TestSearchDoubles() {
+  for (const length of [1, 2, 3, 5, 8, 17, 100]) {
+    const array = [];
+    for (let i = 0; i < length; i++) array.push(i + 0.5);
+    for (let i = 0; i < length; i++) {
+      assertEquals(i, array.indexOf(i + 0.5));
+      assertTrue(array.includes(i + 0.5, i));
+      assertFalse(array.includes(i + 0.5, i + 1));
+    }
+    assertEquals(-1, array.indexOf(1));
+    array.push(-0, NaN, 7);
+    assertEquals(length, array.indexOf(0));
+    assertEquals(length, array.indexOf(-0));
+    assertEquals(length + 2, array.indexOf(7));
+    assertEquals(-1, array.indexOf(NaN));
+    assertTrue(array.includes(NaN));
+    const holey = array.slice();
+    holey[length + 10] = 1.5;
+    assertEquals(length + 10, holey.indexOf(1.5, 2));
+    assertEquals(-1, holey.indexOf(undefined));
+    assertTrue(holey.includes(undefined));
+  }
+})();
+
+(function TestSearchIdentity() {
+  const objects = [];
+  for (let i = 0; i < 37; i++) objects.push({i});
+  const symbol = Symbol();
+  const array = objects.concat([null, true, symbol, undefined]);
+  for (let i = 0; i < objects.length; i++) {
+    assertEquals(i, array.indexOf(objects[i]));
+    assertTrue(array.includes(objects[i]));
+  }
+  assertEquals(-1, array.indexOf({}));
+  assertEquals(37, array.indexOf(null));
+  assertEquals(38, array.indexOf(true));
+  assertEquals(39, array.indexOf(symbol));
+  assertEquals(40, array.indexOf(undefined));
+  assertEquals(-1, array.indexOf(false));
+  // Numbers still match HeapNumbers in object arrays.
+  assertEquals(1, [{}, 1.5, 2].indexOf(1.5));
+  assertEquals(2, [{}, 1.5, 2].indexOf(2));
+})();
+
+(function TestFill() {
+  const object = {};
+  for (const value of [1, 1.5, object, 'x', undefined]) {
+    const array = [1, 2, 3, 4, 5, 6, 7, 8, 9];
+    array.fill(value, 2, -2);
+    assertEquals([1, 2, value, value, value, value, value, 8, 9], array);
+    const doubles = [0.5, 1.5, 2.5, 3.5];
+    doubles.fill(value, 1);
+    assertEquals([0.5, value, value, value], doubles);
+  }
+  assertEquals([NaN, NaN], [0.5, 1.5].fill(NaN));
+})();
+
+(function TestCopyWithin() {
+  const inputs = [
+    [1, 2, 3, 4, 5, 6, 7, 8],
+    [0.5, 1.5, 2.5, 3.5, 4.5, 5.5],
+    [{}, 'a', 1, 2.5, null, [], undefined, {}],
+    [1, , 3, , 5, 6.5, , 8],
+  ];
+  for (const input of inputs) {
+    for (const [target, start, end] of [
+             [0, 3], [3, 0], [1, 2, 5], [-2, 0], [0, -3, -1], [2, 2],
+             [5, 0, 100]]) {
+      const expected = input.slice().copyWithin(target, start, end);
+      const actual = input.slice();
+      assertSame(actual, actual.copyWithin(target, start, end));
+      assertEquals(expected.length, actual.length);
+      for (let i = 0; i < expected.length; i++) {
+        assertEquals(i in expected, i in actual);
+        assertSame(expected[i], actual[i]);
+      }
+    }
+  }
+})();
+
+(function TestCopyWithinShrinkingArray() {
+  const array = [1, 2, 3, 4, 5, 6];
+  const start = {valueOf() { array.length = 3; return 0; }};
+  array.copyWithin(2, start);
+  assertEquals([1, 2, 1, 2, 3], array);
+})();
@@ -0,0 +1,82 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Array.prototype.sort compares Numbers directly for the comparators
+// "(a, b) => a - b" and "(a, b) => b - a". Check that this matches calling
+// them, for all elements kinds and for values that are not Numbers.
+
+function ascending(a, b) { return a - b; }
+const descending = (a, b) => b - a;
+
+function reference(array, comparefn) {
+  // An equivalent comparator that is not recognized.
+  return array.slice().sort((a, b) => {
+    const result = comparefn(a, b);
+    return result;
+  });
+}
+
+function check(array) {
+  for (const comparefn of [ascending, descending]) {
+    // The first sort compiles the comparator, later ones recognize it.
+    for (let i = 0; i < 3; i++) {
+      const expected = reference(array, comparefn);
+      const actual = array.slice().sort(comparefn);
+      assertEquals(expected.length, actual.length);
+      for (let j = 0; j < expected.length; j++) {
+        assertTrue(Object.is(expected[j], actual[j]));
+      }
+    }
+  }
+}
+
+function randomSmis(length) {
+  const result = [];
+  for (let i = 0; i < length; i++) result.push((Math.random() * 1000) | 0);
+  return result;
+}
+
+check(randomSmis(5));
+check(randomSmis(1000));
+check(randomSmis(1000).map((x) => x + 0.5));
+check([3, -0, 0, NaN, 1.5, -Infinity, Infinity, -0, NaN, 0, 2]);
+check([2 ** 31, -(2 ** 31), 2 ** 53, -(2 ** 53), 1, 0]);
+check([3, 'b', 1, '2', undefined, 4, , 0]);
+
+// Values that are not Numbers still call the comparator, which runs valueOf.
+(function TestValueOf() {
+  let calls = 0;
+  function number(value) {
+    return { valueOf() { calls++; return value; } };
+  }
+  for (let i = 0; i < 3; i++) {
+    calls = 0;
+    const array = [number(3), 1, number(2), 0];
+    array.sort(ascending);
+    assertEquals([0, 1, 2, 3], array.map(Number));
+    assertTrue(calls > 0);
+  }
+})();
+
+// The comparator sees Numbers and non-Numbers in a mixed array.
+(function TestMixed() {
+  for (let i = 0; i < 3; i++) {
+    const array = [5, 4, {}, 3, 2, 1];
+    array.sort(ascending);
+    assertEquals(6, array.length);
+  }
+})();
+
+// Similar looking comparators must not be treated the same.
+(function TestNotRecognized() {
+  const array = [1, 2, 3, 4, 5];
+  for (let i = 0; i < 3; i++) {
+    assertEquals([5, 4, 3, 2, 1], array.slice().sort((a, b, c) => b - a));
+    assertEquals([2, 4, 1, 3, 5],
+                 array.slice().sort((a, b) => (a % 2) - (b % 2)));
+    let calls = 0;
+    array.slice().sort((a, b) => { calls++; return a - b; });
+    assertTrue(calls > 0);
+  }
+})();
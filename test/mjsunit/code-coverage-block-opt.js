@@ -22,16 +22,13 @@ f(); f(); %OptimizeFunctionOnNextCall(f); // 0100
 f(); f(); f(); f(); f(); f();             // 0150
 `,
 [{"start":0,"end":199,"count":1},
- {"start":0,"end":33,"count":4},   // TODO(jgruber): Invocation count is off.
- {"start":25,"end":32,"count":16},
- {"start":50,"end":76,"count":2}]  // TODO(jgruber): Invocation count is off.
+ {"start":0,"end":33,"count":16},
+ {"start":50,"end":76,"count":8}]
 );
 
-// This test is tricky: it requires a non-toplevel, optimized function.
-// After initial collection, counts are cleared. Further invocation_counts
-// are not collected for optimized functions, and on the next coverage
-// collection we and up with an uncovered function with an uncovered parent
-// but with non-trivial block coverage.
+// This test requires a non-toplevel, optimized function. After initial
+// collection, counts are cleared. The optimized function keeps incrementing
+// its invocation count, so the result matches the non-optimized case.
 TestCoverage("Partial coverage collection",
 `
 !function() {                             // 0000
@@ -44,8 +41,8 @@ TestCoverage("Partial coverage collection",
   f(false);                               // 0350
 }();                                      // 0400
 `,
-[{"start":52,"end":153,"count":0},
- {"start":121,"end":152,"count":1}]
+[{"start":52,"end":153,"count":1},
+ {"start":111,"end":121,"count":0}]
 );
 
 %DebugToggleBlockCoverage(false);
@@ -50,4 +50,13 @@ for (var i = 0; i < 10; i++) {
 [{"start":0,"end":63,"count":1},{"start":41,"end":48,"count":5}]
 );
 
+TestCoverage(
+"optimized function",
+`
+function f() {}
+f(); f(); %OptimizeFunctionOnNextCall(f); f(); f(); f();
+`,
+[{"start":0,"end":72,"count":1},{"start":0,"end":15,"count":5}]
+);
+
 %DebugTogglePreciseCoverage(false);
@@ -0,0 +1,60 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt
+
+// Test CloneFastJSArray inserted by JSCallReducer for Array.from on
+// packed arrays.
+(function() {
+  function from(a) { return Array.from(a); }
+
+  const smis = [1, 2, 3];
+  const doubles = [1.5, 2.5, 3.5];
+  const objects = [{}, "a", 1];
+  assertEquals(smis, from(smis));
+  assertEquals(doubles, from(doubles));
+  assertEquals(objects, from(objects));
+  %OptimizeFunctionOnNextCall(from);
+  const result = from(doubles);
+  assertEquals(doubles, result);
+  assertFalse(doubles === result);
+  assertEquals(smis, from(smis));
+  assertEquals(objects, from(objects));
+})();
+
+// Holes become undefined.
+(function() {
+  function from(a) { return Array.from(a); }
+
+  const holey = [1, , 3];
+  assertEquals([1, undefined, 3], from(holey));
+  %OptimizeFunctionOnNextCall(from);
+  const result = from(holey);
+  assertEquals([1, undefined, 3], result);
+  assertTrue(result.hasOwnProperty(1));
+})();
+
+// An explicit undefined mapFn is the same as none.
+(function() {
+  function from(a) { return Array.from(a, undefined); }
+
+  const arr = [1.5, 2.5];
+  assertEquals(arr, from(arr));
+  %OptimizeFunctionOnNextCall(from);
+  assertEquals(arr, from(arr));
+})();
+
+// Changing the array iterator deoptimizes.
+(function() {
+  function from(a) { return Array.from(a); }
+
+  const arr = [1, 2, 3];
+  assertEquals(arr, from(arr));
+  %OptimizeFunctionOnNextCall(from);
+  assertEquals(arr, from(arr));
+  assertOptimized(from);
+  Array.prototype[Symbol.iterator] = function*() { yield 42; };
+  assertUnoptimized(from);
+  assertEquals([42], from(arr));
+})();
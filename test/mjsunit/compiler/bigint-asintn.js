@@ -0,0 +1,51 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --noalways-opt
+
+// Test BigInt.asIntN and BigInt.asUintN with a width of 64 bits.
+(function() {
+  function asInt64(x) { return BigInt.asIntN(64, x); }
+  function asUint64(x) { return BigInt.asUintN(64, x); }
+
+  function test() {
+    assertEquals(-1n, asInt64(2n ** 64n - 1n));
+    assertEquals(-(2n ** 63n), asInt64(2n ** 63n));
+    assertEquals(2n ** 63n - 1n, asInt64(-(2n ** 63n) - 1n));
+    assertEquals(42n, asInt64(42n + 2n ** 100n));
+    assertEquals(2n ** 64n - 1n, asUint64(-1n));
+    assertEquals(2n ** 63n, asUint64(-(2n ** 63n)));
+    assertEquals(0n, asUint64(2n ** 64n));
+    assertEquals(0n, asUint64(0n));
+  }
+
+  test();
+  test();
+  %OptimizeFunctionOnNextCall(asInt64);
+  %OptimizeFunctionOnNextCall(asUint64);
+  test();
+  assertOptimized(asInt64);
+  assertOptimized(asUint64);
+
+  // Non-BigInt inputs are still converted or rejected.
+  assertEquals(1n, asInt64(true));
+  assertEquals(2n ** 64n - 2n, asUint64("-2"));
+  assertThrows(() => asInt64(1), TypeError);
+})();
+
+// Test a 64-bit hash loop.
+(function() {
+  function fnv(s) {
+    let h = 0xcbf29ce484222325n;
+    for (let i = 0; i < s.length; ++i) {
+      h = BigInt.asUintN(64, (h ^ BigInt(s.charCodeAt(i))) * 0x100000001b3n);
+    }
+    return h;
+  }
+
+  const expected = fnv("hello world");
+  %OptimizeFunctionOnNextCall(fnv);
+  assertEquals(expected, fnv("hello world"));
+  assertEquals(0xcbf29ce484222325n, fnv(""));
+})();
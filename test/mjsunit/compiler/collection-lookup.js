@@ -0,0 +1,66 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --noalways-opt
+
+// Test Map lookups with string keys, both internalized and not.
+(function() {
+  const map = new Map();
+  map.set("a", 1);
+  map.set("b" + "c".repeat(20), 2);  // Not internalized.
+  map.set(1, 3);
+  map.set({}, 4);
+
+  function get(m, k) { return m.get(String(k)); }
+  function has(m, k) { return m.has(String(k)); }
+
+  function test() {
+    assertEquals(1, get(map, "a"));
+    assertEquals(2, get(map, "bccccccccccccccccccccc"));
+    assertEquals(undefined, get(map, 1));  // "1" is not the Smi key 1.
+    assertEquals(undefined, get(map, "x"));
+    assertTrue(has(map, "a"));
+    assertTrue(has(map, "b" + "c".repeat(20)));
+    assertFalse(has(map, "x"));
+  }
+
+  test();
+  test();
+  %OptimizeFunctionOnNextCall(get);
+  %OptimizeFunctionOnNextCall(has);
+  test();
+  assertOptimized(get);
+  assertOptimized(has);
+})();
+
+// Test WeakMap.prototype.get and has.
+(function() {
+  const key1 = {};
+  const key2 = {};
+  const weak_map = new WeakMap([[key1, 1]]);
+
+  function get(m, k) { return m.get(k); }
+  function has(m, k) { return m.has(k); }
+
+  function test() {
+    assertEquals(1, get(weak_map, key1));
+    assertEquals(undefined, get(weak_map, key2));
+    assertEquals(undefined, get(weak_map, 1));
+    assertTrue(has(weak_map, key1));
+    assertFalse(has(weak_map, key2));
+    assertFalse(has(weak_map, "a"));
+  }
+
+  test();
+  test();
+  %OptimizeFunctionOnNextCall(get);
+  %OptimizeFunctionOnNextCall(has);
+  test();
+  assertOptimized(get);
+  assertOptimized(has);
+
+  weak_map.set(key2, 2);
+  assertEquals(2, get(weak_map, key2));
+  assertTrue(has(weak_map, key2));
+})();
@@ -30,3 +30,37 @@
   assertEquals("first", f(0));
   assertEquals("second", f(1));
 })();
+
+// Test variable index access to array with 4 elements.
+(function testFourElementArrayVariableIndex() {
+  function f(i) {
+    const a = new Array("first", "second", "third", "fourth");
+    return a[i];
+  }
+
+  assertEquals("first", f(0));
+  assertEquals("fourth", f(3));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals("first", f(0));
+  assertEquals("second", f(1));
+  assertEquals("third", f(2));
+  assertEquals("fourth", f(3));
+})();
+
+// Test loop variable access to rest parameters of an inlined callee.
+(function testInlinedRestParametersLoopIndex() {
+  function sum(...args) {
+    let result = 0;
+    for (let i = 0; i < args.length; i++) result += args[i];
+    return result;
+  }
+  function f(x) {
+    return sum(x, x + 1, x + 2);
+  }
+
+  assertEquals(6, f(1));
+  assertEquals(9, f(2));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(6, f(1));
+  assertEquals(9, f(2));
+})();
@@ -0,0 +1,25 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-fast-pipeline-bytecode-size=1
+
+// Every function uses the reduced pipeline with this flag.
+(function() {
+  function point(x, y) { return {x: x, y: y}; }
+  function f(a) {
+    var sum = 0;
+    for (var i = 0; i < a.length; i++) {
+      var p = point(a[i], i);
+      sum += p.x * p.y;
+    }
+    return sum;
+  }
+  var a = new Float64Array([1, 2, 3, 4]);
+  assertEquals(20, f(a));
+  assertEquals(20, f(a));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(20, f(a));
+  assertOptimized(f);
+  assertEquals(0, f(new Float64Array(0)));
+})();
@@ -0,0 +1,57 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --noalways-opt
+
+// Test that parameters survive suspends in optimized generators, both when
+// they keep their incoming value and when they are reassigned.
+(function() {
+  function* gen(a, b) {
+    yield a;
+    b = b + 1;
+    yield a + b;
+    a = a * 2;
+    yield a + b;
+  }
+
+  function collect(a, b) {
+    return [...gen(a, b)];
+  }
+
+  assertEquals([1, 4, 5], collect(1, 2));
+  assertEquals([1, 4, 5], collect(1, 2));
+  %OptimizeFunctionOnNextCall(gen);
+  assertEquals([3, 8, 11], collect(3, 4));
+
+  // Created by optimized code, resumed after optimization was dropped.
+  const g = gen(5, 6);
+  assertEquals(5, g.next().value);
+  %DeoptimizeFunction(gen);
+  assertEquals(12, g.next().value);
+  assertEquals(17, g.next().value);
+})();
+
+// Same for async functions, which don't have an initial yield.
+(function() {
+  let log = [];
+  async function f(a, b) {
+    await null;
+    log.push(a);
+    b = b + a;
+    await null;
+    log.push(b);
+    await null;
+    log.push(a + b);
+  }
+
+  f(1, 2);
+  %PerformMicrotaskCheckpoint();
+  f(1, 2);
+  %PerformMicrotaskCheckpoint();
+  %OptimizeFunctionOnNextCall(f);
+  log = [];
+  f(10, 20);
+  %PerformMicrotaskCheckpoint();
+  assertEquals([10, 30, 40], log);
+})();
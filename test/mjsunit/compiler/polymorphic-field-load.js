@@ -0,0 +1,56 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --noalways-opt
+
+// Test loads from more than four maps that all have the property in the
+// same field.
+(function() {
+  function load(o) { return o.x; }
+
+  const objects = [
+    {x: 1, a: 0}, {x: 2, b: 0}, {x: 3, c: 0}, {x: 4, d: 0},
+    {x: 5, e: 0}, {x: 6, f: 0}, {x: 7, g: 0}, {x: 8, h: 0}
+  ];
+
+  function test() {
+    for (let i = 0; i < objects.length; ++i) {
+      assertEquals(i + 1, load(objects[i]));
+    }
+  }
+
+  test();
+  test();
+  %OptimizeFunctionOnNextCall(load);
+  test();
+  assertOptimized(load);
+
+  // Maps with a different field layout or representation still work.
+  assertEquals(9, load({y: 0, x: 9}));
+  assertEquals(1.5, load({x: 1.5, i: 0}));
+  assertEquals(undefined, load({}));
+})();
+
+// Test that map deprecation is handled.
+(function() {
+  function load(o) { return o.x; }
+
+  function make(i) {
+    const o = {x: i};
+    o["p" + i] = 0;
+    return o;
+  }
+
+  const objects = [];
+  for (let i = 0; i < 8; ++i) objects.push(make(i));
+  for (const o of objects) load(o);
+  for (let i = 0; i < 8; ++i) assertEquals(i, load(objects[i]));
+
+  // Generalize the field representation, which deprecates the old maps.
+  make(0).x = 0.5;
+  for (let i = 0; i < 8; ++i) assertEquals(i, load(objects[i]));
+  %OptimizeFunctionOnNextCall(load);
+  for (let i = 0; i < 8; ++i) assertEquals(i, load(objects[i]));
+  assertEquals(0.5, load({x: 0.5, p0: 0}));
+})();
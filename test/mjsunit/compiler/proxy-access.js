@@ -0,0 +1,69 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --noalways-opt
+
+// Test named loads and stores on proxies with and without traps.
+(function() {
+  const log = [];
+  const handler = {
+    get(target, name, receiver) {
+      log.push("get " + name);
+      return target[name];
+    },
+    set(target, name, value, receiver) {
+      log.push("set " + name);
+      target[name] = value;
+      return true;
+    }
+  };
+  const proxy = new Proxy({x: 1}, handler);
+
+  function load(p) { return p.x; }
+  function store(p, v) { p.x = v; }
+  function keyedLoad(p, k) { return p[k]; }
+
+  store(proxy, 2);
+  assertEquals(2, load(proxy));
+  assertEquals(2, keyedLoad(proxy, "x"));
+  %OptimizeFunctionOnNextCall(load);
+  %OptimizeFunctionOnNextCall(store);
+  %OptimizeFunctionOnNextCall(keyedLoad);
+  log.length = 0;
+  store(proxy, 3);
+  assertEquals(3, load(proxy));
+  assertEquals(3, keyedLoad(proxy, "x"));
+  assertEquals(["set x", "get x", "get x"], log);
+  assertOptimized(load);
+  assertOptimized(store);
+
+  // Other keys still work, and a revoked proxy throws.
+  assertEquals(undefined, keyedLoad(proxy, "y"));
+  const {proxy: revocable, revoke} = Proxy.revocable({x: 1}, {});
+  assertEquals(1, load(revocable));
+  revoke();
+  assertThrows(() => load(revocable), TypeError);
+})();
+
+// Test that a proxy without traps forwards to its target.
+(function() {
+  const target = {
+    get y() { return this === proxy; }
+  };
+  const proxy = new Proxy(target, {});
+
+  function load(p) { return p.y; }
+  function store(p, v) { "use strict"; p.z = v; }
+
+  assertTrue(load(proxy));
+  store(proxy, 1);
+  %OptimizeFunctionOnNextCall(load);
+  %OptimizeFunctionOnNextCall(store);
+  assertTrue(load(proxy));
+  store(proxy, 2);
+  assertEquals(2, target.z);
+
+  Object.freeze(target);
+  assertThrows(() => store(proxy, 3), TypeError);
+})();
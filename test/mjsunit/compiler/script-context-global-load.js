@@ -0,0 +1,43 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --noalways-opt
+
+// Top-level lexical declarations of this script are accessed as globals
+// from the script below.
+const kConst = {value: 1};
+let counter = 0;
+
+Realm.eval(Realm.current(), `
+  function loadConst() { return kConst.value; }
+  function loadLet() { return counter; }
+  function storeLet(v) { counter = v; }
+`);
+
+// Test that script-level consts are read correctly by optimized code.
+(function() {
+  assertEquals(1, loadConst());
+  assertEquals(1, loadConst());
+  %OptimizeFunctionOnNextCall(loadConst);
+  assertEquals(1, loadConst());
+  assertOptimized(loadConst);
+  kConst.value = 2;
+  assertEquals(2, loadConst());
+})();
+
+// Test that optimized code observes stores to script-level lets.
+(function() {
+  assertEquals(0, loadLet());
+  storeLet(1);
+  assertEquals(1, loadLet());
+  %OptimizeFunctionOnNextCall(loadLet);
+  %OptimizeFunctionOnNextCall(storeLet);
+  assertEquals(1, loadLet());
+  storeLet(2);
+  assertEquals(2, loadLet());
+  assertEquals(2, counter);
+  counter = 3;
+  assertEquals(3, loadLet());
+  assertOptimized(loadLet);
+})();
@@ -0,0 +1,48 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Test that appending to strings which got flattened in between still yields
+// the right results.
+(function() {
+  function accumulate(parts) {
+    var s = "";
+    for (var i = 0; i < parts.length; ++i) {
+      s += parts[i];
+      %FlattenString(s);
+      if (s.charCodeAt(s.length - 1) !== parts[i].charCodeAt(0)) return null;
+    }
+    return s;
+  }
+
+  var parts = [];
+  for (var i = 0; i < 100; ++i) parts.push(String.fromCharCode(97 + i % 26));
+  var expected = parts.join("");
+  assertEquals(expected, accumulate(parts));
+  assertEquals(expected, accumulate(parts));
+  %OptimizeFunctionOnNextCall(accumulate);
+  assertEquals(expected, accumulate(parts));
+
+  var two_byte_parts = parts.map(function(p) { return p + "☃"; });
+  assertEquals(two_byte_parts.join(""), accumulate(two_byte_parts));
+})();
+
+// Test the same for NewConsString, which TurboFan uses when it knows that
+// the result is long enough to be a cons string.
+(function() {
+  function append(s) { return s + "abcdefghijklmnopqrstuvwxyz"; }
+
+  var s = "0123456789abcdef";
+  assertEquals(s + "abcdefghijklmnopqrstuvwxyz", append(s));
+  assertEquals(s + "abcdefghijklmnopqrstuvwxyz", append(s));
+  %OptimizeFunctionOnNextCall(append);
+  var r = s;
+  for (var i = 0; i < 10; ++i) {
+    r = append(r);
+    %FlattenString(r);
+  }
+  assertEquals(16 + 26 * 10, r.length);
+  assertEquals("0123456789abcdef" + "abcdefghijklmnopqrstuvwxyz".repeat(10), r);
+})();
@@ -0,0 +1,57 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --noalways-opt
+
+// Test that loops inside of try-blocks still catch exceptions thrown in
+// the loop body once optimized.
+(function() {
+  function thrower(i) {
+    if (i === 7) throw i;
+    return i;
+  }
+
+  function foo(n) {
+    let sum = 0;
+    try {
+      for (let i = 0; i < n; ++i) {
+        sum += thrower(i);
+      }
+    } catch (e) {
+      return -e;
+    } finally {
+      sum++;
+    }
+    return sum;
+  }
+
+  assertEquals(4, foo(3));
+  assertEquals(-7, foo(10));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(4, foo(3));
+  assertEquals(-7, foo(10));
+  assertOptimized(foo);
+})();
+
+// Test that a stack overflow from within a loop is still catchable.
+(function() {
+  function recurse() { return recurse(); }
+
+  function foo(n) {
+    let caught = 0;
+    for (let i = 0; i < n; ++i) {
+      try {
+        recurse();
+      } catch (e) {
+        assertInstanceof(e, RangeError);
+        caught++;
+      }
+    }
+    return caught;
+  }
+
+  assertEquals(2, foo(2));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(2, foo(2));
+})();
@@ -0,0 +1,48 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-bounds-check-elimination
+
+// Bounds checks implied by the loop condition can be removed.
+(function() {
+  function sum(a) {
+    var result = 0;
+    for (var i = 0; i < a.length; i++) result += a[i];
+    return result;
+  }
+  var a = new Float64Array([1, 2, 3, 4]);
+  assertEquals(10, sum(a));
+  assertEquals(10, sum(a));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(10, sum(a));
+  assertEquals(3, sum(new Float64Array([1, 2])));
+})();
+
+// A non-strict loop condition does not imply the bounds check.
+(function() {
+  function sum(a) {
+    var result = 0;
+    for (var i = 0; i <= a.length; i++) result += a[i];
+    return result;
+  }
+  var a = new Float64Array([1, 2, 3, 4]);
+  assertEquals(NaN, sum(a));
+  assertEquals(NaN, sum(a));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(NaN, sum(a));
+})();
+
+// A condition on the length of another array does not imply the bounds check.
+(function() {
+  function copy(a, b) {
+    for (var i = 0; i < b.length; i++) a[i] = b[i];
+    return a;
+  }
+  var a = new Float64Array(2);
+  var b = new Float64Array([1, 2, 3]);
+  assertEquals([1, 2], Array.from(copy(a, b)));
+  assertEquals([1, 2], Array.from(copy(a, b)));
+  %OptimizeFunctionOnNextCall(copy);
+  assertEquals([1, 2], Array.from(copy(a, b)));
+})();
@@ -0,0 +1,58 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --harmony-sharedarraybuffer
+
+if (this.Worker) {
+  (function TestTransferRoundTrip() {
+    // The worker increments every element and transfers the buffer back.
+    var workerScript =
+      `onmessage = function(ab) {
+        var ta = new Uint32Array(ab);
+        for (var i = 0; i < ta.length; ++i) ta[i]++;
+        postMessage(ab, [ab]);
+      };`;
+    var w = new Worker(workerScript, {type: 'string'});
+    var ab = new ArrayBuffer(1024);
+    for (var round = 0; round < 10; ++round) {
+      w.postMessage(ab, [ab]);
+      assertEquals(0, ab.byteLength);
+      ab = w.getMessage();
+      assertEquals(1024, ab.byteLength);
+    }
+    var ta = new Uint32Array(ab);
+    for (var i = 0; i < ta.length; ++i) assertEquals(10, ta[i]);
+    w.terminate();
+  })();
+
+  (function TestTransferSharedArrayBuffer() {
+    var workerScript =
+      `onmessage = function(sab) {
+        new Int32Array(sab)[0] = 42;
+        postMessage('done');
+      };`;
+    var w = new Worker(workerScript, {type: 'string'});
+    var sab = new SharedArrayBuffer(16);
+    // SharedArrayBuffers are shared, not detached, by a transfer.
+    w.postMessage(sab, [sab]);
+    assertEquals(16, sab.byteLength);
+    assertEquals('done', w.getMessage());
+    assertEquals(42, new Int32Array(sab)[0]);
+    w.terminate();
+  })();
+
+  (function TestMessageOrder() {
+    var workerScript = `onmessage = function(m) { postMessage(m); };`;
+    var w = new Worker(workerScript, {type: 'string'});
+    for (var i = 0; i < 1000; ++i) w.postMessage(i);
+    for (var i = 0; i < 1000; ++i) assertEquals(i, w.getMessage());
+    w.terminate();
+  })();
+
+  (function TestBadTransferList() {
+    var w = new Worker('', {type: 'string'});
+    assertThrows(function() { w.postMessage([], [{}]); });
+    w.terminate();
+  })();
+}
@@ -0,0 +1,61 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Fixed-width ES5 date-time strings take a fast path in the date parser.
+// Check them against Date.UTC and the equivalent local-time constructors.
+
+assertEquals(Date.UTC(2019, 0, 15), Date.parse('2019-01-15'));
+assertEquals(Date.UTC(2019, 0, 15, 12, 30), Date.parse('2019-01-15T12:30Z'));
+assertEquals(Date.UTC(2019, 0, 15, 12, 30, 45),
+             Date.parse('2019-01-15T12:30:45Z'));
+assertEquals(Date.UTC(2019, 0, 15, 12, 30, 45, 678),
+             Date.parse('2019-01-15T12:30:45.678Z'));
+assertEquals(Date.UTC(2019, 0, 15, 12, 30, 45, 678),
+             Date.parse('2019-01-15t12:30:45.678z'));
+assertEquals(Date.UTC(1900, 1, 28), Date.parse('1900-02-28'));
+assertEquals(Date.UTC(2000, 1, 29), Date.parse('2000-02-29'));
+assertEquals(-62167219200000, Date.parse('0000-01-01T00:00:00.000Z'));
+assertEquals(253402300799999, Date.parse('9999-12-31T23:59:59.999Z'));
+
+// Date-time forms without a time zone are local time.
+assertEquals(new Date(2019, 5, 1, 8, 15).getTime(),
+             Date.parse('2019-06-01T08:15'));
+assertEquals(new Date(2019, 5, 1, 8, 15, 30).getTime(),
+             Date.parse('2019-06-01T08:15:30'));
+assertEquals(new Date(2019, 5, 1, 8, 15, 30, 250).getTime(),
+             Date.parse('2019-06-01T08:15:30.250'));
+
+// Midnight at the end of the day.
+assertEquals(Date.UTC(2019, 0, 16), Date.parse('2019-01-15T24:00Z'));
+assertEquals(Date.UTC(2019, 0, 16), Date.parse('2019-01-15T24:00:00.000Z'));
+assertEquals(NaN, Date.parse('2019-01-15T24:00:01Z'));
+assertEquals(NaN, Date.parse('2019-01-15T24:00:00.001Z'));
+
+// Out-of-range components.
+assertEquals(NaN, Date.parse('2019-01-15T25:00Z'));
+assertEquals(NaN, Date.parse('2019-01-15T12:60Z'));
+assertEquals(NaN, Date.parse('2019-01-15T12:30:60Z'));
+assertEquals(NaN, Date.parse('2019-13-15'));
+assertEquals(NaN, Date.parse('2019-00-15'));
+assertEquals(NaN, Date.parse('2019-01-32'));
+assertEquals(NaN, Date.parse('2019-01-00'));
+
+// Round trips through toISOString.
+for (let time = -1e13; time < 1e13; time += 123456789013) {
+  const date = new Date(time);
+  if (date.getUTCFullYear() < 0 || date.getUTCFullYear() > 9999) continue;
+  assertEquals(time, Date.parse(date.toISOString()));
+}
+
+// Other shapes are still handled by the general parser.
+assertEquals(Date.UTC(2019, 0, 15, 12, 30, 45, 600),
+             Date.parse('2019-01-15T12:30:45.6Z'));
+assertEquals(Date.UTC(2019, 0, 15, 12, 30, 45, 678),
+             Date.parse('2019-01-15T12:30:45.6789Z'));
+assertEquals(Date.UTC(2019, 0, 15, 10, 30),
+             Date.parse('2019-01-15T12:30+02:00'));
+assertEquals(Date.UTC(2019, 0, 1), Date.parse('2019-01'));
+assertEquals(Date.UTC(-1, 0, 1), Date.parse('-000001-01-01T00:00:00Z'));
+assertEquals(new Date(2019, 0, 15).getTime(), Date.parse('Jan 15 2019'));
+assertEquals(new Date(2019, 0, 15).getTime(), Date.parse('2019/01/15'));
@@ -110,3 +110,20 @@ for (var constructor of typedArrayConstructors) {
   %ArrayBufferDetach(array.buffer);
   assertThrows(() => array.lastIndexOf(tmp), TypeError);
 }
+
+// Search across whole blocks and the remaining tail.
+for (var constructor of typedArrayConstructors) {
+  var array = new constructor(101);
+  for (var i = 0; i < array.length; i++) {
+    array.fill(0);
+    array[i] = 7;
+    assertEquals(i, array.indexOf(7));
+    assertTrue(array.includes(7));
+    assertEquals(i, array.indexOf(7, i));
+    assertEquals(-1, array.indexOf(7, i + 1));
+    assertEquals(i == 0 ? 1 : 0, array.indexOf(0));
+  }
+  array.fill(0);
+  assertEquals(-1, array.indexOf(7));
+  assertFalse(array.includes(7));
+}
@@ -0,0 +1,91 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Large typed arrays are sorted with a radix sort and copied between element
+// kinds with bulk conversions. Check both against the generic paths.
+
+var typedArrayConstructors = [
+  Uint8Array,
+  Int8Array,
+  Uint16Array,
+  Int16Array,
+  Uint32Array,
+  Int32Array,
+  Uint8ClampedArray,
+  Float32Array,
+  Float64Array
+];
+
+var seed = 1234;
+function Random() {
+  seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+  return seed / 0x7fffffff;
+}
+
+var specialValues = [
+  0, -0, NaN, Infinity, -Infinity, 0.5, -0.5, 1.5, -1.5, 255.5, 256, -1,
+  2147483647, 2147483648, -2147483648, -2147483649, 4294967295, 4294967296,
+  1e10, -1e10, 1e20, -1e20, 1e300, -1e300, 5e-324
+];
+
+function RandomValues(length) {
+  var values = [];
+  for (var i = 0; i < length; i++) {
+    if (Random() < 0.1) {
+      values.push(specialValues[Math.floor(Random() * specialValues.length)]);
+    } else {
+      values.push((Random() - 0.5) * Math.pow(2, Math.floor(Random() * 40)));
+    }
+  }
+  return values;
+}
+
+function CompareNumbers(a, b) {
+  if (a < b) return -1;
+  if (a > b) return 1;
+  if (a === 0 && b === 0) return Object.is(a, -0) ? (Object.is(b, -0) ? 0 : -1)
+                                                  : (Object.is(b, -0) ? 1 : 0);
+  if (isNaN(a)) return isNaN(b) ? 0 : 1;
+  if (isNaN(b)) return -1;
+  return 0;
+}
+
+function assertArrayLikeSame(expected, value) {
+  assertEquals(expected.length, value.length);
+  for (var i = 0; i < expected.length; ++i) {
+    assertSame(expected[i], value[i]);
+  }
+}
+
+(function TestSort() {
+  for (var constructor of typedArrayConstructors) {
+    for (var length of [255, 256, 257, 1000, 10000]) {
+      var a = new constructor(RandomValues(length));
+      var b = new constructor(a);
+      a.sort();
+      b.sort(CompareNumbers);
+      assertArrayLikeSame(b, a);
+    }
+    // All elements in a single bucket for some digits.
+    var c = new constructor(1000);
+    for (var i = 0; i < c.length; i++) c[i] = (i * 7) % 100;
+    var d = new constructor(c);
+    c.sort();
+    d.sort(CompareNumbers);
+    assertArrayLikeSame(d, c);
+  }
+})();
+
+(function TestSet() {
+  for (var source_constructor of typedArrayConstructors) {
+    var source = new source_constructor(RandomValues(1003));
+    for (var target_constructor of typedArrayConstructors) {
+      var target = new target_constructor(source.length + 5);
+      target.set(source, 5);
+      var expected = new target_constructor(source.length + 5);
+      for (var i = 0; i < source.length; i++) expected[i + 5] = source[i];
+      assertArrayLikeSame(expected, target);
+    }
+  }
+})();
@@ -0,0 +1,74 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Spread properties after the first one go through the CopyDataProperties
+// builtin instead of CloneObjectIC.
+
+function Merge(a, b) { return {...a, ...b}; }
+function MergeWithPrefix(a, b) { return {x: 0, ...a, y: 1, ...b}; }
+
+function Test() {
+  assertEquals({a: 1, b: 3, c: 4}, Merge({a: 1, b: 2}, {b: 3, c: 4}));
+  assertEquals({x: 0, a: 1, y: 2, b: 3},
+               MergeWithPrefix({a: 1, y: 5}, {y: 2, b: 3}));
+  assertEquals(['x', 'a', 'y', 'b'],
+               Object.keys(MergeWithPrefix({a: 1}, {y: 2, b: 3})));
+
+  // Sources without own enumerable properties.
+  assertEquals({a: 1}, Merge({a: 1}, null));
+  assertEquals({a: 1}, Merge({a: 1}, undefined));
+  assertEquals({a: 1}, Merge({a: 1}, 42));
+  assertEquals({a: 1}, Merge({a: 1}, true));
+  assertEquals({a: 1}, Merge({a: 1}, Symbol()));
+  assertEquals({a: 1}, Merge({a: 1}, ''));
+
+  // Sources handled by the runtime.
+  assertEquals({a: 1, 0: 'x', 1: 'y'}, Merge({a: 1}, 'xy'));
+  assertEquals({a: 1, 0: 2, 1: 3}, Merge({a: 1}, [2, 3]));
+  assertEquals({a: 1, p: 2}, Merge({a: 1}, new Proxy({p: 2}, {})));
+  var dictionary = {p: 1, q: 2};
+  delete dictionary.q;
+  assertEquals({a: 1, p: 1}, Merge({a: 1}, dictionary));
+
+  // Non-enumerable, symbol and inherited properties.
+  var symbol = Symbol('s');
+  var source = Object.create({inherited: 1});
+  Object.defineProperty(source, 'hidden', {value: 1, enumerable: false});
+  source[symbol] = 2;
+  source.visible = 3;
+  var result = Merge({}, source);
+  assertEquals(['visible'], Object.keys(result));
+  assertEquals(2, result[symbol]);
+
+  // Getters run in order and define data properties on the result.
+  var log = [];
+  var getters = {
+    get a() { log.push('a'); return 1; },
+    get b() { log.push('b'); return 2; }
+  };
+  result = Merge({b: 0}, getters);
+  assertEquals(['a', 'b'], log);
+  assertEquals({b: 2, a: 1}, result);
+  var desc = Object.getOwnPropertyDescriptor(result, 'a');
+  assertTrue(desc.writable && desc.enumerable && desc.configurable);
+
+  // Setters on Object.prototype are not triggered.
+  Object.defineProperty(Object.prototype, 'trap', {
+    set(v) { throw new Error('setter called'); },
+    configurable: true
+  });
+  assertEquals({trap: 1}, Merge({}, {trap: 1}));
+  delete Object.prototype.trap;
+
+  // Exceptions from getters propagate.
+  assertThrows(() => Merge({}, {get a() { throw new Error(); }}), Error);
+}
+
+Test();
+Test();
+%OptimizeFunctionOnNextCall(Merge);
+%OptimizeFunctionOnNextCall(MergeWithPrefix);
+Test();
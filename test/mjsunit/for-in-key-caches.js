@@ -0,0 +1,104 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Dictionary-mode objects and receivers with enumerable prototypes cache
+// their for-in keys. Check that every mutation is reflected.
+
+function ForInKeys(object) {
+  var keys = [];
+  for (var key in object) keys.push(key);
+  return keys;
+}
+
+(function TestDictionaryModeReceiver() {
+  var o = {a: 1, b: 2, c: 3};
+  delete o.b;
+  assertFalse(%HasFastProperties(o));
+  assertEquals(['a', 'c'], Object.keys(o));
+  assertEquals(['a', 'c'], ForInKeys(o));
+  // A cached result is not leaked to the caller.
+  Object.keys(o).push('x');
+  assertEquals(['a', 'c'], Object.keys(o));
+
+  o.d = 4;
+  assertEquals(['a', 'c', 'd'], Object.keys(o));
+  assertEquals(['a', 'c', 'd'], ForInKeys(o));
+  delete o.a;
+  assertEquals(['c', 'd'], Object.keys(o));
+  assertEquals(['c', 'd'], ForInKeys(o));
+  Object.defineProperty(o, 'c', {enumerable: false});
+  assertEquals(['d'], Object.keys(o));
+  assertEquals(['d'], ForInKeys(o));
+  Object.defineProperty(o, 'c', {enumerable: true});
+  assertEquals(['c', 'd'], Object.keys(o));
+  o[0] = 0;
+  assertEquals(['0', 'c', 'd'], Object.keys(o));
+  assertEquals(['0', 'c', 'd'], ForInKeys(o));
+  o[Symbol()] = 5;
+  assertEquals(['0', 'c', 'd'], ForInKeys(o));
+  for (var i = 0; i < 100; i++) o['p' + i] = i;
+  assertEquals(103, Object.keys(o).length);
+  assertEquals(103, ForInKeys(o).length);
+  assertEquals([0, 3, 4], Object.values(o).slice(0, 3));
+})();
+
+(function TestEnumerablePrototype() {
+  function Make(proto) {
+    var o = Object.create(proto);
+    o.own = 1;
+    return o;
+  }
+  var proto = {inherited: 1};
+  var o = Make(proto);
+  for (var i = 0; i < 3; i++) {
+    assertEquals(['own', 'inherited'], ForInKeys(o));
+  }
+  // Other receivers with the same map share the cache.
+  assertEquals(['own', 'inherited'], ForInKeys(Make(proto)));
+
+  proto.added = 2;
+  assertEquals(['own', 'inherited', 'added'], ForInKeys(o));
+  delete proto.inherited;
+  assertEquals(['own', 'added'], ForInKeys(o));
+  Object.defineProperty(proto, 'added', {enumerable: false});
+  assertEquals(['own'], ForInKeys(o));
+  Object.defineProperty(proto, 'added', {enumerable: true});
+  assertEquals(['own', 'added'], ForInKeys(o));
+
+  proto[0] = 0;
+  assertEquals(['own', '0', 'added'], ForInKeys(o));
+  delete proto[0];
+  assertEquals(['own', 'added'], ForInKeys(o));
+  o[1] = 1;
+  assertEquals(['1', 'own', 'added'], ForInKeys(o));
+  delete o[1];
+  assertEquals(['own', 'added'], ForInKeys(o));
+
+  // Changes further up the prototype chain.
+  var grand_proto = {grand: 3};
+  Object.setPrototypeOf(proto, grand_proto);
+  assertEquals(['own', 'added', 'grand'], ForInKeys(o));
+  grand_proto.more = 4;
+  assertEquals(['own', 'added', 'grand', 'more'], ForInKeys(o));
+  Object.prototype.polluted = 5;
+  assertEquals(['own', 'added', 'grand', 'more', 'polluted'], ForInKeys(o));
+  delete Object.prototype.polluted;
+  assertEquals(['own', 'added', 'grand', 'more'], ForInKeys(o));
+
+  // Shadowing by the receiver.
+  Object.defineProperty(o, 'grand', {value: 0, enumerable: false});
+  assertEquals(['own', 'added', 'more'], ForInKeys(o));
+  o.added = 7;
+  assertEquals(['own', 'added', 'more'], ForInKeys(o));
+
+  // Dictionary-mode prototypes are not cached, but must still work.
+  var dictionary_proto = {x: 1, y: 2};
+  delete dictionary_proto.y;
+  var p = Object.create(dictionary_proto);
+  assertEquals(['x'], ForInKeys(p));
+  dictionary_proto.z = 3;
+  assertEquals(['x', 'z'], ForInKeys(p));
+})();
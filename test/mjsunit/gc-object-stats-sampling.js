@@ -0,0 +1,11 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --track-gc-object-stats --gc-object-stats-sampling-rate=4
+// Flags: --expose-gc
+
+var objects = [];
+for (var i = 0; i < 10000; i++) objects.push({a: i, b: [i], c: 'x' + i});
+for (var i = 0; i < 5; i++) gc();
+assertEquals(10000, objects.length);
@@ -0,0 +1,74 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --harmony-await-optimization
+
+// Await in async functions resumes the function directly from the promise
+// reaction job. Check that values, exceptions and the order of ticks are
+// the same for all kinds of awaited values.
+
+// Values and exceptions.
+(function() {
+  class MyPromise extends Promise {}
+  const thenable = {then(resolve) { resolve('thenable'); }};
+  const throwing_thenable = {then(resolve, reject) { reject('rejected'); }};
+
+  async function test() {
+    assertEquals(1, await 1);
+    assertEquals(undefined, await undefined);
+    assertEquals('native', await Promise.resolve('native'));
+    assertEquals('subclass', await MyPromise.resolve('subclass'));
+    assertEquals('thenable', await thenable);
+    try {
+      await Promise.reject('native rejection');
+      assertUnreachable();
+    } catch (e) {
+      assertEquals('native rejection', e);
+    }
+    try {
+      await throwing_thenable;
+      assertUnreachable();
+    } catch (e) {
+      assertEquals('rejected', e);
+    }
+    let sum = 0;
+    for (let i = 0; i < 1000; i++) sum += await i;
+    return sum;
+  }
+
+  assertPromiseResult(test(), v => assertEquals(499500, v));
+})();
+
+// Awaiting a pending promise from several async functions at once.
+(function() {
+  let resolve;
+  const promise = new Promise(r => resolve = r);
+  async function wait(x) { return x + await promise; }
+
+  const results = [wait(1), wait(2), wait(3)];
+  resolve(10);
+  assertPromiseResult(Promise.all(results),
+                      v => assertEquals([11, 12, 13], v));
+})();
+
+// Awaiting a native promise and a non-promise both take a single tick.
+(function() {
+  const actual = [];
+
+  async function f(value) {
+    actual.push('before');
+    await value;
+    actual.push('after');
+  }
+
+  f(Promise.resolve());
+  f(42);
+  Promise.resolve().then(() => actual.push('tick 1'))
+                   .then(() => actual.push('tick 2'));
+
+  assertPromiseResult(Promise.resolve().then().then().then(), () => {
+    assertEquals(['before', 'before', 'after', 'after', 'tick 1', 'tick 2'],
+                 actual);
+  });
+})();
@@ -0,0 +1,107 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Large operands take the Karatsuba, Burnikel-Ziegler and divide-and-conquer
+// toString paths. Check them against results built from small operations.
+
+'use strict'
+
+let seed = 1234;
+function RandomHex(length) {
+  let result = '';
+  for (let i = 0; i < length; i++) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    result += ((seed >> 16) & 0xf).toString(16);
+  }
+  return (result[0] === '0' ? 'f' : '') + result;
+}
+function RandomBigInt(bits) {
+  return BigInt('0x' + RandomHex(bits / 4));
+}
+
+// Multiplies by {y} in 32-bit pieces, each of which is a single digit.
+function ReferenceMultiply(x, y) {
+  let result = 0n;
+  let shift = 0n;
+  while (y > 0n) {
+    result += (x * (y & 0xffffffffn)) << shift;
+    y >>= 32n;
+    shift += 32n;
+  }
+  return result;
+}
+
+// Parses {string} in {radix} with single-digit multiplications.
+function ReferenceParse(string, radix) {
+  let result = 0n;
+  const big_radix = BigInt(radix);
+  for (const c of string) {
+    result = result * big_radix + BigInt(parseInt(c, radix));
+  }
+  return result;
+}
+
+const sizes = [1000, 2200, 4000, 8000, 20000];
+
+(function TestMultiply() {
+  for (const x_bits of sizes) {
+    for (const y_bits of sizes) {
+      const x = RandomBigInt(x_bits);
+      const y = RandomBigInt(y_bits);
+      const product = x * y;
+      assertEquals(ReferenceMultiply(x, y), product);
+      assertEquals(-product, -x * y);
+      assertEquals(product, (-x) * (-y));
+    }
+  }
+  // Operands with long runs of all-ones and all-zeros digits.
+  const ones = (1n << 10000n) - 1n;
+  assertEquals((1n << 20000n) - (1n << 10001n) + 1n, ones * ones);
+  const sparse = (1n << 9000n) + 1n;
+  assertEquals((1n << 18000n) + (1n << 9001n) + 1n, sparse * sparse);
+})();
+
+(function TestDivide() {
+  for (const x_bits of sizes) {
+    for (const y_bits of sizes) {
+      if (y_bits > x_bits) continue;
+      const x = RandomBigInt(x_bits);
+      const y = RandomBigInt(y_bits);
+      const quotient = x / y;
+      const remainder = x % y;
+      assertTrue(remainder >= 0n);
+      assertTrue(remainder < y);
+      assertEquals(x, quotient * y + remainder);
+      assertEquals(-quotient, -x / y);
+      assertEquals(-remainder, -x % y);
+      const product = x * y;
+      assertEquals(x, product / y);
+      assertEquals(0n, product % y);
+      assertEquals(x, (product + remainder) / y);
+      assertEquals(remainder, (product + remainder) % y);
+    }
+  }
+  // Exercise the quotient-digit correction steps.
+  const y = (1n << 8000n) - 1n;
+  const x = (y << 8000n) - 1n;
+  assertEquals((1n << 8000n) - 1n, x / y);
+  assertEquals(y - 1n, x % y);
+})();
+
+(function TestToString() {
+  for (const bits of sizes) {
+    const x = RandomBigInt(bits);
+    for (const radix of [3, 7, 10, 36]) {
+      const string = x.toString(radix);
+      assertEquals(x, ReferenceParse(string, radix));
+      assertEquals('-' + string, (-x).toString(radix));
+    }
+    assertEquals(x, BigInt(x.toString()));
+  }
+  // Powers of the radix produce long runs of zeros.
+  const power = 10n ** 5000n;
+  assertEquals('1' + '0'.repeat(5000), power.toString());
+  assertEquals('9'.repeat(5000), (power - 1n).toString());
+  assertEquals('1' + '0'.repeat(4999) + '1', (power + 1n).toString());
+})();
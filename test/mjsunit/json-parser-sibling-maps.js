@@ -0,0 +1,67 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+(function TestHomogeneousObjects() {
+  var rows = JSON.parse(
+      '[{"id":1,"name":"a","ok":true},{"id":2,"name":"b","ok":false},' +
+      '{"id":3,"name":"c","ok":null}]');
+  assertEquals(3, rows.length);
+  assertEquals({id: 3, name: "c", ok: null}, rows[2]);
+  assertTrue(%HaveSameMap(rows[0], rows[1]));
+  assertTrue(%HaveSameMap(rows[1], rows[2]));
+})();
+
+(function TestDifferentKeyOrder() {
+  var rows = JSON.parse('[{"a":1,"b":2},{"b":3,"a":4},{"a":5,"b":6}]');
+  assertEquals(["b", "a"], Object.keys(rows[1]));
+  assertEquals({b: 3, a: 4}, rows[1]);
+  assertEquals({a: 5, b: 6}, rows[2]);
+  assertFalse(%HaveSameMap(rows[0], rows[1]));
+  assertTrue(%HaveSameMap(rows[0], rows[2]));
+})();
+
+(function TestFewerAndMoreKeys() {
+  var rows = JSON.parse(
+      '[{"a":1,"b":2,"c":3},{"a":4},{"a":5,"b":6,"c":7,"d":8},{}]');
+  assertEquals({a: 4}, rows[1]);
+  assertEquals({a: 5, b: 6, c: 7, d: 8}, rows[2]);
+  assertEquals({}, rows[3]);
+  var prefix = JSON.parse('{"a":0}');
+  assertTrue(%HaveSameMap(prefix, rows[1]));
+})();
+
+(function TestRepresentationChange() {
+  var rows = JSON.parse(
+      '[{"x":1,"y":"s"},{"x":1.5,"y":"t"},{"x":{},"y":2},{"x":3,"y":"u"}]');
+  assertEquals(1, rows[0].x);
+  assertEquals(1.5, rows[1].x);
+  assertEquals({}, rows[2].x);
+  assertEquals(2, rows[2].y);
+  assertEquals({x: 3, y: "u"}, rows[3]);
+})();
+
+(function TestElementsAndNesting() {
+  var rows = JSON.parse(
+      '[{"0":"e","k":{"k":1}},{"0":"f","k":{"k":2.5}},{"1":"g","k":[]}]');
+  assertEquals("e", rows[0][0]);
+  assertEquals(2.5, rows[1].k.k);
+  assertEquals(undefined, rows[2][0]);
+  assertEquals("g", rows[2][1]);
+  assertEquals([], rows[2].k);
+})();
+
+(function TestEscapedAndDuplicateKeys() {
+  var rows = JSON.parse(
+      '[{"a\\"b":1,"c":2},{"a\\"b":3,"c":4},{"c":5,"c":6}]');
+  assertEquals(3, rows[1]['a"b']);
+  assertEquals({c: 6}, rows[2]);
+})();
+
+(function TestReviver() {
+  var rows = JSON.parse('[{"a":1,"b":2},{"a":3,"b":4}]',
+                        (key, value) => key === "b" ? value * 10 : value);
+  assertEquals({a: 3, b: 40}, rows[1]);
+})();
@@ -0,0 +1,82 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --harmony-json-stringify
+
+// Reference implementation of JSON string quoting, one character at a time.
+function quote(string) {
+  var result = '"';
+  for (var i = 0; i < string.length; i++) {
+    var c = string.charCodeAt(i);
+    if (c == 0x22) {
+      result += '\\"';
+    } else if (c == 0x5C) {
+      result += '\\\\';
+    } else if (c == 0x08) {
+      result += '\\b';
+    } else if (c == 0x09) {
+      result += '\\t';
+    } else if (c == 0x0A) {
+      result += '\\n';
+    } else if (c == 0x0C) {
+      result += '\\f';
+    } else if (c == 0x0D) {
+      result += '\\r';
+    } else if (c < 0x20) {
+      result += '\\u' + c.toString(16).padStart(4, '0');
+    } else if (c >= 0xD800 && c <= 0xDBFF && i + 1 < string.length &&
+               string.charCodeAt(i + 1) >= 0xDC00 &&
+               string.charCodeAt(i + 1) <= 0xDFFF) {
+      result += string[i] + string[i + 1];
+      i++;
+    } else if (c >= 0xD800 && c <= 0xDFFF) {
+      result += '\\u' + c.toString(16);
+    } else {
+      result += string[i];
+    }
+  }
+  return result + '"';
+}
+
+function check(string) {
+  assertEquals(quote(string), JSON.stringify(string));
+  assertEquals('[' + quote(string) + ',' + quote(string) + ']',
+               JSON.stringify([string, string]));
+}
+
+// Long runs of plain text, with characters that need escaping scattered at
+// every offset relative to a 16-byte vector.
+var plain = 'The quick brown fox jumps over the lazy dog. ';
+var one_byte = plain.repeat(2000);
+check(one_byte);
+check(one_byte + '\xFF\x7F\x80 !#');
+var specials = ['"', '\\', '\n', '\x00', '\x1F', '\x7F', ' ', '!', '\xE9'];
+for (var offset = 0; offset < 40; offset++) {
+  var special = specials[offset % specials.length];
+  check(plain.substring(0, offset) + special + plain + special);
+}
+check(one_byte.split('o').join('"\\\x01'));
+
+// Two-byte strings, including surrogate pairs and lone surrogates on either
+// side of the boundaries between string builder parts.
+var two_byte = (' Āabc' + plain).repeat(1000);
+check(two_byte);
+check(two_byte.split('a').join('"\\\tሴ'));
+for (var length = 4090; length < 4100; length++) {
+  var prefix = 'x'.repeat(length) + 'Ā';
+  check(prefix + '𝌆'.repeat(5000));
+  check(prefix + '\uD834'.repeat(5000));
+  check(prefix + '\uDF06\uD834'.repeat(5000));
+}
+for (var length = 16380; length < 16390; length++) {
+  check('Ā' + 'y'.repeat(length) + '𝌆' + '\uDF06');
+}
+
+// Long strings inside objects, which share string builder parts with the
+// surrounding output.
+var object = {key: one_byte, other: two_byte, short: 'a"b'};
+assertEquals(
+    '{"key":' + quote(one_byte) + ',"other":' + quote(two_byte) +
+        ',"short":' + quote('a"b') + '}',
+    JSON.stringify(object));
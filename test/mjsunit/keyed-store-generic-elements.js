@@ -0,0 +1,91 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Make the keyed store site below megamorphic, so that the generic keyed
+// store is used.
+function store(o, i, v) { o[i] = v; }
+for (let i = 0; i < 10; ++i) {
+  const o = {};
+  o["p" + i] = 0;
+  store(o, "x", i);
+}
+
+// Test stores that grow the backing store.
+(function() {
+  const smis = [];
+  const doubles = [0.5];
+  const objects = [{}];
+  for (let i = 0; i < 100; ++i) {
+    store(smis, i, i);
+    store(doubles, i + 1, i + 0.5);
+    store(objects, i + 1, {i});
+  }
+  assertEquals(100, smis.length);
+  assertEquals(99, smis[99]);
+  assertEquals(101, doubles.length);
+  assertEquals(99.5, doubles[100]);
+  assertEquals(101, objects.length);
+  assertEquals(99, objects[100].i);
+
+  // Stores that leave a gap.
+  const holey = [1, 2, 3];
+  store(holey, 50, 4);
+  assertEquals(51, holey.length);
+  assertFalse(3 in holey);
+  assertEquals(4, holey[50]);
+
+  // Plain objects with elements.
+  const o = {};
+  store(o, 0, 1);
+  store(o, 20, 2);
+  assertEquals(1, o[0]);
+  assertEquals(2, o[20]);
+  assertEquals(["0", "20"], Object.keys(o));
+
+  // Non-extensible objects don't grow.
+  const sealed = Object.preventExtensions([1, 2]);
+  store(sealed, 2, 3);
+  assertEquals(2, sealed.length);
+  assertFalse(2 in sealed);
+
+  // A setter on the prototype chain is called.
+  const proto = [];
+  let set_value;
+  Object.defineProperty(proto, 5, {set(v) { set_value = v; }});
+  const a = [];
+  Object.setPrototypeOf(a, proto);
+  store(a, 5, 42);
+  assertEquals(42, set_value);
+  assertFalse(a.hasOwnProperty(5));
+})();
+
+// Test stores into dictionary elements.
+(function() {
+  const sparse = [];
+  sparse[100000] = 1;
+  sparse[1] = 2;
+  assertTrue(%HasDictionaryElements(sparse));
+  store(sparse, 100000, 3);
+  store(sparse, 1, 4);
+  assertEquals(3, sparse[100000]);
+  assertEquals(4, sparse[1]);
+  store(sparse, 7, 5);
+  assertEquals(5, sparse[7]);
+  assertEquals(100001, sparse.length);
+
+  // Read-only elements are not overwritten.
+  const frozen = Object.freeze(sparse);
+  store(frozen, 1, 6);
+  assertEquals(4, frozen[1]);
+
+  // Accessors are called.
+  const o = [];
+  o[100000] = 0;
+  let got;
+  Object.defineProperty(o, 3, {set(v) { got = v; }, configurable: true});
+  store(o, 3, 7);
+  assertEquals(7, got);
+})();
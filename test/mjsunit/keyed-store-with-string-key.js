@@ -0,0 +1,43 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Test keyed stores with polymorphic name feedback and keys that are built
+// dynamically, i.e. are not internalized.
+(function() {
+  function store(o, key, v) { o[key] = v; }
+
+  const prefix = "fo";
+  const objects = [{foo: 0}, {foo: 0, a: 0}, {foo: 0, b: 0}];
+  for (let i = 0; i < 10; ++i) {
+    for (const o of objects) {
+      store(o, prefix + "o", i);
+      assertEquals(i, o.foo);
+    }
+  }
+
+  // Keys that are not in the string table yet.
+  const o = {foo: 0};
+  store(o, prefix + "x", 1);
+  assertEquals(1, o.fox);
+  assertEquals(0, o.foo);
+})();
+
+// Same for objects in dictionary mode, where the handler looks up the name.
+(function() {
+  function store(o, key, v) { o[key] = v; }
+
+  const objects = [];
+  for (let i = 0; i < 3; ++i) {
+    const o = {bar: 0};
+    o["p" + i] = 0;
+    delete o["p" + i];
+    objects.push(o);
+  }
+  for (let i = 0; i < 10; ++i) {
+    for (const o of objects) {
+      store(o, "ba" + "r", i);
+      assertEquals(i, o.bar);
+    }
+  }
+})();
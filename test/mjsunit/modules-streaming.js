@@ -0,0 +1,19 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MODULE
+// Flags: --streaming-compile
+
+// The same dependency is requested through two specifiers and through a
+// cycle, so it must be fetched and compiled only once.
+import {a, set_a, get_a} from "modules-skip-1.js";
+import * as one from "./modules-skip-1.js";
+import {foo} from "modules-cycle.js";
+
+assertEquals(1, a);
+assertEquals(1, foo);
+set_a(2);
+assertEquals(2, one.a);
+assertEquals(2, foo);
+assertEquals(2, get_a());
@@ -0,0 +1,42 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --parallel-compile-tasks-for-lazy --use-external-strings
+
+var outer_var = 42;
+
+function lazy_outer() {
+  return outer_var;
+}
+
+function lazy_with_params(a, b = 2, ...rest) {
+  return a + b + rest.length;
+}
+
+function* lazy_generator() {
+  yield 1;
+  yield 2;
+}
+
+async function lazy_async() {
+  return 42;
+}
+
+function lazy_strict() {
+  "use strict";
+  return this;
+}
+
+function lazy_never_called() {
+  return 0;
+}
+
+assertEquals(42, lazy_outer());
+assertEquals(6, lazy_with_params(1, 3, 4, 5));
+assertEquals(3, lazy_with_params(1));
+var gen = lazy_generator();
+assertEquals(1, gen.next().value);
+assertEquals(2, gen.next().value);
+assertEquals(undefined, lazy_strict());
+assertPromiseResult(lazy_async(), value => assertEquals(42, value));
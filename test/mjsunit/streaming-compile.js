@@ -0,0 +1,13 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --streaming-compile --cache=code
+
+function outer() {
+  function inner(x) { return x + 1; }
+  return inner;
+}
+
+assertEquals(2, outer()(1));
+assertEquals(42, eval("(() => 42)()"));
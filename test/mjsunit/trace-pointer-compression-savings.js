@@ -0,0 +1,9 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --trace-pointer-compression-savings --expose-gc
+
+var objects = [];
+for (var i = 0; i < 1000; i++) objects.push({a: i, b: [i], c: 'x' + i});
+gc();
@@ -320,3 +320,57 @@ function getMemoryFill(mem) {
   assertTraps(
       kTrapMemOutOfBounds, () => memoryFill(kPageSize + 1, v, kPageSize));
 })();
+
+function getMemoryCopyWithConstantSize(mem, size) {
+  const builder = new WasmModuleBuilder();
+  builder.addImportedMemory("", "mem", 0);
+  builder.addFunction("copy", kSig_v_ii).addBody([
+    kExprGetLocal, 0,  // Dest.
+    kExprGetLocal, 1,  // Source.
+    ...wasmI32Const(size),
+    kNumericPrefix, kExprMemoryCopy, 0,
+  ]).exportAs("copy");
+  return builder.instantiate({'': {mem}}).exports.copy;
+}
+
+function getMemoryFillWithConstantSize(mem, size) {
+  const builder = new WasmModuleBuilder();
+  builder.addImportedMemory("", "mem", 0);
+  builder.addFunction("fill", kSig_v_ii).addBody([
+    kExprGetLocal, 0,  // Dest.
+    kExprGetLocal, 1,  // Byte value.
+    ...wasmI32Const(size),
+    kNumericPrefix, kExprMemoryFill, 0,
+  ]).exportAs("fill");
+  return builder.instantiate({'': {mem}}).exports.fill;
+}
+
+// Small constant sizes are compiled to inline loads and stores.
+(function TestMemoryCopyAndFillWithConstantSize() {
+  for (let size of [0, 1, 2, 3, 7, 8, 9, 15, 16, 31, 33, 63, 64, 65, 100]) {
+    const mem = new WebAssembly.Memory({initial: 1});
+    const memoryCopy = getMemoryCopyWithConstantSize(mem, size);
+    const memoryFill = getMemoryFillWithConstantSize(mem, size);
+    const u8a = new Uint8Array(mem.buffer);
+
+    const expected = new Array(3 * size + 8).fill(0);
+    memoryFill(1, 0x1234);
+    expected.fill(0x34, 1, 1 + size);
+    assertBufferContents(u8a, expected);
+
+    for (let i = 0; i < size; ++i) u8a[i] = expected[i] = i + 1;
+    // Overlapping copy forward and backward.
+    memoryCopy(3, 0);
+    expected.copyWithin(3, 0, size);
+    assertBufferContents(u8a, expected);
+    memoryCopy(1, 3);
+    expected.copyWithin(1, 3, 3 + size);
+    assertBufferContents(u8a, expected);
+
+    if (size == 0) continue;
+    const oob = kPageSize - size + 1;
+    assertTraps(kTrapMemOutOfBounds, () => memoryCopy(0, oob));
+    assertTraps(kTrapMemOutOfBounds, () => memoryCopy(oob, 0));
+    assertTraps(kTrapMemOutOfBounds, () => memoryFill(oob, 0));
+  }
+})();
@@ -98,3 +98,17 @@ load('test/mjsunit/wasm/wasm-module-builder.js');
   instance2.exports.exp_store(7);
   assertEquals(7, mem1[0]);
 })();
+
+(function testValidationReportsFirstInvalidFunction() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  for (let i = 0; i < 100; ++i) {
+    const invalid = i == 50 || i == 80;
+    // An i32.add without operands doesn't validate.
+    builder.addFunction('f' + i, kSig_i_v)
+        .addBody(invalid ? [kExprI32Add] : [kExprI32Const, i]);
+  }
+  assertThrows(
+      () => builder.toModule(), WebAssembly.CompileError,
+      /Compiling function #50:f50 failed/);
+})();
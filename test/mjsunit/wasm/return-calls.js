@@ -0,0 +1,129 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-wasm --experimental-wasm-return-call --stack-size=64
+
+load("test/mjsunit/wasm/wasm-constants.js");
+load("test/mjsunit/wasm/wasm-module-builder.js");
+
+(function TestFactorialReturnCall() {
+  print(arguments.callee.name);
+
+  let builder = new WasmModuleBuilder();
+
+  // fact_aux(n, acc) = n == 1 ? acc : fact_aux(n - 1, n * acc)
+  let fact_aux = builder.addFunction("fact_aux", kSig_i_ii);
+  fact_aux.addBody([
+    kExprGetLocal, 0, kExprI32Const, 1, kExprI32LeS,
+    kExprIf, kWasmI32,
+      kExprGetLocal, 1,
+    kExprElse,
+      kExprGetLocal, 0, kExprI32Const, 1, kExprI32Sub,
+      kExprGetLocal, 0, kExprGetLocal, 1, kExprI32Mul,
+      kExprReturnCall, fact_aux.index,
+    kExprEnd
+  ]);
+
+  builder.addFunction("main", kSig_i_i)
+    .addBody([
+      kExprGetLocal, 0, kExprI32Const, 1,
+      kExprReturnCall, fact_aux.index
+    ])
+    .exportFunc();
+
+  let main = builder.instantiate().exports.main;
+  assertEquals(1, main(1));
+  assertEquals(120, main(5));
+  assertEquals(3628800, main(10));
+})();
+
+(function TestDeepMutualReturnCalls() {
+  print(arguments.callee.name);
+
+  let builder = new WasmModuleBuilder();
+  let sig_i_i = builder.addType(kSig_i_i);
+
+  // The recursion below overflows the stack unless every call reuses the
+  // frame of its caller.
+  let is_even = builder.addFunction("is_even", sig_i_i);
+  let is_odd = builder.addFunction("is_odd", sig_i_i);
+  is_even.addBody([
+    kExprGetLocal, 0, kExprI32Eqz,
+    kExprIf, kWasmI32,
+      kExprI32Const, 1,
+    kExprElse,
+      kExprGetLocal, 0, kExprI32Const, 1, kExprI32Sub,
+      kExprReturnCall, is_odd.index,
+    kExprEnd
+  ]).exportFunc();
+  is_odd.addBody([
+    kExprGetLocal, 0, kExprI32Eqz,
+    kExprIf, kWasmI32,
+      kExprI32Const, 0,
+    kExprElse,
+      kExprGetLocal, 0, kExprI32Const, 1, kExprI32Sub,
+      kExprReturnCall, is_even.index,
+    kExprEnd
+  ]).exportFunc();
+
+  let exports = builder.instantiate().exports;
+  assertEquals(1, exports.is_even(1000000));
+  assertEquals(0, exports.is_odd(1000000));
+  assertEquals(0, exports.is_even(999999));
+})();
+
+(function TestReturnCallIndirect() {
+  print(arguments.callee.name);
+
+  let builder = new WasmModuleBuilder();
+  let sig_i_ii = builder.addType(kSig_i_ii);
+
+  let add = builder.addFunction("add", sig_i_ii)
+    .addBody([kExprGetLocal, 0, kExprGetLocal, 1, kExprI32Add]);
+  let sub = builder.addFunction("sub", sig_i_ii)
+    .addBody([kExprGetLocal, 0, kExprGetLocal, 1, kExprI32Sub]);
+  builder.appendToTable([add.index, sub.index]);
+
+  builder.addFunction("main", kSig_i_i)
+    .addBody([
+      kExprI32Const, 40, kExprI32Const, 2,
+      kExprGetLocal, 0,
+      kExprReturnCallIndirect, sig_i_ii, kTableZero
+    ])
+    .exportFunc();
+
+  let main = builder.instantiate().exports.main;
+  assertEquals(42, main(0));
+  assertEquals(38, main(1));
+  assertTraps(kTrapFuncInvalid, () => main(2));
+})();
+
+(function TestReturnCallImport() {
+  print(arguments.callee.name);
+
+  let builder = new WasmModuleBuilder();
+  let imp = builder.addImport("m", "f", kSig_i_i);
+
+  builder.addFunction("main", kSig_i_i)
+    .addBody([
+      kExprGetLocal, 0, kExprI32Const, 1, kExprI32Add,
+      kExprReturnCall, imp
+    ])
+    .exportFunc();
+
+  let main = builder.instantiate({m: {f: x => x * 2}}).exports.main;
+  assertEquals(10, main(4));
+})();
+
+(function TestReturnCallTypeMismatch() {
+  print(arguments.callee.name);
+
+  let builder = new WasmModuleBuilder();
+  let callee = builder.addFunction("callee", kSig_l_v)
+    .addBody([kExprI64Const, 0]);
+  builder.addFunction("main", kSig_i_v)
+    .addBody([kExprReturnCall, callee.index]);
+
+  assertThrows(() => builder.instantiate(), WebAssembly.CompileError);
+})();
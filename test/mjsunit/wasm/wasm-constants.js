@@ -191,6 +191,8 @@ let kExprBrTable = 0x0e;
 let kExprReturn = 0x0f;
 let kExprCallFunction = 0x10;
 let kExprCallIndirect = 0x11;
+let kExprReturnCall = 0x12;
+let kExprReturnCallIndirect = 0x13;
 let kExprDrop = 0x1a;
 let kExprSelect = 0x1b;
 let kExprGetLocal = 0x20;
@@ -194,7 +194,7 @@ function assertBinop(name, math_func, wasm_func) {
   let f64_intrinsics = [
     'acos',  'asin', 'atan', 'cos',   'sin',   'tan',  'exp', 'log',
     'atan2', 'pow',  'ceil', 'floor', 'sqrt',  'min',  'max', 'abs',
-    'min',   'max',  'abs',  'ceil',  'floor', 'sqrt',
+    'min',   'max',  'abs',  'ceil',  'floor', 'sqrt', 'trunc',
   ];
 
   for (name of f64_intrinsics) {
@@ -219,7 +219,8 @@ function assertBinop(name, math_func, wasm_func) {
 })();
 
 (function TestF32() {
-  let f32_intrinsics = ['min', 'max', 'abs', 'ceil', 'floor', 'sqrt'];
+  let f32_intrinsics =
+      ['min', 'max', 'abs', 'ceil', 'floor', 'sqrt', 'trunc'];
 
   for (name of f32_intrinsics) {
     let r = Math.fround, f = Math[name];
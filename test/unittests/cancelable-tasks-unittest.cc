@@ -260,5 +260,25 @@ TEST_F(CancelableTaskManagerTest, ThreadedMultipleTasksStartedTryAbortAll) {
   EXPECT_EQ(0u, result2);
 }
 
+TEST_F(CancelableTaskManagerTest, ThreadedManyTasksAcrossShards) {
+  // Enough tasks to land in every shard of the manager several times.
+  constexpr int kNumTasks = 64;
+  ResultType results[kNumTasks];
+  std::vector<std::unique_ptr<ThreadedRunner>> runners;
+  for (int i = 0; i < kNumTasks; ++i) {
+    results[i].store(0);
+    runners.push_back(
+        base::make_unique<ThreadedRunner>(NewTask(&results[i])));
+  }
+  for (auto& runner : runners) runner->Start();
+  for (auto& runner : runners) runner->Join();
+  for (int i = 0; i < kNumTasks; ++i) {
+    EXPECT_EQ(runners[i]->task_id(), results[i].load());
+  }
+  // All tasks finished and removed themselves.
+  EXPECT_EQ(TryAbortResult::kTaskRemoved, TryAbortAll());
+  CancelAndWait();
+}
+
 }  // namespace internal
 }  // namespace v8
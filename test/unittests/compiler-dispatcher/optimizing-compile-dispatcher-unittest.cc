@@ -62,6 +62,44 @@ class BlockingCompilationJob : public OptimizedCompilationJob {
   DISALLOW_COPY_AND_ASSIGN(BlockingCompilationJob);
 };
 
+class RecordingCompilationJob : public OptimizedCompilationJob {
+ public:
+  RecordingCompilationJob(Isolate* isolate, Handle<JSFunction> function,
+                          int id, std::vector<int>* order,
+                          base::Mutex* order_mutex)
+      : OptimizedCompilationJob(isolate->stack_guard()->real_climit(), &info_,
+                                "RecordingCompilationJob",
+                                State::kReadyToExecute),
+        shared_(function->shared(), isolate),
+        zone_(isolate->allocator(), ZONE_NAME),
+        info_(&zone_, isolate, shared_, function),
+        id_(id),
+        order_(order),
+        order_mutex_(order_mutex) {}
+  ~RecordingCompilationJob() override = default;
+
+  // OptimiziedCompilationJob implementation.
+  Status PrepareJobImpl(Isolate* isolate) override { UNREACHABLE(); }
+
+  Status ExecuteJobImpl() override {
+    base::MutexGuard guard(order_mutex_);
+    order_->push_back(id_);
+    return SUCCEEDED;
+  }
+
+  Status FinalizeJobImpl(Isolate* isolate) override { return SUCCEEDED; }
+
+ private:
+  Handle<SharedFunctionInfo> shared_;
+  Zone zone_;
+  OptimizedCompilationInfo info_;
+  int id_;
+  std::vector<int>* order_;
+  base::Mutex* order_mutex_;
+
+  DISALLOW_COPY_AND_ASSIGN(RecordingCompilationJob);
+};
+
 }  // namespace
 
 TEST_F(OptimizingCompileDispatcherTest, Construct) {
@@ -95,5 +133,38 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   dispatcher.Stop();
 }
 
+TEST_F(OptimizingCompileDispatcherTest, CompilesHottestFirst) {
+  Handle<JSFunction> fun =
+      RunJS<JSFunction>("function f() { function g() {}; return g;}; f();");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(
+      Compiler::Compile(fun, Compiler::CLEAR_EXCEPTION, &is_compiled_scope));
+
+  SaveFlags save_flags;
+  FLAG_block_concurrent_recompilation = true;
+  FLAG_concurrent_recompilation_max_tasks = 1;
+  std::vector<int> order;
+  base::Mutex order_mutex;
+
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  const int kHotness[] = {1, 5, 3};
+  for (int i = 0; i < 3; i++) {
+    ASSERT_TRUE(dispatcher.IsQueueAvailable());
+    dispatcher.QueueForOptimization(
+        new RecordingCompilationJob(i_isolate(), fun, i, &order, &order_mutex),
+        kHotness[i]);
+  }
+  dispatcher.Unblock();
+
+  // Busy-wait for the jobs to run on a background thread.
+  for (;;) {
+    base::MutexGuard guard(&order_mutex);
+    if (order.size() == 3) break;
+  }
+  dispatcher.Stop();
+
+  EXPECT_EQ(std::vector<int>({1, 2, 0}), order);
+}
+
 }  // namespace internal
 }  // namespace v8
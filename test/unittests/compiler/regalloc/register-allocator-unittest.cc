@@ -593,6 +593,58 @@ TEST_F(RegisterAllocatorTest, DiamondWithCallSecondBlock) {
   Allocate();
 }
 
+TEST_F(RegisterAllocatorTest, FastModeLoopWithCallAndManyPhis) {
+  int saved_size = FLAG_turbo_fast_register_allocation_size;
+  FLAG_turbo_fast_register_allocation_size = 1;
+
+  const size_t kNumRegs = 3;
+  const size_t kParams = kNumRegs + 2;
+  SetNumRegs(kNumRegs, kNumRegs);
+
+  StartBlock();
+  auto constant = DefineConstant();
+  VReg parameters[kParams];
+  for (size_t i = 0; i < arraysize(parameters); ++i) {
+    parameters[i] = DefineConstant();
+  }
+  EndBlock();
+
+  PhiInstruction* phis[kParams];
+  {
+    StartLoop(3);
+
+    // Loop header.
+    StartBlock();
+    for (size_t i = 0; i < arraysize(parameters); ++i) {
+      phis[i] = Phi(parameters[i], 2);
+    }
+    for (size_t i = 0; i < arraysize(parameters); ++i) {
+      auto result = EmitOI(Same(), Reg(phis[i]), Use(constant));
+      SetInput(phis[i], 1, result);
+    }
+    EndBlock(Branch(Reg(DefineConstant()), 1, 3));
+
+    // A call clobbers all registers on one path through the loop.
+    StartBlock();
+    EmitCall(Slot(-1));
+    EndBlock(Jump(1));
+
+    // Jump back to loop header.
+    StartBlock();
+    EndBlock(Jump(-2));
+
+    EndLoop();
+  }
+
+  StartBlock();
+  Return(Reg(phis[0]));
+  EndBlock();
+
+  Allocate();
+
+  FLAG_turbo_fast_register_allocation_size = saved_size;
+}
+
 TEST_F(RegisterAllocatorTest, SingleDeferredBlockSpill) {
   StartBlock();  // B0
   auto var = EmitOI(Reg(0));
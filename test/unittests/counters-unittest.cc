@@ -457,6 +457,33 @@ TEST_F(RuntimeCallStatsTest, RenameTimer) {
   EXPECT_EQ(50, counter2()->time().InMicroseconds());
 }
 
+TEST_F(RuntimeCallStatsTest, CounterSampling) {
+  base::AsAtomic32::Relaxed_Store(
+      &FLAG_runtime_stats,
+      v8::tracing::TracingCategoryObserver::ENABLED_BY_COUNTER_SAMPLING);
+  EXPECT_EQ(nullptr, stats()->current_counter());
+  {
+    RuntimeCallTimerScope scope(stats(), counter_id());
+    EXPECT_EQ(counter(), stats()->current_counter());
+    {
+      RuntimeCallTimerScope scope(stats(), counter_id2());
+      Sleep(50);
+      EXPECT_EQ(counter2(), stats()->current_counter());
+      CHANGE_CURRENT_RUNTIME_COUNTER(stats(),
+                                     RuntimeCallCounterId::kTestCounter3);
+      EXPECT_EQ(counter3(), stats()->current_counter());
+    }
+    EXPECT_EQ(counter(), stats()->current_counter());
+    EXPECT_EQ(nullptr, stats()->current_timer());
+  }
+  EXPECT_EQ(nullptr, stats()->current_counter());
+  // Nothing is timed or counted in this mode.
+  EXPECT_EQ(0, counter()->count());
+  EXPECT_EQ(0, counter2()->count());
+  EXPECT_EQ(0, counter3()->count());
+  EXPECT_EQ(0, counter2()->time().InMicroseconds());
+}
+
 TEST_F(RuntimeCallStatsTest, BasicPrintAndSnapshot) {
   std::ostringstream out;
   stats()->Print(out);
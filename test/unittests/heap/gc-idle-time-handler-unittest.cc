@@ -24,6 +24,9 @@ class GCIdleTimeHandlerTest : public ::testing::Test {
     result.contexts_disposed = 0;
     result.contexts_disposal_rate = GCIdleTimeHandler::kHighContextDisposalRate;
     result.incremental_marking_stopped = false;
+    result.incremental_marking_limit_reached = false;
+    result.sweeping_in_progress = false;
+    result.sweeper_tasks_running = false;
     result.size_of_objects = kSizeOfObjects;
     return result;
   }
@@ -240,5 +243,35 @@ TEST_F(GCIdleTimeHandlerTest, DoneIfNotMakingProgressOnIncrementalMarking) {
   EXPECT_EQ(DONE, action.type);
 }
 
+TEST_F(GCIdleTimeHandlerTest, StartIncrementalMarkingAtLimit) {
+  if (!handler()->Enabled()) return;
+  GCIdleTimeHeapState heap_state = DefaultHeapState();
+  heap_state.incremental_marking_stopped = true;
+  heap_state.incremental_marking_limit_reached = true;
+  double idle_time_ms = 10.0;
+  GCIdleTimeAction action = handler()->Compute(idle_time_ms, heap_state);
+  EXPECT_EQ(DO_START_INCREMENTAL_MARKING, action.type);
+  // Without idle time, marking is left to the allocation path.
+  action = handler()->Compute(0, heap_state);
+  EXPECT_EQ(DO_NOTHING, action.type);
+}
+
+TEST_F(GCIdleTimeHandlerTest, FinalizeSweeping) {
+  GCIdleTimeHeapState heap_state = DefaultHeapState();
+  heap_state.sweeping_in_progress = true;
+  double idle_time_ms = 10.0;
+  GCIdleTimeAction action = handler()->Compute(idle_time_ms, heap_state);
+  EXPECT_EQ(DO_FINALIZE_SWEEPING, action.type);
+}
+
+TEST_F(GCIdleTimeHandlerTest, DontWaitForSweeperTasks) {
+  GCIdleTimeHeapState heap_state = DefaultHeapState();
+  heap_state.sweeping_in_progress = true;
+  heap_state.sweeper_tasks_running = true;
+  double idle_time_ms = 10.0;
+  GCIdleTimeAction action = handler()->Compute(idle_time_ms, heap_state);
+  EXPECT_NE(DO_FINALIZE_SWEEPING, action.type);
+}
+
 }  // namespace internal
 }  // namespace v8
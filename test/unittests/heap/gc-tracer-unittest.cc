@@ -546,5 +546,51 @@ TEST_F(GCTracerTest, RecordGCSumHistograms) {
   GcHistogram::CleanUp();
 }
 
+namespace {
+
+void RecordGCStatistics(v8::Isolate* isolate,
+                        const v8::GCStatistics& statistics, void* data) {
+  *reinterpret_cast<std::vector<v8::GCStatistics>*>(data) = {statistics};
+}
+
+}  // namespace
+
+TEST_F(GCTracerTest, StatisticsCallback) {
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+  std::vector<v8::GCStatistics> reported;
+  isolate()->SetGCStatisticsCallback(&RecordGCStatistics, &reported);
+  tracer->Start(MARK_COMPACTOR, GarbageCollectionReason::kTesting,
+                "collector unittest");
+  tracer->AddScopeSample(GCTracer::Scope::MC_MARK, 10);
+  tracer->AddScopeSample(GCTracer::Scope::MC_SWEEP, 20);
+  tracer->AddBackgroundScopeSample(
+      GCTracer::BackgroundScope::MC_BACKGROUND_MARKING, 30, nullptr);
+  tracer->Stop(MARK_COMPACTOR);
+  ASSERT_EQ(1u, reported.size());
+  EXPECT_EQ(kGCTypeMarkSweepCompact, reported[0].type);
+  EXPECT_FALSE(reported[0].incremental);
+  EXPECT_DOUBLE_EQ(10, reported[0].mark_duration);
+  EXPECT_DOUBLE_EQ(20, reported[0].sweep_duration);
+  EXPECT_DOUBLE_EQ(30, reported[0].background_marking_duration);
+  EXPECT_DOUBLE_EQ(0, reported[0].scavenge_duration);
+
+  tracer->Start(SCAVENGER, GarbageCollectionReason::kTesting,
+                "collector unittest");
+  tracer->AddScopeSample(GCTracer::Scope::SCAVENGER_SCAVENGE_PARALLEL, 5);
+  tracer->Stop(SCAVENGER);
+  ASSERT_EQ(1u, reported.size());
+  EXPECT_EQ(kGCTypeScavenge, reported[0].type);
+  EXPECT_DOUBLE_EQ(5, reported[0].scavenge_parallel_duration);
+  EXPECT_DOUBLE_EQ(0, reported[0].mark_duration);
+
+  isolate()->SetGCStatisticsCallback(nullptr);
+  reported.clear();
+  tracer->Start(SCAVENGER, GarbageCollectionReason::kTesting,
+                "collector unittest");
+  tracer->Stop(SCAVENGER);
+  EXPECT_TRUE(reported.empty());
+}
+
 }  // namespace internal
 }  // namespace v8
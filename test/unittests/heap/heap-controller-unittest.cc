@@ -103,6 +103,30 @@ TEST_F(HeapControllerTest, OldGenerationAllocationLimit) {
           mutator_speed, new_space_capacity, Heap::HeapGrowingMode::kMinimal));
 }
 
+TEST_F(HeapControllerTest, MaxGrowingStep) {
+  HeapController heap_controller(i_isolate()->heap());
+  size_t old_gen_size = 128 * MB;
+  size_t max_old_generation_size = 512 * MB;
+  size_t new_space_capacity = 16 * MB;
+  double max_factor = heap_controller.MaxGrowingFactor(max_old_generation_size);
+
+  heap_controller.max_growing_step_ = 10 * MB;
+  EXPECT_EQ(old_gen_size + 10 * MB + new_space_capacity,
+            heap_controller.CalculateAllocationLimit(
+                old_gen_size, max_old_generation_size, max_factor, 1, 1,
+                new_space_capacity, Heap::HeapGrowingMode::kDefault));
+
+  // The minimum growing step takes precedence.
+  heap_controller.max_growing_step_ = 1 * MB;
+  EXPECT_EQ(old_gen_size +
+                heap_controller.MinimumAllocationLimitGrowingStep(
+                    Heap::HeapGrowingMode::kDefault) +
+                new_space_capacity,
+            heap_controller.CalculateAllocationLimit(
+                old_gen_size, max_old_generation_size, max_factor, 1, 1,
+                new_space_capacity, Heap::HeapGrowingMode::kDefault));
+}
+
 TEST_F(HeapControllerTest, MaxOldGenerationSize) {
   HeapController heap_controller(i_isolate()->heap());
   uint64_t configurations[][2] = {
@@ -97,6 +97,37 @@ TEST(SlotSet, Remove) {
   }
 }
 
+TEST(SlotSet, SparseAndDenseBuckets) {
+  SlotSet set;
+  set.SetPageStart(0);
+  // Fill one bucket in descending order so that it starts out sparse and
+  // then overflows into a bitmap, and keep a single slot in another one.
+  const int kSlots = 16;
+  for (int i = kSlots - 1; i >= 0; i--) {
+    set.Insert(i * 3 * kPointerSize);
+    for (int j = 0; j < kSlots; j++) {
+      EXPECT_EQ(j >= i, set.Lookup(j * 3 * kPointerSize));
+    }
+  }
+  const int kLoneSlot = Page::kPageSize / 2;
+  set.Insert(kLoneSlot);
+  for (int i = 0; i < kSlots; i += 2) {
+    set.Remove(i * 3 * kPointerSize);
+  }
+  int count = set.Iterate([](MaybeObjectSlot slot) { return KEEP_SLOT; },
+                          SlotSet::KEEP_EMPTY_BUCKETS);
+  EXPECT_EQ(kSlots / 2 + 1, count);
+  EXPECT_TRUE(set.Lookup(kLoneSlot));
+  set.Remove(kLoneSlot);
+  EXPECT_FALSE(set.Lookup(kLoneSlot));
+  count = set.Iterate([](MaybeObjectSlot slot) { return REMOVE_SLOT; },
+                      SlotSet::FREE_EMPTY_BUCKETS);
+  EXPECT_EQ(0, count);
+  for (int i = 0; i < kSlots; i++) {
+    EXPECT_FALSE(set.Lookup(i * 3 * kPointerSize));
+  }
+}
+
 void CheckRemoveRangeOn(uint32_t start, uint32_t end) {
   SlotSet set;
   set.SetPageStart(0);
@@ -469,6 +469,12 @@ TEST_F(BytecodeArrayBuilderTest, AllBytecodesGenerated) {
   // Type Information for DevTools is turned on.
   scorecard[Bytecodes::ToByte(Bytecode::kCollectTypeProfile)] = 1;
 
+  // The one-byte Star bytecodes are only emitted with --ignition-short-star.
+#define MARK_SHORT_STAR(Name, ...) \
+  scorecard[Bytecodes::ToByte(Bytecode::k##Name)] = 1;
+  SHORT_STAR_BYTECODE_LIST(MARK_SHORT_STAR)
+#undef MARK_SHORT_STAR
+
   // Check return occurs at the end and only once in the BytecodeArray.
   CHECK_EQ(final_bytecode, Bytecode::kReturn);
   CHECK_EQ(scorecard[Bytecodes::ToByte(final_bytecode)], 1);
@@ -365,6 +365,48 @@ TEST_F(BytecodeArrayWriterUnittest, DeadcodeElimination) {
   CHECK(source_iterator.done());
 }
 
+TEST_F(BytecodeArrayWriterUnittest, ShortStar) {
+  bool old_flag = FLAG_ignition_short_star;
+  FLAG_ignition_short_star = true;
+  ConstantArrayBuilder constant_array_builder(zone());
+  BytecodeArrayWriter writer(zone(), &constant_array_builder,
+                             SourcePositionTableBuilder::OMIT_SOURCE_POSITIONS);
+  FLAG_ignition_short_star = old_flag;
+
+  static const uint8_t expected_bytes[] = {
+      // clang-format off
+      /*  0 */ B(LdaSmi), U8(1),
+      /*  2 */ B(Star0),
+      /*  3 */ B(Star15),
+      /*  4 */ B(Star), R8(16),
+      /*  6 */ B(Star), R8(-1),
+      /*  8 */ B(Return),
+      // clang-format on
+  };
+
+  BytecodeNode lda_smi(Bytecode::kLdaSmi, 1);
+  writer.Write(&lda_smi);
+  BytecodeNode star0(Bytecode::kStar, R(0));
+  writer.Write(&star0);
+  BytecodeNode star15(Bytecode::kStar, R(15));
+  writer.Write(&star15);
+  BytecodeNode star16(Bytecode::kStar, R(16));
+  writer.Write(&star16);
+  BytecodeNode star_param(Bytecode::kStar, R(-1));
+  writer.Write(&star_param);
+  BytecodeNode ret(Bytecode::kReturn);
+  writer.Write(&ret);
+
+  Handle<BytecodeArray> bytecode_array =
+      writer.ToBytecodeArray(isolate(), 0, 0, factory()->empty_byte_array());
+  CHECK_EQ(static_cast<size_t>(bytecode_array->length()),
+           arraysize(expected_bytes));
+  for (size_t i = 0; i < arraysize(expected_bytes); ++i) {
+    CHECK_EQ(static_cast<int>(bytecode_array->get(static_cast<int>(i))),
+             static_cast<int>(expected_bytes[i]));
+  }
+}
+
 #undef B
 #undef R
 
@@ -322,6 +322,29 @@ TEST(Bytecodes, IsJumpIfToBoolean) {
 #undef OR_IS_BYTECODE
 #undef IN_BYTECODE_LIST
 
+TEST(Bytecodes, DispatchLookahead) {
+#define TEST_BYTECODE(Name, ...)                                               \
+  {                                                                            \
+    Bytecode bytecode = Bytecode::k##Name;                                     \
+    bool star_lookahead =                                                      \
+        Bytecodes::IsStarLookahead(bytecode, OperandScale::kSingle);           \
+    bool jump_lookahead =                                                      \
+        Bytecodes::IsJumpIfBooleanLookahead(bytecode, OperandScale::kSingle);  \
+    if (star_lookahead || jump_lookahead) {                                    \
+      EXPECT_TRUE(Bytecodes::WritesAccumulator(bytecode));                     \
+      EXPECT_FALSE(Bytecodes::IsJump(bytecode));                               \
+    }                                                                          \
+    EXPECT_FALSE(star_lookahead && jump_lookahead);                            \
+    EXPECT_FALSE(                                                              \
+        Bytecodes::IsStarLookahead(bytecode, OperandScale::kDouble));          \
+    EXPECT_FALSE(                                                              \
+        Bytecodes::IsJumpIfBooleanLookahead(bytecode, OperandScale::kDouble)); \
+  }
+
+  BYTECODE_LIST(TEST_BYTECODE)
+#undef TEST_BYTECODE
+}
+
 TEST(OperandScale, PrefixesRequired) {
   CHECK(!Bytecodes::OperandScaleRequiresPrefixBytecode(OperandScale::kSingle));
   CHECK(Bytecodes::OperandScaleRequiresPrefixBytecode(OperandScale::kDouble));
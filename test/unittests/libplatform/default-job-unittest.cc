@@ -0,0 +1,124 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/libplatform/default-job.h"
+
+#include <atomic>
+
+#include "include/libplatform/libplatform.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/platform.h"
+#include "src/base/template-utils.h"
+#include "src/libplatform/default-platform.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace platform {
+namespace default_job_unittest {
+
+namespace {
+
+// Runs |num_items| work items, taking one item per Run() call.
+class CountingJobTask : public JobTask {
+ public:
+  explicit CountingJobTask(size_t num_items) : remaining_items_(num_items) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      size_t remaining = remaining_items_.load();
+      if (remaining == 0) return;
+      if (remaining_items_.compare_exchange_weak(remaining, remaining - 1)) {
+        processed_items_++;
+      }
+    }
+  }
+
+  size_t GetMaxConcurrency() const override { return remaining_items_; }
+
+  size_t processed_items() const { return processed_items_; }
+
+ private:
+  std::atomic<size_t> remaining_items_;
+  std::atomic<size_t> processed_items_{0};
+};
+
+// Blocks all workers until the test releases them.
+class BlockingJobTask : public JobTask {
+ public:
+  explicit BlockingJobTask(size_t max_concurrency)
+      : max_concurrency_(max_concurrency) {}
+
+  void Run(JobDelegate* delegate) override {
+    base::MutexGuard guard(&mutex_);
+    workers_++;
+    started_.NotifyAll();
+    while (!delegate->ShouldYield()) {
+      started_.WaitFor(&mutex_, base::TimeDelta::FromMilliseconds(1));
+    }
+  }
+
+  size_t GetMaxConcurrency() const override { return max_concurrency_; }
+
+  void WaitForWorkers(size_t num_workers) {
+    base::MutexGuard guard(&mutex_);
+    while (workers_ < num_workers) started_.Wait(&mutex_);
+  }
+
+ private:
+  const size_t max_concurrency_;
+  base::Mutex mutex_;
+  base::ConditionVariable started_;
+  size_t workers_ = 0;
+};
+
+}  // namespace
+
+TEST(DefaultJobTest, JoinRunsAllItems) {
+  DefaultPlatform platform;
+  platform.SetThreadPoolSize(4);
+  auto job_task = base::make_unique<CountingJobTask>(1000);
+  CountingJobTask* job_task_ptr = job_task.get();
+  std::unique_ptr<JobHandle> handle =
+      platform.PostJob(TaskPriority::kUserVisible, std::move(job_task));
+  EXPECT_TRUE(handle->IsRunning());
+  handle->Join();
+  EXPECT_FALSE(handle->IsRunning());
+  EXPECT_EQ(1000u, job_task_ptr->processed_items());
+}
+
+TEST(DefaultJobTest, JoinWithoutWork) {
+  DefaultPlatform platform;
+  platform.SetThreadPoolSize(2);
+  std::unique_ptr<JobHandle> handle = platform.PostJob(
+      TaskPriority::kBestEffort, base::make_unique<CountingJobTask>(0));
+  handle->Join();
+  EXPECT_FALSE(handle->IsRunning());
+}
+
+TEST(DefaultJobTest, CancelStopsWorkers) {
+  DefaultPlatform platform;
+  platform.SetThreadPoolSize(2);
+  auto job_task = base::make_unique<BlockingJobTask>(2);
+  BlockingJobTask* job_task_ptr = job_task.get();
+  std::unique_ptr<JobHandle> handle =
+      platform.PostJob(TaskPriority::kUserBlocking, std::move(job_task));
+  job_task_ptr->WaitForWorkers(2);
+  handle->Cancel();
+  EXPECT_FALSE(handle->IsRunning());
+}
+
+TEST(DefaultJobTest, NewDefaultJobHandle) {
+  DefaultPlatform platform;
+  platform.SetThreadPoolSize(2);
+  auto job_task = base::make_unique<CountingJobTask>(100);
+  CountingJobTask* job_task_ptr = job_task.get();
+  std::unique_ptr<JobHandle> handle = NewDefaultJobHandle(
+      &platform, TaskPriority::kUserVisible, std::move(job_task), 2);
+  handle->Join();
+  EXPECT_EQ(100u, job_task_ptr->processed_items());
+}
+
+}  // namespace default_job_unittest
+}  // namespace platform
+}  // namespace v8
@@ -0,0 +1,133 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <atomic>
+
+#include "include/v8-platform.h"
+#include "src/base/platform/platform.h"
+#include "src/libplatform/work-stealing-task-queue.h"
+#include "testing/gmock/include/gmock/gmock.h"
+
+using testing::IsNull;
+
+namespace v8 {
+namespace platform {
+namespace work_stealing_task_queue_unittest {
+
+namespace {
+
+struct MockTask : public Task {
+  MOCK_METHOD0(Run, void());
+};
+
+class CountingTask : public Task {
+ public:
+  explicit CountingTask(std::atomic<int>* counter) : counter_(counter) {}
+
+  void Run() override { (*counter_)++; }
+
+ private:
+  std::atomic<int>* counter_;
+};
+
+class QueueThread final : public base::Thread {
+ public:
+  QueueThread(WorkStealingTaskQueue* queue, int worker_id)
+      : Thread(Options("libplatform WorkStealingTaskQueueThread")),
+        queue_(queue),
+        worker_id_(worker_id) {}
+
+  void Run() override {
+    while (std::unique_ptr<Task> task = queue_->GetNext(worker_id_)) {
+      task->Run();
+    }
+  }
+
+ private:
+  WorkStealingTaskQueue* queue_;
+  int worker_id_;
+};
+
+}  // namespace
+
+TEST(WorkStealingTaskQueueTest, Basic) {
+  WorkStealingTaskQueue queue(1);
+  std::unique_ptr<Task> task(new MockTask());
+  Task* ptr = task.get();
+  queue.Append(std::move(task));
+  EXPECT_EQ(ptr, queue.GetNext(0).get());
+  queue.Terminate();
+  EXPECT_THAT(queue.GetNext(0), IsNull());
+}
+
+TEST(WorkStealingTaskQueueTest, StealFromOtherWorker) {
+  WorkStealingTaskQueue queue(4);
+  std::unique_ptr<Task> task1(new MockTask());
+  std::unique_ptr<Task> task2(new MockTask());
+  Task* ptr1 = task1.get();
+  Task* ptr2 = task2.get();
+  // Tasks are distributed round-robin, so the second task does not end up in
+  // the deque of worker 0.
+  queue.Append(std::move(task1));
+  queue.Append(std::move(task2));
+  EXPECT_EQ(ptr1, queue.GetNext(0).get());
+  EXPECT_EQ(ptr2, queue.GetNext(0).get());
+  queue.Terminate();
+  EXPECT_THAT(queue.GetNext(0), IsNull());
+}
+
+TEST(WorkStealingTaskQueueTest, HigherPriorityFirst) {
+  WorkStealingTaskQueue queue(2);
+  std::unique_ptr<Task> best_effort(new MockTask());
+  std::unique_ptr<Task> user_visible(new MockTask());
+  std::unique_ptr<Task> user_blocking(new MockTask());
+  Task* best_effort_ptr = best_effort.get();
+  Task* user_visible_ptr = user_visible.get();
+  Task* user_blocking_ptr = user_blocking.get();
+  queue.Append(std::move(best_effort), TaskPriority::kBestEffort);
+  queue.Append(std::move(user_visible), TaskPriority::kUserVisible);
+  queue.Append(std::move(user_blocking), TaskPriority::kUserBlocking);
+  EXPECT_EQ(user_blocking_ptr, queue.GetNext(0).get());
+  EXPECT_EQ(user_visible_ptr, queue.GetNext(0).get());
+  EXPECT_EQ(best_effort_ptr, queue.GetNext(0).get());
+  queue.Terminate();
+  EXPECT_THAT(queue.GetNext(0), IsNull());
+}
+
+TEST(WorkStealingTaskQueueTest, TerminateDrainsTasks) {
+  WorkStealingTaskQueue queue(2);
+  queue.Append(std::unique_ptr<Task>(new MockTask()));
+  queue.Terminate();
+  EXPECT_NE(nullptr, queue.GetNext(1).get());
+  EXPECT_THAT(queue.GetNext(1), IsNull());
+}
+
+TEST(WorkStealingTaskQueueTest, AppendAfterTerminate) {
+  WorkStealingTaskQueue queue(2);
+  queue.Terminate();
+  queue.Append(std::unique_ptr<Task>(new MockTask()));
+  EXPECT_THAT(queue.GetNext(0), IsNull());
+}
+
+TEST(WorkStealingTaskQueueTest, MultipleWorkers) {
+  static const int kNumWorkers = 4;
+  static const int kNumTasks = 1000;
+  std::atomic<int> counter{0};
+  WorkStealingTaskQueue queue(kNumWorkers);
+  std::vector<std::unique_ptr<QueueThread>> threads;
+  for (int i = 0; i < kNumWorkers; i++) {
+    threads.emplace_back(new QueueThread(&queue, i));
+    threads.back()->Start();
+  }
+  for (int i = 0; i < kNumTasks; i++) {
+    queue.Append(std::unique_ptr<Task>(new CountingTask(&counter)));
+  }
+  queue.Terminate();
+  for (auto& thread : threads) thread->Join();
+  EXPECT_EQ(kNumTasks, counter.load());
+}
+
+}  // namespace work_stealing_task_queue_unittest
+}  // namespace platform
+}  // namespace v8
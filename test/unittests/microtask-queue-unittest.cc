@@ -9,6 +9,7 @@
 #include <memory>
 #include <vector>
 
+#include "src/base/platform/platform.h"
 #include "src/heap/factory.h"
 #include "src/visitors.h"
 #include "test/unittests/test-utils.h"
@@ -171,5 +172,122 @@ TEST_F(MicrotaskQueueTest, VisitRoot) {
   EXPECT_EQ(expected, actual);
 }
 
+// A count budget leaves the remaining Microtasks for the next run.
+TEST_F(MicrotaskQueueTest, RunBudgetCount) {
+  std::unique_ptr<MicrotaskQueue> microtask_queue =
+      MicrotaskQueue::New(isolate());
+  microtask_queue->SetRunBudget(4, 0);
+
+  int count = 0;
+  for (int i = 0; i < 10; ++i) {
+    microtask_queue->EnqueueMicrotask(
+        *NewMicrotask([&count, i] { EXPECT_EQ(i, count++); }));
+  }
+  EXPECT_EQ(4, microtask_queue->RunMicrotasks(isolate()));
+  EXPECT_EQ(4, count);
+  EXPECT_EQ(6, microtask_queue->size());
+  EXPECT_EQ(4, microtask_queue->RunMicrotasks(isolate()));
+  EXPECT_EQ(2, microtask_queue->RunMicrotasks(isolate()));
+  EXPECT_EQ(10, count);
+  EXPECT_EQ(0, microtask_queue->size());
+
+  EXPECT_EQ(10u, microtask_queue->GetEnqueuedCount());
+  EXPECT_EQ(10u, microtask_queue->GetRunCount());
+  EXPECT_EQ(2u, microtask_queue->GetBudgetExhaustedCount());
+}
+
+// Microtasks enqueued while running count against the same budget.
+TEST_F(MicrotaskQueueTest, RunBudgetCountNested) {
+  std::unique_ptr<MicrotaskQueue> microtask_queue =
+      MicrotaskQueue::New(isolate());
+  microtask_queue->SetRunBudget(3, 0);
+
+  int count = 0;
+  MicrotaskQueue* queue = microtask_queue.get();
+  std::function<void()> task = [&] {
+    if (++count < 5) queue->EnqueueMicrotask(*NewMicrotask(task));
+  };
+  queue->EnqueueMicrotask(*NewMicrotask(task));
+  EXPECT_EQ(3, queue->RunMicrotasks(isolate()));
+  EXPECT_EQ(3, count);
+  EXPECT_EQ(1, queue->size());
+
+  queue->SetRunBudget(0, 0);
+  EXPECT_EQ(2, queue->RunMicrotasks(isolate()));
+  EXPECT_EQ(5, count);
+  EXPECT_EQ(0, queue->size());
+}
+
+// A time budget is checked every kRunBudgetCheckInterval Microtasks.
+TEST_F(MicrotaskQueueTest, RunBudgetTime) {
+  std::unique_ptr<MicrotaskQueue> microtask_queue =
+      MicrotaskQueue::New(isolate());
+  microtask_queue->SetRunBudget(0, 1);
+
+  int count = 0;
+  for (int i = 0; i < 2 * MicrotaskQueue::kRunBudgetCheckInterval; ++i) {
+    microtask_queue->EnqueueMicrotask(*NewMicrotask([&count] {
+      ++count;
+      base::OS::Sleep(base::TimeDelta::FromMilliseconds(1));
+    }));
+  }
+  EXPECT_EQ(MicrotaskQueue::kRunBudgetCheckInterval,
+            microtask_queue->RunMicrotasks(isolate()));
+  EXPECT_EQ(MicrotaskQueue::kRunBudgetCheckInterval, count);
+  EXPECT_EQ(1u, microtask_queue->GetBudgetExhaustedCount());
+
+  microtask_queue->SetRunBudget(0, 0);
+  EXPECT_EQ(MicrotaskQueue::kRunBudgetCheckInterval,
+            microtask_queue->RunMicrotasks(isolate()));
+  EXPECT_EQ(2 * MicrotaskQueue::kRunBudgetCheckInterval, count);
+}
+
+void IncrementCounter(void* data) { ++*static_cast<int*>(data); }
+
+// A batch of callbacks grows the ring buffer at most once.
+TEST_F(MicrotaskQueueTest, EnqueueBatch) {
+  std::unique_ptr<MicrotaskQueue> microtask_queue =
+      MicrotaskQueue::New(isolate());
+  v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate());
+
+  const size_t kBatchSize = 100;
+  int counters[kBatchSize] = {};
+  void* data[kBatchSize];
+  for (size_t i = 0; i < kBatchSize; ++i) data[i] = &counters[i];
+
+  microtask_queue->EnqueueMicrotasks(v8_isolate, &IncrementCounter, data,
+                                     kBatchSize);
+  EXPECT_EQ(128, microtask_queue->capacity());
+  EXPECT_EQ(static_cast<intptr_t>(kBatchSize), microtask_queue->size());
+
+  EXPECT_EQ(static_cast<int>(kBatchSize),
+            microtask_queue->PerformCheckpoint(v8_isolate));
+  for (size_t i = 0; i < kBatchSize; ++i) EXPECT_EQ(1, counters[i]);
+}
+
+// Promise jobs of a context with its own MicrotaskQueue go to that queue.
+TEST_F(MicrotaskQueueTest, PerContextQueue) {
+  v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate());
+  std::unique_ptr<v8::MicrotaskQueue> microtask_queue =
+      v8::MicrotaskQueue::New(v8_isolate);
+  v8::Local<v8::Context> context = v8::Context::New(
+      v8_isolate, nullptr, v8::MaybeLocal<v8::ObjectTemplate>(),
+      v8::MaybeLocal<v8::Value>(), v8::DeserializeInternalFieldsCallback(),
+      microtask_queue.get());
+  {
+    v8::Context::Scope scope(context);
+    RunJS("var ran = false; Promise.resolve().then(() => ran = true);");
+  }
+  EXPECT_EQ(0, isolate()->default_microtask_queue()->size());
+  EXPECT_EQ(1u, microtask_queue->GetSize());
+
+  EXPECT_EQ(1, microtask_queue->PerformCheckpoint(v8_isolate));
+  EXPECT_EQ(0u, microtask_queue->GetSize());
+  {
+    v8::Context::Scope scope(context);
+    EXPECT_TRUE(RunJS("ran")->IsTrue(isolate()));
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,68 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/parsing/scanner-simd.h"
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+static const uint16_t kStops[] = {'*', '\n'};
+
+std::vector<uint16_t> MakeInput(size_t length) {
+  return std::vector<uint16_t>(length, 'a');
+}
+
+}  // namespace
+
+TEST(ScannerSimdTest, NoMatchReturnsEnd) {
+  for (size_t length = 0; length < 40; length++) {
+    std::vector<uint16_t> input = MakeInput(length);
+    const uint16_t* start = input.data();
+    EXPECT_EQ(start + length,
+              FindNonAsciiOrOneOf(start, start + length, kStops));
+  }
+}
+
+TEST(ScannerSimdTest, FindsStopCharAtEveryPosition) {
+  for (size_t length = 1; length < 40; length++) {
+    for (size_t pos = 0; pos < length; pos++) {
+      for (uint16_t stop : {uint16_t{'*'}, uint16_t{'\n'}}) {
+        std::vector<uint16_t> input = MakeInput(length);
+        input[pos] = stop;
+        const uint16_t* start = input.data();
+        EXPECT_EQ(start + pos,
+                  FindNonAsciiOrOneOf(start, start + length, kStops));
+      }
+    }
+  }
+}
+
+TEST(ScannerSimdTest, FindsNonAscii) {
+  for (uint16_t c : {0x80, 0xFF, 0x100, 0x2028, 0xD800, 0xFFFF}) {
+    std::vector<uint16_t> input = MakeInput(24);
+    input[13] = c;
+    const uint16_t* start = input.data();
+    EXPECT_EQ(start + 13, FindNonAsciiOrOneOf(start, start + 24, kStops));
+  }
+}
+
+TEST(ScannerSimdTest, ReturnsFirstOfSeveralMatches) {
+  std::vector<uint16_t> input = MakeInput(32);
+  input[5] = 0x1234;
+  input[3] = '\n';
+  input[20] = '*';
+  const uint16_t* start = input.data();
+  EXPECT_EQ(start + 3, FindNonAsciiOrOneOf(start, start + 32, kStops));
+  // Searching from the middle of the buffer.
+  EXPECT_EQ(start + 20, FindNonAsciiOrOneOf(start + 6, start + 32, kStops));
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,68 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/pooled-array-buffer-allocator.h"
+
+#include <cstring>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+TEST(PooledArrayBufferAllocator, ReusesFreedBlocks) {
+  PooledArrayBufferAllocator allocator;
+  void* data = allocator.Allocate(1000);
+  ASSERT_NE(nullptr, data);
+  allocator.Free(data, 1000);
+  EXPECT_EQ(1 * KB, allocator.GetPoolSize());
+
+  // Any length of the same size class gets the block back.
+  void* reused = allocator.AllocateUninitialized(1024);
+  EXPECT_EQ(data, reused);
+  EXPECT_EQ(0u, allocator.GetPoolSize());
+  allocator.Free(reused, 1024);
+}
+
+TEST(PooledArrayBufferAllocator, ZeroesReusedBlocks) {
+  PooledArrayBufferAllocator allocator;
+  uint8_t* data = static_cast<uint8_t*>(allocator.AllocateUninitialized(100));
+  memset(data, 0xAB, 100);
+  allocator.Free(data, 100);
+
+  uint8_t* reused = static_cast<uint8_t*>(allocator.Allocate(100));
+  EXPECT_EQ(data, reused);
+  for (int i = 0; i < 100; i++) EXPECT_EQ(0, reused[i]);
+  allocator.Free(reused, 100);
+}
+
+TEST(PooledArrayBufferAllocator, DoesNotPoolLargeBlocks) {
+  PooledArrayBufferAllocator allocator;
+  const size_t kLength = PooledArrayBufferAllocator::kMaxPooledSize + 1;
+  void* data = allocator.Allocate(kLength);
+  ASSERT_NE(nullptr, data);
+  allocator.Free(data, kLength);
+  EXPECT_EQ(0u, allocator.GetPoolSize());
+}
+
+TEST(PooledArrayBufferAllocator, PoolSizeIsLimited) {
+  PooledArrayBufferAllocator allocator;
+  const size_t kBlockSize = PooledArrayBufferAllocator::kMaxPooledSize;
+  const size_t kBlocks =
+      2 * PooledArrayBufferAllocator::kMaxPoolSizePerClass / kBlockSize;
+  std::vector<void*> blocks;
+  for (size_t i = 0; i < kBlocks; i++) {
+    blocks.push_back(allocator.AllocateUninitialized(kBlockSize));
+  }
+  for (void* block : blocks) allocator.Free(block, kBlockSize);
+  EXPECT_EQ(PooledArrayBufferAllocator::kMaxPoolSizePerClass,
+            allocator.GetPoolSize());
+
+  allocator.ReleaseCachedMemory();
+  EXPECT_EQ(0u, allocator.GetPoolSize());
+}
+
+}  // namespace internal
+}  // namespace v8
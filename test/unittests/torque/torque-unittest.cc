@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "src/torque/cfg.h"
 #include "src/torque/utils.h"
 #include "test/unittests/test-utils.h"
 
@@ -16,6 +17,30 @@ TEST(Torque, StackDeleteRange) {
   ASSERT_TRUE(stack == result);
 }
 
+TEST(Torque, OptimizeCfg) {
+  SourceFileMap::Scope source_file_map;
+  CurrentSourcePosition::Scope current_source_position{
+      SourcePosition{SourceFileMap::AddSource("dummy_filename"), 0, 0}};
+  CfgAssembler assembler({});
+  Block* merged = assembler.NewBlock(Stack<const Type*>{});
+  Block* last = assembler.NewBlock(Stack<const Type*>{});
+  Block* dead = assembler.NewBlock(Stack<const Type*>{});
+  assembler.Goto(merged);
+  // An unreachable predecessor must not prevent merging.
+  assembler.Bind(dead);
+  assembler.Goto(merged);
+  assembler.Bind(merged);
+  assembler.Goto(last);
+  assembler.Bind(last);
+  assembler.Unreachable();
+
+  const ControlFlowGraph& cfg = assembler.Result();
+  ASSERT_EQ(1u, cfg.blocks().size());
+  ASSERT_EQ(cfg.start(), cfg.blocks()[0]);
+  ASSERT_EQ(1u, cfg.start()->instructions().size());
+  ASSERT_TRUE(cfg.start()->instructions()[0].Is<AbortInstruction>());
+}
+
 }  // namespace torque
 }  // namespace internal
 }  // namespace v8
@@ -784,6 +784,52 @@ TEST_F(ValueSerializerTest, RoundTripDictionaryObjectForTransitions) {
       ",{\"\xF0\x9F\x91\x8A\":5,\"\xF0\x9F\x91\x9B\":6}]");
 }
 
+TEST_F(ValueSerializerTest, RoundTripObjectsWithSameShape) {
+  Local<Value> value = RoundTripTest(
+      "var a = [];"
+      "for (var i = 0; i < 20; i++) a.push({alpha: i, beta: 'b' + i});"
+      "a;");
+  ExpectScriptTrue("result.length === 20");
+  ExpectScriptTrue("result[7].alpha === 7 && result[7].beta === 'b7'");
+  ExpectScriptTrue(
+      "result.every(o => Object.keys(o).toString() === 'alpha,beta')");
+
+  // The keys are only written for the first object.
+  std::vector<uint8_t> encoded = EncodeTest(EvaluateScriptForInput(
+      "var a = [];"
+      "for (var i = 0; i < 20; i++) a.push({alpha: i, beta: i});"
+      "a;"));
+  EXPECT_LT(encoded.size(), 20u * 10);
+
+  // A property deleted by a getter of an earlier one is written as a hole.
+  value = RoundTripTest(
+      "[{ get a() { delete this.b; return 1; }, b: 2, c: 3 },"
+      " { get a() { return 4; }, b: 5, c: 6 }]");
+  ExpectScriptTrue("!('b' in result[0]) && result[0].c === 3");
+  ExpectScriptTrue("result[1].b === 5 && result[1].c === 6");
+}
+
+TEST_F(ValueSerializerTest, DecodeShapedObject) {
+  Local<Value> value =
+      DecodeTest({0xFF, 0x0E, 0x41, 0x03, 0x6B, 0x00, 0x02, 0x22, 0x01, 0x61,
+                  0x22, 0x01, 0x62, 0x49, 0x02, 0x49, 0x04, 0x6B, 0x00, 0x49,
+                  0x06, 0x2D, 0x6B, 0x00, 0x5E, 0x01, 0x5E, 0x02, 0x24, 0x00,
+                  0x03});
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("result[0].a === 1 && result[0].b === 2");
+  ExpectScriptTrue("result[1].a === 3 && !('b' in result[1])");
+  ExpectScriptTrue("result[2].a === result[0] && result[2].b === result[1]");
+
+  // Shapes must be defined before they are used.
+  InvalidDecodeTest({0xFF, 0x0E, 0x6B, 0x01, 0x01, 0x22, 0x01, 0x61, 0x49,
+                     0x02});
+  // Keys must be strings.
+  InvalidDecodeTest({0xFF, 0x0E, 0x6B, 0x00, 0x01, 0x49, 0x02, 0x49, 0x02});
+  // Keys must be unique.
+  InvalidDecodeTest({0xFF, 0x0E, 0x6B, 0x00, 0x02, 0x22, 0x01, 0x61, 0x22,
+                     0x01, 0x61, 0x49, 0x02, 0x49, 0x04});
+}
+
 TEST_F(ValueSerializerTest, DecodeDictionaryObjectVersion0) {
   // Empty object.
   Local<Value> value = DecodeTestForVersion0({0x7B, 0x00});
@@ -2050,6 +2096,149 @@ TEST_F(ValueSerializerTestWithSharedArrayBufferClone,
   i::FLAG_experimental_wasm_threads = flag_was_enabled;
 }
 
+class ValueSerializerTestWithContentsByReference : public ValueSerializerTest {
+ protected:
+  static const size_t kTestByteLength = 1024;
+  // Smaller array buffers are copied by the delegate below.
+  static const size_t kMinByteLengthByReference = 64;
+
+  ValueSerializerTestWithContentsByReference()
+      : resource_("the quick brown fox jumps over the lazy dog"),
+        serializer_delegate_(this),
+        deserializer_delegate_(this) {
+    memset(data_, 42, sizeof(data_));
+    Context::Scope scope(serialization_context());
+    input_string_ =
+        String::NewExternalOneByte(isolate(), &resource_).ToLocalChecked();
+    input_buffer_ = ArrayBuffer::New(isolate(), data_, sizeof(data_));
+  }
+
+  const Local<String>& input_string() { return input_string_; }
+  const Local<ArrayBuffer>& input_buffer() { return input_buffer_; }
+
+  class TestResource : public String::ExternalOneByteStringResource {
+   public:
+    explicit TestResource(const char* data)
+        : data_(data), length_(strlen(data)) {}
+    const char* data() const override { return data_; }
+    size_t length() const override { return length_; }
+    // The resource is shared by the strings on both sides.
+    void Dispose() override {}
+
+   private:
+    const char* data_;
+    size_t length_;
+  };
+
+  class SerializerDelegate : public ValueSerializer::Delegate {
+   public:
+    explicit SerializerDelegate(
+        ValueSerializerTestWithContentsByReference* test)
+        : test_(test) {}
+    void ThrowDataCloneError(Local<String> message) override {
+      test_->isolate()->ThrowException(Exception::Error(message));
+    }
+    Maybe<uint32_t> GetExternalStringId(Isolate* isolate,
+                                        Local<String> string) override {
+      if (string->GetExternalOneByteStringResource() != &test_->resource_) {
+        return Nothing<uint32_t>();
+      }
+      return Just(0U);
+    }
+    Maybe<uint32_t> GetArrayBufferContentsId(
+        Isolate* isolate, Local<ArrayBuffer> array_buffer) override {
+      if (array_buffer->ByteLength() < kMinByteLengthByReference) {
+        return Nothing<uint32_t>();
+      }
+      test_->contents_.push_back(array_buffer->GetContents());
+      return Just(static_cast<uint32_t>(test_->contents_.size() - 1));
+    }
+
+   private:
+    ValueSerializerTestWithContentsByReference* test_;
+  };
+
+  class DeserializerDelegate : public ValueDeserializer::Delegate {
+   public:
+    explicit DeserializerDelegate(
+        ValueSerializerTestWithContentsByReference* test)
+        : test_(test) {}
+    MaybeLocal<String> GetExternalStringFromId(Isolate* isolate,
+                                               uint32_t id) override {
+      EXPECT_EQ(0U, id);
+      return String::NewExternalOneByte(isolate, &test_->resource_);
+    }
+    MaybeLocal<ArrayBuffer> GetArrayBufferFromContentsId(
+        Isolate* isolate, uint32_t id) override {
+      EXPECT_LT(id, test_->contents_.size());
+      const ArrayBuffer::Contents& contents = test_->contents_[id];
+      return ArrayBuffer::New(isolate, contents.Data(), contents.ByteLength());
+    }
+
+   private:
+    ValueSerializerTestWithContentsByReference* test_;
+  };
+
+  ValueSerializer::Delegate* GetSerializerDelegate() override {
+    return &serializer_delegate_;
+  }
+
+  ValueDeserializer::Delegate* GetDeserializerDelegate() override {
+    return &deserializer_delegate_;
+  }
+
+  uint8_t data_[kTestByteLength];
+  TestResource resource_;
+  std::vector<ArrayBuffer::Contents> contents_;
+  SerializerDelegate serializer_delegate_;
+  DeserializerDelegate deserializer_delegate_;
+
+ private:
+  Local<String> input_string_;
+  Local<ArrayBuffer> input_buffer_;
+};
+
+TEST_F(ValueSerializerTestWithContentsByReference, RoundTripExternalString) {
+  std::vector<uint8_t> encoded = EncodeTest(input_string());
+  // Only the header, the tag and the ID.
+  EXPECT_GT(static_cast<size_t>(resource_.length()), encoded.size());
+  Local<Value> value = DecodeTest(encoded);
+  ASSERT_TRUE(value->IsString());
+  EXPECT_TRUE(value.As<String>()->IsExternalOneByte());
+  EXPECT_EQ(&resource_, value.As<String>()->GetExternalOneByteStringResource());
+  ExpectScriptTrue("result === 'the quick brown fox jumps over the lazy dog'");
+
+  // Other strings are still copied.
+  RoundTripTest("'the quick brown fox'");
+  ExpectScriptTrue("result === 'the quick brown fox'");
+}
+
+TEST_F(ValueSerializerTestWithContentsByReference,
+       RoundTripArrayBufferContents) {
+  Local<Value> input;
+  {
+    Context::Scope scope(serialization_context());
+    input = Uint8Array::New(input_buffer(), 0, kTestByteLength);
+  }
+  std::vector<uint8_t> encoded = EncodeTest(input);
+  EXPECT_GT(kTestByteLength, encoded.size());
+  Local<Value> value = DecodeTest(encoded);
+  ASSERT_TRUE(value->IsUint8Array());
+  EXPECT_EQ(static_cast<void*>(data_),
+            value.As<Uint8Array>()->Buffer()->GetContents().Data());
+  ExpectScriptTrue("result.length === 1024 && result[1023] === 42");
+
+  // Both views share the one buffer on the deserializing side.
+  RoundTripTest("var a = new Uint8Array(1024); [a, new Uint16Array(a.buffer)]");
+  ExpectScriptTrue("result[0].buffer === result[1].buffer");
+  ExpectScriptTrue("result[1].length === 512");
+
+  // Small array buffers are still copied.
+  RoundTripTest("new Uint8Array([1, 2, 3])");
+  ExpectScriptTrue("result.toString() === '1,2,3'");
+  EXPECT_EQ(2u, contents_.size());
+}
+
 TEST_F(ValueSerializerTest, UnsupportedHostObject) {
   InvalidEncodeTest("new ExampleHostObject()");
   InvalidEncodeTest("({ a: new ExampleHostObject() })");
@@ -1465,6 +1465,49 @@ TEST_F(FunctionBodyDecoderTest, SimpleCalls) {
                     WASM_CALL_FUNCTION(2, WASM_I32V_1(37), WASM_I32V_2(77)));
 }
 
+TEST_F(FunctionBodyDecoderTest, SimpleReturnCalls) {
+  WASM_FEATURE_SCOPE(return_call);
+
+  FunctionSig* sig = sigs.i_i();
+  TestModuleBuilder builder;
+  module = builder.module();
+
+  builder.AddFunction(sigs.i_v());
+  builder.AddFunction(sigs.i_i());
+  builder.AddFunction(sigs.i_ii());
+
+  EXPECT_VERIFIES_S(sig, WASM_RETURN_CALL_FUNCTION0(0));
+  EXPECT_VERIFIES_S(sig, WASM_RETURN_CALL_FUNCTION(1, WASM_I32V_1(27)));
+  EXPECT_VERIFIES_S(
+      sig, WASM_RETURN_CALL_FUNCTION(2, WASM_I32V_1(37), WASM_I32V_2(77)));
+}
+
+TEST_F(FunctionBodyDecoderTest, ReturnCallsWithMismatchedReturns) {
+  WASM_FEATURE_SCOPE(return_call);
+
+  FunctionSig* sig = sigs.i_i();
+  TestModuleBuilder builder;
+  module = builder.module();
+
+  builder.AddFunction(sigs.l_v());
+  builder.AddFunction(sigs.v_v());
+  builder.AddFunction(sigs.f_f());
+
+  EXPECT_FAILURE_S(sig, WASM_RETURN_CALL_FUNCTION0(0));
+  EXPECT_FAILURE_S(sig, WASM_RETURN_CALL_FUNCTION0(1));
+  EXPECT_FAILURE_S(sig, WASM_RETURN_CALL_FUNCTION(2, WASM_F32(1.0)));
+}
+
+TEST_F(FunctionBodyDecoderTest, ReturnCallsWithoutFeature) {
+  FunctionSig* sig = sigs.i_i();
+  TestModuleBuilder builder;
+  module = builder.module();
+
+  builder.AddFunction(sigs.i_v());
+
+  EXPECT_FAILURE_S(sig, WASM_RETURN_CALL_FUNCTION0(0));
+}
+
 TEST_F(FunctionBodyDecoderTest, CallsWithTooFewArguments) {
   FunctionSig* sig = sigs.i_i();
   TestModuleBuilder builder;
@@ -1569,6 +1612,25 @@ TEST_F(FunctionBodyDecoderTest, SimpleIndirectCalls) {
                                              WASM_I32V_2(72)));
 }
 
+TEST_F(FunctionBodyDecoderTest, SimpleIndirectReturnCalls) {
+  WASM_FEATURE_SCOPE(return_call);
+
+  FunctionSig* sig = sigs.i_i();
+  TestModuleBuilder builder;
+  builder.InitializeTable();
+  module = builder.module();
+
+  byte f0 = builder.AddSignature(sigs.i_v());
+  byte f1 = builder.AddSignature(sigs.i_ii());
+  byte f2 = builder.AddSignature(sigs.l_v());
+
+  EXPECT_VERIFIES_S(sig, WASM_RETURN_CALL_INDIRECT0(f0, WASM_ZERO));
+  EXPECT_VERIFIES_S(sig, WASM_RETURN_CALL_INDIRECTN(2, f1, WASM_ZERO,
+                                                    WASM_I32V_1(32),
+                                                    WASM_I32V_2(72)));
+  EXPECT_FAILURE_S(sig, WASM_RETURN_CALL_INDIRECT0(f2, WASM_ZERO));
+}
+
 TEST_F(FunctionBodyDecoderTest, IndirectCallsOutOfBounds) {
   FunctionSig* sig = sigs.i_i();
   TestModuleBuilder builder;
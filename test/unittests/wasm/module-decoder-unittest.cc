@@ -1983,6 +1983,26 @@ TEST_F(WasmModuleVerifyTest, FunctionBodies_count_mismatch2) {
   EXPECT_FAILURE(data);
 }
 
+TEST_F(WasmModuleVerifyTest, FunctionBodies_first_error) {
+  static const byte data[] = {
+      WASM_MODULE_HEADER,                                  // --
+      SIGNATURES_SECTION(1, SIG_ENTRY_v_v),                // --
+      FUNCTION_SIGNATURES_SECTION(4, 0, 0, 0, 0),          // --
+      SECTION(Code, ENTRY_COUNT(4),                        // --
+              2, 0, kExprEnd,                              // valid
+              3, 0, kExprI32Add, kExprEnd,                 // invalid
+              2, 0, kExprEnd,                              // valid
+              3, 0, kExprI32Add, kExprEnd)                 // invalid
+  };
+  // Whether or not the bodies are validated in parallel, the error is the one
+  // of the first invalid function.
+  ModuleResult result = DecodeWasmModule(
+      enabled_features_, data, data + sizeof(data), true, kWasmOrigin,
+      isolate()->counters(), isolate()->allocator());
+  EXPECT_FALSE(result.ok());
+  EXPECT_THAT(result.error_msg(), HasSubstr("in function #1"));
+}
+
 TEST_F(WasmModuleVerifyTest, Names_empty) {
   static const byte data[] = {
       EMPTY_SIGNATURES_SECTION, EMPTY_FUNCTION_SIGNATURES_SECTION,
@@ -10,6 +10,7 @@
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-engine.h"
 #include "src/wasm/wasm-memory.h"
+#include "test/common/wasm/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -331,6 +332,38 @@ TEST_P(WasmCodeManagerTest, LookupWorksAfterRewrite) {
   CHECK_EQ(code1_1, manager()->LookupCode(code1_1->instruction_start()));
 }
 
+TEST_P(WasmCodeManagerTest, CodeGCFreesReplacedCode) {
+  FlagScope<bool> code_gc_scope(&FLAG_wasm_code_gc, true);
+  SetMaxCommittedMemory(2 * page());
+
+  NativeModulePtr nm1 = AllocModule(1 * page(), GetParam());
+
+  WasmCode* code0 = AddCode(nm1.get(), 0, kCodeAlignment);
+  WasmCode* code1 = AddCode(nm1.get(), 1, kCodeAlignment);
+  Address code0_start = code0->instruction_start();
+  Address code1_start = code1->instruction_start();
+  CHECK(!manager()->StartCodeGC());
+
+  WasmCode* code0_1 = AddCode(nm1.get(), 0, kCodeAlignment);
+  WasmCode* code1_1 = AddCode(nm1.get(), 1, kCodeAlignment);
+  CHECK(manager()->StartCodeGC());
+  // {code1} is still on a stack.
+  manager()->MarkLiveCodeForGC(Vector<WasmCode* const>(&code1, 1));
+  manager()->FinishCodeGC();
+
+  CHECK_NULL(manager()->LookupCode(code0_start));
+  CHECK_EQ(code1, manager()->LookupCode(code1_start));
+  CHECK_EQ(code0_1, manager()->LookupCode(code0_1->instruction_start()));
+  CHECK_EQ(code1_1, manager()->LookupCode(code1_1->instruction_start()));
+  CHECK_EQ(code0_1, nm1->code(0));
+  CHECK_EQ(code1_1, nm1->code(1));
+
+  // The next code GC frees {code1}.
+  CHECK(manager()->StartCodeGC());
+  manager()->FinishCodeGC();
+  CHECK_NULL(manager()->LookupCode(code1_start));
+}
+
 }  // namespace wasm_heap_unittest
 }  // namespace wasm
 }  // namespace internal
@@ -21,12 +21,42 @@ TEST(Zone, SegmentPoolConstraints) {
     size_t total_size = 0;
     for (size_t power = 0; power < AccountingAllocator::kNumberBuckets;
          ++power) {
-      total_size +=
-          allocator.unused_segments_max_sizes_[power] * (size_t(1) << power);
+      total_size += allocator.unused_segments_max_sizes_[power] *
+                    (size_t(1)
+                     << (power + AccountingAllocator::kMinSegmentSizePower));
     }
     EXPECT_LE(total_size, size);
   }
 }
 
+TEST(Zone, SegmentPoolReuse) {
+  AccountingAllocator allocator;
+  const size_t min_size = size_t(1)
+                          << AccountingAllocator::kMinSegmentSizePower;
+
+  // Odd sizes are rounded up to their size class, so a segment returned to
+  // the pool serves any later request of that class.
+  Segment* segment = allocator.GetSegment(min_size + 1);
+  EXPECT_EQ(2 * min_size, segment->size());
+  allocator.ReturnSegment(segment);
+  EXPECT_EQ(2 * min_size, allocator.GetCurrentPoolSize());
+  EXPECT_EQ(segment, allocator.GetSegment(2 * min_size - 1));
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+  allocator.ReturnSegment(segment);
+
+  // Memory pressure releases the pool and disables pooling ...
+  allocator.MemoryPressureNotification(MemoryPressureLevel::kCritical);
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+  segment = allocator.GetSegment(min_size);
+  allocator.ReturnSegment(segment);
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+
+  // ... until it is over.
+  allocator.MemoryPressureNotification(MemoryPressureLevel::kNone);
+  segment = allocator.GetSegment(min_size);
+  allocator.ReturnSegment(segment);
+  EXPECT_EQ(min_size, allocator.GetCurrentPoolSize());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,83 @@
+#!/usr/bin/env python
+# Copyright 2019 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+'''
+Usage: decode-binary-log.py <binary log> [<text log>]
+
+Turns a log written with --log-binary-ticks back into the text format, so
+that it can be fed to the tick, ic and map processors. Writes to stdout if
+no output file is given.
+
+Text lines are copied unchanged. Binary records start with a NUL byte, which
+never starts a text line, and are little-endian:
+
+  uint8  marker (always 0)
+  uint8  type (1 = tick)
+  uint8  flags (1 = has external callback, 2 = overflow)
+  uint8  vm state
+  uint32 frames count
+  uint64 pc
+  int64  timestamp in microseconds
+  uint64 top of stack, or the external callback entry
+  uint64 frames[frames count]
+'''
+
+import struct
+import sys
+
+TICK_HEADER = struct.Struct('<BBBBIQqQ')
+FRAME = struct.Struct('<Q')
+
+TICK = 1
+HAS_EXTERNAL_CALLBACK = 1 << 0
+OVERFLOW = 1 << 1
+
+
+def DecodeTick(data, position, out):
+  (_, record_type, flags, state, frames_count, pc, timestamp,
+   tos_or_external_callback) = TICK_HEADER.unpack_from(data, position)
+  if record_type != TICK:
+    raise ValueError('unknown record type %d at offset %d' %
+                     (record_type, position))
+  position += TICK_HEADER.size
+  fields = ['tick', '0x%x' % pc, '%d' % timestamp,
+            '1' if flags & HAS_EXTERNAL_CALLBACK else '0',
+            '0x%x' % tos_or_external_callback, '%d' % state]
+  if flags & OVERFLOW:
+    fields.append('overflow')
+  for _ in range(frames_count):
+    fields.append('0x%x' % FRAME.unpack_from(data, position))
+    position += FRAME.size
+  out.write((','.join(fields) + '\n').encode('ascii'))
+  return position
+
+
+def Decode(data, out):
+  position = 0
+  while position < len(data):
+    if data[position:position + 1] == b'\0':
+      position = DecodeTick(data, position, out)
+      continue
+    end = data.find(b'\n', position)
+    end = len(data) if end == -1 else end + 1
+    out.write(data[position:end])
+    position = end
+
+
+def Main(argv):
+  if len(argv) not in (2, 3):
+    sys.stderr.write(__doc__)
+    return 1
+  with open(argv[1], 'rb') as f:
+    data = f.read()
+  if len(argv) == 3:
+    with open(argv[2], 'wb') as out:
+      Decode(data, out)
+  else:
+    Decode(data, getattr(sys.stdout, 'buffer', sys.stdout))
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(Main(sys.argv))
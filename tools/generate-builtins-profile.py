@@ -0,0 +1,58 @@
+#!/usr/bin/env python
+# Copyright 2019 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+'''
+Usage: generate-builtins-profile.py <v8.log> [<v8.log> ...]
+
+Counts the ticks in builtins in logs written with --prof, and prints them as
+a profile for mksnapshot's --embedded-builtins-profile (or the GN arg
+v8_embedded_builtins_profile), hottest first:
+
+  <builtin name> <ticks>
+
+Only the sampled pc is counted, not the callers on the stack. Logs written
+with --log-binary-ticks must be decoded with decode-binary-log.py first.
+'''
+
+import bisect
+import collections
+import sys
+
+
+def ReadLog(path, builtins, ticks):
+  with open(path) as log:
+    for line in log:
+      fields = line.rstrip('\n').split(',')
+      if fields[0] == 'code-creation' and len(fields) >= 7 and \
+          fields[1] == 'Builtin':
+        builtins.append((int(fields[4], 16), int(fields[5], 0), fields[6]))
+      elif fields[0] == 'tick' and len(fields) >= 2:
+        ticks.append(int(fields[1], 16))
+
+
+def Main(argv):
+  if len(argv) < 2:
+    sys.stderr.write(__doc__)
+    return 1
+  builtins = []
+  ticks = []
+  for path in argv[1:]:
+    ReadLog(path, builtins, ticks)
+  builtins.sort()
+  starts = [start for start, _, _ in builtins]
+  counts = collections.Counter()
+  for pc in ticks:
+    index = bisect.bisect_right(starts, pc) - 1
+    if index < 0: continue
+    start, size, name = builtins[index]
+    if pc < start + size:
+      counts[name] += 1
+  for name, count in sorted(counts.items(), key=lambda item: (-item[1],
+                                                               item[0])):
+    print('%s %d' % (name, count))
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(Main(sys.argv))